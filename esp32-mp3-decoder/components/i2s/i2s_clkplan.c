@@ -0,0 +1,116 @@
+/******************************************************************************
+ * FileName: i2s_clkplan.c
+ *
+ * Description: Works out the I2S clock divider settings for a sample rate.
+ * Besides the integer clock and bit clock dividers, the ESP32 I2S clock has a
+ * fractional divider, so most rates can be made to within a fraction of a ppm
+ * instead of the hundreds of ppm integer dividers give. This is pure math,
+ * without any hardware access, so it can be built and checked on a host.
+ *
+ * The plans for the nine MPEG sample rates are precomputed in i2s_clktab.h,
+ * so switching between those is just a table lookup. To regenerate it:
+ *   gcc -DI2S_CLKPLAN_GENTAB -Iinclude i2s_clkplan.c -lm -o gentab && ./gentab > i2s_clktab.h
+ *
+*******************************************************************************/
+#include <stdlib.h>
+#include <math.h>
+
+#include "i2s_clkplan.h"
+#ifndef I2S_CLKPLAN_GENTAB
+#include "i2s_clktab.h"
+#endif
+
+/*
+	CLK_I2S = 160MHz / (I2S_CLKM_DIV_NUM + I2S_CLKM_DIV_B/I2S_CLKM_DIV_A)
+	BCLK = CLK_I2S / I2S_BCK_DIV_NUM
+	WS = BCLK/ 2 / (16 + I2S_BITS_MOD)
+	Note that I2S_CLKM_DIV_NUM must be >5 for I2S data
+	I2S_CLKM_DIV_NUM - 5-63 (same range as the old integer-only search)
+	I2S_CLKM_DIV_A, I2S_CLKM_DIV_B - 6 bits, with B<A
+	I2S_BCK_DIV_NUM - 2-63
+
+	We also have the option to send out more than 2x16 bit per sample. Most I2S codecs will
+	ignore the extra bits and in the case of the 'fake' PWM/delta-sigma outputs, they will just lower the output
+	voltage a bit. With the fractional divider this is hardly ever needed anymore, so only a word length
+	that's really better than 16 bits is used.
+
+	The fractional divider works by alternating between dividing by N and N+1; a plan without a fraction
+	is preferred when it's just as good, because it has no jitter.
+*/
+
+//Find the divider settings that get closest to the given sample rate.
+void i2sClkPlan(int rate, int enaWordlenFuzzing, struct i2sClkPlan *plan) {
+	int bits, bckdiv, clkmdiv, a, b;
+	long long den, rem;
+	double err, bestErr=1e9;
+
+	plan->rate=rate;
+	plan->clkmDiv=5;
+	plan->clkmDivA=0;
+	plan->clkmDivB=0;
+	plan->bckDiv=2;
+	plan->bits=16;
+	for (bits=16; bits<(enaWordlenFuzzing?20:17); bits++) {
+		for (bckdiv=2; bckdiv<64; bckdiv++) {
+			//The total divider we'd need is BASEFREQ/den; split it into an integer part and a fraction.
+			den=(long long)rate*2*bits*bckdiv;
+			clkmdiv=I2S_CLKPLAN_BASEFREQ/den;
+			rem=I2S_CLKPLAN_BASEFREQ%den;
+			if (clkmdiv<5 || clkmdiv>63) continue;
+			//Try every denominator, with the numerator closest to the fraction we need.
+			for (a=1; a<64; a++) {
+				b=(rem*a+den/2)/den;
+				//Rounding up to a whole extra step of the integer divider
+				if (b==a && clkmdiv==63) continue;
+				err=(double)I2S_CLKPLAN_BASEFREQ*a/((double)(clkmdiv*a+b)*den)-1.0;
+				if (fabs(err)<fabs(bestErr)-1e-12 || (fabs(err)<=fabs(bestErr)+1e-12 && (b==0 || b==a) && plan->clkmDivB!=0)) {
+					bestErr=err;
+					plan->bits=bits;
+					plan->bckDiv=bckdiv;
+					if (b==0 || b==a) {
+						//No fraction after all
+						plan->clkmDiv=clkmdiv+(b==a);
+						plan->clkmDivA=0;
+						plan->clkmDivB=0;
+					} else {
+						plan->clkmDiv=clkmdiv;
+						plan->clkmDivA=a;
+						plan->clkmDivB=b;
+					}
+				}
+			}
+		}
+	}
+	plan->errPpb=(int)lrint(bestErr*1e9);
+}
+
+#ifndef I2S_CLKPLAN_GENTAB
+//Get the precomputed plan for one of the MPEG sample rates, or NULL if it's not in the table. All
+//of these are 16-bit plans, which are fine with or without word length fuzzing.
+const struct i2sClkPlan *i2sClkPlanLookup(int rate) {
+	int i;
+	for (i=0; i<(int)(sizeof(i2sClkTab)/sizeof(i2sClkTab[0])); i++) {
+		if (i2sClkTab[i].rate==rate) return &i2sClkTab[i];
+	}
+	return NULL;
+}
+
+#else
+#include <stdio.h>
+
+//Host-side generator for i2s_clktab.h
+int main() {
+	static const int rates[]={8000, 11025, 12000, 16000, 22050, 24000, 32000, 44100, 48000};
+	struct i2sClkPlan p;
+	int i;
+	printf("//Generated by i2s_clkplan.c with -DI2S_CLKPLAN_GENTAB; don't edit by hand.\n");
+	printf("//rate, clkmDiv, clkmDivA, clkmDivB, bckDiv, bits, errPpb\n");
+	printf("static const struct i2sClkPlan i2sClkTab[]={\n");
+	for (i=0; i<(int)(sizeof(rates)/sizeof(rates[0])); i++) {
+		i2sClkPlan(rates[i], 0, &p);
+		printf("\t{%d, %d, %d, %d, %d, %d, %d},\n", p.rate, p.clkmDiv, p.clkmDivA, p.clkmDivB, p.bckDiv, p.bits, p.errPpb);
+	}
+	printf("};\n");
+	return 0;
+}
+#endif
@@ -0,0 +1,13 @@
+//Generated by i2s_clkplan.c with -DI2S_CLKPLAN_GENTAB; don't edit by hand.
+//rate, clkmDiv, clkmDivA, clkmDivB, bckDiv, bits, errPpb
+static const struct i2sClkPlan i2sClkTab[]={
+	{8000, 25, 0, 0, 25, 16, 0},
+	{11025, 32, 33, 13, 14, 16, -909},
+	{12000, 59, 21, 11, 7, 16, 0},
+	{16000, 62, 2, 1, 5, 16, 0},
+	{22050, 32, 33, 13, 7, 16, -909},
+	{24000, 52, 12, 1, 4, 16, 0},
+	{32000, 52, 12, 1, 3, 16, 0},
+	{44100, 22, 37, 25, 5, 16, 2703},
+	{48000, 52, 12, 1, 2, 16, 0},
+};
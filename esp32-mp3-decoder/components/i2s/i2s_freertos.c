@@ -7,8 +7,8 @@
  *
  * FileName: i2s_freertos.c
  *
- * Description: I2S output routines for a FreeRTOS system. Uses DMA and a queue
- * to abstract away the nitty-gritty details.
+ * Description: I2S output routines for a FreeRTOS system. Uses DMA and a ring
+ * of buffers to abstract away the nitty-gritty details.
  *
  * Modification history:
  *     2015/06/01, v1.0 File created.
@@ -37,13 +37,21 @@ How does this work? Basically, to get sound, you need to:
 - Start up a thread that's going to do the sound output
 - Call I2sInit()
 - Call I2sSetRate() with the sample rate you want.
-- Generate sound and call i2sPushSample() with 32-bit samples.
+- Generate sound and call i2sPushSample() with 32-bit samples, or i2sPushSamples()
+  with a bunch of them. Alternatively, get a piece of DMA buffer memory with
+  i2sBorrowBuffer(), write the samples in there and hand them over using
+  i2sCommitBuffer().
 The 32bit samples basically are 2 16-bit signed values (the analog values for
 the left and right channel) concatenated as (Rout<<16)+Lout
 
 I2sPushSample will block when you're sending data too quickly, so you can just
 generate and push data as fast as you can and I2sPushSample will regulate the
 speed.
+
+To see where playback is, compare i2sGetSamplesWritten() with
+i2sGetSamplesConsumed(): the difference (i2sGetQueuedSamples()) is the audio
+that is written but hasn't come out yet. i2sGetSamplesPlayed() is a clock that
+counts every sample the port sends, including silence during underruns.
 */
 
 #include "soc/i2s_reg.h"
@@ -61,29 +69,83 @@ speed.
 #include "soc/gpio_reg.h"
 #include "rom/gpio.h"
 #include "i2s_freertos.h"
+#include "i2s_clkplan.h"
+#include "xtensa/hal.h"
+#include "esp_timer.h"
 
 #include <stdio.h>
+#include <string.h>
+#include <stdatomic.h>
 
 //Pointer to the I2S DMA buffer data
 static uint8_t *i2sBuf[I2SDMABUFCNT];
 //I2S DMA buffer descriptors
 static lldesc_t i2sBufDesc[I2SDMABUFCNT];
-//Queue which contains empty DMA buffers
-static xQueueHandle dmaQueue;
+//Amount of buffers the DMA engine has finished sending. It goes through the descriptors in order, so
+//the buffer it's sending right now is dmaDone%I2SDMABUFCNT. Only the ISR changes this. It starts at
+//I2SDMABUFCNT rather than 0, so the buffers the DMA engine gets to after the first two are free to fill
+//right away.
+static atomic_uint dmaDone;
+//Descriptor the ISR expects to finish next
+static int isrNextDesc;
+//Amount of buffers the writer has taken to fill. Buffer n may be filled when the DMA engine has finished
+//it and hasn't come around to it again: wrTaken<=n<dmaDone, and dmaDone-n<I2SDMABUFCNT. Only the
+//writer changes this.
+static atomic_uint wrTaken;
+//Set when the writer sleeps because all buffers are full. The ISR wakes it with a task notification.
+static atomic_int wrWaiting;
+static xTaskHandle wrTask;
+#ifdef I2S_UNDERRUN_SILENCE
+//Played instead of a buffer the writer didn't refill in time
+static uint32_t *silenceBuf;
+#endif
+//Amount of samples the writer has committed. Only the writer uses wrCount; it publishes it to wrSamples
+//for the other tasks once per DMA buffer and on every i2sCommitBuffer, so i2sPushSample doesn't have to
+//do an atomic store for every sample.
+static unsigned int wrCount;
+static atomic_uint wrSamples;
+//Amount of those samples the DMA engine has finished sending. Only the ISR changes this.
+static atomic_uint wrConsumed;
+//Per descriptor: set when the writer hands it a buffer of samples, cleared when the DMA engine is done
+//with it. descEnd is the value of wrSamples after the last sample in the buffer.
+static atomic_int descLive[I2SDMABUFCNT];
+static unsigned int descEnd[I2SDMABUFCNT];
+//Held by the ISR while it retires descriptors and by the writer while it hands one over, so the writer's
+//check that it isn't too late and the handover itself happen as one step for the ISR on the other core.
+static portMUX_TYPE descMux=portMUX_INITIALIZER_UNLOCKED;
+//Current sample rate
+static int curRate;
+//What the ISR knows about the progress of the DMA engine: the total amount of buffers it has finished
+//(this one doesn't wrap), the time it last finished one, in uS, and the sample rate at that time. The
+//ISR makes isrSeq odd while it updates these and wrConsumed/descLive/wakeStart, and even again when it's
+//done; a reader checks it before and after reading, and tries again if it was odd or has changed.
+static atomic_uint isrSeq;
+static unsigned long long dmaTotal;
+static int64_t eofTime;
+static int eofRate;
 //DMA underrun counter
 static long underrunCnt;
+//Longest ISR run, in CPU cycles, and longest time between the ISR waking the writer and the writer
+//getting a buffer, in uS, since the last i2sGetTimingStats call. The ISR and the writer can run on
+//different cores, which don't share a cycle counter, so the wakeup is timed with esp_timer. wakeStart
+//is the time the ISR last woke the writer; it's 64 bits, so it's read through isrSeq.
+static uint32_t isrMaxCycles;
+static int64_t wakeMaxUs;
+static int64_t wakeStart;
 
 static intr_handle_t ih;
 
 //This routine is called as soon as the DMA routine has something to tell us. All we
-//handle here is the RX_EOF_INT status, which indicate the DMA has sent a buffer whose
-//descriptor has the 'EOF' field set to 1.
+//handle here is the OUT_EOF_INT status, which indicate the DMA has sent a buffer whose
+//descriptor has the 'EOF' field set to 1. The writer works out by itself which buffers are
+//free from the amount of buffers done, so all this does is count.
 static void IRAM_ATTR i2s_isr(void* arg) {
 	portBASE_TYPE HPTaskAwoken=0;
-
-    lldesc_t *finishedDesc;
+	uint32_t t=xthal_get_ccount();
+	lldesc_t *finishedDesc;
 	uint32_t slc_intr_status;
-	int dummy;
+	int idx, n, wake;
+	unsigned int done, seq;
 
 	slc_intr_status = READ_PERI_REG(I2S_INT_ST_REG(0));
 	if (slc_intr_status == 0) {
@@ -93,17 +155,50 @@ static void IRAM_ATTR i2s_isr(void* arg) {
 	//clear all intrs
 	WRITE_PERI_REG(I2S_INT_CLR_REG(0), 0xffffffff);
 	if (slc_intr_status & I2S_OUT_EOF_INT_ST) {
-		//The DMA subsystem is done with this block: Push it on the queue so it can be re-used.
 		finishedDesc=(lldesc_t*)READ_PERI_REG(I2S_OUT_EOF_DES_ADDR_REG(0));
-		if (xQueueIsQueueFullFromISR(dmaQueue)) {
-			//All buffers are empty. This means we have an underflow on our hands.
-			underrunCnt++;
-			//Pop the top off the queue; it's invalid now anyway.
-			xQueueReceiveFromISR(dmaQueue, &dummy, &HPTaskAwoken);
+		idx=finishedDesc-i2sBufDesc;
+		//Normally this is the descriptor after the previous one, but if an interrupt got lost we may
+		//have skipped one or more.
+		n=idx-isrNextDesc;
+		if (n<0) n+=I2SDMABUFCNT;
+		portENTER_CRITICAL_ISR(&descMux);
+		seq=atomic_load_explicit(&isrSeq, memory_order_relaxed);
+		atomic_store_explicit(&isrSeq, seq+1, memory_order_relaxed);
+		atomic_thread_fence(memory_order_release);
+		//These buffers have been played, and so have the samples the writer put in them. The acquire
+		//pairs with the writer's store to descLive, so descEnd is the value it wrote before that.
+		while (1) {
+			if (atomic_load_explicit(&descLive[isrNextDesc], memory_order_acquire)) {
+				atomic_store(&wrConsumed, descEnd[isrNextDesc]);
+				atomic_store_explicit(&descLive[isrNextDesc], 0, memory_order_relaxed);
+			}
+#ifdef I2S_UNDERRUN_SILENCE
+			//If the writer doesn't refill them in time, play silence instead.
+			i2sBufDesc[isrNextDesc].buf=(uint8_t*)silenceBuf;
+#endif
+			if (isrNextDesc==idx) break;
+			if (++isrNextDesc==I2SDMABUFCNT) isrNextDesc=0;
 		}
-		//Dump the buffer on the queue so the rest of the software can fill it.
-		xQueueSendFromISR(dmaQueue, (void*)(&finishedDesc->buf), &HPTaskAwoken);
+		//esp_timer_get_time is IRAM_ATTR in IDF v3.0 (which this sdkconfig comes from) and later, so it's
+		//fine to call from here.
+		eofTime=esp_timer_get_time();
+		eofRate=curRate;
+		dmaTotal+=n+1;
+		isrNextDesc=idx+1;
+		if (isrNextDesc==I2SDMABUFCNT) isrNextDesc=0;
+		done=atomic_load_explicit(&dmaDone, memory_order_relaxed)+n+1;
+		atomic_store(&dmaDone, done);
+		//If the writer sleeps until a buffer is done, it's this interrupt that wakes it.
+		wake=atomic_exchange(&wrWaiting, 0);
+		if (wake) wakeStart=eofTime;
+		atomic_store_explicit(&isrSeq, seq+2, memory_order_release);
+		portEXIT_CRITICAL_ISR(&descMux);
+		//If every buffer is waiting to be filled, the DMA engine is going to play one that wasn't.
+		if (done-atomic_load(&wrTaken)>=I2SDMABUFCNT) underrunCnt++;
+		if (wake) vTaskNotifyGiveFromISR(wrTask, &HPTaskAwoken);
 	}
+	t=xthal_get_ccount()-t;
+	if (t>isrMaxCycles) isrMaxCycles=t;
 	//We're done.
 	if(HPTaskAwoken == pdTRUE) {
 		portYIELD_FROM_ISR();
@@ -116,7 +211,25 @@ void i2sInit() {
 	int x, y;
 	
 	underrunCnt=0;
-	
+	//The DMA engine starts on descriptor 0, and descriptor 1 counts as too late (see nextBuffer), so the
+	//writer can fill 2 to I2SDMABUFCNT-1 before the DMA engine gets there.
+	atomic_store(&dmaDone, I2SDMABUFCNT);
+	atomic_store(&wrTaken, 2);
+	atomic_store(&wrWaiting, 0);
+	isrNextDesc=0;
+	wrCount=0;
+	atomic_store(&wrSamples, 0);
+	atomic_store(&wrConsumed, 0);
+	for (x=0; x<I2SDMABUFCNT; x++) atomic_store(&descLive[x], 0);
+	atomic_store(&isrSeq, 0);
+	dmaTotal=0;
+	eofTime=esp_timer_get_time();
+	eofRate=I2S_DEFAULT_SAMPLE_RATE;
+	isrMaxCycles=0;
+	wakeMaxUs=0;
+#ifdef I2S_UNDERRUN_SILENCE
+	silenceBuf=calloc(I2SDMABUFLEN, 4);
+#endif
 	
 	//Take care of the DMA buffers.
 	for (y=0; y<I2SDMABUFCNT; y++) {
@@ -155,7 +268,12 @@ void i2sInit() {
 		i2sBufDesc[x].sosf=0;
 		i2sBufDesc[x].length=I2SDMABUFLEN*4;
 		i2sBufDesc[x].size=I2SDMABUFLEN*4;
+#ifdef I2S_UNDERRUN_SILENCE
+		//Nothing has been written yet
+		i2sBufDesc[x].buf=(uint8_t*)silenceBuf;
+#else
 		i2sBufDesc[x].buf=&i2sBuf[x][0];
+#endif
 		i2sBufDesc[x].offset=0;
 		i2sBufDesc[x].empty=(uint32_t)((x<(I2SDMABUFCNT-1))?(&i2sBufDesc[x+1]):(&i2sBufDesc[0]));
 	}
@@ -170,13 +288,6 @@ void i2sInit() {
     SET_PERI_REG_MASK(I2S_IN_LINK_REG(0), ((uint32_t)(&i2sBufDesc[1]))&I2S_INLINK_ADDR);
 
 
-	//We use a queue to keep track of the DMA buffers that are empty. The ISR will push buffers to the back of the queue,
-	//the mp3 decode will pull them from the front and fill them. For ease, the queue will contain *pointers* to the DMA
-	//buffers, not the data itself. The queue depth is one smaller than the amount of buffers we have, because there's
-	//always a buffer that is being used by the DMA subsystem *right now* and we don't want to be able to write to that
-	//simultaneously.
-	dmaQueue=xQueueCreate(I2SDMABUFCNT-1, sizeof(int*));
-
 	//Init pins to i2s functions
 	//Use GPIO 16/17/18 as I2S port
 	gpio_config_t io_conf;
@@ -233,75 +344,245 @@ void i2sInit() {
 }
 
 
-#define BASEFREQ (160000000L)
-#define ABS(x) (((x)>0)?(x):(-(x)))
+//Error of the current sample rate, in ppb
+static int rateErrPpb;
 
-//Set the I2S sample rate, in HZ
+//Set the I2S sample rate, in HZ. The divider settings for the MPEG sample rates are precomputed;
+//anything else gets planned on the spot.
 void i2sSetRate(int rate, int enaWordlenFuzzing) {
-	//Find closest divider 
-	int bestclkmdiv=5, bestbckdiv=2, bestbits=16, bestfreq=-10000;
-	int tstfreq;
-	int bckdiv, clkmdiv, bits=16;
-	/*
-		CLK_I2S = 160MHz / I2S_CLKM_DIV_NUM
-		BCLK = CLK_I2S / I2S_BCK_DIV_NUM
-		WS = BCLK/ 2 / (16 + I2S_BITS_MOD)
-		Note that I2S_CLKM_DIV_NUM must be >5 for I2S data
-		I2S_CLKM_DIV_NUM - 5-127
-		I2S_BCK_DIV_NUM - 2-127
-		
-		We also have the option to send out more than 2x16 bit per sample. Most I2S codecs will
-		ignore the extra bits and in the case of the 'fake' PWM/delta-sigma outputs, they will just lower the output
-		voltage a bit, so we add them when it makes sense.
-	*/
-	for (bckdiv=2; bckdiv<64; bckdiv++) {
-		for (clkmdiv=5; clkmdiv<64; clkmdiv++) {
-			for (bits=16; bits<(enaWordlenFuzzing?20:17); bits++) {
-				tstfreq=BASEFREQ/(bckdiv*clkmdiv*bits*2);
-				if (ABS(rate-tstfreq)<ABS(rate-bestfreq)) {
-					bestfreq=tstfreq;
-					bestclkmdiv=clkmdiv;
-					bestbckdiv=bckdiv;
-					bestbits=bits;
-				}
-			}
-		}
+	struct i2sClkPlan plan;
+	const struct i2sClkPlan *p=i2sClkPlanLookup(rate);
+	if (p==NULL) {
+		i2sClkPlan(rate, enaWordlenFuzzing, &plan);
+		p=&plan;
 	}
+	curRate=rate;
+	rateErrPpb=p->errPpb;
 
-	printf("ReqRate %d MDiv %d BckDiv %d Bits %d  Frq %d\n", 
-		rate, bestclkmdiv, bestbckdiv, bestbits, (int)(BASEFREQ/(bestbckdiv*bestclkmdiv*bestbits*2)));	
+	printf("ReqRate %d MDiv %d+%d/%d BckDiv %d Bits %d  Err %d ppb\n", 
+		rate, p->clkmDiv, p->clkmDivB, p->clkmDivA, p->bckDiv, p->bits, p->errPpb);
 	
-	SET_PERI_REG_BITS(I2S_SAMPLE_RATE_CONF_REG(0), I2S_RX_BITS_MOD, bestbits, I2S_RX_BITS_MOD_S);
-    SET_PERI_REG_BITS(I2S_SAMPLE_RATE_CONF_REG(0), I2S_TX_BITS_MOD, bestbits, I2S_TX_BITS_MOD_S);
+	SET_PERI_REG_BITS(I2S_SAMPLE_RATE_CONF_REG(0), I2S_RX_BITS_MOD, p->bits, I2S_RX_BITS_MOD_S);
+    SET_PERI_REG_BITS(I2S_SAMPLE_RATE_CONF_REG(0), I2S_TX_BITS_MOD, p->bits, I2S_TX_BITS_MOD_S);
+
+    SET_PERI_REG_BITS(I2S_SAMPLE_RATE_CONF_REG(0), I2S_RX_BCK_DIV_NUM, p->bckDiv, I2S_RX_BCK_DIV_NUM_S);
+    SET_PERI_REG_BITS(I2S_SAMPLE_RATE_CONF_REG(0), I2S_TX_BCK_DIV_NUM, p->bckDiv, I2S_TX_BCK_DIV_NUM_S);
 
-    SET_PERI_REG_BITS(I2S_SAMPLE_RATE_CONF_REG(0), I2S_RX_BCK_DIV_NUM, bestbckdiv, I2S_RX_BCK_DIV_NUM_S);
-    SET_PERI_REG_BITS(I2S_SAMPLE_RATE_CONF_REG(0), I2S_TX_BCK_DIV_NUM, bestbckdiv, I2S_TX_BCK_DIV_NUM_S);
 
+	SET_PERI_REG_BITS(I2S_CLKM_CONF_REG(0), I2S_CLKM_DIV_A, p->clkmDivA, I2S_CLKM_DIV_A_S);
+    SET_PERI_REG_BITS(I2S_CLKM_CONF_REG(0), I2S_CLKM_DIV_B, p->clkmDivB, I2S_CLKM_DIV_B_S);
+    SET_PERI_REG_BITS(I2S_CLKM_CONF_REG(0), I2S_CLKM_DIV_NUM, p->clkmDiv, I2S_CLKM_DIV_NUM_S);  //Setting to 0 wrecks it up.
+}
+
+//How far the actual sample rate is off from the one asked for in i2sSetRate, in parts per billion.
+//Positive means the I2S port runs too fast.
+int i2sGetRateError() {
+	return rateErrPpb;
+}
 
-	SET_PERI_REG_BITS(I2S_CLKM_CONF_REG(0), I2S_CLKM_DIV_A, 0, I2S_CLKM_DIV_A_S);
-    SET_PERI_REG_BITS(I2S_CLKM_CONF_REG(0), I2S_CLKM_DIV_B, 0, I2S_CLKM_DIV_B_S);
-    SET_PERI_REG_BITS(I2S_CLKM_CONF_REG(0), I2S_CLKM_DIV_NUM, bestclkmdiv, I2S_CLKM_DIV_NUM_S);  //Setting to 0 wrecks it up.
+//Sample rate the I2S port is set to, as asked for in i2sSetRate. This is the rate the queued samples
+//play at, which isn't the rate of the mp3 stream when the output is rate converted.
+int i2sGetRate() {
+	return curRate;
 }
 
 //Current DMA buffer we're writing to
-static unsigned int *currDMABuff=NULL;
+static uint32_t *currDMABuff=NULL;
 //Current position in that DMA buffer
 static int currDMABuffPos=0;
 
+//Read wakeStart, which the ISR may be writing on the other core at the same time.
+static int64_t getWakeStart() {
+	unsigned int seq;
+	int64_t t;
+	do {
+		seq=atomic_load_explicit(&isrSeq, memory_order_acquire);
+		t=wakeStart;
+		atomic_thread_fence(memory_order_acquire);
+	} while ((seq&1) || atomic_load_explicit(&isrSeq, memory_order_relaxed)!=seq);
+	return t;
+}
+
+//Hand the buffer we're writing to over to the DMA engine and take the next free one. Blocks until the
+//DMA engine has finished sending one if there is none.
+static void nextBuffer() {
+	unsigned int taken=atomic_load_explicit(&wrTaken, memory_order_relaxed);
+	unsigned int done;
+	int64_t t;
+	int k, woken;
+	atomic_store_explicit(&wrSamples, wrCount, memory_order_release);
+	//The buffer is complete; have the DMA engine play it. If it's already busy sending it (or past it),
+	//this is too late: its samples never count as played, and in silence mode the ISR will make it
+	//play silence again when it's done with it. The DMA engine starts on a buffer a little before the
+	//ISR hears the previous one is done, so the buffer right after the last one the ISR has seen finish
+	//counts as too late as well.
+	if (currDMABuff!=NULL) {
+		k=(taken-1)%I2SDMABUFCNT;
+		portENTER_CRITICAL(&descMux);
+		if (atomic_load(&dmaDone)-(taken-1)<I2SDMABUFCNT-1) {
+			descEnd[k]=wrCount;
+			atomic_store_explicit(&descLive[k], 1, memory_order_release);
+#ifdef I2S_UNDERRUN_SILENCE
+			i2sBufDesc[k].buf=i2sBuf[k];
+#endif
+		}
+		portEXIT_CRITICAL(&descMux);
+	}
+	done=atomic_load(&dmaDone);
+	if (done==taken) {
+		//All buffers are full. Sleep until the ISR tells us one is done.
+		wrTask=xTaskGetCurrentTaskHandle();
+		do {
+			atomic_store(&wrWaiting, 1);
+			if (atomic_load(&dmaDone)==taken) ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+			//If the ISR cleared the flag, it woke us and noted when.
+			woken=!atomic_exchange(&wrWaiting, 0);
+			done=atomic_load(&dmaDone);
+		} while (done==taken);
+		if (woken) {
+			t=esp_timer_get_time()-getWakeStart();
+			if (t>wakeMaxUs) wakeMaxUs=t;
+		}
+	}
+	if (done-taken>=I2SDMABUFCNT-1) {
+		//Underrun: the DMA engine has lapped us, or is about to start on the buffer we'd take. Skip to the
+		//oldest buffer that it can't have started on yet, which is the one after the one it plays next.
+		taken=done-(I2SDMABUFCNT-2);
+	}
+	currDMABuff=(uint32_t*)i2sBuf[taken%I2SDMABUFCNT];
+	currDMABuffPos=0;
+	atomic_store(&wrTaken, taken+1);
+}
+
 
 //This routine pushes a single, 32-bit sample to the I2S buffers. Call this at (on average) 
 //at least the current sample rate. You can also call it quicker: it will suspend the calling
 //thread if the buffer is full and resume when there's room again.
 void i2sPushSample(unsigned int sample) {
 	//Check if current DMA buffer is full.
-	if (currDMABuffPos==I2SDMABUFLEN || currDMABuff==NULL) {
-		//We need a new buffer. Pop one from the queue.
-		xQueueReceive(dmaQueue, &currDMABuff, portMAX_DELAY);
-		currDMABuffPos=0;
-	}
+	if (currDMABuffPos==I2SDMABUFLEN || currDMABuff==NULL) nextBuffer();
 	currDMABuff[currDMABuffPos++]=sample;
+	wrCount++;
+}
+
+//Borrow the unused part of the current DMA buffer so the caller can write samples into it
+//directly. Blocks like i2sPushSample if all buffers are full. Returns a pointer to the first
+//free word and stores the amount of words that may be written in *len. The samples only count
+//once they are handed back with i2sCommitBuffer; until then nothing else may push samples.
+uint32_t *i2sBorrowBuffer(int *len) {
+	if (currDMABuffPos==I2SDMABUFLEN || currDMABuff==NULL) nextBuffer();
+	*len=I2SDMABUFLEN-currDMABuffPos;
+	return &currDMABuff[currDMABuffPos];
+}
+
+//Commit the first n words of the memory returned by the last i2sBorrowBuffer call.
+void i2sCommitBuffer(int n) {
+	currDMABuffPos+=n;
+	wrCount+=n;
+	atomic_store_explicit(&wrSamples, wrCount, memory_order_release);
+}
+
+//Push n 32-bit samples to the I2S buffers. Same blocking behaviour as i2sPushSample, but
+//copies whole runs at a time instead of doing the buffer administration for every sample.
+void i2sPushSamples(const uint32_t *samples, int n) {
+	uint32_t *buf;
+	int len;
+	while (n>0) {
+		buf=i2sBorrowBuffer(&len);
+		if (len>n) len=n;
+		memcpy(buf, samples, len*4);
+		i2sCommitBuffer(len);
+		samples+=len;
+		n-=len;
+	}
 }
 
 long i2sGetUnderrunCnt() {
 	return underrunCnt;
+}
+
+//Returns the amount of DMA buffers that are waiting to be filled. At most I2SDMABUFCNT-1 buffers can
+//be, so this is a measure of how little audio is still lined up for the DMA engine.
+int i2sGetFreeBufCnt() {
+	unsigned int n=atomic_load(&dmaDone)-atomic_load(&wrTaken);
+	return (n>I2SDMABUFCNT-1)?I2SDMABUFCNT-1:n;
+}
+
+//Take a consistent snapshot of the amount of buffers done and the time the last one finished, and work
+//out how many samples of the buffer after it the DMA engine has sent since: 0 to I2SDMABUFLEN-1.
+static int dmaProgress(unsigned long long *total, unsigned int *consumed, int *live, unsigned int *end) {
+	unsigned int seq, d;
+	int64_t t, n;
+	int rate;
+	do {
+		seq=atomic_load_explicit(&isrSeq, memory_order_acquire);
+		d=atomic_load_explicit(&dmaDone, memory_order_relaxed);
+		*total=dmaTotal;
+		*consumed=atomic_load_explicit(&wrConsumed, memory_order_relaxed);
+		*live=atomic_load(&descLive[d%I2SDMABUFCNT]);
+		*end=descEnd[d%I2SDMABUFCNT];
+		t=eofTime;
+		rate=eofRate;
+		atomic_thread_fence(memory_order_acquire);
+	} while ((seq&1) || atomic_load_explicit(&isrSeq, memory_order_relaxed)!=seq);
+	//Use the rate from the snapshot: if it changes halfway a buffer, the interpolation can't jump back.
+	n=((esp_timer_get_time()-t)*rate)/1000000;
+	if (n<0) n=0;
+	if (n>I2SDMABUFLEN-1) n=I2SDMABUFLEN-1;
+	return n;
+}
+
+//Amount of samples committed so far. This is the sample count the other functions here are relative
+//to; it wraps around. Samples pushed with i2sPushSample only show up here once their DMA buffer is
+//handed over; samples handed over with i2sCommitBuffer show up right away.
+unsigned int i2sGetSamplesWritten() {
+	return atomic_load_explicit(&wrSamples, memory_order_acquire);
+}
+
+//Amount of the committed samples that have actually come out of the I2S port. Exact every time the
+//DMA engine finishes a buffer, and interpolated from the time since then in between. Samples in buffers
+//that came too late to be played count as played once the DMA engine is past them.
+unsigned int i2sGetSamplesConsumed() {
+	unsigned long long total;
+	unsigned int consumed, end;
+	int live, n;
+	n=dmaProgress(&total, &consumed, &live, &end);
+	//If the buffer being sent now was written by us, we're n samples into it.
+	if (live && (int)(end-I2SDMABUFLEN+n-consumed)>0) consumed=end-I2SDMABUFLEN+n;
+	return consumed;
+}
+
+//Amount of committed samples that are still waiting to be played. Divided by the sample rate, this is
+//the output latency.
+int i2sGetQueuedSamples() {
+	int n=atomic_load_explicit(&wrSamples, memory_order_acquire)-i2sGetSamplesConsumed();
+	return (n<0)?0:n;
+}
+
+//Total amount of samples the I2S port has sent since i2sInit, including the silence (or repeats)
+//it played during underruns. Never goes backwards, so it can be used as the clock of the output.
+unsigned long long i2sGetSamplesPlayed() {
+	unsigned long long total;
+	unsigned int consumed, end;
+	int live, n;
+	n=dmaProgress(&total, &consumed, &live, &end);
+	return total*I2SDMABUFLEN+n;
+}
+
+#ifdef I2S_UNDERRUN_SILENCE
+//Set the 32-bit sample that's played when the writer doesn't keep up. This is 0 for a real
+//I2S codec, but e.g. the PWM hack needs something with half of the bits set.
+void i2sSetSilence(uint32_t sample) {
+	int x;
+	for (x=0; x<I2SDMABUFLEN; x++) silenceBuf[x]=sample;
+}
+#endif
+
+//Get the longest time the ISR took, and the longest time between the ISR waking up a writer that waited
+//for a free buffer and it actually getting one, in CPU cycles and uS respectively, since the previous call.
+void i2sGetTimingStats(int *isrCycles, int *wakeUs) {
+	*isrCycles=isrMaxCycles;
+	*wakeUs=wakeMaxUs;
+	isrMaxCycles=0;
+	wakeMaxUs=0;
 }
\ No newline at end of file
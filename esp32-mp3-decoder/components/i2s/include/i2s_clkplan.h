@@ -0,0 +1,24 @@
+#ifndef _I2S_CLKPLAN_H_
+#define _I2S_CLKPLAN_H_
+
+//Clock the I2S dividers run from (PLL_D2)
+#define I2S_CLKPLAN_BASEFREQ (160000000L)
+
+/*
+Divider settings for one sample rate. The resulting rate is
+	BASEFREQ / (clkmDiv + clkmDivB/clkmDivA) / bckDiv / (2*bits)
+*/
+struct i2sClkPlan {
+	int rate;				//Requested sample rate, in Hz
+	unsigned char clkmDiv;	//I2S_CLKM_DIV_NUM
+	unsigned char clkmDivA;	//I2S_CLKM_DIV_A; 0 if there's no fractional part
+	unsigned char clkmDivB;	//I2S_CLKM_DIV_B
+	unsigned char bckDiv;	//I2S_TX_BCK_DIV_NUM
+	unsigned char bits;		//I2S_TX_BITS_MOD
+	int errPpb;				//Difference between the resulting and the requested rate, in parts per billion
+};
+
+void i2sClkPlan(int rate, int enaWordlenFuzzing, struct i2sClkPlan *plan);
+const struct i2sClkPlan *i2sClkPlanLookup(int rate);
+
+#endif
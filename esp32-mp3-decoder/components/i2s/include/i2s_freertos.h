@@ -1,16 +1,35 @@
 #ifndef _I2S_FREERTOS_H_
 #define _I2S_FREERTOS_H_
 
+#include <stdint.h>
+
 //Parameters for the I2S DMA behaviour
 #define I2SDMABUFCNT (14)			//Number of buffers in the I2S circular buffer
 #define I2SDMABUFLEN (128*2)		//Length of one buffer, in 32-bit words.
 #define I2S_DEFAULT_SAMPLE_RATE  (44100)
+//What the DMA engine plays when a buffer isn't refilled in time. With this define, it plays silence
+//(see i2sSetSilence); without it, it plays the old contents of the buffer again.
+#define I2S_UNDERRUN_SILENCE
 
 
 void i2sInit();
 void i2sSetRate(int rate, int enaWordlenFuzzing);
 void i2sPushSample(unsigned int sample);
+void i2sPushSamples(const uint32_t *samples, int n);
+uint32_t *i2sBorrowBuffer(int *len);
+void i2sCommitBuffer(int n);
 long i2sGetUnderrunCnt();
+int i2sGetRateError();
+int i2sGetRate();
+int i2sGetFreeBufCnt();
+unsigned int i2sGetSamplesWritten();
+unsigned int i2sGetSamplesConsumed();
+int i2sGetQueuedSamples();
+unsigned long long i2sGetSamplesPlayed();
+#ifdef I2S_UNDERRUN_SILENCE
+void i2sSetSilence(uint32_t sample);
+#endif
+void i2sGetTimingStats(int *isrCycles, int *wakeUs);
 
 
 #endif
@@ -0,0 +1,20 @@
+#ifndef _HOST_GPIO_H_
+#define _HOST_GPIO_H_
+
+//The pin and peripheral setup of i2sInit does nothing on the host.
+
+typedef struct {
+	int intr_type, mode, pin_bit_mask, pull_down_en, pull_up_en;
+} gpio_config_t;
+
+enum {
+	GPIO_INTR_DISABLE, GPIO_MODE_OUTPUT, GPIO_PULLDOWN_DISABLE=0, GPIO_PULLUP_DISABLE=0,
+	GPIO_SEL_17=1, GPIO_SEL_18=2, GPIO_SEL_19=4, GPIO_NUM_17=17, GPIO_NUM_18, GPIO_NUM_19,
+	I2S0O_DATA_OUT23_IDX, I2S0O_BCK_OUT_IDX, I2S0O_WS_OUT_IDX, PERIPH_I2S0_MODULE, ETS_I2S0_INTR_SOURCE
+};
+
+static inline void gpio_config(gpio_config_t *c) {}
+static inline void gpio_matrix_out(int gpio, int sig, int inv, int oenInv) {}
+static inline void periph_module_enable(int module) {}
+
+#endif
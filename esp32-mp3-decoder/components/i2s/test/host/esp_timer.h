@@ -0,0 +1,14 @@
+#ifndef _HOST_ESP_TIMER_H_
+#define _HOST_ESP_TIMER_H_
+
+#include <stdint.h>
+#include <time.h>
+
+//Microseconds of the monotonic clock
+static inline int64_t esp_timer_get_time() {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (int64_t)t.tv_sec*1000000+t.tv_nsec/1000;
+}
+
+#endif
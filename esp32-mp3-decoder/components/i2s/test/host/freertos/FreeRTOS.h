@@ -0,0 +1,62 @@
+#ifndef _HOST_FREERTOS_H_
+#define _HOST_FREERTOS_H_
+
+//Just enough of the FreeRTOS task notification and critical section API, on top of pthreads, to run
+//i2s_freertos.c on a host.
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+typedef int portBASE_TYPE;
+#define pdTRUE 1
+#define portMAX_DELAY (0xffffffffu)
+#define portYIELD_FROM_ISR() ((void)0)
+
+struct hostTask {
+	pthread_mutex_t m;
+	pthread_cond_t c;
+	uint32_t notify;
+};
+typedef struct hostTask *xTaskHandle;
+
+//Never freed, so the ISR can still notify a thread that has just ended.
+static __thread xTaskHandle hostCurTask;
+
+static inline xTaskHandle xTaskGetCurrentTaskHandle() {
+	if (hostCurTask==NULL) {
+		hostCurTask=calloc(1, sizeof(*hostCurTask));
+		pthread_mutex_init(&hostCurTask->m, NULL);
+		pthread_cond_init(&hostCurTask->c, NULL);
+	}
+	return hostCurTask;
+}
+
+//The timeout is always portMAX_DELAY in i2s_freertos.c.
+static inline uint32_t ulTaskNotifyTake(int clear, uint32_t timeout) {
+	xTaskHandle t=xTaskGetCurrentTaskHandle();
+	uint32_t n;
+	pthread_mutex_lock(&t->m);
+	while (t->notify==0) pthread_cond_wait(&t->c, &t->m);
+	n=t->notify;
+	t->notify=clear?0:n-1;
+	pthread_mutex_unlock(&t->m);
+	return n;
+}
+
+static inline void vTaskNotifyGiveFromISR(xTaskHandle t, portBASE_TYPE *woken) {
+	pthread_mutex_lock(&t->m);
+	t->notify++;
+	pthread_cond_signal(&t->c);
+	pthread_mutex_unlock(&t->m);
+	*woken=pdTRUE;
+}
+
+typedef pthread_mutex_t portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED PTHREAD_MUTEX_INITIALIZER
+#define portENTER_CRITICAL(m) pthread_mutex_lock(m)
+#define portEXIT_CRITICAL(m) pthread_mutex_unlock(m)
+#define portENTER_CRITICAL_ISR(m) pthread_mutex_lock(m)
+#define portEXIT_CRITICAL_ISR(m) pthread_mutex_unlock(m)
+
+#endif
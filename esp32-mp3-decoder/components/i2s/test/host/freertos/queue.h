@@ -0,0 +1 @@
+//Everything needed is in FreeRTOS.h
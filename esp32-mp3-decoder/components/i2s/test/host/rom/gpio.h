@@ -0,0 +1 @@
+//Nothing needed from this on the host; see driver/gpio.h
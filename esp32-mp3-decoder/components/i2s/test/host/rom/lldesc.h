@@ -0,0 +1,14 @@
+#ifndef _HOST_LLDESC_H_
+#define _HOST_LLDESC_H_
+
+#include <stdint.h>
+
+//Same fields as the ROM version. The link to the next descriptor is a 32-bit word on the ESP32; the
+//host DMA engine of the test doesn't follow it.
+typedef struct lldesc_s {
+	uint32_t size:12, length:12, offset:5, sosf:1, eof:1, owner:1;
+	uint8_t *volatile buf;
+	uint32_t empty;
+} lldesc_t;
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef _HOST_I2S_REG_H_
+#define _HOST_I2S_REG_H_
+
+#include <stdint.h>
+
+//The only registers that matter on the host are the ones the ISR uses: the interrupt status, the
+//address of the descriptor the DMA engine finished and the interrupt clear register. The test
+//provides them with hostRegRead and hostRegWrite. Everything else is a dummy register, and setting
+//bits in one does nothing.
+enum {
+	HOST_REG_DUMMY, HOST_REG_INT_ST, HOST_REG_OUT_EOF_DES_ADDR, HOST_REG_INT_CLR
+};
+
+uintptr_t hostRegRead(int reg);
+void hostRegWrite(int reg, uint32_t val);
+
+#define READ_PERI_REG(r) hostRegRead(r)
+#define WRITE_PERI_REG(r, v) hostRegWrite(r, v)
+#define SET_PERI_REG_MASK(r, m) ((void)0)
+#define CLEAR_PERI_REG_MASK(r, m) ((void)0)
+#define SET_PERI_REG_BITS(r, m, v, s) ((void)(v))
+
+#define I2S_INT_ST_REG(i) HOST_REG_INT_ST
+#define I2S_OUT_EOF_DES_ADDR_REG(i) HOST_REG_OUT_EOF_DES_ADDR
+#define I2S_INT_CLR_REG(i) HOST_REG_INT_CLR
+#define I2S_OUT_EOF_INT_ST (1<<12)
+
+#define I2S_CLKM_CONF_REG(i) HOST_REG_DUMMY
+#define I2S_CONF2_REG(i) HOST_REG_DUMMY
+#define I2S_CONF_CHAN_REG(i) HOST_REG_DUMMY
+#define I2S_CONF_REG(i) HOST_REG_DUMMY
+#define I2S_FIFO_CONF_REG(i) HOST_REG_DUMMY
+#define I2S_INT_ENA_REG(i) HOST_REG_DUMMY
+#define I2S_IN_LINK_REG(i) HOST_REG_DUMMY
+#define I2S_LC_CONF_REG(i) HOST_REG_DUMMY
+#define I2S_OUT_LINK_REG(i) HOST_REG_DUMMY
+#define I2S_SAMPLE_RATE_CONF_REG(i) HOST_REG_DUMMY
+#define I2S_TIMING_REG(i) HOST_REG_DUMMY
+
+#define I2S_AHBM_FIFO_RST 0
+#define I2S_AHBM_RST 0
+#define I2S_CHECK_OWNER 0
+#define I2S_CLKM_DIV_A 0
+#define I2S_CLKM_DIV_A_S 0
+#define I2S_CLKM_DIV_B 0
+#define I2S_CLKM_DIV_B_S 0
+#define I2S_CLKM_DIV_NUM 0
+#define I2S_CLKM_DIV_NUM_S 0
+#define I2S_DSCR_EN 0
+#define I2S_INLINK_ADDR 0
+#define I2S_IN_RST 0
+#define I2S_OUTLINK_ADDR 0
+#define I2S_OUTLINK_START 0
+#define I2S_OUT_EOF_INT_ENA_S 0
+#define I2S_OUT_EOF_MODE 0
+#define I2S_OUT_RST 0
+#define I2S_RX_BCK_DIV_NUM 0
+#define I2S_RX_BCK_DIV_NUM_S 0
+#define I2S_RX_BITS_MOD 0
+#define I2S_RX_BITS_MOD_S 0
+#define I2S_RX_CHAN_MOD_S 0
+#define I2S_RX_DATA_NUM_S 0
+#define I2S_RX_FIFO_MOD_M 0
+#define I2S_RX_FIFO_RESET 0
+#define I2S_RX_RESET 0
+#define I2S_TX_BCK_DIV_NUM 0
+#define I2S_TX_BCK_DIV_NUM_S 0
+#define I2S_TX_BITS_MOD 0
+#define I2S_TX_BITS_MOD_S 0
+#define I2S_TX_CHAN_MOD_S 0
+#define I2S_TX_DATA_NUM_S 0
+#define I2S_TX_FIFO_MOD_M 0
+#define I2S_TX_FIFO_RESET 0
+#define I2S_TX_MSB_SHIFT 0
+#define I2S_TX_RESET 0
+#define I2S_TX_START 0
+#define I2S_TX_WS_OUT_DELAY_S 0
+
+#endif
@@ -0,0 +1,14 @@
+#ifndef _HOST_XTENSA_HAL_H_
+#define _HOST_XTENSA_HAL_H_
+
+#include <stdint.h>
+#include <time.h>
+
+//There's no portable cycle counter on the host; this counts nanoseconds instead.
+static inline uint32_t xthal_get_ccount() {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (uint32_t)(t.tv_sec*1000000000ULL+t.tv_nsec);
+}
+
+#endif
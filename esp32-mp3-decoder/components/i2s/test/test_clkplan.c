@@ -0,0 +1,139 @@
+/******************************************************************************
+ * FileName: test_clkplan.c
+ *
+ * Description: Host test for the I2S clock planner. For every rate in the
+ * precomputed table and a sweep of other rates, it checks that the divider
+ * settings fit in their register fields, that the rate they make really is
+ * within errPpb of the one asked for, that the error stays under the bounds
+ * below and that it's never worse than what the integer dividers alone can
+ * do. For the table rates (and every 50th rate of the sweep) it also tries
+ * every possible 16-bit divider setting, to check that nothing gets closer
+ * than the plan. Finally, the table has to be what the planner makes now.
+ *
+*******************************************************************************/
+#include <stdio.h>
+#include <math.h>
+
+#include "i2s_clkplan.h"
+
+//Sweep of off-table rates
+#define SWEEP_FROM (4000)
+#define SWEEP_TO (96000)
+#define SWEEP_STEP (37)
+//Largest error a plan may have, in ppm: for the table rates, for other rates, and for other rates with
+//word length fuzzing. The higher the rate, the smaller the bit clock divider and the coarser the steps
+//of the fractional divider get; the worst case in the sweep is about 147 ppm, at 95.5KHz. Integer
+//dividers alone are off by hundreds to thousands of ppm for most of the MPEG rates.
+#define MAX_TAB_ERR_PPM (3.0)
+#define MAX_ERR_PPM (150.0)
+#define MAX_FUZZ_ERR_PPM (15.0)
+
+static const int tabRates[]={8000, 11025, 12000, 16000, 22050, 24000, 32000, 44100, 48000};
+
+//The sample rate the divider settings actually make
+static double planRate(const struct i2sClkPlan *p) {
+	double div=p->clkmDiv;
+	if (p->clkmDivA) div+=(double)p->clkmDivB/p->clkmDivA;
+	return I2S_CLKPLAN_BASEFREQ/(div*p->bckDiv*2*p->bits);
+}
+
+//Smallest error a 16-bit setting without a fraction can get, relative
+static double bestIntErr(int rate) {
+	int bck, c;
+	double err, best=1e9;
+	for (bck=2; bck<64; bck++) {
+		for (c=5; c<64; c++) {
+			err=I2S_CLKPLAN_BASEFREQ/((double)c*bck*32)/rate-1.0;
+			if (fabs(err)<best) best=fabs(err);
+		}
+	}
+	return best;
+}
+
+//Smallest error any 16-bit divider setting can get, relative
+static double bestErr(int rate) {
+	int bck, c, a, b;
+	double err, best=1e9;
+	for (bck=2; bck<64; bck++) {
+		for (c=5; c<64; c++) {
+			err=I2S_CLKPLAN_BASEFREQ/((double)c*bck*32)/rate-1.0;
+			if (fabs(err)<best) best=fabs(err);
+			for (a=1; a<64; a++) {
+				for (b=1; b<a; b++) {
+					err=I2S_CLKPLAN_BASEFREQ/((c+(double)b/a)*bck*32)/rate-1.0;
+					if (fabs(err)<best) best=fabs(err);
+				}
+			}
+		}
+	}
+	return best;
+}
+
+static int checkPlan(const struct i2sClkPlan *p, int rate, int fuzz, double maxPpm, int exhaustive, double *maxErr) {
+	double err=planRate(p)/rate-1.0;
+	if (p->rate!=rate) {
+		printf("FAIL: %d Hz: plan is for %d Hz\n", rate, p->rate);
+		return 1;
+	}
+	if (p->clkmDiv<5 || p->clkmDiv>63 || p->bckDiv<2 || p->bckDiv>63 || p->clkmDivA>63 ||
+			(p->clkmDivA==0 && p->clkmDivB!=0) || (p->clkmDivA!=0 && (p->clkmDivB==0 || p->clkmDivB>=p->clkmDivA)) ||
+			p->bits<16 || p->bits>(fuzz?19:16)) {
+		printf("FAIL: %d Hz: settings out of range: %d+%d/%d, bck %d, %d bits\n", rate,
+				p->clkmDiv, p->clkmDivB, p->clkmDivA, p->bckDiv, p->bits);
+		return 1;
+	}
+	if (fabs(err*1e9-p->errPpb)>1.0) {
+		printf("FAIL: %d Hz: error is %.1f ppb, plan says %d ppb\n", rate, err*1e9, p->errPpb);
+		return 1;
+	}
+	if (fabs(err)*1e6>maxPpm) {
+		printf("FAIL: %d Hz: error %.3f ppm is more than %.0f ppm\n", rate, err*1e6, maxPpm);
+		return 1;
+	}
+	if (fabs(err)>bestIntErr(rate)+1e-12) {
+		printf("FAIL: %d Hz: %.3f ppm, integer dividers get %.3f ppm\n", rate, err*1e6, bestIntErr(rate)*1e6);
+		return 1;
+	}
+	if (exhaustive && !fuzz && fabs(err)>bestErr(rate)+1e-12) {
+		printf("FAIL: %d Hz: %.3f ppm, but %.3f ppm is possible\n", rate, err*1e6, bestErr(rate)*1e6);
+		return 1;
+	}
+	if (fabs(err)>*maxErr) *maxErr=fabs(err);
+	return 0;
+}
+
+int main() {
+	struct i2sClkPlan p;
+	const struct i2sClkPlan *t;
+	double maxTab=0, maxSweep=0, maxFuzz=0;
+	int i, rate, n=0, fail=0;
+
+	for (i=0; i<(int)(sizeof(tabRates)/sizeof(tabRates[0])); i++) {
+		t=i2sClkPlanLookup(tabRates[i]);
+		if (t==NULL) {
+			printf("FAIL: %d Hz is not in the table\n", tabRates[i]);
+			fail=1;
+			continue;
+		}
+		fail|=checkPlan(t, tabRates[i], 0, MAX_TAB_ERR_PPM, 1, &maxTab);
+		i2sClkPlan(tabRates[i], 0, &p);
+		if (p.clkmDiv!=t->clkmDiv || p.clkmDivA!=t->clkmDivA || p.clkmDivB!=t->clkmDivB ||
+				p.bckDiv!=t->bckDiv || p.bits!=t->bits || p.errPpb!=t->errPpb) {
+			printf("FAIL: %d Hz: table entry differs from the planner; regenerate i2s_clktab.h\n", tabRates[i]);
+			fail=1;
+		}
+	}
+
+	for (rate=SWEEP_FROM; rate<=SWEEP_TO; rate+=SWEEP_STEP) {
+		i2sClkPlan(rate, 0, &p);
+		fail|=checkPlan(&p, rate, 0, MAX_ERR_PPM, (n%50)==0, &maxSweep);
+		i2sClkPlan(rate, 1, &p);
+		fail|=checkPlan(&p, rate, 1, MAX_FUZZ_ERR_PPM, 0, &maxFuzz);
+		n++;
+	}
+
+	printf("table: max error %.3f ppm; %d other rates: max error %.3f ppm, %.3f ppm with word length fuzzing\n",
+			maxTab*1e6, n, maxSweep*1e6, maxFuzz*1e6);
+	if (!fail) printf("OK: all plans fit the registers and are within bounds\n");
+	return fail;
+}
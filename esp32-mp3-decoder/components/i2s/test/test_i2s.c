@@ -0,0 +1,325 @@
+/******************************************************************************
+ * FileName: test_i2s.c
+ *
+ * Description: Host test for the DMA buffer bookkeeping and the playback
+ * position of i2s_freertos.c. The file is built in with stubs (host/) for the
+ * FreeRTOS and ESP-IDF calls it makes. A thread plays the part of the DMA
+ * engine: it "sends" the buffer of the current descriptor for as long as it
+ * takes at SIM_RATE, checks it, and then runs the ISR like the EOF interrupt
+ * would. A writer thread fills the buffers with a running sample count, with
+ * i2sBorrowBuffer/i2sCommitBuffer or with i2sPushSample, and now and then
+ * stalls long enough to make the output underrun. An observer thread keeps
+ * reading the position functions. It checks that:
+ * - no buffer changes while it's being sent, and every buffer holds a run of
+ *   consecutive samples (or silence, with I2S_UNDERRUN_SILENCE);
+ * - no samples are sent twice;
+ * - right after a buffer of fresh samples, i2sGetSamplesConsumed is exactly
+ *   the count after its last sample;
+ * - i2sGetSamplesPlayed and i2sGetSamplesConsumed never go back and
+ *   i2sGetQueuedSamples stays in range, also with the buffer count starting
+ *   just below 2^32;
+ * - the interpolated position is within MAX_POS_ERR_RMS of where the DMA
+ *   thread really is.
+ * Samples the writer puts in a buffer the DMA engine is already past are lost;
+ * the gaps that leaves are counted, but are not an error.
+ *
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <pthread.h>
+
+#include "../i2s_freertos.c"
+
+//Simulated sample rate. This is much higher than a real one, so a run of SIM_BUFFERS buffers takes
+//about a second.
+#define SIM_RATE (400000)
+#define SIM_BUFFERS (1500)
+//Time the DMA thread takes to send one buffer, in uS
+#define SIM_PERIOD_US ((int)(I2SDMABUFLEN*1000000LL/SIM_RATE))
+//Samples the writer produces in one go, and how long it stalls after that when it does, in buffer
+//periods
+#define WRITE_BLOCK (1152)
+#define STALL_MIN (4)
+#define STALL_MAX (33)
+//Largest rms error of the interpolated position, in samples; it's usually around half a sample.
+//Position reads that take longer than MAX_READ_US (because the observer got preempted in the middle)
+//aren't counted.
+#define MAX_POS_ERR_RMS (2.0)
+#define MAX_READ_US (5)
+
+struct runConfig {
+	const char *name;
+	int push;					//Writer uses i2sPushSample instead of i2sBorrowBuffer/i2sCommitBuffer
+	double stallOdds;			//Chance that the writer stalls after a block
+	int nearWrap;				//Start the buffer count just below 2^32
+};
+
+struct runResult {
+	long played, silence, gaps, replays, torn, consumedErr, orderErr;
+	long posErrN;
+	double posErrSum, posErrMax;
+	uint32_t isrTime[SIM_BUFFERS];
+	int wakeMaxUs;
+};
+
+static const struct runConfig *cfg;
+static struct runResult res;
+static volatile int stop, writerDone;
+
+//Registers the ISR reads: the interrupt status and the descriptor that's just done
+static volatile uintptr_t regIntSt, regEofDesc;
+
+uintptr_t hostRegRead(int reg) {
+	if (reg==HOST_REG_INT_ST) return regIntSt;
+	if (reg==HOST_REG_OUT_EOF_DES_ADDR) return regEofDesc;
+	return 0;
+}
+
+void hostRegWrite(int reg, uint32_t val) {
+	if (reg==HOST_REG_INT_CLR) regIntSt&=~val;
+}
+
+//Where the DMA thread really is: the time it started sending a buffer of fresh samples, and the first
+//sample of that buffer. Valid while truthLive is set.
+static pthread_mutex_t truthMux=PTHREAD_MUTEX_INITIALIZER;
+static int64_t truthStart;
+static uint32_t truthFirst;
+static int truthLive;
+
+static void sleepUs(int us) {
+	struct timespec t={us/1000000, (us%1000000)*1000L};
+	nanosleep(&t, NULL);
+}
+
+//Sleep until the given esp_timer_get_time() time
+static void sleepUntil(int64_t us) {
+	struct timespec t={us/1000000, (us%1000000)*1000L};
+	clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &t, NULL);
+}
+
+static void setTruth(int live, int64_t start, uint32_t first) {
+	pthread_mutex_lock(&truthMux);
+	truthLive=live;
+	truthStart=start;
+	truthFirst=first;
+	pthread_mutex_unlock(&truthMux);
+}
+
+//Tell the ISR the DMA engine is done with descriptor n. Returns the time the ISR took, in ns.
+static uint32_t eofInterrupt(int n) {
+	uint32_t t;
+	regEofDesc=(uintptr_t)&i2sBufDesc[n];
+	regIntSt=I2S_OUT_EOF_INT_ST;
+	t=xthal_get_ccount();
+	i2s_isr(NULL);
+	return xthal_get_ccount()-t;
+}
+
+static int isSilence(const uint32_t *buf) {
+#ifdef I2S_UNDERRUN_SILENCE
+	return buf==silenceBuf;
+#else
+	return 0;
+#endif
+}
+
+static void *dmaThread(void *arg) {
+	static uint32_t snap[I2SDMABUFLEN];
+	uint32_t last=0, *buf;
+	int b, i, cur=0, fresh, isrCycles, wakeUs;
+	//Like the real one, the DMA engine starts on the next buffer when it's done with one, not when the
+	//ISR has run.
+	int64_t start=esp_timer_get_time();
+	for (b=0; b<SIM_BUFFERS; b++) {
+		buf=(uint32_t *)i2sBufDesc[cur].buf;
+		memcpy(snap, buf, sizeof(snap));
+		//The observer only compares against buffers with samples it hasn't seen yet.
+		fresh=!isSilence(buf) && snap[0]==last+1;
+		setTruth(fresh, start, snap[0]);
+		sleepUntil(start+SIM_PERIOD_US);
+		setTruth(0, 0, 0);
+
+		if (memcmp(snap, buf, sizeof(snap))!=0) res.torn++;
+		if (isSilence(buf)) {
+			res.silence++;
+		} else {
+			for (i=1; i<I2SDMABUFLEN; i++) {
+				if (snap[i]!=snap[0]+i) break;
+			}
+			if (i<I2SDMABUFLEN) res.torn++;
+			if (snap[0]==0 && last==0) {
+				//Nothing written yet
+			} else if (snap[0]<=last) {
+				res.replays++;
+			} else {
+				if (snap[0]!=last+1) res.gaps++;
+				last=snap[I2SDMABUFLEN-1];
+			}
+			res.played++;
+		}
+
+		start=esp_timer_get_time();
+		res.isrTime[b]=eofInterrupt(cur);
+		if (fresh && atomic_load(&wrConsumed)!=snap[I2SDMABUFLEN-1]) res.consumedErr++;
+		if (b%50==49) {
+			i2sGetTimingStats(&isrCycles, &wakeUs);
+			if (wakeUs>res.wakeMaxUs) res.wakeMaxUs=wakeUs;
+		}
+		cur=(cur+1)%I2SDMABUFCNT;
+	}
+	//Keep the writer going until it sees it has to stop.
+	stop=1;
+	while (!writerDone) {
+		eofInterrupt(cur);
+		cur=(cur+1)%I2SDMABUFCNT;
+		sleepUs(SIM_PERIOD_US/4);
+	}
+	return NULL;
+}
+
+static void *writerThread(void *arg) {
+	uint32_t seq=1, *p;
+	int n, len, i;
+	srand(5);
+	while (!stop) {
+		n=WRITE_BLOCK;
+		if (cfg->push) {
+			while (n>0 && !stop) {
+				i2sPushSample(seq++);
+				n--;
+			}
+		} else {
+			while (n>0 && !stop) {
+				p=i2sBorrowBuffer(&len);
+				if (len>n) len=n;
+				for (i=0; i<len; i++) p[i]=seq++;
+				i2sCommitBuffer(len);
+				n-=len;
+			}
+		}
+		if ((double)rand()/RAND_MAX<cfg->stallOdds) sleepUs(SIM_PERIOD_US*(STALL_MIN+rand()%(STALL_MAX-STALL_MIN+1)));
+	}
+	writerDone=1;
+	return NULL;
+}
+
+static void *observerThread(void *arg) {
+	unsigned long long played, lastPlayed=0;
+	unsigned int consumed, lastConsumed=0;
+	int queued, live;
+	int64_t start, t0, t1;
+	uint32_t first;
+	double truth, err;
+	while (!stop) {
+		pthread_mutex_lock(&truthMux);
+		live=truthLive;
+		start=truthStart;
+		first=truthFirst;
+		played=i2sGetSamplesPlayed();
+		t0=esp_timer_get_time();
+		consumed=i2sGetSamplesConsumed();
+		t1=esp_timer_get_time();
+		pthread_mutex_unlock(&truthMux);
+		truth=(first-1)+((t0+t1)/2.0-start)*SIM_RATE/1000000;
+		queued=i2sGetQueuedSamples();
+
+		if (played<lastPlayed || (int)(consumed-lastConsumed)<0) res.orderErr++;
+		if (queued<0 || queued>I2SDMABUFCNT*I2SDMABUFLEN+WRITE_BLOCK) res.orderErr++;
+		lastPlayed=played;
+		lastConsumed=consumed;
+		//Past the end of the buffer, the DMA thread is just late.
+		if (live && t1-t0<=MAX_READ_US && truth<first-1+I2SDMABUFLEN-1) {
+			err=(double)consumed-truth;
+			res.posErrSum+=err*err;
+			res.posErrN++;
+			if (fabs(err)>res.posErrMax) res.posErrMax=fabs(err);
+		}
+		sleepUs(37);
+	}
+	return NULL;
+}
+
+static int cmpU32(const void *a, const void *b) {
+	uint32_t x=*(const uint32_t *)a, y=*(const uint32_t *)b;
+	return (x<y)?-1:(x>y);
+}
+
+static int run(const struct runConfig *c) {
+	pthread_t dma, writer, observer;
+	unsigned long long startTotal, played;
+	int fail=0;
+	double posRms;
+
+	cfg=c;
+	memset(&res, 0, sizeof(res));
+	stop=0;
+	writerDone=0;
+	//i2sInit doesn't know about the writer's current buffer; start that over as well.
+	currDMABuff=NULL;
+	currDMABuffPos=0;
+	i2sInit();
+	i2sSetRate(SIM_RATE, 0);
+	if (c->nearWrap) dmaTotal=(1ULL<<32)-SIM_BUFFERS/2;
+	startTotal=dmaTotal;
+#ifdef I2S_UNDERRUN_SILENCE
+	i2sSetSilence(0);
+#endif
+
+	pthread_create(&writer, NULL, writerThread, NULL);
+	sleepUs(SIM_PERIOD_US*2);
+	pthread_create(&observer, NULL, observerThread, NULL);
+	pthread_create(&dma, NULL, dmaThread, NULL);
+	pthread_join(dma, NULL);
+	pthread_join(observer, NULL);
+	pthread_join(writer, NULL);
+	played=i2sGetSamplesPlayed();
+
+	qsort(res.isrTime, SIM_BUFFERS, sizeof(uint32_t), cmpU32);
+	posRms=res.posErrN?sqrt(res.posErrSum/res.posErrN):0;
+	printf("%-20s %4ld played, %4ld silence, %3ld gaps, %4ld underruns; position err %.1f rms, %.1f max "
+			"(%ld reads); ISR %u/%u ns p50/p99, wakeup max %d us\n",
+			c->name, res.played, res.silence, res.gaps, i2sGetUnderrunCnt(), posRms, res.posErrMax,
+			res.posErrN, res.isrTime[SIM_BUFFERS/2], res.isrTime[SIM_BUFFERS*99/100], res.wakeMaxUs);
+
+	if (res.torn) {
+		printf("FAIL: %ld buffers changed while being sent or weren't consecutive samples\n", res.torn);
+		fail=1;
+	}
+	if (res.replays) {
+		printf("FAIL: %ld buffers had samples that were already sent\n", res.replays);
+		fail=1;
+	}
+	if (res.consumedErr) {
+		printf("FAIL: %ld times the consumed count at EOF wasn't the end of the buffer\n", res.consumedErr);
+		fail=1;
+	}
+	if (res.orderErr) {
+		printf("FAIL: %ld times the position went back or the queued count was out of range\n", res.orderErr);
+		fail=1;
+	}
+	if (played/I2SDMABUFLEN<startTotal+SIM_BUFFERS) {
+		printf("FAIL: the sample clock ends at buffer %llu, expected at least %llu\n",
+				played/I2SDMABUFLEN, startTotal+SIM_BUFFERS);
+		fail=1;
+	}
+	if (res.posErrN==0 || posRms>MAX_POS_ERR_RMS) {
+		printf("FAIL: the position is more than %.0f samples rms off\n", MAX_POS_ERR_RMS);
+		fail=1;
+	}
+	return fail;
+}
+
+int main() {
+	static const struct runConfig runs[]={
+		{"commit, 1% stalls", 0, 0.01, 0},
+		{"commit, 5% stalls", 0, 0.05, 0},
+		{"push, 1% stalls", 1, 0.01, 0},
+		{"push, 5% stalls", 1, 0.05, 0},
+		{"commit, 2^32 wrap", 0, 0.01, 1},
+	};
+	int i, fail=0;
+	for (i=0; i<(int)(sizeof(runs)/sizeof(runs[0])); i++) fail|=run(&runs[i]);
+	if (!fail) printf("OK: the DMA bookkeeping and playback position hold up\n");
+	return fail;
+}
@@ -82,6 +82,8 @@ unsigned short const crc_table[256] = {
 
 # define CRC_POLY  0x8005
 
+# define CACHEBITS  MAD_BIT_CACHEBITS
+
 /*
  * NAME:	bit->init()
  * DESCRIPTION:	initialize bit pointer struct
@@ -90,7 +92,29 @@ void mad_bit_init(struct mad_bitptr *bitptr, unsigned char const *byte)
 {
   bitptr->byte  = byte;
   bitptr->cache = 0;
-  bitptr->left  = CHAR_BIT;
+  bitptr->left  = 0;
+
+  bitptr->end   = 0;
+  bitptr->next  = 0;
+}
+
+/*
+ * NAME:	bit->split()
+ * DESCRIPTION:	continue reading at next once end is reached, so a bit
+ *		stream can be read from two separate pieces of memory
+ */
+void mad_bit_split(struct mad_bitptr *bitptr,
+		   unsigned char const *end, unsigned char const *next)
+{
+  bitptr->end  = end;
+  bitptr->next = next;
+
+  /* end is cleared once the pointer has moved on to the second segment */
+
+  if (bitptr->byte == end && bitptr->left == 0) {
+    bitptr->byte = next;
+    bitptr->end  = 0;
+  }
 }
 
 /*
@@ -100,8 +124,22 @@ void mad_bit_init(struct mad_bitptr *bitptr, unsigned char const *byte)
 unsigned int mad_bit_length(struct mad_bitptr const *begin,
 			    struct mad_bitptr const *end)
 {
-  return begin->left +
-    CHAR_BIT * (end->byte - (begin->byte + 1)) + (CHAR_BIT - end->left);
+  unsigned int len;
+
+  /* the cache never holds bytes of more than one segment */
+
+  if (begin->end && !end->end && end->next == begin->next) {
+    /* begin is in the first segment, end in the second */
+
+    len = begin->left + CHAR_BIT * (begin->end - begin->byte) +
+      CHAR_BIT * (end->byte - end->next) - end->left;
+  }
+  else {
+    len = begin->left +
+      CHAR_BIT * (end->byte - begin->byte) - end->left;
+  }
+
+  return len;
 }
 
 /*
@@ -110,7 +148,50 @@ unsigned int mad_bit_length(struct mad_bitptr const *begin,
  */
 unsigned char const *mad_bit_nextbyte(struct mad_bitptr const *bitptr)
 {
-  return bitptr->left == CHAR_BIT ? bitptr->byte : bitptr->byte + 1;
+  unsigned char const *byte;
+
+  byte = bitptr->byte - bitptr->left / CHAR_BIT;
+
+  return byte == bitptr->end ? bitptr->next : byte;
+}
+
+/*
+ * NAME:	bit->refill()
+ * DESCRIPTION:	load whole bytes into the cache until it is (nearly) full
+ *		or the current segment is exhausted
+ */
+void mad_bit_refill(struct mad_bitptr *bitptr)
+{
+  register unsigned char const *byte;
+  register unsigned long cache;
+  unsigned int left;
+
+  byte  = bitptr->byte;
+  cache = bitptr->cache;
+  left  = bitptr->left;
+
+  if (byte == bitptr->end && left == 0) {
+    byte = bitptr->next;
+    bitptr->end = 0;
+  }
+
+  if (left <= CACHEBITS - 32 &&
+      (bitptr->end == 0 || bitptr->end - byte >= 4)) {
+    cache |= ((unsigned long) byte[0] << 24 | (unsigned long) byte[1] << 16 |
+	      (unsigned long) byte[2] <<  8 | (unsigned long) byte[3] <<  0)
+      << (CACHEBITS - 32 - left);
+    byte += 4;
+    left += 32;
+  }
+
+  while (left <= CACHEBITS - CHAR_BIT && byte != bitptr->end) {
+    cache |= (unsigned long) *byte++ << (CACHEBITS - CHAR_BIT - left);
+    left  += CHAR_BIT;
+  }
+
+  bitptr->byte  = byte;
+  bitptr->cache = cache;
+  bitptr->left  = left;
 }
 
 /*
@@ -119,16 +200,33 @@ unsigned char const *mad_bit_nextbyte(struct mad_bitptr const *bitptr)
  */
 void mad_bit_skip(struct mad_bitptr *bitptr, unsigned int len)
 {
-  bitptr->byte += len / CHAR_BIT;
-  bitptr->left -= len % CHAR_BIT;
+  unsigned int bytes;
 
-  if (bitptr->left > CHAR_BIT) {
-    bitptr->byte++;
-    bitptr->left += CHAR_BIT;
+  if (len < bitptr->left) {
+    mad_bit_consume(bitptr, len);
+    return;
   }
 
-  if (bitptr->left < CHAR_BIT)
-    bitptr->cache = *bitptr->byte;
+  len          -= bitptr->left;
+  bitptr->cache = 0;
+  bitptr->left  = 0;
+
+  bytes = len / CHAR_BIT;
+
+  if (bitptr->end && bytes >= (unsigned int) (bitptr->end - bitptr->byte)) {
+    bytes -= bitptr->end - bitptr->byte;
+
+    bitptr->byte = bitptr->next;
+    bitptr->end  = 0;
+  }
+
+  bitptr->byte += bytes;
+
+  len %= CHAR_BIT;
+  if (len) {
+    mad_bit_refill(bitptr);
+    mad_bit_consume(bitptr, len);
+  }
 }
 
 /*
@@ -139,39 +237,35 @@ unsigned long mad_bit_read(struct mad_bitptr *bitptr, unsigned int len)
 {
   register unsigned long value;
 
-  if (bitptr->left == CHAR_BIT)
-    bitptr->cache = *bitptr->byte;
-
-  if (len < bitptr->left) {
-    value = (bitptr->cache & ((1 << bitptr->left) - 1)) >>
-      (bitptr->left - len);
-    bitptr->left -= len;
-
-    return value;
+  if (len > 24) {
+    value = mad_bit_read(bitptr, len - 16);
+    return (value << 16) | mad_bit_read(bitptr, 16);
   }
 
-  /* remaining bits in current byte */
+  if (bitptr->left < len) {
+    mad_bit_refill(bitptr);
 
-  value = bitptr->cache & ((1 << bitptr->left) - 1);
-  len  -= bitptr->left;
+    if (bitptr->left < len) {
+      /* the bits continue in the second segment */
 
-  bitptr->byte++;
-  bitptr->left = CHAR_BIT;
+      value = mad_bit_peek(bitptr, bitptr->left);
+      len  -= bitptr->left;
 
-  /* more bytes */
+      bitptr->cache = 0;
+      bitptr->left  = 0;
 
-  while (len >= CHAR_BIT) {
-    value = (value << CHAR_BIT) | *bitptr->byte++;
-    len  -= CHAR_BIT;
-  }
+      mad_bit_refill(bitptr);
 
-  if (len > 0) {
-    bitptr->cache = *bitptr->byte;
+      value = (value << len) | mad_bit_peek(bitptr, len);
+      mad_bit_consume(bitptr, len);
 
-    value = (value << len) | (bitptr->cache >> (CHAR_BIT - len));
-    bitptr->left -= len;
+      return value;
+    }
   }
 
+  value = mad_bit_peek(bitptr, len);
+  mad_bit_consume(bitptr, len);
+
   return value;
 }
 
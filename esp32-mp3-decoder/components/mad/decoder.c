@@ -52,6 +52,33 @@
 # include "synth.h"
 # include "decoder.h"
 
+/*
+ * NAME:	sync->init()
+ * DESCRIPTION:	initialize a decoder context and attach its Layer III buffers
+ */
+void mad_sync_init(struct sync_t *sync)
+{
+  mad_stream_init(&sync->stream);
+  mad_frame_init(&sync->frame);
+  mad_synth_init(&sync->synth);
+
+  sync->stream.main_data = &sync->main_data;
+  sync->frame.overlap    = &sync->overlap;
+
+  mad_frame_mute(&sync->frame);
+}
+
+/*
+ * NAME:	sync->finish()
+ * DESCRIPTION:	release a decoder context
+ */
+void mad_sync_finish(struct sync_t *sync)
+{
+  mad_synth_finish(&sync->synth);
+  mad_frame_finish(&sync->frame);
+  mad_stream_finish(&sync->stream);
+}
+
 /*
  * NAME:	decoder->init()
  * DESCRIPTION:	initialize a decoder object with callback routines
@@ -341,9 +368,7 @@ int run_sync(struct mad_decoder *decoder)
   frame  = &decoder->sync->frame;
   synth  = &decoder->sync->synth;
 
-  mad_stream_init(stream);
-  mad_frame_init(frame);
-  mad_synth_init(synth);
+  mad_sync_init(decoder->sync);
 
   mad_stream_options(stream, decoder->options);
 
@@ -464,9 +489,7 @@ int run_sync(struct mad_decoder *decoder)
   result = -1;
 
  done:
-  mad_synth_finish(synth);
-  mad_frame_finish(frame);
-  mad_stream_finish(stream);
+  mad_sync_finish(decoder->sync);
 
   return result;
 }
@@ -541,9 +564,8 @@ int run_async(struct mad_decoder *decoder)
  */
 int mad_decoder_run(struct mad_decoder *decoder, enum mad_decoder_mode mode)
 {
-  int result;
+  int result, allocated = 0;
   int (*run)(struct mad_decoder *) = 0;
-  static struct sync_t decsync; //statically-allocated decoder obj
 
   switch (decoder->mode = mode) {
   case MAD_DECODER_MODE_SYNC:
@@ -560,15 +582,20 @@ int mad_decoder_run(struct mad_decoder *decoder, enum mad_decoder_mode mode)
   if (run == 0)
     return -1;
 
-//  decoder->sync = malloc(sizeof(*decoder->sync));
-  decoder->sync=&decsync;
-  if (decoder->sync == 0)
-    return -1;
+  /* the caller may supply the context (e.g. statically allocated) */
+  if (decoder->sync == 0) {
+    decoder->sync = malloc(sizeof(*decoder->sync));
+    if (decoder->sync == 0)
+      return -1;
+    allocated = 1;
+  }
 
   result = run(decoder);
 
-//  free(decoder->sync);
-//  decoder->sync = 0;
+  if (allocated) {
+    free(decoder->sync);
+    decoder->sync = 0;
+  }
 
   return result;
 }
@@ -41,6 +41,18 @@ mad_fixed_t mad_f_abs(mad_fixed_t x)
  * DESCRIPTION:	perform division using fixed-point math
  */
 mad_fixed_t mad_f_div(mad_fixed_t x, mad_fixed_t y)
+# if defined(FPM_FLOAT)
+{
+  mad_fixed_t q;
+
+  q = x / y;
+
+  if (!(q >= MAD_F_MIN && q < MAD_F_MAX))
+    return 0;
+
+  return q;
+}
+# else
 {
   mad_fixed_t q, r;
   unsigned int bits;
@@ -79,3 +91,4 @@ mad_fixed_t mad_f_div(mad_fixed_t x, mad_fixed_t y)
 
   return q << bits;
 }
+# endif
@@ -127,15 +127,18 @@ int decode_header(struct mad_header *header, struct mad_stream *stream)
 
   /* header() */
 
+  /* the bit pointer is fresh at the sync word: fill the cache at once */
+  mad_bit_refill(&stream->ptr);
+
   /* syncword */
   mad_bit_skip(&stream->ptr, 11);
 
   /* MPEG 2.5 indicator (really part of syncword) */
-  if (mad_bit_read(&stream->ptr, 1) == 0)
+  if (mad_bit_get(&stream->ptr, 1) == 0)
     header->flags |= MAD_FLAG_MPEG_2_5_EXT;
 
   /* ID */
-  if (mad_bit_read(&stream->ptr, 1) == 0)
+  if (mad_bit_get(&stream->ptr, 1) == 0)
     header->flags |= MAD_FLAG_LSF_EXT;
   else if (header->flags & MAD_FLAG_MPEG_2_5_EXT) {
     stream->error = MAD_ERROR_LOSTSYNC;
@@ -143,7 +146,7 @@ int decode_header(struct mad_header *header, struct mad_stream *stream)
   }
 
   /* layer */
-  header->layer = 4 - mad_bit_read(&stream->ptr, 2);
+  header->layer = 4 - mad_bit_get(&stream->ptr, 2);
 
   if (header->layer == 4) {
     stream->error = MAD_ERROR_BADLAYER;
@@ -151,13 +154,13 @@ int decode_header(struct mad_header *header, struct mad_stream *stream)
   }
 
   /* protection_bit */
-  if (mad_bit_read(&stream->ptr, 1) == 0) {
+  if (mad_bit_get(&stream->ptr, 1) == 0) {
     header->flags    |= MAD_FLAG_PROTECTION;
     header->crc_check = mad_bit_crc(stream->ptr, 16, 0xffff);
   }
 
   /* bitrate_index */
-  index = mad_bit_read(&stream->ptr, 4);
+  index = mad_bit_get(&stream->ptr, 4);
 
   if (index == 15) {
     stream->error = MAD_ERROR_BADBITRATE;
@@ -170,7 +173,7 @@ int decode_header(struct mad_header *header, struct mad_stream *stream)
     header->bitrate = bitrate_table[header->layer - 1][index];
 
   /* sampling_frequency */
-  index = mad_bit_read(&stream->ptr, 2);
+  index = mad_bit_get(&stream->ptr, 2);
 
   if (index == 3) {
     stream->error = MAD_ERROR_BADSAMPLERATE;
@@ -187,29 +190,29 @@ int decode_header(struct mad_header *header, struct mad_stream *stream)
   }
 
   /* padding_bit */
-  if (mad_bit_read(&stream->ptr, 1))
+  if (mad_bit_get(&stream->ptr, 1))
     header->flags |= MAD_FLAG_PADDING;
 
   /* private_bit */
-  if (mad_bit_read(&stream->ptr, 1))
+  if (mad_bit_get(&stream->ptr, 1))
     header->private_bits |= MAD_PRIVATE_HEADER;
 
   /* mode */
-  header->mode = 3 - mad_bit_read(&stream->ptr, 2);
+  header->mode = 3 - mad_bit_get(&stream->ptr, 2);
 
   /* mode_extension */
-  header->mode_extension = mad_bit_read(&stream->ptr, 2);
+  header->mode_extension = mad_bit_get(&stream->ptr, 2);
 
   /* copyright */
-  if (mad_bit_read(&stream->ptr, 1))
+  if (mad_bit_get(&stream->ptr, 1))
     header->flags |= MAD_FLAG_COPYRIGHT;
 
   /* original/copy */
-  if (mad_bit_read(&stream->ptr, 1))
+  if (mad_bit_get(&stream->ptr, 1))
     header->flags |= MAD_FLAG_ORIGINAL;
 
   /* emphasis */
-  header->emphasis = mad_bit_read(&stream->ptr, 2);
+  header->emphasis = mad_bit_get(&stream->ptr, 2);
 
 # if defined(OPT_STRICT)
   /*
@@ -227,7 +230,7 @@ int decode_header(struct mad_header *header, struct mad_stream *stream)
 
   /* crc_check */
   if (header->flags & MAD_FLAG_PROTECTION)
-    header->crc_target = mad_bit_read(&stream->ptr, 16);
+    header->crc_target = mad_bit_get(&stream->ptr, 16);
 
   return 0;
 }
@@ -429,6 +432,10 @@ int mad_header_decode(struct mad_header *header, struct mad_stream *stream)
  fail:
   stream->sync = 0;
 
+  /* the caller is about to refill the buffer */
+  if (stream->error == MAD_ERROR_BUFLEN)
+    mad_stream_detach(stream);
+
   return -1;
 }
 
@@ -31,15 +31,21 @@
  * These are the Huffman code words for Layer III.
  * The data for these tables are derived from Table B.7 of ISO/IEC 11172-3.
  *
- * These tables support decoding up to 4 Huffman code bits at a time.
+ * The tables are flattened for lookup speed: the first level of each pair
+ * table is indexed directly by up to 10 code bits (the startbits of
+ * mad_huff_pair_table[]), which resolves all code words of 10 bits or less
+ * in a single lookup. Longer code words continue through second-level
+ * tables of at most 6 bits. The quadruple tables resolve any code word in
+ * one 6-bit lookup.
+ *
+ * This file is generated from the original tables by test/gen_huffman.c;
+ * regenerate it rather than editing it by hand.
  */
 
 # if defined(__GNUC__) ||  \
     (defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901)
-#  define PTR(offs, bits)	{ .ptr   = { 0, bits, offs       } }
 #  define V(v, w, x, y, hlen)	{ .value = { 1, hlen, v, w, x, y } }
 # else
-#  define PTR(offs, bits)	{ { 0, bits, offs } }
 #  if defined(WORDS_BIGENDIAN)
 #   define V(v, w, x, y, hlen)	{ { 1, hlen, (v << 11) | (w << 10) |  \
                                              (x <<  9) | (y <<  8) } }
@@ -51,66 +57,141 @@
 
 static
 union huffquad const hufftabA[] = {
-  /* 0000 */ PTR(16, 2),
-  /* 0001 */ PTR(20, 2),
-  /* 0010 */ PTR(24, 1),
-  /* 0011 */ PTR(26, 1),
-  /* 0100 */ V(0, 0, 1, 0, 4),
-  /* 0101 */ V(0, 0, 0, 1, 4),
-  /* 0110 */ V(0, 1, 0, 0, 4),
-  /* 0111 */ V(1, 0, 0, 0, 4),
-  /* 1000 */ V(0, 0, 0, 0, 1),
-  /* 1001 */ V(0, 0, 0, 0, 1),
-  /* 1010 */ V(0, 0, 0, 0, 1),
-  /* 1011 */ V(0, 0, 0, 0, 1),
-  /* 1100 */ V(0, 0, 0, 0, 1),
-  /* 1101 */ V(0, 0, 0, 0, 1),
-  /* 1110 */ V(0, 0, 0, 0, 1),
-  /* 1111 */ V(0, 0, 0, 0, 1),
-
-  /* 0000 ... */
-  /* 00   */ V(1, 0, 1, 1, 2),	/* 16 */
-  /* 01   */ V(1, 1, 1, 1, 2),
-  /* 10   */ V(1, 1, 0, 1, 2),
-  /* 11   */ V(1, 1, 1, 0, 2),
-
-  /* 0001 ... */
-  /* 00   */ V(0, 1, 1, 1, 2),	/* 20 */
-  /* 01   */ V(0, 1, 0, 1, 2),
-  /* 10   */ V(1, 0, 0, 1, 1),
-  /* 11   */ V(1, 0, 0, 1, 1),
-
-  /* 0010 ... */
-  /* 0    */ V(0, 1, 1, 0, 1),	/* 24 */
-  /* 1    */ V(0, 0, 1, 1, 1),
-
-  /* 0011 ... */
-  /* 0    */ V(1, 0, 1, 0, 1),	/* 26 */
-  /* 1    */ V(1, 1, 0, 0, 1)
+  /* 000000 */ V(1, 0, 1, 1, 6),
+  /* 000001 */ V(1, 1, 1, 1, 6),
+  /* 000010 */ V(1, 1, 0, 1, 6),
+  /* 000011 */ V(1, 1, 1, 0, 6),
+  /* 000100 */ V(0, 1, 1, 1, 6),
+  /* 000101 */ V(0, 1, 0, 1, 6),
+  /* 000110 */ V(1, 0, 0, 1, 5),
+  /* 000111 */ V(1, 0, 0, 1, 5),
+  /* 001000 */ V(0, 1, 1, 0, 5),
+  /* 001001 */ V(0, 1, 1, 0, 5),
+  /* 001010 */ V(0, 0, 1, 1, 5),
+  /* 001011 */ V(0, 0, 1, 1, 5),
+  /* 001100 */ V(1, 0, 1, 0, 5),
+  /* 001101 */ V(1, 0, 1, 0, 5),
+  /* 001110 */ V(1, 1, 0, 0, 5),
+  /* 001111 */ V(1, 1, 0, 0, 5),
+  /* 010000 */ V(0, 0, 1, 0, 4),
+  /* 010001 */ V(0, 0, 1, 0, 4),
+  /* 010010 */ V(0, 0, 1, 0, 4),
+  /* 010011 */ V(0, 0, 1, 0, 4),
+  /* 010100 */ V(0, 0, 0, 1, 4),
+  /* 010101 */ V(0, 0, 0, 1, 4),
+  /* 010110 */ V(0, 0, 0, 1, 4),
+  /* 010111 */ V(0, 0, 0, 1, 4),
+  /* 011000 */ V(0, 1, 0, 0, 4),
+  /* 011001 */ V(0, 1, 0, 0, 4),
+  /* 011010 */ V(0, 1, 0, 0, 4),
+  /* 011011 */ V(0, 1, 0, 0, 4),
+  /* 011100 */ V(1, 0, 0, 0, 4),
+  /* 011101 */ V(1, 0, 0, 0, 4),
+  /* 011110 */ V(1, 0, 0, 0, 4),
+  /* 011111 */ V(1, 0, 0, 0, 4),
+  /* 100000 */ V(0, 0, 0, 0, 1),
+  /* 100001 */ V(0, 0, 0, 0, 1),
+  /* 100010 */ V(0, 0, 0, 0, 1),
+  /* 100011 */ V(0, 0, 0, 0, 1),
+  /* 100100 */ V(0, 0, 0, 0, 1),
+  /* 100101 */ V(0, 0, 0, 0, 1),
+  /* 100110 */ V(0, 0, 0, 0, 1),
+  /* 100111 */ V(0, 0, 0, 0, 1),
+  /* 101000 */ V(0, 0, 0, 0, 1),
+  /* 101001 */ V(0, 0, 0, 0, 1),
+  /* 101010 */ V(0, 0, 0, 0, 1),
+  /* 101011 */ V(0, 0, 0, 0, 1),
+  /* 101100 */ V(0, 0, 0, 0, 1),
+  /* 101101 */ V(0, 0, 0, 0, 1),
+  /* 101110 */ V(0, 0, 0, 0, 1),
+  /* 101111 */ V(0, 0, 0, 0, 1),
+  /* 110000 */ V(0, 0, 0, 0, 1),
+  /* 110001 */ V(0, 0, 0, 0, 1),
+  /* 110010 */ V(0, 0, 0, 0, 1),
+  /* 110011 */ V(0, 0, 0, 0, 1),
+  /* 110100 */ V(0, 0, 0, 0, 1),
+  /* 110101 */ V(0, 0, 0, 0, 1),
+  /* 110110 */ V(0, 0, 0, 0, 1),
+  /* 110111 */ V(0, 0, 0, 0, 1),
+  /* 111000 */ V(0, 0, 0, 0, 1),
+  /* 111001 */ V(0, 0, 0, 0, 1),
+  /* 111010 */ V(0, 0, 0, 0, 1),
+  /* 111011 */ V(0, 0, 0, 0, 1),
+  /* 111100 */ V(0, 0, 0, 0, 1),
+  /* 111101 */ V(0, 0, 0, 0, 1),
+  /* 111110 */ V(0, 0, 0, 0, 1),
+  /* 111111 */ V(0, 0, 0, 0, 1)
 };
 
 static
 union huffquad const hufftabB[] = {
-  /* 0000 */ V(1, 1, 1, 1, 4),
-  /* 0001 */ V(1, 1, 1, 0, 4),
-  /* 0010 */ V(1, 1, 0, 1, 4),
-  /* 0011 */ V(1, 1, 0, 0, 4),
-  /* 0100 */ V(1, 0, 1, 1, 4),
-  /* 0101 */ V(1, 0, 1, 0, 4),
-  /* 0110 */ V(1, 0, 0, 1, 4),
-  /* 0111 */ V(1, 0, 0, 0, 4),
-  /* 1000 */ V(0, 1, 1, 1, 4),
-  /* 1001 */ V(0, 1, 1, 0, 4),
-  /* 1010 */ V(0, 1, 0, 1, 4),
-  /* 1011 */ V(0, 1, 0, 0, 4),
-  /* 1100 */ V(0, 0, 1, 1, 4),
-  /* 1101 */ V(0, 0, 1, 0, 4),
-  /* 1110 */ V(0, 0, 0, 1, 4),
-  /* 1111 */ V(0, 0, 0, 0, 4)
+  /* 000000 */ V(1, 1, 1, 1, 4),
+  /* 000001 */ V(1, 1, 1, 1, 4),
+  /* 000010 */ V(1, 1, 1, 1, 4),
+  /* 000011 */ V(1, 1, 1, 1, 4),
+  /* 000100 */ V(1, 1, 1, 0, 4),
+  /* 000101 */ V(1, 1, 1, 0, 4),
+  /* 000110 */ V(1, 1, 1, 0, 4),
+  /* 000111 */ V(1, 1, 1, 0, 4),
+  /* 001000 */ V(1, 1, 0, 1, 4),
+  /* 001001 */ V(1, 1, 0, 1, 4),
+  /* 001010 */ V(1, 1, 0, 1, 4),
+  /* 001011 */ V(1, 1, 0, 1, 4),
+  /* 001100 */ V(1, 1, 0, 0, 4),
+  /* 001101 */ V(1, 1, 0, 0, 4),
+  /* 001110 */ V(1, 1, 0, 0, 4),
+  /* 001111 */ V(1, 1, 0, 0, 4),
+  /* 010000 */ V(1, 0, 1, 1, 4),
+  /* 010001 */ V(1, 0, 1, 1, 4),
+  /* 010010 */ V(1, 0, 1, 1, 4),
+  /* 010011 */ V(1, 0, 1, 1, 4),
+  /* 010100 */ V(1, 0, 1, 0, 4),
+  /* 010101 */ V(1, 0, 1, 0, 4),
+  /* 010110 */ V(1, 0, 1, 0, 4),
+  /* 010111 */ V(1, 0, 1, 0, 4),
+  /* 011000 */ V(1, 0, 0, 1, 4),
+  /* 011001 */ V(1, 0, 0, 1, 4),
+  /* 011010 */ V(1, 0, 0, 1, 4),
+  /* 011011 */ V(1, 0, 0, 1, 4),
+  /* 011100 */ V(1, 0, 0, 0, 4),
+  /* 011101 */ V(1, 0, 0, 0, 4),
+  /* 011110 */ V(1, 0, 0, 0, 4),
+  /* 011111 */ V(1, 0, 0, 0, 4),
+  /* 100000 */ V(0, 1, 1, 1, 4),
+  /* 100001 */ V(0, 1, 1, 1, 4),
+  /* 100010 */ V(0, 1, 1, 1, 4),
+  /* 100011 */ V(0, 1, 1, 1, 4),
+  /* 100100 */ V(0, 1, 1, 0, 4),
+  /* 100101 */ V(0, 1, 1, 0, 4),
+  /* 100110 */ V(0, 1, 1, 0, 4),
+  /* 100111 */ V(0, 1, 1, 0, 4),
+  /* 101000 */ V(0, 1, 0, 1, 4),
+  /* 101001 */ V(0, 1, 0, 1, 4),
+  /* 101010 */ V(0, 1, 0, 1, 4),
+  /* 101011 */ V(0, 1, 0, 1, 4),
+  /* 101100 */ V(0, 1, 0, 0, 4),
+  /* 101101 */ V(0, 1, 0, 0, 4),
+  /* 101110 */ V(0, 1, 0, 0, 4),
+  /* 101111 */ V(0, 1, 0, 0, 4),
+  /* 110000 */ V(0, 0, 1, 1, 4),
+  /* 110001 */ V(0, 0, 1, 1, 4),
+  /* 110010 */ V(0, 0, 1, 1, 4),
+  /* 110011 */ V(0, 0, 1, 1, 4),
+  /* 110100 */ V(0, 0, 1, 0, 4),
+  /* 110101 */ V(0, 0, 1, 0, 4),
+  /* 110110 */ V(0, 0, 1, 0, 4),
+  /* 110111 */ V(0, 0, 1, 0, 4),
+  /* 111000 */ V(0, 0, 0, 1, 4),
+  /* 111001 */ V(0, 0, 0, 1, 4),
+  /* 111010 */ V(0, 0, 0, 1, 4),
+  /* 111011 */ V(0, 0, 0, 1, 4),
+  /* 111100 */ V(0, 0, 0, 0, 4),
+  /* 111101 */ V(0, 0, 0, 0, 4),
+  /* 111110 */ V(0, 0, 0, 0, 4),
+  /* 111111 */ V(0, 0, 0, 0, 4)
 };
 
 # undef V
-# undef PTR
 
 # if defined(__GNUC__) ||  \
     (defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901)
@@ -119,7 +200,7 @@ union huffquad const hufftabB[] = {
 # else
 #  define PTR(offs, bits)	{ { 0, bits, offs } }
 #  if defined(WORDS_BIGENDIAN)
-#   define V(x, y, hlen)	{ { 1, hlen, (x << 8) | (y << 4) } }
+#   define V(x, y, hlen)	{ { 1, hlen, (x << 7) | (y << 3) } }
 #  else
 #   define V(x, y, hlen)	{ { 1, hlen, (x << 0) | (y << 4) } }
 #  endif
@@ -144,1357 +225,7307 @@ union huffpair const hufftab1[] = {
 
 static
 union huffpair const hufftab2[] = {
-  /* 000  */ PTR(8, 3),
-  /* 001  */ V(1, 1, 3),
-  /* 010  */ V(0, 1, 3),
-  /* 011  */ V(1, 0, 3),
-  /* 100  */ V(0, 0, 1),
-  /* 101  */ V(0, 0, 1),
-  /* 110  */ V(0, 0, 1),
-  /* 111  */ V(0, 0, 1),
-
-  /* 000 ... */
-  /* 000  */ V(2, 2, 3),	/* 8 */
-  /* 001  */ V(0, 2, 3),
-  /* 010  */ V(1, 2, 2),
-  /* 011  */ V(1, 2, 2),
-  /* 100  */ V(2, 1, 2),
-  /* 101  */ V(2, 1, 2),
-  /* 110  */ V(2, 0, 2),
-  /* 111  */ V(2, 0, 2)
+  /* 000000 */ V(2, 2, 6),
+  /* 000001 */ V(0, 2, 6),
+  /* 000010 */ V(1, 2, 5),
+  /* 000011 */ V(1, 2, 5),
+  /* 000100 */ V(2, 1, 5),
+  /* 000101 */ V(2, 1, 5),
+  /* 000110 */ V(2, 0, 5),
+  /* 000111 */ V(2, 0, 5),
+  /* 001000 */ V(1, 1, 3),
+  /* 001001 */ V(1, 1, 3),
+  /* 001010 */ V(1, 1, 3),
+  /* 001011 */ V(1, 1, 3),
+  /* 001100 */ V(1, 1, 3),
+  /* 001101 */ V(1, 1, 3),
+  /* 001110 */ V(1, 1, 3),
+  /* 001111 */ V(1, 1, 3),
+  /* 010000 */ V(0, 1, 3),
+  /* 010001 */ V(0, 1, 3),
+  /* 010010 */ V(0, 1, 3),
+  /* 010011 */ V(0, 1, 3),
+  /* 010100 */ V(0, 1, 3),
+  /* 010101 */ V(0, 1, 3),
+  /* 010110 */ V(0, 1, 3),
+  /* 010111 */ V(0, 1, 3),
+  /* 011000 */ V(1, 0, 3),
+  /* 011001 */ V(1, 0, 3),
+  /* 011010 */ V(1, 0, 3),
+  /* 011011 */ V(1, 0, 3),
+  /* 011100 */ V(1, 0, 3),
+  /* 011101 */ V(1, 0, 3),
+  /* 011110 */ V(1, 0, 3),
+  /* 011111 */ V(1, 0, 3),
+  /* 100000 */ V(0, 0, 1),
+  /* 100001 */ V(0, 0, 1),
+  /* 100010 */ V(0, 0, 1),
+  /* 100011 */ V(0, 0, 1),
+  /* 100100 */ V(0, 0, 1),
+  /* 100101 */ V(0, 0, 1),
+  /* 100110 */ V(0, 0, 1),
+  /* 100111 */ V(0, 0, 1),
+  /* 101000 */ V(0, 0, 1),
+  /* 101001 */ V(0, 0, 1),
+  /* 101010 */ V(0, 0, 1),
+  /* 101011 */ V(0, 0, 1),
+  /* 101100 */ V(0, 0, 1),
+  /* 101101 */ V(0, 0, 1),
+  /* 101110 */ V(0, 0, 1),
+  /* 101111 */ V(0, 0, 1),
+  /* 110000 */ V(0, 0, 1),
+  /* 110001 */ V(0, 0, 1),
+  /* 110010 */ V(0, 0, 1),
+  /* 110011 */ V(0, 0, 1),
+  /* 110100 */ V(0, 0, 1),
+  /* 110101 */ V(0, 0, 1),
+  /* 110110 */ V(0, 0, 1),
+  /* 110111 */ V(0, 0, 1),
+  /* 111000 */ V(0, 0, 1),
+  /* 111001 */ V(0, 0, 1),
+  /* 111010 */ V(0, 0, 1),
+  /* 111011 */ V(0, 0, 1),
+  /* 111100 */ V(0, 0, 1),
+  /* 111101 */ V(0, 0, 1),
+  /* 111110 */ V(0, 0, 1),
+  /* 111111 */ V(0, 0, 1)
 };
 
 static
 union huffpair const hufftab3[] = {
-  /* 000  */ PTR(8, 3),
-  /* 001  */ V(1, 0, 3),
-  /* 010  */ V(1, 1, 2),
-  /* 011  */ V(1, 1, 2),
-  /* 100  */ V(0, 1, 2),
-  /* 101  */ V(0, 1, 2),
-  /* 110  */ V(0, 0, 2),
-  /* 111  */ V(0, 0, 2),
-
-  /* 000 ... */
-  /* 000  */ V(2, 2, 3),	/* 8 */
-  /* 001  */ V(0, 2, 3),
-  /* 010  */ V(1, 2, 2),
-  /* 011  */ V(1, 2, 2),
-  /* 100  */ V(2, 1, 2),
-  /* 101  */ V(2, 1, 2),
-  /* 110  */ V(2, 0, 2),
-  /* 111  */ V(2, 0, 2)
+  /* 000000 */ V(2, 2, 6),
+  /* 000001 */ V(0, 2, 6),
+  /* 000010 */ V(1, 2, 5),
+  /* 000011 */ V(1, 2, 5),
+  /* 000100 */ V(2, 1, 5),
+  /* 000101 */ V(2, 1, 5),
+  /* 000110 */ V(2, 0, 5),
+  /* 000111 */ V(2, 0, 5),
+  /* 001000 */ V(1, 0, 3),
+  /* 001001 */ V(1, 0, 3),
+  /* 001010 */ V(1, 0, 3),
+  /* 001011 */ V(1, 0, 3),
+  /* 001100 */ V(1, 0, 3),
+  /* 001101 */ V(1, 0, 3),
+  /* 001110 */ V(1, 0, 3),
+  /* 001111 */ V(1, 0, 3),
+  /* 010000 */ V(1, 1, 2),
+  /* 010001 */ V(1, 1, 2),
+  /* 010010 */ V(1, 1, 2),
+  /* 010011 */ V(1, 1, 2),
+  /* 010100 */ V(1, 1, 2),
+  /* 010101 */ V(1, 1, 2),
+  /* 010110 */ V(1, 1, 2),
+  /* 010111 */ V(1, 1, 2),
+  /* 011000 */ V(1, 1, 2),
+  /* 011001 */ V(1, 1, 2),
+  /* 011010 */ V(1, 1, 2),
+  /* 011011 */ V(1, 1, 2),
+  /* 011100 */ V(1, 1, 2),
+  /* 011101 */ V(1, 1, 2),
+  /* 011110 */ V(1, 1, 2),
+  /* 011111 */ V(1, 1, 2),
+  /* 100000 */ V(0, 1, 2),
+  /* 100001 */ V(0, 1, 2),
+  /* 100010 */ V(0, 1, 2),
+  /* 100011 */ V(0, 1, 2),
+  /* 100100 */ V(0, 1, 2),
+  /* 100101 */ V(0, 1, 2),
+  /* 100110 */ V(0, 1, 2),
+  /* 100111 */ V(0, 1, 2),
+  /* 101000 */ V(0, 1, 2),
+  /* 101001 */ V(0, 1, 2),
+  /* 101010 */ V(0, 1, 2),
+  /* 101011 */ V(0, 1, 2),
+  /* 101100 */ V(0, 1, 2),
+  /* 101101 */ V(0, 1, 2),
+  /* 101110 */ V(0, 1, 2),
+  /* 101111 */ V(0, 1, 2),
+  /* 110000 */ V(0, 0, 2),
+  /* 110001 */ V(0, 0, 2),
+  /* 110010 */ V(0, 0, 2),
+  /* 110011 */ V(0, 0, 2),
+  /* 110100 */ V(0, 0, 2),
+  /* 110101 */ V(0, 0, 2),
+  /* 110110 */ V(0, 0, 2),
+  /* 110111 */ V(0, 0, 2),
+  /* 111000 */ V(0, 0, 2),
+  /* 111001 */ V(0, 0, 2),
+  /* 111010 */ V(0, 0, 2),
+  /* 111011 */ V(0, 0, 2),
+  /* 111100 */ V(0, 0, 2),
+  /* 111101 */ V(0, 0, 2),
+  /* 111110 */ V(0, 0, 2),
+  /* 111111 */ V(0, 0, 2)
 };
 
 static
 union huffpair const hufftab5[] = {
-  /* 000  */ PTR(8, 4),
-  /* 001  */ V(1, 1, 3),
-  /* 010  */ V(0, 1, 3),
-  /* 011  */ V(1, 0, 3),
-  /* 100  */ V(0, 0, 1),
-  /* 101  */ V(0, 0, 1),
-  /* 110  */ V(0, 0, 1),
-  /* 111  */ V(0, 0, 1),
-
-  /* 000 ... */
-  /* 0000 */ PTR(24, 1),	/* 8 */
-  /* 0001 */ V(3, 2, 4),
-  /* 0010 */ V(3, 1, 3),
-  /* 0011 */ V(3, 1, 3),
-  /* 0100 */ V(1, 3, 4),
-  /* 0101 */ V(0, 3, 4),
-  /* 0110 */ V(3, 0, 4),
-  /* 0111 */ V(2, 2, 4),
-  /* 1000 */ V(1, 2, 3),
-  /* 1001 */ V(1, 2, 3),
-  /* 1010 */ V(2, 1, 3),
-  /* 1011 */ V(2, 1, 3),
-  /* 1100 */ V(0, 2, 3),
-  /* 1101 */ V(0, 2, 3),
-  /* 1110 */ V(2, 0, 3),
-  /* 1111 */ V(2, 0, 3),
-
-  /* 000 0000 ... */
-  /* 0    */ V(3, 3, 1),	/* 24 */
-  /* 1    */ V(2, 3, 1)
+  /* 00000000 */ V(3, 3, 8),
+  /* 00000001 */ V(2, 3, 8),
+  /* 00000010 */ V(3, 2, 7),
+  /* 00000011 */ V(3, 2, 7),
+  /* 00000100 */ V(3, 1, 6),
+  /* 00000101 */ V(3, 1, 6),
+  /* 00000110 */ V(3, 1, 6),
+  /* 00000111 */ V(3, 1, 6),
+  /* 00001000 */ V(1, 3, 7),
+  /* 00001001 */ V(1, 3, 7),
+  /* 00001010 */ V(0, 3, 7),
+  /* 00001011 */ V(0, 3, 7),
+  /* 00001100 */ V(3, 0, 7),
+  /* 00001101 */ V(3, 0, 7),
+  /* 00001110 */ V(2, 2, 7),
+  /* 00001111 */ V(2, 2, 7),
+  /* 00010000 */ V(1, 2, 6),
+  /* 00010001 */ V(1, 2, 6),
+  /* 00010010 */ V(1, 2, 6),
+  /* 00010011 */ V(1, 2, 6),
+  /* 00010100 */ V(2, 1, 6),
+  /* 00010101 */ V(2, 1, 6),
+  /* 00010110 */ V(2, 1, 6),
+  /* 00010111 */ V(2, 1, 6),
+  /* 00011000 */ V(0, 2, 6),
+  /* 00011001 */ V(0, 2, 6),
+  /* 00011010 */ V(0, 2, 6),
+  /* 00011011 */ V(0, 2, 6),
+  /* 00011100 */ V(2, 0, 6),
+  /* 00011101 */ V(2, 0, 6),
+  /* 00011110 */ V(2, 0, 6),
+  /* 00011111 */ V(2, 0, 6),
+  /* 00100000 */ V(1, 1, 3),
+  /* 00100001 */ V(1, 1, 3),
+  /* 00100010 */ V(1, 1, 3),
+  /* 00100011 */ V(1, 1, 3),
+  /* 00100100 */ V(1, 1, 3),
+  /* 00100101 */ V(1, 1, 3),
+  /* 00100110 */ V(1, 1, 3),
+  /* 00100111 */ V(1, 1, 3),
+  /* 00101000 */ V(1, 1, 3),
+  /* 00101001 */ V(1, 1, 3),
+  /* 00101010 */ V(1, 1, 3),
+  /* 00101011 */ V(1, 1, 3),
+  /* 00101100 */ V(1, 1, 3),
+  /* 00101101 */ V(1, 1, 3),
+  /* 00101110 */ V(1, 1, 3),
+  /* 00101111 */ V(1, 1, 3),
+  /* 00110000 */ V(1, 1, 3),
+  /* 00110001 */ V(1, 1, 3),
+  /* 00110010 */ V(1, 1, 3),
+  /* 00110011 */ V(1, 1, 3),
+  /* 00110100 */ V(1, 1, 3),
+  /* 00110101 */ V(1, 1, 3),
+  /* 00110110 */ V(1, 1, 3),
+  /* 00110111 */ V(1, 1, 3),
+  /* 00111000 */ V(1, 1, 3),
+  /* 00111001 */ V(1, 1, 3),
+  /* 00111010 */ V(1, 1, 3),
+  /* 00111011 */ V(1, 1, 3),
+  /* 00111100 */ V(1, 1, 3),
+  /* 00111101 */ V(1, 1, 3),
+  /* 00111110 */ V(1, 1, 3),
+  /* 00111111 */ V(1, 1, 3),
+  /* 01000000 */ V(0, 1, 3),
+  /* 01000001 */ V(0, 1, 3),
+  /* 01000010 */ V(0, 1, 3),
+  /* 01000011 */ V(0, 1, 3),
+  /* 01000100 */ V(0, 1, 3),
+  /* 01000101 */ V(0, 1, 3),
+  /* 01000110 */ V(0, 1, 3),
+  /* 01000111 */ V(0, 1, 3),
+  /* 01001000 */ V(0, 1, 3),
+  /* 01001001 */ V(0, 1, 3),
+  /* 01001010 */ V(0, 1, 3),
+  /* 01001011 */ V(0, 1, 3),
+  /* 01001100 */ V(0, 1, 3),
+  /* 01001101 */ V(0, 1, 3),
+  /* 01001110 */ V(0, 1, 3),
+  /* 01001111 */ V(0, 1, 3),
+  /* 01010000 */ V(0, 1, 3),
+  /* 01010001 */ V(0, 1, 3),
+  /* 01010010 */ V(0, 1, 3),
+  /* 01010011 */ V(0, 1, 3),
+  /* 01010100 */ V(0, 1, 3),
+  /* 01010101 */ V(0, 1, 3),
+  /* 01010110 */ V(0, 1, 3),
+  /* 01010111 */ V(0, 1, 3),
+  /* 01011000 */ V(0, 1, 3),
+  /* 01011001 */ V(0, 1, 3),
+  /* 01011010 */ V(0, 1, 3),
+  /* 01011011 */ V(0, 1, 3),
+  /* 01011100 */ V(0, 1, 3),
+  /* 01011101 */ V(0, 1, 3),
+  /* 01011110 */ V(0, 1, 3),
+  /* 01011111 */ V(0, 1, 3),
+  /* 01100000 */ V(1, 0, 3),
+  /* 01100001 */ V(1, 0, 3),
+  /* 01100010 */ V(1, 0, 3),
+  /* 01100011 */ V(1, 0, 3),
+  /* 01100100 */ V(1, 0, 3),
+  /* 01100101 */ V(1, 0, 3),
+  /* 01100110 */ V(1, 0, 3),
+  /* 01100111 */ V(1, 0, 3),
+  /* 01101000 */ V(1, 0, 3),
+  /* 01101001 */ V(1, 0, 3),
+  /* 01101010 */ V(1, 0, 3),
+  /* 01101011 */ V(1, 0, 3),
+  /* 01101100 */ V(1, 0, 3),
+  /* 01101101 */ V(1, 0, 3),
+  /* 01101110 */ V(1, 0, 3),
+  /* 01101111 */ V(1, 0, 3),
+  /* 01110000 */ V(1, 0, 3),
+  /* 01110001 */ V(1, 0, 3),
+  /* 01110010 */ V(1, 0, 3),
+  /* 01110011 */ V(1, 0, 3),
+  /* 01110100 */ V(1, 0, 3),
+  /* 01110101 */ V(1, 0, 3),
+  /* 01110110 */ V(1, 0, 3),
+  /* 01110111 */ V(1, 0, 3),
+  /* 01111000 */ V(1, 0, 3),
+  /* 01111001 */ V(1, 0, 3),
+  /* 01111010 */ V(1, 0, 3),
+  /* 01111011 */ V(1, 0, 3),
+  /* 01111100 */ V(1, 0, 3),
+  /* 01111101 */ V(1, 0, 3),
+  /* 01111110 */ V(1, 0, 3),
+  /* 01111111 */ V(1, 0, 3),
+  /* 10000000 */ V(0, 0, 1),
+  /* 10000001 */ V(0, 0, 1),
+  /* 10000010 */ V(0, 0, 1),
+  /* 10000011 */ V(0, 0, 1),
+  /* 10000100 */ V(0, 0, 1),
+  /* 10000101 */ V(0, 0, 1),
+  /* 10000110 */ V(0, 0, 1),
+  /* 10000111 */ V(0, 0, 1),
+  /* 10001000 */ V(0, 0, 1),
+  /* 10001001 */ V(0, 0, 1),
+  /* 10001010 */ V(0, 0, 1),
+  /* 10001011 */ V(0, 0, 1),
+  /* 10001100 */ V(0, 0, 1),
+  /* 10001101 */ V(0, 0, 1),
+  /* 10001110 */ V(0, 0, 1),
+  /* 10001111 */ V(0, 0, 1),
+  /* 10010000 */ V(0, 0, 1),
+  /* 10010001 */ V(0, 0, 1),
+  /* 10010010 */ V(0, 0, 1),
+  /* 10010011 */ V(0, 0, 1),
+  /* 10010100 */ V(0, 0, 1),
+  /* 10010101 */ V(0, 0, 1),
+  /* 10010110 */ V(0, 0, 1),
+  /* 10010111 */ V(0, 0, 1),
+  /* 10011000 */ V(0, 0, 1),
+  /* 10011001 */ V(0, 0, 1),
+  /* 10011010 */ V(0, 0, 1),
+  /* 10011011 */ V(0, 0, 1),
+  /* 10011100 */ V(0, 0, 1),
+  /* 10011101 */ V(0, 0, 1),
+  /* 10011110 */ V(0, 0, 1),
+  /* 10011111 */ V(0, 0, 1),
+  /* 10100000 */ V(0, 0, 1),
+  /* 10100001 */ V(0, 0, 1),
+  /* 10100010 */ V(0, 0, 1),
+  /* 10100011 */ V(0, 0, 1),
+  /* 10100100 */ V(0, 0, 1),
+  /* 10100101 */ V(0, 0, 1),
+  /* 10100110 */ V(0, 0, 1),
+  /* 10100111 */ V(0, 0, 1),
+  /* 10101000 */ V(0, 0, 1),
+  /* 10101001 */ V(0, 0, 1),
+  /* 10101010 */ V(0, 0, 1),
+  /* 10101011 */ V(0, 0, 1),
+  /* 10101100 */ V(0, 0, 1),
+  /* 10101101 */ V(0, 0, 1),
+  /* 10101110 */ V(0, 0, 1),
+  /* 10101111 */ V(0, 0, 1),
+  /* 10110000 */ V(0, 0, 1),
+  /* 10110001 */ V(0, 0, 1),
+  /* 10110010 */ V(0, 0, 1),
+  /* 10110011 */ V(0, 0, 1),
+  /* 10110100 */ V(0, 0, 1),
+  /* 10110101 */ V(0, 0, 1),
+  /* 10110110 */ V(0, 0, 1),
+  /* 10110111 */ V(0, 0, 1),
+  /* 10111000 */ V(0, 0, 1),
+  /* 10111001 */ V(0, 0, 1),
+  /* 10111010 */ V(0, 0, 1),
+  /* 10111011 */ V(0, 0, 1),
+  /* 10111100 */ V(0, 0, 1),
+  /* 10111101 */ V(0, 0, 1),
+  /* 10111110 */ V(0, 0, 1),
+  /* 10111111 */ V(0, 0, 1),
+  /* 11000000 */ V(0, 0, 1),
+  /* 11000001 */ V(0, 0, 1),
+  /* 11000010 */ V(0, 0, 1),
+  /* 11000011 */ V(0, 0, 1),
+  /* 11000100 */ V(0, 0, 1),
+  /* 11000101 */ V(0, 0, 1),
+  /* 11000110 */ V(0, 0, 1),
+  /* 11000111 */ V(0, 0, 1),
+  /* 11001000 */ V(0, 0, 1),
+  /* 11001001 */ V(0, 0, 1),
+  /* 11001010 */ V(0, 0, 1),
+  /* 11001011 */ V(0, 0, 1),
+  /* 11001100 */ V(0, 0, 1),
+  /* 11001101 */ V(0, 0, 1),
+  /* 11001110 */ V(0, 0, 1),
+  /* 11001111 */ V(0, 0, 1),
+  /* 11010000 */ V(0, 0, 1),
+  /* 11010001 */ V(0, 0, 1),
+  /* 11010010 */ V(0, 0, 1),
+  /* 11010011 */ V(0, 0, 1),
+  /* 11010100 */ V(0, 0, 1),
+  /* 11010101 */ V(0, 0, 1),
+  /* 11010110 */ V(0, 0, 1),
+  /* 11010111 */ V(0, 0, 1),
+  /* 11011000 */ V(0, 0, 1),
+  /* 11011001 */ V(0, 0, 1),
+  /* 11011010 */ V(0, 0, 1),
+  /* 11011011 */ V(0, 0, 1),
+  /* 11011100 */ V(0, 0, 1),
+  /* 11011101 */ V(0, 0, 1),
+  /* 11011110 */ V(0, 0, 1),
+  /* 11011111 */ V(0, 0, 1),
+  /* 11100000 */ V(0, 0, 1),
+  /* 11100001 */ V(0, 0, 1),
+  /* 11100010 */ V(0, 0, 1),
+  /* 11100011 */ V(0, 0, 1),
+  /* 11100100 */ V(0, 0, 1),
+  /* 11100101 */ V(0, 0, 1),
+  /* 11100110 */ V(0, 0, 1),
+  /* 11100111 */ V(0, 0, 1),
+  /* 11101000 */ V(0, 0, 1),
+  /* 11101001 */ V(0, 0, 1),
+  /* 11101010 */ V(0, 0, 1),
+  /* 11101011 */ V(0, 0, 1),
+  /* 11101100 */ V(0, 0, 1),
+  /* 11101101 */ V(0, 0, 1),
+  /* 11101110 */ V(0, 0, 1),
+  /* 11101111 */ V(0, 0, 1),
+  /* 11110000 */ V(0, 0, 1),
+  /* 11110001 */ V(0, 0, 1),
+  /* 11110010 */ V(0, 0, 1),
+  /* 11110011 */ V(0, 0, 1),
+  /* 11110100 */ V(0, 0, 1),
+  /* 11110101 */ V(0, 0, 1),
+  /* 11110110 */ V(0, 0, 1),
+  /* 11110111 */ V(0, 0, 1),
+  /* 11111000 */ V(0, 0, 1),
+  /* 11111001 */ V(0, 0, 1),
+  /* 11111010 */ V(0, 0, 1),
+  /* 11111011 */ V(0, 0, 1),
+  /* 11111100 */ V(0, 0, 1),
+  /* 11111101 */ V(0, 0, 1),
+  /* 11111110 */ V(0, 0, 1),
+  /* 11111111 */ V(0, 0, 1)
 };
 
 static
 union huffpair const hufftab6[] = {
-  /* 0000 */ PTR(16, 3),
-  /* 0001 */ PTR(24, 1),
-  /* 0010 */ PTR(26, 1),
-  /* 0011 */ V(1, 2, 4),
-  /* 0100 */ V(2, 1, 4),
-  /* 0101 */ V(2, 0, 4),
-  /* 0110 */ V(0, 1, 3),
-  /* 0111 */ V(0, 1, 3),
-  /* 1000 */ V(1, 1, 2),
-  /* 1001 */ V(1, 1, 2),
-  /* 1010 */ V(1, 1, 2),
-  /* 1011 */ V(1, 1, 2),
-  /* 1100 */ V(1, 0, 3),
-  /* 1101 */ V(1, 0, 3),
-  /* 1110 */ V(0, 0, 3),
-  /* 1111 */ V(0, 0, 3),
-
-  /* 0000 ... */
-  /* 000  */ V(3, 3, 3),	/* 16 */
-  /* 001  */ V(0, 3, 3),
-  /* 010  */ V(2, 3, 2),
-  /* 011  */ V(2, 3, 2),
-  /* 100  */ V(3, 2, 2),
-  /* 101  */ V(3, 2, 2),
-  /* 110  */ V(3, 0, 2),
-  /* 111  */ V(3, 0, 2),
-
-  /* 0001 ... */
-  /* 0    */ V(1, 3, 1),	/* 24 */
-  /* 1    */ V(3, 1, 1),
-
-  /* 0010 ... */
-  /* 0    */ V(2, 2, 1),	/* 26 */
-  /* 1    */ V(0, 2, 1)
+  /* 0000000 */ V(3, 3, 7),
+  /* 0000001 */ V(0, 3, 7),
+  /* 0000010 */ V(2, 3, 6),
+  /* 0000011 */ V(2, 3, 6),
+  /* 0000100 */ V(3, 2, 6),
+  /* 0000101 */ V(3, 2, 6),
+  /* 0000110 */ V(3, 0, 6),
+  /* 0000111 */ V(3, 0, 6),
+  /* 0001000 */ V(1, 3, 5),
+  /* 0001001 */ V(1, 3, 5),
+  /* 0001010 */ V(1, 3, 5),
+  /* 0001011 */ V(1, 3, 5),
+  /* 0001100 */ V(3, 1, 5),
+  /* 0001101 */ V(3, 1, 5),
+  /* 0001110 */ V(3, 1, 5),
+  /* 0001111 */ V(3, 1, 5),
+  /* 0010000 */ V(2, 2, 5),
+  /* 0010001 */ V(2, 2, 5),
+  /* 0010010 */ V(2, 2, 5),
+  /* 0010011 */ V(2, 2, 5),
+  /* 0010100 */ V(0, 2, 5),
+  /* 0010101 */ V(0, 2, 5),
+  /* 0010110 */ V(0, 2, 5),
+  /* 0010111 */ V(0, 2, 5),
+  /* 0011000 */ V(1, 2, 4),
+  /* 0011001 */ V(1, 2, 4),
+  /* 0011010 */ V(1, 2, 4),
+  /* 0011011 */ V(1, 2, 4),
+  /* 0011100 */ V(1, 2, 4),
+  /* 0011101 */ V(1, 2, 4),
+  /* 0011110 */ V(1, 2, 4),
+  /* 0011111 */ V(1, 2, 4),
+  /* 0100000 */ V(2, 1, 4),
+  /* 0100001 */ V(2, 1, 4),
+  /* 0100010 */ V(2, 1, 4),
+  /* 0100011 */ V(2, 1, 4),
+  /* 0100100 */ V(2, 1, 4),
+  /* 0100101 */ V(2, 1, 4),
+  /* 0100110 */ V(2, 1, 4),
+  /* 0100111 */ V(2, 1, 4),
+  /* 0101000 */ V(2, 0, 4),
+  /* 0101001 */ V(2, 0, 4),
+  /* 0101010 */ V(2, 0, 4),
+  /* 0101011 */ V(2, 0, 4),
+  /* 0101100 */ V(2, 0, 4),
+  /* 0101101 */ V(2, 0, 4),
+  /* 0101110 */ V(2, 0, 4),
+  /* 0101111 */ V(2, 0, 4),
+  /* 0110000 */ V(0, 1, 3),
+  /* 0110001 */ V(0, 1, 3),
+  /* 0110010 */ V(0, 1, 3),
+  /* 0110011 */ V(0, 1, 3),
+  /* 0110100 */ V(0, 1, 3),
+  /* 0110101 */ V(0, 1, 3),
+  /* 0110110 */ V(0, 1, 3),
+  /* 0110111 */ V(0, 1, 3),
+  /* 0111000 */ V(0, 1, 3),
+  /* 0111001 */ V(0, 1, 3),
+  /* 0111010 */ V(0, 1, 3),
+  /* 0111011 */ V(0, 1, 3),
+  /* 0111100 */ V(0, 1, 3),
+  /* 0111101 */ V(0, 1, 3),
+  /* 0111110 */ V(0, 1, 3),
+  /* 0111111 */ V(0, 1, 3),
+  /* 1000000 */ V(1, 1, 2),
+  /* 1000001 */ V(1, 1, 2),
+  /* 1000010 */ V(1, 1, 2),
+  /* 1000011 */ V(1, 1, 2),
+  /* 1000100 */ V(1, 1, 2),
+  /* 1000101 */ V(1, 1, 2),
+  /* 1000110 */ V(1, 1, 2),
+  /* 1000111 */ V(1, 1, 2),
+  /* 1001000 */ V(1, 1, 2),
+  /* 1001001 */ V(1, 1, 2),
+  /* 1001010 */ V(1, 1, 2),
+  /* 1001011 */ V(1, 1, 2),
+  /* 1001100 */ V(1, 1, 2),
+  /* 1001101 */ V(1, 1, 2),
+  /* 1001110 */ V(1, 1, 2),
+  /* 1001111 */ V(1, 1, 2),
+  /* 1010000 */ V(1, 1, 2),
+  /* 1010001 */ V(1, 1, 2),
+  /* 1010010 */ V(1, 1, 2),
+  /* 1010011 */ V(1, 1, 2),
+  /* 1010100 */ V(1, 1, 2),
+  /* 1010101 */ V(1, 1, 2),
+  /* 1010110 */ V(1, 1, 2),
+  /* 1010111 */ V(1, 1, 2),
+  /* 1011000 */ V(1, 1, 2),
+  /* 1011001 */ V(1, 1, 2),
+  /* 1011010 */ V(1, 1, 2),
+  /* 1011011 */ V(1, 1, 2),
+  /* 1011100 */ V(1, 1, 2),
+  /* 1011101 */ V(1, 1, 2),
+  /* 1011110 */ V(1, 1, 2),
+  /* 1011111 */ V(1, 1, 2),
+  /* 1100000 */ V(1, 0, 3),
+  /* 1100001 */ V(1, 0, 3),
+  /* 1100010 */ V(1, 0, 3),
+  /* 1100011 */ V(1, 0, 3),
+  /* 1100100 */ V(1, 0, 3),
+  /* 1100101 */ V(1, 0, 3),
+  /* 1100110 */ V(1, 0, 3),
+  /* 1100111 */ V(1, 0, 3),
+  /* 1101000 */ V(1, 0, 3),
+  /* 1101001 */ V(1, 0, 3),
+  /* 1101010 */ V(1, 0, 3),
+  /* 1101011 */ V(1, 0, 3),
+  /* 1101100 */ V(1, 0, 3),
+  /* 1101101 */ V(1, 0, 3),
+  /* 1101110 */ V(1, 0, 3),
+  /* 1101111 */ V(1, 0, 3),
+  /* 1110000 */ V(0, 0, 3),
+  /* 1110001 */ V(0, 0, 3),
+  /* 1110010 */ V(0, 0, 3),
+  /* 1110011 */ V(0, 0, 3),
+  /* 1110100 */ V(0, 0, 3),
+  /* 1110101 */ V(0, 0, 3),
+  /* 1110110 */ V(0, 0, 3),
+  /* 1110111 */ V(0, 0, 3),
+  /* 1111000 */ V(0, 0, 3),
+  /* 1111001 */ V(0, 0, 3),
+  /* 1111010 */ V(0, 0, 3),
+  /* 1111011 */ V(0, 0, 3),
+  /* 1111100 */ V(0, 0, 3),
+  /* 1111101 */ V(0, 0, 3),
+  /* 1111110 */ V(0, 0, 3),
+  /* 1111111 */ V(0, 0, 3)
 };
 
 static
 union huffpair const hufftab7[] = {
-  /* 0000 */ PTR(16, 4),
-  /* 0001 */ PTR(32, 4),
-  /* 0010 */ PTR(48, 2),
-  /* 0011 */ V(1, 1, 4),
-  /* 0100 */ V(0, 1, 3),
-  /* 0101 */ V(0, 1, 3),
-  /* 0110 */ V(1, 0, 3),
-  /* 0111 */ V(1, 0, 3),
-  /* 1000 */ V(0, 0, 1),
-  /* 1001 */ V(0, 0, 1),
-  /* 1010 */ V(0, 0, 1),
-  /* 1011 */ V(0, 0, 1),
-  /* 1100 */ V(0, 0, 1),
-  /* 1101 */ V(0, 0, 1),
-  /* 1110 */ V(0, 0, 1),
-  /* 1111 */ V(0, 0, 1),
-
-  /* 0000 ... */
-  /* 0000 */ PTR(52, 2),	/* 16 */
-  /* 0001 */ PTR(56, 1),
-  /* 0010 */ PTR(58, 1),
-  /* 0011 */ V(1, 5, 4),
-  /* 0100 */ V(5, 1, 4),
-  /* 0101 */ PTR(60, 1),
-  /* 0110 */ V(5, 0, 4),
-  /* 0111 */ PTR(62, 1),
-  /* 1000 */ V(2, 4, 4),
-  /* 1001 */ V(4, 2, 4),
-  /* 1010 */ V(1, 4, 3),
-  /* 1011 */ V(1, 4, 3),
-  /* 1100 */ V(4, 1, 3),
-  /* 1101 */ V(4, 1, 3),
-  /* 1110 */ V(4, 0, 3),
-  /* 1111 */ V(4, 0, 3),
-
-  /* 0001 ... */
-  /* 0000 */ V(0, 4, 4),	/* 32 */
-  /* 0001 */ V(2, 3, 4),
-  /* 0010 */ V(3, 2, 4),
-  /* 0011 */ V(0, 3, 4),
-  /* 0100 */ V(1, 3, 3),
-  /* 0101 */ V(1, 3, 3),
-  /* 0110 */ V(3, 1, 3),
-  /* 0111 */ V(3, 1, 3),
-  /* 1000 */ V(3, 0, 3),
-  /* 1001 */ V(3, 0, 3),
-  /* 1010 */ V(2, 2, 3),
-  /* 1011 */ V(2, 2, 3),
-  /* 1100 */ V(1, 2, 2),
-  /* 1101 */ V(1, 2, 2),
-  /* 1110 */ V(1, 2, 2),
-  /* 1111 */ V(1, 2, 2),
-
-  /* 0010 ... */
-  /* 00   */ V(2, 1, 1),	/* 48 */
-  /* 01   */ V(2, 1, 1),
-  /* 10   */ V(0, 2, 2),
-  /* 11   */ V(2, 0, 2),
-
-  /* 0000 0000 ... */
-  /* 00   */ V(5, 5, 2),	/* 52 */
-  /* 01   */ V(4, 5, 2),
-  /* 10   */ V(5, 4, 2),
-  /* 11   */ V(5, 3, 2),
-
-  /* 0000 0001 ... */
-  /* 0    */ V(3, 5, 1),	/* 56 */
-  /* 1    */ V(4, 4, 1),
-
-  /* 0000 0010 ... */
-  /* 0    */ V(2, 5, 1),	/* 58 */
-  /* 1    */ V(5, 2, 1),
-
-  /* 0000 0101 ... */
-  /* 0    */ V(0, 5, 1),	/* 60 */
-  /* 1    */ V(3, 4, 1),
-
-  /* 0000 0111 ... */
-  /* 0    */ V(4, 3, 1),	/* 62 */
-  /* 1    */ V(3, 3, 1)
+  /* 0000000000 */ V(5, 5, 10),
+  /* 0000000001 */ V(4, 5, 10),
+  /* 0000000010 */ V(5, 4, 10),
+  /* 0000000011 */ V(5, 3, 10),
+  /* 0000000100 */ V(3, 5, 9),
+  /* 0000000101 */ V(3, 5, 9),
+  /* 0000000110 */ V(4, 4, 9),
+  /* 0000000111 */ V(4, 4, 9),
+  /* 0000001000 */ V(2, 5, 9),
+  /* 0000001001 */ V(2, 5, 9),
+  /* 0000001010 */ V(5, 2, 9),
+  /* 0000001011 */ V(5, 2, 9),
+  /* 0000001100 */ V(1, 5, 8),
+  /* 0000001101 */ V(1, 5, 8),
+  /* 0000001110 */ V(1, 5, 8),
+  /* 0000001111 */ V(1, 5, 8),
+  /* 0000010000 */ V(5, 1, 8),
+  /* 0000010001 */ V(5, 1, 8),
+  /* 0000010010 */ V(5, 1, 8),
+  /* 0000010011 */ V(5, 1, 8),
+  /* 0000010100 */ V(0, 5, 9),
+  /* 0000010101 */ V(0, 5, 9),
+  /* 0000010110 */ V(3, 4, 9),
+  /* 0000010111 */ V(3, 4, 9),
+  /* 0000011000 */ V(5, 0, 8),
+  /* 0000011001 */ V(5, 0, 8),
+  /* 0000011010 */ V(5, 0, 8),
+  /* 0000011011 */ V(5, 0, 8),
+  /* 0000011100 */ V(4, 3, 9),
+  /* 0000011101 */ V(4, 3, 9),
+  /* 0000011110 */ V(3, 3, 9),
+  /* 0000011111 */ V(3, 3, 9),
+  /* 0000100000 */ V(2, 4, 8),
+  /* 0000100001 */ V(2, 4, 8),
+  /* 0000100010 */ V(2, 4, 8),
+  /* 0000100011 */ V(2, 4, 8),
+  /* 0000100100 */ V(4, 2, 8),
+  /* 0000100101 */ V(4, 2, 8),
+  /* 0000100110 */ V(4, 2, 8),
+  /* 0000100111 */ V(4, 2, 8),
+  /* 0000101000 */ V(1, 4, 7),
+  /* 0000101001 */ V(1, 4, 7),
+  /* 0000101010 */ V(1, 4, 7),
+  /* 0000101011 */ V(1, 4, 7),
+  /* 0000101100 */ V(1, 4, 7),
+  /* 0000101101 */ V(1, 4, 7),
+  /* 0000101110 */ V(1, 4, 7),
+  /* 0000101111 */ V(1, 4, 7),
+  /* 0000110000 */ V(4, 1, 7),
+  /* 0000110001 */ V(4, 1, 7),
+  /* 0000110010 */ V(4, 1, 7),
+  /* 0000110011 */ V(4, 1, 7),
+  /* 0000110100 */ V(4, 1, 7),
+  /* 0000110101 */ V(4, 1, 7),
+  /* 0000110110 */ V(4, 1, 7),
+  /* 0000110111 */ V(4, 1, 7),
+  /* 0000111000 */ V(4, 0, 7),
+  /* 0000111001 */ V(4, 0, 7),
+  /* 0000111010 */ V(4, 0, 7),
+  /* 0000111011 */ V(4, 0, 7),
+  /* 0000111100 */ V(4, 0, 7),
+  /* 0000111101 */ V(4, 0, 7),
+  /* 0000111110 */ V(4, 0, 7),
+  /* 0000111111 */ V(4, 0, 7),
+  /* 0001000000 */ V(0, 4, 8),
+  /* 0001000001 */ V(0, 4, 8),
+  /* 0001000010 */ V(0, 4, 8),
+  /* 0001000011 */ V(0, 4, 8),
+  /* 0001000100 */ V(2, 3, 8),
+  /* 0001000101 */ V(2, 3, 8),
+  /* 0001000110 */ V(2, 3, 8),
+  /* 0001000111 */ V(2, 3, 8),
+  /* 0001001000 */ V(3, 2, 8),
+  /* 0001001001 */ V(3, 2, 8),
+  /* 0001001010 */ V(3, 2, 8),
+  /* 0001001011 */ V(3, 2, 8),
+  /* 0001001100 */ V(0, 3, 8),
+  /* 0001001101 */ V(0, 3, 8),
+  /* 0001001110 */ V(0, 3, 8),
+  /* 0001001111 */ V(0, 3, 8),
+  /* 0001010000 */ V(1, 3, 7),
+  /* 0001010001 */ V(1, 3, 7),
+  /* 0001010010 */ V(1, 3, 7),
+  /* 0001010011 */ V(1, 3, 7),
+  /* 0001010100 */ V(1, 3, 7),
+  /* 0001010101 */ V(1, 3, 7),
+  /* 0001010110 */ V(1, 3, 7),
+  /* 0001010111 */ V(1, 3, 7),
+  /* 0001011000 */ V(3, 1, 7),
+  /* 0001011001 */ V(3, 1, 7),
+  /* 0001011010 */ V(3, 1, 7),
+  /* 0001011011 */ V(3, 1, 7),
+  /* 0001011100 */ V(3, 1, 7),
+  /* 0001011101 */ V(3, 1, 7),
+  /* 0001011110 */ V(3, 1, 7),
+  /* 0001011111 */ V(3, 1, 7),
+  /* 0001100000 */ V(3, 0, 7),
+  /* 0001100001 */ V(3, 0, 7),
+  /* 0001100010 */ V(3, 0, 7),
+  /* 0001100011 */ V(3, 0, 7),
+  /* 0001100100 */ V(3, 0, 7),
+  /* 0001100101 */ V(3, 0, 7),
+  /* 0001100110 */ V(3, 0, 7),
+  /* 0001100111 */ V(3, 0, 7),
+  /* 0001101000 */ V(2, 2, 7),
+  /* 0001101001 */ V(2, 2, 7),
+  /* 0001101010 */ V(2, 2, 7),
+  /* 0001101011 */ V(2, 2, 7),
+  /* 0001101100 */ V(2, 2, 7),
+  /* 0001101101 */ V(2, 2, 7),
+  /* 0001101110 */ V(2, 2, 7),
+  /* 0001101111 */ V(2, 2, 7),
+  /* 0001110000 */ V(1, 2, 6),
+  /* 0001110001 */ V(1, 2, 6),
+  /* 0001110010 */ V(1, 2, 6),
+  /* 0001110011 */ V(1, 2, 6),
+  /* 0001110100 */ V(1, 2, 6),
+  /* 0001110101 */ V(1, 2, 6),
+  /* 0001110110 */ V(1, 2, 6),
+  /* 0001110111 */ V(1, 2, 6),
+  /* 0001111000 */ V(1, 2, 6),
+  /* 0001111001 */ V(1, 2, 6),
+  /* 0001111010 */ V(1, 2, 6),
+  /* 0001111011 */ V(1, 2, 6),
+  /* 0001111100 */ V(1, 2, 6),
+  /* 0001111101 */ V(1, 2, 6),
+  /* 0001111110 */ V(1, 2, 6),
+  /* 0001111111 */ V(1, 2, 6),
+  /* 0010000000 */ V(2, 1, 5),
+  /* 0010000001 */ V(2, 1, 5),
+  /* 0010000010 */ V(2, 1, 5),
+  /* 0010000011 */ V(2, 1, 5),
+  /* 0010000100 */ V(2, 1, 5),
+  /* 0010000101 */ V(2, 1, 5),
+  /* 0010000110 */ V(2, 1, 5),
+  /* 0010000111 */ V(2, 1, 5),
+  /* 0010001000 */ V(2, 1, 5),
+  /* 0010001001 */ V(2, 1, 5),
+  /* 0010001010 */ V(2, 1, 5),
+  /* 0010001011 */ V(2, 1, 5),
+  /* 0010001100 */ V(2, 1, 5),
+  /* 0010001101 */ V(2, 1, 5),
+  /* 0010001110 */ V(2, 1, 5),
+  /* 0010001111 */ V(2, 1, 5),
+  /* 0010010000 */ V(2, 1, 5),
+  /* 0010010001 */ V(2, 1, 5),
+  /* 0010010010 */ V(2, 1, 5),
+  /* 0010010011 */ V(2, 1, 5),
+  /* 0010010100 */ V(2, 1, 5),
+  /* 0010010101 */ V(2, 1, 5),
+  /* 0010010110 */ V(2, 1, 5),
+  /* 0010010111 */ V(2, 1, 5),
+  /* 0010011000 */ V(2, 1, 5),
+  /* 0010011001 */ V(2, 1, 5),
+  /* 0010011010 */ V(2, 1, 5),
+  /* 0010011011 */ V(2, 1, 5),
+  /* 0010011100 */ V(2, 1, 5),
+  /* 0010011101 */ V(2, 1, 5),
+  /* 0010011110 */ V(2, 1, 5),
+  /* 0010011111 */ V(2, 1, 5),
+  /* 0010100000 */ V(0, 2, 6),
+  /* 0010100001 */ V(0, 2, 6),
+  /* 0010100010 */ V(0, 2, 6),
+  /* 0010100011 */ V(0, 2, 6),
+  /* 0010100100 */ V(0, 2, 6),
+  /* 0010100101 */ V(0, 2, 6),
+  /* 0010100110 */ V(0, 2, 6),
+  /* 0010100111 */ V(0, 2, 6),
+  /* 0010101000 */ V(0, 2, 6),
+  /* 0010101001 */ V(0, 2, 6),
+  /* 0010101010 */ V(0, 2, 6),
+  /* 0010101011 */ V(0, 2, 6),
+  /* 0010101100 */ V(0, 2, 6),
+  /* 0010101101 */ V(0, 2, 6),
+  /* 0010101110 */ V(0, 2, 6),
+  /* 0010101111 */ V(0, 2, 6),
+  /* 0010110000 */ V(2, 0, 6),
+  /* 0010110001 */ V(2, 0, 6),
+  /* 0010110010 */ V(2, 0, 6),
+  /* 0010110011 */ V(2, 0, 6),
+  /* 0010110100 */ V(2, 0, 6),
+  /* 0010110101 */ V(2, 0, 6),
+  /* 0010110110 */ V(2, 0, 6),
+  /* 0010110111 */ V(2, 0, 6),
+  /* 0010111000 */ V(2, 0, 6),
+  /* 0010111001 */ V(2, 0, 6),
+  /* 0010111010 */ V(2, 0, 6),
+  /* 0010111011 */ V(2, 0, 6),
+  /* 0010111100 */ V(2, 0, 6),
+  /* 0010111101 */ V(2, 0, 6),
+  /* 0010111110 */ V(2, 0, 6),
+  /* 0010111111 */ V(2, 0, 6),
+  /* 0011000000 */ V(1, 1, 4),
+  /* 0011000001 */ V(1, 1, 4),
+  /* 0011000010 */ V(1, 1, 4),
+  /* 0011000011 */ V(1, 1, 4),
+  /* 0011000100 */ V(1, 1, 4),
+  /* 0011000101 */ V(1, 1, 4),
+  /* 0011000110 */ V(1, 1, 4),
+  /* 0011000111 */ V(1, 1, 4),
+  /* 0011001000 */ V(1, 1, 4),
+  /* 0011001001 */ V(1, 1, 4),
+  /* 0011001010 */ V(1, 1, 4),
+  /* 0011001011 */ V(1, 1, 4),
+  /* 0011001100 */ V(1, 1, 4),
+  /* 0011001101 */ V(1, 1, 4),
+  /* 0011001110 */ V(1, 1, 4),
+  /* 0011001111 */ V(1, 1, 4),
+  /* 0011010000 */ V(1, 1, 4),
+  /* 0011010001 */ V(1, 1, 4),
+  /* 0011010010 */ V(1, 1, 4),
+  /* 0011010011 */ V(1, 1, 4),
+  /* 0011010100 */ V(1, 1, 4),
+  /* 0011010101 */ V(1, 1, 4),
+  /* 0011010110 */ V(1, 1, 4),
+  /* 0011010111 */ V(1, 1, 4),
+  /* 0011011000 */ V(1, 1, 4),
+  /* 0011011001 */ V(1, 1, 4),
+  /* 0011011010 */ V(1, 1, 4),
+  /* 0011011011 */ V(1, 1, 4),
+  /* 0011011100 */ V(1, 1, 4),
+  /* 0011011101 */ V(1, 1, 4),
+  /* 0011011110 */ V(1, 1, 4),
+  /* 0011011111 */ V(1, 1, 4),
+  /* 0011100000 */ V(1, 1, 4),
+  /* 0011100001 */ V(1, 1, 4),
+  /* 0011100010 */ V(1, 1, 4),
+  /* 0011100011 */ V(1, 1, 4),
+  /* 0011100100 */ V(1, 1, 4),
+  /* 0011100101 */ V(1, 1, 4),
+  /* 0011100110 */ V(1, 1, 4),
+  /* 0011100111 */ V(1, 1, 4),
+  /* 0011101000 */ V(1, 1, 4),
+  /* 0011101001 */ V(1, 1, 4),
+  /* 0011101010 */ V(1, 1, 4),
+  /* 0011101011 */ V(1, 1, 4),
+  /* 0011101100 */ V(1, 1, 4),
+  /* 0011101101 */ V(1, 1, 4),
+  /* 0011101110 */ V(1, 1, 4),
+  /* 0011101111 */ V(1, 1, 4),
+  /* 0011110000 */ V(1, 1, 4),
+  /* 0011110001 */ V(1, 1, 4),
+  /* 0011110010 */ V(1, 1, 4),
+  /* 0011110011 */ V(1, 1, 4),
+  /* 0011110100 */ V(1, 1, 4),
+  /* 0011110101 */ V(1, 1, 4),
+  /* 0011110110 */ V(1, 1, 4),
+  /* 0011110111 */ V(1, 1, 4),
+  /* 0011111000 */ V(1, 1, 4),
+  /* 0011111001 */ V(1, 1, 4),
+  /* 0011111010 */ V(1, 1, 4),
+  /* 0011111011 */ V(1, 1, 4),
+  /* 0011111100 */ V(1, 1, 4),
+  /* 0011111101 */ V(1, 1, 4),
+  /* 0011111110 */ V(1, 1, 4),
+  /* 0011111111 */ V(1, 1, 4),
+  /* 0100000000 */ V(0, 1, 3),
+  /* 0100000001 */ V(0, 1, 3),
+  /* 0100000010 */ V(0, 1, 3),
+  /* 0100000011 */ V(0, 1, 3),
+  /* 0100000100 */ V(0, 1, 3),
+  /* 0100000101 */ V(0, 1, 3),
+  /* 0100000110 */ V(0, 1, 3),
+  /* 0100000111 */ V(0, 1, 3),
+  /* 0100001000 */ V(0, 1, 3),
+  /* 0100001001 */ V(0, 1, 3),
+  /* 0100001010 */ V(0, 1, 3),
+  /* 0100001011 */ V(0, 1, 3),
+  /* 0100001100 */ V(0, 1, 3),
+  /* 0100001101 */ V(0, 1, 3),
+  /* 0100001110 */ V(0, 1, 3),
+  /* 0100001111 */ V(0, 1, 3),
+  /* 0100010000 */ V(0, 1, 3),
+  /* 0100010001 */ V(0, 1, 3),
+  /* 0100010010 */ V(0, 1, 3),
+  /* 0100010011 */ V(0, 1, 3),
+  /* 0100010100 */ V(0, 1, 3),
+  /* 0100010101 */ V(0, 1, 3),
+  /* 0100010110 */ V(0, 1, 3),
+  /* 0100010111 */ V(0, 1, 3),
+  /* 0100011000 */ V(0, 1, 3),
+  /* 0100011001 */ V(0, 1, 3),
+  /* 0100011010 */ V(0, 1, 3),
+  /* 0100011011 */ V(0, 1, 3),
+  /* 0100011100 */ V(0, 1, 3),
+  /* 0100011101 */ V(0, 1, 3),
+  /* 0100011110 */ V(0, 1, 3),
+  /* 0100011111 */ V(0, 1, 3),
+  /* 0100100000 */ V(0, 1, 3),
+  /* 0100100001 */ V(0, 1, 3),
+  /* 0100100010 */ V(0, 1, 3),
+  /* 0100100011 */ V(0, 1, 3),
+  /* 0100100100 */ V(0, 1, 3),
+  /* 0100100101 */ V(0, 1, 3),
+  /* 0100100110 */ V(0, 1, 3),
+  /* 0100100111 */ V(0, 1, 3),
+  /* 0100101000 */ V(0, 1, 3),
+  /* 0100101001 */ V(0, 1, 3),
+  /* 0100101010 */ V(0, 1, 3),
+  /* 0100101011 */ V(0, 1, 3),
+  /* 0100101100 */ V(0, 1, 3),
+  /* 0100101101 */ V(0, 1, 3),
+  /* 0100101110 */ V(0, 1, 3),
+  /* 0100101111 */ V(0, 1, 3),
+  /* 0100110000 */ V(0, 1, 3),
+  /* 0100110001 */ V(0, 1, 3),
+  /* 0100110010 */ V(0, 1, 3),
+  /* 0100110011 */ V(0, 1, 3),
+  /* 0100110100 */ V(0, 1, 3),
+  /* 0100110101 */ V(0, 1, 3),
+  /* 0100110110 */ V(0, 1, 3),
+  /* 0100110111 */ V(0, 1, 3),
+  /* 0100111000 */ V(0, 1, 3),
+  /* 0100111001 */ V(0, 1, 3),
+  /* 0100111010 */ V(0, 1, 3),
+  /* 0100111011 */ V(0, 1, 3),
+  /* 0100111100 */ V(0, 1, 3),
+  /* 0100111101 */ V(0, 1, 3),
+  /* 0100111110 */ V(0, 1, 3),
+  /* 0100111111 */ V(0, 1, 3),
+  /* 0101000000 */ V(0, 1, 3),
+  /* 0101000001 */ V(0, 1, 3),
+  /* 0101000010 */ V(0, 1, 3),
+  /* 0101000011 */ V(0, 1, 3),
+  /* 0101000100 */ V(0, 1, 3),
+  /* 0101000101 */ V(0, 1, 3),
+  /* 0101000110 */ V(0, 1, 3),
+  /* 0101000111 */ V(0, 1, 3),
+  /* 0101001000 */ V(0, 1, 3),
+  /* 0101001001 */ V(0, 1, 3),
+  /* 0101001010 */ V(0, 1, 3),
+  /* 0101001011 */ V(0, 1, 3),
+  /* 0101001100 */ V(0, 1, 3),
+  /* 0101001101 */ V(0, 1, 3),
+  /* 0101001110 */ V(0, 1, 3),
+  /* 0101001111 */ V(0, 1, 3),
+  /* 0101010000 */ V(0, 1, 3),
+  /* 0101010001 */ V(0, 1, 3),
+  /* 0101010010 */ V(0, 1, 3),
+  /* 0101010011 */ V(0, 1, 3),
+  /* 0101010100 */ V(0, 1, 3),
+  /* 0101010101 */ V(0, 1, 3),
+  /* 0101010110 */ V(0, 1, 3),
+  /* 0101010111 */ V(0, 1, 3),
+  /* 0101011000 */ V(0, 1, 3),
+  /* 0101011001 */ V(0, 1, 3),
+  /* 0101011010 */ V(0, 1, 3),
+  /* 0101011011 */ V(0, 1, 3),
+  /* 0101011100 */ V(0, 1, 3),
+  /* 0101011101 */ V(0, 1, 3),
+  /* 0101011110 */ V(0, 1, 3),
+  /* 0101011111 */ V(0, 1, 3),
+  /* 0101100000 */ V(0, 1, 3),
+  /* 0101100001 */ V(0, 1, 3),
+  /* 0101100010 */ V(0, 1, 3),
+  /* 0101100011 */ V(0, 1, 3),
+  /* 0101100100 */ V(0, 1, 3),
+  /* 0101100101 */ V(0, 1, 3),
+  /* 0101100110 */ V(0, 1, 3),
+  /* 0101100111 */ V(0, 1, 3),
+  /* 0101101000 */ V(0, 1, 3),
+  /* 0101101001 */ V(0, 1, 3),
+  /* 0101101010 */ V(0, 1, 3),
+  /* 0101101011 */ V(0, 1, 3),
+  /* 0101101100 */ V(0, 1, 3),
+  /* 0101101101 */ V(0, 1, 3),
+  /* 0101101110 */ V(0, 1, 3),
+  /* 0101101111 */ V(0, 1, 3),
+  /* 0101110000 */ V(0, 1, 3),
+  /* 0101110001 */ V(0, 1, 3),
+  /* 0101110010 */ V(0, 1, 3),
+  /* 0101110011 */ V(0, 1, 3),
+  /* 0101110100 */ V(0, 1, 3),
+  /* 0101110101 */ V(0, 1, 3),
+  /* 0101110110 */ V(0, 1, 3),
+  /* 0101110111 */ V(0, 1, 3),
+  /* 0101111000 */ V(0, 1, 3),
+  /* 0101111001 */ V(0, 1, 3),
+  /* 0101111010 */ V(0, 1, 3),
+  /* 0101111011 */ V(0, 1, 3),
+  /* 0101111100 */ V(0, 1, 3),
+  /* 0101111101 */ V(0, 1, 3),
+  /* 0101111110 */ V(0, 1, 3),
+  /* 0101111111 */ V(0, 1, 3),
+  /* 0110000000 */ V(1, 0, 3),
+  /* 0110000001 */ V(1, 0, 3),
+  /* 0110000010 */ V(1, 0, 3),
+  /* 0110000011 */ V(1, 0, 3),
+  /* 0110000100 */ V(1, 0, 3),
+  /* 0110000101 */ V(1, 0, 3),
+  /* 0110000110 */ V(1, 0, 3),
+  /* 0110000111 */ V(1, 0, 3),
+  /* 0110001000 */ V(1, 0, 3),
+  /* 0110001001 */ V(1, 0, 3),
+  /* 0110001010 */ V(1, 0, 3),
+  /* 0110001011 */ V(1, 0, 3),
+  /* 0110001100 */ V(1, 0, 3),
+  /* 0110001101 */ V(1, 0, 3),
+  /* 0110001110 */ V(1, 0, 3),
+  /* 0110001111 */ V(1, 0, 3),
+  /* 0110010000 */ V(1, 0, 3),
+  /* 0110010001 */ V(1, 0, 3),
+  /* 0110010010 */ V(1, 0, 3),
+  /* 0110010011 */ V(1, 0, 3),
+  /* 0110010100 */ V(1, 0, 3),
+  /* 0110010101 */ V(1, 0, 3),
+  /* 0110010110 */ V(1, 0, 3),
+  /* 0110010111 */ V(1, 0, 3),
+  /* 0110011000 */ V(1, 0, 3),
+  /* 0110011001 */ V(1, 0, 3),
+  /* 0110011010 */ V(1, 0, 3),
+  /* 0110011011 */ V(1, 0, 3),
+  /* 0110011100 */ V(1, 0, 3),
+  /* 0110011101 */ V(1, 0, 3),
+  /* 0110011110 */ V(1, 0, 3),
+  /* 0110011111 */ V(1, 0, 3),
+  /* 0110100000 */ V(1, 0, 3),
+  /* 0110100001 */ V(1, 0, 3),
+  /* 0110100010 */ V(1, 0, 3),
+  /* 0110100011 */ V(1, 0, 3),
+  /* 0110100100 */ V(1, 0, 3),
+  /* 0110100101 */ V(1, 0, 3),
+  /* 0110100110 */ V(1, 0, 3),
+  /* 0110100111 */ V(1, 0, 3),
+  /* 0110101000 */ V(1, 0, 3),
+  /* 0110101001 */ V(1, 0, 3),
+  /* 0110101010 */ V(1, 0, 3),
+  /* 0110101011 */ V(1, 0, 3),
+  /* 0110101100 */ V(1, 0, 3),
+  /* 0110101101 */ V(1, 0, 3),
+  /* 0110101110 */ V(1, 0, 3),
+  /* 0110101111 */ V(1, 0, 3),
+  /* 0110110000 */ V(1, 0, 3),
+  /* 0110110001 */ V(1, 0, 3),
+  /* 0110110010 */ V(1, 0, 3),
+  /* 0110110011 */ V(1, 0, 3),
+  /* 0110110100 */ V(1, 0, 3),
+  /* 0110110101 */ V(1, 0, 3),
+  /* 0110110110 */ V(1, 0, 3),
+  /* 0110110111 */ V(1, 0, 3),
+  /* 0110111000 */ V(1, 0, 3),
+  /* 0110111001 */ V(1, 0, 3),
+  /* 0110111010 */ V(1, 0, 3),
+  /* 0110111011 */ V(1, 0, 3),
+  /* 0110111100 */ V(1, 0, 3),
+  /* 0110111101 */ V(1, 0, 3),
+  /* 0110111110 */ V(1, 0, 3),
+  /* 0110111111 */ V(1, 0, 3),
+  /* 0111000000 */ V(1, 0, 3),
+  /* 0111000001 */ V(1, 0, 3),
+  /* 0111000010 */ V(1, 0, 3),
+  /* 0111000011 */ V(1, 0, 3),
+  /* 0111000100 */ V(1, 0, 3),
+  /* 0111000101 */ V(1, 0, 3),
+  /* 0111000110 */ V(1, 0, 3),
+  /* 0111000111 */ V(1, 0, 3),
+  /* 0111001000 */ V(1, 0, 3),
+  /* 0111001001 */ V(1, 0, 3),
+  /* 0111001010 */ V(1, 0, 3),
+  /* 0111001011 */ V(1, 0, 3),
+  /* 0111001100 */ V(1, 0, 3),
+  /* 0111001101 */ V(1, 0, 3),
+  /* 0111001110 */ V(1, 0, 3),
+  /* 0111001111 */ V(1, 0, 3),
+  /* 0111010000 */ V(1, 0, 3),
+  /* 0111010001 */ V(1, 0, 3),
+  /* 0111010010 */ V(1, 0, 3),
+  /* 0111010011 */ V(1, 0, 3),
+  /* 0111010100 */ V(1, 0, 3),
+  /* 0111010101 */ V(1, 0, 3),
+  /* 0111010110 */ V(1, 0, 3),
+  /* 0111010111 */ V(1, 0, 3),
+  /* 0111011000 */ V(1, 0, 3),
+  /* 0111011001 */ V(1, 0, 3),
+  /* 0111011010 */ V(1, 0, 3),
+  /* 0111011011 */ V(1, 0, 3),
+  /* 0111011100 */ V(1, 0, 3),
+  /* 0111011101 */ V(1, 0, 3),
+  /* 0111011110 */ V(1, 0, 3),
+  /* 0111011111 */ V(1, 0, 3),
+  /* 0111100000 */ V(1, 0, 3),
+  /* 0111100001 */ V(1, 0, 3),
+  /* 0111100010 */ V(1, 0, 3),
+  /* 0111100011 */ V(1, 0, 3),
+  /* 0111100100 */ V(1, 0, 3),
+  /* 0111100101 */ V(1, 0, 3),
+  /* 0111100110 */ V(1, 0, 3),
+  /* 0111100111 */ V(1, 0, 3),
+  /* 0111101000 */ V(1, 0, 3),
+  /* 0111101001 */ V(1, 0, 3),
+  /* 0111101010 */ V(1, 0, 3),
+  /* 0111101011 */ V(1, 0, 3),
+  /* 0111101100 */ V(1, 0, 3),
+  /* 0111101101 */ V(1, 0, 3),
+  /* 0111101110 */ V(1, 0, 3),
+  /* 0111101111 */ V(1, 0, 3),
+  /* 0111110000 */ V(1, 0, 3),
+  /* 0111110001 */ V(1, 0, 3),
+  /* 0111110010 */ V(1, 0, 3),
+  /* 0111110011 */ V(1, 0, 3),
+  /* 0111110100 */ V(1, 0, 3),
+  /* 0111110101 */ V(1, 0, 3),
+  /* 0111110110 */ V(1, 0, 3),
+  /* 0111110111 */ V(1, 0, 3),
+  /* 0111111000 */ V(1, 0, 3),
+  /* 0111111001 */ V(1, 0, 3),
+  /* 0111111010 */ V(1, 0, 3),
+  /* 0111111011 */ V(1, 0, 3),
+  /* 0111111100 */ V(1, 0, 3),
+  /* 0111111101 */ V(1, 0, 3),
+  /* 0111111110 */ V(1, 0, 3),
+  /* 0111111111 */ V(1, 0, 3),
+  /* 1000000000 */ V(0, 0, 1),
+  /* 1000000001 */ V(0, 0, 1),
+  /* 1000000010 */ V(0, 0, 1),
+  /* 1000000011 */ V(0, 0, 1),
+  /* 1000000100 */ V(0, 0, 1),
+  /* 1000000101 */ V(0, 0, 1),
+  /* 1000000110 */ V(0, 0, 1),
+  /* 1000000111 */ V(0, 0, 1),
+  /* 1000001000 */ V(0, 0, 1),
+  /* 1000001001 */ V(0, 0, 1),
+  /* 1000001010 */ V(0, 0, 1),
+  /* 1000001011 */ V(0, 0, 1),
+  /* 1000001100 */ V(0, 0, 1),
+  /* 1000001101 */ V(0, 0, 1),
+  /* 1000001110 */ V(0, 0, 1),
+  /* 1000001111 */ V(0, 0, 1),
+  /* 1000010000 */ V(0, 0, 1),
+  /* 1000010001 */ V(0, 0, 1),
+  /* 1000010010 */ V(0, 0, 1),
+  /* 1000010011 */ V(0, 0, 1),
+  /* 1000010100 */ V(0, 0, 1),
+  /* 1000010101 */ V(0, 0, 1),
+  /* 1000010110 */ V(0, 0, 1),
+  /* 1000010111 */ V(0, 0, 1),
+  /* 1000011000 */ V(0, 0, 1),
+  /* 1000011001 */ V(0, 0, 1),
+  /* 1000011010 */ V(0, 0, 1),
+  /* 1000011011 */ V(0, 0, 1),
+  /* 1000011100 */ V(0, 0, 1),
+  /* 1000011101 */ V(0, 0, 1),
+  /* 1000011110 */ V(0, 0, 1),
+  /* 1000011111 */ V(0, 0, 1),
+  /* 1000100000 */ V(0, 0, 1),
+  /* 1000100001 */ V(0, 0, 1),
+  /* 1000100010 */ V(0, 0, 1),
+  /* 1000100011 */ V(0, 0, 1),
+  /* 1000100100 */ V(0, 0, 1),
+  /* 1000100101 */ V(0, 0, 1),
+  /* 1000100110 */ V(0, 0, 1),
+  /* 1000100111 */ V(0, 0, 1),
+  /* 1000101000 */ V(0, 0, 1),
+  /* 1000101001 */ V(0, 0, 1),
+  /* 1000101010 */ V(0, 0, 1),
+  /* 1000101011 */ V(0, 0, 1),
+  /* 1000101100 */ V(0, 0, 1),
+  /* 1000101101 */ V(0, 0, 1),
+  /* 1000101110 */ V(0, 0, 1),
+  /* 1000101111 */ V(0, 0, 1),
+  /* 1000110000 */ V(0, 0, 1),
+  /* 1000110001 */ V(0, 0, 1),
+  /* 1000110010 */ V(0, 0, 1),
+  /* 1000110011 */ V(0, 0, 1),
+  /* 1000110100 */ V(0, 0, 1),
+  /* 1000110101 */ V(0, 0, 1),
+  /* 1000110110 */ V(0, 0, 1),
+  /* 1000110111 */ V(0, 0, 1),
+  /* 1000111000 */ V(0, 0, 1),
+  /* 1000111001 */ V(0, 0, 1),
+  /* 1000111010 */ V(0, 0, 1),
+  /* 1000111011 */ V(0, 0, 1),
+  /* 1000111100 */ V(0, 0, 1),
+  /* 1000111101 */ V(0, 0, 1),
+  /* 1000111110 */ V(0, 0, 1),
+  /* 1000111111 */ V(0, 0, 1),
+  /* 1001000000 */ V(0, 0, 1),
+  /* 1001000001 */ V(0, 0, 1),
+  /* 1001000010 */ V(0, 0, 1),
+  /* 1001000011 */ V(0, 0, 1),
+  /* 1001000100 */ V(0, 0, 1),
+  /* 1001000101 */ V(0, 0, 1),
+  /* 1001000110 */ V(0, 0, 1),
+  /* 1001000111 */ V(0, 0, 1),
+  /* 1001001000 */ V(0, 0, 1),
+  /* 1001001001 */ V(0, 0, 1),
+  /* 1001001010 */ V(0, 0, 1),
+  /* 1001001011 */ V(0, 0, 1),
+  /* 1001001100 */ V(0, 0, 1),
+  /* 1001001101 */ V(0, 0, 1),
+  /* 1001001110 */ V(0, 0, 1),
+  /* 1001001111 */ V(0, 0, 1),
+  /* 1001010000 */ V(0, 0, 1),
+  /* 1001010001 */ V(0, 0, 1),
+  /* 1001010010 */ V(0, 0, 1),
+  /* 1001010011 */ V(0, 0, 1),
+  /* 1001010100 */ V(0, 0, 1),
+  /* 1001010101 */ V(0, 0, 1),
+  /* 1001010110 */ V(0, 0, 1),
+  /* 1001010111 */ V(0, 0, 1),
+  /* 1001011000 */ V(0, 0, 1),
+  /* 1001011001 */ V(0, 0, 1),
+  /* 1001011010 */ V(0, 0, 1),
+  /* 1001011011 */ V(0, 0, 1),
+  /* 1001011100 */ V(0, 0, 1),
+  /* 1001011101 */ V(0, 0, 1),
+  /* 1001011110 */ V(0, 0, 1),
+  /* 1001011111 */ V(0, 0, 1),
+  /* 1001100000 */ V(0, 0, 1),
+  /* 1001100001 */ V(0, 0, 1),
+  /* 1001100010 */ V(0, 0, 1),
+  /* 1001100011 */ V(0, 0, 1),
+  /* 1001100100 */ V(0, 0, 1),
+  /* 1001100101 */ V(0, 0, 1),
+  /* 1001100110 */ V(0, 0, 1),
+  /* 1001100111 */ V(0, 0, 1),
+  /* 1001101000 */ V(0, 0, 1),
+  /* 1001101001 */ V(0, 0, 1),
+  /* 1001101010 */ V(0, 0, 1),
+  /* 1001101011 */ V(0, 0, 1),
+  /* 1001101100 */ V(0, 0, 1),
+  /* 1001101101 */ V(0, 0, 1),
+  /* 1001101110 */ V(0, 0, 1),
+  /* 1001101111 */ V(0, 0, 1),
+  /* 1001110000 */ V(0, 0, 1),
+  /* 1001110001 */ V(0, 0, 1),
+  /* 1001110010 */ V(0, 0, 1),
+  /* 1001110011 */ V(0, 0, 1),
+  /* 1001110100 */ V(0, 0, 1),
+  /* 1001110101 */ V(0, 0, 1),
+  /* 1001110110 */ V(0, 0, 1),
+  /* 1001110111 */ V(0, 0, 1),
+  /* 1001111000 */ V(0, 0, 1),
+  /* 1001111001 */ V(0, 0, 1),
+  /* 1001111010 */ V(0, 0, 1),
+  /* 1001111011 */ V(0, 0, 1),
+  /* 1001111100 */ V(0, 0, 1),
+  /* 1001111101 */ V(0, 0, 1),
+  /* 1001111110 */ V(0, 0, 1),
+  /* 1001111111 */ V(0, 0, 1),
+  /* 1010000000 */ V(0, 0, 1),
+  /* 1010000001 */ V(0, 0, 1),
+  /* 1010000010 */ V(0, 0, 1),
+  /* 1010000011 */ V(0, 0, 1),
+  /* 1010000100 */ V(0, 0, 1),
+  /* 1010000101 */ V(0, 0, 1),
+  /* 1010000110 */ V(0, 0, 1),
+  /* 1010000111 */ V(0, 0, 1),
+  /* 1010001000 */ V(0, 0, 1),
+  /* 1010001001 */ V(0, 0, 1),
+  /* 1010001010 */ V(0, 0, 1),
+  /* 1010001011 */ V(0, 0, 1),
+  /* 1010001100 */ V(0, 0, 1),
+  /* 1010001101 */ V(0, 0, 1),
+  /* 1010001110 */ V(0, 0, 1),
+  /* 1010001111 */ V(0, 0, 1),
+  /* 1010010000 */ V(0, 0, 1),
+  /* 1010010001 */ V(0, 0, 1),
+  /* 1010010010 */ V(0, 0, 1),
+  /* 1010010011 */ V(0, 0, 1),
+  /* 1010010100 */ V(0, 0, 1),
+  /* 1010010101 */ V(0, 0, 1),
+  /* 1010010110 */ V(0, 0, 1),
+  /* 1010010111 */ V(0, 0, 1),
+  /* 1010011000 */ V(0, 0, 1),
+  /* 1010011001 */ V(0, 0, 1),
+  /* 1010011010 */ V(0, 0, 1),
+  /* 1010011011 */ V(0, 0, 1),
+  /* 1010011100 */ V(0, 0, 1),
+  /* 1010011101 */ V(0, 0, 1),
+  /* 1010011110 */ V(0, 0, 1),
+  /* 1010011111 */ V(0, 0, 1),
+  /* 1010100000 */ V(0, 0, 1),
+  /* 1010100001 */ V(0, 0, 1),
+  /* 1010100010 */ V(0, 0, 1),
+  /* 1010100011 */ V(0, 0, 1),
+  /* 1010100100 */ V(0, 0, 1),
+  /* 1010100101 */ V(0, 0, 1),
+  /* 1010100110 */ V(0, 0, 1),
+  /* 1010100111 */ V(0, 0, 1),
+  /* 1010101000 */ V(0, 0, 1),
+  /* 1010101001 */ V(0, 0, 1),
+  /* 1010101010 */ V(0, 0, 1),
+  /* 1010101011 */ V(0, 0, 1),
+  /* 1010101100 */ V(0, 0, 1),
+  /* 1010101101 */ V(0, 0, 1),
+  /* 1010101110 */ V(0, 0, 1),
+  /* 1010101111 */ V(0, 0, 1),
+  /* 1010110000 */ V(0, 0, 1),
+  /* 1010110001 */ V(0, 0, 1),
+  /* 1010110010 */ V(0, 0, 1),
+  /* 1010110011 */ V(0, 0, 1),
+  /* 1010110100 */ V(0, 0, 1),
+  /* 1010110101 */ V(0, 0, 1),
+  /* 1010110110 */ V(0, 0, 1),
+  /* 1010110111 */ V(0, 0, 1),
+  /* 1010111000 */ V(0, 0, 1),
+  /* 1010111001 */ V(0, 0, 1),
+  /* 1010111010 */ V(0, 0, 1),
+  /* 1010111011 */ V(0, 0, 1),
+  /* 1010111100 */ V(0, 0, 1),
+  /* 1010111101 */ V(0, 0, 1),
+  /* 1010111110 */ V(0, 0, 1),
+  /* 1010111111 */ V(0, 0, 1),
+  /* 1011000000 */ V(0, 0, 1),
+  /* 1011000001 */ V(0, 0, 1),
+  /* 1011000010 */ V(0, 0, 1),
+  /* 1011000011 */ V(0, 0, 1),
+  /* 1011000100 */ V(0, 0, 1),
+  /* 1011000101 */ V(0, 0, 1),
+  /* 1011000110 */ V(0, 0, 1),
+  /* 1011000111 */ V(0, 0, 1),
+  /* 1011001000 */ V(0, 0, 1),
+  /* 1011001001 */ V(0, 0, 1),
+  /* 1011001010 */ V(0, 0, 1),
+  /* 1011001011 */ V(0, 0, 1),
+  /* 1011001100 */ V(0, 0, 1),
+  /* 1011001101 */ V(0, 0, 1),
+  /* 1011001110 */ V(0, 0, 1),
+  /* 1011001111 */ V(0, 0, 1),
+  /* 1011010000 */ V(0, 0, 1),
+  /* 1011010001 */ V(0, 0, 1),
+  /* 1011010010 */ V(0, 0, 1),
+  /* 1011010011 */ V(0, 0, 1),
+  /* 1011010100 */ V(0, 0, 1),
+  /* 1011010101 */ V(0, 0, 1),
+  /* 1011010110 */ V(0, 0, 1),
+  /* 1011010111 */ V(0, 0, 1),
+  /* 1011011000 */ V(0, 0, 1),
+  /* 1011011001 */ V(0, 0, 1),
+  /* 1011011010 */ V(0, 0, 1),
+  /* 1011011011 */ V(0, 0, 1),
+  /* 1011011100 */ V(0, 0, 1),
+  /* 1011011101 */ V(0, 0, 1),
+  /* 1011011110 */ V(0, 0, 1),
+  /* 1011011111 */ V(0, 0, 1),
+  /* 1011100000 */ V(0, 0, 1),
+  /* 1011100001 */ V(0, 0, 1),
+  /* 1011100010 */ V(0, 0, 1),
+  /* 1011100011 */ V(0, 0, 1),
+  /* 1011100100 */ V(0, 0, 1),
+  /* 1011100101 */ V(0, 0, 1),
+  /* 1011100110 */ V(0, 0, 1),
+  /* 1011100111 */ V(0, 0, 1),
+  /* 1011101000 */ V(0, 0, 1),
+  /* 1011101001 */ V(0, 0, 1),
+  /* 1011101010 */ V(0, 0, 1),
+  /* 1011101011 */ V(0, 0, 1),
+  /* 1011101100 */ V(0, 0, 1),
+  /* 1011101101 */ V(0, 0, 1),
+  /* 1011101110 */ V(0, 0, 1),
+  /* 1011101111 */ V(0, 0, 1),
+  /* 1011110000 */ V(0, 0, 1),
+  /* 1011110001 */ V(0, 0, 1),
+  /* 1011110010 */ V(0, 0, 1),
+  /* 1011110011 */ V(0, 0, 1),
+  /* 1011110100 */ V(0, 0, 1),
+  /* 1011110101 */ V(0, 0, 1),
+  /* 1011110110 */ V(0, 0, 1),
+  /* 1011110111 */ V(0, 0, 1),
+  /* 1011111000 */ V(0, 0, 1),
+  /* 1011111001 */ V(0, 0, 1),
+  /* 1011111010 */ V(0, 0, 1),
+  /* 1011111011 */ V(0, 0, 1),
+  /* 1011111100 */ V(0, 0, 1),
+  /* 1011111101 */ V(0, 0, 1),
+  /* 1011111110 */ V(0, 0, 1),
+  /* 1011111111 */ V(0, 0, 1),
+  /* 1100000000 */ V(0, 0, 1),
+  /* 1100000001 */ V(0, 0, 1),
+  /* 1100000010 */ V(0, 0, 1),
+  /* 1100000011 */ V(0, 0, 1),
+  /* 1100000100 */ V(0, 0, 1),
+  /* 1100000101 */ V(0, 0, 1),
+  /* 1100000110 */ V(0, 0, 1),
+  /* 1100000111 */ V(0, 0, 1),
+  /* 1100001000 */ V(0, 0, 1),
+  /* 1100001001 */ V(0, 0, 1),
+  /* 1100001010 */ V(0, 0, 1),
+  /* 1100001011 */ V(0, 0, 1),
+  /* 1100001100 */ V(0, 0, 1),
+  /* 1100001101 */ V(0, 0, 1),
+  /* 1100001110 */ V(0, 0, 1),
+  /* 1100001111 */ V(0, 0, 1),
+  /* 1100010000 */ V(0, 0, 1),
+  /* 1100010001 */ V(0, 0, 1),
+  /* 1100010010 */ V(0, 0, 1),
+  /* 1100010011 */ V(0, 0, 1),
+  /* 1100010100 */ V(0, 0, 1),
+  /* 1100010101 */ V(0, 0, 1),
+  /* 1100010110 */ V(0, 0, 1),
+  /* 1100010111 */ V(0, 0, 1),
+  /* 1100011000 */ V(0, 0, 1),
+  /* 1100011001 */ V(0, 0, 1),
+  /* 1100011010 */ V(0, 0, 1),
+  /* 1100011011 */ V(0, 0, 1),
+  /* 1100011100 */ V(0, 0, 1),
+  /* 1100011101 */ V(0, 0, 1),
+  /* 1100011110 */ V(0, 0, 1),
+  /* 1100011111 */ V(0, 0, 1),
+  /* 1100100000 */ V(0, 0, 1),
+  /* 1100100001 */ V(0, 0, 1),
+  /* 1100100010 */ V(0, 0, 1),
+  /* 1100100011 */ V(0, 0, 1),
+  /* 1100100100 */ V(0, 0, 1),
+  /* 1100100101 */ V(0, 0, 1),
+  /* 1100100110 */ V(0, 0, 1),
+  /* 1100100111 */ V(0, 0, 1),
+  /* 1100101000 */ V(0, 0, 1),
+  /* 1100101001 */ V(0, 0, 1),
+  /* 1100101010 */ V(0, 0, 1),
+  /* 1100101011 */ V(0, 0, 1),
+  /* 1100101100 */ V(0, 0, 1),
+  /* 1100101101 */ V(0, 0, 1),
+  /* 1100101110 */ V(0, 0, 1),
+  /* 1100101111 */ V(0, 0, 1),
+  /* 1100110000 */ V(0, 0, 1),
+  /* 1100110001 */ V(0, 0, 1),
+  /* 1100110010 */ V(0, 0, 1),
+  /* 1100110011 */ V(0, 0, 1),
+  /* 1100110100 */ V(0, 0, 1),
+  /* 1100110101 */ V(0, 0, 1),
+  /* 1100110110 */ V(0, 0, 1),
+  /* 1100110111 */ V(0, 0, 1),
+  /* 1100111000 */ V(0, 0, 1),
+  /* 1100111001 */ V(0, 0, 1),
+  /* 1100111010 */ V(0, 0, 1),
+  /* 1100111011 */ V(0, 0, 1),
+  /* 1100111100 */ V(0, 0, 1),
+  /* 1100111101 */ V(0, 0, 1),
+  /* 1100111110 */ V(0, 0, 1),
+  /* 1100111111 */ V(0, 0, 1),
+  /* 1101000000 */ V(0, 0, 1),
+  /* 1101000001 */ V(0, 0, 1),
+  /* 1101000010 */ V(0, 0, 1),
+  /* 1101000011 */ V(0, 0, 1),
+  /* 1101000100 */ V(0, 0, 1),
+  /* 1101000101 */ V(0, 0, 1),
+  /* 1101000110 */ V(0, 0, 1),
+  /* 1101000111 */ V(0, 0, 1),
+  /* 1101001000 */ V(0, 0, 1),
+  /* 1101001001 */ V(0, 0, 1),
+  /* 1101001010 */ V(0, 0, 1),
+  /* 1101001011 */ V(0, 0, 1),
+  /* 1101001100 */ V(0, 0, 1),
+  /* 1101001101 */ V(0, 0, 1),
+  /* 1101001110 */ V(0, 0, 1),
+  /* 1101001111 */ V(0, 0, 1),
+  /* 1101010000 */ V(0, 0, 1),
+  /* 1101010001 */ V(0, 0, 1),
+  /* 1101010010 */ V(0, 0, 1),
+  /* 1101010011 */ V(0, 0, 1),
+  /* 1101010100 */ V(0, 0, 1),
+  /* 1101010101 */ V(0, 0, 1),
+  /* 1101010110 */ V(0, 0, 1),
+  /* 1101010111 */ V(0, 0, 1),
+  /* 1101011000 */ V(0, 0, 1),
+  /* 1101011001 */ V(0, 0, 1),
+  /* 1101011010 */ V(0, 0, 1),
+  /* 1101011011 */ V(0, 0, 1),
+  /* 1101011100 */ V(0, 0, 1),
+  /* 1101011101 */ V(0, 0, 1),
+  /* 1101011110 */ V(0, 0, 1),
+  /* 1101011111 */ V(0, 0, 1),
+  /* 1101100000 */ V(0, 0, 1),
+  /* 1101100001 */ V(0, 0, 1),
+  /* 1101100010 */ V(0, 0, 1),
+  /* 1101100011 */ V(0, 0, 1),
+  /* 1101100100 */ V(0, 0, 1),
+  /* 1101100101 */ V(0, 0, 1),
+  /* 1101100110 */ V(0, 0, 1),
+  /* 1101100111 */ V(0, 0, 1),
+  /* 1101101000 */ V(0, 0, 1),
+  /* 1101101001 */ V(0, 0, 1),
+  /* 1101101010 */ V(0, 0, 1),
+  /* 1101101011 */ V(0, 0, 1),
+  /* 1101101100 */ V(0, 0, 1),
+  /* 1101101101 */ V(0, 0, 1),
+  /* 1101101110 */ V(0, 0, 1),
+  /* 1101101111 */ V(0, 0, 1),
+  /* 1101110000 */ V(0, 0, 1),
+  /* 1101110001 */ V(0, 0, 1),
+  /* 1101110010 */ V(0, 0, 1),
+  /* 1101110011 */ V(0, 0, 1),
+  /* 1101110100 */ V(0, 0, 1),
+  /* 1101110101 */ V(0, 0, 1),
+  /* 1101110110 */ V(0, 0, 1),
+  /* 1101110111 */ V(0, 0, 1),
+  /* 1101111000 */ V(0, 0, 1),
+  /* 1101111001 */ V(0, 0, 1),
+  /* 1101111010 */ V(0, 0, 1),
+  /* 1101111011 */ V(0, 0, 1),
+  /* 1101111100 */ V(0, 0, 1),
+  /* 1101111101 */ V(0, 0, 1),
+  /* 1101111110 */ V(0, 0, 1),
+  /* 1101111111 */ V(0, 0, 1),
+  /* 1110000000 */ V(0, 0, 1),
+  /* 1110000001 */ V(0, 0, 1),
+  /* 1110000010 */ V(0, 0, 1),
+  /* 1110000011 */ V(0, 0, 1),
+  /* 1110000100 */ V(0, 0, 1),
+  /* 1110000101 */ V(0, 0, 1),
+  /* 1110000110 */ V(0, 0, 1),
+  /* 1110000111 */ V(0, 0, 1),
+  /* 1110001000 */ V(0, 0, 1),
+  /* 1110001001 */ V(0, 0, 1),
+  /* 1110001010 */ V(0, 0, 1),
+  /* 1110001011 */ V(0, 0, 1),
+  /* 1110001100 */ V(0, 0, 1),
+  /* 1110001101 */ V(0, 0, 1),
+  /* 1110001110 */ V(0, 0, 1),
+  /* 1110001111 */ V(0, 0, 1),
+  /* 1110010000 */ V(0, 0, 1),
+  /* 1110010001 */ V(0, 0, 1),
+  /* 1110010010 */ V(0, 0, 1),
+  /* 1110010011 */ V(0, 0, 1),
+  /* 1110010100 */ V(0, 0, 1),
+  /* 1110010101 */ V(0, 0, 1),
+  /* 1110010110 */ V(0, 0, 1),
+  /* 1110010111 */ V(0, 0, 1),
+  /* 1110011000 */ V(0, 0, 1),
+  /* 1110011001 */ V(0, 0, 1),
+  /* 1110011010 */ V(0, 0, 1),
+  /* 1110011011 */ V(0, 0, 1),
+  /* 1110011100 */ V(0, 0, 1),
+  /* 1110011101 */ V(0, 0, 1),
+  /* 1110011110 */ V(0, 0, 1),
+  /* 1110011111 */ V(0, 0, 1),
+  /* 1110100000 */ V(0, 0, 1),
+  /* 1110100001 */ V(0, 0, 1),
+  /* 1110100010 */ V(0, 0, 1),
+  /* 1110100011 */ V(0, 0, 1),
+  /* 1110100100 */ V(0, 0, 1),
+  /* 1110100101 */ V(0, 0, 1),
+  /* 1110100110 */ V(0, 0, 1),
+  /* 1110100111 */ V(0, 0, 1),
+  /* 1110101000 */ V(0, 0, 1),
+  /* 1110101001 */ V(0, 0, 1),
+  /* 1110101010 */ V(0, 0, 1),
+  /* 1110101011 */ V(0, 0, 1),
+  /* 1110101100 */ V(0, 0, 1),
+  /* 1110101101 */ V(0, 0, 1),
+  /* 1110101110 */ V(0, 0, 1),
+  /* 1110101111 */ V(0, 0, 1),
+  /* 1110110000 */ V(0, 0, 1),
+  /* 1110110001 */ V(0, 0, 1),
+  /* 1110110010 */ V(0, 0, 1),
+  /* 1110110011 */ V(0, 0, 1),
+  /* 1110110100 */ V(0, 0, 1),
+  /* 1110110101 */ V(0, 0, 1),
+  /* 1110110110 */ V(0, 0, 1),
+  /* 1110110111 */ V(0, 0, 1),
+  /* 1110111000 */ V(0, 0, 1),
+  /* 1110111001 */ V(0, 0, 1),
+  /* 1110111010 */ V(0, 0, 1),
+  /* 1110111011 */ V(0, 0, 1),
+  /* 1110111100 */ V(0, 0, 1),
+  /* 1110111101 */ V(0, 0, 1),
+  /* 1110111110 */ V(0, 0, 1),
+  /* 1110111111 */ V(0, 0, 1),
+  /* 1111000000 */ V(0, 0, 1),
+  /* 1111000001 */ V(0, 0, 1),
+  /* 1111000010 */ V(0, 0, 1),
+  /* 1111000011 */ V(0, 0, 1),
+  /* 1111000100 */ V(0, 0, 1),
+  /* 1111000101 */ V(0, 0, 1),
+  /* 1111000110 */ V(0, 0, 1),
+  /* 1111000111 */ V(0, 0, 1),
+  /* 1111001000 */ V(0, 0, 1),
+  /* 1111001001 */ V(0, 0, 1),
+  /* 1111001010 */ V(0, 0, 1),
+  /* 1111001011 */ V(0, 0, 1),
+  /* 1111001100 */ V(0, 0, 1),
+  /* 1111001101 */ V(0, 0, 1),
+  /* 1111001110 */ V(0, 0, 1),
+  /* 1111001111 */ V(0, 0, 1),
+  /* 1111010000 */ V(0, 0, 1),
+  /* 1111010001 */ V(0, 0, 1),
+  /* 1111010010 */ V(0, 0, 1),
+  /* 1111010011 */ V(0, 0, 1),
+  /* 1111010100 */ V(0, 0, 1),
+  /* 1111010101 */ V(0, 0, 1),
+  /* 1111010110 */ V(0, 0, 1),
+  /* 1111010111 */ V(0, 0, 1),
+  /* 1111011000 */ V(0, 0, 1),
+  /* 1111011001 */ V(0, 0, 1),
+  /* 1111011010 */ V(0, 0, 1),
+  /* 1111011011 */ V(0, 0, 1),
+  /* 1111011100 */ V(0, 0, 1),
+  /* 1111011101 */ V(0, 0, 1),
+  /* 1111011110 */ V(0, 0, 1),
+  /* 1111011111 */ V(0, 0, 1),
+  /* 1111100000 */ V(0, 0, 1),
+  /* 1111100001 */ V(0, 0, 1),
+  /* 1111100010 */ V(0, 0, 1),
+  /* 1111100011 */ V(0, 0, 1),
+  /* 1111100100 */ V(0, 0, 1),
+  /* 1111100101 */ V(0, 0, 1),
+  /* 1111100110 */ V(0, 0, 1),
+  /* 1111100111 */ V(0, 0, 1),
+  /* 1111101000 */ V(0, 0, 1),
+  /* 1111101001 */ V(0, 0, 1),
+  /* 1111101010 */ V(0, 0, 1),
+  /* 1111101011 */ V(0, 0, 1),
+  /* 1111101100 */ V(0, 0, 1),
+  /* 1111101101 */ V(0, 0, 1),
+  /* 1111101110 */ V(0, 0, 1),
+  /* 1111101111 */ V(0, 0, 1),
+  /* 1111110000 */ V(0, 0, 1),
+  /* 1111110001 */ V(0, 0, 1),
+  /* 1111110010 */ V(0, 0, 1),
+  /* 1111110011 */ V(0, 0, 1),
+  /* 1111110100 */ V(0, 0, 1),
+  /* 1111110101 */ V(0, 0, 1),
+  /* 1111110110 */ V(0, 0, 1),
+  /* 1111110111 */ V(0, 0, 1),
+  /* 1111111000 */ V(0, 0, 1),
+  /* 1111111001 */ V(0, 0, 1),
+  /* 1111111010 */ V(0, 0, 1),
+  /* 1111111011 */ V(0, 0, 1),
+  /* 1111111100 */ V(0, 0, 1),
+  /* 1111111101 */ V(0, 0, 1),
+  /* 1111111110 */ V(0, 0, 1),
+  /* 1111111111 */ V(0, 0, 1)
 };
 
-# if 0
-/* this version saves 8 entries (16 bytes) at the expense of
-   an extra lookup in 4 out of 36 cases */
 static
 union huffpair const hufftab8[] = {
-  /* 0000 */ PTR(16, 4),
-  /* 0001 */ PTR(32, 2),
-  /* 0010 */ V(1, 2, 4),
-  /* 0011 */ V(2, 1, 4),
-  /* 0100 */ V(1, 1, 2),
-  /* 0101 */ V(1, 1, 2),
-  /* 0110 */ V(1, 1, 2),
-  /* 0111 */ V(1, 1, 2),
-  /* 1000 */ V(0, 1, 3),
-  /* 1001 */ V(0, 1, 3),
-  /* 1010 */ V(1, 0, 3),
-  /* 1011 */ V(1, 0, 3),
-  /* 1100 */ V(0, 0, 2),
-  /* 1101 */ V(0, 0, 2),
-  /* 1110 */ V(0, 0, 2),
-  /* 1111 */ V(0, 0, 2),
-
-  /* 0000 ... */
-  /* 0000 */ PTR(36, 3),	/* 16 */
-  /* 0001 */ PTR(44, 2),
-  /* 0010 */ PTR(48, 1),
-  /* 0011 */ V(1, 5, 4),
-  /* 0100 */ V(5, 1, 4),
-  /* 0101 */ PTR(50, 1),
-  /* 0110 */ PTR(52, 1),
-  /* 0111 */ V(2, 4, 4),
-  /* 1000 */ V(4, 2, 4),
-  /* 1001 */ V(1, 4, 4),
-  /* 1010 */ V(4, 1, 3),
-  /* 1011 */ V(4, 1, 3),
-  /* 1100 */ V(0, 4, 4),
-  /* 1101 */ V(4, 0, 4),
-  /* 1110 */ V(2, 3, 4),
-  /* 1111 */ V(3, 2, 4),
-
-  /* 0001 ... */
-  /* 00   */ PTR(54, 2),	/* 32 */
-  /* 01   */ V(2, 2, 2),
-  /* 10   */ V(0, 2, 2),
-  /* 11   */ V(2, 0, 2),
-
-  /* 0000 0000 ... */
-  /* 000  */ V(5, 5, 3),	/* 36 */
-  /* 001  */ V(5, 4, 3),
-  /* 010  */ V(4, 5, 2),
-  /* 011  */ V(4, 5, 2),
-  /* 100  */ V(5, 3, 1),
-  /* 101  */ V(5, 3, 1),
-  /* 110  */ V(5, 3, 1),
-  /* 111  */ V(5, 3, 1),
-
-  /* 0000 0001 ... */
-  /* 00   */ V(3, 5, 2),	/* 44 */
-  /* 01   */ V(4, 4, 2),
-  /* 10   */ V(2, 5, 1),
-  /* 11   */ V(2, 5, 1),
-
-  /* 0000 0010 ... */
-  /* 0    */ V(5, 2, 1),	/* 48 */
-  /* 1    */ V(0, 5, 1),
-
-  /* 0000 0101 ... */
-  /* 0    */ V(3, 4, 1),	/* 50 */
-  /* 1    */ V(4, 3, 1),
-
-  /* 0000 0110 ... */
-  /* 0    */ V(5, 0, 1),	/* 52 */
-  /* 1    */ V(3, 3, 1),
-
-  /* 0001 00 ... */
-  /* 00   */ V(1, 3, 2),	/* 54 */
-  /* 01   */ V(3, 1, 2),
-  /* 10   */ V(0, 3, 2),
-  /* 11   */ V(3, 0, 2),
+  /* 0000000000 */ PTR(1024, 1),
+  /* 0000000001 */ V(4, 5, 10),
+  /* 0000000010 */ V(5, 3, 9),
+  /* 0000000011 */ V(5, 3, 9),
+  /* 0000000100 */ V(3, 5, 10),
+  /* 0000000101 */ V(4, 4, 10),
+  /* 0000000110 */ V(2, 5, 9),
+  /* 0000000111 */ V(2, 5, 9),
+  /* 0000001000 */ V(5, 2, 9),
+  /* 0000001001 */ V(5, 2, 9),
+  /* 0000001010 */ V(0, 5, 9),
+  /* 0000001011 */ V(0, 5, 9),
+  /* 0000001100 */ V(1, 5, 8),
+  /* 0000001101 */ V(1, 5, 8),
+  /* 0000001110 */ V(1, 5, 8),
+  /* 0000001111 */ V(1, 5, 8),
+  /* 0000010000 */ V(5, 1, 8),
+  /* 0000010001 */ V(5, 1, 8),
+  /* 0000010010 */ V(5, 1, 8),
+  /* 0000010011 */ V(5, 1, 8),
+  /* 0000010100 */ V(3, 4, 9),
+  /* 0000010101 */ V(3, 4, 9),
+  /* 0000010110 */ V(4, 3, 9),
+  /* 0000010111 */ V(4, 3, 9),
+  /* 0000011000 */ V(5, 0, 9),
+  /* 0000011001 */ V(5, 0, 9),
+  /* 0000011010 */ V(3, 3, 9),
+  /* 0000011011 */ V(3, 3, 9),
+  /* 0000011100 */ V(2, 4, 8),
+  /* 0000011101 */ V(2, 4, 8),
+  /* 0000011110 */ V(2, 4, 8),
+  /* 0000011111 */ V(2, 4, 8),
+  /* 0000100000 */ V(4, 2, 8),
+  /* 0000100001 */ V(4, 2, 8),
+  /* 0000100010 */ V(4, 2, 8),
+  /* 0000100011 */ V(4, 2, 8),
+  /* 0000100100 */ V(1, 4, 8),
+  /* 0000100101 */ V(1, 4, 8),
+  /* 0000100110 */ V(1, 4, 8),
+  /* 0000100111 */ V(1, 4, 8),
+  /* 0000101000 */ V(4, 1, 7),
+  /* 0000101001 */ V(4, 1, 7),
+  /* 0000101010 */ V(4, 1, 7),
+  /* 0000101011 */ V(4, 1, 7),
+  /* 0000101100 */ V(4, 1, 7),
+  /* 0000101101 */ V(4, 1, 7),
+  /* 0000101110 */ V(4, 1, 7),
+  /* 0000101111 */ V(4, 1, 7),
+  /* 0000110000 */ V(0, 4, 8),
+  /* 0000110001 */ V(0, 4, 8),
+  /* 0000110010 */ V(0, 4, 8),
+  /* 0000110011 */ V(0, 4, 8),
+  /* 0000110100 */ V(4, 0, 8),
+  /* 0000110101 */ V(4, 0, 8),
+  /* 0000110110 */ V(4, 0, 8),
+  /* 0000110111 */ V(4, 0, 8),
+  /* 0000111000 */ V(2, 3, 8),
+  /* 0000111001 */ V(2, 3, 8),
+  /* 0000111010 */ V(2, 3, 8),
+  /* 0000111011 */ V(2, 3, 8),
+  /* 0000111100 */ V(3, 2, 8),
+  /* 0000111101 */ V(3, 2, 8),
+  /* 0000111110 */ V(3, 2, 8),
+  /* 0000111111 */ V(3, 2, 8),
+  /* 0001000000 */ V(1, 3, 8),
+  /* 0001000001 */ V(1, 3, 8),
+  /* 0001000010 */ V(1, 3, 8),
+  /* 0001000011 */ V(1, 3, 8),
+  /* 0001000100 */ V(3, 1, 8),
+  /* 0001000101 */ V(3, 1, 8),
+  /* 0001000110 */ V(3, 1, 8),
+  /* 0001000111 */ V(3, 1, 8),
+  /* 0001001000 */ V(0, 3, 8),
+  /* 0001001001 */ V(0, 3, 8),
+  /* 0001001010 */ V(0, 3, 8),
+  /* 0001001011 */ V(0, 3, 8),
+  /* 0001001100 */ V(3, 0, 8),
+  /* 0001001101 */ V(3, 0, 8),
+  /* 0001001110 */ V(3, 0, 8),
+  /* 0001001111 */ V(3, 0, 8),
+  /* 0001010000 */ V(2, 2, 6),
+  /* 0001010001 */ V(2, 2, 6),
+  /* 0001010010 */ V(2, 2, 6),
+  /* 0001010011 */ V(2, 2, 6),
+  /* 0001010100 */ V(2, 2, 6),
+  /* 0001010101 */ V(2, 2, 6),
+  /* 0001010110 */ V(2, 2, 6),
+  /* 0001010111 */ V(2, 2, 6),
+  /* 0001011000 */ V(2, 2, 6),
+  /* 0001011001 */ V(2, 2, 6),
+  /* 0001011010 */ V(2, 2, 6),
+  /* 0001011011 */ V(2, 2, 6),
+  /* 0001011100 */ V(2, 2, 6),
+  /* 0001011101 */ V(2, 2, 6),
+  /* 0001011110 */ V(2, 2, 6),
+  /* 0001011111 */ V(2, 2, 6),
+  /* 0001100000 */ V(0, 2, 6),
+  /* 0001100001 */ V(0, 2, 6),
+  /* 0001100010 */ V(0, 2, 6),
+  /* 0001100011 */ V(0, 2, 6),
+  /* 0001100100 */ V(0, 2, 6),
+  /* 0001100101 */ V(0, 2, 6),
+  /* 0001100110 */ V(0, 2, 6),
+  /* 0001100111 */ V(0, 2, 6),
+  /* 0001101000 */ V(0, 2, 6),
+  /* 0001101001 */ V(0, 2, 6),
+  /* 0001101010 */ V(0, 2, 6),
+  /* 0001101011 */ V(0, 2, 6),
+  /* 0001101100 */ V(0, 2, 6),
+  /* 0001101101 */ V(0, 2, 6),
+  /* 0001101110 */ V(0, 2, 6),
+  /* 0001101111 */ V(0, 2, 6),
+  /* 0001110000 */ V(2, 0, 6),
+  /* 0001110001 */ V(2, 0, 6),
+  /* 0001110010 */ V(2, 0, 6),
+  /* 0001110011 */ V(2, 0, 6),
+  /* 0001110100 */ V(2, 0, 6),
+  /* 0001110101 */ V(2, 0, 6),
+  /* 0001110110 */ V(2, 0, 6),
+  /* 0001110111 */ V(2, 0, 6),
+  /* 0001111000 */ V(2, 0, 6),
+  /* 0001111001 */ V(2, 0, 6),
+  /* 0001111010 */ V(2, 0, 6),
+  /* 0001111011 */ V(2, 0, 6),
+  /* 0001111100 */ V(2, 0, 6),
+  /* 0001111101 */ V(2, 0, 6),
+  /* 0001111110 */ V(2, 0, 6),
+  /* 0001111111 */ V(2, 0, 6),
+  /* 0010000000 */ V(1, 2, 4),
+  /* 0010000001 */ V(1, 2, 4),
+  /* 0010000010 */ V(1, 2, 4),
+  /* 0010000011 */ V(1, 2, 4),
+  /* 0010000100 */ V(1, 2, 4),
+  /* 0010000101 */ V(1, 2, 4),
+  /* 0010000110 */ V(1, 2, 4),
+  /* 0010000111 */ V(1, 2, 4),
+  /* 0010001000 */ V(1, 2, 4),
+  /* 0010001001 */ V(1, 2, 4),
+  /* 0010001010 */ V(1, 2, 4),
+  /* 0010001011 */ V(1, 2, 4),
+  /* 0010001100 */ V(1, 2, 4),
+  /* 0010001101 */ V(1, 2, 4),
+  /* 0010001110 */ V(1, 2, 4),
+  /* 0010001111 */ V(1, 2, 4),
+  /* 0010010000 */ V(1, 2, 4),
+  /* 0010010001 */ V(1, 2, 4),
+  /* 0010010010 */ V(1, 2, 4),
+  /* 0010010011 */ V(1, 2, 4),
+  /* 0010010100 */ V(1, 2, 4),
+  /* 0010010101 */ V(1, 2, 4),
+  /* 0010010110 */ V(1, 2, 4),
+  /* 0010010111 */ V(1, 2, 4),
+  /* 0010011000 */ V(1, 2, 4),
+  /* 0010011001 */ V(1, 2, 4),
+  /* 0010011010 */ V(1, 2, 4),
+  /* 0010011011 */ V(1, 2, 4),
+  /* 0010011100 */ V(1, 2, 4),
+  /* 0010011101 */ V(1, 2, 4),
+  /* 0010011110 */ V(1, 2, 4),
+  /* 0010011111 */ V(1, 2, 4),
+  /* 0010100000 */ V(1, 2, 4),
+  /* 0010100001 */ V(1, 2, 4),
+  /* 0010100010 */ V(1, 2, 4),
+  /* 0010100011 */ V(1, 2, 4),
+  /* 0010100100 */ V(1, 2, 4),
+  /* 0010100101 */ V(1, 2, 4),
+  /* 0010100110 */ V(1, 2, 4),
+  /* 0010100111 */ V(1, 2, 4),
+  /* 0010101000 */ V(1, 2, 4),
+  /* 0010101001 */ V(1, 2, 4),
+  /* 0010101010 */ V(1, 2, 4),
+  /* 0010101011 */ V(1, 2, 4),
+  /* 0010101100 */ V(1, 2, 4),
+  /* 0010101101 */ V(1, 2, 4),
+  /* 0010101110 */ V(1, 2, 4),
+  /* 0010101111 */ V(1, 2, 4),
+  /* 0010110000 */ V(1, 2, 4),
+  /* 0010110001 */ V(1, 2, 4),
+  /* 0010110010 */ V(1, 2, 4),
+  /* 0010110011 */ V(1, 2, 4),
+  /* 0010110100 */ V(1, 2, 4),
+  /* 0010110101 */ V(1, 2, 4),
+  /* 0010110110 */ V(1, 2, 4),
+  /* 0010110111 */ V(1, 2, 4),
+  /* 0010111000 */ V(1, 2, 4),
+  /* 0010111001 */ V(1, 2, 4),
+  /* 0010111010 */ V(1, 2, 4),
+  /* 0010111011 */ V(1, 2, 4),
+  /* 0010111100 */ V(1, 2, 4),
+  /* 0010111101 */ V(1, 2, 4),
+  /* 0010111110 */ V(1, 2, 4),
+  /* 0010111111 */ V(1, 2, 4),
+  /* 0011000000 */ V(2, 1, 4),
+  /* 0011000001 */ V(2, 1, 4),
+  /* 0011000010 */ V(2, 1, 4),
+  /* 0011000011 */ V(2, 1, 4),
+  /* 0011000100 */ V(2, 1, 4),
+  /* 0011000101 */ V(2, 1, 4),
+  /* 0011000110 */ V(2, 1, 4),
+  /* 0011000111 */ V(2, 1, 4),
+  /* 0011001000 */ V(2, 1, 4),
+  /* 0011001001 */ V(2, 1, 4),
+  /* 0011001010 */ V(2, 1, 4),
+  /* 0011001011 */ V(2, 1, 4),
+  /* 0011001100 */ V(2, 1, 4),
+  /* 0011001101 */ V(2, 1, 4),
+  /* 0011001110 */ V(2, 1, 4),
+  /* 0011001111 */ V(2, 1, 4),
+  /* 0011010000 */ V(2, 1, 4),
+  /* 0011010001 */ V(2, 1, 4),
+  /* 0011010010 */ V(2, 1, 4),
+  /* 0011010011 */ V(2, 1, 4),
+  /* 0011010100 */ V(2, 1, 4),
+  /* 0011010101 */ V(2, 1, 4),
+  /* 0011010110 */ V(2, 1, 4),
+  /* 0011010111 */ V(2, 1, 4),
+  /* 0011011000 */ V(2, 1, 4),
+  /* 0011011001 */ V(2, 1, 4),
+  /* 0011011010 */ V(2, 1, 4),
+  /* 0011011011 */ V(2, 1, 4),
+  /* 0011011100 */ V(2, 1, 4),
+  /* 0011011101 */ V(2, 1, 4),
+  /* 0011011110 */ V(2, 1, 4),
+  /* 0011011111 */ V(2, 1, 4),
+  /* 0011100000 */ V(2, 1, 4),
+  /* 0011100001 */ V(2, 1, 4),
+  /* 0011100010 */ V(2, 1, 4),
+  /* 0011100011 */ V(2, 1, 4),
+  /* 0011100100 */ V(2, 1, 4),
+  /* 0011100101 */ V(2, 1, 4),
+  /* 0011100110 */ V(2, 1, 4),
+  /* 0011100111 */ V(2, 1, 4),
+  /* 0011101000 */ V(2, 1, 4),
+  /* 0011101001 */ V(2, 1, 4),
+  /* 0011101010 */ V(2, 1, 4),
+  /* 0011101011 */ V(2, 1, 4),
+  /* 0011101100 */ V(2, 1, 4),
+  /* 0011101101 */ V(2, 1, 4),
+  /* 0011101110 */ V(2, 1, 4),
+  /* 0011101111 */ V(2, 1, 4),
+  /* 0011110000 */ V(2, 1, 4),
+  /* 0011110001 */ V(2, 1, 4),
+  /* 0011110010 */ V(2, 1, 4),
+  /* 0011110011 */ V(2, 1, 4),
+  /* 0011110100 */ V(2, 1, 4),
+  /* 0011110101 */ V(2, 1, 4),
+  /* 0011110110 */ V(2, 1, 4),
+  /* 0011110111 */ V(2, 1, 4),
+  /* 0011111000 */ V(2, 1, 4),
+  /* 0011111001 */ V(2, 1, 4),
+  /* 0011111010 */ V(2, 1, 4),
+  /* 0011111011 */ V(2, 1, 4),
+  /* 0011111100 */ V(2, 1, 4),
+  /* 0011111101 */ V(2, 1, 4),
+  /* 0011111110 */ V(2, 1, 4),
+  /* 0011111111 */ V(2, 1, 4),
+  /* 0100000000 */ V(1, 1, 2),
+  /* 0100000001 */ V(1, 1, 2),
+  /* 0100000010 */ V(1, 1, 2),
+  /* 0100000011 */ V(1, 1, 2),
+  /* 0100000100 */ V(1, 1, 2),
+  /* 0100000101 */ V(1, 1, 2),
+  /* 0100000110 */ V(1, 1, 2),
+  /* 0100000111 */ V(1, 1, 2),
+  /* 0100001000 */ V(1, 1, 2),
+  /* 0100001001 */ V(1, 1, 2),
+  /* 0100001010 */ V(1, 1, 2),
+  /* 0100001011 */ V(1, 1, 2),
+  /* 0100001100 */ V(1, 1, 2),
+  /* 0100001101 */ V(1, 1, 2),
+  /* 0100001110 */ V(1, 1, 2),
+  /* 0100001111 */ V(1, 1, 2),
+  /* 0100010000 */ V(1, 1, 2),
+  /* 0100010001 */ V(1, 1, 2),
+  /* 0100010010 */ V(1, 1, 2),
+  /* 0100010011 */ V(1, 1, 2),
+  /* 0100010100 */ V(1, 1, 2),
+  /* 0100010101 */ V(1, 1, 2),
+  /* 0100010110 */ V(1, 1, 2),
+  /* 0100010111 */ V(1, 1, 2),
+  /* 0100011000 */ V(1, 1, 2),
+  /* 0100011001 */ V(1, 1, 2),
+  /* 0100011010 */ V(1, 1, 2),
+  /* 0100011011 */ V(1, 1, 2),
+  /* 0100011100 */ V(1, 1, 2),
+  /* 0100011101 */ V(1, 1, 2),
+  /* 0100011110 */ V(1, 1, 2),
+  /* 0100011111 */ V(1, 1, 2),
+  /* 0100100000 */ V(1, 1, 2),
+  /* 0100100001 */ V(1, 1, 2),
+  /* 0100100010 */ V(1, 1, 2),
+  /* 0100100011 */ V(1, 1, 2),
+  /* 0100100100 */ V(1, 1, 2),
+  /* 0100100101 */ V(1, 1, 2),
+  /* 0100100110 */ V(1, 1, 2),
+  /* 0100100111 */ V(1, 1, 2),
+  /* 0100101000 */ V(1, 1, 2),
+  /* 0100101001 */ V(1, 1, 2),
+  /* 0100101010 */ V(1, 1, 2),
+  /* 0100101011 */ V(1, 1, 2),
+  /* 0100101100 */ V(1, 1, 2),
+  /* 0100101101 */ V(1, 1, 2),
+  /* 0100101110 */ V(1, 1, 2),
+  /* 0100101111 */ V(1, 1, 2),
+  /* 0100110000 */ V(1, 1, 2),
+  /* 0100110001 */ V(1, 1, 2),
+  /* 0100110010 */ V(1, 1, 2),
+  /* 0100110011 */ V(1, 1, 2),
+  /* 0100110100 */ V(1, 1, 2),
+  /* 0100110101 */ V(1, 1, 2),
+  /* 0100110110 */ V(1, 1, 2),
+  /* 0100110111 */ V(1, 1, 2),
+  /* 0100111000 */ V(1, 1, 2),
+  /* 0100111001 */ V(1, 1, 2),
+  /* 0100111010 */ V(1, 1, 2),
+  /* 0100111011 */ V(1, 1, 2),
+  /* 0100111100 */ V(1, 1, 2),
+  /* 0100111101 */ V(1, 1, 2),
+  /* 0100111110 */ V(1, 1, 2),
+  /* 0100111111 */ V(1, 1, 2),
+  /* 0101000000 */ V(1, 1, 2),
+  /* 0101000001 */ V(1, 1, 2),
+  /* 0101000010 */ V(1, 1, 2),
+  /* 0101000011 */ V(1, 1, 2),
+  /* 0101000100 */ V(1, 1, 2),
+  /* 0101000101 */ V(1, 1, 2),
+  /* 0101000110 */ V(1, 1, 2),
+  /* 0101000111 */ V(1, 1, 2),
+  /* 0101001000 */ V(1, 1, 2),
+  /* 0101001001 */ V(1, 1, 2),
+  /* 0101001010 */ V(1, 1, 2),
+  /* 0101001011 */ V(1, 1, 2),
+  /* 0101001100 */ V(1, 1, 2),
+  /* 0101001101 */ V(1, 1, 2),
+  /* 0101001110 */ V(1, 1, 2),
+  /* 0101001111 */ V(1, 1, 2),
+  /* 0101010000 */ V(1, 1, 2),
+  /* 0101010001 */ V(1, 1, 2),
+  /* 0101010010 */ V(1, 1, 2),
+  /* 0101010011 */ V(1, 1, 2),
+  /* 0101010100 */ V(1, 1, 2),
+  /* 0101010101 */ V(1, 1, 2),
+  /* 0101010110 */ V(1, 1, 2),
+  /* 0101010111 */ V(1, 1, 2),
+  /* 0101011000 */ V(1, 1, 2),
+  /* 0101011001 */ V(1, 1, 2),
+  /* 0101011010 */ V(1, 1, 2),
+  /* 0101011011 */ V(1, 1, 2),
+  /* 0101011100 */ V(1, 1, 2),
+  /* 0101011101 */ V(1, 1, 2),
+  /* 0101011110 */ V(1, 1, 2),
+  /* 0101011111 */ V(1, 1, 2),
+  /* 0101100000 */ V(1, 1, 2),
+  /* 0101100001 */ V(1, 1, 2),
+  /* 0101100010 */ V(1, 1, 2),
+  /* 0101100011 */ V(1, 1, 2),
+  /* 0101100100 */ V(1, 1, 2),
+  /* 0101100101 */ V(1, 1, 2),
+  /* 0101100110 */ V(1, 1, 2),
+  /* 0101100111 */ V(1, 1, 2),
+  /* 0101101000 */ V(1, 1, 2),
+  /* 0101101001 */ V(1, 1, 2),
+  /* 0101101010 */ V(1, 1, 2),
+  /* 0101101011 */ V(1, 1, 2),
+  /* 0101101100 */ V(1, 1, 2),
+  /* 0101101101 */ V(1, 1, 2),
+  /* 0101101110 */ V(1, 1, 2),
+  /* 0101101111 */ V(1, 1, 2),
+  /* 0101110000 */ V(1, 1, 2),
+  /* 0101110001 */ V(1, 1, 2),
+  /* 0101110010 */ V(1, 1, 2),
+  /* 0101110011 */ V(1, 1, 2),
+  /* 0101110100 */ V(1, 1, 2),
+  /* 0101110101 */ V(1, 1, 2),
+  /* 0101110110 */ V(1, 1, 2),
+  /* 0101110111 */ V(1, 1, 2),
+  /* 0101111000 */ V(1, 1, 2),
+  /* 0101111001 */ V(1, 1, 2),
+  /* 0101111010 */ V(1, 1, 2),
+  /* 0101111011 */ V(1, 1, 2),
+  /* 0101111100 */ V(1, 1, 2),
+  /* 0101111101 */ V(1, 1, 2),
+  /* 0101111110 */ V(1, 1, 2),
+  /* 0101111111 */ V(1, 1, 2),
+  /* 0110000000 */ V(1, 1, 2),
+  /* 0110000001 */ V(1, 1, 2),
+  /* 0110000010 */ V(1, 1, 2),
+  /* 0110000011 */ V(1, 1, 2),
+  /* 0110000100 */ V(1, 1, 2),
+  /* 0110000101 */ V(1, 1, 2),
+  /* 0110000110 */ V(1, 1, 2),
+  /* 0110000111 */ V(1, 1, 2),
+  /* 0110001000 */ V(1, 1, 2),
+  /* 0110001001 */ V(1, 1, 2),
+  /* 0110001010 */ V(1, 1, 2),
+  /* 0110001011 */ V(1, 1, 2),
+  /* 0110001100 */ V(1, 1, 2),
+  /* 0110001101 */ V(1, 1, 2),
+  /* 0110001110 */ V(1, 1, 2),
+  /* 0110001111 */ V(1, 1, 2),
+  /* 0110010000 */ V(1, 1, 2),
+  /* 0110010001 */ V(1, 1, 2),
+  /* 0110010010 */ V(1, 1, 2),
+  /* 0110010011 */ V(1, 1, 2),
+  /* 0110010100 */ V(1, 1, 2),
+  /* 0110010101 */ V(1, 1, 2),
+  /* 0110010110 */ V(1, 1, 2),
+  /* 0110010111 */ V(1, 1, 2),
+  /* 0110011000 */ V(1, 1, 2),
+  /* 0110011001 */ V(1, 1, 2),
+  /* 0110011010 */ V(1, 1, 2),
+  /* 0110011011 */ V(1, 1, 2),
+  /* 0110011100 */ V(1, 1, 2),
+  /* 0110011101 */ V(1, 1, 2),
+  /* 0110011110 */ V(1, 1, 2),
+  /* 0110011111 */ V(1, 1, 2),
+  /* 0110100000 */ V(1, 1, 2),
+  /* 0110100001 */ V(1, 1, 2),
+  /* 0110100010 */ V(1, 1, 2),
+  /* 0110100011 */ V(1, 1, 2),
+  /* 0110100100 */ V(1, 1, 2),
+  /* 0110100101 */ V(1, 1, 2),
+  /* 0110100110 */ V(1, 1, 2),
+  /* 0110100111 */ V(1, 1, 2),
+  /* 0110101000 */ V(1, 1, 2),
+  /* 0110101001 */ V(1, 1, 2),
+  /* 0110101010 */ V(1, 1, 2),
+  /* 0110101011 */ V(1, 1, 2),
+  /* 0110101100 */ V(1, 1, 2),
+  /* 0110101101 */ V(1, 1, 2),
+  /* 0110101110 */ V(1, 1, 2),
+  /* 0110101111 */ V(1, 1, 2),
+  /* 0110110000 */ V(1, 1, 2),
+  /* 0110110001 */ V(1, 1, 2),
+  /* 0110110010 */ V(1, 1, 2),
+  /* 0110110011 */ V(1, 1, 2),
+  /* 0110110100 */ V(1, 1, 2),
+  /* 0110110101 */ V(1, 1, 2),
+  /* 0110110110 */ V(1, 1, 2),
+  /* 0110110111 */ V(1, 1, 2),
+  /* 0110111000 */ V(1, 1, 2),
+  /* 0110111001 */ V(1, 1, 2),
+  /* 0110111010 */ V(1, 1, 2),
+  /* 0110111011 */ V(1, 1, 2),
+  /* 0110111100 */ V(1, 1, 2),
+  /* 0110111101 */ V(1, 1, 2),
+  /* 0110111110 */ V(1, 1, 2),
+  /* 0110111111 */ V(1, 1, 2),
+  /* 0111000000 */ V(1, 1, 2),
+  /* 0111000001 */ V(1, 1, 2),
+  /* 0111000010 */ V(1, 1, 2),
+  /* 0111000011 */ V(1, 1, 2),
+  /* 0111000100 */ V(1, 1, 2),
+  /* 0111000101 */ V(1, 1, 2),
+  /* 0111000110 */ V(1, 1, 2),
+  /* 0111000111 */ V(1, 1, 2),
+  /* 0111001000 */ V(1, 1, 2),
+  /* 0111001001 */ V(1, 1, 2),
+  /* 0111001010 */ V(1, 1, 2),
+  /* 0111001011 */ V(1, 1, 2),
+  /* 0111001100 */ V(1, 1, 2),
+  /* 0111001101 */ V(1, 1, 2),
+  /* 0111001110 */ V(1, 1, 2),
+  /* 0111001111 */ V(1, 1, 2),
+  /* 0111010000 */ V(1, 1, 2),
+  /* 0111010001 */ V(1, 1, 2),
+  /* 0111010010 */ V(1, 1, 2),
+  /* 0111010011 */ V(1, 1, 2),
+  /* 0111010100 */ V(1, 1, 2),
+  /* 0111010101 */ V(1, 1, 2),
+  /* 0111010110 */ V(1, 1, 2),
+  /* 0111010111 */ V(1, 1, 2),
+  /* 0111011000 */ V(1, 1, 2),
+  /* 0111011001 */ V(1, 1, 2),
+  /* 0111011010 */ V(1, 1, 2),
+  /* 0111011011 */ V(1, 1, 2),
+  /* 0111011100 */ V(1, 1, 2),
+  /* 0111011101 */ V(1, 1, 2),
+  /* 0111011110 */ V(1, 1, 2),
+  /* 0111011111 */ V(1, 1, 2),
+  /* 0111100000 */ V(1, 1, 2),
+  /* 0111100001 */ V(1, 1, 2),
+  /* 0111100010 */ V(1, 1, 2),
+  /* 0111100011 */ V(1, 1, 2),
+  /* 0111100100 */ V(1, 1, 2),
+  /* 0111100101 */ V(1, 1, 2),
+  /* 0111100110 */ V(1, 1, 2),
+  /* 0111100111 */ V(1, 1, 2),
+  /* 0111101000 */ V(1, 1, 2),
+  /* 0111101001 */ V(1, 1, 2),
+  /* 0111101010 */ V(1, 1, 2),
+  /* 0111101011 */ V(1, 1, 2),
+  /* 0111101100 */ V(1, 1, 2),
+  /* 0111101101 */ V(1, 1, 2),
+  /* 0111101110 */ V(1, 1, 2),
+  /* 0111101111 */ V(1, 1, 2),
+  /* 0111110000 */ V(1, 1, 2),
+  /* 0111110001 */ V(1, 1, 2),
+  /* 0111110010 */ V(1, 1, 2),
+  /* 0111110011 */ V(1, 1, 2),
+  /* 0111110100 */ V(1, 1, 2),
+  /* 0111110101 */ V(1, 1, 2),
+  /* 0111110110 */ V(1, 1, 2),
+  /* 0111110111 */ V(1, 1, 2),
+  /* 0111111000 */ V(1, 1, 2),
+  /* 0111111001 */ V(1, 1, 2),
+  /* 0111111010 */ V(1, 1, 2),
+  /* 0111111011 */ V(1, 1, 2),
+  /* 0111111100 */ V(1, 1, 2),
+  /* 0111111101 */ V(1, 1, 2),
+  /* 0111111110 */ V(1, 1, 2),
+  /* 0111111111 */ V(1, 1, 2),
+  /* 1000000000 */ V(0, 1, 3),
+  /* 1000000001 */ V(0, 1, 3),
+  /* 1000000010 */ V(0, 1, 3),
+  /* 1000000011 */ V(0, 1, 3),
+  /* 1000000100 */ V(0, 1, 3),
+  /* 1000000101 */ V(0, 1, 3),
+  /* 1000000110 */ V(0, 1, 3),
+  /* 1000000111 */ V(0, 1, 3),
+  /* 1000001000 */ V(0, 1, 3),
+  /* 1000001001 */ V(0, 1, 3),
+  /* 1000001010 */ V(0, 1, 3),
+  /* 1000001011 */ V(0, 1, 3),
+  /* 1000001100 */ V(0, 1, 3),
+  /* 1000001101 */ V(0, 1, 3),
+  /* 1000001110 */ V(0, 1, 3),
+  /* 1000001111 */ V(0, 1, 3),
+  /* 1000010000 */ V(0, 1, 3),
+  /* 1000010001 */ V(0, 1, 3),
+  /* 1000010010 */ V(0, 1, 3),
+  /* 1000010011 */ V(0, 1, 3),
+  /* 1000010100 */ V(0, 1, 3),
+  /* 1000010101 */ V(0, 1, 3),
+  /* 1000010110 */ V(0, 1, 3),
+  /* 1000010111 */ V(0, 1, 3),
+  /* 1000011000 */ V(0, 1, 3),
+  /* 1000011001 */ V(0, 1, 3),
+  /* 1000011010 */ V(0, 1, 3),
+  /* 1000011011 */ V(0, 1, 3),
+  /* 1000011100 */ V(0, 1, 3),
+  /* 1000011101 */ V(0, 1, 3),
+  /* 1000011110 */ V(0, 1, 3),
+  /* 1000011111 */ V(0, 1, 3),
+  /* 1000100000 */ V(0, 1, 3),
+  /* 1000100001 */ V(0, 1, 3),
+  /* 1000100010 */ V(0, 1, 3),
+  /* 1000100011 */ V(0, 1, 3),
+  /* 1000100100 */ V(0, 1, 3),
+  /* 1000100101 */ V(0, 1, 3),
+  /* 1000100110 */ V(0, 1, 3),
+  /* 1000100111 */ V(0, 1, 3),
+  /* 1000101000 */ V(0, 1, 3),
+  /* 1000101001 */ V(0, 1, 3),
+  /* 1000101010 */ V(0, 1, 3),
+  /* 1000101011 */ V(0, 1, 3),
+  /* 1000101100 */ V(0, 1, 3),
+  /* 1000101101 */ V(0, 1, 3),
+  /* 1000101110 */ V(0, 1, 3),
+  /* 1000101111 */ V(0, 1, 3),
+  /* 1000110000 */ V(0, 1, 3),
+  /* 1000110001 */ V(0, 1, 3),
+  /* 1000110010 */ V(0, 1, 3),
+  /* 1000110011 */ V(0, 1, 3),
+  /* 1000110100 */ V(0, 1, 3),
+  /* 1000110101 */ V(0, 1, 3),
+  /* 1000110110 */ V(0, 1, 3),
+  /* 1000110111 */ V(0, 1, 3),
+  /* 1000111000 */ V(0, 1, 3),
+  /* 1000111001 */ V(0, 1, 3),
+  /* 1000111010 */ V(0, 1, 3),
+  /* 1000111011 */ V(0, 1, 3),
+  /* 1000111100 */ V(0, 1, 3),
+  /* 1000111101 */ V(0, 1, 3),
+  /* 1000111110 */ V(0, 1, 3),
+  /* 1000111111 */ V(0, 1, 3),
+  /* 1001000000 */ V(0, 1, 3),
+  /* 1001000001 */ V(0, 1, 3),
+  /* 1001000010 */ V(0, 1, 3),
+  /* 1001000011 */ V(0, 1, 3),
+  /* 1001000100 */ V(0, 1, 3),
+  /* 1001000101 */ V(0, 1, 3),
+  /* 1001000110 */ V(0, 1, 3),
+  /* 1001000111 */ V(0, 1, 3),
+  /* 1001001000 */ V(0, 1, 3),
+  /* 1001001001 */ V(0, 1, 3),
+  /* 1001001010 */ V(0, 1, 3),
+  /* 1001001011 */ V(0, 1, 3),
+  /* 1001001100 */ V(0, 1, 3),
+  /* 1001001101 */ V(0, 1, 3),
+  /* 1001001110 */ V(0, 1, 3),
+  /* 1001001111 */ V(0, 1, 3),
+  /* 1001010000 */ V(0, 1, 3),
+  /* 1001010001 */ V(0, 1, 3),
+  /* 1001010010 */ V(0, 1, 3),
+  /* 1001010011 */ V(0, 1, 3),
+  /* 1001010100 */ V(0, 1, 3),
+  /* 1001010101 */ V(0, 1, 3),
+  /* 1001010110 */ V(0, 1, 3),
+  /* 1001010111 */ V(0, 1, 3),
+  /* 1001011000 */ V(0, 1, 3),
+  /* 1001011001 */ V(0, 1, 3),
+  /* 1001011010 */ V(0, 1, 3),
+  /* 1001011011 */ V(0, 1, 3),
+  /* 1001011100 */ V(0, 1, 3),
+  /* 1001011101 */ V(0, 1, 3),
+  /* 1001011110 */ V(0, 1, 3),
+  /* 1001011111 */ V(0, 1, 3),
+  /* 1001100000 */ V(0, 1, 3),
+  /* 1001100001 */ V(0, 1, 3),
+  /* 1001100010 */ V(0, 1, 3),
+  /* 1001100011 */ V(0, 1, 3),
+  /* 1001100100 */ V(0, 1, 3),
+  /* 1001100101 */ V(0, 1, 3),
+  /* 1001100110 */ V(0, 1, 3),
+  /* 1001100111 */ V(0, 1, 3),
+  /* 1001101000 */ V(0, 1, 3),
+  /* 1001101001 */ V(0, 1, 3),
+  /* 1001101010 */ V(0, 1, 3),
+  /* 1001101011 */ V(0, 1, 3),
+  /* 1001101100 */ V(0, 1, 3),
+  /* 1001101101 */ V(0, 1, 3),
+  /* 1001101110 */ V(0, 1, 3),
+  /* 1001101111 */ V(0, 1, 3),
+  /* 1001110000 */ V(0, 1, 3),
+  /* 1001110001 */ V(0, 1, 3),
+  /* 1001110010 */ V(0, 1, 3),
+  /* 1001110011 */ V(0, 1, 3),
+  /* 1001110100 */ V(0, 1, 3),
+  /* 1001110101 */ V(0, 1, 3),
+  /* 1001110110 */ V(0, 1, 3),
+  /* 1001110111 */ V(0, 1, 3),
+  /* 1001111000 */ V(0, 1, 3),
+  /* 1001111001 */ V(0, 1, 3),
+  /* 1001111010 */ V(0, 1, 3),
+  /* 1001111011 */ V(0, 1, 3),
+  /* 1001111100 */ V(0, 1, 3),
+  /* 1001111101 */ V(0, 1, 3),
+  /* 1001111110 */ V(0, 1, 3),
+  /* 1001111111 */ V(0, 1, 3),
+  /* 1010000000 */ V(1, 0, 3),
+  /* 1010000001 */ V(1, 0, 3),
+  /* 1010000010 */ V(1, 0, 3),
+  /* 1010000011 */ V(1, 0, 3),
+  /* 1010000100 */ V(1, 0, 3),
+  /* 1010000101 */ V(1, 0, 3),
+  /* 1010000110 */ V(1, 0, 3),
+  /* 1010000111 */ V(1, 0, 3),
+  /* 1010001000 */ V(1, 0, 3),
+  /* 1010001001 */ V(1, 0, 3),
+  /* 1010001010 */ V(1, 0, 3),
+  /* 1010001011 */ V(1, 0, 3),
+  /* 1010001100 */ V(1, 0, 3),
+  /* 1010001101 */ V(1, 0, 3),
+  /* 1010001110 */ V(1, 0, 3),
+  /* 1010001111 */ V(1, 0, 3),
+  /* 1010010000 */ V(1, 0, 3),
+  /* 1010010001 */ V(1, 0, 3),
+  /* 1010010010 */ V(1, 0, 3),
+  /* 1010010011 */ V(1, 0, 3),
+  /* 1010010100 */ V(1, 0, 3),
+  /* 1010010101 */ V(1, 0, 3),
+  /* 1010010110 */ V(1, 0, 3),
+  /* 1010010111 */ V(1, 0, 3),
+  /* 1010011000 */ V(1, 0, 3),
+  /* 1010011001 */ V(1, 0, 3),
+  /* 1010011010 */ V(1, 0, 3),
+  /* 1010011011 */ V(1, 0, 3),
+  /* 1010011100 */ V(1, 0, 3),
+  /* 1010011101 */ V(1, 0, 3),
+  /* 1010011110 */ V(1, 0, 3),
+  /* 1010011111 */ V(1, 0, 3),
+  /* 1010100000 */ V(1, 0, 3),
+  /* 1010100001 */ V(1, 0, 3),
+  /* 1010100010 */ V(1, 0, 3),
+  /* 1010100011 */ V(1, 0, 3),
+  /* 1010100100 */ V(1, 0, 3),
+  /* 1010100101 */ V(1, 0, 3),
+  /* 1010100110 */ V(1, 0, 3),
+  /* 1010100111 */ V(1, 0, 3),
+  /* 1010101000 */ V(1, 0, 3),
+  /* 1010101001 */ V(1, 0, 3),
+  /* 1010101010 */ V(1, 0, 3),
+  /* 1010101011 */ V(1, 0, 3),
+  /* 1010101100 */ V(1, 0, 3),
+  /* 1010101101 */ V(1, 0, 3),
+  /* 1010101110 */ V(1, 0, 3),
+  /* 1010101111 */ V(1, 0, 3),
+  /* 1010110000 */ V(1, 0, 3),
+  /* 1010110001 */ V(1, 0, 3),
+  /* 1010110010 */ V(1, 0, 3),
+  /* 1010110011 */ V(1, 0, 3),
+  /* 1010110100 */ V(1, 0, 3),
+  /* 1010110101 */ V(1, 0, 3),
+  /* 1010110110 */ V(1, 0, 3),
+  /* 1010110111 */ V(1, 0, 3),
+  /* 1010111000 */ V(1, 0, 3),
+  /* 1010111001 */ V(1, 0, 3),
+  /* 1010111010 */ V(1, 0, 3),
+  /* 1010111011 */ V(1, 0, 3),
+  /* 1010111100 */ V(1, 0, 3),
+  /* 1010111101 */ V(1, 0, 3),
+  /* 1010111110 */ V(1, 0, 3),
+  /* 1010111111 */ V(1, 0, 3),
+  /* 1011000000 */ V(1, 0, 3),
+  /* 1011000001 */ V(1, 0, 3),
+  /* 1011000010 */ V(1, 0, 3),
+  /* 1011000011 */ V(1, 0, 3),
+  /* 1011000100 */ V(1, 0, 3),
+  /* 1011000101 */ V(1, 0, 3),
+  /* 1011000110 */ V(1, 0, 3),
+  /* 1011000111 */ V(1, 0, 3),
+  /* 1011001000 */ V(1, 0, 3),
+  /* 1011001001 */ V(1, 0, 3),
+  /* 1011001010 */ V(1, 0, 3),
+  /* 1011001011 */ V(1, 0, 3),
+  /* 1011001100 */ V(1, 0, 3),
+  /* 1011001101 */ V(1, 0, 3),
+  /* 1011001110 */ V(1, 0, 3),
+  /* 1011001111 */ V(1, 0, 3),
+  /* 1011010000 */ V(1, 0, 3),
+  /* 1011010001 */ V(1, 0, 3),
+  /* 1011010010 */ V(1, 0, 3),
+  /* 1011010011 */ V(1, 0, 3),
+  /* 1011010100 */ V(1, 0, 3),
+  /* 1011010101 */ V(1, 0, 3),
+  /* 1011010110 */ V(1, 0, 3),
+  /* 1011010111 */ V(1, 0, 3),
+  /* 1011011000 */ V(1, 0, 3),
+  /* 1011011001 */ V(1, 0, 3),
+  /* 1011011010 */ V(1, 0, 3),
+  /* 1011011011 */ V(1, 0, 3),
+  /* 1011011100 */ V(1, 0, 3),
+  /* 1011011101 */ V(1, 0, 3),
+  /* 1011011110 */ V(1, 0, 3),
+  /* 1011011111 */ V(1, 0, 3),
+  /* 1011100000 */ V(1, 0, 3),
+  /* 1011100001 */ V(1, 0, 3),
+  /* 1011100010 */ V(1, 0, 3),
+  /* 1011100011 */ V(1, 0, 3),
+  /* 1011100100 */ V(1, 0, 3),
+  /* 1011100101 */ V(1, 0, 3),
+  /* 1011100110 */ V(1, 0, 3),
+  /* 1011100111 */ V(1, 0, 3),
+  /* 1011101000 */ V(1, 0, 3),
+  /* 1011101001 */ V(1, 0, 3),
+  /* 1011101010 */ V(1, 0, 3),
+  /* 1011101011 */ V(1, 0, 3),
+  /* 1011101100 */ V(1, 0, 3),
+  /* 1011101101 */ V(1, 0, 3),
+  /* 1011101110 */ V(1, 0, 3),
+  /* 1011101111 */ V(1, 0, 3),
+  /* 1011110000 */ V(1, 0, 3),
+  /* 1011110001 */ V(1, 0, 3),
+  /* 1011110010 */ V(1, 0, 3),
+  /* 1011110011 */ V(1, 0, 3),
+  /* 1011110100 */ V(1, 0, 3),
+  /* 1011110101 */ V(1, 0, 3),
+  /* 1011110110 */ V(1, 0, 3),
+  /* 1011110111 */ V(1, 0, 3),
+  /* 1011111000 */ V(1, 0, 3),
+  /* 1011111001 */ V(1, 0, 3),
+  /* 1011111010 */ V(1, 0, 3),
+  /* 1011111011 */ V(1, 0, 3),
+  /* 1011111100 */ V(1, 0, 3),
+  /* 1011111101 */ V(1, 0, 3),
+  /* 1011111110 */ V(1, 0, 3),
+  /* 1011111111 */ V(1, 0, 3),
+  /* 1100000000 */ V(0, 0, 2),
+  /* 1100000001 */ V(0, 0, 2),
+  /* 1100000010 */ V(0, 0, 2),
+  /* 1100000011 */ V(0, 0, 2),
+  /* 1100000100 */ V(0, 0, 2),
+  /* 1100000101 */ V(0, 0, 2),
+  /* 1100000110 */ V(0, 0, 2),
+  /* 1100000111 */ V(0, 0, 2),
+  /* 1100001000 */ V(0, 0, 2),
+  /* 1100001001 */ V(0, 0, 2),
+  /* 1100001010 */ V(0, 0, 2),
+  /* 1100001011 */ V(0, 0, 2),
+  /* 1100001100 */ V(0, 0, 2),
+  /* 1100001101 */ V(0, 0, 2),
+  /* 1100001110 */ V(0, 0, 2),
+  /* 1100001111 */ V(0, 0, 2),
+  /* 1100010000 */ V(0, 0, 2),
+  /* 1100010001 */ V(0, 0, 2),
+  /* 1100010010 */ V(0, 0, 2),
+  /* 1100010011 */ V(0, 0, 2),
+  /* 1100010100 */ V(0, 0, 2),
+  /* 1100010101 */ V(0, 0, 2),
+  /* 1100010110 */ V(0, 0, 2),
+  /* 1100010111 */ V(0, 0, 2),
+  /* 1100011000 */ V(0, 0, 2),
+  /* 1100011001 */ V(0, 0, 2),
+  /* 1100011010 */ V(0, 0, 2),
+  /* 1100011011 */ V(0, 0, 2),
+  /* 1100011100 */ V(0, 0, 2),
+  /* 1100011101 */ V(0, 0, 2),
+  /* 1100011110 */ V(0, 0, 2),
+  /* 1100011111 */ V(0, 0, 2),
+  /* 1100100000 */ V(0, 0, 2),
+  /* 1100100001 */ V(0, 0, 2),
+  /* 1100100010 */ V(0, 0, 2),
+  /* 1100100011 */ V(0, 0, 2),
+  /* 1100100100 */ V(0, 0, 2),
+  /* 1100100101 */ V(0, 0, 2),
+  /* 1100100110 */ V(0, 0, 2),
+  /* 1100100111 */ V(0, 0, 2),
+  /* 1100101000 */ V(0, 0, 2),
+  /* 1100101001 */ V(0, 0, 2),
+  /* 1100101010 */ V(0, 0, 2),
+  /* 1100101011 */ V(0, 0, 2),
+  /* 1100101100 */ V(0, 0, 2),
+  /* 1100101101 */ V(0, 0, 2),
+  /* 1100101110 */ V(0, 0, 2),
+  /* 1100101111 */ V(0, 0, 2),
+  /* 1100110000 */ V(0, 0, 2),
+  /* 1100110001 */ V(0, 0, 2),
+  /* 1100110010 */ V(0, 0, 2),
+  /* 1100110011 */ V(0, 0, 2),
+  /* 1100110100 */ V(0, 0, 2),
+  /* 1100110101 */ V(0, 0, 2),
+  /* 1100110110 */ V(0, 0, 2),
+  /* 1100110111 */ V(0, 0, 2),
+  /* 1100111000 */ V(0, 0, 2),
+  /* 1100111001 */ V(0, 0, 2),
+  /* 1100111010 */ V(0, 0, 2),
+  /* 1100111011 */ V(0, 0, 2),
+  /* 1100111100 */ V(0, 0, 2),
+  /* 1100111101 */ V(0, 0, 2),
+  /* 1100111110 */ V(0, 0, 2),
+  /* 1100111111 */ V(0, 0, 2),
+  /* 1101000000 */ V(0, 0, 2),
+  /* 1101000001 */ V(0, 0, 2),
+  /* 1101000010 */ V(0, 0, 2),
+  /* 1101000011 */ V(0, 0, 2),
+  /* 1101000100 */ V(0, 0, 2),
+  /* 1101000101 */ V(0, 0, 2),
+  /* 1101000110 */ V(0, 0, 2),
+  /* 1101000111 */ V(0, 0, 2),
+  /* 1101001000 */ V(0, 0, 2),
+  /* 1101001001 */ V(0, 0, 2),
+  /* 1101001010 */ V(0, 0, 2),
+  /* 1101001011 */ V(0, 0, 2),
+  /* 1101001100 */ V(0, 0, 2),
+  /* 1101001101 */ V(0, 0, 2),
+  /* 1101001110 */ V(0, 0, 2),
+  /* 1101001111 */ V(0, 0, 2),
+  /* 1101010000 */ V(0, 0, 2),
+  /* 1101010001 */ V(0, 0, 2),
+  /* 1101010010 */ V(0, 0, 2),
+  /* 1101010011 */ V(0, 0, 2),
+  /* 1101010100 */ V(0, 0, 2),
+  /* 1101010101 */ V(0, 0, 2),
+  /* 1101010110 */ V(0, 0, 2),
+  /* 1101010111 */ V(0, 0, 2),
+  /* 1101011000 */ V(0, 0, 2),
+  /* 1101011001 */ V(0, 0, 2),
+  /* 1101011010 */ V(0, 0, 2),
+  /* 1101011011 */ V(0, 0, 2),
+  /* 1101011100 */ V(0, 0, 2),
+  /* 1101011101 */ V(0, 0, 2),
+  /* 1101011110 */ V(0, 0, 2),
+  /* 1101011111 */ V(0, 0, 2),
+  /* 1101100000 */ V(0, 0, 2),
+  /* 1101100001 */ V(0, 0, 2),
+  /* 1101100010 */ V(0, 0, 2),
+  /* 1101100011 */ V(0, 0, 2),
+  /* 1101100100 */ V(0, 0, 2),
+  /* 1101100101 */ V(0, 0, 2),
+  /* 1101100110 */ V(0, 0, 2),
+  /* 1101100111 */ V(0, 0, 2),
+  /* 1101101000 */ V(0, 0, 2),
+  /* 1101101001 */ V(0, 0, 2),
+  /* 1101101010 */ V(0, 0, 2),
+  /* 1101101011 */ V(0, 0, 2),
+  /* 1101101100 */ V(0, 0, 2),
+  /* 1101101101 */ V(0, 0, 2),
+  /* 1101101110 */ V(0, 0, 2),
+  /* 1101101111 */ V(0, 0, 2),
+  /* 1101110000 */ V(0, 0, 2),
+  /* 1101110001 */ V(0, 0, 2),
+  /* 1101110010 */ V(0, 0, 2),
+  /* 1101110011 */ V(0, 0, 2),
+  /* 1101110100 */ V(0, 0, 2),
+  /* 1101110101 */ V(0, 0, 2),
+  /* 1101110110 */ V(0, 0, 2),
+  /* 1101110111 */ V(0, 0, 2),
+  /* 1101111000 */ V(0, 0, 2),
+  /* 1101111001 */ V(0, 0, 2),
+  /* 1101111010 */ V(0, 0, 2),
+  /* 1101111011 */ V(0, 0, 2),
+  /* 1101111100 */ V(0, 0, 2),
+  /* 1101111101 */ V(0, 0, 2),
+  /* 1101111110 */ V(0, 0, 2),
+  /* 1101111111 */ V(0, 0, 2),
+  /* 1110000000 */ V(0, 0, 2),
+  /* 1110000001 */ V(0, 0, 2),
+  /* 1110000010 */ V(0, 0, 2),
+  /* 1110000011 */ V(0, 0, 2),
+  /* 1110000100 */ V(0, 0, 2),
+  /* 1110000101 */ V(0, 0, 2),
+  /* 1110000110 */ V(0, 0, 2),
+  /* 1110000111 */ V(0, 0, 2),
+  /* 1110001000 */ V(0, 0, 2),
+  /* 1110001001 */ V(0, 0, 2),
+  /* 1110001010 */ V(0, 0, 2),
+  /* 1110001011 */ V(0, 0, 2),
+  /* 1110001100 */ V(0, 0, 2),
+  /* 1110001101 */ V(0, 0, 2),
+  /* 1110001110 */ V(0, 0, 2),
+  /* 1110001111 */ V(0, 0, 2),
+  /* 1110010000 */ V(0, 0, 2),
+  /* 1110010001 */ V(0, 0, 2),
+  /* 1110010010 */ V(0, 0, 2),
+  /* 1110010011 */ V(0, 0, 2),
+  /* 1110010100 */ V(0, 0, 2),
+  /* 1110010101 */ V(0, 0, 2),
+  /* 1110010110 */ V(0, 0, 2),
+  /* 1110010111 */ V(0, 0, 2),
+  /* 1110011000 */ V(0, 0, 2),
+  /* 1110011001 */ V(0, 0, 2),
+  /* 1110011010 */ V(0, 0, 2),
+  /* 1110011011 */ V(0, 0, 2),
+  /* 1110011100 */ V(0, 0, 2),
+  /* 1110011101 */ V(0, 0, 2),
+  /* 1110011110 */ V(0, 0, 2),
+  /* 1110011111 */ V(0, 0, 2),
+  /* 1110100000 */ V(0, 0, 2),
+  /* 1110100001 */ V(0, 0, 2),
+  /* 1110100010 */ V(0, 0, 2),
+  /* 1110100011 */ V(0, 0, 2),
+  /* 1110100100 */ V(0, 0, 2),
+  /* 1110100101 */ V(0, 0, 2),
+  /* 1110100110 */ V(0, 0, 2),
+  /* 1110100111 */ V(0, 0, 2),
+  /* 1110101000 */ V(0, 0, 2),
+  /* 1110101001 */ V(0, 0, 2),
+  /* 1110101010 */ V(0, 0, 2),
+  /* 1110101011 */ V(0, 0, 2),
+  /* 1110101100 */ V(0, 0, 2),
+  /* 1110101101 */ V(0, 0, 2),
+  /* 1110101110 */ V(0, 0, 2),
+  /* 1110101111 */ V(0, 0, 2),
+  /* 1110110000 */ V(0, 0, 2),
+  /* 1110110001 */ V(0, 0, 2),
+  /* 1110110010 */ V(0, 0, 2),
+  /* 1110110011 */ V(0, 0, 2),
+  /* 1110110100 */ V(0, 0, 2),
+  /* 1110110101 */ V(0, 0, 2),
+  /* 1110110110 */ V(0, 0, 2),
+  /* 1110110111 */ V(0, 0, 2),
+  /* 1110111000 */ V(0, 0, 2),
+  /* 1110111001 */ V(0, 0, 2),
+  /* 1110111010 */ V(0, 0, 2),
+  /* 1110111011 */ V(0, 0, 2),
+  /* 1110111100 */ V(0, 0, 2),
+  /* 1110111101 */ V(0, 0, 2),
+  /* 1110111110 */ V(0, 0, 2),
+  /* 1110111111 */ V(0, 0, 2),
+  /* 1111000000 */ V(0, 0, 2),
+  /* 1111000001 */ V(0, 0, 2),
+  /* 1111000010 */ V(0, 0, 2),
+  /* 1111000011 */ V(0, 0, 2),
+  /* 1111000100 */ V(0, 0, 2),
+  /* 1111000101 */ V(0, 0, 2),
+  /* 1111000110 */ V(0, 0, 2),
+  /* 1111000111 */ V(0, 0, 2),
+  /* 1111001000 */ V(0, 0, 2),
+  /* 1111001001 */ V(0, 0, 2),
+  /* 1111001010 */ V(0, 0, 2),
+  /* 1111001011 */ V(0, 0, 2),
+  /* 1111001100 */ V(0, 0, 2),
+  /* 1111001101 */ V(0, 0, 2),
+  /* 1111001110 */ V(0, 0, 2),
+  /* 1111001111 */ V(0, 0, 2),
+  /* 1111010000 */ V(0, 0, 2),
+  /* 1111010001 */ V(0, 0, 2),
+  /* 1111010010 */ V(0, 0, 2),
+  /* 1111010011 */ V(0, 0, 2),
+  /* 1111010100 */ V(0, 0, 2),
+  /* 1111010101 */ V(0, 0, 2),
+  /* 1111010110 */ V(0, 0, 2),
+  /* 1111010111 */ V(0, 0, 2),
+  /* 1111011000 */ V(0, 0, 2),
+  /* 1111011001 */ V(0, 0, 2),
+  /* 1111011010 */ V(0, 0, 2),
+  /* 1111011011 */ V(0, 0, 2),
+  /* 1111011100 */ V(0, 0, 2),
+  /* 1111011101 */ V(0, 0, 2),
+  /* 1111011110 */ V(0, 0, 2),
+  /* 1111011111 */ V(0, 0, 2),
+  /* 1111100000 */ V(0, 0, 2),
+  /* 1111100001 */ V(0, 0, 2),
+  /* 1111100010 */ V(0, 0, 2),
+  /* 1111100011 */ V(0, 0, 2),
+  /* 1111100100 */ V(0, 0, 2),
+  /* 1111100101 */ V(0, 0, 2),
+  /* 1111100110 */ V(0, 0, 2),
+  /* 1111100111 */ V(0, 0, 2),
+  /* 1111101000 */ V(0, 0, 2),
+  /* 1111101001 */ V(0, 0, 2),
+  /* 1111101010 */ V(0, 0, 2),
+  /* 1111101011 */ V(0, 0, 2),
+  /* 1111101100 */ V(0, 0, 2),
+  /* 1111101101 */ V(0, 0, 2),
+  /* 1111101110 */ V(0, 0, 2),
+  /* 1111101111 */ V(0, 0, 2),
+  /* 1111110000 */ V(0, 0, 2),
+  /* 1111110001 */ V(0, 0, 2),
+  /* 1111110010 */ V(0, 0, 2),
+  /* 1111110011 */ V(0, 0, 2),
+  /* 1111110100 */ V(0, 0, 2),
+  /* 1111110101 */ V(0, 0, 2),
+  /* 1111110110 */ V(0, 0, 2),
+  /* 1111110111 */ V(0, 0, 2),
+  /* 1111111000 */ V(0, 0, 2),
+  /* 1111111001 */ V(0, 0, 2),
+  /* 1111111010 */ V(0, 0, 2),
+  /* 1111111011 */ V(0, 0, 2),
+  /* 1111111100 */ V(0, 0, 2),
+  /* 1111111101 */ V(0, 0, 2),
+  /* 1111111110 */ V(0, 0, 2),
+  /* 1111111111 */ V(0, 0, 2),
+
+  /* 0000 0000 00 ... */
+  /* 0    */ V(5, 5, 1),	/* 1024 */
+  /* 1    */ V(5, 4, 1)
 };
-# else
-static
-union huffpair const hufftab8[] = {
-  /* 0000 */ PTR(16, 4),
-  /* 0001 */ PTR(32, 4),
-  /* 0010 */ V(1, 2, 4),
-  /* 0011 */ V(2, 1, 4),
-  /* 0100 */ V(1, 1, 2),
-  /* 0101 */ V(1, 1, 2),
-  /* 0110 */ V(1, 1, 2),
-  /* 0111 */ V(1, 1, 2),
-  /* 1000 */ V(0, 1, 3),
-  /* 1001 */ V(0, 1, 3),
-  /* 1010 */ V(1, 0, 3),
-  /* 1011 */ V(1, 0, 3),
-  /* 1100 */ V(0, 0, 2),
-  /* 1101 */ V(0, 0, 2),
-  /* 1110 */ V(0, 0, 2),
-  /* 1111 */ V(0, 0, 2),
-
-  /* 0000 ... */
-  /* 0000 */ PTR(48, 3),	/* 16 */
-  /* 0001 */ PTR(56, 2),
-  /* 0010 */ PTR(60, 1),
-  /* 0011 */ V(1, 5, 4),
-  /* 0100 */ V(5, 1, 4),
-  /* 0101 */ PTR(62, 1),
-  /* 0110 */ PTR(64, 1),
-  /* 0111 */ V(2, 4, 4),
-  /* 1000 */ V(4, 2, 4),
-  /* 1001 */ V(1, 4, 4),
-  /* 1010 */ V(4, 1, 3),
-  /* 1011 */ V(4, 1, 3),
-  /* 1100 */ V(0, 4, 4),
-  /* 1101 */ V(4, 0, 4),
-  /* 1110 */ V(2, 3, 4),
-  /* 1111 */ V(3, 2, 4),
-
-  /* 0001 ... */
-  /* 0000 */ V(1, 3, 4),	/* 32 */
-  /* 0001 */ V(3, 1, 4),
-  /* 0010 */ V(0, 3, 4),
-  /* 0011 */ V(3, 0, 4),
-  /* 0100 */ V(2, 2, 2),
-  /* 0101 */ V(2, 2, 2),
-  /* 0110 */ V(2, 2, 2),
-  /* 0111 */ V(2, 2, 2),
-  /* 1000 */ V(0, 2, 2),
-  /* 1001 */ V(0, 2, 2),
-  /* 1010 */ V(0, 2, 2),
-  /* 1011 */ V(0, 2, 2),
-  /* 1100 */ V(2, 0, 2),
-  /* 1101 */ V(2, 0, 2),
-  /* 1110 */ V(2, 0, 2),
-  /* 1111 */ V(2, 0, 2),
-
-  /* 0000 0000 ... */
-  /* 000  */ V(5, 5, 3),	/* 48 */
-  /* 001  */ V(5, 4, 3),
-  /* 010  */ V(4, 5, 2),
-  /* 011  */ V(4, 5, 2),
-  /* 100  */ V(5, 3, 1),
-  /* 101  */ V(5, 3, 1),
-  /* 110  */ V(5, 3, 1),
-  /* 111  */ V(5, 3, 1),
-
-  /* 0000 0001 ... */
-  /* 00   */ V(3, 5, 2),	/* 56 */
-  /* 01   */ V(4, 4, 2),
-  /* 10   */ V(2, 5, 1),
-  /* 11   */ V(2, 5, 1),
-
-  /* 0000 0010 ... */
-  /* 0    */ V(5, 2, 1),	/* 60 */
-  /* 1    */ V(0, 5, 1),
-
-  /* 0000 0101 ... */
-  /* 0    */ V(3, 4, 1),	/* 62 */
-  /* 1    */ V(4, 3, 1),
-
-  /* 0000 0110 ... */
-  /* 0    */ V(5, 0, 1),	/* 64 */
-  /* 1    */ V(3, 3, 1)
-};
-# endif
 
 static
 union huffpair const hufftab9[] = {
-  /* 0000 */ PTR(16, 4),
-  /* 0001 */ PTR(32, 3),
-  /* 0010 */ PTR(40, 2),
-  /* 0011 */ PTR(44, 2),
-  /* 0100 */ PTR(48, 1),
-  /* 0101 */ V(1, 2, 4),
-  /* 0110 */ V(2, 1, 4),
-  /* 0111 */ V(2, 0, 4),
-  /* 1000 */ V(1, 1, 3),
-  /* 1001 */ V(1, 1, 3),
-  /* 1010 */ V(0, 1, 3),
-  /* 1011 */ V(0, 1, 3),
-  /* 1100 */ V(1, 0, 3),
-  /* 1101 */ V(1, 0, 3),
-  /* 1110 */ V(0, 0, 3),
-  /* 1111 */ V(0, 0, 3),
-
-  /* 0000 ... */
-  /* 0000 */ PTR(50, 1),	/* 16 */
-  /* 0001 */ V(3, 5, 4),
-  /* 0010 */ V(5, 3, 4),
-  /* 0011 */ PTR(52, 1),
-  /* 0100 */ V(4, 4, 4),
-  /* 0101 */ V(2, 5, 4),
-  /* 0110 */ V(5, 2, 4),
-  /* 0111 */ V(1, 5, 4),
-  /* 1000 */ V(5, 1, 3),
-  /* 1001 */ V(5, 1, 3),
-  /* 1010 */ V(3, 4, 3),
-  /* 1011 */ V(3, 4, 3),
-  /* 1100 */ V(4, 3, 3),
-  /* 1101 */ V(4, 3, 3),
-  /* 1110 */ V(5, 0, 4),
-  /* 1111 */ V(0, 4, 4),
-
-  /* 0001 ... */
-  /* 000  */ V(2, 4, 3),	/* 32 */
-  /* 001  */ V(4, 2, 3),
-  /* 010  */ V(3, 3, 3),
-  /* 011  */ V(4, 0, 3),
-  /* 100  */ V(1, 4, 2),
-  /* 101  */ V(1, 4, 2),
-  /* 110  */ V(4, 1, 2),
-  /* 111  */ V(4, 1, 2),
-
-  /* 0010 ... */
-  /* 00   */ V(2, 3, 2),	/* 40 */
-  /* 01   */ V(3, 2, 2),
-  /* 10   */ V(1, 3, 1),
-  /* 11   */ V(1, 3, 1),
-
-  /* 0011 ... */
-  /* 00   */ V(3, 1, 1),	/* 44 */
-  /* 01   */ V(3, 1, 1),
-  /* 10   */ V(0, 3, 2),
-  /* 11   */ V(3, 0, 2),
-
-  /* 0100 ... */
-  /* 0    */ V(2, 2, 1),	/* 48 */
-  /* 1    */ V(0, 2, 1),
-
-  /* 0000 0000 ... */
-  /* 0    */ V(5, 5, 1),	/* 50 */
-  /* 1    */ V(4, 5, 1),
-
-  /* 0000 0011 ... */
-  /* 0    */ V(5, 4, 1),	/* 52 */
-  /* 1    */ V(0, 5, 1)
+  /* 000000000 */ V(5, 5, 9),
+  /* 000000001 */ V(4, 5, 9),
+  /* 000000010 */ V(3, 5, 8),
+  /* 000000011 */ V(3, 5, 8),
+  /* 000000100 */ V(5, 3, 8),
+  /* 000000101 */ V(5, 3, 8),
+  /* 000000110 */ V(5, 4, 9),
+  /* 000000111 */ V(0, 5, 9),
+  /* 000001000 */ V(4, 4, 8),
+  /* 000001001 */ V(4, 4, 8),
+  /* 000001010 */ V(2, 5, 8),
+  /* 000001011 */ V(2, 5, 8),
+  /* 000001100 */ V(5, 2, 8),
+  /* 000001101 */ V(5, 2, 8),
+  /* 000001110 */ V(1, 5, 8),
+  /* 000001111 */ V(1, 5, 8),
+  /* 000010000 */ V(5, 1, 7),
+  /* 000010001 */ V(5, 1, 7),
+  /* 000010010 */ V(5, 1, 7),
+  /* 000010011 */ V(5, 1, 7),
+  /* 000010100 */ V(3, 4, 7),
+  /* 000010101 */ V(3, 4, 7),
+  /* 000010110 */ V(3, 4, 7),
+  /* 000010111 */ V(3, 4, 7),
+  /* 000011000 */ V(4, 3, 7),
+  /* 000011001 */ V(4, 3, 7),
+  /* 000011010 */ V(4, 3, 7),
+  /* 000011011 */ V(4, 3, 7),
+  /* 000011100 */ V(5, 0, 8),
+  /* 000011101 */ V(5, 0, 8),
+  /* 000011110 */ V(0, 4, 8),
+  /* 000011111 */ V(0, 4, 8),
+  /* 000100000 */ V(2, 4, 7),
+  /* 000100001 */ V(2, 4, 7),
+  /* 000100010 */ V(2, 4, 7),
+  /* 000100011 */ V(2, 4, 7),
+  /* 000100100 */ V(4, 2, 7),
+  /* 000100101 */ V(4, 2, 7),
+  /* 000100110 */ V(4, 2, 7),
+  /* 000100111 */ V(4, 2, 7),
+  /* 000101000 */ V(3, 3, 7),
+  /* 000101001 */ V(3, 3, 7),
+  /* 000101010 */ V(3, 3, 7),
+  /* 000101011 */ V(3, 3, 7),
+  /* 000101100 */ V(4, 0, 7),
+  /* 000101101 */ V(4, 0, 7),
+  /* 000101110 */ V(4, 0, 7),
+  /* 000101111 */ V(4, 0, 7),
+  /* 000110000 */ V(1, 4, 6),
+  /* 000110001 */ V(1, 4, 6),
+  /* 000110010 */ V(1, 4, 6),
+  /* 000110011 */ V(1, 4, 6),
+  /* 000110100 */ V(1, 4, 6),
+  /* 000110101 */ V(1, 4, 6),
+  /* 000110110 */ V(1, 4, 6),
+  /* 000110111 */ V(1, 4, 6),
+  /* 000111000 */ V(4, 1, 6),
+  /* 000111001 */ V(4, 1, 6),
+  /* 000111010 */ V(4, 1, 6),
+  /* 000111011 */ V(4, 1, 6),
+  /* 000111100 */ V(4, 1, 6),
+  /* 000111101 */ V(4, 1, 6),
+  /* 000111110 */ V(4, 1, 6),
+  /* 000111111 */ V(4, 1, 6),
+  /* 001000000 */ V(2, 3, 6),
+  /* 001000001 */ V(2, 3, 6),
+  /* 001000010 */ V(2, 3, 6),
+  /* 001000011 */ V(2, 3, 6),
+  /* 001000100 */ V(2, 3, 6),
+  /* 001000101 */ V(2, 3, 6),
+  /* 001000110 */ V(2, 3, 6),
+  /* 001000111 */ V(2, 3, 6),
+  /* 001001000 */ V(3, 2, 6),
+  /* 001001001 */ V(3, 2, 6),
+  /* 001001010 */ V(3, 2, 6),
+  /* 001001011 */ V(3, 2, 6),
+  /* 001001100 */ V(3, 2, 6),
+  /* 001001101 */ V(3, 2, 6),
+  /* 001001110 */ V(3, 2, 6),
+  /* 001001111 */ V(3, 2, 6),
+  /* 001010000 */ V(1, 3, 5),
+  /* 001010001 */ V(1, 3, 5),
+  /* 001010010 */ V(1, 3, 5),
+  /* 001010011 */ V(1, 3, 5),
+  /* 001010100 */ V(1, 3, 5),
+  /* 001010101 */ V(1, 3, 5),
+  /* 001010110 */ V(1, 3, 5),
+  /* 001010111 */ V(1, 3, 5),
+  /* 001011000 */ V(1, 3, 5),
+  /* 001011001 */ V(1, 3, 5),
+  /* 001011010 */ V(1, 3, 5),
+  /* 001011011 */ V(1, 3, 5),
+  /* 001011100 */ V(1, 3, 5),
+  /* 001011101 */ V(1, 3, 5),
+  /* 001011110 */ V(1, 3, 5),
+  /* 001011111 */ V(1, 3, 5),
+  /* 001100000 */ V(3, 1, 5),
+  /* 001100001 */ V(3, 1, 5),
+  /* 001100010 */ V(3, 1, 5),
+  /* 001100011 */ V(3, 1, 5),
+  /* 001100100 */ V(3, 1, 5),
+  /* 001100101 */ V(3, 1, 5),
+  /* 001100110 */ V(3, 1, 5),
+  /* 001100111 */ V(3, 1, 5),
+  /* 001101000 */ V(3, 1, 5),
+  /* 001101001 */ V(3, 1, 5),
+  /* 001101010 */ V(3, 1, 5),
+  /* 001101011 */ V(3, 1, 5),
+  /* 001101100 */ V(3, 1, 5),
+  /* 001101101 */ V(3, 1, 5),
+  /* 001101110 */ V(3, 1, 5),
+  /* 001101111 */ V(3, 1, 5),
+  /* 001110000 */ V(0, 3, 6),
+  /* 001110001 */ V(0, 3, 6),
+  /* 001110010 */ V(0, 3, 6),
+  /* 001110011 */ V(0, 3, 6),
+  /* 001110100 */ V(0, 3, 6),
+  /* 001110101 */ V(0, 3, 6),
+  /* 001110110 */ V(0, 3, 6),
+  /* 001110111 */ V(0, 3, 6),
+  /* 001111000 */ V(3, 0, 6),
+  /* 001111001 */ V(3, 0, 6),
+  /* 001111010 */ V(3, 0, 6),
+  /* 001111011 */ V(3, 0, 6),
+  /* 001111100 */ V(3, 0, 6),
+  /* 001111101 */ V(3, 0, 6),
+  /* 001111110 */ V(3, 0, 6),
+  /* 001111111 */ V(3, 0, 6),
+  /* 010000000 */ V(2, 2, 5),
+  /* 010000001 */ V(2, 2, 5),
+  /* 010000010 */ V(2, 2, 5),
+  /* 010000011 */ V(2, 2, 5),
+  /* 010000100 */ V(2, 2, 5),
+  /* 010000101 */ V(2, 2, 5),
+  /* 010000110 */ V(2, 2, 5),
+  /* 010000111 */ V(2, 2, 5),
+  /* 010001000 */ V(2, 2, 5),
+  /* 010001001 */ V(2, 2, 5),
+  /* 010001010 */ V(2, 2, 5),
+  /* 010001011 */ V(2, 2, 5),
+  /* 010001100 */ V(2, 2, 5),
+  /* 010001101 */ V(2, 2, 5),
+  /* 010001110 */ V(2, 2, 5),
+  /* 010001111 */ V(2, 2, 5),
+  /* 010010000 */ V(0, 2, 5),
+  /* 010010001 */ V(0, 2, 5),
+  /* 010010010 */ V(0, 2, 5),
+  /* 010010011 */ V(0, 2, 5),
+  /* 010010100 */ V(0, 2, 5),
+  /* 010010101 */ V(0, 2, 5),
+  /* 010010110 */ V(0, 2, 5),
+  /* 010010111 */ V(0, 2, 5),
+  /* 010011000 */ V(0, 2, 5),
+  /* 010011001 */ V(0, 2, 5),
+  /* 010011010 */ V(0, 2, 5),
+  /* 010011011 */ V(0, 2, 5),
+  /* 010011100 */ V(0, 2, 5),
+  /* 010011101 */ V(0, 2, 5),
+  /* 010011110 */ V(0, 2, 5),
+  /* 010011111 */ V(0, 2, 5),
+  /* 010100000 */ V(1, 2, 4),
+  /* 010100001 */ V(1, 2, 4),
+  /* 010100010 */ V(1, 2, 4),
+  /* 010100011 */ V(1, 2, 4),
+  /* 010100100 */ V(1, 2, 4),
+  /* 010100101 */ V(1, 2, 4),
+  /* 010100110 */ V(1, 2, 4),
+  /* 010100111 */ V(1, 2, 4),
+  /* 010101000 */ V(1, 2, 4),
+  /* 010101001 */ V(1, 2, 4),
+  /* 010101010 */ V(1, 2, 4),
+  /* 010101011 */ V(1, 2, 4),
+  /* 010101100 */ V(1, 2, 4),
+  /* 010101101 */ V(1, 2, 4),
+  /* 010101110 */ V(1, 2, 4),
+  /* 010101111 */ V(1, 2, 4),
+  /* 010110000 */ V(1, 2, 4),
+  /* 010110001 */ V(1, 2, 4),
+  /* 010110010 */ V(1, 2, 4),
+  /* 010110011 */ V(1, 2, 4),
+  /* 010110100 */ V(1, 2, 4),
+  /* 010110101 */ V(1, 2, 4),
+  /* 010110110 */ V(1, 2, 4),
+  /* 010110111 */ V(1, 2, 4),
+  /* 010111000 */ V(1, 2, 4),
+  /* 010111001 */ V(1, 2, 4),
+  /* 010111010 */ V(1, 2, 4),
+  /* 010111011 */ V(1, 2, 4),
+  /* 010111100 */ V(1, 2, 4),
+  /* 010111101 */ V(1, 2, 4),
+  /* 010111110 */ V(1, 2, 4),
+  /* 010111111 */ V(1, 2, 4),
+  /* 011000000 */ V(2, 1, 4),
+  /* 011000001 */ V(2, 1, 4),
+  /* 011000010 */ V(2, 1, 4),
+  /* 011000011 */ V(2, 1, 4),
+  /* 011000100 */ V(2, 1, 4),
+  /* 011000101 */ V(2, 1, 4),
+  /* 011000110 */ V(2, 1, 4),
+  /* 011000111 */ V(2, 1, 4),
+  /* 011001000 */ V(2, 1, 4),
+  /* 011001001 */ V(2, 1, 4),
+  /* 011001010 */ V(2, 1, 4),
+  /* 011001011 */ V(2, 1, 4),
+  /* 011001100 */ V(2, 1, 4),
+  /* 011001101 */ V(2, 1, 4),
+  /* 011001110 */ V(2, 1, 4),
+  /* 011001111 */ V(2, 1, 4),
+  /* 011010000 */ V(2, 1, 4),
+  /* 011010001 */ V(2, 1, 4),
+  /* 011010010 */ V(2, 1, 4),
+  /* 011010011 */ V(2, 1, 4),
+  /* 011010100 */ V(2, 1, 4),
+  /* 011010101 */ V(2, 1, 4),
+  /* 011010110 */ V(2, 1, 4),
+  /* 011010111 */ V(2, 1, 4),
+  /* 011011000 */ V(2, 1, 4),
+  /* 011011001 */ V(2, 1, 4),
+  /* 011011010 */ V(2, 1, 4),
+  /* 011011011 */ V(2, 1, 4),
+  /* 011011100 */ V(2, 1, 4),
+  /* 011011101 */ V(2, 1, 4),
+  /* 011011110 */ V(2, 1, 4),
+  /* 011011111 */ V(2, 1, 4),
+  /* 011100000 */ V(2, 0, 4),
+  /* 011100001 */ V(2, 0, 4),
+  /* 011100010 */ V(2, 0, 4),
+  /* 011100011 */ V(2, 0, 4),
+  /* 011100100 */ V(2, 0, 4),
+  /* 011100101 */ V(2, 0, 4),
+  /* 011100110 */ V(2, 0, 4),
+  /* 011100111 */ V(2, 0, 4),
+  /* 011101000 */ V(2, 0, 4),
+  /* 011101001 */ V(2, 0, 4),
+  /* 011101010 */ V(2, 0, 4),
+  /* 011101011 */ V(2, 0, 4),
+  /* 011101100 */ V(2, 0, 4),
+  /* 011101101 */ V(2, 0, 4),
+  /* 011101110 */ V(2, 0, 4),
+  /* 011101111 */ V(2, 0, 4),
+  /* 011110000 */ V(2, 0, 4),
+  /* 011110001 */ V(2, 0, 4),
+  /* 011110010 */ V(2, 0, 4),
+  /* 011110011 */ V(2, 0, 4),
+  /* 011110100 */ V(2, 0, 4),
+  /* 011110101 */ V(2, 0, 4),
+  /* 011110110 */ V(2, 0, 4),
+  /* 011110111 */ V(2, 0, 4),
+  /* 011111000 */ V(2, 0, 4),
+  /* 011111001 */ V(2, 0, 4),
+  /* 011111010 */ V(2, 0, 4),
+  /* 011111011 */ V(2, 0, 4),
+  /* 011111100 */ V(2, 0, 4),
+  /* 011111101 */ V(2, 0, 4),
+  /* 011111110 */ V(2, 0, 4),
+  /* 011111111 */ V(2, 0, 4),
+  /* 100000000 */ V(1, 1, 3),
+  /* 100000001 */ V(1, 1, 3),
+  /* 100000010 */ V(1, 1, 3),
+  /* 100000011 */ V(1, 1, 3),
+  /* 100000100 */ V(1, 1, 3),
+  /* 100000101 */ V(1, 1, 3),
+  /* 100000110 */ V(1, 1, 3),
+  /* 100000111 */ V(1, 1, 3),
+  /* 100001000 */ V(1, 1, 3),
+  /* 100001001 */ V(1, 1, 3),
+  /* 100001010 */ V(1, 1, 3),
+  /* 100001011 */ V(1, 1, 3),
+  /* 100001100 */ V(1, 1, 3),
+  /* 100001101 */ V(1, 1, 3),
+  /* 100001110 */ V(1, 1, 3),
+  /* 100001111 */ V(1, 1, 3),
+  /* 100010000 */ V(1, 1, 3),
+  /* 100010001 */ V(1, 1, 3),
+  /* 100010010 */ V(1, 1, 3),
+  /* 100010011 */ V(1, 1, 3),
+  /* 100010100 */ V(1, 1, 3),
+  /* 100010101 */ V(1, 1, 3),
+  /* 100010110 */ V(1, 1, 3),
+  /* 100010111 */ V(1, 1, 3),
+  /* 100011000 */ V(1, 1, 3),
+  /* 100011001 */ V(1, 1, 3),
+  /* 100011010 */ V(1, 1, 3),
+  /* 100011011 */ V(1, 1, 3),
+  /* 100011100 */ V(1, 1, 3),
+  /* 100011101 */ V(1, 1, 3),
+  /* 100011110 */ V(1, 1, 3),
+  /* 100011111 */ V(1, 1, 3),
+  /* 100100000 */ V(1, 1, 3),
+  /* 100100001 */ V(1, 1, 3),
+  /* 100100010 */ V(1, 1, 3),
+  /* 100100011 */ V(1, 1, 3),
+  /* 100100100 */ V(1, 1, 3),
+  /* 100100101 */ V(1, 1, 3),
+  /* 100100110 */ V(1, 1, 3),
+  /* 100100111 */ V(1, 1, 3),
+  /* 100101000 */ V(1, 1, 3),
+  /* 100101001 */ V(1, 1, 3),
+  /* 100101010 */ V(1, 1, 3),
+  /* 100101011 */ V(1, 1, 3),
+  /* 100101100 */ V(1, 1, 3),
+  /* 100101101 */ V(1, 1, 3),
+  /* 100101110 */ V(1, 1, 3),
+  /* 100101111 */ V(1, 1, 3),
+  /* 100110000 */ V(1, 1, 3),
+  /* 100110001 */ V(1, 1, 3),
+  /* 100110010 */ V(1, 1, 3),
+  /* 100110011 */ V(1, 1, 3),
+  /* 100110100 */ V(1, 1, 3),
+  /* 100110101 */ V(1, 1, 3),
+  /* 100110110 */ V(1, 1, 3),
+  /* 100110111 */ V(1, 1, 3),
+  /* 100111000 */ V(1, 1, 3),
+  /* 100111001 */ V(1, 1, 3),
+  /* 100111010 */ V(1, 1, 3),
+  /* 100111011 */ V(1, 1, 3),
+  /* 100111100 */ V(1, 1, 3),
+  /* 100111101 */ V(1, 1, 3),
+  /* 100111110 */ V(1, 1, 3),
+  /* 100111111 */ V(1, 1, 3),
+  /* 101000000 */ V(0, 1, 3),
+  /* 101000001 */ V(0, 1, 3),
+  /* 101000010 */ V(0, 1, 3),
+  /* 101000011 */ V(0, 1, 3),
+  /* 101000100 */ V(0, 1, 3),
+  /* 101000101 */ V(0, 1, 3),
+  /* 101000110 */ V(0, 1, 3),
+  /* 101000111 */ V(0, 1, 3),
+  /* 101001000 */ V(0, 1, 3),
+  /* 101001001 */ V(0, 1, 3),
+  /* 101001010 */ V(0, 1, 3),
+  /* 101001011 */ V(0, 1, 3),
+  /* 101001100 */ V(0, 1, 3),
+  /* 101001101 */ V(0, 1, 3),
+  /* 101001110 */ V(0, 1, 3),
+  /* 101001111 */ V(0, 1, 3),
+  /* 101010000 */ V(0, 1, 3),
+  /* 101010001 */ V(0, 1, 3),
+  /* 101010010 */ V(0, 1, 3),
+  /* 101010011 */ V(0, 1, 3),
+  /* 101010100 */ V(0, 1, 3),
+  /* 101010101 */ V(0, 1, 3),
+  /* 101010110 */ V(0, 1, 3),
+  /* 101010111 */ V(0, 1, 3),
+  /* 101011000 */ V(0, 1, 3),
+  /* 101011001 */ V(0, 1, 3),
+  /* 101011010 */ V(0, 1, 3),
+  /* 101011011 */ V(0, 1, 3),
+  /* 101011100 */ V(0, 1, 3),
+  /* 101011101 */ V(0, 1, 3),
+  /* 101011110 */ V(0, 1, 3),
+  /* 101011111 */ V(0, 1, 3),
+  /* 101100000 */ V(0, 1, 3),
+  /* 101100001 */ V(0, 1, 3),
+  /* 101100010 */ V(0, 1, 3),
+  /* 101100011 */ V(0, 1, 3),
+  /* 101100100 */ V(0, 1, 3),
+  /* 101100101 */ V(0, 1, 3),
+  /* 101100110 */ V(0, 1, 3),
+  /* 101100111 */ V(0, 1, 3),
+  /* 101101000 */ V(0, 1, 3),
+  /* 101101001 */ V(0, 1, 3),
+  /* 101101010 */ V(0, 1, 3),
+  /* 101101011 */ V(0, 1, 3),
+  /* 101101100 */ V(0, 1, 3),
+  /* 101101101 */ V(0, 1, 3),
+  /* 101101110 */ V(0, 1, 3),
+  /* 101101111 */ V(0, 1, 3),
+  /* 101110000 */ V(0, 1, 3),
+  /* 101110001 */ V(0, 1, 3),
+  /* 101110010 */ V(0, 1, 3),
+  /* 101110011 */ V(0, 1, 3),
+  /* 101110100 */ V(0, 1, 3),
+  /* 101110101 */ V(0, 1, 3),
+  /* 101110110 */ V(0, 1, 3),
+  /* 101110111 */ V(0, 1, 3),
+  /* 101111000 */ V(0, 1, 3),
+  /* 101111001 */ V(0, 1, 3),
+  /* 101111010 */ V(0, 1, 3),
+  /* 101111011 */ V(0, 1, 3),
+  /* 101111100 */ V(0, 1, 3),
+  /* 101111101 */ V(0, 1, 3),
+  /* 101111110 */ V(0, 1, 3),
+  /* 101111111 */ V(0, 1, 3),
+  /* 110000000 */ V(1, 0, 3),
+  /* 110000001 */ V(1, 0, 3),
+  /* 110000010 */ V(1, 0, 3),
+  /* 110000011 */ V(1, 0, 3),
+  /* 110000100 */ V(1, 0, 3),
+  /* 110000101 */ V(1, 0, 3),
+  /* 110000110 */ V(1, 0, 3),
+  /* 110000111 */ V(1, 0, 3),
+  /* 110001000 */ V(1, 0, 3),
+  /* 110001001 */ V(1, 0, 3),
+  /* 110001010 */ V(1, 0, 3),
+  /* 110001011 */ V(1, 0, 3),
+  /* 110001100 */ V(1, 0, 3),
+  /* 110001101 */ V(1, 0, 3),
+  /* 110001110 */ V(1, 0, 3),
+  /* 110001111 */ V(1, 0, 3),
+  /* 110010000 */ V(1, 0, 3),
+  /* 110010001 */ V(1, 0, 3),
+  /* 110010010 */ V(1, 0, 3),
+  /* 110010011 */ V(1, 0, 3),
+  /* 110010100 */ V(1, 0, 3),
+  /* 110010101 */ V(1, 0, 3),
+  /* 110010110 */ V(1, 0, 3),
+  /* 110010111 */ V(1, 0, 3),
+  /* 110011000 */ V(1, 0, 3),
+  /* 110011001 */ V(1, 0, 3),
+  /* 110011010 */ V(1, 0, 3),
+  /* 110011011 */ V(1, 0, 3),
+  /* 110011100 */ V(1, 0, 3),
+  /* 110011101 */ V(1, 0, 3),
+  /* 110011110 */ V(1, 0, 3),
+  /* 110011111 */ V(1, 0, 3),
+  /* 110100000 */ V(1, 0, 3),
+  /* 110100001 */ V(1, 0, 3),
+  /* 110100010 */ V(1, 0, 3),
+  /* 110100011 */ V(1, 0, 3),
+  /* 110100100 */ V(1, 0, 3),
+  /* 110100101 */ V(1, 0, 3),
+  /* 110100110 */ V(1, 0, 3),
+  /* 110100111 */ V(1, 0, 3),
+  /* 110101000 */ V(1, 0, 3),
+  /* 110101001 */ V(1, 0, 3),
+  /* 110101010 */ V(1, 0, 3),
+  /* 110101011 */ V(1, 0, 3),
+  /* 110101100 */ V(1, 0, 3),
+  /* 110101101 */ V(1, 0, 3),
+  /* 110101110 */ V(1, 0, 3),
+  /* 110101111 */ V(1, 0, 3),
+  /* 110110000 */ V(1, 0, 3),
+  /* 110110001 */ V(1, 0, 3),
+  /* 110110010 */ V(1, 0, 3),
+  /* 110110011 */ V(1, 0, 3),
+  /* 110110100 */ V(1, 0, 3),
+  /* 110110101 */ V(1, 0, 3),
+  /* 110110110 */ V(1, 0, 3),
+  /* 110110111 */ V(1, 0, 3),
+  /* 110111000 */ V(1, 0, 3),
+  /* 110111001 */ V(1, 0, 3),
+  /* 110111010 */ V(1, 0, 3),
+  /* 110111011 */ V(1, 0, 3),
+  /* 110111100 */ V(1, 0, 3),
+  /* 110111101 */ V(1, 0, 3),
+  /* 110111110 */ V(1, 0, 3),
+  /* 110111111 */ V(1, 0, 3),
+  /* 111000000 */ V(0, 0, 3),
+  /* 111000001 */ V(0, 0, 3),
+  /* 111000010 */ V(0, 0, 3),
+  /* 111000011 */ V(0, 0, 3),
+  /* 111000100 */ V(0, 0, 3),
+  /* 111000101 */ V(0, 0, 3),
+  /* 111000110 */ V(0, 0, 3),
+  /* 111000111 */ V(0, 0, 3),
+  /* 111001000 */ V(0, 0, 3),
+  /* 111001001 */ V(0, 0, 3),
+  /* 111001010 */ V(0, 0, 3),
+  /* 111001011 */ V(0, 0, 3),
+  /* 111001100 */ V(0, 0, 3),
+  /* 111001101 */ V(0, 0, 3),
+  /* 111001110 */ V(0, 0, 3),
+  /* 111001111 */ V(0, 0, 3),
+  /* 111010000 */ V(0, 0, 3),
+  /* 111010001 */ V(0, 0, 3),
+  /* 111010010 */ V(0, 0, 3),
+  /* 111010011 */ V(0, 0, 3),
+  /* 111010100 */ V(0, 0, 3),
+  /* 111010101 */ V(0, 0, 3),
+  /* 111010110 */ V(0, 0, 3),
+  /* 111010111 */ V(0, 0, 3),
+  /* 111011000 */ V(0, 0, 3),
+  /* 111011001 */ V(0, 0, 3),
+  /* 111011010 */ V(0, 0, 3),
+  /* 111011011 */ V(0, 0, 3),
+  /* 111011100 */ V(0, 0, 3),
+  /* 111011101 */ V(0, 0, 3),
+  /* 111011110 */ V(0, 0, 3),
+  /* 111011111 */ V(0, 0, 3),
+  /* 111100000 */ V(0, 0, 3),
+  /* 111100001 */ V(0, 0, 3),
+  /* 111100010 */ V(0, 0, 3),
+  /* 111100011 */ V(0, 0, 3),
+  /* 111100100 */ V(0, 0, 3),
+  /* 111100101 */ V(0, 0, 3),
+  /* 111100110 */ V(0, 0, 3),
+  /* 111100111 */ V(0, 0, 3),
+  /* 111101000 */ V(0, 0, 3),
+  /* 111101001 */ V(0, 0, 3),
+  /* 111101010 */ V(0, 0, 3),
+  /* 111101011 */ V(0, 0, 3),
+  /* 111101100 */ V(0, 0, 3),
+  /* 111101101 */ V(0, 0, 3),
+  /* 111101110 */ V(0, 0, 3),
+  /* 111101111 */ V(0, 0, 3),
+  /* 111110000 */ V(0, 0, 3),
+  /* 111110001 */ V(0, 0, 3),
+  /* 111110010 */ V(0, 0, 3),
+  /* 111110011 */ V(0, 0, 3),
+  /* 111110100 */ V(0, 0, 3),
+  /* 111110101 */ V(0, 0, 3),
+  /* 111110110 */ V(0, 0, 3),
+  /* 111110111 */ V(0, 0, 3),
+  /* 111111000 */ V(0, 0, 3),
+  /* 111111001 */ V(0, 0, 3),
+  /* 111111010 */ V(0, 0, 3),
+  /* 111111011 */ V(0, 0, 3),
+  /* 111111100 */ V(0, 0, 3),
+  /* 111111101 */ V(0, 0, 3),
+  /* 111111110 */ V(0, 0, 3),
+  /* 111111111 */ V(0, 0, 3)
 };
 
 static
 union huffpair const hufftab10[] = {
-  /* 0000 */ PTR(16, 4),
-  /* 0001 */ PTR(32, 4),
-  /* 0010 */ PTR(48, 2),
-  /* 0011 */ V(1, 1, 4),
-  /* 0100 */ V(0, 1, 3),
-  /* 0101 */ V(0, 1, 3),
-  /* 0110 */ V(1, 0, 3),
-  /* 0111 */ V(1, 0, 3),
-  /* 1000 */ V(0, 0, 1),
-  /* 1001 */ V(0, 0, 1),
-  /* 1010 */ V(0, 0, 1),
-  /* 1011 */ V(0, 0, 1),
-  /* 1100 */ V(0, 0, 1),
-  /* 1101 */ V(0, 0, 1),
-  /* 1110 */ V(0, 0, 1),
-  /* 1111 */ V(0, 0, 1),
-
-  /* 0000 ... */
-  /* 0000 */ PTR(52, 3),	/* 16 */
-  /* 0001 */ PTR(60, 2),
-  /* 0010 */ PTR(64, 3),
-  /* 0011 */ PTR(72, 1),
-  /* 0100 */ PTR(74, 2),
-  /* 0101 */ PTR(78, 2),
-  /* 0110 */ PTR(82, 2),
-  /* 0111 */ V(1, 7, 4),
-  /* 1000 */ V(7, 1, 4),
-  /* 1001 */ PTR(86, 1),
-  /* 1010 */ PTR(88, 2),
-  /* 1011 */ PTR(92, 2),
-  /* 1100 */ V(1, 6, 4),
-  /* 1101 */ V(6, 1, 4),
-  /* 1110 */ V(6, 0, 4),
-  /* 1111 */ PTR(96, 1),
-
-  /* 0001 ... */
-  /* 0000 */ PTR(98, 1),	/* 32 */
-  /* 0001 */ PTR(100, 1),
-  /* 0010 */ V(1, 4, 4),
-  /* 0011 */ V(4, 1, 4),
-  /* 0100 */ V(4, 0, 4),
-  /* 0101 */ V(2, 3, 4),
-  /* 0110 */ V(3, 2, 4),
-  /* 0111 */ V(0, 3, 4),
-  /* 1000 */ V(1, 3, 3),
-  /* 1001 */ V(1, 3, 3),
-  /* 1010 */ V(3, 1, 3),
-  /* 1011 */ V(3, 1, 3),
-  /* 1100 */ V(3, 0, 3),
-  /* 1101 */ V(3, 0, 3),
-  /* 1110 */ V(2, 2, 3),
-  /* 1111 */ V(2, 2, 3),
-
-  /* 0010 ... */
-  /* 00   */ V(1, 2, 2),	/* 48 */
-  /* 01   */ V(2, 1, 2),
-  /* 10   */ V(0, 2, 2),
-  /* 11   */ V(2, 0, 2),
-
-  /* 0000 0000 ... */
-  /* 000  */ V(7, 7, 3),	/* 52 */
-  /* 001  */ V(6, 7, 3),
-  /* 010  */ V(7, 6, 3),
-  /* 011  */ V(5, 7, 3),
-  /* 100  */ V(7, 5, 3),
-  /* 101  */ V(6, 6, 3),
-  /* 110  */ V(4, 7, 2),
-  /* 111  */ V(4, 7, 2),
-
-  /* 0000 0001 ... */
-  /* 00   */ V(7, 4, 2),	/* 60 */
-  /* 01   */ V(5, 6, 2),
-  /* 10   */ V(6, 5, 2),
-  /* 11   */ V(3, 7, 2),
-
-  /* 0000 0010 ... */
-  /* 000  */ V(7, 3, 2),	/* 64 */
-  /* 001  */ V(7, 3, 2),
-  /* 010  */ V(4, 6, 2),
-  /* 011  */ V(4, 6, 2),
-  /* 100  */ V(5, 5, 3),
-  /* 101  */ V(5, 4, 3),
-  /* 110  */ V(6, 3, 2),
-  /* 111  */ V(6, 3, 2),
-
-  /* 0000 0011 ... */
-  /* 0    */ V(2, 7, 1),	/* 72 */
-  /* 1    */ V(7, 2, 1),
-
-  /* 0000 0100 ... */
-  /* 00   */ V(6, 4, 2),	/* 74 */
-  /* 01   */ V(0, 7, 2),
-  /* 10   */ V(7, 0, 1),
-  /* 11   */ V(7, 0, 1),
-
-  /* 0000 0101 ... */
-  /* 00   */ V(6, 2, 1),	/* 78 */
-  /* 01   */ V(6, 2, 1),
-  /* 10   */ V(4, 5, 2),
-  /* 11   */ V(3, 5, 2),
-
-  /* 0000 0110 ... */
-  /* 00   */ V(0, 6, 1),	/* 82 */
-  /* 01   */ V(0, 6, 1),
-  /* 10   */ V(5, 3, 2),
-  /* 11   */ V(4, 4, 2),
-
-  /* 0000 1001 ... */
-  /* 0    */ V(3, 6, 1),	/* 86 */
-  /* 1    */ V(2, 6, 1),
-
-  /* 0000 1010 ... */
-  /* 00   */ V(2, 5, 2),	/* 88 */
-  /* 01   */ V(5, 2, 2),
-  /* 10   */ V(1, 5, 1),
-  /* 11   */ V(1, 5, 1),
-
-  /* 0000 1011 ... */
-  /* 00   */ V(5, 1, 1),	/* 92 */
-  /* 01   */ V(5, 1, 1),
-  /* 10   */ V(3, 4, 2),
-  /* 11   */ V(4, 3, 2),
-
-  /* 0000 1111 ... */
-  /* 0    */ V(0, 5, 1),	/* 96 */
-  /* 1    */ V(5, 0, 1),
-
-  /* 0001 0000 ... */
-  /* 0    */ V(2, 4, 1),	/* 98 */
-  /* 1    */ V(4, 2, 1),
-
-  /* 0001 0001 ... */
-  /* 0    */ V(3, 3, 1),	/* 100 */
-  /* 1    */ V(0, 4, 1)
-};
-
-static
-union huffpair const hufftab11[] = {
-  /* 0000 */ PTR(16, 4),
-  /* 0001 */ PTR(32, 4),
-  /* 0010 */ PTR(48, 4),
-  /* 0011 */ PTR(64, 3),
-  /* 0100 */ V(1, 2, 4),
-  /* 0101 */ PTR(72, 1),
-  /* 0110 */ V(1, 1, 3),
-  /* 0111 */ V(1, 1, 3),
-  /* 1000 */ V(0, 1, 3),
-  /* 1001 */ V(0, 1, 3),
-  /* 1010 */ V(1, 0, 3),
-  /* 1011 */ V(1, 0, 3),
-  /* 1100 */ V(0, 0, 2),
-  /* 1101 */ V(0, 0, 2),
-  /* 1110 */ V(0, 0, 2),
-  /* 1111 */ V(0, 0, 2),
-
-  /* 0000 ... */
-  /* 0000 */ PTR(74, 2),	/* 16 */
-  /* 0001 */ PTR(78, 3),
-  /* 0010 */ PTR(86, 2),
-  /* 0011 */ PTR(90, 1),
-  /* 0100 */ PTR(92, 2),
-  /* 0101 */ V(2, 7, 4),
-  /* 0110 */ V(7, 2, 4),
-  /* 0111 */ PTR(96, 1),
-  /* 1000 */ V(7, 1, 3),
-  /* 1001 */ V(7, 1, 3),
-  /* 1010 */ V(1, 7, 4),
-  /* 1011 */ V(7, 0, 4),
-  /* 1100 */ V(3, 6, 4),
-  /* 1101 */ V(6, 3, 4),
-  /* 1110 */ V(6, 0, 4),
-  /* 1111 */ PTR(98, 1),
-
-  /* 0001 ... */
-  /* 0000 */ PTR(100, 1),	/* 32 */
-  /* 0001 */ V(1, 5, 4),
-  /* 0010 */ V(6, 2, 3),
-  /* 0011 */ V(6, 2, 3),
-  /* 0100 */ V(2, 6, 4),
-  /* 0101 */ V(0, 6, 4),
-  /* 0110 */ V(1, 6, 3),
-  /* 0111 */ V(1, 6, 3),
-  /* 1000 */ V(6, 1, 3),
-  /* 1001 */ V(6, 1, 3),
-  /* 1010 */ V(5, 1, 4),
-  /* 1011 */ V(3, 4, 4),
-  /* 1100 */ V(5, 0, 4),
-  /* 1101 */ PTR(102, 1),
-  /* 1110 */ V(2, 4, 4),
-  /* 1111 */ V(4, 2, 4),
-
-  /* 0010 ... */
-  /* 0000 */ V(1, 4, 4),	/* 48 */
-  /* 0001 */ V(4, 1, 4),
-  /* 0010 */ V(0, 4, 4),
-  /* 0011 */ V(4, 0, 4),
-  /* 0100 */ V(2, 3, 3),
-  /* 0101 */ V(2, 3, 3),
-  /* 0110 */ V(3, 2, 3),
-  /* 0111 */ V(3, 2, 3),
-  /* 1000 */ V(1, 3, 2),
-  /* 1001 */ V(1, 3, 2),
-  /* 1010 */ V(1, 3, 2),
-  /* 1011 */ V(1, 3, 2),
-  /* 1100 */ V(3, 1, 2),
-  /* 1101 */ V(3, 1, 2),
-  /* 1110 */ V(3, 1, 2),
-  /* 1111 */ V(3, 1, 2),
-
-  /* 0011 ... */
-  /* 000  */ V(0, 3, 3),	/* 64 */
-  /* 001  */ V(3, 0, 3),
-  /* 010  */ V(2, 2, 2),
-  /* 011  */ V(2, 2, 2),
-  /* 100  */ V(2, 1, 1),
-  /* 101  */ V(2, 1, 1),
-  /* 110  */ V(2, 1, 1),
-  /* 111  */ V(2, 1, 1),
-
-  /* 0101 ... */
-  /* 0    */ V(0, 2, 1),	/* 72 */
-  /* 1    */ V(2, 0, 1),
-
-  /* 0000 0000 ... */
-  /* 00   */ V(7, 7, 2),	/* 74 */
-  /* 01   */ V(6, 7, 2),
-  /* 10   */ V(7, 6, 2),
-  /* 11   */ V(7, 5, 2),
-
-  /* 0000 0001 ... */
-  /* 000  */ V(6, 6, 2),	/* 78 */
-  /* 001  */ V(6, 6, 2),
-  /* 010  */ V(4, 7, 2),
-  /* 011  */ V(4, 7, 2),
-  /* 100  */ V(7, 4, 2),
-  /* 101  */ V(7, 4, 2),
-  /* 110  */ V(5, 7, 3),
-  /* 111  */ V(5, 5, 3),
-
-  /* 0000 0010 ... */
-  /* 00   */ V(5, 6, 2),	/* 86 */
-  /* 01   */ V(6, 5, 2),
-  /* 10   */ V(3, 7, 1),
-  /* 11   */ V(3, 7, 1),
-
-  /* 0000 0011 ... */
-  /* 0    */ V(7, 3, 1),	/* 90 */
-  /* 1    */ V(4, 6, 1),
-
-  /* 0000 0100 ... */
-  /* 00   */ V(4, 5, 2),	/* 92 */
-  /* 01   */ V(5, 4, 2),
-  /* 10   */ V(3, 5, 2),
-  /* 11   */ V(5, 3, 2),
+  /* 0000000000 */ PTR(1024, 1),
+  /* 0000000001 */ PTR(1026, 1),
+  /* 0000000010 */ PTR(1028, 1),
+  /* 0000000011 */ V(4, 7, 10),
+  /* 0000000100 */ V(7, 4, 10),
+  /* 0000000101 */ V(5, 6, 10),
+  /* 0000000110 */ V(6, 5, 10),
+  /* 0000000111 */ V(3, 7, 10),
+  /* 0000001000 */ V(7, 3, 10),
+  /* 0000001001 */ V(4, 6, 10),
+  /* 0000001010 */ PTR(1030, 1),
+  /* 0000001011 */ V(6, 3, 10),
+  /* 0000001100 */ V(2, 7, 9),
+  /* 0000001101 */ V(2, 7, 9),
+  /* 0000001110 */ V(7, 2, 9),
+  /* 0000001111 */ V(7, 2, 9),
+  /* 0000010000 */ V(6, 4, 10),
+  /* 0000010001 */ V(0, 7, 10),
+  /* 0000010010 */ V(7, 0, 9),
+  /* 0000010011 */ V(7, 0, 9),
+  /* 0000010100 */ V(6, 2, 9),
+  /* 0000010101 */ V(6, 2, 9),
+  /* 0000010110 */ V(4, 5, 10),
+  /* 0000010111 */ V(3, 5, 10),
+  /* 0000011000 */ V(0, 6, 9),
+  /* 0000011001 */ V(0, 6, 9),
+  /* 0000011010 */ V(5, 3, 10),
+  /* 0000011011 */ V(4, 4, 10),
+  /* 0000011100 */ V(1, 7, 8),
+  /* 0000011101 */ V(1, 7, 8),
+  /* 0000011110 */ V(1, 7, 8),
+  /* 0000011111 */ V(1, 7, 8),
+  /* 0000100000 */ V(7, 1, 8),
+  /* 0000100001 */ V(7, 1, 8),
+  /* 0000100010 */ V(7, 1, 8),
+  /* 0000100011 */ V(7, 1, 8),
+  /* 0000100100 */ V(3, 6, 9),
+  /* 0000100101 */ V(3, 6, 9),
+  /* 0000100110 */ V(2, 6, 9),
+  /* 0000100111 */ V(2, 6, 9),
+  /* 0000101000 */ V(2, 5, 10),
+  /* 0000101001 */ V(5, 2, 10),
+  /* 0000101010 */ V(1, 5, 9),
+  /* 0000101011 */ V(1, 5, 9),
+  /* 0000101100 */ V(5, 1, 9),
+  /* 0000101101 */ V(5, 1, 9),
+  /* 0000101110 */ V(3, 4, 10),
+  /* 0000101111 */ V(4, 3, 10),
+  /* 0000110000 */ V(1, 6, 8),
+  /* 0000110001 */ V(1, 6, 8),
+  /* 0000110010 */ V(1, 6, 8),
+  /* 0000110011 */ V(1, 6, 8),
+  /* 0000110100 */ V(6, 1, 8),
+  /* 0000110101 */ V(6, 1, 8),
+  /* 0000110110 */ V(6, 1, 8),
+  /* 0000110111 */ V(6, 1, 8),
+  /* 0000111000 */ V(6, 0, 8),
+  /* 0000111001 */ V(6, 0, 8),
+  /* 0000111010 */ V(6, 0, 8),
+  /* 0000111011 */ V(6, 0, 8),
+  /* 0000111100 */ V(0, 5, 9),
+  /* 0000111101 */ V(0, 5, 9),
+  /* 0000111110 */ V(5, 0, 9),
+  /* 0000111111 */ V(5, 0, 9),
+  /* 0001000000 */ V(2, 4, 9),
+  /* 0001000001 */ V(2, 4, 9),
+  /* 0001000010 */ V(4, 2, 9),
+  /* 0001000011 */ V(4, 2, 9),
+  /* 0001000100 */ V(3, 3, 9),
+  /* 0001000101 */ V(3, 3, 9),
+  /* 0001000110 */ V(0, 4, 9),
+  /* 0001000111 */ V(0, 4, 9),
+  /* 0001001000 */ V(1, 4, 8),
+  /* 0001001001 */ V(1, 4, 8),
+  /* 0001001010 */ V(1, 4, 8),
+  /* 0001001011 */ V(1, 4, 8),
+  /* 0001001100 */ V(4, 1, 8),
+  /* 0001001101 */ V(4, 1, 8),
+  /* 0001001110 */ V(4, 1, 8),
+  /* 0001001111 */ V(4, 1, 8),
+  /* 0001010000 */ V(4, 0, 8),
+  /* 0001010001 */ V(4, 0, 8),
+  /* 0001010010 */ V(4, 0, 8),
+  /* 0001010011 */ V(4, 0, 8),
+  /* 0001010100 */ V(2, 3, 8),
+  /* 0001010101 */ V(2, 3, 8),
+  /* 0001010110 */ V(2, 3, 8),
+  /* 0001010111 */ V(2, 3, 8),
+  /* 0001011000 */ V(3, 2, 8),
+  /* 0001011001 */ V(3, 2, 8),
+  /* 0001011010 */ V(3, 2, 8),
+  /* 0001011011 */ V(3, 2, 8),
+  /* 0001011100 */ V(0, 3, 8),
+  /* 0001011101 */ V(0, 3, 8),
+  /* 0001011110 */ V(0, 3, 8),
+  /* 0001011111 */ V(0, 3, 8),
+  /* 0001100000 */ V(1, 3, 7),
+  /* 0001100001 */ V(1, 3, 7),
+  /* 0001100010 */ V(1, 3, 7),
+  /* 0001100011 */ V(1, 3, 7),
+  /* 0001100100 */ V(1, 3, 7),
+  /* 0001100101 */ V(1, 3, 7),
+  /* 0001100110 */ V(1, 3, 7),
+  /* 0001100111 */ V(1, 3, 7),
+  /* 0001101000 */ V(3, 1, 7),
+  /* 0001101001 */ V(3, 1, 7),
+  /* 0001101010 */ V(3, 1, 7),
+  /* 0001101011 */ V(3, 1, 7),
+  /* 0001101100 */ V(3, 1, 7),
+  /* 0001101101 */ V(3, 1, 7),
+  /* 0001101110 */ V(3, 1, 7),
+  /* 0001101111 */ V(3, 1, 7),
+  /* 0001110000 */ V(3, 0, 7),
+  /* 0001110001 */ V(3, 0, 7),
+  /* 0001110010 */ V(3, 0, 7),
+  /* 0001110011 */ V(3, 0, 7),
+  /* 0001110100 */ V(3, 0, 7),
+  /* 0001110101 */ V(3, 0, 7),
+  /* 0001110110 */ V(3, 0, 7),
+  /* 0001110111 */ V(3, 0, 7),
+  /* 0001111000 */ V(2, 2, 7),
+  /* 0001111001 */ V(2, 2, 7),
+  /* 0001111010 */ V(2, 2, 7),
+  /* 0001111011 */ V(2, 2, 7),
+  /* 0001111100 */ V(2, 2, 7),
+  /* 0001111101 */ V(2, 2, 7),
+  /* 0001111110 */ V(2, 2, 7),
+  /* 0001111111 */ V(2, 2, 7),
+  /* 0010000000 */ V(1, 2, 6),
+  /* 0010000001 */ V(1, 2, 6),
+  /* 0010000010 */ V(1, 2, 6),
+  /* 0010000011 */ V(1, 2, 6),
+  /* 0010000100 */ V(1, 2, 6),
+  /* 0010000101 */ V(1, 2, 6),
+  /* 0010000110 */ V(1, 2, 6),
+  /* 0010000111 */ V(1, 2, 6),
+  /* 0010001000 */ V(1, 2, 6),
+  /* 0010001001 */ V(1, 2, 6),
+  /* 0010001010 */ V(1, 2, 6),
+  /* 0010001011 */ V(1, 2, 6),
+  /* 0010001100 */ V(1, 2, 6),
+  /* 0010001101 */ V(1, 2, 6),
+  /* 0010001110 */ V(1, 2, 6),
+  /* 0010001111 */ V(1, 2, 6),
+  /* 0010010000 */ V(2, 1, 6),
+  /* 0010010001 */ V(2, 1, 6),
+  /* 0010010010 */ V(2, 1, 6),
+  /* 0010010011 */ V(2, 1, 6),
+  /* 0010010100 */ V(2, 1, 6),
+  /* 0010010101 */ V(2, 1, 6),
+  /* 0010010110 */ V(2, 1, 6),
+  /* 0010010111 */ V(2, 1, 6),
+  /* 0010011000 */ V(2, 1, 6),
+  /* 0010011001 */ V(2, 1, 6),
+  /* 0010011010 */ V(2, 1, 6),
+  /* 0010011011 */ V(2, 1, 6),
+  /* 0010011100 */ V(2, 1, 6),
+  /* 0010011101 */ V(2, 1, 6),
+  /* 0010011110 */ V(2, 1, 6),
+  /* 0010011111 */ V(2, 1, 6),
+  /* 0010100000 */ V(0, 2, 6),
+  /* 0010100001 */ V(0, 2, 6),
+  /* 0010100010 */ V(0, 2, 6),
+  /* 0010100011 */ V(0, 2, 6),
+  /* 0010100100 */ V(0, 2, 6),
+  /* 0010100101 */ V(0, 2, 6),
+  /* 0010100110 */ V(0, 2, 6),
+  /* 0010100111 */ V(0, 2, 6),
+  /* 0010101000 */ V(0, 2, 6),
+  /* 0010101001 */ V(0, 2, 6),
+  /* 0010101010 */ V(0, 2, 6),
+  /* 0010101011 */ V(0, 2, 6),
+  /* 0010101100 */ V(0, 2, 6),
+  /* 0010101101 */ V(0, 2, 6),
+  /* 0010101110 */ V(0, 2, 6),
+  /* 0010101111 */ V(0, 2, 6),
+  /* 0010110000 */ V(2, 0, 6),
+  /* 0010110001 */ V(2, 0, 6),
+  /* 0010110010 */ V(2, 0, 6),
+  /* 0010110011 */ V(2, 0, 6),
+  /* 0010110100 */ V(2, 0, 6),
+  /* 0010110101 */ V(2, 0, 6),
+  /* 0010110110 */ V(2, 0, 6),
+  /* 0010110111 */ V(2, 0, 6),
+  /* 0010111000 */ V(2, 0, 6),
+  /* 0010111001 */ V(2, 0, 6),
+  /* 0010111010 */ V(2, 0, 6),
+  /* 0010111011 */ V(2, 0, 6),
+  /* 0010111100 */ V(2, 0, 6),
+  /* 0010111101 */ V(2, 0, 6),
+  /* 0010111110 */ V(2, 0, 6),
+  /* 0010111111 */ V(2, 0, 6),
+  /* 0011000000 */ V(1, 1, 4),
+  /* 0011000001 */ V(1, 1, 4),
+  /* 0011000010 */ V(1, 1, 4),
+  /* 0011000011 */ V(1, 1, 4),
+  /* 0011000100 */ V(1, 1, 4),
+  /* 0011000101 */ V(1, 1, 4),
+  /* 0011000110 */ V(1, 1, 4),
+  /* 0011000111 */ V(1, 1, 4),
+  /* 0011001000 */ V(1, 1, 4),
+  /* 0011001001 */ V(1, 1, 4),
+  /* 0011001010 */ V(1, 1, 4),
+  /* 0011001011 */ V(1, 1, 4),
+  /* 0011001100 */ V(1, 1, 4),
+  /* 0011001101 */ V(1, 1, 4),
+  /* 0011001110 */ V(1, 1, 4),
+  /* 0011001111 */ V(1, 1, 4),
+  /* 0011010000 */ V(1, 1, 4),
+  /* 0011010001 */ V(1, 1, 4),
+  /* 0011010010 */ V(1, 1, 4),
+  /* 0011010011 */ V(1, 1, 4),
+  /* 0011010100 */ V(1, 1, 4),
+  /* 0011010101 */ V(1, 1, 4),
+  /* 0011010110 */ V(1, 1, 4),
+  /* 0011010111 */ V(1, 1, 4),
+  /* 0011011000 */ V(1, 1, 4),
+  /* 0011011001 */ V(1, 1, 4),
+  /* 0011011010 */ V(1, 1, 4),
+  /* 0011011011 */ V(1, 1, 4),
+  /* 0011011100 */ V(1, 1, 4),
+  /* 0011011101 */ V(1, 1, 4),
+  /* 0011011110 */ V(1, 1, 4),
+  /* 0011011111 */ V(1, 1, 4),
+  /* 0011100000 */ V(1, 1, 4),
+  /* 0011100001 */ V(1, 1, 4),
+  /* 0011100010 */ V(1, 1, 4),
+  /* 0011100011 */ V(1, 1, 4),
+  /* 0011100100 */ V(1, 1, 4),
+  /* 0011100101 */ V(1, 1, 4),
+  /* 0011100110 */ V(1, 1, 4),
+  /* 0011100111 */ V(1, 1, 4),
+  /* 0011101000 */ V(1, 1, 4),
+  /* 0011101001 */ V(1, 1, 4),
+  /* 0011101010 */ V(1, 1, 4),
+  /* 0011101011 */ V(1, 1, 4),
+  /* 0011101100 */ V(1, 1, 4),
+  /* 0011101101 */ V(1, 1, 4),
+  /* 0011101110 */ V(1, 1, 4),
+  /* 0011101111 */ V(1, 1, 4),
+  /* 0011110000 */ V(1, 1, 4),
+  /* 0011110001 */ V(1, 1, 4),
+  /* 0011110010 */ V(1, 1, 4),
+  /* 0011110011 */ V(1, 1, 4),
+  /* 0011110100 */ V(1, 1, 4),
+  /* 0011110101 */ V(1, 1, 4),
+  /* 0011110110 */ V(1, 1, 4),
+  /* 0011110111 */ V(1, 1, 4),
+  /* 0011111000 */ V(1, 1, 4),
+  /* 0011111001 */ V(1, 1, 4),
+  /* 0011111010 */ V(1, 1, 4),
+  /* 0011111011 */ V(1, 1, 4),
+  /* 0011111100 */ V(1, 1, 4),
+  /* 0011111101 */ V(1, 1, 4),
+  /* 0011111110 */ V(1, 1, 4),
+  /* 0011111111 */ V(1, 1, 4),
+  /* 0100000000 */ V(0, 1, 3),
+  /* 0100000001 */ V(0, 1, 3),
+  /* 0100000010 */ V(0, 1, 3),
+  /* 0100000011 */ V(0, 1, 3),
+  /* 0100000100 */ V(0, 1, 3),
+  /* 0100000101 */ V(0, 1, 3),
+  /* 0100000110 */ V(0, 1, 3),
+  /* 0100000111 */ V(0, 1, 3),
+  /* 0100001000 */ V(0, 1, 3),
+  /* 0100001001 */ V(0, 1, 3),
+  /* 0100001010 */ V(0, 1, 3),
+  /* 0100001011 */ V(0, 1, 3),
+  /* 0100001100 */ V(0, 1, 3),
+  /* 0100001101 */ V(0, 1, 3),
+  /* 0100001110 */ V(0, 1, 3),
+  /* 0100001111 */ V(0, 1, 3),
+  /* 0100010000 */ V(0, 1, 3),
+  /* 0100010001 */ V(0, 1, 3),
+  /* 0100010010 */ V(0, 1, 3),
+  /* 0100010011 */ V(0, 1, 3),
+  /* 0100010100 */ V(0, 1, 3),
+  /* 0100010101 */ V(0, 1, 3),
+  /* 0100010110 */ V(0, 1, 3),
+  /* 0100010111 */ V(0, 1, 3),
+  /* 0100011000 */ V(0, 1, 3),
+  /* 0100011001 */ V(0, 1, 3),
+  /* 0100011010 */ V(0, 1, 3),
+  /* 0100011011 */ V(0, 1, 3),
+  /* 0100011100 */ V(0, 1, 3),
+  /* 0100011101 */ V(0, 1, 3),
+  /* 0100011110 */ V(0, 1, 3),
+  /* 0100011111 */ V(0, 1, 3),
+  /* 0100100000 */ V(0, 1, 3),
+  /* 0100100001 */ V(0, 1, 3),
+  /* 0100100010 */ V(0, 1, 3),
+  /* 0100100011 */ V(0, 1, 3),
+  /* 0100100100 */ V(0, 1, 3),
+  /* 0100100101 */ V(0, 1, 3),
+  /* 0100100110 */ V(0, 1, 3),
+  /* 0100100111 */ V(0, 1, 3),
+  /* 0100101000 */ V(0, 1, 3),
+  /* 0100101001 */ V(0, 1, 3),
+  /* 0100101010 */ V(0, 1, 3),
+  /* 0100101011 */ V(0, 1, 3),
+  /* 0100101100 */ V(0, 1, 3),
+  /* 0100101101 */ V(0, 1, 3),
+  /* 0100101110 */ V(0, 1, 3),
+  /* 0100101111 */ V(0, 1, 3),
+  /* 0100110000 */ V(0, 1, 3),
+  /* 0100110001 */ V(0, 1, 3),
+  /* 0100110010 */ V(0, 1, 3),
+  /* 0100110011 */ V(0, 1, 3),
+  /* 0100110100 */ V(0, 1, 3),
+  /* 0100110101 */ V(0, 1, 3),
+  /* 0100110110 */ V(0, 1, 3),
+  /* 0100110111 */ V(0, 1, 3),
+  /* 0100111000 */ V(0, 1, 3),
+  /* 0100111001 */ V(0, 1, 3),
+  /* 0100111010 */ V(0, 1, 3),
+  /* 0100111011 */ V(0, 1, 3),
+  /* 0100111100 */ V(0, 1, 3),
+  /* 0100111101 */ V(0, 1, 3),
+  /* 0100111110 */ V(0, 1, 3),
+  /* 0100111111 */ V(0, 1, 3),
+  /* 0101000000 */ V(0, 1, 3),
+  /* 0101000001 */ V(0, 1, 3),
+  /* 0101000010 */ V(0, 1, 3),
+  /* 0101000011 */ V(0, 1, 3),
+  /* 0101000100 */ V(0, 1, 3),
+  /* 0101000101 */ V(0, 1, 3),
+  /* 0101000110 */ V(0, 1, 3),
+  /* 0101000111 */ V(0, 1, 3),
+  /* 0101001000 */ V(0, 1, 3),
+  /* 0101001001 */ V(0, 1, 3),
+  /* 0101001010 */ V(0, 1, 3),
+  /* 0101001011 */ V(0, 1, 3),
+  /* 0101001100 */ V(0, 1, 3),
+  /* 0101001101 */ V(0, 1, 3),
+  /* 0101001110 */ V(0, 1, 3),
+  /* 0101001111 */ V(0, 1, 3),
+  /* 0101010000 */ V(0, 1, 3),
+  /* 0101010001 */ V(0, 1, 3),
+  /* 0101010010 */ V(0, 1, 3),
+  /* 0101010011 */ V(0, 1, 3),
+  /* 0101010100 */ V(0, 1, 3),
+  /* 0101010101 */ V(0, 1, 3),
+  /* 0101010110 */ V(0, 1, 3),
+  /* 0101010111 */ V(0, 1, 3),
+  /* 0101011000 */ V(0, 1, 3),
+  /* 0101011001 */ V(0, 1, 3),
+  /* 0101011010 */ V(0, 1, 3),
+  /* 0101011011 */ V(0, 1, 3),
+  /* 0101011100 */ V(0, 1, 3),
+  /* 0101011101 */ V(0, 1, 3),
+  /* 0101011110 */ V(0, 1, 3),
+  /* 0101011111 */ V(0, 1, 3),
+  /* 0101100000 */ V(0, 1, 3),
+  /* 0101100001 */ V(0, 1, 3),
+  /* 0101100010 */ V(0, 1, 3),
+  /* 0101100011 */ V(0, 1, 3),
+  /* 0101100100 */ V(0, 1, 3),
+  /* 0101100101 */ V(0, 1, 3),
+  /* 0101100110 */ V(0, 1, 3),
+  /* 0101100111 */ V(0, 1, 3),
+  /* 0101101000 */ V(0, 1, 3),
+  /* 0101101001 */ V(0, 1, 3),
+  /* 0101101010 */ V(0, 1, 3),
+  /* 0101101011 */ V(0, 1, 3),
+  /* 0101101100 */ V(0, 1, 3),
+  /* 0101101101 */ V(0, 1, 3),
+  /* 0101101110 */ V(0, 1, 3),
+  /* 0101101111 */ V(0, 1, 3),
+  /* 0101110000 */ V(0, 1, 3),
+  /* 0101110001 */ V(0, 1, 3),
+  /* 0101110010 */ V(0, 1, 3),
+  /* 0101110011 */ V(0, 1, 3),
+  /* 0101110100 */ V(0, 1, 3),
+  /* 0101110101 */ V(0, 1, 3),
+  /* 0101110110 */ V(0, 1, 3),
+  /* 0101110111 */ V(0, 1, 3),
+  /* 0101111000 */ V(0, 1, 3),
+  /* 0101111001 */ V(0, 1, 3),
+  /* 0101111010 */ V(0, 1, 3),
+  /* 0101111011 */ V(0, 1, 3),
+  /* 0101111100 */ V(0, 1, 3),
+  /* 0101111101 */ V(0, 1, 3),
+  /* 0101111110 */ V(0, 1, 3),
+  /* 0101111111 */ V(0, 1, 3),
+  /* 0110000000 */ V(1, 0, 3),
+  /* 0110000001 */ V(1, 0, 3),
+  /* 0110000010 */ V(1, 0, 3),
+  /* 0110000011 */ V(1, 0, 3),
+  /* 0110000100 */ V(1, 0, 3),
+  /* 0110000101 */ V(1, 0, 3),
+  /* 0110000110 */ V(1, 0, 3),
+  /* 0110000111 */ V(1, 0, 3),
+  /* 0110001000 */ V(1, 0, 3),
+  /* 0110001001 */ V(1, 0, 3),
+  /* 0110001010 */ V(1, 0, 3),
+  /* 0110001011 */ V(1, 0, 3),
+  /* 0110001100 */ V(1, 0, 3),
+  /* 0110001101 */ V(1, 0, 3),
+  /* 0110001110 */ V(1, 0, 3),
+  /* 0110001111 */ V(1, 0, 3),
+  /* 0110010000 */ V(1, 0, 3),
+  /* 0110010001 */ V(1, 0, 3),
+  /* 0110010010 */ V(1, 0, 3),
+  /* 0110010011 */ V(1, 0, 3),
+  /* 0110010100 */ V(1, 0, 3),
+  /* 0110010101 */ V(1, 0, 3),
+  /* 0110010110 */ V(1, 0, 3),
+  /* 0110010111 */ V(1, 0, 3),
+  /* 0110011000 */ V(1, 0, 3),
+  /* 0110011001 */ V(1, 0, 3),
+  /* 0110011010 */ V(1, 0, 3),
+  /* 0110011011 */ V(1, 0, 3),
+  /* 0110011100 */ V(1, 0, 3),
+  /* 0110011101 */ V(1, 0, 3),
+  /* 0110011110 */ V(1, 0, 3),
+  /* 0110011111 */ V(1, 0, 3),
+  /* 0110100000 */ V(1, 0, 3),
+  /* 0110100001 */ V(1, 0, 3),
+  /* 0110100010 */ V(1, 0, 3),
+  /* 0110100011 */ V(1, 0, 3),
+  /* 0110100100 */ V(1, 0, 3),
+  /* 0110100101 */ V(1, 0, 3),
+  /* 0110100110 */ V(1, 0, 3),
+  /* 0110100111 */ V(1, 0, 3),
+  /* 0110101000 */ V(1, 0, 3),
+  /* 0110101001 */ V(1, 0, 3),
+  /* 0110101010 */ V(1, 0, 3),
+  /* 0110101011 */ V(1, 0, 3),
+  /* 0110101100 */ V(1, 0, 3),
+  /* 0110101101 */ V(1, 0, 3),
+  /* 0110101110 */ V(1, 0, 3),
+  /* 0110101111 */ V(1, 0, 3),
+  /* 0110110000 */ V(1, 0, 3),
+  /* 0110110001 */ V(1, 0, 3),
+  /* 0110110010 */ V(1, 0, 3),
+  /* 0110110011 */ V(1, 0, 3),
+  /* 0110110100 */ V(1, 0, 3),
+  /* 0110110101 */ V(1, 0, 3),
+  /* 0110110110 */ V(1, 0, 3),
+  /* 0110110111 */ V(1, 0, 3),
+  /* 0110111000 */ V(1, 0, 3),
+  /* 0110111001 */ V(1, 0, 3),
+  /* 0110111010 */ V(1, 0, 3),
+  /* 0110111011 */ V(1, 0, 3),
+  /* 0110111100 */ V(1, 0, 3),
+  /* 0110111101 */ V(1, 0, 3),
+  /* 0110111110 */ V(1, 0, 3),
+  /* 0110111111 */ V(1, 0, 3),
+  /* 0111000000 */ V(1, 0, 3),
+  /* 0111000001 */ V(1, 0, 3),
+  /* 0111000010 */ V(1, 0, 3),
+  /* 0111000011 */ V(1, 0, 3),
+  /* 0111000100 */ V(1, 0, 3),
+  /* 0111000101 */ V(1, 0, 3),
+  /* 0111000110 */ V(1, 0, 3),
+  /* 0111000111 */ V(1, 0, 3),
+  /* 0111001000 */ V(1, 0, 3),
+  /* 0111001001 */ V(1, 0, 3),
+  /* 0111001010 */ V(1, 0, 3),
+  /* 0111001011 */ V(1, 0, 3),
+  /* 0111001100 */ V(1, 0, 3),
+  /* 0111001101 */ V(1, 0, 3),
+  /* 0111001110 */ V(1, 0, 3),
+  /* 0111001111 */ V(1, 0, 3),
+  /* 0111010000 */ V(1, 0, 3),
+  /* 0111010001 */ V(1, 0, 3),
+  /* 0111010010 */ V(1, 0, 3),
+  /* 0111010011 */ V(1, 0, 3),
+  /* 0111010100 */ V(1, 0, 3),
+  /* 0111010101 */ V(1, 0, 3),
+  /* 0111010110 */ V(1, 0, 3),
+  /* 0111010111 */ V(1, 0, 3),
+  /* 0111011000 */ V(1, 0, 3),
+  /* 0111011001 */ V(1, 0, 3),
+  /* 0111011010 */ V(1, 0, 3),
+  /* 0111011011 */ V(1, 0, 3),
+  /* 0111011100 */ V(1, 0, 3),
+  /* 0111011101 */ V(1, 0, 3),
+  /* 0111011110 */ V(1, 0, 3),
+  /* 0111011111 */ V(1, 0, 3),
+  /* 0111100000 */ V(1, 0, 3),
+  /* 0111100001 */ V(1, 0, 3),
+  /* 0111100010 */ V(1, 0, 3),
+  /* 0111100011 */ V(1, 0, 3),
+  /* 0111100100 */ V(1, 0, 3),
+  /* 0111100101 */ V(1, 0, 3),
+  /* 0111100110 */ V(1, 0, 3),
+  /* 0111100111 */ V(1, 0, 3),
+  /* 0111101000 */ V(1, 0, 3),
+  /* 0111101001 */ V(1, 0, 3),
+  /* 0111101010 */ V(1, 0, 3),
+  /* 0111101011 */ V(1, 0, 3),
+  /* 0111101100 */ V(1, 0, 3),
+  /* 0111101101 */ V(1, 0, 3),
+  /* 0111101110 */ V(1, 0, 3),
+  /* 0111101111 */ V(1, 0, 3),
+  /* 0111110000 */ V(1, 0, 3),
+  /* 0111110001 */ V(1, 0, 3),
+  /* 0111110010 */ V(1, 0, 3),
+  /* 0111110011 */ V(1, 0, 3),
+  /* 0111110100 */ V(1, 0, 3),
+  /* 0111110101 */ V(1, 0, 3),
+  /* 0111110110 */ V(1, 0, 3),
+  /* 0111110111 */ V(1, 0, 3),
+  /* 0111111000 */ V(1, 0, 3),
+  /* 0111111001 */ V(1, 0, 3),
+  /* 0111111010 */ V(1, 0, 3),
+  /* 0111111011 */ V(1, 0, 3),
+  /* 0111111100 */ V(1, 0, 3),
+  /* 0111111101 */ V(1, 0, 3),
+  /* 0111111110 */ V(1, 0, 3),
+  /* 0111111111 */ V(1, 0, 3),
+  /* 1000000000 */ V(0, 0, 1),
+  /* 1000000001 */ V(0, 0, 1),
+  /* 1000000010 */ V(0, 0, 1),
+  /* 1000000011 */ V(0, 0, 1),
+  /* 1000000100 */ V(0, 0, 1),
+  /* 1000000101 */ V(0, 0, 1),
+  /* 1000000110 */ V(0, 0, 1),
+  /* 1000000111 */ V(0, 0, 1),
+  /* 1000001000 */ V(0, 0, 1),
+  /* 1000001001 */ V(0, 0, 1),
+  /* 1000001010 */ V(0, 0, 1),
+  /* 1000001011 */ V(0, 0, 1),
+  /* 1000001100 */ V(0, 0, 1),
+  /* 1000001101 */ V(0, 0, 1),
+  /* 1000001110 */ V(0, 0, 1),
+  /* 1000001111 */ V(0, 0, 1),
+  /* 1000010000 */ V(0, 0, 1),
+  /* 1000010001 */ V(0, 0, 1),
+  /* 1000010010 */ V(0, 0, 1),
+  /* 1000010011 */ V(0, 0, 1),
+  /* 1000010100 */ V(0, 0, 1),
+  /* 1000010101 */ V(0, 0, 1),
+  /* 1000010110 */ V(0, 0, 1),
+  /* 1000010111 */ V(0, 0, 1),
+  /* 1000011000 */ V(0, 0, 1),
+  /* 1000011001 */ V(0, 0, 1),
+  /* 1000011010 */ V(0, 0, 1),
+  /* 1000011011 */ V(0, 0, 1),
+  /* 1000011100 */ V(0, 0, 1),
+  /* 1000011101 */ V(0, 0, 1),
+  /* 1000011110 */ V(0, 0, 1),
+  /* 1000011111 */ V(0, 0, 1),
+  /* 1000100000 */ V(0, 0, 1),
+  /* 1000100001 */ V(0, 0, 1),
+  /* 1000100010 */ V(0, 0, 1),
+  /* 1000100011 */ V(0, 0, 1),
+  /* 1000100100 */ V(0, 0, 1),
+  /* 1000100101 */ V(0, 0, 1),
+  /* 1000100110 */ V(0, 0, 1),
+  /* 1000100111 */ V(0, 0, 1),
+  /* 1000101000 */ V(0, 0, 1),
+  /* 1000101001 */ V(0, 0, 1),
+  /* 1000101010 */ V(0, 0, 1),
+  /* 1000101011 */ V(0, 0, 1),
+  /* 1000101100 */ V(0, 0, 1),
+  /* 1000101101 */ V(0, 0, 1),
+  /* 1000101110 */ V(0, 0, 1),
+  /* 1000101111 */ V(0, 0, 1),
+  /* 1000110000 */ V(0, 0, 1),
+  /* 1000110001 */ V(0, 0, 1),
+  /* 1000110010 */ V(0, 0, 1),
+  /* 1000110011 */ V(0, 0, 1),
+  /* 1000110100 */ V(0, 0, 1),
+  /* 1000110101 */ V(0, 0, 1),
+  /* 1000110110 */ V(0, 0, 1),
+  /* 1000110111 */ V(0, 0, 1),
+  /* 1000111000 */ V(0, 0, 1),
+  /* 1000111001 */ V(0, 0, 1),
+  /* 1000111010 */ V(0, 0, 1),
+  /* 1000111011 */ V(0, 0, 1),
+  /* 1000111100 */ V(0, 0, 1),
+  /* 1000111101 */ V(0, 0, 1),
+  /* 1000111110 */ V(0, 0, 1),
+  /* 1000111111 */ V(0, 0, 1),
+  /* 1001000000 */ V(0, 0, 1),
+  /* 1001000001 */ V(0, 0, 1),
+  /* 1001000010 */ V(0, 0, 1),
+  /* 1001000011 */ V(0, 0, 1),
+  /* 1001000100 */ V(0, 0, 1),
+  /* 1001000101 */ V(0, 0, 1),
+  /* 1001000110 */ V(0, 0, 1),
+  /* 1001000111 */ V(0, 0, 1),
+  /* 1001001000 */ V(0, 0, 1),
+  /* 1001001001 */ V(0, 0, 1),
+  /* 1001001010 */ V(0, 0, 1),
+  /* 1001001011 */ V(0, 0, 1),
+  /* 1001001100 */ V(0, 0, 1),
+  /* 1001001101 */ V(0, 0, 1),
+  /* 1001001110 */ V(0, 0, 1),
+  /* 1001001111 */ V(0, 0, 1),
+  /* 1001010000 */ V(0, 0, 1),
+  /* 1001010001 */ V(0, 0, 1),
+  /* 1001010010 */ V(0, 0, 1),
+  /* 1001010011 */ V(0, 0, 1),
+  /* 1001010100 */ V(0, 0, 1),
+  /* 1001010101 */ V(0, 0, 1),
+  /* 1001010110 */ V(0, 0, 1),
+  /* 1001010111 */ V(0, 0, 1),
+  /* 1001011000 */ V(0, 0, 1),
+  /* 1001011001 */ V(0, 0, 1),
+  /* 1001011010 */ V(0, 0, 1),
+  /* 1001011011 */ V(0, 0, 1),
+  /* 1001011100 */ V(0, 0, 1),
+  /* 1001011101 */ V(0, 0, 1),
+  /* 1001011110 */ V(0, 0, 1),
+  /* 1001011111 */ V(0, 0, 1),
+  /* 1001100000 */ V(0, 0, 1),
+  /* 1001100001 */ V(0, 0, 1),
+  /* 1001100010 */ V(0, 0, 1),
+  /* 1001100011 */ V(0, 0, 1),
+  /* 1001100100 */ V(0, 0, 1),
+  /* 1001100101 */ V(0, 0, 1),
+  /* 1001100110 */ V(0, 0, 1),
+  /* 1001100111 */ V(0, 0, 1),
+  /* 1001101000 */ V(0, 0, 1),
+  /* 1001101001 */ V(0, 0, 1),
+  /* 1001101010 */ V(0, 0, 1),
+  /* 1001101011 */ V(0, 0, 1),
+  /* 1001101100 */ V(0, 0, 1),
+  /* 1001101101 */ V(0, 0, 1),
+  /* 1001101110 */ V(0, 0, 1),
+  /* 1001101111 */ V(0, 0, 1),
+  /* 1001110000 */ V(0, 0, 1),
+  /* 1001110001 */ V(0, 0, 1),
+  /* 1001110010 */ V(0, 0, 1),
+  /* 1001110011 */ V(0, 0, 1),
+  /* 1001110100 */ V(0, 0, 1),
+  /* 1001110101 */ V(0, 0, 1),
+  /* 1001110110 */ V(0, 0, 1),
+  /* 1001110111 */ V(0, 0, 1),
+  /* 1001111000 */ V(0, 0, 1),
+  /* 1001111001 */ V(0, 0, 1),
+  /* 1001111010 */ V(0, 0, 1),
+  /* 1001111011 */ V(0, 0, 1),
+  /* 1001111100 */ V(0, 0, 1),
+  /* 1001111101 */ V(0, 0, 1),
+  /* 1001111110 */ V(0, 0, 1),
+  /* 1001111111 */ V(0, 0, 1),
+  /* 1010000000 */ V(0, 0, 1),
+  /* 1010000001 */ V(0, 0, 1),
+  /* 1010000010 */ V(0, 0, 1),
+  /* 1010000011 */ V(0, 0, 1),
+  /* 1010000100 */ V(0, 0, 1),
+  /* 1010000101 */ V(0, 0, 1),
+  /* 1010000110 */ V(0, 0, 1),
+  /* 1010000111 */ V(0, 0, 1),
+  /* 1010001000 */ V(0, 0, 1),
+  /* 1010001001 */ V(0, 0, 1),
+  /* 1010001010 */ V(0, 0, 1),
+  /* 1010001011 */ V(0, 0, 1),
+  /* 1010001100 */ V(0, 0, 1),
+  /* 1010001101 */ V(0, 0, 1),
+  /* 1010001110 */ V(0, 0, 1),
+  /* 1010001111 */ V(0, 0, 1),
+  /* 1010010000 */ V(0, 0, 1),
+  /* 1010010001 */ V(0, 0, 1),
+  /* 1010010010 */ V(0, 0, 1),
+  /* 1010010011 */ V(0, 0, 1),
+  /* 1010010100 */ V(0, 0, 1),
+  /* 1010010101 */ V(0, 0, 1),
+  /* 1010010110 */ V(0, 0, 1),
+  /* 1010010111 */ V(0, 0, 1),
+  /* 1010011000 */ V(0, 0, 1),
+  /* 1010011001 */ V(0, 0, 1),
+  /* 1010011010 */ V(0, 0, 1),
+  /* 1010011011 */ V(0, 0, 1),
+  /* 1010011100 */ V(0, 0, 1),
+  /* 1010011101 */ V(0, 0, 1),
+  /* 1010011110 */ V(0, 0, 1),
+  /* 1010011111 */ V(0, 0, 1),
+  /* 1010100000 */ V(0, 0, 1),
+  /* 1010100001 */ V(0, 0, 1),
+  /* 1010100010 */ V(0, 0, 1),
+  /* 1010100011 */ V(0, 0, 1),
+  /* 1010100100 */ V(0, 0, 1),
+  /* 1010100101 */ V(0, 0, 1),
+  /* 1010100110 */ V(0, 0, 1),
+  /* 1010100111 */ V(0, 0, 1),
+  /* 1010101000 */ V(0, 0, 1),
+  /* 1010101001 */ V(0, 0, 1),
+  /* 1010101010 */ V(0, 0, 1),
+  /* 1010101011 */ V(0, 0, 1),
+  /* 1010101100 */ V(0, 0, 1),
+  /* 1010101101 */ V(0, 0, 1),
+  /* 1010101110 */ V(0, 0, 1),
+  /* 1010101111 */ V(0, 0, 1),
+  /* 1010110000 */ V(0, 0, 1),
+  /* 1010110001 */ V(0, 0, 1),
+  /* 1010110010 */ V(0, 0, 1),
+  /* 1010110011 */ V(0, 0, 1),
+  /* 1010110100 */ V(0, 0, 1),
+  /* 1010110101 */ V(0, 0, 1),
+  /* 1010110110 */ V(0, 0, 1),
+  /* 1010110111 */ V(0, 0, 1),
+  /* 1010111000 */ V(0, 0, 1),
+  /* 1010111001 */ V(0, 0, 1),
+  /* 1010111010 */ V(0, 0, 1),
+  /* 1010111011 */ V(0, 0, 1),
+  /* 1010111100 */ V(0, 0, 1),
+  /* 1010111101 */ V(0, 0, 1),
+  /* 1010111110 */ V(0, 0, 1),
+  /* 1010111111 */ V(0, 0, 1),
+  /* 1011000000 */ V(0, 0, 1),
+  /* 1011000001 */ V(0, 0, 1),
+  /* 1011000010 */ V(0, 0, 1),
+  /* 1011000011 */ V(0, 0, 1),
+  /* 1011000100 */ V(0, 0, 1),
+  /* 1011000101 */ V(0, 0, 1),
+  /* 1011000110 */ V(0, 0, 1),
+  /* 1011000111 */ V(0, 0, 1),
+  /* 1011001000 */ V(0, 0, 1),
+  /* 1011001001 */ V(0, 0, 1),
+  /* 1011001010 */ V(0, 0, 1),
+  /* 1011001011 */ V(0, 0, 1),
+  /* 1011001100 */ V(0, 0, 1),
+  /* 1011001101 */ V(0, 0, 1),
+  /* 1011001110 */ V(0, 0, 1),
+  /* 1011001111 */ V(0, 0, 1),
+  /* 1011010000 */ V(0, 0, 1),
+  /* 1011010001 */ V(0, 0, 1),
+  /* 1011010010 */ V(0, 0, 1),
+  /* 1011010011 */ V(0, 0, 1),
+  /* 1011010100 */ V(0, 0, 1),
+  /* 1011010101 */ V(0, 0, 1),
+  /* 1011010110 */ V(0, 0, 1),
+  /* 1011010111 */ V(0, 0, 1),
+  /* 1011011000 */ V(0, 0, 1),
+  /* 1011011001 */ V(0, 0, 1),
+  /* 1011011010 */ V(0, 0, 1),
+  /* 1011011011 */ V(0, 0, 1),
+  /* 1011011100 */ V(0, 0, 1),
+  /* 1011011101 */ V(0, 0, 1),
+  /* 1011011110 */ V(0, 0, 1),
+  /* 1011011111 */ V(0, 0, 1),
+  /* 1011100000 */ V(0, 0, 1),
+  /* 1011100001 */ V(0, 0, 1),
+  /* 1011100010 */ V(0, 0, 1),
+  /* 1011100011 */ V(0, 0, 1),
+  /* 1011100100 */ V(0, 0, 1),
+  /* 1011100101 */ V(0, 0, 1),
+  /* 1011100110 */ V(0, 0, 1),
+  /* 1011100111 */ V(0, 0, 1),
+  /* 1011101000 */ V(0, 0, 1),
+  /* 1011101001 */ V(0, 0, 1),
+  /* 1011101010 */ V(0, 0, 1),
+  /* 1011101011 */ V(0, 0, 1),
+  /* 1011101100 */ V(0, 0, 1),
+  /* 1011101101 */ V(0, 0, 1),
+  /* 1011101110 */ V(0, 0, 1),
+  /* 1011101111 */ V(0, 0, 1),
+  /* 1011110000 */ V(0, 0, 1),
+  /* 1011110001 */ V(0, 0, 1),
+  /* 1011110010 */ V(0, 0, 1),
+  /* 1011110011 */ V(0, 0, 1),
+  /* 1011110100 */ V(0, 0, 1),
+  /* 1011110101 */ V(0, 0, 1),
+  /* 1011110110 */ V(0, 0, 1),
+  /* 1011110111 */ V(0, 0, 1),
+  /* 1011111000 */ V(0, 0, 1),
+  /* 1011111001 */ V(0, 0, 1),
+  /* 1011111010 */ V(0, 0, 1),
+  /* 1011111011 */ V(0, 0, 1),
+  /* 1011111100 */ V(0, 0, 1),
+  /* 1011111101 */ V(0, 0, 1),
+  /* 1011111110 */ V(0, 0, 1),
+  /* 1011111111 */ V(0, 0, 1),
+  /* 1100000000 */ V(0, 0, 1),
+  /* 1100000001 */ V(0, 0, 1),
+  /* 1100000010 */ V(0, 0, 1),
+  /* 1100000011 */ V(0, 0, 1),
+  /* 1100000100 */ V(0, 0, 1),
+  /* 1100000101 */ V(0, 0, 1),
+  /* 1100000110 */ V(0, 0, 1),
+  /* 1100000111 */ V(0, 0, 1),
+  /* 1100001000 */ V(0, 0, 1),
+  /* 1100001001 */ V(0, 0, 1),
+  /* 1100001010 */ V(0, 0, 1),
+  /* 1100001011 */ V(0, 0, 1),
+  /* 1100001100 */ V(0, 0, 1),
+  /* 1100001101 */ V(0, 0, 1),
+  /* 1100001110 */ V(0, 0, 1),
+  /* 1100001111 */ V(0, 0, 1),
+  /* 1100010000 */ V(0, 0, 1),
+  /* 1100010001 */ V(0, 0, 1),
+  /* 1100010010 */ V(0, 0, 1),
+  /* 1100010011 */ V(0, 0, 1),
+  /* 1100010100 */ V(0, 0, 1),
+  /* 1100010101 */ V(0, 0, 1),
+  /* 1100010110 */ V(0, 0, 1),
+  /* 1100010111 */ V(0, 0, 1),
+  /* 1100011000 */ V(0, 0, 1),
+  /* 1100011001 */ V(0, 0, 1),
+  /* 1100011010 */ V(0, 0, 1),
+  /* 1100011011 */ V(0, 0, 1),
+  /* 1100011100 */ V(0, 0, 1),
+  /* 1100011101 */ V(0, 0, 1),
+  /* 1100011110 */ V(0, 0, 1),
+  /* 1100011111 */ V(0, 0, 1),
+  /* 1100100000 */ V(0, 0, 1),
+  /* 1100100001 */ V(0, 0, 1),
+  /* 1100100010 */ V(0, 0, 1),
+  /* 1100100011 */ V(0, 0, 1),
+  /* 1100100100 */ V(0, 0, 1),
+  /* 1100100101 */ V(0, 0, 1),
+  /* 1100100110 */ V(0, 0, 1),
+  /* 1100100111 */ V(0, 0, 1),
+  /* 1100101000 */ V(0, 0, 1),
+  /* 1100101001 */ V(0, 0, 1),
+  /* 1100101010 */ V(0, 0, 1),
+  /* 1100101011 */ V(0, 0, 1),
+  /* 1100101100 */ V(0, 0, 1),
+  /* 1100101101 */ V(0, 0, 1),
+  /* 1100101110 */ V(0, 0, 1),
+  /* 1100101111 */ V(0, 0, 1),
+  /* 1100110000 */ V(0, 0, 1),
+  /* 1100110001 */ V(0, 0, 1),
+  /* 1100110010 */ V(0, 0, 1),
+  /* 1100110011 */ V(0, 0, 1),
+  /* 1100110100 */ V(0, 0, 1),
+  /* 1100110101 */ V(0, 0, 1),
+  /* 1100110110 */ V(0, 0, 1),
+  /* 1100110111 */ V(0, 0, 1),
+  /* 1100111000 */ V(0, 0, 1),
+  /* 1100111001 */ V(0, 0, 1),
+  /* 1100111010 */ V(0, 0, 1),
+  /* 1100111011 */ V(0, 0, 1),
+  /* 1100111100 */ V(0, 0, 1),
+  /* 1100111101 */ V(0, 0, 1),
+  /* 1100111110 */ V(0, 0, 1),
+  /* 1100111111 */ V(0, 0, 1),
+  /* 1101000000 */ V(0, 0, 1),
+  /* 1101000001 */ V(0, 0, 1),
+  /* 1101000010 */ V(0, 0, 1),
+  /* 1101000011 */ V(0, 0, 1),
+  /* 1101000100 */ V(0, 0, 1),
+  /* 1101000101 */ V(0, 0, 1),
+  /* 1101000110 */ V(0, 0, 1),
+  /* 1101000111 */ V(0, 0, 1),
+  /* 1101001000 */ V(0, 0, 1),
+  /* 1101001001 */ V(0, 0, 1),
+  /* 1101001010 */ V(0, 0, 1),
+  /* 1101001011 */ V(0, 0, 1),
+  /* 1101001100 */ V(0, 0, 1),
+  /* 1101001101 */ V(0, 0, 1),
+  /* 1101001110 */ V(0, 0, 1),
+  /* 1101001111 */ V(0, 0, 1),
+  /* 1101010000 */ V(0, 0, 1),
+  /* 1101010001 */ V(0, 0, 1),
+  /* 1101010010 */ V(0, 0, 1),
+  /* 1101010011 */ V(0, 0, 1),
+  /* 1101010100 */ V(0, 0, 1),
+  /* 1101010101 */ V(0, 0, 1),
+  /* 1101010110 */ V(0, 0, 1),
+  /* 1101010111 */ V(0, 0, 1),
+  /* 1101011000 */ V(0, 0, 1),
+  /* 1101011001 */ V(0, 0, 1),
+  /* 1101011010 */ V(0, 0, 1),
+  /* 1101011011 */ V(0, 0, 1),
+  /* 1101011100 */ V(0, 0, 1),
+  /* 1101011101 */ V(0, 0, 1),
+  /* 1101011110 */ V(0, 0, 1),
+  /* 1101011111 */ V(0, 0, 1),
+  /* 1101100000 */ V(0, 0, 1),
+  /* 1101100001 */ V(0, 0, 1),
+  /* 1101100010 */ V(0, 0, 1),
+  /* 1101100011 */ V(0, 0, 1),
+  /* 1101100100 */ V(0, 0, 1),
+  /* 1101100101 */ V(0, 0, 1),
+  /* 1101100110 */ V(0, 0, 1),
+  /* 1101100111 */ V(0, 0, 1),
+  /* 1101101000 */ V(0, 0, 1),
+  /* 1101101001 */ V(0, 0, 1),
+  /* 1101101010 */ V(0, 0, 1),
+  /* 1101101011 */ V(0, 0, 1),
+  /* 1101101100 */ V(0, 0, 1),
+  /* 1101101101 */ V(0, 0, 1),
+  /* 1101101110 */ V(0, 0, 1),
+  /* 1101101111 */ V(0, 0, 1),
+  /* 1101110000 */ V(0, 0, 1),
+  /* 1101110001 */ V(0, 0, 1),
+  /* 1101110010 */ V(0, 0, 1),
+  /* 1101110011 */ V(0, 0, 1),
+  /* 1101110100 */ V(0, 0, 1),
+  /* 1101110101 */ V(0, 0, 1),
+  /* 1101110110 */ V(0, 0, 1),
+  /* 1101110111 */ V(0, 0, 1),
+  /* 1101111000 */ V(0, 0, 1),
+  /* 1101111001 */ V(0, 0, 1),
+  /* 1101111010 */ V(0, 0, 1),
+  /* 1101111011 */ V(0, 0, 1),
+  /* 1101111100 */ V(0, 0, 1),
+  /* 1101111101 */ V(0, 0, 1),
+  /* 1101111110 */ V(0, 0, 1),
+  /* 1101111111 */ V(0, 0, 1),
+  /* 1110000000 */ V(0, 0, 1),
+  /* 1110000001 */ V(0, 0, 1),
+  /* 1110000010 */ V(0, 0, 1),
+  /* 1110000011 */ V(0, 0, 1),
+  /* 1110000100 */ V(0, 0, 1),
+  /* 1110000101 */ V(0, 0, 1),
+  /* 1110000110 */ V(0, 0, 1),
+  /* 1110000111 */ V(0, 0, 1),
+  /* 1110001000 */ V(0, 0, 1),
+  /* 1110001001 */ V(0, 0, 1),
+  /* 1110001010 */ V(0, 0, 1),
+  /* 1110001011 */ V(0, 0, 1),
+  /* 1110001100 */ V(0, 0, 1),
+  /* 1110001101 */ V(0, 0, 1),
+  /* 1110001110 */ V(0, 0, 1),
+  /* 1110001111 */ V(0, 0, 1),
+  /* 1110010000 */ V(0, 0, 1),
+  /* 1110010001 */ V(0, 0, 1),
+  /* 1110010010 */ V(0, 0, 1),
+  /* 1110010011 */ V(0, 0, 1),
+  /* 1110010100 */ V(0, 0, 1),
+  /* 1110010101 */ V(0, 0, 1),
+  /* 1110010110 */ V(0, 0, 1),
+  /* 1110010111 */ V(0, 0, 1),
+  /* 1110011000 */ V(0, 0, 1),
+  /* 1110011001 */ V(0, 0, 1),
+  /* 1110011010 */ V(0, 0, 1),
+  /* 1110011011 */ V(0, 0, 1),
+  /* 1110011100 */ V(0, 0, 1),
+  /* 1110011101 */ V(0, 0, 1),
+  /* 1110011110 */ V(0, 0, 1),
+  /* 1110011111 */ V(0, 0, 1),
+  /* 1110100000 */ V(0, 0, 1),
+  /* 1110100001 */ V(0, 0, 1),
+  /* 1110100010 */ V(0, 0, 1),
+  /* 1110100011 */ V(0, 0, 1),
+  /* 1110100100 */ V(0, 0, 1),
+  /* 1110100101 */ V(0, 0, 1),
+  /* 1110100110 */ V(0, 0, 1),
+  /* 1110100111 */ V(0, 0, 1),
+  /* 1110101000 */ V(0, 0, 1),
+  /* 1110101001 */ V(0, 0, 1),
+  /* 1110101010 */ V(0, 0, 1),
+  /* 1110101011 */ V(0, 0, 1),
+  /* 1110101100 */ V(0, 0, 1),
+  /* 1110101101 */ V(0, 0, 1),
+  /* 1110101110 */ V(0, 0, 1),
+  /* 1110101111 */ V(0, 0, 1),
+  /* 1110110000 */ V(0, 0, 1),
+  /* 1110110001 */ V(0, 0, 1),
+  /* 1110110010 */ V(0, 0, 1),
+  /* 1110110011 */ V(0, 0, 1),
+  /* 1110110100 */ V(0, 0, 1),
+  /* 1110110101 */ V(0, 0, 1),
+  /* 1110110110 */ V(0, 0, 1),
+  /* 1110110111 */ V(0, 0, 1),
+  /* 1110111000 */ V(0, 0, 1),
+  /* 1110111001 */ V(0, 0, 1),
+  /* 1110111010 */ V(0, 0, 1),
+  /* 1110111011 */ V(0, 0, 1),
+  /* 1110111100 */ V(0, 0, 1),
+  /* 1110111101 */ V(0, 0, 1),
+  /* 1110111110 */ V(0, 0, 1),
+  /* 1110111111 */ V(0, 0, 1),
+  /* 1111000000 */ V(0, 0, 1),
+  /* 1111000001 */ V(0, 0, 1),
+  /* 1111000010 */ V(0, 0, 1),
+  /* 1111000011 */ V(0, 0, 1),
+  /* 1111000100 */ V(0, 0, 1),
+  /* 1111000101 */ V(0, 0, 1),
+  /* 1111000110 */ V(0, 0, 1),
+  /* 1111000111 */ V(0, 0, 1),
+  /* 1111001000 */ V(0, 0, 1),
+  /* 1111001001 */ V(0, 0, 1),
+  /* 1111001010 */ V(0, 0, 1),
+  /* 1111001011 */ V(0, 0, 1),
+  /* 1111001100 */ V(0, 0, 1),
+  /* 1111001101 */ V(0, 0, 1),
+  /* 1111001110 */ V(0, 0, 1),
+  /* 1111001111 */ V(0, 0, 1),
+  /* 1111010000 */ V(0, 0, 1),
+  /* 1111010001 */ V(0, 0, 1),
+  /* 1111010010 */ V(0, 0, 1),
+  /* 1111010011 */ V(0, 0, 1),
+  /* 1111010100 */ V(0, 0, 1),
+  /* 1111010101 */ V(0, 0, 1),
+  /* 1111010110 */ V(0, 0, 1),
+  /* 1111010111 */ V(0, 0, 1),
+  /* 1111011000 */ V(0, 0, 1),
+  /* 1111011001 */ V(0, 0, 1),
+  /* 1111011010 */ V(0, 0, 1),
+  /* 1111011011 */ V(0, 0, 1),
+  /* 1111011100 */ V(0, 0, 1),
+  /* 1111011101 */ V(0, 0, 1),
+  /* 1111011110 */ V(0, 0, 1),
+  /* 1111011111 */ V(0, 0, 1),
+  /* 1111100000 */ V(0, 0, 1),
+  /* 1111100001 */ V(0, 0, 1),
+  /* 1111100010 */ V(0, 0, 1),
+  /* 1111100011 */ V(0, 0, 1),
+  /* 1111100100 */ V(0, 0, 1),
+  /* 1111100101 */ V(0, 0, 1),
+  /* 1111100110 */ V(0, 0, 1),
+  /* 1111100111 */ V(0, 0, 1),
+  /* 1111101000 */ V(0, 0, 1),
+  /* 1111101001 */ V(0, 0, 1),
+  /* 1111101010 */ V(0, 0, 1),
+  /* 1111101011 */ V(0, 0, 1),
+  /* 1111101100 */ V(0, 0, 1),
+  /* 1111101101 */ V(0, 0, 1),
+  /* 1111101110 */ V(0, 0, 1),
+  /* 1111101111 */ V(0, 0, 1),
+  /* 1111110000 */ V(0, 0, 1),
+  /* 1111110001 */ V(0, 0, 1),
+  /* 1111110010 */ V(0, 0, 1),
+  /* 1111110011 */ V(0, 0, 1),
+  /* 1111110100 */ V(0, 0, 1),
+  /* 1111110101 */ V(0, 0, 1),
+  /* 1111110110 */ V(0, 0, 1),
+  /* 1111110111 */ V(0, 0, 1),
+  /* 1111111000 */ V(0, 0, 1),
+  /* 1111111001 */ V(0, 0, 1),
+  /* 1111111010 */ V(0, 0, 1),
+  /* 1111111011 */ V(0, 0, 1),
+  /* 1111111100 */ V(0, 0, 1),
+  /* 1111111101 */ V(0, 0, 1),
+  /* 1111111110 */ V(0, 0, 1),
+  /* 1111111111 */ V(0, 0, 1),
+
+  /* 0000 0000 00 ... */
+  /* 0    */ V(7, 7, 1),	/* 1024 */
+  /* 1    */ V(6, 7, 1),
 
-  /* 0000 0111 ... */
-  /* 0    */ V(6, 4, 1),	/* 96 */
-  /* 1    */ V(0, 7, 1),
+  /* 0000 0000 01 ... */
+  /* 0    */ V(7, 6, 1),	/* 1026 */
+  /* 1    */ V(5, 7, 1),
 
-  /* 0000 1111 ... */
-  /* 0    */ V(4, 4, 1),	/* 98 */
-  /* 1    */ V(2, 5, 1),
+  /* 0000 0000 10 ... */
+  /* 0    */ V(7, 5, 1),	/* 1028 */
+  /* 1    */ V(6, 6, 1),
 
-  /* 0001 0000 ... */
-  /* 0    */ V(5, 2, 1),	/* 100 */
-  /* 1    */ V(0, 5, 1),
+  /* 0000 0010 10 ... */
+  /* 0    */ V(5, 5, 1),	/* 1030 */
+  /* 1    */ V(5, 4, 1)
+};
 
-  /* 0001 1101 ... */
-  /* 0    */ V(4, 3, 1),	/* 102 */
-  /* 1    */ V(3, 3, 1)
+static
+union huffpair const hufftab11[] = {
+  /* 0000000000 */ V(7, 7, 10),
+  /* 0000000001 */ V(6, 7, 10),
+  /* 0000000010 */ V(7, 6, 10),
+  /* 0000000011 */ V(7, 5, 10),
+  /* 0000000100 */ V(6, 6, 10),
+  /* 0000000101 */ V(4, 7, 10),
+  /* 0000000110 */ V(7, 4, 10),
+  /* 0000000111 */ PTR(1024, 1),
+  /* 0000001000 */ V(5, 6, 10),
+  /* 0000001001 */ V(6, 5, 10),
+  /* 0000001010 */ V(3, 7, 9),
+  /* 0000001011 */ V(3, 7, 9),
+  /* 0000001100 */ V(7, 3, 9),
+  /* 0000001101 */ V(7, 3, 9),
+  /* 0000001110 */ V(4, 6, 9),
+  /* 0000001111 */ V(4, 6, 9),
+  /* 0000010000 */ V(4, 5, 10),
+  /* 0000010001 */ V(5, 4, 10),
+  /* 0000010010 */ V(3, 5, 10),
+  /* 0000010011 */ V(5, 3, 10),
+  /* 0000010100 */ V(2, 7, 8),
+  /* 0000010101 */ V(2, 7, 8),
+  /* 0000010110 */ V(2, 7, 8),
+  /* 0000010111 */ V(2, 7, 8),
+  /* 0000011000 */ V(7, 2, 8),
+  /* 0000011001 */ V(7, 2, 8),
+  /* 0000011010 */ V(7, 2, 8),
+  /* 0000011011 */ V(7, 2, 8),
+  /* 0000011100 */ V(6, 4, 9),
+  /* 0000011101 */ V(6, 4, 9),
+  /* 0000011110 */ V(0, 7, 9),
+  /* 0000011111 */ V(0, 7, 9),
+  /* 0000100000 */ V(7, 1, 7),
+  /* 0000100001 */ V(7, 1, 7),
+  /* 0000100010 */ V(7, 1, 7),
+  /* 0000100011 */ V(7, 1, 7),
+  /* 0000100100 */ V(7, 1, 7),
+  /* 0000100101 */ V(7, 1, 7),
+  /* 0000100110 */ V(7, 1, 7),
+  /* 0000100111 */ V(7, 1, 7),
+  /* 0000101000 */ V(1, 7, 8),
+  /* 0000101001 */ V(1, 7, 8),
+  /* 0000101010 */ V(1, 7, 8),
+  /* 0000101011 */ V(1, 7, 8),
+  /* 0000101100 */ V(7, 0, 8),
+  /* 0000101101 */ V(7, 0, 8),
+  /* 0000101110 */ V(7, 0, 8),
+  /* 0000101111 */ V(7, 0, 8),
+  /* 0000110000 */ V(3, 6, 8),
+  /* 0000110001 */ V(3, 6, 8),
+  /* 0000110010 */ V(3, 6, 8),
+  /* 0000110011 */ V(3, 6, 8),
+  /* 0000110100 */ V(6, 3, 8),
+  /* 0000110101 */ V(6, 3, 8),
+  /* 0000110110 */ V(6, 3, 8),
+  /* 0000110111 */ V(6, 3, 8),
+  /* 0000111000 */ V(6, 0, 8),
+  /* 0000111001 */ V(6, 0, 8),
+  /* 0000111010 */ V(6, 0, 8),
+  /* 0000111011 */ V(6, 0, 8),
+  /* 0000111100 */ V(4, 4, 9),
+  /* 0000111101 */ V(4, 4, 9),
+  /* 0000111110 */ V(2, 5, 9),
+  /* 0000111111 */ V(2, 5, 9),
+  /* 0001000000 */ V(5, 2, 9),
+  /* 0001000001 */ V(5, 2, 9),
+  /* 0001000010 */ V(0, 5, 9),
+  /* 0001000011 */ V(0, 5, 9),
+  /* 0001000100 */ V(1, 5, 8),
+  /* 0001000101 */ V(1, 5, 8),
+  /* 0001000110 */ V(1, 5, 8),
+  /* 0001000111 */ V(1, 5, 8),
+  /* 0001001000 */ V(6, 2, 7),
+  /* 0001001001 */ V(6, 2, 7),
+  /* 0001001010 */ V(6, 2, 7),
+  /* 0001001011 */ V(6, 2, 7),
+  /* 0001001100 */ V(6, 2, 7),
+  /* 0001001101 */ V(6, 2, 7),
+  /* 0001001110 */ V(6, 2, 7),
+  /* 0001001111 */ V(6, 2, 7),
+  /* 0001010000 */ V(2, 6, 8),
+  /* 0001010001 */ V(2, 6, 8),
+  /* 0001010010 */ V(2, 6, 8),
+  /* 0001010011 */ V(2, 6, 8),
+  /* 0001010100 */ V(0, 6, 8),
+  /* 0001010101 */ V(0, 6, 8),
+  /* 0001010110 */ V(0, 6, 8),
+  /* 0001010111 */ V(0, 6, 8),
+  /* 0001011000 */ V(1, 6, 7),
+  /* 0001011001 */ V(1, 6, 7),
+  /* 0001011010 */ V(1, 6, 7),
+  /* 0001011011 */ V(1, 6, 7),
+  /* 0001011100 */ V(1, 6, 7),
+  /* 0001011101 */ V(1, 6, 7),
+  /* 0001011110 */ V(1, 6, 7),
+  /* 0001011111 */ V(1, 6, 7),
+  /* 0001100000 */ V(6, 1, 7),
+  /* 0001100001 */ V(6, 1, 7),
+  /* 0001100010 */ V(6, 1, 7),
+  /* 0001100011 */ V(6, 1, 7),
+  /* 0001100100 */ V(6, 1, 7),
+  /* 0001100101 */ V(6, 1, 7),
+  /* 0001100110 */ V(6, 1, 7),
+  /* 0001100111 */ V(6, 1, 7),
+  /* 0001101000 */ V(5, 1, 8),
+  /* 0001101001 */ V(5, 1, 8),
+  /* 0001101010 */ V(5, 1, 8),
+  /* 0001101011 */ V(5, 1, 8),
+  /* 0001101100 */ V(3, 4, 8),
+  /* 0001101101 */ V(3, 4, 8),
+  /* 0001101110 */ V(3, 4, 8),
+  /* 0001101111 */ V(3, 4, 8),
+  /* 0001110000 */ V(5, 0, 8),
+  /* 0001110001 */ V(5, 0, 8),
+  /* 0001110010 */ V(5, 0, 8),
+  /* 0001110011 */ V(5, 0, 8),
+  /* 0001110100 */ V(4, 3, 9),
+  /* 0001110101 */ V(4, 3, 9),
+  /* 0001110110 */ V(3, 3, 9),
+  /* 0001110111 */ V(3, 3, 9),
+  /* 0001111000 */ V(2, 4, 8),
+  /* 0001111001 */ V(2, 4, 8),
+  /* 0001111010 */ V(2, 4, 8),
+  /* 0001111011 */ V(2, 4, 8),
+  /* 0001111100 */ V(4, 2, 8),
+  /* 0001111101 */ V(4, 2, 8),
+  /* 0001111110 */ V(4, 2, 8),
+  /* 0001111111 */ V(4, 2, 8),
+  /* 0010000000 */ V(1, 4, 8),
+  /* 0010000001 */ V(1, 4, 8),
+  /* 0010000010 */ V(1, 4, 8),
+  /* 0010000011 */ V(1, 4, 8),
+  /* 0010000100 */ V(4, 1, 8),
+  /* 0010000101 */ V(4, 1, 8),
+  /* 0010000110 */ V(4, 1, 8),
+  /* 0010000111 */ V(4, 1, 8),
+  /* 0010001000 */ V(0, 4, 8),
+  /* 0010001001 */ V(0, 4, 8),
+  /* 0010001010 */ V(0, 4, 8),
+  /* 0010001011 */ V(0, 4, 8),
+  /* 0010001100 */ V(4, 0, 8),
+  /* 0010001101 */ V(4, 0, 8),
+  /* 0010001110 */ V(4, 0, 8),
+  /* 0010001111 */ V(4, 0, 8),
+  /* 0010010000 */ V(2, 3, 7),
+  /* 0010010001 */ V(2, 3, 7),
+  /* 0010010010 */ V(2, 3, 7),
+  /* 0010010011 */ V(2, 3, 7),
+  /* 0010010100 */ V(2, 3, 7),
+  /* 0010010101 */ V(2, 3, 7),
+  /* 0010010110 */ V(2, 3, 7),
+  /* 0010010111 */ V(2, 3, 7),
+  /* 0010011000 */ V(3, 2, 7),
+  /* 0010011001 */ V(3, 2, 7),
+  /* 0010011010 */ V(3, 2, 7),
+  /* 0010011011 */ V(3, 2, 7),
+  /* 0010011100 */ V(3, 2, 7),
+  /* 0010011101 */ V(3, 2, 7),
+  /* 0010011110 */ V(3, 2, 7),
+  /* 0010011111 */ V(3, 2, 7),
+  /* 0010100000 */ V(1, 3, 6),
+  /* 0010100001 */ V(1, 3, 6),
+  /* 0010100010 */ V(1, 3, 6),
+  /* 0010100011 */ V(1, 3, 6),
+  /* 0010100100 */ V(1, 3, 6),
+  /* 0010100101 */ V(1, 3, 6),
+  /* 0010100110 */ V(1, 3, 6),
+  /* 0010100111 */ V(1, 3, 6),
+  /* 0010101000 */ V(1, 3, 6),
+  /* 0010101001 */ V(1, 3, 6),
+  /* 0010101010 */ V(1, 3, 6),
+  /* 0010101011 */ V(1, 3, 6),
+  /* 0010101100 */ V(1, 3, 6),
+  /* 0010101101 */ V(1, 3, 6),
+  /* 0010101110 */ V(1, 3, 6),
+  /* 0010101111 */ V(1, 3, 6),
+  /* 0010110000 */ V(3, 1, 6),
+  /* 0010110001 */ V(3, 1, 6),
+  /* 0010110010 */ V(3, 1, 6),
+  /* 0010110011 */ V(3, 1, 6),
+  /* 0010110100 */ V(3, 1, 6),
+  /* 0010110101 */ V(3, 1, 6),
+  /* 0010110110 */ V(3, 1, 6),
+  /* 0010110111 */ V(3, 1, 6),
+  /* 0010111000 */ V(3, 1, 6),
+  /* 0010111001 */ V(3, 1, 6),
+  /* 0010111010 */ V(3, 1, 6),
+  /* 0010111011 */ V(3, 1, 6),
+  /* 0010111100 */ V(3, 1, 6),
+  /* 0010111101 */ V(3, 1, 6),
+  /* 0010111110 */ V(3, 1, 6),
+  /* 0010111111 */ V(3, 1, 6),
+  /* 0011000000 */ V(0, 3, 7),
+  /* 0011000001 */ V(0, 3, 7),
+  /* 0011000010 */ V(0, 3, 7),
+  /* 0011000011 */ V(0, 3, 7),
+  /* 0011000100 */ V(0, 3, 7),
+  /* 0011000101 */ V(0, 3, 7),
+  /* 0011000110 */ V(0, 3, 7),
+  /* 0011000111 */ V(0, 3, 7),
+  /* 0011001000 */ V(3, 0, 7),
+  /* 0011001001 */ V(3, 0, 7),
+  /* 0011001010 */ V(3, 0, 7),
+  /* 0011001011 */ V(3, 0, 7),
+  /* 0011001100 */ V(3, 0, 7),
+  /* 0011001101 */ V(3, 0, 7),
+  /* 0011001110 */ V(3, 0, 7),
+  /* 0011001111 */ V(3, 0, 7),
+  /* 0011010000 */ V(2, 2, 6),
+  /* 0011010001 */ V(2, 2, 6),
+  /* 0011010010 */ V(2, 2, 6),
+  /* 0011010011 */ V(2, 2, 6),
+  /* 0011010100 */ V(2, 2, 6),
+  /* 0011010101 */ V(2, 2, 6),
+  /* 0011010110 */ V(2, 2, 6),
+  /* 0011010111 */ V(2, 2, 6),
+  /* 0011011000 */ V(2, 2, 6),
+  /* 0011011001 */ V(2, 2, 6),
+  /* 0011011010 */ V(2, 2, 6),
+  /* 0011011011 */ V(2, 2, 6),
+  /* 0011011100 */ V(2, 2, 6),
+  /* 0011011101 */ V(2, 2, 6),
+  /* 0011011110 */ V(2, 2, 6),
+  /* 0011011111 */ V(2, 2, 6),
+  /* 0011100000 */ V(2, 1, 5),
+  /* 0011100001 */ V(2, 1, 5),
+  /* 0011100010 */ V(2, 1, 5),
+  /* 0011100011 */ V(2, 1, 5),
+  /* 0011100100 */ V(2, 1, 5),
+  /* 0011100101 */ V(2, 1, 5),
+  /* 0011100110 */ V(2, 1, 5),
+  /* 0011100111 */ V(2, 1, 5),
+  /* 0011101000 */ V(2, 1, 5),
+  /* 0011101001 */ V(2, 1, 5),
+  /* 0011101010 */ V(2, 1, 5),
+  /* 0011101011 */ V(2, 1, 5),
+  /* 0011101100 */ V(2, 1, 5),
+  /* 0011101101 */ V(2, 1, 5),
+  /* 0011101110 */ V(2, 1, 5),
+  /* 0011101111 */ V(2, 1, 5),
+  /* 0011110000 */ V(2, 1, 5),
+  /* 0011110001 */ V(2, 1, 5),
+  /* 0011110010 */ V(2, 1, 5),
+  /* 0011110011 */ V(2, 1, 5),
+  /* 0011110100 */ V(2, 1, 5),
+  /* 0011110101 */ V(2, 1, 5),
+  /* 0011110110 */ V(2, 1, 5),
+  /* 0011110111 */ V(2, 1, 5),
+  /* 0011111000 */ V(2, 1, 5),
+  /* 0011111001 */ V(2, 1, 5),
+  /* 0011111010 */ V(2, 1, 5),
+  /* 0011111011 */ V(2, 1, 5),
+  /* 0011111100 */ V(2, 1, 5),
+  /* 0011111101 */ V(2, 1, 5),
+  /* 0011111110 */ V(2, 1, 5),
+  /* 0011111111 */ V(2, 1, 5),
+  /* 0100000000 */ V(1, 2, 4),
+  /* 0100000001 */ V(1, 2, 4),
+  /* 0100000010 */ V(1, 2, 4),
+  /* 0100000011 */ V(1, 2, 4),
+  /* 0100000100 */ V(1, 2, 4),
+  /* 0100000101 */ V(1, 2, 4),
+  /* 0100000110 */ V(1, 2, 4),
+  /* 0100000111 */ V(1, 2, 4),
+  /* 0100001000 */ V(1, 2, 4),
+  /* 0100001001 */ V(1, 2, 4),
+  /* 0100001010 */ V(1, 2, 4),
+  /* 0100001011 */ V(1, 2, 4),
+  /* 0100001100 */ V(1, 2, 4),
+  /* 0100001101 */ V(1, 2, 4),
+  /* 0100001110 */ V(1, 2, 4),
+  /* 0100001111 */ V(1, 2, 4),
+  /* 0100010000 */ V(1, 2, 4),
+  /* 0100010001 */ V(1, 2, 4),
+  /* 0100010010 */ V(1, 2, 4),
+  /* 0100010011 */ V(1, 2, 4),
+  /* 0100010100 */ V(1, 2, 4),
+  /* 0100010101 */ V(1, 2, 4),
+  /* 0100010110 */ V(1, 2, 4),
+  /* 0100010111 */ V(1, 2, 4),
+  /* 0100011000 */ V(1, 2, 4),
+  /* 0100011001 */ V(1, 2, 4),
+  /* 0100011010 */ V(1, 2, 4),
+  /* 0100011011 */ V(1, 2, 4),
+  /* 0100011100 */ V(1, 2, 4),
+  /* 0100011101 */ V(1, 2, 4),
+  /* 0100011110 */ V(1, 2, 4),
+  /* 0100011111 */ V(1, 2, 4),
+  /* 0100100000 */ V(1, 2, 4),
+  /* 0100100001 */ V(1, 2, 4),
+  /* 0100100010 */ V(1, 2, 4),
+  /* 0100100011 */ V(1, 2, 4),
+  /* 0100100100 */ V(1, 2, 4),
+  /* 0100100101 */ V(1, 2, 4),
+  /* 0100100110 */ V(1, 2, 4),
+  /* 0100100111 */ V(1, 2, 4),
+  /* 0100101000 */ V(1, 2, 4),
+  /* 0100101001 */ V(1, 2, 4),
+  /* 0100101010 */ V(1, 2, 4),
+  /* 0100101011 */ V(1, 2, 4),
+  /* 0100101100 */ V(1, 2, 4),
+  /* 0100101101 */ V(1, 2, 4),
+  /* 0100101110 */ V(1, 2, 4),
+  /* 0100101111 */ V(1, 2, 4),
+  /* 0100110000 */ V(1, 2, 4),
+  /* 0100110001 */ V(1, 2, 4),
+  /* 0100110010 */ V(1, 2, 4),
+  /* 0100110011 */ V(1, 2, 4),
+  /* 0100110100 */ V(1, 2, 4),
+  /* 0100110101 */ V(1, 2, 4),
+  /* 0100110110 */ V(1, 2, 4),
+  /* 0100110111 */ V(1, 2, 4),
+  /* 0100111000 */ V(1, 2, 4),
+  /* 0100111001 */ V(1, 2, 4),
+  /* 0100111010 */ V(1, 2, 4),
+  /* 0100111011 */ V(1, 2, 4),
+  /* 0100111100 */ V(1, 2, 4),
+  /* 0100111101 */ V(1, 2, 4),
+  /* 0100111110 */ V(1, 2, 4),
+  /* 0100111111 */ V(1, 2, 4),
+  /* 0101000000 */ V(0, 2, 5),
+  /* 0101000001 */ V(0, 2, 5),
+  /* 0101000010 */ V(0, 2, 5),
+  /* 0101000011 */ V(0, 2, 5),
+  /* 0101000100 */ V(0, 2, 5),
+  /* 0101000101 */ V(0, 2, 5),
+  /* 0101000110 */ V(0, 2, 5),
+  /* 0101000111 */ V(0, 2, 5),
+  /* 0101001000 */ V(0, 2, 5),
+  /* 0101001001 */ V(0, 2, 5),
+  /* 0101001010 */ V(0, 2, 5),
+  /* 0101001011 */ V(0, 2, 5),
+  /* 0101001100 */ V(0, 2, 5),
+  /* 0101001101 */ V(0, 2, 5),
+  /* 0101001110 */ V(0, 2, 5),
+  /* 0101001111 */ V(0, 2, 5),
+  /* 0101010000 */ V(0, 2, 5),
+  /* 0101010001 */ V(0, 2, 5),
+  /* 0101010010 */ V(0, 2, 5),
+  /* 0101010011 */ V(0, 2, 5),
+  /* 0101010100 */ V(0, 2, 5),
+  /* 0101010101 */ V(0, 2, 5),
+  /* 0101010110 */ V(0, 2, 5),
+  /* 0101010111 */ V(0, 2, 5),
+  /* 0101011000 */ V(0, 2, 5),
+  /* 0101011001 */ V(0, 2, 5),
+  /* 0101011010 */ V(0, 2, 5),
+  /* 0101011011 */ V(0, 2, 5),
+  /* 0101011100 */ V(0, 2, 5),
+  /* 0101011101 */ V(0, 2, 5),
+  /* 0101011110 */ V(0, 2, 5),
+  /* 0101011111 */ V(0, 2, 5),
+  /* 0101100000 */ V(2, 0, 5),
+  /* 0101100001 */ V(2, 0, 5),
+  /* 0101100010 */ V(2, 0, 5),
+  /* 0101100011 */ V(2, 0, 5),
+  /* 0101100100 */ V(2, 0, 5),
+  /* 0101100101 */ V(2, 0, 5),
+  /* 0101100110 */ V(2, 0, 5),
+  /* 0101100111 */ V(2, 0, 5),
+  /* 0101101000 */ V(2, 0, 5),
+  /* 0101101001 */ V(2, 0, 5),
+  /* 0101101010 */ V(2, 0, 5),
+  /* 0101101011 */ V(2, 0, 5),
+  /* 0101101100 */ V(2, 0, 5),
+  /* 0101101101 */ V(2, 0, 5),
+  /* 0101101110 */ V(2, 0, 5),
+  /* 0101101111 */ V(2, 0, 5),
+  /* 0101110000 */ V(2, 0, 5),
+  /* 0101110001 */ V(2, 0, 5),
+  /* 0101110010 */ V(2, 0, 5),
+  /* 0101110011 */ V(2, 0, 5),
+  /* 0101110100 */ V(2, 0, 5),
+  /* 0101110101 */ V(2, 0, 5),
+  /* 0101110110 */ V(2, 0, 5),
+  /* 0101110111 */ V(2, 0, 5),
+  /* 0101111000 */ V(2, 0, 5),
+  /* 0101111001 */ V(2, 0, 5),
+  /* 0101111010 */ V(2, 0, 5),
+  /* 0101111011 */ V(2, 0, 5),
+  /* 0101111100 */ V(2, 0, 5),
+  /* 0101111101 */ V(2, 0, 5),
+  /* 0101111110 */ V(2, 0, 5),
+  /* 0101111111 */ V(2, 0, 5),
+  /* 0110000000 */ V(1, 1, 3),
+  /* 0110000001 */ V(1, 1, 3),
+  /* 0110000010 */ V(1, 1, 3),
+  /* 0110000011 */ V(1, 1, 3),
+  /* 0110000100 */ V(1, 1, 3),
+  /* 0110000101 */ V(1, 1, 3),
+  /* 0110000110 */ V(1, 1, 3),
+  /* 0110000111 */ V(1, 1, 3),
+  /* 0110001000 */ V(1, 1, 3),
+  /* 0110001001 */ V(1, 1, 3),
+  /* 0110001010 */ V(1, 1, 3),
+  /* 0110001011 */ V(1, 1, 3),
+  /* 0110001100 */ V(1, 1, 3),
+  /* 0110001101 */ V(1, 1, 3),
+  /* 0110001110 */ V(1, 1, 3),
+  /* 0110001111 */ V(1, 1, 3),
+  /* 0110010000 */ V(1, 1, 3),
+  /* 0110010001 */ V(1, 1, 3),
+  /* 0110010010 */ V(1, 1, 3),
+  /* 0110010011 */ V(1, 1, 3),
+  /* 0110010100 */ V(1, 1, 3),
+  /* 0110010101 */ V(1, 1, 3),
+  /* 0110010110 */ V(1, 1, 3),
+  /* 0110010111 */ V(1, 1, 3),
+  /* 0110011000 */ V(1, 1, 3),
+  /* 0110011001 */ V(1, 1, 3),
+  /* 0110011010 */ V(1, 1, 3),
+  /* 0110011011 */ V(1, 1, 3),
+  /* 0110011100 */ V(1, 1, 3),
+  /* 0110011101 */ V(1, 1, 3),
+  /* 0110011110 */ V(1, 1, 3),
+  /* 0110011111 */ V(1, 1, 3),
+  /* 0110100000 */ V(1, 1, 3),
+  /* 0110100001 */ V(1, 1, 3),
+  /* 0110100010 */ V(1, 1, 3),
+  /* 0110100011 */ V(1, 1, 3),
+  /* 0110100100 */ V(1, 1, 3),
+  /* 0110100101 */ V(1, 1, 3),
+  /* 0110100110 */ V(1, 1, 3),
+  /* 0110100111 */ V(1, 1, 3),
+  /* 0110101000 */ V(1, 1, 3),
+  /* 0110101001 */ V(1, 1, 3),
+  /* 0110101010 */ V(1, 1, 3),
+  /* 0110101011 */ V(1, 1, 3),
+  /* 0110101100 */ V(1, 1, 3),
+  /* 0110101101 */ V(1, 1, 3),
+  /* 0110101110 */ V(1, 1, 3),
+  /* 0110101111 */ V(1, 1, 3),
+  /* 0110110000 */ V(1, 1, 3),
+  /* 0110110001 */ V(1, 1, 3),
+  /* 0110110010 */ V(1, 1, 3),
+  /* 0110110011 */ V(1, 1, 3),
+  /* 0110110100 */ V(1, 1, 3),
+  /* 0110110101 */ V(1, 1, 3),
+  /* 0110110110 */ V(1, 1, 3),
+  /* 0110110111 */ V(1, 1, 3),
+  /* 0110111000 */ V(1, 1, 3),
+  /* 0110111001 */ V(1, 1, 3),
+  /* 0110111010 */ V(1, 1, 3),
+  /* 0110111011 */ V(1, 1, 3),
+  /* 0110111100 */ V(1, 1, 3),
+  /* 0110111101 */ V(1, 1, 3),
+  /* 0110111110 */ V(1, 1, 3),
+  /* 0110111111 */ V(1, 1, 3),
+  /* 0111000000 */ V(1, 1, 3),
+  /* 0111000001 */ V(1, 1, 3),
+  /* 0111000010 */ V(1, 1, 3),
+  /* 0111000011 */ V(1, 1, 3),
+  /* 0111000100 */ V(1, 1, 3),
+  /* 0111000101 */ V(1, 1, 3),
+  /* 0111000110 */ V(1, 1, 3),
+  /* 0111000111 */ V(1, 1, 3),
+  /* 0111001000 */ V(1, 1, 3),
+  /* 0111001001 */ V(1, 1, 3),
+  /* 0111001010 */ V(1, 1, 3),
+  /* 0111001011 */ V(1, 1, 3),
+  /* 0111001100 */ V(1, 1, 3),
+  /* 0111001101 */ V(1, 1, 3),
+  /* 0111001110 */ V(1, 1, 3),
+  /* 0111001111 */ V(1, 1, 3),
+  /* 0111010000 */ V(1, 1, 3),
+  /* 0111010001 */ V(1, 1, 3),
+  /* 0111010010 */ V(1, 1, 3),
+  /* 0111010011 */ V(1, 1, 3),
+  /* 0111010100 */ V(1, 1, 3),
+  /* 0111010101 */ V(1, 1, 3),
+  /* 0111010110 */ V(1, 1, 3),
+  /* 0111010111 */ V(1, 1, 3),
+  /* 0111011000 */ V(1, 1, 3),
+  /* 0111011001 */ V(1, 1, 3),
+  /* 0111011010 */ V(1, 1, 3),
+  /* 0111011011 */ V(1, 1, 3),
+  /* 0111011100 */ V(1, 1, 3),
+  /* 0111011101 */ V(1, 1, 3),
+  /* 0111011110 */ V(1, 1, 3),
+  /* 0111011111 */ V(1, 1, 3),
+  /* 0111100000 */ V(1, 1, 3),
+  /* 0111100001 */ V(1, 1, 3),
+  /* 0111100010 */ V(1, 1, 3),
+  /* 0111100011 */ V(1, 1, 3),
+  /* 0111100100 */ V(1, 1, 3),
+  /* 0111100101 */ V(1, 1, 3),
+  /* 0111100110 */ V(1, 1, 3),
+  /* 0111100111 */ V(1, 1, 3),
+  /* 0111101000 */ V(1, 1, 3),
+  /* 0111101001 */ V(1, 1, 3),
+  /* 0111101010 */ V(1, 1, 3),
+  /* 0111101011 */ V(1, 1, 3),
+  /* 0111101100 */ V(1, 1, 3),
+  /* 0111101101 */ V(1, 1, 3),
+  /* 0111101110 */ V(1, 1, 3),
+  /* 0111101111 */ V(1, 1, 3),
+  /* 0111110000 */ V(1, 1, 3),
+  /* 0111110001 */ V(1, 1, 3),
+  /* 0111110010 */ V(1, 1, 3),
+  /* 0111110011 */ V(1, 1, 3),
+  /* 0111110100 */ V(1, 1, 3),
+  /* 0111110101 */ V(1, 1, 3),
+  /* 0111110110 */ V(1, 1, 3),
+  /* 0111110111 */ V(1, 1, 3),
+  /* 0111111000 */ V(1, 1, 3),
+  /* 0111111001 */ V(1, 1, 3),
+  /* 0111111010 */ V(1, 1, 3),
+  /* 0111111011 */ V(1, 1, 3),
+  /* 0111111100 */ V(1, 1, 3),
+  /* 0111111101 */ V(1, 1, 3),
+  /* 0111111110 */ V(1, 1, 3),
+  /* 0111111111 */ V(1, 1, 3),
+  /* 1000000000 */ V(0, 1, 3),
+  /* 1000000001 */ V(0, 1, 3),
+  /* 1000000010 */ V(0, 1, 3),
+  /* 1000000011 */ V(0, 1, 3),
+  /* 1000000100 */ V(0, 1, 3),
+  /* 1000000101 */ V(0, 1, 3),
+  /* 1000000110 */ V(0, 1, 3),
+  /* 1000000111 */ V(0, 1, 3),
+  /* 1000001000 */ V(0, 1, 3),
+  /* 1000001001 */ V(0, 1, 3),
+  /* 1000001010 */ V(0, 1, 3),
+  /* 1000001011 */ V(0, 1, 3),
+  /* 1000001100 */ V(0, 1, 3),
+  /* 1000001101 */ V(0, 1, 3),
+  /* 1000001110 */ V(0, 1, 3),
+  /* 1000001111 */ V(0, 1, 3),
+  /* 1000010000 */ V(0, 1, 3),
+  /* 1000010001 */ V(0, 1, 3),
+  /* 1000010010 */ V(0, 1, 3),
+  /* 1000010011 */ V(0, 1, 3),
+  /* 1000010100 */ V(0, 1, 3),
+  /* 1000010101 */ V(0, 1, 3),
+  /* 1000010110 */ V(0, 1, 3),
+  /* 1000010111 */ V(0, 1, 3),
+  /* 1000011000 */ V(0, 1, 3),
+  /* 1000011001 */ V(0, 1, 3),
+  /* 1000011010 */ V(0, 1, 3),
+  /* 1000011011 */ V(0, 1, 3),
+  /* 1000011100 */ V(0, 1, 3),
+  /* 1000011101 */ V(0, 1, 3),
+  /* 1000011110 */ V(0, 1, 3),
+  /* 1000011111 */ V(0, 1, 3),
+  /* 1000100000 */ V(0, 1, 3),
+  /* 1000100001 */ V(0, 1, 3),
+  /* 1000100010 */ V(0, 1, 3),
+  /* 1000100011 */ V(0, 1, 3),
+  /* 1000100100 */ V(0, 1, 3),
+  /* 1000100101 */ V(0, 1, 3),
+  /* 1000100110 */ V(0, 1, 3),
+  /* 1000100111 */ V(0, 1, 3),
+  /* 1000101000 */ V(0, 1, 3),
+  /* 1000101001 */ V(0, 1, 3),
+  /* 1000101010 */ V(0, 1, 3),
+  /* 1000101011 */ V(0, 1, 3),
+  /* 1000101100 */ V(0, 1, 3),
+  /* 1000101101 */ V(0, 1, 3),
+  /* 1000101110 */ V(0, 1, 3),
+  /* 1000101111 */ V(0, 1, 3),
+  /* 1000110000 */ V(0, 1, 3),
+  /* 1000110001 */ V(0, 1, 3),
+  /* 1000110010 */ V(0, 1, 3),
+  /* 1000110011 */ V(0, 1, 3),
+  /* 1000110100 */ V(0, 1, 3),
+  /* 1000110101 */ V(0, 1, 3),
+  /* 1000110110 */ V(0, 1, 3),
+  /* 1000110111 */ V(0, 1, 3),
+  /* 1000111000 */ V(0, 1, 3),
+  /* 1000111001 */ V(0, 1, 3),
+  /* 1000111010 */ V(0, 1, 3),
+  /* 1000111011 */ V(0, 1, 3),
+  /* 1000111100 */ V(0, 1, 3),
+  /* 1000111101 */ V(0, 1, 3),
+  /* 1000111110 */ V(0, 1, 3),
+  /* 1000111111 */ V(0, 1, 3),
+  /* 1001000000 */ V(0, 1, 3),
+  /* 1001000001 */ V(0, 1, 3),
+  /* 1001000010 */ V(0, 1, 3),
+  /* 1001000011 */ V(0, 1, 3),
+  /* 1001000100 */ V(0, 1, 3),
+  /* 1001000101 */ V(0, 1, 3),
+  /* 1001000110 */ V(0, 1, 3),
+  /* 1001000111 */ V(0, 1, 3),
+  /* 1001001000 */ V(0, 1, 3),
+  /* 1001001001 */ V(0, 1, 3),
+  /* 1001001010 */ V(0, 1, 3),
+  /* 1001001011 */ V(0, 1, 3),
+  /* 1001001100 */ V(0, 1, 3),
+  /* 1001001101 */ V(0, 1, 3),
+  /* 1001001110 */ V(0, 1, 3),
+  /* 1001001111 */ V(0, 1, 3),
+  /* 1001010000 */ V(0, 1, 3),
+  /* 1001010001 */ V(0, 1, 3),
+  /* 1001010010 */ V(0, 1, 3),
+  /* 1001010011 */ V(0, 1, 3),
+  /* 1001010100 */ V(0, 1, 3),
+  /* 1001010101 */ V(0, 1, 3),
+  /* 1001010110 */ V(0, 1, 3),
+  /* 1001010111 */ V(0, 1, 3),
+  /* 1001011000 */ V(0, 1, 3),
+  /* 1001011001 */ V(0, 1, 3),
+  /* 1001011010 */ V(0, 1, 3),
+  /* 1001011011 */ V(0, 1, 3),
+  /* 1001011100 */ V(0, 1, 3),
+  /* 1001011101 */ V(0, 1, 3),
+  /* 1001011110 */ V(0, 1, 3),
+  /* 1001011111 */ V(0, 1, 3),
+  /* 1001100000 */ V(0, 1, 3),
+  /* 1001100001 */ V(0, 1, 3),
+  /* 1001100010 */ V(0, 1, 3),
+  /* 1001100011 */ V(0, 1, 3),
+  /* 1001100100 */ V(0, 1, 3),
+  /* 1001100101 */ V(0, 1, 3),
+  /* 1001100110 */ V(0, 1, 3),
+  /* 1001100111 */ V(0, 1, 3),
+  /* 1001101000 */ V(0, 1, 3),
+  /* 1001101001 */ V(0, 1, 3),
+  /* 1001101010 */ V(0, 1, 3),
+  /* 1001101011 */ V(0, 1, 3),
+  /* 1001101100 */ V(0, 1, 3),
+  /* 1001101101 */ V(0, 1, 3),
+  /* 1001101110 */ V(0, 1, 3),
+  /* 1001101111 */ V(0, 1, 3),
+  /* 1001110000 */ V(0, 1, 3),
+  /* 1001110001 */ V(0, 1, 3),
+  /* 1001110010 */ V(0, 1, 3),
+  /* 1001110011 */ V(0, 1, 3),
+  /* 1001110100 */ V(0, 1, 3),
+  /* 1001110101 */ V(0, 1, 3),
+  /* 1001110110 */ V(0, 1, 3),
+  /* 1001110111 */ V(0, 1, 3),
+  /* 1001111000 */ V(0, 1, 3),
+  /* 1001111001 */ V(0, 1, 3),
+  /* 1001111010 */ V(0, 1, 3),
+  /* 1001111011 */ V(0, 1, 3),
+  /* 1001111100 */ V(0, 1, 3),
+  /* 1001111101 */ V(0, 1, 3),
+  /* 1001111110 */ V(0, 1, 3),
+  /* 1001111111 */ V(0, 1, 3),
+  /* 1010000000 */ V(1, 0, 3),
+  /* 1010000001 */ V(1, 0, 3),
+  /* 1010000010 */ V(1, 0, 3),
+  /* 1010000011 */ V(1, 0, 3),
+  /* 1010000100 */ V(1, 0, 3),
+  /* 1010000101 */ V(1, 0, 3),
+  /* 1010000110 */ V(1, 0, 3),
+  /* 1010000111 */ V(1, 0, 3),
+  /* 1010001000 */ V(1, 0, 3),
+  /* 1010001001 */ V(1, 0, 3),
+  /* 1010001010 */ V(1, 0, 3),
+  /* 1010001011 */ V(1, 0, 3),
+  /* 1010001100 */ V(1, 0, 3),
+  /* 1010001101 */ V(1, 0, 3),
+  /* 1010001110 */ V(1, 0, 3),
+  /* 1010001111 */ V(1, 0, 3),
+  /* 1010010000 */ V(1, 0, 3),
+  /* 1010010001 */ V(1, 0, 3),
+  /* 1010010010 */ V(1, 0, 3),
+  /* 1010010011 */ V(1, 0, 3),
+  /* 1010010100 */ V(1, 0, 3),
+  /* 1010010101 */ V(1, 0, 3),
+  /* 1010010110 */ V(1, 0, 3),
+  /* 1010010111 */ V(1, 0, 3),
+  /* 1010011000 */ V(1, 0, 3),
+  /* 1010011001 */ V(1, 0, 3),
+  /* 1010011010 */ V(1, 0, 3),
+  /* 1010011011 */ V(1, 0, 3),
+  /* 1010011100 */ V(1, 0, 3),
+  /* 1010011101 */ V(1, 0, 3),
+  /* 1010011110 */ V(1, 0, 3),
+  /* 1010011111 */ V(1, 0, 3),
+  /* 1010100000 */ V(1, 0, 3),
+  /* 1010100001 */ V(1, 0, 3),
+  /* 1010100010 */ V(1, 0, 3),
+  /* 1010100011 */ V(1, 0, 3),
+  /* 1010100100 */ V(1, 0, 3),
+  /* 1010100101 */ V(1, 0, 3),
+  /* 1010100110 */ V(1, 0, 3),
+  /* 1010100111 */ V(1, 0, 3),
+  /* 1010101000 */ V(1, 0, 3),
+  /* 1010101001 */ V(1, 0, 3),
+  /* 1010101010 */ V(1, 0, 3),
+  /* 1010101011 */ V(1, 0, 3),
+  /* 1010101100 */ V(1, 0, 3),
+  /* 1010101101 */ V(1, 0, 3),
+  /* 1010101110 */ V(1, 0, 3),
+  /* 1010101111 */ V(1, 0, 3),
+  /* 1010110000 */ V(1, 0, 3),
+  /* 1010110001 */ V(1, 0, 3),
+  /* 1010110010 */ V(1, 0, 3),
+  /* 1010110011 */ V(1, 0, 3),
+  /* 1010110100 */ V(1, 0, 3),
+  /* 1010110101 */ V(1, 0, 3),
+  /* 1010110110 */ V(1, 0, 3),
+  /* 1010110111 */ V(1, 0, 3),
+  /* 1010111000 */ V(1, 0, 3),
+  /* 1010111001 */ V(1, 0, 3),
+  /* 1010111010 */ V(1, 0, 3),
+  /* 1010111011 */ V(1, 0, 3),
+  /* 1010111100 */ V(1, 0, 3),
+  /* 1010111101 */ V(1, 0, 3),
+  /* 1010111110 */ V(1, 0, 3),
+  /* 1010111111 */ V(1, 0, 3),
+  /* 1011000000 */ V(1, 0, 3),
+  /* 1011000001 */ V(1, 0, 3),
+  /* 1011000010 */ V(1, 0, 3),
+  /* 1011000011 */ V(1, 0, 3),
+  /* 1011000100 */ V(1, 0, 3),
+  /* 1011000101 */ V(1, 0, 3),
+  /* 1011000110 */ V(1, 0, 3),
+  /* 1011000111 */ V(1, 0, 3),
+  /* 1011001000 */ V(1, 0, 3),
+  /* 1011001001 */ V(1, 0, 3),
+  /* 1011001010 */ V(1, 0, 3),
+  /* 1011001011 */ V(1, 0, 3),
+  /* 1011001100 */ V(1, 0, 3),
+  /* 1011001101 */ V(1, 0, 3),
+  /* 1011001110 */ V(1, 0, 3),
+  /* 1011001111 */ V(1, 0, 3),
+  /* 1011010000 */ V(1, 0, 3),
+  /* 1011010001 */ V(1, 0, 3),
+  /* 1011010010 */ V(1, 0, 3),
+  /* 1011010011 */ V(1, 0, 3),
+  /* 1011010100 */ V(1, 0, 3),
+  /* 1011010101 */ V(1, 0, 3),
+  /* 1011010110 */ V(1, 0, 3),
+  /* 1011010111 */ V(1, 0, 3),
+  /* 1011011000 */ V(1, 0, 3),
+  /* 1011011001 */ V(1, 0, 3),
+  /* 1011011010 */ V(1, 0, 3),
+  /* 1011011011 */ V(1, 0, 3),
+  /* 1011011100 */ V(1, 0, 3),
+  /* 1011011101 */ V(1, 0, 3),
+  /* 1011011110 */ V(1, 0, 3),
+  /* 1011011111 */ V(1, 0, 3),
+  /* 1011100000 */ V(1, 0, 3),
+  /* 1011100001 */ V(1, 0, 3),
+  /* 1011100010 */ V(1, 0, 3),
+  /* 1011100011 */ V(1, 0, 3),
+  /* 1011100100 */ V(1, 0, 3),
+  /* 1011100101 */ V(1, 0, 3),
+  /* 1011100110 */ V(1, 0, 3),
+  /* 1011100111 */ V(1, 0, 3),
+  /* 1011101000 */ V(1, 0, 3),
+  /* 1011101001 */ V(1, 0, 3),
+  /* 1011101010 */ V(1, 0, 3),
+  /* 1011101011 */ V(1, 0, 3),
+  /* 1011101100 */ V(1, 0, 3),
+  /* 1011101101 */ V(1, 0, 3),
+  /* 1011101110 */ V(1, 0, 3),
+  /* 1011101111 */ V(1, 0, 3),
+  /* 1011110000 */ V(1, 0, 3),
+  /* 1011110001 */ V(1, 0, 3),
+  /* 1011110010 */ V(1, 0, 3),
+  /* 1011110011 */ V(1, 0, 3),
+  /* 1011110100 */ V(1, 0, 3),
+  /* 1011110101 */ V(1, 0, 3),
+  /* 1011110110 */ V(1, 0, 3),
+  /* 1011110111 */ V(1, 0, 3),
+  /* 1011111000 */ V(1, 0, 3),
+  /* 1011111001 */ V(1, 0, 3),
+  /* 1011111010 */ V(1, 0, 3),
+  /* 1011111011 */ V(1, 0, 3),
+  /* 1011111100 */ V(1, 0, 3),
+  /* 1011111101 */ V(1, 0, 3),
+  /* 1011111110 */ V(1, 0, 3),
+  /* 1011111111 */ V(1, 0, 3),
+  /* 1100000000 */ V(0, 0, 2),
+  /* 1100000001 */ V(0, 0, 2),
+  /* 1100000010 */ V(0, 0, 2),
+  /* 1100000011 */ V(0, 0, 2),
+  /* 1100000100 */ V(0, 0, 2),
+  /* 1100000101 */ V(0, 0, 2),
+  /* 1100000110 */ V(0, 0, 2),
+  /* 1100000111 */ V(0, 0, 2),
+  /* 1100001000 */ V(0, 0, 2),
+  /* 1100001001 */ V(0, 0, 2),
+  /* 1100001010 */ V(0, 0, 2),
+  /* 1100001011 */ V(0, 0, 2),
+  /* 1100001100 */ V(0, 0, 2),
+  /* 1100001101 */ V(0, 0, 2),
+  /* 1100001110 */ V(0, 0, 2),
+  /* 1100001111 */ V(0, 0, 2),
+  /* 1100010000 */ V(0, 0, 2),
+  /* 1100010001 */ V(0, 0, 2),
+  /* 1100010010 */ V(0, 0, 2),
+  /* 1100010011 */ V(0, 0, 2),
+  /* 1100010100 */ V(0, 0, 2),
+  /* 1100010101 */ V(0, 0, 2),
+  /* 1100010110 */ V(0, 0, 2),
+  /* 1100010111 */ V(0, 0, 2),
+  /* 1100011000 */ V(0, 0, 2),
+  /* 1100011001 */ V(0, 0, 2),
+  /* 1100011010 */ V(0, 0, 2),
+  /* 1100011011 */ V(0, 0, 2),
+  /* 1100011100 */ V(0, 0, 2),
+  /* 1100011101 */ V(0, 0, 2),
+  /* 1100011110 */ V(0, 0, 2),
+  /* 1100011111 */ V(0, 0, 2),
+  /* 1100100000 */ V(0, 0, 2),
+  /* 1100100001 */ V(0, 0, 2),
+  /* 1100100010 */ V(0, 0, 2),
+  /* 1100100011 */ V(0, 0, 2),
+  /* 1100100100 */ V(0, 0, 2),
+  /* 1100100101 */ V(0, 0, 2),
+  /* 1100100110 */ V(0, 0, 2),
+  /* 1100100111 */ V(0, 0, 2),
+  /* 1100101000 */ V(0, 0, 2),
+  /* 1100101001 */ V(0, 0, 2),
+  /* 1100101010 */ V(0, 0, 2),
+  /* 1100101011 */ V(0, 0, 2),
+  /* 1100101100 */ V(0, 0, 2),
+  /* 1100101101 */ V(0, 0, 2),
+  /* 1100101110 */ V(0, 0, 2),
+  /* 1100101111 */ V(0, 0, 2),
+  /* 1100110000 */ V(0, 0, 2),
+  /* 1100110001 */ V(0, 0, 2),
+  /* 1100110010 */ V(0, 0, 2),
+  /* 1100110011 */ V(0, 0, 2),
+  /* 1100110100 */ V(0, 0, 2),
+  /* 1100110101 */ V(0, 0, 2),
+  /* 1100110110 */ V(0, 0, 2),
+  /* 1100110111 */ V(0, 0, 2),
+  /* 1100111000 */ V(0, 0, 2),
+  /* 1100111001 */ V(0, 0, 2),
+  /* 1100111010 */ V(0, 0, 2),
+  /* 1100111011 */ V(0, 0, 2),
+  /* 1100111100 */ V(0, 0, 2),
+  /* 1100111101 */ V(0, 0, 2),
+  /* 1100111110 */ V(0, 0, 2),
+  /* 1100111111 */ V(0, 0, 2),
+  /* 1101000000 */ V(0, 0, 2),
+  /* 1101000001 */ V(0, 0, 2),
+  /* 1101000010 */ V(0, 0, 2),
+  /* 1101000011 */ V(0, 0, 2),
+  /* 1101000100 */ V(0, 0, 2),
+  /* 1101000101 */ V(0, 0, 2),
+  /* 1101000110 */ V(0, 0, 2),
+  /* 1101000111 */ V(0, 0, 2),
+  /* 1101001000 */ V(0, 0, 2),
+  /* 1101001001 */ V(0, 0, 2),
+  /* 1101001010 */ V(0, 0, 2),
+  /* 1101001011 */ V(0, 0, 2),
+  /* 1101001100 */ V(0, 0, 2),
+  /* 1101001101 */ V(0, 0, 2),
+  /* 1101001110 */ V(0, 0, 2),
+  /* 1101001111 */ V(0, 0, 2),
+  /* 1101010000 */ V(0, 0, 2),
+  /* 1101010001 */ V(0, 0, 2),
+  /* 1101010010 */ V(0, 0, 2),
+  /* 1101010011 */ V(0, 0, 2),
+  /* 1101010100 */ V(0, 0, 2),
+  /* 1101010101 */ V(0, 0, 2),
+  /* 1101010110 */ V(0, 0, 2),
+  /* 1101010111 */ V(0, 0, 2),
+  /* 1101011000 */ V(0, 0, 2),
+  /* 1101011001 */ V(0, 0, 2),
+  /* 1101011010 */ V(0, 0, 2),
+  /* 1101011011 */ V(0, 0, 2),
+  /* 1101011100 */ V(0, 0, 2),
+  /* 1101011101 */ V(0, 0, 2),
+  /* 1101011110 */ V(0, 0, 2),
+  /* 1101011111 */ V(0, 0, 2),
+  /* 1101100000 */ V(0, 0, 2),
+  /* 1101100001 */ V(0, 0, 2),
+  /* 1101100010 */ V(0, 0, 2),
+  /* 1101100011 */ V(0, 0, 2),
+  /* 1101100100 */ V(0, 0, 2),
+  /* 1101100101 */ V(0, 0, 2),
+  /* 1101100110 */ V(0, 0, 2),
+  /* 1101100111 */ V(0, 0, 2),
+  /* 1101101000 */ V(0, 0, 2),
+  /* 1101101001 */ V(0, 0, 2),
+  /* 1101101010 */ V(0, 0, 2),
+  /* 1101101011 */ V(0, 0, 2),
+  /* 1101101100 */ V(0, 0, 2),
+  /* 1101101101 */ V(0, 0, 2),
+  /* 1101101110 */ V(0, 0, 2),
+  /* 1101101111 */ V(0, 0, 2),
+  /* 1101110000 */ V(0, 0, 2),
+  /* 1101110001 */ V(0, 0, 2),
+  /* 1101110010 */ V(0, 0, 2),
+  /* 1101110011 */ V(0, 0, 2),
+  /* 1101110100 */ V(0, 0, 2),
+  /* 1101110101 */ V(0, 0, 2),
+  /* 1101110110 */ V(0, 0, 2),
+  /* 1101110111 */ V(0, 0, 2),
+  /* 1101111000 */ V(0, 0, 2),
+  /* 1101111001 */ V(0, 0, 2),
+  /* 1101111010 */ V(0, 0, 2),
+  /* 1101111011 */ V(0, 0, 2),
+  /* 1101111100 */ V(0, 0, 2),
+  /* 1101111101 */ V(0, 0, 2),
+  /* 1101111110 */ V(0, 0, 2),
+  /* 1101111111 */ V(0, 0, 2),
+  /* 1110000000 */ V(0, 0, 2),
+  /* 1110000001 */ V(0, 0, 2),
+  /* 1110000010 */ V(0, 0, 2),
+  /* 1110000011 */ V(0, 0, 2),
+  /* 1110000100 */ V(0, 0, 2),
+  /* 1110000101 */ V(0, 0, 2),
+  /* 1110000110 */ V(0, 0, 2),
+  /* 1110000111 */ V(0, 0, 2),
+  /* 1110001000 */ V(0, 0, 2),
+  /* 1110001001 */ V(0, 0, 2),
+  /* 1110001010 */ V(0, 0, 2),
+  /* 1110001011 */ V(0, 0, 2),
+  /* 1110001100 */ V(0, 0, 2),
+  /* 1110001101 */ V(0, 0, 2),
+  /* 1110001110 */ V(0, 0, 2),
+  /* 1110001111 */ V(0, 0, 2),
+  /* 1110010000 */ V(0, 0, 2),
+  /* 1110010001 */ V(0, 0, 2),
+  /* 1110010010 */ V(0, 0, 2),
+  /* 1110010011 */ V(0, 0, 2),
+  /* 1110010100 */ V(0, 0, 2),
+  /* 1110010101 */ V(0, 0, 2),
+  /* 1110010110 */ V(0, 0, 2),
+  /* 1110010111 */ V(0, 0, 2),
+  /* 1110011000 */ V(0, 0, 2),
+  /* 1110011001 */ V(0, 0, 2),
+  /* 1110011010 */ V(0, 0, 2),
+  /* 1110011011 */ V(0, 0, 2),
+  /* 1110011100 */ V(0, 0, 2),
+  /* 1110011101 */ V(0, 0, 2),
+  /* 1110011110 */ V(0, 0, 2),
+  /* 1110011111 */ V(0, 0, 2),
+  /* 1110100000 */ V(0, 0, 2),
+  /* 1110100001 */ V(0, 0, 2),
+  /* 1110100010 */ V(0, 0, 2),
+  /* 1110100011 */ V(0, 0, 2),
+  /* 1110100100 */ V(0, 0, 2),
+  /* 1110100101 */ V(0, 0, 2),
+  /* 1110100110 */ V(0, 0, 2),
+  /* 1110100111 */ V(0, 0, 2),
+  /* 1110101000 */ V(0, 0, 2),
+  /* 1110101001 */ V(0, 0, 2),
+  /* 1110101010 */ V(0, 0, 2),
+  /* 1110101011 */ V(0, 0, 2),
+  /* 1110101100 */ V(0, 0, 2),
+  /* 1110101101 */ V(0, 0, 2),
+  /* 1110101110 */ V(0, 0, 2),
+  /* 1110101111 */ V(0, 0, 2),
+  /* 1110110000 */ V(0, 0, 2),
+  /* 1110110001 */ V(0, 0, 2),
+  /* 1110110010 */ V(0, 0, 2),
+  /* 1110110011 */ V(0, 0, 2),
+  /* 1110110100 */ V(0, 0, 2),
+  /* 1110110101 */ V(0, 0, 2),
+  /* 1110110110 */ V(0, 0, 2),
+  /* 1110110111 */ V(0, 0, 2),
+  /* 1110111000 */ V(0, 0, 2),
+  /* 1110111001 */ V(0, 0, 2),
+  /* 1110111010 */ V(0, 0, 2),
+  /* 1110111011 */ V(0, 0, 2),
+  /* 1110111100 */ V(0, 0, 2),
+  /* 1110111101 */ V(0, 0, 2),
+  /* 1110111110 */ V(0, 0, 2),
+  /* 1110111111 */ V(0, 0, 2),
+  /* 1111000000 */ V(0, 0, 2),
+  /* 1111000001 */ V(0, 0, 2),
+  /* 1111000010 */ V(0, 0, 2),
+  /* 1111000011 */ V(0, 0, 2),
+  /* 1111000100 */ V(0, 0, 2),
+  /* 1111000101 */ V(0, 0, 2),
+  /* 1111000110 */ V(0, 0, 2),
+  /* 1111000111 */ V(0, 0, 2),
+  /* 1111001000 */ V(0, 0, 2),
+  /* 1111001001 */ V(0, 0, 2),
+  /* 1111001010 */ V(0, 0, 2),
+  /* 1111001011 */ V(0, 0, 2),
+  /* 1111001100 */ V(0, 0, 2),
+  /* 1111001101 */ V(0, 0, 2),
+  /* 1111001110 */ V(0, 0, 2),
+  /* 1111001111 */ V(0, 0, 2),
+  /* 1111010000 */ V(0, 0, 2),
+  /* 1111010001 */ V(0, 0, 2),
+  /* 1111010010 */ V(0, 0, 2),
+  /* 1111010011 */ V(0, 0, 2),
+  /* 1111010100 */ V(0, 0, 2),
+  /* 1111010101 */ V(0, 0, 2),
+  /* 1111010110 */ V(0, 0, 2),
+  /* 1111010111 */ V(0, 0, 2),
+  /* 1111011000 */ V(0, 0, 2),
+  /* 1111011001 */ V(0, 0, 2),
+  /* 1111011010 */ V(0, 0, 2),
+  /* 1111011011 */ V(0, 0, 2),
+  /* 1111011100 */ V(0, 0, 2),
+  /* 1111011101 */ V(0, 0, 2),
+  /* 1111011110 */ V(0, 0, 2),
+  /* 1111011111 */ V(0, 0, 2),
+  /* 1111100000 */ V(0, 0, 2),
+  /* 1111100001 */ V(0, 0, 2),
+  /* 1111100010 */ V(0, 0, 2),
+  /* 1111100011 */ V(0, 0, 2),
+  /* 1111100100 */ V(0, 0, 2),
+  /* 1111100101 */ V(0, 0, 2),
+  /* 1111100110 */ V(0, 0, 2),
+  /* 1111100111 */ V(0, 0, 2),
+  /* 1111101000 */ V(0, 0, 2),
+  /* 1111101001 */ V(0, 0, 2),
+  /* 1111101010 */ V(0, 0, 2),
+  /* 1111101011 */ V(0, 0, 2),
+  /* 1111101100 */ V(0, 0, 2),
+  /* 1111101101 */ V(0, 0, 2),
+  /* 1111101110 */ V(0, 0, 2),
+  /* 1111101111 */ V(0, 0, 2),
+  /* 1111110000 */ V(0, 0, 2),
+  /* 1111110001 */ V(0, 0, 2),
+  /* 1111110010 */ V(0, 0, 2),
+  /* 1111110011 */ V(0, 0, 2),
+  /* 1111110100 */ V(0, 0, 2),
+  /* 1111110101 */ V(0, 0, 2),
+  /* 1111110110 */ V(0, 0, 2),
+  /* 1111110111 */ V(0, 0, 2),
+  /* 1111111000 */ V(0, 0, 2),
+  /* 1111111001 */ V(0, 0, 2),
+  /* 1111111010 */ V(0, 0, 2),
+  /* 1111111011 */ V(0, 0, 2),
+  /* 1111111100 */ V(0, 0, 2),
+  /* 1111111101 */ V(0, 0, 2),
+  /* 1111111110 */ V(0, 0, 2),
+  /* 1111111111 */ V(0, 0, 2),
+
+  /* 0000 0001 11 ... */
+  /* 0    */ V(5, 7, 1),	/* 1024 */
+  /* 1    */ V(5, 5, 1)
 };
 
 static
 union huffpair const hufftab12[] = {
-  /* 0000 */ PTR(16, 4),
-  /* 0001 */ PTR(32, 4),
-  /* 0010 */ PTR(48, 4),
-  /* 0011 */ PTR(64, 2),
-  /* 0100 */ PTR(68, 3),
-  /* 0101 */ PTR(76, 1),
-  /* 0110 */ V(1, 2, 4),
-  /* 0111 */ V(2, 1, 4),
-  /* 1000 */ PTR(78, 1),
-  /* 1001 */ V(0, 0, 4),
-  /* 1010 */ V(1, 1, 3),
-  /* 1011 */ V(1, 1, 3),
-  /* 1100 */ V(0, 1, 3),
-  /* 1101 */ V(0, 1, 3),
-  /* 1110 */ V(1, 0, 3),
-  /* 1111 */ V(1, 0, 3),
-
-  /* 0000 ... */
-  /* 0000 */ PTR(80, 2),	/* 16 */
-  /* 0001 */ PTR(84, 1),
-  /* 0010 */ PTR(86, 1),
-  /* 0011 */ PTR(88, 1),
-  /* 0100 */ V(5, 6, 4),
-  /* 0101 */ V(3, 7, 4),
-  /* 0110 */ PTR(90, 1),
-  /* 0111 */ V(2, 7, 4),
-  /* 1000 */ V(7, 2, 4),
-  /* 1001 */ V(4, 6, 4),
-  /* 1010 */ V(6, 4, 4),
-  /* 1011 */ V(1, 7, 4),
-  /* 1100 */ V(7, 1, 4),
-  /* 1101 */ PTR(92, 1),
-  /* 1110 */ V(3, 6, 4),
-  /* 1111 */ V(6, 3, 4),
-
-  /* 0001 ... */
-  /* 0000 */ V(4, 5, 4),	/* 32 */
-  /* 0001 */ V(5, 4, 4),
-  /* 0010 */ V(4, 4, 4),
-  /* 0011 */ PTR(94, 1),
-  /* 0100 */ V(2, 6, 3),
-  /* 0101 */ V(2, 6, 3),
-  /* 0110 */ V(6, 2, 3),
-  /* 0111 */ V(6, 2, 3),
-  /* 1000 */ V(6, 1, 3),
-  /* 1001 */ V(6, 1, 3),
-  /* 1010 */ V(1, 6, 4),
-  /* 1011 */ V(6, 0, 4),
-  /* 1100 */ V(3, 5, 4),
-  /* 1101 */ V(5, 3, 4),
-  /* 1110 */ V(2, 5, 4),
-  /* 1111 */ V(5, 2, 4),
-
-  /* 0010 ... */
-  /* 0000 */ V(1, 5, 3),	/* 48 */
-  /* 0001 */ V(1, 5, 3),
-  /* 0010 */ V(5, 1, 3),
-  /* 0011 */ V(5, 1, 3),
-  /* 0100 */ V(3, 4, 3),
-  /* 0101 */ V(3, 4, 3),
-  /* 0110 */ V(4, 3, 3),
-  /* 0111 */ V(4, 3, 3),
-  /* 1000 */ V(5, 0, 4),
-  /* 1001 */ V(0, 4, 4),
-  /* 1010 */ V(2, 4, 3),
-  /* 1011 */ V(2, 4, 3),
-  /* 1100 */ V(4, 2, 3),
-  /* 1101 */ V(4, 2, 3),
-  /* 1110 */ V(1, 4, 3),
-  /* 1111 */ V(1, 4, 3),
-
-  /* 0011 ... */
-  /* 00   */ V(3, 3, 2),	/* 64 */
-  /* 01   */ V(4, 1, 2),
-  /* 10   */ V(2, 3, 2),
-  /* 11   */ V(3, 2, 2),
-
-  /* 0100 ... */
-  /* 000  */ V(4, 0, 3),	/* 68 */
-  /* 001  */ V(0, 3, 3),
-  /* 010  */ V(3, 0, 2),
-  /* 011  */ V(3, 0, 2),
-  /* 100  */ V(1, 3, 1),
-  /* 101  */ V(1, 3, 1),
-  /* 110  */ V(1, 3, 1),
-  /* 111  */ V(1, 3, 1),
-
-  /* 0101 ... */
-  /* 0    */ V(3, 1, 1),	/* 76 */
-  /* 1    */ V(2, 2, 1),
-
-  /* 1000 ... */
-  /* 0    */ V(0, 2, 1),	/* 78 */
-  /* 1    */ V(2, 0, 1),
-
-  /* 0000 0000 ... */
-  /* 00   */ V(7, 7, 2),	/* 80 */
-  /* 01   */ V(6, 7, 2),
-  /* 10   */ V(7, 6, 1),
-  /* 11   */ V(7, 6, 1),
-
-  /* 0000 0001 ... */
-  /* 0    */ V(5, 7, 1),	/* 84 */
-  /* 1    */ V(7, 5, 1),
-
-  /* 0000 0010 ... */
-  /* 0    */ V(6, 6, 1),	/* 86 */
-  /* 1    */ V(4, 7, 1),
-
-  /* 0000 0011 ... */
-  /* 0    */ V(7, 4, 1),	/* 88 */
-  /* 1    */ V(6, 5, 1),
-
-  /* 0000 0110 ... */
-  /* 0    */ V(7, 3, 1),	/* 90 */
-  /* 1    */ V(5, 5, 1),
-
-  /* 0000 1101 ... */
-  /* 0    */ V(0, 7, 1),	/* 92 */
-  /* 1    */ V(7, 0, 1),
-
-  /* 0001 0011 ... */
-  /* 0    */ V(0, 6, 1),	/* 94 */
-  /* 1    */ V(0, 5, 1)
+  /* 0000000000 */ V(7, 7, 10),
+  /* 0000000001 */ V(6, 7, 10),
+  /* 0000000010 */ V(7, 6, 9),
+  /* 0000000011 */ V(7, 6, 9),
+  /* 0000000100 */ V(5, 7, 9),
+  /* 0000000101 */ V(5, 7, 9),
+  /* 0000000110 */ V(7, 5, 9),
+  /* 0000000111 */ V(7, 5, 9),
+  /* 0000001000 */ V(6, 6, 9),
+  /* 0000001001 */ V(6, 6, 9),
+  /* 0000001010 */ V(4, 7, 9),
+  /* 0000001011 */ V(4, 7, 9),
+  /* 0000001100 */ V(7, 4, 9),
+  /* 0000001101 */ V(7, 4, 9),
+  /* 0000001110 */ V(6, 5, 9),
+  /* 0000001111 */ V(6, 5, 9),
+  /* 0000010000 */ V(5, 6, 8),
+  /* 0000010001 */ V(5, 6, 8),
+  /* 0000010010 */ V(5, 6, 8),
+  /* 0000010011 */ V(5, 6, 8),
+  /* 0000010100 */ V(3, 7, 8),
+  /* 0000010101 */ V(3, 7, 8),
+  /* 0000010110 */ V(3, 7, 8),
+  /* 0000010111 */ V(3, 7, 8),
+  /* 0000011000 */ V(7, 3, 9),
+  /* 0000011001 */ V(7, 3, 9),
+  /* 0000011010 */ V(5, 5, 9),
+  /* 0000011011 */ V(5, 5, 9),
+  /* 0000011100 */ V(2, 7, 8),
+  /* 0000011101 */ V(2, 7, 8),
+  /* 0000011110 */ V(2, 7, 8),
+  /* 0000011111 */ V(2, 7, 8),
+  /* 0000100000 */ V(7, 2, 8),
+  /* 0000100001 */ V(7, 2, 8),
+  /* 0000100010 */ V(7, 2, 8),
+  /* 0000100011 */ V(7, 2, 8),
+  /* 0000100100 */ V(4, 6, 8),
+  /* 0000100101 */ V(4, 6, 8),
+  /* 0000100110 */ V(4, 6, 8),
+  /* 0000100111 */ V(4, 6, 8),
+  /* 0000101000 */ V(6, 4, 8),
+  /* 0000101001 */ V(6, 4, 8),
+  /* 0000101010 */ V(6, 4, 8),
+  /* 0000101011 */ V(6, 4, 8),
+  /* 0000101100 */ V(1, 7, 8),
+  /* 0000101101 */ V(1, 7, 8),
+  /* 0000101110 */ V(1, 7, 8),
+  /* 0000101111 */ V(1, 7, 8),
+  /* 0000110000 */ V(7, 1, 8),
+  /* 0000110001 */ V(7, 1, 8),
+  /* 0000110010 */ V(7, 1, 8),
+  /* 0000110011 */ V(7, 1, 8),
+  /* 0000110100 */ V(0, 7, 9),
+  /* 0000110101 */ V(0, 7, 9),
+  /* 0000110110 */ V(7, 0, 9),
+  /* 0000110111 */ V(7, 0, 9),
+  /* 0000111000 */ V(3, 6, 8),
+  /* 0000111001 */ V(3, 6, 8),
+  /* 0000111010 */ V(3, 6, 8),
+  /* 0000111011 */ V(3, 6, 8),
+  /* 0000111100 */ V(6, 3, 8),
+  /* 0000111101 */ V(6, 3, 8),
+  /* 0000111110 */ V(6, 3, 8),
+  /* 0000111111 */ V(6, 3, 8),
+  /* 0001000000 */ V(4, 5, 8),
+  /* 0001000001 */ V(4, 5, 8),
+  /* 0001000010 */ V(4, 5, 8),
+  /* 0001000011 */ V(4, 5, 8),
+  /* 0001000100 */ V(5, 4, 8),
+  /* 0001000101 */ V(5, 4, 8),
+  /* 0001000110 */ V(5, 4, 8),
+  /* 0001000111 */ V(5, 4, 8),
+  /* 0001001000 */ V(4, 4, 8),
+  /* 0001001001 */ V(4, 4, 8),
+  /* 0001001010 */ V(4, 4, 8),
+  /* 0001001011 */ V(4, 4, 8),
+  /* 0001001100 */ V(0, 6, 9),
+  /* 0001001101 */ V(0, 6, 9),
+  /* 0001001110 */ V(0, 5, 9),
+  /* 0001001111 */ V(0, 5, 9),
+  /* 0001010000 */ V(2, 6, 7),
+  /* 0001010001 */ V(2, 6, 7),
+  /* 0001010010 */ V(2, 6, 7),
+  /* 0001010011 */ V(2, 6, 7),
+  /* 0001010100 */ V(2, 6, 7),
+  /* 0001010101 */ V(2, 6, 7),
+  /* 0001010110 */ V(2, 6, 7),
+  /* 0001010111 */ V(2, 6, 7),
+  /* 0001011000 */ V(6, 2, 7),
+  /* 0001011001 */ V(6, 2, 7),
+  /* 0001011010 */ V(6, 2, 7),
+  /* 0001011011 */ V(6, 2, 7),
+  /* 0001011100 */ V(6, 2, 7),
+  /* 0001011101 */ V(6, 2, 7),
+  /* 0001011110 */ V(6, 2, 7),
+  /* 0001011111 */ V(6, 2, 7),
+  /* 0001100000 */ V(6, 1, 7),
+  /* 0001100001 */ V(6, 1, 7),
+  /* 0001100010 */ V(6, 1, 7),
+  /* 0001100011 */ V(6, 1, 7),
+  /* 0001100100 */ V(6, 1, 7),
+  /* 0001100101 */ V(6, 1, 7),
+  /* 0001100110 */ V(6, 1, 7),
+  /* 0001100111 */ V(6, 1, 7),
+  /* 0001101000 */ V(1, 6, 8),
+  /* 0001101001 */ V(1, 6, 8),
+  /* 0001101010 */ V(1, 6, 8),
+  /* 0001101011 */ V(1, 6, 8),
+  /* 0001101100 */ V(6, 0, 8),
+  /* 0001101101 */ V(6, 0, 8),
+  /* 0001101110 */ V(6, 0, 8),
+  /* 0001101111 */ V(6, 0, 8),
+  /* 0001110000 */ V(3, 5, 8),
+  /* 0001110001 */ V(3, 5, 8),
+  /* 0001110010 */ V(3, 5, 8),
+  /* 0001110011 */ V(3, 5, 8),
+  /* 0001110100 */ V(5, 3, 8),
+  /* 0001110101 */ V(5, 3, 8),
+  /* 0001110110 */ V(5, 3, 8),
+  /* 0001110111 */ V(5, 3, 8),
+  /* 0001111000 */ V(2, 5, 8),
+  /* 0001111001 */ V(2, 5, 8),
+  /* 0001111010 */ V(2, 5, 8),
+  /* 0001111011 */ V(2, 5, 8),
+  /* 0001111100 */ V(5, 2, 8),
+  /* 0001111101 */ V(5, 2, 8),
+  /* 0001111110 */ V(5, 2, 8),
+  /* 0001111111 */ V(5, 2, 8),
+  /* 0010000000 */ V(1, 5, 7),
+  /* 0010000001 */ V(1, 5, 7),
+  /* 0010000010 */ V(1, 5, 7),
+  /* 0010000011 */ V(1, 5, 7),
+  /* 0010000100 */ V(1, 5, 7),
+  /* 0010000101 */ V(1, 5, 7),
+  /* 0010000110 */ V(1, 5, 7),
+  /* 0010000111 */ V(1, 5, 7),
+  /* 0010001000 */ V(5, 1, 7),
+  /* 0010001001 */ V(5, 1, 7),
+  /* 0010001010 */ V(5, 1, 7),
+  /* 0010001011 */ V(5, 1, 7),
+  /* 0010001100 */ V(5, 1, 7),
+  /* 0010001101 */ V(5, 1, 7),
+  /* 0010001110 */ V(5, 1, 7),
+  /* 0010001111 */ V(5, 1, 7),
+  /* 0010010000 */ V(3, 4, 7),
+  /* 0010010001 */ V(3, 4, 7),
+  /* 0010010010 */ V(3, 4, 7),
+  /* 0010010011 */ V(3, 4, 7),
+  /* 0010010100 */ V(3, 4, 7),
+  /* 0010010101 */ V(3, 4, 7),
+  /* 0010010110 */ V(3, 4, 7),
+  /* 0010010111 */ V(3, 4, 7),
+  /* 0010011000 */ V(4, 3, 7),
+  /* 0010011001 */ V(4, 3, 7),
+  /* 0010011010 */ V(4, 3, 7),
+  /* 0010011011 */ V(4, 3, 7),
+  /* 0010011100 */ V(4, 3, 7),
+  /* 0010011101 */ V(4, 3, 7),
+  /* 0010011110 */ V(4, 3, 7),
+  /* 0010011111 */ V(4, 3, 7),
+  /* 0010100000 */ V(5, 0, 8),
+  /* 0010100001 */ V(5, 0, 8),
+  /* 0010100010 */ V(5, 0, 8),
+  /* 0010100011 */ V(5, 0, 8),
+  /* 0010100100 */ V(0, 4, 8),
+  /* 0010100101 */ V(0, 4, 8),
+  /* 0010100110 */ V(0, 4, 8),
+  /* 0010100111 */ V(0, 4, 8),
+  /* 0010101000 */ V(2, 4, 7),
+  /* 0010101001 */ V(2, 4, 7),
+  /* 0010101010 */ V(2, 4, 7),
+  /* 0010101011 */ V(2, 4, 7),
+  /* 0010101100 */ V(2, 4, 7),
+  /* 0010101101 */ V(2, 4, 7),
+  /* 0010101110 */ V(2, 4, 7),
+  /* 0010101111 */ V(2, 4, 7),
+  /* 0010110000 */ V(4, 2, 7),
+  /* 0010110001 */ V(4, 2, 7),
+  /* 0010110010 */ V(4, 2, 7),
+  /* 0010110011 */ V(4, 2, 7),
+  /* 0010110100 */ V(4, 2, 7),
+  /* 0010110101 */ V(4, 2, 7),
+  /* 0010110110 */ V(4, 2, 7),
+  /* 0010110111 */ V(4, 2, 7),
+  /* 0010111000 */ V(1, 4, 7),
+  /* 0010111001 */ V(1, 4, 7),
+  /* 0010111010 */ V(1, 4, 7),
+  /* 0010111011 */ V(1, 4, 7),
+  /* 0010111100 */ V(1, 4, 7),
+  /* 0010111101 */ V(1, 4, 7),
+  /* 0010111110 */ V(1, 4, 7),
+  /* 0010111111 */ V(1, 4, 7),
+  /* 0011000000 */ V(3, 3, 6),
+  /* 0011000001 */ V(3, 3, 6),
+  /* 0011000010 */ V(3, 3, 6),
+  /* 0011000011 */ V(3, 3, 6),
+  /* 0011000100 */ V(3, 3, 6),
+  /* 0011000101 */ V(3, 3, 6),
+  /* 0011000110 */ V(3, 3, 6),
+  /* 0011000111 */ V(3, 3, 6),
+  /* 0011001000 */ V(3, 3, 6),
+  /* 0011001001 */ V(3, 3, 6),
+  /* 0011001010 */ V(3, 3, 6),
+  /* 0011001011 */ V(3, 3, 6),
+  /* 0011001100 */ V(3, 3, 6),
+  /* 0011001101 */ V(3, 3, 6),
+  /* 0011001110 */ V(3, 3, 6),
+  /* 0011001111 */ V(3, 3, 6),
+  /* 0011010000 */ V(4, 1, 6),
+  /* 0011010001 */ V(4, 1, 6),
+  /* 0011010010 */ V(4, 1, 6),
+  /* 0011010011 */ V(4, 1, 6),
+  /* 0011010100 */ V(4, 1, 6),
+  /* 0011010101 */ V(4, 1, 6),
+  /* 0011010110 */ V(4, 1, 6),
+  /* 0011010111 */ V(4, 1, 6),
+  /* 0011011000 */ V(4, 1, 6),
+  /* 0011011001 */ V(4, 1, 6),
+  /* 0011011010 */ V(4, 1, 6),
+  /* 0011011011 */ V(4, 1, 6),
+  /* 0011011100 */ V(4, 1, 6),
+  /* 0011011101 */ V(4, 1, 6),
+  /* 0011011110 */ V(4, 1, 6),
+  /* 0011011111 */ V(4, 1, 6),
+  /* 0011100000 */ V(2, 3, 6),
+  /* 0011100001 */ V(2, 3, 6),
+  /* 0011100010 */ V(2, 3, 6),
+  /* 0011100011 */ V(2, 3, 6),
+  /* 0011100100 */ V(2, 3, 6),
+  /* 0011100101 */ V(2, 3, 6),
+  /* 0011100110 */ V(2, 3, 6),
+  /* 0011100111 */ V(2, 3, 6),
+  /* 0011101000 */ V(2, 3, 6),
+  /* 0011101001 */ V(2, 3, 6),
+  /* 0011101010 */ V(2, 3, 6),
+  /* 0011101011 */ V(2, 3, 6),
+  /* 0011101100 */ V(2, 3, 6),
+  /* 0011101101 */ V(2, 3, 6),
+  /* 0011101110 */ V(2, 3, 6),
+  /* 0011101111 */ V(2, 3, 6),
+  /* 0011110000 */ V(3, 2, 6),
+  /* 0011110001 */ V(3, 2, 6),
+  /* 0011110010 */ V(3, 2, 6),
+  /* 0011110011 */ V(3, 2, 6),
+  /* 0011110100 */ V(3, 2, 6),
+  /* 0011110101 */ V(3, 2, 6),
+  /* 0011110110 */ V(3, 2, 6),
+  /* 0011110111 */ V(3, 2, 6),
+  /* 0011111000 */ V(3, 2, 6),
+  /* 0011111001 */ V(3, 2, 6),
+  /* 0011111010 */ V(3, 2, 6),
+  /* 0011111011 */ V(3, 2, 6),
+  /* 0011111100 */ V(3, 2, 6),
+  /* 0011111101 */ V(3, 2, 6),
+  /* 0011111110 */ V(3, 2, 6),
+  /* 0011111111 */ V(3, 2, 6),
+  /* 0100000000 */ V(4, 0, 7),
+  /* 0100000001 */ V(4, 0, 7),
+  /* 0100000010 */ V(4, 0, 7),
+  /* 0100000011 */ V(4, 0, 7),
+  /* 0100000100 */ V(4, 0, 7),
+  /* 0100000101 */ V(4, 0, 7),
+  /* 0100000110 */ V(4, 0, 7),
+  /* 0100000111 */ V(4, 0, 7),
+  /* 0100001000 */ V(0, 3, 7),
+  /* 0100001001 */ V(0, 3, 7),
+  /* 0100001010 */ V(0, 3, 7),
+  /* 0100001011 */ V(0, 3, 7),
+  /* 0100001100 */ V(0, 3, 7),
+  /* 0100001101 */ V(0, 3, 7),
+  /* 0100001110 */ V(0, 3, 7),
+  /* 0100001111 */ V(0, 3, 7),
+  /* 0100010000 */ V(3, 0, 6),
+  /* 0100010001 */ V(3, 0, 6),
+  /* 0100010010 */ V(3, 0, 6),
+  /* 0100010011 */ V(3, 0, 6),
+  /* 0100010100 */ V(3, 0, 6),
+  /* 0100010101 */ V(3, 0, 6),
+  /* 0100010110 */ V(3, 0, 6),
+  /* 0100010111 */ V(3, 0, 6),
+  /* 0100011000 */ V(3, 0, 6),
+  /* 0100011001 */ V(3, 0, 6),
+  /* 0100011010 */ V(3, 0, 6),
+  /* 0100011011 */ V(3, 0, 6),
+  /* 0100011100 */ V(3, 0, 6),
+  /* 0100011101 */ V(3, 0, 6),
+  /* 0100011110 */ V(3, 0, 6),
+  /* 0100011111 */ V(3, 0, 6),
+  /* 0100100000 */ V(1, 3, 5),
+  /* 0100100001 */ V(1, 3, 5),
+  /* 0100100010 */ V(1, 3, 5),
+  /* 0100100011 */ V(1, 3, 5),
+  /* 0100100100 */ V(1, 3, 5),
+  /* 0100100101 */ V(1, 3, 5),
+  /* 0100100110 */ V(1, 3, 5),
+  /* 0100100111 */ V(1, 3, 5),
+  /* 0100101000 */ V(1, 3, 5),
+  /* 0100101001 */ V(1, 3, 5),
+  /* 0100101010 */ V(1, 3, 5),
+  /* 0100101011 */ V(1, 3, 5),
+  /* 0100101100 */ V(1, 3, 5),
+  /* 0100101101 */ V(1, 3, 5),
+  /* 0100101110 */ V(1, 3, 5),
+  /* 0100101111 */ V(1, 3, 5),
+  /* 0100110000 */ V(1, 3, 5),
+  /* 0100110001 */ V(1, 3, 5),
+  /* 0100110010 */ V(1, 3, 5),
+  /* 0100110011 */ V(1, 3, 5),
+  /* 0100110100 */ V(1, 3, 5),
+  /* 0100110101 */ V(1, 3, 5),
+  /* 0100110110 */ V(1, 3, 5),
+  /* 0100110111 */ V(1, 3, 5),
+  /* 0100111000 */ V(1, 3, 5),
+  /* 0100111001 */ V(1, 3, 5),
+  /* 0100111010 */ V(1, 3, 5),
+  /* 0100111011 */ V(1, 3, 5),
+  /* 0100111100 */ V(1, 3, 5),
+  /* 0100111101 */ V(1, 3, 5),
+  /* 0100111110 */ V(1, 3, 5),
+  /* 0100111111 */ V(1, 3, 5),
+  /* 0101000000 */ V(3, 1, 5),
+  /* 0101000001 */ V(3, 1, 5),
+  /* 0101000010 */ V(3, 1, 5),
+  /* 0101000011 */ V(3, 1, 5),
+  /* 0101000100 */ V(3, 1, 5),
+  /* 0101000101 */ V(3, 1, 5),
+  /* 0101000110 */ V(3, 1, 5),
+  /* 0101000111 */ V(3, 1, 5),
+  /* 0101001000 */ V(3, 1, 5),
+  /* 0101001001 */ V(3, 1, 5),
+  /* 0101001010 */ V(3, 1, 5),
+  /* 0101001011 */ V(3, 1, 5),
+  /* 0101001100 */ V(3, 1, 5),
+  /* 0101001101 */ V(3, 1, 5),
+  /* 0101001110 */ V(3, 1, 5),
+  /* 0101001111 */ V(3, 1, 5),
+  /* 0101010000 */ V(3, 1, 5),
+  /* 0101010001 */ V(3, 1, 5),
+  /* 0101010010 */ V(3, 1, 5),
+  /* 0101010011 */ V(3, 1, 5),
+  /* 0101010100 */ V(3, 1, 5),
+  /* 0101010101 */ V(3, 1, 5),
+  /* 0101010110 */ V(3, 1, 5),
+  /* 0101010111 */ V(3, 1, 5),
+  /* 0101011000 */ V(3, 1, 5),
+  /* 0101011001 */ V(3, 1, 5),
+  /* 0101011010 */ V(3, 1, 5),
+  /* 0101011011 */ V(3, 1, 5),
+  /* 0101011100 */ V(3, 1, 5),
+  /* 0101011101 */ V(3, 1, 5),
+  /* 0101011110 */ V(3, 1, 5),
+  /* 0101011111 */ V(3, 1, 5),
+  /* 0101100000 */ V(2, 2, 5),
+  /* 0101100001 */ V(2, 2, 5),
+  /* 0101100010 */ V(2, 2, 5),
+  /* 0101100011 */ V(2, 2, 5),
+  /* 0101100100 */ V(2, 2, 5),
+  /* 0101100101 */ V(2, 2, 5),
+  /* 0101100110 */ V(2, 2, 5),
+  /* 0101100111 */ V(2, 2, 5),
+  /* 0101101000 */ V(2, 2, 5),
+  /* 0101101001 */ V(2, 2, 5),
+  /* 0101101010 */ V(2, 2, 5),
+  /* 0101101011 */ V(2, 2, 5),
+  /* 0101101100 */ V(2, 2, 5),
+  /* 0101101101 */ V(2, 2, 5),
+  /* 0101101110 */ V(2, 2, 5),
+  /* 0101101111 */ V(2, 2, 5),
+  /* 0101110000 */ V(2, 2, 5),
+  /* 0101110001 */ V(2, 2, 5),
+  /* 0101110010 */ V(2, 2, 5),
+  /* 0101110011 */ V(2, 2, 5),
+  /* 0101110100 */ V(2, 2, 5),
+  /* 0101110101 */ V(2, 2, 5),
+  /* 0101110110 */ V(2, 2, 5),
+  /* 0101110111 */ V(2, 2, 5),
+  /* 0101111000 */ V(2, 2, 5),
+  /* 0101111001 */ V(2, 2, 5),
+  /* 0101111010 */ V(2, 2, 5),
+  /* 0101111011 */ V(2, 2, 5),
+  /* 0101111100 */ V(2, 2, 5),
+  /* 0101111101 */ V(2, 2, 5),
+  /* 0101111110 */ V(2, 2, 5),
+  /* 0101111111 */ V(2, 2, 5),
+  /* 0110000000 */ V(1, 2, 4),
+  /* 0110000001 */ V(1, 2, 4),
+  /* 0110000010 */ V(1, 2, 4),
+  /* 0110000011 */ V(1, 2, 4),
+  /* 0110000100 */ V(1, 2, 4),
+  /* 0110000101 */ V(1, 2, 4),
+  /* 0110000110 */ V(1, 2, 4),
+  /* 0110000111 */ V(1, 2, 4),
+  /* 0110001000 */ V(1, 2, 4),
+  /* 0110001001 */ V(1, 2, 4),
+  /* 0110001010 */ V(1, 2, 4),
+  /* 0110001011 */ V(1, 2, 4),
+  /* 0110001100 */ V(1, 2, 4),
+  /* 0110001101 */ V(1, 2, 4),
+  /* 0110001110 */ V(1, 2, 4),
+  /* 0110001111 */ V(1, 2, 4),
+  /* 0110010000 */ V(1, 2, 4),
+  /* 0110010001 */ V(1, 2, 4),
+  /* 0110010010 */ V(1, 2, 4),
+  /* 0110010011 */ V(1, 2, 4),
+  /* 0110010100 */ V(1, 2, 4),
+  /* 0110010101 */ V(1, 2, 4),
+  /* 0110010110 */ V(1, 2, 4),
+  /* 0110010111 */ V(1, 2, 4),
+  /* 0110011000 */ V(1, 2, 4),
+  /* 0110011001 */ V(1, 2, 4),
+  /* 0110011010 */ V(1, 2, 4),
+  /* 0110011011 */ V(1, 2, 4),
+  /* 0110011100 */ V(1, 2, 4),
+  /* 0110011101 */ V(1, 2, 4),
+  /* 0110011110 */ V(1, 2, 4),
+  /* 0110011111 */ V(1, 2, 4),
+  /* 0110100000 */ V(1, 2, 4),
+  /* 0110100001 */ V(1, 2, 4),
+  /* 0110100010 */ V(1, 2, 4),
+  /* 0110100011 */ V(1, 2, 4),
+  /* 0110100100 */ V(1, 2, 4),
+  /* 0110100101 */ V(1, 2, 4),
+  /* 0110100110 */ V(1, 2, 4),
+  /* 0110100111 */ V(1, 2, 4),
+  /* 0110101000 */ V(1, 2, 4),
+  /* 0110101001 */ V(1, 2, 4),
+  /* 0110101010 */ V(1, 2, 4),
+  /* 0110101011 */ V(1, 2, 4),
+  /* 0110101100 */ V(1, 2, 4),
+  /* 0110101101 */ V(1, 2, 4),
+  /* 0110101110 */ V(1, 2, 4),
+  /* 0110101111 */ V(1, 2, 4),
+  /* 0110110000 */ V(1, 2, 4),
+  /* 0110110001 */ V(1, 2, 4),
+  /* 0110110010 */ V(1, 2, 4),
+  /* 0110110011 */ V(1, 2, 4),
+  /* 0110110100 */ V(1, 2, 4),
+  /* 0110110101 */ V(1, 2, 4),
+  /* 0110110110 */ V(1, 2, 4),
+  /* 0110110111 */ V(1, 2, 4),
+  /* 0110111000 */ V(1, 2, 4),
+  /* 0110111001 */ V(1, 2, 4),
+  /* 0110111010 */ V(1, 2, 4),
+  /* 0110111011 */ V(1, 2, 4),
+  /* 0110111100 */ V(1, 2, 4),
+  /* 0110111101 */ V(1, 2, 4),
+  /* 0110111110 */ V(1, 2, 4),
+  /* 0110111111 */ V(1, 2, 4),
+  /* 0111000000 */ V(2, 1, 4),
+  /* 0111000001 */ V(2, 1, 4),
+  /* 0111000010 */ V(2, 1, 4),
+  /* 0111000011 */ V(2, 1, 4),
+  /* 0111000100 */ V(2, 1, 4),
+  /* 0111000101 */ V(2, 1, 4),
+  /* 0111000110 */ V(2, 1, 4),
+  /* 0111000111 */ V(2, 1, 4),
+  /* 0111001000 */ V(2, 1, 4),
+  /* 0111001001 */ V(2, 1, 4),
+  /* 0111001010 */ V(2, 1, 4),
+  /* 0111001011 */ V(2, 1, 4),
+  /* 0111001100 */ V(2, 1, 4),
+  /* 0111001101 */ V(2, 1, 4),
+  /* 0111001110 */ V(2, 1, 4),
+  /* 0111001111 */ V(2, 1, 4),
+  /* 0111010000 */ V(2, 1, 4),
+  /* 0111010001 */ V(2, 1, 4),
+  /* 0111010010 */ V(2, 1, 4),
+  /* 0111010011 */ V(2, 1, 4),
+  /* 0111010100 */ V(2, 1, 4),
+  /* 0111010101 */ V(2, 1, 4),
+  /* 0111010110 */ V(2, 1, 4),
+  /* 0111010111 */ V(2, 1, 4),
+  /* 0111011000 */ V(2, 1, 4),
+  /* 0111011001 */ V(2, 1, 4),
+  /* 0111011010 */ V(2, 1, 4),
+  /* 0111011011 */ V(2, 1, 4),
+  /* 0111011100 */ V(2, 1, 4),
+  /* 0111011101 */ V(2, 1, 4),
+  /* 0111011110 */ V(2, 1, 4),
+  /* 0111011111 */ V(2, 1, 4),
+  /* 0111100000 */ V(2, 1, 4),
+  /* 0111100001 */ V(2, 1, 4),
+  /* 0111100010 */ V(2, 1, 4),
+  /* 0111100011 */ V(2, 1, 4),
+  /* 0111100100 */ V(2, 1, 4),
+  /* 0111100101 */ V(2, 1, 4),
+  /* 0111100110 */ V(2, 1, 4),
+  /* 0111100111 */ V(2, 1, 4),
+  /* 0111101000 */ V(2, 1, 4),
+  /* 0111101001 */ V(2, 1, 4),
+  /* 0111101010 */ V(2, 1, 4),
+  /* 0111101011 */ V(2, 1, 4),
+  /* 0111101100 */ V(2, 1, 4),
+  /* 0111101101 */ V(2, 1, 4),
+  /* 0111101110 */ V(2, 1, 4),
+  /* 0111101111 */ V(2, 1, 4),
+  /* 0111110000 */ V(2, 1, 4),
+  /* 0111110001 */ V(2, 1, 4),
+  /* 0111110010 */ V(2, 1, 4),
+  /* 0111110011 */ V(2, 1, 4),
+  /* 0111110100 */ V(2, 1, 4),
+  /* 0111110101 */ V(2, 1, 4),
+  /* 0111110110 */ V(2, 1, 4),
+  /* 0111110111 */ V(2, 1, 4),
+  /* 0111111000 */ V(2, 1, 4),
+  /* 0111111001 */ V(2, 1, 4),
+  /* 0111111010 */ V(2, 1, 4),
+  /* 0111111011 */ V(2, 1, 4),
+  /* 0111111100 */ V(2, 1, 4),
+  /* 0111111101 */ V(2, 1, 4),
+  /* 0111111110 */ V(2, 1, 4),
+  /* 0111111111 */ V(2, 1, 4),
+  /* 1000000000 */ V(0, 2, 5),
+  /* 1000000001 */ V(0, 2, 5),
+  /* 1000000010 */ V(0, 2, 5),
+  /* 1000000011 */ V(0, 2, 5),
+  /* 1000000100 */ V(0, 2, 5),
+  /* 1000000101 */ V(0, 2, 5),
+  /* 1000000110 */ V(0, 2, 5),
+  /* 1000000111 */ V(0, 2, 5),
+  /* 1000001000 */ V(0, 2, 5),
+  /* 1000001001 */ V(0, 2, 5),
+  /* 1000001010 */ V(0, 2, 5),
+  /* 1000001011 */ V(0, 2, 5),
+  /* 1000001100 */ V(0, 2, 5),
+  /* 1000001101 */ V(0, 2, 5),
+  /* 1000001110 */ V(0, 2, 5),
+  /* 1000001111 */ V(0, 2, 5),
+  /* 1000010000 */ V(0, 2, 5),
+  /* 1000010001 */ V(0, 2, 5),
+  /* 1000010010 */ V(0, 2, 5),
+  /* 1000010011 */ V(0, 2, 5),
+  /* 1000010100 */ V(0, 2, 5),
+  /* 1000010101 */ V(0, 2, 5),
+  /* 1000010110 */ V(0, 2, 5),
+  /* 1000010111 */ V(0, 2, 5),
+  /* 1000011000 */ V(0, 2, 5),
+  /* 1000011001 */ V(0, 2, 5),
+  /* 1000011010 */ V(0, 2, 5),
+  /* 1000011011 */ V(0, 2, 5),
+  /* 1000011100 */ V(0, 2, 5),
+  /* 1000011101 */ V(0, 2, 5),
+  /* 1000011110 */ V(0, 2, 5),
+  /* 1000011111 */ V(0, 2, 5),
+  /* 1000100000 */ V(2, 0, 5),
+  /* 1000100001 */ V(2, 0, 5),
+  /* 1000100010 */ V(2, 0, 5),
+  /* 1000100011 */ V(2, 0, 5),
+  /* 1000100100 */ V(2, 0, 5),
+  /* 1000100101 */ V(2, 0, 5),
+  /* 1000100110 */ V(2, 0, 5),
+  /* 1000100111 */ V(2, 0, 5),
+  /* 1000101000 */ V(2, 0, 5),
+  /* 1000101001 */ V(2, 0, 5),
+  /* 1000101010 */ V(2, 0, 5),
+  /* 1000101011 */ V(2, 0, 5),
+  /* 1000101100 */ V(2, 0, 5),
+  /* 1000101101 */ V(2, 0, 5),
+  /* 1000101110 */ V(2, 0, 5),
+  /* 1000101111 */ V(2, 0, 5),
+  /* 1000110000 */ V(2, 0, 5),
+  /* 1000110001 */ V(2, 0, 5),
+  /* 1000110010 */ V(2, 0, 5),
+  /* 1000110011 */ V(2, 0, 5),
+  /* 1000110100 */ V(2, 0, 5),
+  /* 1000110101 */ V(2, 0, 5),
+  /* 1000110110 */ V(2, 0, 5),
+  /* 1000110111 */ V(2, 0, 5),
+  /* 1000111000 */ V(2, 0, 5),
+  /* 1000111001 */ V(2, 0, 5),
+  /* 1000111010 */ V(2, 0, 5),
+  /* 1000111011 */ V(2, 0, 5),
+  /* 1000111100 */ V(2, 0, 5),
+  /* 1000111101 */ V(2, 0, 5),
+  /* 1000111110 */ V(2, 0, 5),
+  /* 1000111111 */ V(2, 0, 5),
+  /* 1001000000 */ V(0, 0, 4),
+  /* 1001000001 */ V(0, 0, 4),
+  /* 1001000010 */ V(0, 0, 4),
+  /* 1001000011 */ V(0, 0, 4),
+  /* 1001000100 */ V(0, 0, 4),
+  /* 1001000101 */ V(0, 0, 4),
+  /* 1001000110 */ V(0, 0, 4),
+  /* 1001000111 */ V(0, 0, 4),
+  /* 1001001000 */ V(0, 0, 4),
+  /* 1001001001 */ V(0, 0, 4),
+  /* 1001001010 */ V(0, 0, 4),
+  /* 1001001011 */ V(0, 0, 4),
+  /* 1001001100 */ V(0, 0, 4),
+  /* 1001001101 */ V(0, 0, 4),
+  /* 1001001110 */ V(0, 0, 4),
+  /* 1001001111 */ V(0, 0, 4),
+  /* 1001010000 */ V(0, 0, 4),
+  /* 1001010001 */ V(0, 0, 4),
+  /* 1001010010 */ V(0, 0, 4),
+  /* 1001010011 */ V(0, 0, 4),
+  /* 1001010100 */ V(0, 0, 4),
+  /* 1001010101 */ V(0, 0, 4),
+  /* 1001010110 */ V(0, 0, 4),
+  /* 1001010111 */ V(0, 0, 4),
+  /* 1001011000 */ V(0, 0, 4),
+  /* 1001011001 */ V(0, 0, 4),
+  /* 1001011010 */ V(0, 0, 4),
+  /* 1001011011 */ V(0, 0, 4),
+  /* 1001011100 */ V(0, 0, 4),
+  /* 1001011101 */ V(0, 0, 4),
+  /* 1001011110 */ V(0, 0, 4),
+  /* 1001011111 */ V(0, 0, 4),
+  /* 1001100000 */ V(0, 0, 4),
+  /* 1001100001 */ V(0, 0, 4),
+  /* 1001100010 */ V(0, 0, 4),
+  /* 1001100011 */ V(0, 0, 4),
+  /* 1001100100 */ V(0, 0, 4),
+  /* 1001100101 */ V(0, 0, 4),
+  /* 1001100110 */ V(0, 0, 4),
+  /* 1001100111 */ V(0, 0, 4),
+  /* 1001101000 */ V(0, 0, 4),
+  /* 1001101001 */ V(0, 0, 4),
+  /* 1001101010 */ V(0, 0, 4),
+  /* 1001101011 */ V(0, 0, 4),
+  /* 1001101100 */ V(0, 0, 4),
+  /* 1001101101 */ V(0, 0, 4),
+  /* 1001101110 */ V(0, 0, 4),
+  /* 1001101111 */ V(0, 0, 4),
+  /* 1001110000 */ V(0, 0, 4),
+  /* 1001110001 */ V(0, 0, 4),
+  /* 1001110010 */ V(0, 0, 4),
+  /* 1001110011 */ V(0, 0, 4),
+  /* 1001110100 */ V(0, 0, 4),
+  /* 1001110101 */ V(0, 0, 4),
+  /* 1001110110 */ V(0, 0, 4),
+  /* 1001110111 */ V(0, 0, 4),
+  /* 1001111000 */ V(0, 0, 4),
+  /* 1001111001 */ V(0, 0, 4),
+  /* 1001111010 */ V(0, 0, 4),
+  /* 1001111011 */ V(0, 0, 4),
+  /* 1001111100 */ V(0, 0, 4),
+  /* 1001111101 */ V(0, 0, 4),
+  /* 1001111110 */ V(0, 0, 4),
+  /* 1001111111 */ V(0, 0, 4),
+  /* 1010000000 */ V(1, 1, 3),
+  /* 1010000001 */ V(1, 1, 3),
+  /* 1010000010 */ V(1, 1, 3),
+  /* 1010000011 */ V(1, 1, 3),
+  /* 1010000100 */ V(1, 1, 3),
+  /* 1010000101 */ V(1, 1, 3),
+  /* 1010000110 */ V(1, 1, 3),
+  /* 1010000111 */ V(1, 1, 3),
+  /* 1010001000 */ V(1, 1, 3),
+  /* 1010001001 */ V(1, 1, 3),
+  /* 1010001010 */ V(1, 1, 3),
+  /* 1010001011 */ V(1, 1, 3),
+  /* 1010001100 */ V(1, 1, 3),
+  /* 1010001101 */ V(1, 1, 3),
+  /* 1010001110 */ V(1, 1, 3),
+  /* 1010001111 */ V(1, 1, 3),
+  /* 1010010000 */ V(1, 1, 3),
+  /* 1010010001 */ V(1, 1, 3),
+  /* 1010010010 */ V(1, 1, 3),
+  /* 1010010011 */ V(1, 1, 3),
+  /* 1010010100 */ V(1, 1, 3),
+  /* 1010010101 */ V(1, 1, 3),
+  /* 1010010110 */ V(1, 1, 3),
+  /* 1010010111 */ V(1, 1, 3),
+  /* 1010011000 */ V(1, 1, 3),
+  /* 1010011001 */ V(1, 1, 3),
+  /* 1010011010 */ V(1, 1, 3),
+  /* 1010011011 */ V(1, 1, 3),
+  /* 1010011100 */ V(1, 1, 3),
+  /* 1010011101 */ V(1, 1, 3),
+  /* 1010011110 */ V(1, 1, 3),
+  /* 1010011111 */ V(1, 1, 3),
+  /* 1010100000 */ V(1, 1, 3),
+  /* 1010100001 */ V(1, 1, 3),
+  /* 1010100010 */ V(1, 1, 3),
+  /* 1010100011 */ V(1, 1, 3),
+  /* 1010100100 */ V(1, 1, 3),
+  /* 1010100101 */ V(1, 1, 3),
+  /* 1010100110 */ V(1, 1, 3),
+  /* 1010100111 */ V(1, 1, 3),
+  /* 1010101000 */ V(1, 1, 3),
+  /* 1010101001 */ V(1, 1, 3),
+  /* 1010101010 */ V(1, 1, 3),
+  /* 1010101011 */ V(1, 1, 3),
+  /* 1010101100 */ V(1, 1, 3),
+  /* 1010101101 */ V(1, 1, 3),
+  /* 1010101110 */ V(1, 1, 3),
+  /* 1010101111 */ V(1, 1, 3),
+  /* 1010110000 */ V(1, 1, 3),
+  /* 1010110001 */ V(1, 1, 3),
+  /* 1010110010 */ V(1, 1, 3),
+  /* 1010110011 */ V(1, 1, 3),
+  /* 1010110100 */ V(1, 1, 3),
+  /* 1010110101 */ V(1, 1, 3),
+  /* 1010110110 */ V(1, 1, 3),
+  /* 1010110111 */ V(1, 1, 3),
+  /* 1010111000 */ V(1, 1, 3),
+  /* 1010111001 */ V(1, 1, 3),
+  /* 1010111010 */ V(1, 1, 3),
+  /* 1010111011 */ V(1, 1, 3),
+  /* 1010111100 */ V(1, 1, 3),
+  /* 1010111101 */ V(1, 1, 3),
+  /* 1010111110 */ V(1, 1, 3),
+  /* 1010111111 */ V(1, 1, 3),
+  /* 1011000000 */ V(1, 1, 3),
+  /* 1011000001 */ V(1, 1, 3),
+  /* 1011000010 */ V(1, 1, 3),
+  /* 1011000011 */ V(1, 1, 3),
+  /* 1011000100 */ V(1, 1, 3),
+  /* 1011000101 */ V(1, 1, 3),
+  /* 1011000110 */ V(1, 1, 3),
+  /* 1011000111 */ V(1, 1, 3),
+  /* 1011001000 */ V(1, 1, 3),
+  /* 1011001001 */ V(1, 1, 3),
+  /* 1011001010 */ V(1, 1, 3),
+  /* 1011001011 */ V(1, 1, 3),
+  /* 1011001100 */ V(1, 1, 3),
+  /* 1011001101 */ V(1, 1, 3),
+  /* 1011001110 */ V(1, 1, 3),
+  /* 1011001111 */ V(1, 1, 3),
+  /* 1011010000 */ V(1, 1, 3),
+  /* 1011010001 */ V(1, 1, 3),
+  /* 1011010010 */ V(1, 1, 3),
+  /* 1011010011 */ V(1, 1, 3),
+  /* 1011010100 */ V(1, 1, 3),
+  /* 1011010101 */ V(1, 1, 3),
+  /* 1011010110 */ V(1, 1, 3),
+  /* 1011010111 */ V(1, 1, 3),
+  /* 1011011000 */ V(1, 1, 3),
+  /* 1011011001 */ V(1, 1, 3),
+  /* 1011011010 */ V(1, 1, 3),
+  /* 1011011011 */ V(1, 1, 3),
+  /* 1011011100 */ V(1, 1, 3),
+  /* 1011011101 */ V(1, 1, 3),
+  /* 1011011110 */ V(1, 1, 3),
+  /* 1011011111 */ V(1, 1, 3),
+  /* 1011100000 */ V(1, 1, 3),
+  /* 1011100001 */ V(1, 1, 3),
+  /* 1011100010 */ V(1, 1, 3),
+  /* 1011100011 */ V(1, 1, 3),
+  /* 1011100100 */ V(1, 1, 3),
+  /* 1011100101 */ V(1, 1, 3),
+  /* 1011100110 */ V(1, 1, 3),
+  /* 1011100111 */ V(1, 1, 3),
+  /* 1011101000 */ V(1, 1, 3),
+  /* 1011101001 */ V(1, 1, 3),
+  /* 1011101010 */ V(1, 1, 3),
+  /* 1011101011 */ V(1, 1, 3),
+  /* 1011101100 */ V(1, 1, 3),
+  /* 1011101101 */ V(1, 1, 3),
+  /* 1011101110 */ V(1, 1, 3),
+  /* 1011101111 */ V(1, 1, 3),
+  /* 1011110000 */ V(1, 1, 3),
+  /* 1011110001 */ V(1, 1, 3),
+  /* 1011110010 */ V(1, 1, 3),
+  /* 1011110011 */ V(1, 1, 3),
+  /* 1011110100 */ V(1, 1, 3),
+  /* 1011110101 */ V(1, 1, 3),
+  /* 1011110110 */ V(1, 1, 3),
+  /* 1011110111 */ V(1, 1, 3),
+  /* 1011111000 */ V(1, 1, 3),
+  /* 1011111001 */ V(1, 1, 3),
+  /* 1011111010 */ V(1, 1, 3),
+  /* 1011111011 */ V(1, 1, 3),
+  /* 1011111100 */ V(1, 1, 3),
+  /* 1011111101 */ V(1, 1, 3),
+  /* 1011111110 */ V(1, 1, 3),
+  /* 1011111111 */ V(1, 1, 3),
+  /* 1100000000 */ V(0, 1, 3),
+  /* 1100000001 */ V(0, 1, 3),
+  /* 1100000010 */ V(0, 1, 3),
+  /* 1100000011 */ V(0, 1, 3),
+  /* 1100000100 */ V(0, 1, 3),
+  /* 1100000101 */ V(0, 1, 3),
+  /* 1100000110 */ V(0, 1, 3),
+  /* 1100000111 */ V(0, 1, 3),
+  /* 1100001000 */ V(0, 1, 3),
+  /* 1100001001 */ V(0, 1, 3),
+  /* 1100001010 */ V(0, 1, 3),
+  /* 1100001011 */ V(0, 1, 3),
+  /* 1100001100 */ V(0, 1, 3),
+  /* 1100001101 */ V(0, 1, 3),
+  /* 1100001110 */ V(0, 1, 3),
+  /* 1100001111 */ V(0, 1, 3),
+  /* 1100010000 */ V(0, 1, 3),
+  /* 1100010001 */ V(0, 1, 3),
+  /* 1100010010 */ V(0, 1, 3),
+  /* 1100010011 */ V(0, 1, 3),
+  /* 1100010100 */ V(0, 1, 3),
+  /* 1100010101 */ V(0, 1, 3),
+  /* 1100010110 */ V(0, 1, 3),
+  /* 1100010111 */ V(0, 1, 3),
+  /* 1100011000 */ V(0, 1, 3),
+  /* 1100011001 */ V(0, 1, 3),
+  /* 1100011010 */ V(0, 1, 3),
+  /* 1100011011 */ V(0, 1, 3),
+  /* 1100011100 */ V(0, 1, 3),
+  /* 1100011101 */ V(0, 1, 3),
+  /* 1100011110 */ V(0, 1, 3),
+  /* 1100011111 */ V(0, 1, 3),
+  /* 1100100000 */ V(0, 1, 3),
+  /* 1100100001 */ V(0, 1, 3),
+  /* 1100100010 */ V(0, 1, 3),
+  /* 1100100011 */ V(0, 1, 3),
+  /* 1100100100 */ V(0, 1, 3),
+  /* 1100100101 */ V(0, 1, 3),
+  /* 1100100110 */ V(0, 1, 3),
+  /* 1100100111 */ V(0, 1, 3),
+  /* 1100101000 */ V(0, 1, 3),
+  /* 1100101001 */ V(0, 1, 3),
+  /* 1100101010 */ V(0, 1, 3),
+  /* 1100101011 */ V(0, 1, 3),
+  /* 1100101100 */ V(0, 1, 3),
+  /* 1100101101 */ V(0, 1, 3),
+  /* 1100101110 */ V(0, 1, 3),
+  /* 1100101111 */ V(0, 1, 3),
+  /* 1100110000 */ V(0, 1, 3),
+  /* 1100110001 */ V(0, 1, 3),
+  /* 1100110010 */ V(0, 1, 3),
+  /* 1100110011 */ V(0, 1, 3),
+  /* 1100110100 */ V(0, 1, 3),
+  /* 1100110101 */ V(0, 1, 3),
+  /* 1100110110 */ V(0, 1, 3),
+  /* 1100110111 */ V(0, 1, 3),
+  /* 1100111000 */ V(0, 1, 3),
+  /* 1100111001 */ V(0, 1, 3),
+  /* 1100111010 */ V(0, 1, 3),
+  /* 1100111011 */ V(0, 1, 3),
+  /* 1100111100 */ V(0, 1, 3),
+  /* 1100111101 */ V(0, 1, 3),
+  /* 1100111110 */ V(0, 1, 3),
+  /* 1100111111 */ V(0, 1, 3),
+  /* 1101000000 */ V(0, 1, 3),
+  /* 1101000001 */ V(0, 1, 3),
+  /* 1101000010 */ V(0, 1, 3),
+  /* 1101000011 */ V(0, 1, 3),
+  /* 1101000100 */ V(0, 1, 3),
+  /* 1101000101 */ V(0, 1, 3),
+  /* 1101000110 */ V(0, 1, 3),
+  /* 1101000111 */ V(0, 1, 3),
+  /* 1101001000 */ V(0, 1, 3),
+  /* 1101001001 */ V(0, 1, 3),
+  /* 1101001010 */ V(0, 1, 3),
+  /* 1101001011 */ V(0, 1, 3),
+  /* 1101001100 */ V(0, 1, 3),
+  /* 1101001101 */ V(0, 1, 3),
+  /* 1101001110 */ V(0, 1, 3),
+  /* 1101001111 */ V(0, 1, 3),
+  /* 1101010000 */ V(0, 1, 3),
+  /* 1101010001 */ V(0, 1, 3),
+  /* 1101010010 */ V(0, 1, 3),
+  /* 1101010011 */ V(0, 1, 3),
+  /* 1101010100 */ V(0, 1, 3),
+  /* 1101010101 */ V(0, 1, 3),
+  /* 1101010110 */ V(0, 1, 3),
+  /* 1101010111 */ V(0, 1, 3),
+  /* 1101011000 */ V(0, 1, 3),
+  /* 1101011001 */ V(0, 1, 3),
+  /* 1101011010 */ V(0, 1, 3),
+  /* 1101011011 */ V(0, 1, 3),
+  /* 1101011100 */ V(0, 1, 3),
+  /* 1101011101 */ V(0, 1, 3),
+  /* 1101011110 */ V(0, 1, 3),
+  /* 1101011111 */ V(0, 1, 3),
+  /* 1101100000 */ V(0, 1, 3),
+  /* 1101100001 */ V(0, 1, 3),
+  /* 1101100010 */ V(0, 1, 3),
+  /* 1101100011 */ V(0, 1, 3),
+  /* 1101100100 */ V(0, 1, 3),
+  /* 1101100101 */ V(0, 1, 3),
+  /* 1101100110 */ V(0, 1, 3),
+  /* 1101100111 */ V(0, 1, 3),
+  /* 1101101000 */ V(0, 1, 3),
+  /* 1101101001 */ V(0, 1, 3),
+  /* 1101101010 */ V(0, 1, 3),
+  /* 1101101011 */ V(0, 1, 3),
+  /* 1101101100 */ V(0, 1, 3),
+  /* 1101101101 */ V(0, 1, 3),
+  /* 1101101110 */ V(0, 1, 3),
+  /* 1101101111 */ V(0, 1, 3),
+  /* 1101110000 */ V(0, 1, 3),
+  /* 1101110001 */ V(0, 1, 3),
+  /* 1101110010 */ V(0, 1, 3),
+  /* 1101110011 */ V(0, 1, 3),
+  /* 1101110100 */ V(0, 1, 3),
+  /* 1101110101 */ V(0, 1, 3),
+  /* 1101110110 */ V(0, 1, 3),
+  /* 1101110111 */ V(0, 1, 3),
+  /* 1101111000 */ V(0, 1, 3),
+  /* 1101111001 */ V(0, 1, 3),
+  /* 1101111010 */ V(0, 1, 3),
+  /* 1101111011 */ V(0, 1, 3),
+  /* 1101111100 */ V(0, 1, 3),
+  /* 1101111101 */ V(0, 1, 3),
+  /* 1101111110 */ V(0, 1, 3),
+  /* 1101111111 */ V(0, 1, 3),
+  /* 1110000000 */ V(1, 0, 3),
+  /* 1110000001 */ V(1, 0, 3),
+  /* 1110000010 */ V(1, 0, 3),
+  /* 1110000011 */ V(1, 0, 3),
+  /* 1110000100 */ V(1, 0, 3),
+  /* 1110000101 */ V(1, 0, 3),
+  /* 1110000110 */ V(1, 0, 3),
+  /* 1110000111 */ V(1, 0, 3),
+  /* 1110001000 */ V(1, 0, 3),
+  /* 1110001001 */ V(1, 0, 3),
+  /* 1110001010 */ V(1, 0, 3),
+  /* 1110001011 */ V(1, 0, 3),
+  /* 1110001100 */ V(1, 0, 3),
+  /* 1110001101 */ V(1, 0, 3),
+  /* 1110001110 */ V(1, 0, 3),
+  /* 1110001111 */ V(1, 0, 3),
+  /* 1110010000 */ V(1, 0, 3),
+  /* 1110010001 */ V(1, 0, 3),
+  /* 1110010010 */ V(1, 0, 3),
+  /* 1110010011 */ V(1, 0, 3),
+  /* 1110010100 */ V(1, 0, 3),
+  /* 1110010101 */ V(1, 0, 3),
+  /* 1110010110 */ V(1, 0, 3),
+  /* 1110010111 */ V(1, 0, 3),
+  /* 1110011000 */ V(1, 0, 3),
+  /* 1110011001 */ V(1, 0, 3),
+  /* 1110011010 */ V(1, 0, 3),
+  /* 1110011011 */ V(1, 0, 3),
+  /* 1110011100 */ V(1, 0, 3),
+  /* 1110011101 */ V(1, 0, 3),
+  /* 1110011110 */ V(1, 0, 3),
+  /* 1110011111 */ V(1, 0, 3),
+  /* 1110100000 */ V(1, 0, 3),
+  /* 1110100001 */ V(1, 0, 3),
+  /* 1110100010 */ V(1, 0, 3),
+  /* 1110100011 */ V(1, 0, 3),
+  /* 1110100100 */ V(1, 0, 3),
+  /* 1110100101 */ V(1, 0, 3),
+  /* 1110100110 */ V(1, 0, 3),
+  /* 1110100111 */ V(1, 0, 3),
+  /* 1110101000 */ V(1, 0, 3),
+  /* 1110101001 */ V(1, 0, 3),
+  /* 1110101010 */ V(1, 0, 3),
+  /* 1110101011 */ V(1, 0, 3),
+  /* 1110101100 */ V(1, 0, 3),
+  /* 1110101101 */ V(1, 0, 3),
+  /* 1110101110 */ V(1, 0, 3),
+  /* 1110101111 */ V(1, 0, 3),
+  /* 1110110000 */ V(1, 0, 3),
+  /* 1110110001 */ V(1, 0, 3),
+  /* 1110110010 */ V(1, 0, 3),
+  /* 1110110011 */ V(1, 0, 3),
+  /* 1110110100 */ V(1, 0, 3),
+  /* 1110110101 */ V(1, 0, 3),
+  /* 1110110110 */ V(1, 0, 3),
+  /* 1110110111 */ V(1, 0, 3),
+  /* 1110111000 */ V(1, 0, 3),
+  /* 1110111001 */ V(1, 0, 3),
+  /* 1110111010 */ V(1, 0, 3),
+  /* 1110111011 */ V(1, 0, 3),
+  /* 1110111100 */ V(1, 0, 3),
+  /* 1110111101 */ V(1, 0, 3),
+  /* 1110111110 */ V(1, 0, 3),
+  /* 1110111111 */ V(1, 0, 3),
+  /* 1111000000 */ V(1, 0, 3),
+  /* 1111000001 */ V(1, 0, 3),
+  /* 1111000010 */ V(1, 0, 3),
+  /* 1111000011 */ V(1, 0, 3),
+  /* 1111000100 */ V(1, 0, 3),
+  /* 1111000101 */ V(1, 0, 3),
+  /* 1111000110 */ V(1, 0, 3),
+  /* 1111000111 */ V(1, 0, 3),
+  /* 1111001000 */ V(1, 0, 3),
+  /* 1111001001 */ V(1, 0, 3),
+  /* 1111001010 */ V(1, 0, 3),
+  /* 1111001011 */ V(1, 0, 3),
+  /* 1111001100 */ V(1, 0, 3),
+  /* 1111001101 */ V(1, 0, 3),
+  /* 1111001110 */ V(1, 0, 3),
+  /* 1111001111 */ V(1, 0, 3),
+  /* 1111010000 */ V(1, 0, 3),
+  /* 1111010001 */ V(1, 0, 3),
+  /* 1111010010 */ V(1, 0, 3),
+  /* 1111010011 */ V(1, 0, 3),
+  /* 1111010100 */ V(1, 0, 3),
+  /* 1111010101 */ V(1, 0, 3),
+  /* 1111010110 */ V(1, 0, 3),
+  /* 1111010111 */ V(1, 0, 3),
+  /* 1111011000 */ V(1, 0, 3),
+  /* 1111011001 */ V(1, 0, 3),
+  /* 1111011010 */ V(1, 0, 3),
+  /* 1111011011 */ V(1, 0, 3),
+  /* 1111011100 */ V(1, 0, 3),
+  /* 1111011101 */ V(1, 0, 3),
+  /* 1111011110 */ V(1, 0, 3),
+  /* 1111011111 */ V(1, 0, 3),
+  /* 1111100000 */ V(1, 0, 3),
+  /* 1111100001 */ V(1, 0, 3),
+  /* 1111100010 */ V(1, 0, 3),
+  /* 1111100011 */ V(1, 0, 3),
+  /* 1111100100 */ V(1, 0, 3),
+  /* 1111100101 */ V(1, 0, 3),
+  /* 1111100110 */ V(1, 0, 3),
+  /* 1111100111 */ V(1, 0, 3),
+  /* 1111101000 */ V(1, 0, 3),
+  /* 1111101001 */ V(1, 0, 3),
+  /* 1111101010 */ V(1, 0, 3),
+  /* 1111101011 */ V(1, 0, 3),
+  /* 1111101100 */ V(1, 0, 3),
+  /* 1111101101 */ V(1, 0, 3),
+  /* 1111101110 */ V(1, 0, 3),
+  /* 1111101111 */ V(1, 0, 3),
+  /* 1111110000 */ V(1, 0, 3),
+  /* 1111110001 */ V(1, 0, 3),
+  /* 1111110010 */ V(1, 0, 3),
+  /* 1111110011 */ V(1, 0, 3),
+  /* 1111110100 */ V(1, 0, 3),
+  /* 1111110101 */ V(1, 0, 3),
+  /* 1111110110 */ V(1, 0, 3),
+  /* 1111110111 */ V(1, 0, 3),
+  /* 1111111000 */ V(1, 0, 3),
+  /* 1111111001 */ V(1, 0, 3),
+  /* 1111111010 */ V(1, 0, 3),
+  /* 1111111011 */ V(1, 0, 3),
+  /* 1111111100 */ V(1, 0, 3),
+  /* 1111111101 */ V(1, 0, 3),
+  /* 1111111110 */ V(1, 0, 3),
+  /* 1111111111 */ V(1, 0, 3)
 };
 
 static
 union huffpair const hufftab13[] = {
-  /* 0000 */ PTR(16, 4),
-  /* 0001 */ PTR(32, 4),
-  /* 0010 */ PTR(48, 4),
-  /* 0011 */ PTR(64, 2),
-  /* 0100 */ V(1, 1, 4),
-  /* 0101 */ V(0, 1, 4),
-  /* 0110 */ V(1, 0, 3),
-  /* 0111 */ V(1, 0, 3),
-  /* 1000 */ V(0, 0, 1),
-  /* 1001 */ V(0, 0, 1),
-  /* 1010 */ V(0, 0, 1),
-  /* 1011 */ V(0, 0, 1),
-  /* 1100 */ V(0, 0, 1),
-  /* 1101 */ V(0, 0, 1),
-  /* 1110 */ V(0, 0, 1),
-  /* 1111 */ V(0, 0, 1),
-
-  /* 0000 ... */
-  /* 0000 */ PTR(68, 4),	/* 16 */
-  /* 0001 */ PTR(84, 4),
-  /* 0010 */ PTR(100, 4),
-  /* 0011 */ PTR(116, 4),
-  /* 0100 */ PTR(132, 4),
-  /* 0101 */ PTR(148, 4),
-  /* 0110 */ PTR(164, 3),
-  /* 0111 */ PTR(172, 3),
-  /* 1000 */ PTR(180, 3),
-  /* 1001 */ PTR(188, 3),
-  /* 1010 */ PTR(196, 3),
-  /* 1011 */ PTR(204, 3),
-  /* 1100 */ PTR(212, 1),
-  /* 1101 */ PTR(214, 2),
-  /* 1110 */ PTR(218, 3),
-  /* 1111 */ PTR(226, 1),
-
-  /* 0001 ... */
-  /* 0000 */ PTR(228, 2),	/* 32 */
-  /* 0001 */ PTR(232, 2),
-  /* 0010 */ PTR(236, 2),
-  /* 0011 */ PTR(240, 2),
-  /* 0100 */ V(8, 1, 4),
-  /* 0101 */ PTR(244, 1),
-  /* 0110 */ PTR(246, 1),
-  /* 0111 */ PTR(248, 1),
-  /* 1000 */ PTR(250, 2),
-  /* 1001 */ PTR(254, 1),
-  /* 1010 */ V(1, 5, 4),
-  /* 1011 */ V(5, 1, 4),
-  /* 1100 */ PTR(256, 1),
-  /* 1101 */ PTR(258, 1),
-  /* 1110 */ PTR(260, 1),
-  /* 1111 */ V(1, 4, 4),
-
-  /* 0010 ... */
-  /* 0000 */ V(4, 1, 3),	/* 48 */
-  /* 0001 */ V(4, 1, 3),
-  /* 0010 */ V(0, 4, 4),
-  /* 0011 */ V(4, 0, 4),
-  /* 0100 */ V(2, 3, 4),
-  /* 0101 */ V(3, 2, 4),
-  /* 0110 */ V(1, 3, 3),
-  /* 0111 */ V(1, 3, 3),
-  /* 1000 */ V(3, 1, 3),
-  /* 1001 */ V(3, 1, 3),
-  /* 1010 */ V(0, 3, 3),
-  /* 1011 */ V(0, 3, 3),
-  /* 1100 */ V(3, 0, 3),
-  /* 1101 */ V(3, 0, 3),
-  /* 1110 */ V(2, 2, 3),
-  /* 1111 */ V(2, 2, 3),
-
-  /* 0011 ... */
-  /* 00   */ V(1, 2, 2),	/* 64 */
-  /* 01   */ V(2, 1, 2),
-  /* 10   */ V(0, 2, 2),
-  /* 11   */ V(2, 0, 2),
-
-  /* 0000 0000 ... */
-  /* 0000 */ PTR(262, 4),	/* 68 */
-  /* 0001 */ PTR(278, 4),
-  /* 0010 */ PTR(294, 4),
-  /* 0011 */ PTR(310, 3),
-  /* 0100 */ PTR(318, 2),
-  /* 0101 */ PTR(322, 2),
-  /* 0110 */ PTR(326, 3),
-  /* 0111 */ PTR(334, 2),
-  /* 1000 */ PTR(338, 1),
-  /* 1001 */ PTR(340, 2),
-  /* 1010 */ PTR(344, 2),
-  /* 1011 */ PTR(348, 2),
-  /* 1100 */ PTR(352, 2),
-  /* 1101 */ PTR(356, 2),
-  /* 1110 */ V(1, 15, 4),
-  /* 1111 */ V(15, 1, 4),
-
-  /* 0000 0001 ... */
-  /* 0000 */ V(15, 0, 4),	/* 84 */
-  /* 0001 */ PTR(360, 1),
-  /* 0010 */ PTR(362, 1),
-  /* 0011 */ PTR(364, 1),
-  /* 0100 */ V(14, 2, 4),
-  /* 0101 */ PTR(366, 1),
-  /* 0110 */ V(1, 14, 4),
-  /* 0111 */ V(14, 1, 4),
-  /* 1000 */ PTR(368, 1),
-  /* 1001 */ PTR(370, 1),
-  /* 1010 */ PTR(372, 1),
-  /* 1011 */ PTR(374, 1),
-  /* 1100 */ PTR(376, 1),
-  /* 1101 */ PTR(378, 1),
-  /* 1110 */ V(12, 6, 4),
-  /* 1111 */ V(3, 13, 4),
-
-  /* 0000 0010 ... */
-  /* 0000 */ PTR(380, 1),	/* 100 */
-  /* 0001 */ V(2, 13, 4),
-  /* 0010 */ V(13, 2, 4),
-  /* 0011 */ V(1, 13, 4),
-  /* 0100 */ V(11, 7, 4),
-  /* 0101 */ PTR(382, 1),
-  /* 0110 */ PTR(384, 1),
-  /* 0111 */ V(12, 3, 4),
-  /* 1000 */ PTR(386, 1),
-  /* 1001 */ V(4, 11, 4),
-  /* 1010 */ V(13, 1, 3),
-  /* 1011 */ V(13, 1, 3),
-  /* 1100 */ V(0, 13, 4),
-  /* 1101 */ V(13, 0, 4),
-  /* 1110 */ V(8, 10, 4),
-  /* 1111 */ V(10, 8, 4),
-
-  /* 0000 0011 ... */
-  /* 0000 */ V(4, 12, 4),	/* 116 */
-  /* 0001 */ V(12, 4, 4),
-  /* 0010 */ V(6, 11, 4),
-  /* 0011 */ V(11, 6, 4),
-  /* 0100 */ V(3, 12, 3),
-  /* 0101 */ V(3, 12, 3),
-  /* 0110 */ V(2, 12, 3),
-  /* 0111 */ V(2, 12, 3),
-  /* 1000 */ V(12, 2, 3),
-  /* 1001 */ V(12, 2, 3),
-  /* 1010 */ V(5, 11, 3),
-  /* 1011 */ V(5, 11, 3),
-  /* 1100 */ V(11, 5, 4),
-  /* 1101 */ V(8, 9, 4),
-  /* 1110 */ V(1, 12, 3),
-  /* 1111 */ V(1, 12, 3),
-
-  /* 0000 0100 ... */
-  /* 0000 */ V(12, 1, 3),	/* 132 */
-  /* 0001 */ V(12, 1, 3),
-  /* 0010 */ V(9, 8, 4),
-  /* 0011 */ V(0, 12, 4),
-  /* 0100 */ V(12, 0, 3),
-  /* 0101 */ V(12, 0, 3),
-  /* 0110 */ V(11, 4, 4),
-  /* 0111 */ V(6, 10, 4),
-  /* 1000 */ V(10, 6, 4),
-  /* 1001 */ V(7, 9, 4),
-  /* 1010 */ V(3, 11, 3),
-  /* 1011 */ V(3, 11, 3),
-  /* 1100 */ V(11, 3, 3),
-  /* 1101 */ V(11, 3, 3),
-  /* 1110 */ V(8, 8, 4),
-  /* 1111 */ V(5, 10, 4),
-
-  /* 0000 0101 ... */
-  /* 0000 */ V(2, 11, 3),	/* 148 */
-  /* 0001 */ V(2, 11, 3),
-  /* 0010 */ V(10, 5, 4),
-  /* 0011 */ V(6, 9, 4),
-  /* 0100 */ V(10, 4, 3),
-  /* 0101 */ V(10, 4, 3),
-  /* 0110 */ V(7, 8, 4),
-  /* 0111 */ V(8, 7, 4),
-  /* 1000 */ V(9, 4, 3),
-  /* 1001 */ V(9, 4, 3),
-  /* 1010 */ V(7, 7, 4),
-  /* 1011 */ V(7, 6, 4),
-  /* 1100 */ V(11, 2, 2),
-  /* 1101 */ V(11, 2, 2),
-  /* 1110 */ V(11, 2, 2),
-  /* 1111 */ V(11, 2, 2),
-
-  /* 0000 0110 ... */
-  /* 000  */ V(1, 11, 2),	/* 164 */
-  /* 001  */ V(1, 11, 2),
-  /* 010  */ V(11, 1, 2),
-  /* 011  */ V(11, 1, 2),
-  /* 100  */ V(0, 11, 3),
-  /* 101  */ V(11, 0, 3),
-  /* 110  */ V(9, 6, 3),
-  /* 111  */ V(4, 10, 3),
-
-  /* 0000 0111 ... */
-  /* 000  */ V(3, 10, 3),	/* 172 */
-  /* 001  */ V(10, 3, 3),
-  /* 010  */ V(5, 9, 3),
-  /* 011  */ V(9, 5, 3),
-  /* 100  */ V(2, 10, 2),
-  /* 101  */ V(2, 10, 2),
-  /* 110  */ V(10, 2, 2),
-  /* 111  */ V(10, 2, 2),
-
-  /* 0000 1000 ... */
-  /* 000  */ V(1, 10, 2),	/* 180 */
-  /* 001  */ V(1, 10, 2),
-  /* 010  */ V(10, 1, 2),
-  /* 011  */ V(10, 1, 2),
-  /* 100  */ V(0, 10, 3),
-  /* 101  */ V(6, 8, 3),
-  /* 110  */ V(10, 0, 2),
-  /* 111  */ V(10, 0, 2),
-
-  /* 0000 1001 ... */
-  /* 000  */ V(8, 6, 3),	/* 188 */
-  /* 001  */ V(4, 9, 3),
-  /* 010  */ V(9, 3, 2),
-  /* 011  */ V(9, 3, 2),
-  /* 100  */ V(3, 9, 3),
-  /* 101  */ V(5, 8, 3),
-  /* 110  */ V(8, 5, 3),
-  /* 111  */ V(6, 7, 3),
-
-  /* 0000 1010 ... */
-  /* 000  */ V(2, 9, 2),	/* 196 */
-  /* 001  */ V(2, 9, 2),
-  /* 010  */ V(9, 2, 2),
-  /* 011  */ V(9, 2, 2),
-  /* 100  */ V(5, 7, 3),
-  /* 101  */ V(7, 5, 3),
-  /* 110  */ V(3, 8, 2),
-  /* 111  */ V(3, 8, 2),
-
-  /* 0000 1011 ... */
-  /* 000  */ V(8, 3, 2),	/* 204 */
-  /* 001  */ V(8, 3, 2),
-  /* 010  */ V(6, 6, 3),
-  /* 011  */ V(4, 7, 3),
-  /* 100  */ V(7, 4, 3),
-  /* 101  */ V(5, 6, 3),
-  /* 110  */ V(6, 5, 3),
-  /* 111  */ V(7, 3, 3),
-
-  /* 0000 1100 ... */
-  /* 0    */ V(1, 9, 1),	/* 212 */
-  /* 1    */ V(9, 1, 1),
-
-  /* 0000 1101 ... */
-  /* 00   */ V(0, 9, 2),	/* 214 */
-  /* 01   */ V(9, 0, 2),
-  /* 10   */ V(4, 8, 2),
-  /* 11   */ V(8, 4, 2),
-
-  /* 0000 1110 ... */
-  /* 000  */ V(7, 2, 2),	/* 218 */
-  /* 001  */ V(7, 2, 2),
-  /* 010  */ V(4, 6, 3),
-  /* 011  */ V(6, 4, 3),
-  /* 100  */ V(2, 8, 1),
-  /* 101  */ V(2, 8, 1),
-  /* 110  */ V(2, 8, 1),
-  /* 111  */ V(2, 8, 1),
-
-  /* 0000 1111 ... */
-  /* 0    */ V(8, 2, 1),	/* 226 */
-  /* 1    */ V(1, 8, 1),
-
-  /* 0001 0000 ... */
-  /* 00   */ V(3, 7, 2),	/* 228 */
-  /* 01   */ V(2, 7, 2),
-  /* 10   */ V(1, 7, 1),
-  /* 11   */ V(1, 7, 1),
-
-  /* 0001 0001 ... */
-  /* 00   */ V(7, 1, 1),	/* 232 */
-  /* 01   */ V(7, 1, 1),
-  /* 10   */ V(5, 5, 2),
-  /* 11   */ V(0, 7, 2),
-
-  /* 0001 0010 ... */
-  /* 00   */ V(7, 0, 2),	/* 236 */
-  /* 01   */ V(3, 6, 2),
-  /* 10   */ V(6, 3, 2),
-  /* 11   */ V(4, 5, 2),
-
-  /* 0001 0011 ... */
-  /* 00   */ V(5, 4, 2),	/* 240 */
-  /* 01   */ V(2, 6, 2),
-  /* 10   */ V(6, 2, 2),
-  /* 11   */ V(3, 5, 2),
-
-  /* 0001 0101 ... */
-  /* 0    */ V(0, 8, 1),	/* 244 */
-  /* 1    */ V(8, 0, 1),
-
-  /* 0001 0110 ... */
-  /* 0    */ V(1, 6, 1),	/* 246 */
-  /* 1    */ V(6, 1, 1),
-
-  /* 0001 0111 ... */
-  /* 0    */ V(0, 6, 1),	/* 248 */
-  /* 1    */ V(6, 0, 1),
-
-  /* 0001 1000 ... */
-  /* 00   */ V(5, 3, 2),	/* 250 */
-  /* 01   */ V(4, 4, 2),
-  /* 10   */ V(2, 5, 1),
-  /* 11   */ V(2, 5, 1),
-
-  /* 0001 1001 ... */
-  /* 0    */ V(5, 2, 1),	/* 254 */
-  /* 1    */ V(0, 5, 1),
-
-  /* 0001 1100 ... */
-  /* 0    */ V(3, 4, 1),	/* 256 */
-  /* 1    */ V(4, 3, 1),
-
-  /* 0001 1101 ... */
-  /* 0    */ V(5, 0, 1),	/* 258 */
-  /* 1    */ V(2, 4, 1),
-
-  /* 0001 1110 ... */
-  /* 0    */ V(4, 2, 1),	/* 260 */
-  /* 1    */ V(3, 3, 1),
-
-  /* 0000 0000 0000 ... */
-  /* 0000 */ PTR(388, 3),	/* 262 */
-  /* 0001 */ V(15, 15, 4),
-  /* 0010 */ V(14, 15, 4),
-  /* 0011 */ V(13, 15, 4),
-  /* 0100 */ V(14, 14, 4),
-  /* 0101 */ V(12, 15, 4),
-  /* 0110 */ V(13, 14, 4),
-  /* 0111 */ V(11, 15, 4),
-  /* 1000 */ V(15, 11, 4),
-  /* 1001 */ V(12, 14, 4),
-  /* 1010 */ V(13, 12, 4),
-  /* 1011 */ PTR(396, 1),
-  /* 1100 */ V(14, 12, 3),
-  /* 1101 */ V(14, 12, 3),
-  /* 1110 */ V(13, 13, 3),
-  /* 1111 */ V(13, 13, 3),
-
-  /* 0000 0000 0001 ... */
-  /* 0000 */ V(15, 10, 4),	/* 278 */
-  /* 0001 */ V(12, 13, 4),
-  /* 0010 */ V(11, 14, 3),
-  /* 0011 */ V(11, 14, 3),
-  /* 0100 */ V(14, 11, 3),
-  /* 0101 */ V(14, 11, 3),
-  /* 0110 */ V(9, 15, 3),
-  /* 0111 */ V(9, 15, 3),
-  /* 1000 */ V(15, 9, 3),
-  /* 1001 */ V(15, 9, 3),
-  /* 1010 */ V(14, 10, 3),
-  /* 1011 */ V(14, 10, 3),
-  /* 1100 */ V(11, 13, 3),
-  /* 1101 */ V(11, 13, 3),
-  /* 1110 */ V(13, 11, 3),
-  /* 1111 */ V(13, 11, 3),
-
-  /* 0000 0000 0010 ... */
-  /* 0000 */ V(8, 15, 3),	/* 294 */
-  /* 0001 */ V(8, 15, 3),
-  /* 0010 */ V(15, 8, 3),
-  /* 0011 */ V(15, 8, 3),
-  /* 0100 */ V(12, 12, 3),
-  /* 0101 */ V(12, 12, 3),
-  /* 0110 */ V(10, 14, 4),
-  /* 0111 */ V(9, 14, 4),
-  /* 1000 */ V(8, 14, 3),
-  /* 1001 */ V(8, 14, 3),
-  /* 1010 */ V(7, 15, 4),
-  /* 1011 */ V(7, 14, 4),
-  /* 1100 */ V(15, 7, 2),
-  /* 1101 */ V(15, 7, 2),
-  /* 1110 */ V(15, 7, 2),
-  /* 1111 */ V(15, 7, 2),
-
-  /* 0000 0000 0011 ... */
-  /* 000  */ V(13, 10, 2),	/* 310 */
-  /* 001  */ V(13, 10, 2),
-  /* 010  */ V(10, 13, 3),
-  /* 011  */ V(11, 12, 3),
-  /* 100  */ V(12, 11, 3),
-  /* 101  */ V(15, 6, 3),
-  /* 110  */ V(6, 15, 2),
-  /* 111  */ V(6, 15, 2),
-
-  /* 0000 0000 0100 ... */
-  /* 00   */ V(14, 8, 2),	/* 318 */
-  /* 01   */ V(5, 15, 2),
-  /* 10   */ V(9, 13, 2),
-  /* 11   */ V(13, 9, 2),
-
-  /* 0000 0000 0101 ... */
-  /* 00   */ V(15, 5, 2),	/* 322 */
-  /* 01   */ V(14, 7, 2),
-  /* 10   */ V(10, 12, 2),
-  /* 11   */ V(11, 11, 2),
-
-  /* 0000 0000 0110 ... */
-  /* 000  */ V(4, 15, 2),	/* 326 */
-  /* 001  */ V(4, 15, 2),
-  /* 010  */ V(15, 4, 2),
-  /* 011  */ V(15, 4, 2),
-  /* 100  */ V(12, 10, 3),
-  /* 101  */ V(14, 6, 3),
-  /* 110  */ V(15, 3, 2),
-  /* 111  */ V(15, 3, 2),
-
-  /* 0000 0000 0111 ... */
-  /* 00   */ V(3, 15, 1),	/* 334 */
-  /* 01   */ V(3, 15, 1),
-  /* 10   */ V(8, 13, 2),
-  /* 11   */ V(13, 8, 2),
-
-  /* 0000 0000 1000 ... */
-  /* 0    */ V(2, 15, 1),	/* 338 */
-  /* 1    */ V(15, 2, 1),
-
-  /* 0000 0000 1001 ... */
-  /* 00   */ V(6, 14, 2),	/* 340 */
-  /* 01   */ V(9, 12, 2),
-  /* 10   */ V(0, 15, 1),
-  /* 11   */ V(0, 15, 1),
-
-  /* 0000 0000 1010 ... */
-  /* 00   */ V(12, 9, 2),	/* 344 */
-  /* 01   */ V(5, 14, 2),
-  /* 10   */ V(10, 11, 1),
-  /* 11   */ V(10, 11, 1),
-
-  /* 0000 0000 1011 ... */
-  /* 00   */ V(7, 13, 2),	/* 348 */
-  /* 01   */ V(13, 7, 2),
-  /* 10   */ V(4, 14, 1),
-  /* 11   */ V(4, 14, 1),
-
-  /* 0000 0000 1100 ... */
-  /* 00   */ V(12, 8, 2),	/* 352 */
-  /* 01   */ V(13, 6, 2),
-  /* 10   */ V(3, 14, 1),
-  /* 11   */ V(3, 14, 1),
-
-  /* 0000 0000 1101 ... */
-  /* 00   */ V(11, 9, 1),	/* 356 */
-  /* 01   */ V(11, 9, 1),
-  /* 10   */ V(9, 11, 2),
-  /* 11   */ V(10, 10, 2),
-
-  /* 0000 0001 0001 ... */
-  /* 0    */ V(11, 10, 1),	/* 360 */
-  /* 1    */ V(14, 5, 1),
-
-  /* 0000 0001 0010 ... */
-  /* 0    */ V(14, 4, 1),	/* 362 */
-  /* 1    */ V(8, 12, 1),
-
-  /* 0000 0001 0011 ... */
-  /* 0    */ V(6, 13, 1),	/* 364 */
-  /* 1    */ V(14, 3, 1),
-
-  /* 0000 0001 0101 ... */
-  /* 0    */ V(2, 14, 1),	/* 366 */
-  /* 1    */ V(0, 14, 1),
-
-  /* 0000 0001 1000 ... */
-  /* 0    */ V(14, 0, 1),	/* 368 */
-  /* 1    */ V(5, 13, 1),
-
-  /* 0000 0001 1001 ... */
-  /* 0    */ V(13, 5, 1),	/* 370 */
-  /* 1    */ V(7, 12, 1),
-
-  /* 0000 0001 1010 ... */
-  /* 0    */ V(12, 7, 1),	/* 372 */
-  /* 1    */ V(4, 13, 1),
-
-  /* 0000 0001 1011 ... */
-  /* 0    */ V(8, 11, 1),	/* 374 */
-  /* 1    */ V(11, 8, 1),
-
-  /* 0000 0001 1100 ... */
-  /* 0    */ V(13, 4, 1),	/* 376 */
-  /* 1    */ V(9, 10, 1),
-
-  /* 0000 0001 1101 ... */
-  /* 0    */ V(10, 9, 1),	/* 378 */
-  /* 1    */ V(6, 12, 1),
-
-  /* 0000 0010 0000 ... */
-  /* 0    */ V(13, 3, 1),	/* 380 */
-  /* 1    */ V(7, 11, 1),
-
-  /* 0000 0010 0101 ... */
-  /* 0    */ V(5, 12, 1),	/* 382 */
-  /* 1    */ V(12, 5, 1),
-
-  /* 0000 0010 0110 ... */
-  /* 0    */ V(9, 9, 1),	/* 384 */
-  /* 1    */ V(7, 10, 1),
-
-  /* 0000 0010 1000 ... */
-  /* 0    */ V(10, 7, 1),	/* 386 */
-  /* 1    */ V(9, 7, 1),
+  /* 0000000000 */ PTR(1024, 6),
+  /* 0000000001 */ PTR(1098, 5),
+  /* 0000000010 */ PTR(1130, 4),
+  /* 0000000011 */ PTR(1146, 4),
+  /* 0000000100 */ PTR(1162, 3),
+  /* 0000000101 */ PTR(1170, 3),
+  /* 0000000110 */ PTR(1178, 3),
+  /* 0000000111 */ PTR(1186, 3),
+  /* 0000001000 */ PTR(1194, 3),
+  /* 0000001001 */ PTR(1202, 3),
+  /* 0000001010 */ PTR(1210, 3),
+  /* 0000001011 */ PTR(1218, 2),
+  /* 0000001100 */ PTR(1222, 2),
+  /* 0000001101 */ PTR(1226, 1),
+  /* 0000001110 */ PTR(1228, 1),
+  /* 0000001111 */ PTR(1230, 2),
+  /* 0000010000 */ PTR(1234, 2),
+  /* 0000010001 */ PTR(1238, 2),
+  /* 0000010010 */ PTR(1242, 2),
+  /* 0000010011 */ PTR(1246, 2),
+  /* 0000010100 */ PTR(1250, 2),
+  /* 0000010101 */ PTR(1254, 2),
+  /* 0000010110 */ PTR(1258, 2),
+  /* 0000010111 */ V(11, 2, 10),
+  /* 0000011000 */ V(1, 11, 10),
+  /* 0000011001 */ V(11, 1, 10),
+  /* 0000011010 */ PTR(1262, 1),
+  /* 0000011011 */ PTR(1264, 1),
+  /* 0000011100 */ PTR(1266, 1),
+  /* 0000011101 */ PTR(1268, 1),
+  /* 0000011110 */ V(2, 10, 10),
+  /* 0000011111 */ V(10, 2, 10),
+  /* 0000100000 */ V(1, 10, 10),
+  /* 0000100001 */ V(10, 1, 10),
+  /* 0000100010 */ PTR(1270, 1),
+  /* 0000100011 */ V(10, 0, 10),
+  /* 0000100100 */ PTR(1272, 1),
+  /* 0000100101 */ V(9, 3, 10),
+  /* 0000100110 */ PTR(1274, 1),
+  /* 0000100111 */ PTR(1276, 1),
+  /* 0000101000 */ V(2, 9, 10),
+  /* 0000101001 */ V(9, 2, 10),
+  /* 0000101010 */ PTR(1278, 1),
+  /* 0000101011 */ V(3, 8, 10),
+  /* 0000101100 */ V(8, 3, 10),
+  /* 0000101101 */ PTR(1280, 1),
+  /* 0000101110 */ PTR(1282, 1),
+  /* 0000101111 */ PTR(1284, 1),
+  /* 0000110000 */ V(1, 9, 9),
+  /* 0000110001 */ V(1, 9, 9),
+  /* 0000110010 */ V(9, 1, 9),
+  /* 0000110011 */ V(9, 1, 9),
+  /* 0000110100 */ V(0, 9, 10),
+  /* 0000110101 */ V(9, 0, 10),
+  /* 0000110110 */ V(4, 8, 10),
+  /* 0000110111 */ V(8, 4, 10),
+  /* 0000111000 */ V(7, 2, 10),
+  /* 0000111001 */ PTR(1286, 1),
+  /* 0000111010 */ V(2, 8, 9),
+  /* 0000111011 */ V(2, 8, 9),
+  /* 0000111100 */ V(8, 2, 9),
+  /* 0000111101 */ V(8, 2, 9),
+  /* 0000111110 */ V(1, 8, 9),
+  /* 0000111111 */ V(1, 8, 9),
+  /* 0001000000 */ V(3, 7, 10),
+  /* 0001000001 */ V(2, 7, 10),
+  /* 0001000010 */ V(1, 7, 9),
+  /* 0001000011 */ V(1, 7, 9),
+  /* 0001000100 */ V(7, 1, 9),
+  /* 0001000101 */ V(7, 1, 9),
+  /* 0001000110 */ V(5, 5, 10),
+  /* 0001000111 */ V(0, 7, 10),
+  /* 0001001000 */ V(7, 0, 10),
+  /* 0001001001 */ V(3, 6, 10),
+  /* 0001001010 */ V(6, 3, 10),
+  /* 0001001011 */ V(4, 5, 10),
+  /* 0001001100 */ V(5, 4, 10),
+  /* 0001001101 */ V(2, 6, 10),
+  /* 0001001110 */ V(6, 2, 10),
+  /* 0001001111 */ V(3, 5, 10),
+  /* 0001010000 */ V(8, 1, 8),
+  /* 0001010001 */ V(8, 1, 8),
+  /* 0001010010 */ V(8, 1, 8),
+  /* 0001010011 */ V(8, 1, 8),
+  /* 0001010100 */ V(0, 8, 9),
+  /* 0001010101 */ V(0, 8, 9),
+  /* 0001010110 */ V(8, 0, 9),
+  /* 0001010111 */ V(8, 0, 9),
+  /* 0001011000 */ V(1, 6, 9),
+  /* 0001011001 */ V(1, 6, 9),
+  /* 0001011010 */ V(6, 1, 9),
+  /* 0001011011 */ V(6, 1, 9),
+  /* 0001011100 */ V(0, 6, 9),
+  /* 0001011101 */ V(0, 6, 9),
+  /* 0001011110 */ V(6, 0, 9),
+  /* 0001011111 */ V(6, 0, 9),
+  /* 0001100000 */ V(5, 3, 10),
+  /* 0001100001 */ V(4, 4, 10),
+  /* 0001100010 */ V(2, 5, 9),
+  /* 0001100011 */ V(2, 5, 9),
+  /* 0001100100 */ V(5, 2, 9),
+  /* 0001100101 */ V(5, 2, 9),
+  /* 0001100110 */ V(0, 5, 9),
+  /* 0001100111 */ V(0, 5, 9),
+  /* 0001101000 */ V(1, 5, 8),
+  /* 0001101001 */ V(1, 5, 8),
+  /* 0001101010 */ V(1, 5, 8),
+  /* 0001101011 */ V(1, 5, 8),
+  /* 0001101100 */ V(5, 1, 8),
+  /* 0001101101 */ V(5, 1, 8),
+  /* 0001101110 */ V(5, 1, 8),
+  /* 0001101111 */ V(5, 1, 8),
+  /* 0001110000 */ V(3, 4, 9),
+  /* 0001110001 */ V(3, 4, 9),
+  /* 0001110010 */ V(4, 3, 9),
+  /* 0001110011 */ V(4, 3, 9),
+  /* 0001110100 */ V(5, 0, 9),
+  /* 0001110101 */ V(5, 0, 9),
+  /* 0001110110 */ V(2, 4, 9),
+  /* 0001110111 */ V(2, 4, 9),
+  /* 0001111000 */ V(4, 2, 9),
+  /* 0001111001 */ V(4, 2, 9),
+  /* 0001111010 */ V(3, 3, 9),
+  /* 0001111011 */ V(3, 3, 9),
+  /* 0001111100 */ V(1, 4, 8),
+  /* 0001111101 */ V(1, 4, 8),
+  /* 0001111110 */ V(1, 4, 8),
+  /* 0001111111 */ V(1, 4, 8),
+  /* 0010000000 */ V(4, 1, 7),
+  /* 0010000001 */ V(4, 1, 7),
+  /* 0010000010 */ V(4, 1, 7),
+  /* 0010000011 */ V(4, 1, 7),
+  /* 0010000100 */ V(4, 1, 7),
+  /* 0010000101 */ V(4, 1, 7),
+  /* 0010000110 */ V(4, 1, 7),
+  /* 0010000111 */ V(4, 1, 7),
+  /* 0010001000 */ V(0, 4, 8),
+  /* 0010001001 */ V(0, 4, 8),
+  /* 0010001010 */ V(0, 4, 8),
+  /* 0010001011 */ V(0, 4, 8),
+  /* 0010001100 */ V(4, 0, 8),
+  /* 0010001101 */ V(4, 0, 8),
+  /* 0010001110 */ V(4, 0, 8),
+  /* 0010001111 */ V(4, 0, 8),
+  /* 0010010000 */ V(2, 3, 8),
+  /* 0010010001 */ V(2, 3, 8),
+  /* 0010010010 */ V(2, 3, 8),
+  /* 0010010011 */ V(2, 3, 8),
+  /* 0010010100 */ V(3, 2, 8),
+  /* 0010010101 */ V(3, 2, 8),
+  /* 0010010110 */ V(3, 2, 8),
+  /* 0010010111 */ V(3, 2, 8),
+  /* 0010011000 */ V(1, 3, 7),
+  /* 0010011001 */ V(1, 3, 7),
+  /* 0010011010 */ V(1, 3, 7),
+  /* 0010011011 */ V(1, 3, 7),
+  /* 0010011100 */ V(1, 3, 7),
+  /* 0010011101 */ V(1, 3, 7),
+  /* 0010011110 */ V(1, 3, 7),
+  /* 0010011111 */ V(1, 3, 7),
+  /* 0010100000 */ V(3, 1, 7),
+  /* 0010100001 */ V(3, 1, 7),
+  /* 0010100010 */ V(3, 1, 7),
+  /* 0010100011 */ V(3, 1, 7),
+  /* 0010100100 */ V(3, 1, 7),
+  /* 0010100101 */ V(3, 1, 7),
+  /* 0010100110 */ V(3, 1, 7),
+  /* 0010100111 */ V(3, 1, 7),
+  /* 0010101000 */ V(0, 3, 7),
+  /* 0010101001 */ V(0, 3, 7),
+  /* 0010101010 */ V(0, 3, 7),
+  /* 0010101011 */ V(0, 3, 7),
+  /* 0010101100 */ V(0, 3, 7),
+  /* 0010101101 */ V(0, 3, 7),
+  /* 0010101110 */ V(0, 3, 7),
+  /* 0010101111 */ V(0, 3, 7),
+  /* 0010110000 */ V(3, 0, 7),
+  /* 0010110001 */ V(3, 0, 7),
+  /* 0010110010 */ V(3, 0, 7),
+  /* 0010110011 */ V(3, 0, 7),
+  /* 0010110100 */ V(3, 0, 7),
+  /* 0010110101 */ V(3, 0, 7),
+  /* 0010110110 */ V(3, 0, 7),
+  /* 0010110111 */ V(3, 0, 7),
+  /* 0010111000 */ V(2, 2, 7),
+  /* 0010111001 */ V(2, 2, 7),
+  /* 0010111010 */ V(2, 2, 7),
+  /* 0010111011 */ V(2, 2, 7),
+  /* 0010111100 */ V(2, 2, 7),
+  /* 0010111101 */ V(2, 2, 7),
+  /* 0010111110 */ V(2, 2, 7),
+  /* 0010111111 */ V(2, 2, 7),
+  /* 0011000000 */ V(1, 2, 6),
+  /* 0011000001 */ V(1, 2, 6),
+  /* 0011000010 */ V(1, 2, 6),
+  /* 0011000011 */ V(1, 2, 6),
+  /* 0011000100 */ V(1, 2, 6),
+  /* 0011000101 */ V(1, 2, 6),
+  /* 0011000110 */ V(1, 2, 6),
+  /* 0011000111 */ V(1, 2, 6),
+  /* 0011001000 */ V(1, 2, 6),
+  /* 0011001001 */ V(1, 2, 6),
+  /* 0011001010 */ V(1, 2, 6),
+  /* 0011001011 */ V(1, 2, 6),
+  /* 0011001100 */ V(1, 2, 6),
+  /* 0011001101 */ V(1, 2, 6),
+  /* 0011001110 */ V(1, 2, 6),
+  /* 0011001111 */ V(1, 2, 6),
+  /* 0011010000 */ V(2, 1, 6),
+  /* 0011010001 */ V(2, 1, 6),
+  /* 0011010010 */ V(2, 1, 6),
+  /* 0011010011 */ V(2, 1, 6),
+  /* 0011010100 */ V(2, 1, 6),
+  /* 0011010101 */ V(2, 1, 6),
+  /* 0011010110 */ V(2, 1, 6),
+  /* 0011010111 */ V(2, 1, 6),
+  /* 0011011000 */ V(2, 1, 6),
+  /* 0011011001 */ V(2, 1, 6),
+  /* 0011011010 */ V(2, 1, 6),
+  /* 0011011011 */ V(2, 1, 6),
+  /* 0011011100 */ V(2, 1, 6),
+  /* 0011011101 */ V(2, 1, 6),
+  /* 0011011110 */ V(2, 1, 6),
+  /* 0011011111 */ V(2, 1, 6),
+  /* 0011100000 */ V(0, 2, 6),
+  /* 0011100001 */ V(0, 2, 6),
+  /* 0011100010 */ V(0, 2, 6),
+  /* 0011100011 */ V(0, 2, 6),
+  /* 0011100100 */ V(0, 2, 6),
+  /* 0011100101 */ V(0, 2, 6),
+  /* 0011100110 */ V(0, 2, 6),
+  /* 0011100111 */ V(0, 2, 6),
+  /* 0011101000 */ V(0, 2, 6),
+  /* 0011101001 */ V(0, 2, 6),
+  /* 0011101010 */ V(0, 2, 6),
+  /* 0011101011 */ V(0, 2, 6),
+  /* 0011101100 */ V(0, 2, 6),
+  /* 0011101101 */ V(0, 2, 6),
+  /* 0011101110 */ V(0, 2, 6),
+  /* 0011101111 */ V(0, 2, 6),
+  /* 0011110000 */ V(2, 0, 6),
+  /* 0011110001 */ V(2, 0, 6),
+  /* 0011110010 */ V(2, 0, 6),
+  /* 0011110011 */ V(2, 0, 6),
+  /* 0011110100 */ V(2, 0, 6),
+  /* 0011110101 */ V(2, 0, 6),
+  /* 0011110110 */ V(2, 0, 6),
+  /* 0011110111 */ V(2, 0, 6),
+  /* 0011111000 */ V(2, 0, 6),
+  /* 0011111001 */ V(2, 0, 6),
+  /* 0011111010 */ V(2, 0, 6),
+  /* 0011111011 */ V(2, 0, 6),
+  /* 0011111100 */ V(2, 0, 6),
+  /* 0011111101 */ V(2, 0, 6),
+  /* 0011111110 */ V(2, 0, 6),
+  /* 0011111111 */ V(2, 0, 6),
+  /* 0100000000 */ V(1, 1, 4),
+  /* 0100000001 */ V(1, 1, 4),
+  /* 0100000010 */ V(1, 1, 4),
+  /* 0100000011 */ V(1, 1, 4),
+  /* 0100000100 */ V(1, 1, 4),
+  /* 0100000101 */ V(1, 1, 4),
+  /* 0100000110 */ V(1, 1, 4),
+  /* 0100000111 */ V(1, 1, 4),
+  /* 0100001000 */ V(1, 1, 4),
+  /* 0100001001 */ V(1, 1, 4),
+  /* 0100001010 */ V(1, 1, 4),
+  /* 0100001011 */ V(1, 1, 4),
+  /* 0100001100 */ V(1, 1, 4),
+  /* 0100001101 */ V(1, 1, 4),
+  /* 0100001110 */ V(1, 1, 4),
+  /* 0100001111 */ V(1, 1, 4),
+  /* 0100010000 */ V(1, 1, 4),
+  /* 0100010001 */ V(1, 1, 4),
+  /* 0100010010 */ V(1, 1, 4),
+  /* 0100010011 */ V(1, 1, 4),
+  /* 0100010100 */ V(1, 1, 4),
+  /* 0100010101 */ V(1, 1, 4),
+  /* 0100010110 */ V(1, 1, 4),
+  /* 0100010111 */ V(1, 1, 4),
+  /* 0100011000 */ V(1, 1, 4),
+  /* 0100011001 */ V(1, 1, 4),
+  /* 0100011010 */ V(1, 1, 4),
+  /* 0100011011 */ V(1, 1, 4),
+  /* 0100011100 */ V(1, 1, 4),
+  /* 0100011101 */ V(1, 1, 4),
+  /* 0100011110 */ V(1, 1, 4),
+  /* 0100011111 */ V(1, 1, 4),
+  /* 0100100000 */ V(1, 1, 4),
+  /* 0100100001 */ V(1, 1, 4),
+  /* 0100100010 */ V(1, 1, 4),
+  /* 0100100011 */ V(1, 1, 4),
+  /* 0100100100 */ V(1, 1, 4),
+  /* 0100100101 */ V(1, 1, 4),
+  /* 0100100110 */ V(1, 1, 4),
+  /* 0100100111 */ V(1, 1, 4),
+  /* 0100101000 */ V(1, 1, 4),
+  /* 0100101001 */ V(1, 1, 4),
+  /* 0100101010 */ V(1, 1, 4),
+  /* 0100101011 */ V(1, 1, 4),
+  /* 0100101100 */ V(1, 1, 4),
+  /* 0100101101 */ V(1, 1, 4),
+  /* 0100101110 */ V(1, 1, 4),
+  /* 0100101111 */ V(1, 1, 4),
+  /* 0100110000 */ V(1, 1, 4),
+  /* 0100110001 */ V(1, 1, 4),
+  /* 0100110010 */ V(1, 1, 4),
+  /* 0100110011 */ V(1, 1, 4),
+  /* 0100110100 */ V(1, 1, 4),
+  /* 0100110101 */ V(1, 1, 4),
+  /* 0100110110 */ V(1, 1, 4),
+  /* 0100110111 */ V(1, 1, 4),
+  /* 0100111000 */ V(1, 1, 4),
+  /* 0100111001 */ V(1, 1, 4),
+  /* 0100111010 */ V(1, 1, 4),
+  /* 0100111011 */ V(1, 1, 4),
+  /* 0100111100 */ V(1, 1, 4),
+  /* 0100111101 */ V(1, 1, 4),
+  /* 0100111110 */ V(1, 1, 4),
+  /* 0100111111 */ V(1, 1, 4),
+  /* 0101000000 */ V(0, 1, 4),
+  /* 0101000001 */ V(0, 1, 4),
+  /* 0101000010 */ V(0, 1, 4),
+  /* 0101000011 */ V(0, 1, 4),
+  /* 0101000100 */ V(0, 1, 4),
+  /* 0101000101 */ V(0, 1, 4),
+  /* 0101000110 */ V(0, 1, 4),
+  /* 0101000111 */ V(0, 1, 4),
+  /* 0101001000 */ V(0, 1, 4),
+  /* 0101001001 */ V(0, 1, 4),
+  /* 0101001010 */ V(0, 1, 4),
+  /* 0101001011 */ V(0, 1, 4),
+  /* 0101001100 */ V(0, 1, 4),
+  /* 0101001101 */ V(0, 1, 4),
+  /* 0101001110 */ V(0, 1, 4),
+  /* 0101001111 */ V(0, 1, 4),
+  /* 0101010000 */ V(0, 1, 4),
+  /* 0101010001 */ V(0, 1, 4),
+  /* 0101010010 */ V(0, 1, 4),
+  /* 0101010011 */ V(0, 1, 4),
+  /* 0101010100 */ V(0, 1, 4),
+  /* 0101010101 */ V(0, 1, 4),
+  /* 0101010110 */ V(0, 1, 4),
+  /* 0101010111 */ V(0, 1, 4),
+  /* 0101011000 */ V(0, 1, 4),
+  /* 0101011001 */ V(0, 1, 4),
+  /* 0101011010 */ V(0, 1, 4),
+  /* 0101011011 */ V(0, 1, 4),
+  /* 0101011100 */ V(0, 1, 4),
+  /* 0101011101 */ V(0, 1, 4),
+  /* 0101011110 */ V(0, 1, 4),
+  /* 0101011111 */ V(0, 1, 4),
+  /* 0101100000 */ V(0, 1, 4),
+  /* 0101100001 */ V(0, 1, 4),
+  /* 0101100010 */ V(0, 1, 4),
+  /* 0101100011 */ V(0, 1, 4),
+  /* 0101100100 */ V(0, 1, 4),
+  /* 0101100101 */ V(0, 1, 4),
+  /* 0101100110 */ V(0, 1, 4),
+  /* 0101100111 */ V(0, 1, 4),
+  /* 0101101000 */ V(0, 1, 4),
+  /* 0101101001 */ V(0, 1, 4),
+  /* 0101101010 */ V(0, 1, 4),
+  /* 0101101011 */ V(0, 1, 4),
+  /* 0101101100 */ V(0, 1, 4),
+  /* 0101101101 */ V(0, 1, 4),
+  /* 0101101110 */ V(0, 1, 4),
+  /* 0101101111 */ V(0, 1, 4),
+  /* 0101110000 */ V(0, 1, 4),
+  /* 0101110001 */ V(0, 1, 4),
+  /* 0101110010 */ V(0, 1, 4),
+  /* 0101110011 */ V(0, 1, 4),
+  /* 0101110100 */ V(0, 1, 4),
+  /* 0101110101 */ V(0, 1, 4),
+  /* 0101110110 */ V(0, 1, 4),
+  /* 0101110111 */ V(0, 1, 4),
+  /* 0101111000 */ V(0, 1, 4),
+  /* 0101111001 */ V(0, 1, 4),
+  /* 0101111010 */ V(0, 1, 4),
+  /* 0101111011 */ V(0, 1, 4),
+  /* 0101111100 */ V(0, 1, 4),
+  /* 0101111101 */ V(0, 1, 4),
+  /* 0101111110 */ V(0, 1, 4),
+  /* 0101111111 */ V(0, 1, 4),
+  /* 0110000000 */ V(1, 0, 3),
+  /* 0110000001 */ V(1, 0, 3),
+  /* 0110000010 */ V(1, 0, 3),
+  /* 0110000011 */ V(1, 0, 3),
+  /* 0110000100 */ V(1, 0, 3),
+  /* 0110000101 */ V(1, 0, 3),
+  /* 0110000110 */ V(1, 0, 3),
+  /* 0110000111 */ V(1, 0, 3),
+  /* 0110001000 */ V(1, 0, 3),
+  /* 0110001001 */ V(1, 0, 3),
+  /* 0110001010 */ V(1, 0, 3),
+  /* 0110001011 */ V(1, 0, 3),
+  /* 0110001100 */ V(1, 0, 3),
+  /* 0110001101 */ V(1, 0, 3),
+  /* 0110001110 */ V(1, 0, 3),
+  /* 0110001111 */ V(1, 0, 3),
+  /* 0110010000 */ V(1, 0, 3),
+  /* 0110010001 */ V(1, 0, 3),
+  /* 0110010010 */ V(1, 0, 3),
+  /* 0110010011 */ V(1, 0, 3),
+  /* 0110010100 */ V(1, 0, 3),
+  /* 0110010101 */ V(1, 0, 3),
+  /* 0110010110 */ V(1, 0, 3),
+  /* 0110010111 */ V(1, 0, 3),
+  /* 0110011000 */ V(1, 0, 3),
+  /* 0110011001 */ V(1, 0, 3),
+  /* 0110011010 */ V(1, 0, 3),
+  /* 0110011011 */ V(1, 0, 3),
+  /* 0110011100 */ V(1, 0, 3),
+  /* 0110011101 */ V(1, 0, 3),
+  /* 0110011110 */ V(1, 0, 3),
+  /* 0110011111 */ V(1, 0, 3),
+  /* 0110100000 */ V(1, 0, 3),
+  /* 0110100001 */ V(1, 0, 3),
+  /* 0110100010 */ V(1, 0, 3),
+  /* 0110100011 */ V(1, 0, 3),
+  /* 0110100100 */ V(1, 0, 3),
+  /* 0110100101 */ V(1, 0, 3),
+  /* 0110100110 */ V(1, 0, 3),
+  /* 0110100111 */ V(1, 0, 3),
+  /* 0110101000 */ V(1, 0, 3),
+  /* 0110101001 */ V(1, 0, 3),
+  /* 0110101010 */ V(1, 0, 3),
+  /* 0110101011 */ V(1, 0, 3),
+  /* 0110101100 */ V(1, 0, 3),
+  /* 0110101101 */ V(1, 0, 3),
+  /* 0110101110 */ V(1, 0, 3),
+  /* 0110101111 */ V(1, 0, 3),
+  /* 0110110000 */ V(1, 0, 3),
+  /* 0110110001 */ V(1, 0, 3),
+  /* 0110110010 */ V(1, 0, 3),
+  /* 0110110011 */ V(1, 0, 3),
+  /* 0110110100 */ V(1, 0, 3),
+  /* 0110110101 */ V(1, 0, 3),
+  /* 0110110110 */ V(1, 0, 3),
+  /* 0110110111 */ V(1, 0, 3),
+  /* 0110111000 */ V(1, 0, 3),
+  /* 0110111001 */ V(1, 0, 3),
+  /* 0110111010 */ V(1, 0, 3),
+  /* 0110111011 */ V(1, 0, 3),
+  /* 0110111100 */ V(1, 0, 3),
+  /* 0110111101 */ V(1, 0, 3),
+  /* 0110111110 */ V(1, 0, 3),
+  /* 0110111111 */ V(1, 0, 3),
+  /* 0111000000 */ V(1, 0, 3),
+  /* 0111000001 */ V(1, 0, 3),
+  /* 0111000010 */ V(1, 0, 3),
+  /* 0111000011 */ V(1, 0, 3),
+  /* 0111000100 */ V(1, 0, 3),
+  /* 0111000101 */ V(1, 0, 3),
+  /* 0111000110 */ V(1, 0, 3),
+  /* 0111000111 */ V(1, 0, 3),
+  /* 0111001000 */ V(1, 0, 3),
+  /* 0111001001 */ V(1, 0, 3),
+  /* 0111001010 */ V(1, 0, 3),
+  /* 0111001011 */ V(1, 0, 3),
+  /* 0111001100 */ V(1, 0, 3),
+  /* 0111001101 */ V(1, 0, 3),
+  /* 0111001110 */ V(1, 0, 3),
+  /* 0111001111 */ V(1, 0, 3),
+  /* 0111010000 */ V(1, 0, 3),
+  /* 0111010001 */ V(1, 0, 3),
+  /* 0111010010 */ V(1, 0, 3),
+  /* 0111010011 */ V(1, 0, 3),
+  /* 0111010100 */ V(1, 0, 3),
+  /* 0111010101 */ V(1, 0, 3),
+  /* 0111010110 */ V(1, 0, 3),
+  /* 0111010111 */ V(1, 0, 3),
+  /* 0111011000 */ V(1, 0, 3),
+  /* 0111011001 */ V(1, 0, 3),
+  /* 0111011010 */ V(1, 0, 3),
+  /* 0111011011 */ V(1, 0, 3),
+  /* 0111011100 */ V(1, 0, 3),
+  /* 0111011101 */ V(1, 0, 3),
+  /* 0111011110 */ V(1, 0, 3),
+  /* 0111011111 */ V(1, 0, 3),
+  /* 0111100000 */ V(1, 0, 3),
+  /* 0111100001 */ V(1, 0, 3),
+  /* 0111100010 */ V(1, 0, 3),
+  /* 0111100011 */ V(1, 0, 3),
+  /* 0111100100 */ V(1, 0, 3),
+  /* 0111100101 */ V(1, 0, 3),
+  /* 0111100110 */ V(1, 0, 3),
+  /* 0111100111 */ V(1, 0, 3),
+  /* 0111101000 */ V(1, 0, 3),
+  /* 0111101001 */ V(1, 0, 3),
+  /* 0111101010 */ V(1, 0, 3),
+  /* 0111101011 */ V(1, 0, 3),
+  /* 0111101100 */ V(1, 0, 3),
+  /* 0111101101 */ V(1, 0, 3),
+  /* 0111101110 */ V(1, 0, 3),
+  /* 0111101111 */ V(1, 0, 3),
+  /* 0111110000 */ V(1, 0, 3),
+  /* 0111110001 */ V(1, 0, 3),
+  /* 0111110010 */ V(1, 0, 3),
+  /* 0111110011 */ V(1, 0, 3),
+  /* 0111110100 */ V(1, 0, 3),
+  /* 0111110101 */ V(1, 0, 3),
+  /* 0111110110 */ V(1, 0, 3),
+  /* 0111110111 */ V(1, 0, 3),
+  /* 0111111000 */ V(1, 0, 3),
+  /* 0111111001 */ V(1, 0, 3),
+  /* 0111111010 */ V(1, 0, 3),
+  /* 0111111011 */ V(1, 0, 3),
+  /* 0111111100 */ V(1, 0, 3),
+  /* 0111111101 */ V(1, 0, 3),
+  /* 0111111110 */ V(1, 0, 3),
+  /* 0111111111 */ V(1, 0, 3),
+  /* 1000000000 */ V(0, 0, 1),
+  /* 1000000001 */ V(0, 0, 1),
+  /* 1000000010 */ V(0, 0, 1),
+  /* 1000000011 */ V(0, 0, 1),
+  /* 1000000100 */ V(0, 0, 1),
+  /* 1000000101 */ V(0, 0, 1),
+  /* 1000000110 */ V(0, 0, 1),
+  /* 1000000111 */ V(0, 0, 1),
+  /* 1000001000 */ V(0, 0, 1),
+  /* 1000001001 */ V(0, 0, 1),
+  /* 1000001010 */ V(0, 0, 1),
+  /* 1000001011 */ V(0, 0, 1),
+  /* 1000001100 */ V(0, 0, 1),
+  /* 1000001101 */ V(0, 0, 1),
+  /* 1000001110 */ V(0, 0, 1),
+  /* 1000001111 */ V(0, 0, 1),
+  /* 1000010000 */ V(0, 0, 1),
+  /* 1000010001 */ V(0, 0, 1),
+  /* 1000010010 */ V(0, 0, 1),
+  /* 1000010011 */ V(0, 0, 1),
+  /* 1000010100 */ V(0, 0, 1),
+  /* 1000010101 */ V(0, 0, 1),
+  /* 1000010110 */ V(0, 0, 1),
+  /* 1000010111 */ V(0, 0, 1),
+  /* 1000011000 */ V(0, 0, 1),
+  /* 1000011001 */ V(0, 0, 1),
+  /* 1000011010 */ V(0, 0, 1),
+  /* 1000011011 */ V(0, 0, 1),
+  /* 1000011100 */ V(0, 0, 1),
+  /* 1000011101 */ V(0, 0, 1),
+  /* 1000011110 */ V(0, 0, 1),
+  /* 1000011111 */ V(0, 0, 1),
+  /* 1000100000 */ V(0, 0, 1),
+  /* 1000100001 */ V(0, 0, 1),
+  /* 1000100010 */ V(0, 0, 1),
+  /* 1000100011 */ V(0, 0, 1),
+  /* 1000100100 */ V(0, 0, 1),
+  /* 1000100101 */ V(0, 0, 1),
+  /* 1000100110 */ V(0, 0, 1),
+  /* 1000100111 */ V(0, 0, 1),
+  /* 1000101000 */ V(0, 0, 1),
+  /* 1000101001 */ V(0, 0, 1),
+  /* 1000101010 */ V(0, 0, 1),
+  /* 1000101011 */ V(0, 0, 1),
+  /* 1000101100 */ V(0, 0, 1),
+  /* 1000101101 */ V(0, 0, 1),
+  /* 1000101110 */ V(0, 0, 1),
+  /* 1000101111 */ V(0, 0, 1),
+  /* 1000110000 */ V(0, 0, 1),
+  /* 1000110001 */ V(0, 0, 1),
+  /* 1000110010 */ V(0, 0, 1),
+  /* 1000110011 */ V(0, 0, 1),
+  /* 1000110100 */ V(0, 0, 1),
+  /* 1000110101 */ V(0, 0, 1),
+  /* 1000110110 */ V(0, 0, 1),
+  /* 1000110111 */ V(0, 0, 1),
+  /* 1000111000 */ V(0, 0, 1),
+  /* 1000111001 */ V(0, 0, 1),
+  /* 1000111010 */ V(0, 0, 1),
+  /* 1000111011 */ V(0, 0, 1),
+  /* 1000111100 */ V(0, 0, 1),
+  /* 1000111101 */ V(0, 0, 1),
+  /* 1000111110 */ V(0, 0, 1),
+  /* 1000111111 */ V(0, 0, 1),
+  /* 1001000000 */ V(0, 0, 1),
+  /* 1001000001 */ V(0, 0, 1),
+  /* 1001000010 */ V(0, 0, 1),
+  /* 1001000011 */ V(0, 0, 1),
+  /* 1001000100 */ V(0, 0, 1),
+  /* 1001000101 */ V(0, 0, 1),
+  /* 1001000110 */ V(0, 0, 1),
+  /* 1001000111 */ V(0, 0, 1),
+  /* 1001001000 */ V(0, 0, 1),
+  /* 1001001001 */ V(0, 0, 1),
+  /* 1001001010 */ V(0, 0, 1),
+  /* 1001001011 */ V(0, 0, 1),
+  /* 1001001100 */ V(0, 0, 1),
+  /* 1001001101 */ V(0, 0, 1),
+  /* 1001001110 */ V(0, 0, 1),
+  /* 1001001111 */ V(0, 0, 1),
+  /* 1001010000 */ V(0, 0, 1),
+  /* 1001010001 */ V(0, 0, 1),
+  /* 1001010010 */ V(0, 0, 1),
+  /* 1001010011 */ V(0, 0, 1),
+  /* 1001010100 */ V(0, 0, 1),
+  /* 1001010101 */ V(0, 0, 1),
+  /* 1001010110 */ V(0, 0, 1),
+  /* 1001010111 */ V(0, 0, 1),
+  /* 1001011000 */ V(0, 0, 1),
+  /* 1001011001 */ V(0, 0, 1),
+  /* 1001011010 */ V(0, 0, 1),
+  /* 1001011011 */ V(0, 0, 1),
+  /* 1001011100 */ V(0, 0, 1),
+  /* 1001011101 */ V(0, 0, 1),
+  /* 1001011110 */ V(0, 0, 1),
+  /* 1001011111 */ V(0, 0, 1),
+  /* 1001100000 */ V(0, 0, 1),
+  /* 1001100001 */ V(0, 0, 1),
+  /* 1001100010 */ V(0, 0, 1),
+  /* 1001100011 */ V(0, 0, 1),
+  /* 1001100100 */ V(0, 0, 1),
+  /* 1001100101 */ V(0, 0, 1),
+  /* 1001100110 */ V(0, 0, 1),
+  /* 1001100111 */ V(0, 0, 1),
+  /* 1001101000 */ V(0, 0, 1),
+  /* 1001101001 */ V(0, 0, 1),
+  /* 1001101010 */ V(0, 0, 1),
+  /* 1001101011 */ V(0, 0, 1),
+  /* 1001101100 */ V(0, 0, 1),
+  /* 1001101101 */ V(0, 0, 1),
+  /* 1001101110 */ V(0, 0, 1),
+  /* 1001101111 */ V(0, 0, 1),
+  /* 1001110000 */ V(0, 0, 1),
+  /* 1001110001 */ V(0, 0, 1),
+  /* 1001110010 */ V(0, 0, 1),
+  /* 1001110011 */ V(0, 0, 1),
+  /* 1001110100 */ V(0, 0, 1),
+  /* 1001110101 */ V(0, 0, 1),
+  /* 1001110110 */ V(0, 0, 1),
+  /* 1001110111 */ V(0, 0, 1),
+  /* 1001111000 */ V(0, 0, 1),
+  /* 1001111001 */ V(0, 0, 1),
+  /* 1001111010 */ V(0, 0, 1),
+  /* 1001111011 */ V(0, 0, 1),
+  /* 1001111100 */ V(0, 0, 1),
+  /* 1001111101 */ V(0, 0, 1),
+  /* 1001111110 */ V(0, 0, 1),
+  /* 1001111111 */ V(0, 0, 1),
+  /* 1010000000 */ V(0, 0, 1),
+  /* 1010000001 */ V(0, 0, 1),
+  /* 1010000010 */ V(0, 0, 1),
+  /* 1010000011 */ V(0, 0, 1),
+  /* 1010000100 */ V(0, 0, 1),
+  /* 1010000101 */ V(0, 0, 1),
+  /* 1010000110 */ V(0, 0, 1),
+  /* 1010000111 */ V(0, 0, 1),
+  /* 1010001000 */ V(0, 0, 1),
+  /* 1010001001 */ V(0, 0, 1),
+  /* 1010001010 */ V(0, 0, 1),
+  /* 1010001011 */ V(0, 0, 1),
+  /* 1010001100 */ V(0, 0, 1),
+  /* 1010001101 */ V(0, 0, 1),
+  /* 1010001110 */ V(0, 0, 1),
+  /* 1010001111 */ V(0, 0, 1),
+  /* 1010010000 */ V(0, 0, 1),
+  /* 1010010001 */ V(0, 0, 1),
+  /* 1010010010 */ V(0, 0, 1),
+  /* 1010010011 */ V(0, 0, 1),
+  /* 1010010100 */ V(0, 0, 1),
+  /* 1010010101 */ V(0, 0, 1),
+  /* 1010010110 */ V(0, 0, 1),
+  /* 1010010111 */ V(0, 0, 1),
+  /* 1010011000 */ V(0, 0, 1),
+  /* 1010011001 */ V(0, 0, 1),
+  /* 1010011010 */ V(0, 0, 1),
+  /* 1010011011 */ V(0, 0, 1),
+  /* 1010011100 */ V(0, 0, 1),
+  /* 1010011101 */ V(0, 0, 1),
+  /* 1010011110 */ V(0, 0, 1),
+  /* 1010011111 */ V(0, 0, 1),
+  /* 1010100000 */ V(0, 0, 1),
+  /* 1010100001 */ V(0, 0, 1),
+  /* 1010100010 */ V(0, 0, 1),
+  /* 1010100011 */ V(0, 0, 1),
+  /* 1010100100 */ V(0, 0, 1),
+  /* 1010100101 */ V(0, 0, 1),
+  /* 1010100110 */ V(0, 0, 1),
+  /* 1010100111 */ V(0, 0, 1),
+  /* 1010101000 */ V(0, 0, 1),
+  /* 1010101001 */ V(0, 0, 1),
+  /* 1010101010 */ V(0, 0, 1),
+  /* 1010101011 */ V(0, 0, 1),
+  /* 1010101100 */ V(0, 0, 1),
+  /* 1010101101 */ V(0, 0, 1),
+  /* 1010101110 */ V(0, 0, 1),
+  /* 1010101111 */ V(0, 0, 1),
+  /* 1010110000 */ V(0, 0, 1),
+  /* 1010110001 */ V(0, 0, 1),
+  /* 1010110010 */ V(0, 0, 1),
+  /* 1010110011 */ V(0, 0, 1),
+  /* 1010110100 */ V(0, 0, 1),
+  /* 1010110101 */ V(0, 0, 1),
+  /* 1010110110 */ V(0, 0, 1),
+  /* 1010110111 */ V(0, 0, 1),
+  /* 1010111000 */ V(0, 0, 1),
+  /* 1010111001 */ V(0, 0, 1),
+  /* 1010111010 */ V(0, 0, 1),
+  /* 1010111011 */ V(0, 0, 1),
+  /* 1010111100 */ V(0, 0, 1),
+  /* 1010111101 */ V(0, 0, 1),
+  /* 1010111110 */ V(0, 0, 1),
+  /* 1010111111 */ V(0, 0, 1),
+  /* 1011000000 */ V(0, 0, 1),
+  /* 1011000001 */ V(0, 0, 1),
+  /* 1011000010 */ V(0, 0, 1),
+  /* 1011000011 */ V(0, 0, 1),
+  /* 1011000100 */ V(0, 0, 1),
+  /* 1011000101 */ V(0, 0, 1),
+  /* 1011000110 */ V(0, 0, 1),
+  /* 1011000111 */ V(0, 0, 1),
+  /* 1011001000 */ V(0, 0, 1),
+  /* 1011001001 */ V(0, 0, 1),
+  /* 1011001010 */ V(0, 0, 1),
+  /* 1011001011 */ V(0, 0, 1),
+  /* 1011001100 */ V(0, 0, 1),
+  /* 1011001101 */ V(0, 0, 1),
+  /* 1011001110 */ V(0, 0, 1),
+  /* 1011001111 */ V(0, 0, 1),
+  /* 1011010000 */ V(0, 0, 1),
+  /* 1011010001 */ V(0, 0, 1),
+  /* 1011010010 */ V(0, 0, 1),
+  /* 1011010011 */ V(0, 0, 1),
+  /* 1011010100 */ V(0, 0, 1),
+  /* 1011010101 */ V(0, 0, 1),
+  /* 1011010110 */ V(0, 0, 1),
+  /* 1011010111 */ V(0, 0, 1),
+  /* 1011011000 */ V(0, 0, 1),
+  /* 1011011001 */ V(0, 0, 1),
+  /* 1011011010 */ V(0, 0, 1),
+  /* 1011011011 */ V(0, 0, 1),
+  /* 1011011100 */ V(0, 0, 1),
+  /* 1011011101 */ V(0, 0, 1),
+  /* 1011011110 */ V(0, 0, 1),
+  /* 1011011111 */ V(0, 0, 1),
+  /* 1011100000 */ V(0, 0, 1),
+  /* 1011100001 */ V(0, 0, 1),
+  /* 1011100010 */ V(0, 0, 1),
+  /* 1011100011 */ V(0, 0, 1),
+  /* 1011100100 */ V(0, 0, 1),
+  /* 1011100101 */ V(0, 0, 1),
+  /* 1011100110 */ V(0, 0, 1),
+  /* 1011100111 */ V(0, 0, 1),
+  /* 1011101000 */ V(0, 0, 1),
+  /* 1011101001 */ V(0, 0, 1),
+  /* 1011101010 */ V(0, 0, 1),
+  /* 1011101011 */ V(0, 0, 1),
+  /* 1011101100 */ V(0, 0, 1),
+  /* 1011101101 */ V(0, 0, 1),
+  /* 1011101110 */ V(0, 0, 1),
+  /* 1011101111 */ V(0, 0, 1),
+  /* 1011110000 */ V(0, 0, 1),
+  /* 1011110001 */ V(0, 0, 1),
+  /* 1011110010 */ V(0, 0, 1),
+  /* 1011110011 */ V(0, 0, 1),
+  /* 1011110100 */ V(0, 0, 1),
+  /* 1011110101 */ V(0, 0, 1),
+  /* 1011110110 */ V(0, 0, 1),
+  /* 1011110111 */ V(0, 0, 1),
+  /* 1011111000 */ V(0, 0, 1),
+  /* 1011111001 */ V(0, 0, 1),
+  /* 1011111010 */ V(0, 0, 1),
+  /* 1011111011 */ V(0, 0, 1),
+  /* 1011111100 */ V(0, 0, 1),
+  /* 1011111101 */ V(0, 0, 1),
+  /* 1011111110 */ V(0, 0, 1),
+  /* 1011111111 */ V(0, 0, 1),
+  /* 1100000000 */ V(0, 0, 1),
+  /* 1100000001 */ V(0, 0, 1),
+  /* 1100000010 */ V(0, 0, 1),
+  /* 1100000011 */ V(0, 0, 1),
+  /* 1100000100 */ V(0, 0, 1),
+  /* 1100000101 */ V(0, 0, 1),
+  /* 1100000110 */ V(0, 0, 1),
+  /* 1100000111 */ V(0, 0, 1),
+  /* 1100001000 */ V(0, 0, 1),
+  /* 1100001001 */ V(0, 0, 1),
+  /* 1100001010 */ V(0, 0, 1),
+  /* 1100001011 */ V(0, 0, 1),
+  /* 1100001100 */ V(0, 0, 1),
+  /* 1100001101 */ V(0, 0, 1),
+  /* 1100001110 */ V(0, 0, 1),
+  /* 1100001111 */ V(0, 0, 1),
+  /* 1100010000 */ V(0, 0, 1),
+  /* 1100010001 */ V(0, 0, 1),
+  /* 1100010010 */ V(0, 0, 1),
+  /* 1100010011 */ V(0, 0, 1),
+  /* 1100010100 */ V(0, 0, 1),
+  /* 1100010101 */ V(0, 0, 1),
+  /* 1100010110 */ V(0, 0, 1),
+  /* 1100010111 */ V(0, 0, 1),
+  /* 1100011000 */ V(0, 0, 1),
+  /* 1100011001 */ V(0, 0, 1),
+  /* 1100011010 */ V(0, 0, 1),
+  /* 1100011011 */ V(0, 0, 1),
+  /* 1100011100 */ V(0, 0, 1),
+  /* 1100011101 */ V(0, 0, 1),
+  /* 1100011110 */ V(0, 0, 1),
+  /* 1100011111 */ V(0, 0, 1),
+  /* 1100100000 */ V(0, 0, 1),
+  /* 1100100001 */ V(0, 0, 1),
+  /* 1100100010 */ V(0, 0, 1),
+  /* 1100100011 */ V(0, 0, 1),
+  /* 1100100100 */ V(0, 0, 1),
+  /* 1100100101 */ V(0, 0, 1),
+  /* 1100100110 */ V(0, 0, 1),
+  /* 1100100111 */ V(0, 0, 1),
+  /* 1100101000 */ V(0, 0, 1),
+  /* 1100101001 */ V(0, 0, 1),
+  /* 1100101010 */ V(0, 0, 1),
+  /* 1100101011 */ V(0, 0, 1),
+  /* 1100101100 */ V(0, 0, 1),
+  /* 1100101101 */ V(0, 0, 1),
+  /* 1100101110 */ V(0, 0, 1),
+  /* 1100101111 */ V(0, 0, 1),
+  /* 1100110000 */ V(0, 0, 1),
+  /* 1100110001 */ V(0, 0, 1),
+  /* 1100110010 */ V(0, 0, 1),
+  /* 1100110011 */ V(0, 0, 1),
+  /* 1100110100 */ V(0, 0, 1),
+  /* 1100110101 */ V(0, 0, 1),
+  /* 1100110110 */ V(0, 0, 1),
+  /* 1100110111 */ V(0, 0, 1),
+  /* 1100111000 */ V(0, 0, 1),
+  /* 1100111001 */ V(0, 0, 1),
+  /* 1100111010 */ V(0, 0, 1),
+  /* 1100111011 */ V(0, 0, 1),
+  /* 1100111100 */ V(0, 0, 1),
+  /* 1100111101 */ V(0, 0, 1),
+  /* 1100111110 */ V(0, 0, 1),
+  /* 1100111111 */ V(0, 0, 1),
+  /* 1101000000 */ V(0, 0, 1),
+  /* 1101000001 */ V(0, 0, 1),
+  /* 1101000010 */ V(0, 0, 1),
+  /* 1101000011 */ V(0, 0, 1),
+  /* 1101000100 */ V(0, 0, 1),
+  /* 1101000101 */ V(0, 0, 1),
+  /* 1101000110 */ V(0, 0, 1),
+  /* 1101000111 */ V(0, 0, 1),
+  /* 1101001000 */ V(0, 0, 1),
+  /* 1101001001 */ V(0, 0, 1),
+  /* 1101001010 */ V(0, 0, 1),
+  /* 1101001011 */ V(0, 0, 1),
+  /* 1101001100 */ V(0, 0, 1),
+  /* 1101001101 */ V(0, 0, 1),
+  /* 1101001110 */ V(0, 0, 1),
+  /* 1101001111 */ V(0, 0, 1),
+  /* 1101010000 */ V(0, 0, 1),
+  /* 1101010001 */ V(0, 0, 1),
+  /* 1101010010 */ V(0, 0, 1),
+  /* 1101010011 */ V(0, 0, 1),
+  /* 1101010100 */ V(0, 0, 1),
+  /* 1101010101 */ V(0, 0, 1),
+  /* 1101010110 */ V(0, 0, 1),
+  /* 1101010111 */ V(0, 0, 1),
+  /* 1101011000 */ V(0, 0, 1),
+  /* 1101011001 */ V(0, 0, 1),
+  /* 1101011010 */ V(0, 0, 1),
+  /* 1101011011 */ V(0, 0, 1),
+  /* 1101011100 */ V(0, 0, 1),
+  /* 1101011101 */ V(0, 0, 1),
+  /* 1101011110 */ V(0, 0, 1),
+  /* 1101011111 */ V(0, 0, 1),
+  /* 1101100000 */ V(0, 0, 1),
+  /* 1101100001 */ V(0, 0, 1),
+  /* 1101100010 */ V(0, 0, 1),
+  /* 1101100011 */ V(0, 0, 1),
+  /* 1101100100 */ V(0, 0, 1),
+  /* 1101100101 */ V(0, 0, 1),
+  /* 1101100110 */ V(0, 0, 1),
+  /* 1101100111 */ V(0, 0, 1),
+  /* 1101101000 */ V(0, 0, 1),
+  /* 1101101001 */ V(0, 0, 1),
+  /* 1101101010 */ V(0, 0, 1),
+  /* 1101101011 */ V(0, 0, 1),
+  /* 1101101100 */ V(0, 0, 1),
+  /* 1101101101 */ V(0, 0, 1),
+  /* 1101101110 */ V(0, 0, 1),
+  /* 1101101111 */ V(0, 0, 1),
+  /* 1101110000 */ V(0, 0, 1),
+  /* 1101110001 */ V(0, 0, 1),
+  /* 1101110010 */ V(0, 0, 1),
+  /* 1101110011 */ V(0, 0, 1),
+  /* 1101110100 */ V(0, 0, 1),
+  /* 1101110101 */ V(0, 0, 1),
+  /* 1101110110 */ V(0, 0, 1),
+  /* 1101110111 */ V(0, 0, 1),
+  /* 1101111000 */ V(0, 0, 1),
+  /* 1101111001 */ V(0, 0, 1),
+  /* 1101111010 */ V(0, 0, 1),
+  /* 1101111011 */ V(0, 0, 1),
+  /* 1101111100 */ V(0, 0, 1),
+  /* 1101111101 */ V(0, 0, 1),
+  /* 1101111110 */ V(0, 0, 1),
+  /* 1101111111 */ V(0, 0, 1),
+  /* 1110000000 */ V(0, 0, 1),
+  /* 1110000001 */ V(0, 0, 1),
+  /* 1110000010 */ V(0, 0, 1),
+  /* 1110000011 */ V(0, 0, 1),
+  /* 1110000100 */ V(0, 0, 1),
+  /* 1110000101 */ V(0, 0, 1),
+  /* 1110000110 */ V(0, 0, 1),
+  /* 1110000111 */ V(0, 0, 1),
+  /* 1110001000 */ V(0, 0, 1),
+  /* 1110001001 */ V(0, 0, 1),
+  /* 1110001010 */ V(0, 0, 1),
+  /* 1110001011 */ V(0, 0, 1),
+  /* 1110001100 */ V(0, 0, 1),
+  /* 1110001101 */ V(0, 0, 1),
+  /* 1110001110 */ V(0, 0, 1),
+  /* 1110001111 */ V(0, 0, 1),
+  /* 1110010000 */ V(0, 0, 1),
+  /* 1110010001 */ V(0, 0, 1),
+  /* 1110010010 */ V(0, 0, 1),
+  /* 1110010011 */ V(0, 0, 1),
+  /* 1110010100 */ V(0, 0, 1),
+  /* 1110010101 */ V(0, 0, 1),
+  /* 1110010110 */ V(0, 0, 1),
+  /* 1110010111 */ V(0, 0, 1),
+  /* 1110011000 */ V(0, 0, 1),
+  /* 1110011001 */ V(0, 0, 1),
+  /* 1110011010 */ V(0, 0, 1),
+  /* 1110011011 */ V(0, 0, 1),
+  /* 1110011100 */ V(0, 0, 1),
+  /* 1110011101 */ V(0, 0, 1),
+  /* 1110011110 */ V(0, 0, 1),
+  /* 1110011111 */ V(0, 0, 1),
+  /* 1110100000 */ V(0, 0, 1),
+  /* 1110100001 */ V(0, 0, 1),
+  /* 1110100010 */ V(0, 0, 1),
+  /* 1110100011 */ V(0, 0, 1),
+  /* 1110100100 */ V(0, 0, 1),
+  /* 1110100101 */ V(0, 0, 1),
+  /* 1110100110 */ V(0, 0, 1),
+  /* 1110100111 */ V(0, 0, 1),
+  /* 1110101000 */ V(0, 0, 1),
+  /* 1110101001 */ V(0, 0, 1),
+  /* 1110101010 */ V(0, 0, 1),
+  /* 1110101011 */ V(0, 0, 1),
+  /* 1110101100 */ V(0, 0, 1),
+  /* 1110101101 */ V(0, 0, 1),
+  /* 1110101110 */ V(0, 0, 1),
+  /* 1110101111 */ V(0, 0, 1),
+  /* 1110110000 */ V(0, 0, 1),
+  /* 1110110001 */ V(0, 0, 1),
+  /* 1110110010 */ V(0, 0, 1),
+  /* 1110110011 */ V(0, 0, 1),
+  /* 1110110100 */ V(0, 0, 1),
+  /* 1110110101 */ V(0, 0, 1),
+  /* 1110110110 */ V(0, 0, 1),
+  /* 1110110111 */ V(0, 0, 1),
+  /* 1110111000 */ V(0, 0, 1),
+  /* 1110111001 */ V(0, 0, 1),
+  /* 1110111010 */ V(0, 0, 1),
+  /* 1110111011 */ V(0, 0, 1),
+  /* 1110111100 */ V(0, 0, 1),
+  /* 1110111101 */ V(0, 0, 1),
+  /* 1110111110 */ V(0, 0, 1),
+  /* 1110111111 */ V(0, 0, 1),
+  /* 1111000000 */ V(0, 0, 1),
+  /* 1111000001 */ V(0, 0, 1),
+  /* 1111000010 */ V(0, 0, 1),
+  /* 1111000011 */ V(0, 0, 1),
+  /* 1111000100 */ V(0, 0, 1),
+  /* 1111000101 */ V(0, 0, 1),
+  /* 1111000110 */ V(0, 0, 1),
+  /* 1111000111 */ V(0, 0, 1),
+  /* 1111001000 */ V(0, 0, 1),
+  /* 1111001001 */ V(0, 0, 1),
+  /* 1111001010 */ V(0, 0, 1),
+  /* 1111001011 */ V(0, 0, 1),
+  /* 1111001100 */ V(0, 0, 1),
+  /* 1111001101 */ V(0, 0, 1),
+  /* 1111001110 */ V(0, 0, 1),
+  /* 1111001111 */ V(0, 0, 1),
+  /* 1111010000 */ V(0, 0, 1),
+  /* 1111010001 */ V(0, 0, 1),
+  /* 1111010010 */ V(0, 0, 1),
+  /* 1111010011 */ V(0, 0, 1),
+  /* 1111010100 */ V(0, 0, 1),
+  /* 1111010101 */ V(0, 0, 1),
+  /* 1111010110 */ V(0, 0, 1),
+  /* 1111010111 */ V(0, 0, 1),
+  /* 1111011000 */ V(0, 0, 1),
+  /* 1111011001 */ V(0, 0, 1),
+  /* 1111011010 */ V(0, 0, 1),
+  /* 1111011011 */ V(0, 0, 1),
+  /* 1111011100 */ V(0, 0, 1),
+  /* 1111011101 */ V(0, 0, 1),
+  /* 1111011110 */ V(0, 0, 1),
+  /* 1111011111 */ V(0, 0, 1),
+  /* 1111100000 */ V(0, 0, 1),
+  /* 1111100001 */ V(0, 0, 1),
+  /* 1111100010 */ V(0, 0, 1),
+  /* 1111100011 */ V(0, 0, 1),
+  /* 1111100100 */ V(0, 0, 1),
+  /* 1111100101 */ V(0, 0, 1),
+  /* 1111100110 */ V(0, 0, 1),
+  /* 1111100111 */ V(0, 0, 1),
+  /* 1111101000 */ V(0, 0, 1),
+  /* 1111101001 */ V(0, 0, 1),
+  /* 1111101010 */ V(0, 0, 1),
+  /* 1111101011 */ V(0, 0, 1),
+  /* 1111101100 */ V(0, 0, 1),
+  /* 1111101101 */ V(0, 0, 1),
+  /* 1111101110 */ V(0, 0, 1),
+  /* 1111101111 */ V(0, 0, 1),
+  /* 1111110000 */ V(0, 0, 1),
+  /* 1111110001 */ V(0, 0, 1),
+  /* 1111110010 */ V(0, 0, 1),
+  /* 1111110011 */ V(0, 0, 1),
+  /* 1111110100 */ V(0, 0, 1),
+  /* 1111110101 */ V(0, 0, 1),
+  /* 1111110110 */ V(0, 0, 1),
+  /* 1111110111 */ V(0, 0, 1),
+  /* 1111111000 */ V(0, 0, 1),
+  /* 1111111001 */ V(0, 0, 1),
+  /* 1111111010 */ V(0, 0, 1),
+  /* 1111111011 */ V(0, 0, 1),
+  /* 1111111100 */ V(0, 0, 1),
+  /* 1111111101 */ V(0, 0, 1),
+  /* 1111111110 */ V(0, 0, 1),
+  /* 1111111111 */ V(0, 0, 1),
+
+  /* 0000 0000 00 ... */
+  /* 000000 */ PTR(1088, 3),	/* 1024 */
+  /* 000001 */ V(15, 15, 6),
+  /* 000010 */ V(14, 15, 6),
+  /* 000011 */ V(13, 15, 6),
+  /* 000100 */ V(14, 14, 6),
+  /* 000101 */ V(12, 15, 6),
+  /* 000110 */ V(13, 14, 6),
+  /* 000111 */ V(11, 15, 6),
+  /* 001000 */ V(15, 11, 6),
+  /* 001001 */ V(12, 14, 6),
+  /* 001010 */ V(13, 12, 6),
+  /* 001011 */ PTR(1096, 1),
+  /* 001100 */ V(14, 12, 5),
+  /* 001101 */ V(14, 12, 5),
+  /* 001110 */ V(13, 13, 5),
+  /* 001111 */ V(13, 13, 5),
+  /* 010000 */ V(15, 10, 6),
+  /* 010001 */ V(12, 13, 6),
+  /* 010010 */ V(11, 14, 5),
+  /* 010011 */ V(11, 14, 5),
+  /* 010100 */ V(14, 11, 5),
+  /* 010101 */ V(14, 11, 5),
+  /* 010110 */ V(9, 15, 5),
+  /* 010111 */ V(9, 15, 5),
+  /* 011000 */ V(15, 9, 5),
+  /* 011001 */ V(15, 9, 5),
+  /* 011010 */ V(14, 10, 5),
+  /* 011011 */ V(14, 10, 5),
+  /* 011100 */ V(11, 13, 5),
+  /* 011101 */ V(11, 13, 5),
+  /* 011110 */ V(13, 11, 5),
+  /* 011111 */ V(13, 11, 5),
+  /* 100000 */ V(8, 15, 5),
+  /* 100001 */ V(8, 15, 5),
+  /* 100010 */ V(15, 8, 5),
+  /* 100011 */ V(15, 8, 5),
+  /* 100100 */ V(12, 12, 5),
+  /* 100101 */ V(12, 12, 5),
+  /* 100110 */ V(10, 14, 6),
+  /* 100111 */ V(9, 14, 6),
+  /* 101000 */ V(8, 14, 5),
+  /* 101001 */ V(8, 14, 5),
+  /* 101010 */ V(7, 15, 6),
+  /* 101011 */ V(7, 14, 6),
+  /* 101100 */ V(15, 7, 4),
+  /* 101101 */ V(15, 7, 4),
+  /* 101110 */ V(15, 7, 4),
+  /* 101111 */ V(15, 7, 4),
+  /* 110000 */ V(13, 10, 4),
+  /* 110001 */ V(13, 10, 4),
+  /* 110010 */ V(13, 10, 4),
+  /* 110011 */ V(13, 10, 4),
+  /* 110100 */ V(10, 13, 5),
+  /* 110101 */ V(10, 13, 5),
+  /* 110110 */ V(11, 12, 5),
+  /* 110111 */ V(11, 12, 5),
+  /* 111000 */ V(12, 11, 5),
+  /* 111001 */ V(12, 11, 5),
+  /* 111010 */ V(15, 6, 5),
+  /* 111011 */ V(15, 6, 5),
+  /* 111100 */ V(6, 15, 4),
+  /* 111101 */ V(6, 15, 4),
+  /* 111110 */ V(6, 15, 4),
+  /* 111111 */ V(6, 15, 4),
 
   /* 0000 0000 0000 0000 ... */
-  /* 000  */ V(15, 14, 3),	/* 388 */
+  /* 000  */ V(15, 14, 3),	/* 1088 */
   /* 001  */ V(15, 12, 3),
   /* 010  */ V(15, 13, 2),
   /* 011  */ V(15, 13, 2),
@@ -1504,1566 +7535,3984 @@ union huffpair const hufftab13[] = {
   /* 111  */ V(14, 13, 1),
 
   /* 0000 0000 0000 1011 ... */
-  /* 0    */ V(10, 15, 1),	/* 396 */
-  /* 1    */ V(14, 9, 1)
-};
-
-static
-union huffpair const hufftab15[] = {
-  /* 0000 */ PTR(16, 4),
-  /* 0001 */ PTR(32, 4),
-  /* 0010 */ PTR(48, 4),
-  /* 0011 */ PTR(64, 4),
-  /* 0100 */ PTR(80, 4),
-  /* 0101 */ PTR(96, 3),
-  /* 0110 */ PTR(104, 3),
-  /* 0111 */ PTR(112, 2),
-  /* 1000 */ PTR(116, 1),
-  /* 1001 */ PTR(118, 1),
-  /* 1010 */ V(1, 1, 3),
-  /* 1011 */ V(1, 1, 3),
-  /* 1100 */ V(0, 1, 4),
-  /* 1101 */ V(1, 0, 4),
-  /* 1110 */ V(0, 0, 3),
-  /* 1111 */ V(0, 0, 3),
-
-  /* 0000 ... */
-  /* 0000 */ PTR(120, 4),	/* 16 */
-  /* 0001 */ PTR(136, 4),
-  /* 0010 */ PTR(152, 4),
-  /* 0011 */ PTR(168, 4),
-  /* 0100 */ PTR(184, 4),
-  /* 0101 */ PTR(200, 3),
-  /* 0110 */ PTR(208, 3),
-  /* 0111 */ PTR(216, 4),
-  /* 1000 */ PTR(232, 3),
-  /* 1001 */ PTR(240, 3),
-  /* 1010 */ PTR(248, 3),
-  /* 1011 */ PTR(256, 3),
-  /* 1100 */ PTR(264, 2),
-  /* 1101 */ PTR(268, 3),
-  /* 1110 */ PTR(276, 3),
-  /* 1111 */ PTR(284, 2),
-
-  /* 0001 ... */
-  /* 0000 */ PTR(288, 2),	/* 32 */
-  /* 0001 */ PTR(292, 2),
-  /* 0010 */ PTR(296, 2),
-  /* 0011 */ PTR(300, 2),
-  /* 0100 */ PTR(304, 2),
-  /* 0101 */ PTR(308, 2),
-  /* 0110 */ PTR(312, 2),
-  /* 0111 */ PTR(316, 2),
-  /* 1000 */ PTR(320, 1),
-  /* 1001 */ PTR(322, 1),
-  /* 1010 */ PTR(324, 1),
-  /* 1011 */ PTR(326, 2),
-  /* 1100 */ PTR(330, 1),
-  /* 1101 */ PTR(332, 1),
-  /* 1110 */ PTR(334, 2),
-  /* 1111 */ PTR(338, 1),
-
-  /* 0010 ... */
-  /* 0000 */ PTR(340, 1),	/* 48 */
-  /* 0001 */ PTR(342, 1),
-  /* 0010 */ V(9, 1, 4),
-  /* 0011 */ PTR(344, 1),
-  /* 0100 */ PTR(346, 1),
-  /* 0101 */ PTR(348, 1),
-  /* 0110 */ PTR(350, 1),
-  /* 0111 */ PTR(352, 1),
-  /* 1000 */ V(2, 8, 4),
-  /* 1001 */ V(8, 2, 4),
-  /* 1010 */ V(1, 8, 4),
-  /* 1011 */ V(8, 1, 4),
-  /* 1100 */ PTR(354, 1),
-  /* 1101 */ PTR(356, 1),
-  /* 1110 */ PTR(358, 1),
-  /* 1111 */ PTR(360, 1),
-
-  /* 0011 ... */
-  /* 0000 */ V(2, 7, 4),	/* 64 */
-  /* 0001 */ V(7, 2, 4),
-  /* 0010 */ V(6, 4, 4),
-  /* 0011 */ V(1, 7, 4),
-  /* 0100 */ V(5, 5, 4),
-  /* 0101 */ V(7, 1, 4),
-  /* 0110 */ PTR(362, 1),
-  /* 0111 */ V(3, 6, 4),
-  /* 1000 */ V(6, 3, 4),
-  /* 1001 */ V(4, 5, 4),
-  /* 1010 */ V(5, 4, 4),
-  /* 1011 */ V(2, 6, 4),
-  /* 1100 */ V(6, 2, 4),
-  /* 1101 */ V(1, 6, 4),
-  /* 1110 */ PTR(364, 1),
-  /* 1111 */ V(3, 5, 4),
-
-  /* 0100 ... */
-  /* 0000 */ V(6, 1, 3),	/* 80 */
-  /* 0001 */ V(6, 1, 3),
-  /* 0010 */ V(5, 3, 4),
-  /* 0011 */ V(4, 4, 4),
-  /* 0100 */ V(2, 5, 3),
-  /* 0101 */ V(2, 5, 3),
-  /* 0110 */ V(5, 2, 3),
-  /* 0111 */ V(5, 2, 3),
-  /* 1000 */ V(1, 5, 3),
-  /* 1001 */ V(1, 5, 3),
-  /* 1010 */ V(5, 1, 3),
-  /* 1011 */ V(5, 1, 3),
-  /* 1100 */ V(0, 5, 4),
-  /* 1101 */ V(5, 0, 4),
-  /* 1110 */ V(3, 4, 3),
-  /* 1111 */ V(3, 4, 3),
-
-  /* 0101 ... */
-  /* 000  */ V(4, 3, 3),	/* 96 */
-  /* 001  */ V(2, 4, 3),
-  /* 010  */ V(4, 2, 3),
-  /* 011  */ V(3, 3, 3),
-  /* 100  */ V(4, 1, 2),
-  /* 101  */ V(4, 1, 2),
-  /* 110  */ V(1, 4, 3),
-  /* 111  */ V(0, 4, 3),
-
-  /* 0110 ... */
-  /* 000  */ V(2, 3, 2),	/* 104 */
-  /* 001  */ V(2, 3, 2),
-  /* 010  */ V(3, 2, 2),
-  /* 011  */ V(3, 2, 2),
-  /* 100  */ V(4, 0, 3),
-  /* 101  */ V(0, 3, 3),
-  /* 110  */ V(1, 3, 2),
-  /* 111  */ V(1, 3, 2),
-
-  /* 0111 ... */
-  /* 00   */ V(3, 1, 2),	/* 112 */
-  /* 01   */ V(3, 0, 2),
-  /* 10   */ V(2, 2, 1),
-  /* 11   */ V(2, 2, 1),
-
-  /* 1000 ... */
-  /* 0    */ V(1, 2, 1),	/* 116 */
-  /* 1    */ V(2, 1, 1),
-
-  /* 1001 ... */
-  /* 0    */ V(0, 2, 1),	/* 118 */
-  /* 1    */ V(2, 0, 1),
-
-  /* 0000 0000 ... */
-  /* 0000 */ PTR(366, 1),	/* 120 */
-  /* 0001 */ PTR(368, 1),
-  /* 0010 */ V(14, 14, 4),
-  /* 0011 */ PTR(370, 1),
-  /* 0100 */ PTR(372, 1),
-  /* 0101 */ PTR(374, 1),
-  /* 0110 */ V(15, 11, 4),
-  /* 0111 */ PTR(376, 1),
-  /* 1000 */ V(13, 13, 4),
-  /* 1001 */ V(10, 15, 4),
-  /* 1010 */ V(15, 10, 4),
-  /* 1011 */ V(11, 14, 4),
-  /* 1100 */ V(14, 11, 4),
-  /* 1101 */ V(12, 13, 4),
-  /* 1110 */ V(13, 12, 4),
-  /* 1111 */ V(9, 15, 4),
-
-  /* 0000 0001 ... */
-  /* 0000 */ V(15, 9, 4),	/* 136 */
-  /* 0001 */ V(14, 10, 4),
-  /* 0010 */ V(11, 13, 4),
-  /* 0011 */ V(13, 11, 4),
-  /* 0100 */ V(8, 15, 4),
-  /* 0101 */ V(15, 8, 4),
-  /* 0110 */ V(12, 12, 4),
-  /* 0111 */ V(9, 14, 4),
-  /* 1000 */ V(14, 9, 4),
-  /* 1001 */ V(7, 15, 4),
-  /* 1010 */ V(15, 7, 4),
-  /* 1011 */ V(10, 13, 4),
-  /* 1100 */ V(13, 10, 4),
-  /* 1101 */ V(11, 12, 4),
-  /* 1110 */ V(6, 15, 4),
-  /* 1111 */ PTR(378, 1),
-
-  /* 0000 0010 ... */
-  /* 0000 */ V(12, 11, 3),	/* 152 */
-  /* 0001 */ V(12, 11, 3),
-  /* 0010 */ V(15, 6, 3),
-  /* 0011 */ V(15, 6, 3),
-  /* 0100 */ V(8, 14, 4),
-  /* 0101 */ V(14, 8, 4),
-  /* 0110 */ V(5, 15, 4),
-  /* 0111 */ V(9, 13, 4),
-  /* 1000 */ V(15, 5, 3),
-  /* 1001 */ V(15, 5, 3),
-  /* 1010 */ V(7, 14, 3),
-  /* 1011 */ V(7, 14, 3),
-  /* 1100 */ V(14, 7, 3),
-  /* 1101 */ V(14, 7, 3),
-  /* 1110 */ V(10, 12, 3),
-  /* 1111 */ V(10, 12, 3),
-
-  /* 0000 0011 ... */
-  /* 0000 */ V(12, 10, 3),	/* 168 */
-  /* 0001 */ V(12, 10, 3),
-  /* 0010 */ V(11, 11, 3),
-  /* 0011 */ V(11, 11, 3),
-  /* 0100 */ V(13, 9, 4),
-  /* 0101 */ V(8, 13, 4),
-  /* 0110 */ V(4, 15, 3),
-  /* 0111 */ V(4, 15, 3),
-  /* 1000 */ V(15, 4, 3),
-  /* 1001 */ V(15, 4, 3),
-  /* 1010 */ V(3, 15, 3),
-  /* 1011 */ V(3, 15, 3),
-  /* 1100 */ V(15, 3, 3),
-  /* 1101 */ V(15, 3, 3),
-  /* 1110 */ V(13, 8, 3),
-  /* 1111 */ V(13, 8, 3),
-
-  /* 0000 0100 ... */
-  /* 0000 */ V(14, 6, 3),	/* 184 */
-  /* 0001 */ V(14, 6, 3),
-  /* 0010 */ V(2, 15, 3),
-  /* 0011 */ V(2, 15, 3),
-  /* 0100 */ V(15, 2, 3),
-  /* 0101 */ V(15, 2, 3),
-  /* 0110 */ V(6, 14, 4),
-  /* 0111 */ V(15, 0, 4),
-  /* 1000 */ V(1, 15, 3),
-  /* 1001 */ V(1, 15, 3),
-  /* 1010 */ V(15, 1, 3),
-  /* 1011 */ V(15, 1, 3),
-  /* 1100 */ V(9, 12, 3),
-  /* 1101 */ V(9, 12, 3),
-  /* 1110 */ V(12, 9, 3),
-  /* 1111 */ V(12, 9, 3),
-
-  /* 0000 0101 ... */
-  /* 000  */ V(5, 14, 3),	/* 200 */
-  /* 001  */ V(10, 11, 3),
+  /* 0    */ V(10, 15, 1),	/* 1096 */
+  /* 1    */ V(14, 9, 1),
+
+  /* 0000 0000 01 ... */
+  /* 00000 */ V(14, 8, 4),	/* 1098 */
+  /* 00001 */ V(14, 8, 4),
+  /* 00010 */ V(5, 15, 4),
+  /* 00011 */ V(5, 15, 4),
+  /* 00100 */ V(9, 13, 4),
+  /* 00101 */ V(9, 13, 4),
+  /* 00110 */ V(13, 9, 4),
+  /* 00111 */ V(13, 9, 4),
+  /* 01000 */ V(15, 5, 4),
+  /* 01001 */ V(15, 5, 4),
+  /* 01010 */ V(14, 7, 4),
+  /* 01011 */ V(14, 7, 4),
+  /* 01100 */ V(10, 12, 4),
+  /* 01101 */ V(10, 12, 4),
+  /* 01110 */ V(11, 11, 4),
+  /* 01111 */ V(11, 11, 4),
+  /* 10000 */ V(4, 15, 4),
+  /* 10001 */ V(4, 15, 4),
+  /* 10010 */ V(15, 4, 4),
+  /* 10011 */ V(15, 4, 4),
+  /* 10100 */ V(12, 10, 5),
+  /* 10101 */ V(14, 6, 5),
+  /* 10110 */ V(15, 3, 4),
+  /* 10111 */ V(15, 3, 4),
+  /* 11000 */ V(3, 15, 3),
+  /* 11001 */ V(3, 15, 3),
+  /* 11010 */ V(3, 15, 3),
+  /* 11011 */ V(3, 15, 3),
+  /* 11100 */ V(8, 13, 4),
+  /* 11101 */ V(8, 13, 4),
+  /* 11110 */ V(13, 8, 4),
+  /* 11111 */ V(13, 8, 4),
+
+  /* 0000 0000 10 ... */
+  /* 0000 */ V(2, 15, 3),	/* 1130 */
+  /* 0001 */ V(2, 15, 3),
+  /* 0010 */ V(15, 2, 3),
+  /* 0011 */ V(15, 2, 3),
+  /* 0100 */ V(6, 14, 4),
+  /* 0101 */ V(9, 12, 4),
+  /* 0110 */ V(0, 15, 3),
+  /* 0111 */ V(0, 15, 3),
+  /* 1000 */ V(12, 9, 4),
+  /* 1001 */ V(5, 14, 4),
+  /* 1010 */ V(10, 11, 3),
+  /* 1011 */ V(10, 11, 3),
+  /* 1100 */ V(7, 13, 4),
+  /* 1101 */ V(13, 7, 4),
+  /* 1110 */ V(4, 14, 3),
+  /* 1111 */ V(4, 14, 3),
+
+  /* 0000 0000 11 ... */
+  /* 0000 */ V(12, 8, 4),	/* 1146 */
+  /* 0001 */ V(13, 6, 4),
+  /* 0010 */ V(3, 14, 3),
+  /* 0011 */ V(3, 14, 3),
+  /* 0100 */ V(11, 9, 3),
+  /* 0101 */ V(11, 9, 3),
+  /* 0110 */ V(9, 11, 4),
+  /* 0111 */ V(10, 10, 4),
+  /* 1000 */ V(1, 15, 2),
+  /* 1001 */ V(1, 15, 2),
+  /* 1010 */ V(1, 15, 2),
+  /* 1011 */ V(1, 15, 2),
+  /* 1100 */ V(15, 1, 2),
+  /* 1101 */ V(15, 1, 2),
+  /* 1110 */ V(15, 1, 2),
+  /* 1111 */ V(15, 1, 2),
+
+  /* 0000 0001 00 ... */
+  /* 000  */ V(15, 0, 2),	/* 1162 */
+  /* 001  */ V(15, 0, 2),
   /* 010  */ V(11, 10, 3),
   /* 011  */ V(14, 5, 3),
-  /* 100  */ V(7, 13, 3),
-  /* 101  */ V(13, 7, 3),
-  /* 110  */ V(4, 14, 3),
-  /* 111  */ V(14, 4, 3),
-
-  /* 0000 0110 ... */
-  /* 000  */ V(8, 12, 3),	/* 208 */
-  /* 001  */ V(12, 8, 3),
-  /* 010  */ V(3, 14, 3),
-  /* 011  */ V(6, 13, 3),
-  /* 100  */ V(13, 6, 3),
-  /* 101  */ V(14, 3, 3),
-  /* 110  */ V(9, 11, 3),
-  /* 111  */ V(11, 9, 3),
-
-  /* 0000 0111 ... */
-  /* 0000 */ V(2, 14, 3),	/* 216 */
-  /* 0001 */ V(2, 14, 3),
-  /* 0010 */ V(10, 10, 3),
-  /* 0011 */ V(10, 10, 3),
-  /* 0100 */ V(14, 2, 3),
-  /* 0101 */ V(14, 2, 3),
-  /* 0110 */ V(1, 14, 3),
-  /* 0111 */ V(1, 14, 3),
-  /* 1000 */ V(14, 1, 3),
-  /* 1001 */ V(14, 1, 3),
-  /* 1010 */ V(0, 14, 4),
-  /* 1011 */ V(14, 0, 4),
-  /* 1100 */ V(5, 13, 3),
-  /* 1101 */ V(5, 13, 3),
-  /* 1110 */ V(13, 5, 3),
-  /* 1111 */ V(13, 5, 3),
-
-  /* 0000 1000 ... */
-  /* 000  */ V(7, 12, 3),	/* 232 */
-  /* 001  */ V(12, 7, 3),
-  /* 010  */ V(4, 13, 3),
-  /* 011  */ V(8, 11, 3),
-  /* 100  */ V(13, 4, 2),
-  /* 101  */ V(13, 4, 2),
-  /* 110  */ V(11, 8, 3),
-  /* 111  */ V(9, 10, 3),
-
-  /* 0000 1001 ... */
-  /* 000  */ V(10, 9, 3),	/* 240 */
-  /* 001  */ V(6, 12, 3),
-  /* 010  */ V(12, 6, 3),
-  /* 011  */ V(3, 13, 3),
-  /* 100  */ V(13, 3, 2),
-  /* 101  */ V(13, 3, 2),
-  /* 110  */ V(13, 2, 2),
-  /* 111  */ V(13, 2, 2),
-
-  /* 0000 1010 ... */
-  /* 000  */ V(2, 13, 3),	/* 248 */
-  /* 001  */ V(0, 13, 3),
-  /* 010  */ V(1, 13, 2),
-  /* 011  */ V(1, 13, 2),
-  /* 100  */ V(7, 11, 2),
-  /* 101  */ V(7, 11, 2),
-  /* 110  */ V(11, 7, 2),
-  /* 111  */ V(11, 7, 2),
-
-  /* 0000 1011 ... */
-  /* 000  */ V(13, 1, 2),	/* 256 */
-  /* 001  */ V(13, 1, 2),
+  /* 100  */ V(14, 4, 3),
+  /* 101  */ V(8, 12, 3),
+  /* 110  */ V(6, 13, 3),
+  /* 111  */ V(14, 3, 3),
+
+  /* 0000 0001 01 ... */
+  /* 000  */ V(14, 2, 2),	/* 1170 */
+  /* 001  */ V(14, 2, 2),
+  /* 010  */ V(2, 14, 3),
+  /* 011  */ V(0, 14, 3),
+  /* 100  */ V(1, 14, 2),
+  /* 101  */ V(1, 14, 2),
+  /* 110  */ V(14, 1, 2),
+  /* 111  */ V(14, 1, 2),
+
+  /* 0000 0001 10 ... */
+  /* 000  */ V(14, 0, 3),	/* 1178 */
+  /* 001  */ V(5, 13, 3),
+  /* 010  */ V(13, 5, 3),
+  /* 011  */ V(7, 12, 3),
+  /* 100  */ V(12, 7, 3),
+  /* 101  */ V(4, 13, 3),
+  /* 110  */ V(8, 11, 3),
+  /* 111  */ V(11, 8, 3),
+
+  /* 0000 0001 11 ... */
+  /* 000  */ V(13, 4, 3),	/* 1186 */
+  /* 001  */ V(9, 10, 3),
+  /* 010  */ V(10, 9, 3),
+  /* 011  */ V(6, 12, 3),
+  /* 100  */ V(12, 6, 2),
+  /* 101  */ V(12, 6, 2),
+  /* 110  */ V(3, 13, 2),
+  /* 111  */ V(3, 13, 2),
+
+  /* 0000 0010 00 ... */
+  /* 000  */ V(13, 3, 3),	/* 1194 */
+  /* 001  */ V(7, 11, 3),
+  /* 010  */ V(2, 13, 2),
+  /* 011  */ V(2, 13, 2),
+  /* 100  */ V(13, 2, 2),
+  /* 101  */ V(13, 2, 2),
+  /* 110  */ V(1, 13, 2),
+  /* 111  */ V(1, 13, 2),
+
+  /* 0000 0010 01 ... */
+  /* 000  */ V(11, 7, 2),	/* 1202 */
+  /* 001  */ V(11, 7, 2),
   /* 010  */ V(5, 12, 3),
-  /* 011  */ V(13, 0, 3),
-  /* 100  */ V(12, 5, 2),
-  /* 101  */ V(12, 5, 2),
-  /* 110  */ V(8, 10, 2),
-  /* 111  */ V(8, 10, 2),
-
-  /* 0000 1100 ... */
-  /* 00   */ V(10, 8, 2),	/* 264 */
-  /* 01   */ V(4, 12, 2),
-  /* 10   */ V(12, 4, 2),
-  /* 11   */ V(6, 11, 2),
-
-  /* 0000 1101 ... */
-  /* 000  */ V(11, 6, 2),	/* 268 */
-  /* 001  */ V(11, 6, 2),
-  /* 010  */ V(9, 9, 3),
-  /* 011  */ V(0, 12, 3),
-  /* 100  */ V(3, 12, 2),
-  /* 101  */ V(3, 12, 2),
+  /* 011  */ V(12, 5, 3),
+  /* 100  */ V(9, 9, 3),
+  /* 101  */ V(7, 10, 3),
   /* 110  */ V(12, 3, 2),
   /* 111  */ V(12, 3, 2),
 
-  /* 0000 1110 ... */
-  /* 000  */ V(7, 10, 2),	/* 276 */
-  /* 001  */ V(7, 10, 2),
-  /* 010  */ V(10, 7, 2),
-  /* 011  */ V(10, 7, 2),
-  /* 100  */ V(10, 6, 2),
-  /* 101  */ V(10, 6, 2),
-  /* 110  */ V(12, 0, 3),
-  /* 111  */ V(0, 11, 3),
-
-  /* 0000 1111 ... */
-  /* 00   */ V(12, 2, 1),	/* 284 */
-  /* 01   */ V(12, 2, 1),
-  /* 10   */ V(2, 12, 2),
-  /* 11   */ V(5, 11, 2),
-
-  /* 0001 0000 ... */
-  /* 00   */ V(11, 5, 2),	/* 288 */
-  /* 01   */ V(1, 12, 2),
-  /* 10   */ V(8, 9, 2),
-  /* 11   */ V(9, 8, 2),
-
-  /* 0001 0001 ... */
-  /* 00   */ V(12, 1, 2),	/* 292 */
-  /* 01   */ V(4, 11, 2),
+  /* 0000 0010 10 ... */
+  /* 000  */ V(10, 7, 3),	/* 1210 */
+  /* 001  */ V(9, 7, 3),
+  /* 010  */ V(4, 11, 2),
+  /* 011  */ V(4, 11, 2),
+  /* 100  */ V(13, 1, 1),
+  /* 101  */ V(13, 1, 1),
+  /* 110  */ V(13, 1, 1),
+  /* 111  */ V(13, 1, 1),
+
+  /* 0000 0010 11 ... */
+  /* 00   */ V(0, 13, 2),	/* 1218 */
+  /* 01   */ V(13, 0, 2),
+  /* 10   */ V(8, 10, 2),
+  /* 11   */ V(10, 8, 2),
+
+  /* 0000 0011 00 ... */
+  /* 00   */ V(4, 12, 2),	/* 1222 */
+  /* 01   */ V(12, 4, 2),
+  /* 10   */ V(6, 11, 2),
+  /* 11   */ V(11, 6, 2),
+
+  /* 0000 0011 01 ... */
+  /* 0    */ V(3, 12, 1),	/* 1226 */
+  /* 1    */ V(2, 12, 1),
+
+  /* 0000 0011 10 ... */
+  /* 0    */ V(12, 2, 1),	/* 1228 */
+  /* 1    */ V(5, 11, 1),
+
+  /* 0000 0011 11 ... */
+  /* 00   */ V(11, 5, 2),	/* 1230 */
+  /* 01   */ V(8, 9, 2),
+  /* 10   */ V(1, 12, 1),
+  /* 11   */ V(1, 12, 1),
+
+  /* 0000 0100 00 ... */
+  /* 00   */ V(12, 1, 1),	/* 1234 */
+  /* 01   */ V(12, 1, 1),
+  /* 10   */ V(9, 8, 2),
+  /* 11   */ V(0, 12, 2),
+
+  /* 0000 0100 01 ... */
+  /* 00   */ V(12, 0, 1),	/* 1238 */
+  /* 01   */ V(12, 0, 1),
   /* 10   */ V(11, 4, 2),
   /* 11   */ V(6, 10, 2),
 
-  /* 0001 0010 ... */
-  /* 00   */ V(3, 11, 2),	/* 296 */
+  /* 0000 0100 10 ... */
+  /* 00   */ V(10, 6, 2),	/* 1242 */
   /* 01   */ V(7, 9, 2),
-  /* 10   */ V(11, 3, 1),
-  /* 11   */ V(11, 3, 1),
+  /* 10   */ V(3, 11, 1),
+  /* 11   */ V(3, 11, 1),
 
-  /* 0001 0011 ... */
-  /* 00   */ V(9, 7, 2),	/* 300 */
-  /* 01   */ V(8, 8, 2),
-  /* 10   */ V(2, 11, 2),
+  /* 0000 0100 11 ... */
+  /* 00   */ V(11, 3, 1),	/* 1246 */
+  /* 01   */ V(11, 3, 1),
+  /* 10   */ V(8, 8, 2),
   /* 11   */ V(5, 10, 2),
 
-  /* 0001 0100 ... */
-  /* 00   */ V(11, 2, 1),	/* 304 */
-  /* 01   */ V(11, 2, 1),
+  /* 0000 0101 00 ... */
+  /* 00   */ V(2, 11, 1),	/* 1250 */
+  /* 01   */ V(2, 11, 1),
   /* 10   */ V(10, 5, 2),
-  /* 11   */ V(1, 11, 2),
-
-  /* 0001 0101 ... */
-  /* 00   */ V(11, 1, 1),	/* 308 */
-  /* 01   */ V(11, 1, 1),
-  /* 10   */ V(11, 0, 2),
   /* 11   */ V(6, 9, 2),
 
-  /* 0001 0110 ... */
-  /* 00   */ V(9, 6, 2),	/* 312 */
-  /* 01   */ V(4, 10, 2),
-  /* 10   */ V(10, 4, 2),
-  /* 11   */ V(7, 8, 2),
+  /* 0000 0101 01 ... */
+  /* 00   */ V(10, 4, 1),	/* 1254 */
+  /* 01   */ V(10, 4, 1),
+  /* 10   */ V(7, 8, 2),
+  /* 11   */ V(8, 7, 2),
 
-  /* 0001 0111 ... */
-  /* 00   */ V(8, 7, 2),	/* 316 */
-  /* 01   */ V(3, 10, 2),
-  /* 10   */ V(10, 3, 1),
-  /* 11   */ V(10, 3, 1),
+  /* 0000 0101 10 ... */
+  /* 00   */ V(9, 4, 1),	/* 1258 */
+  /* 01   */ V(9, 4, 1),
+  /* 10   */ V(7, 7, 2),
+  /* 11   */ V(7, 6, 2),
 
-  /* 0001 1000 ... */
-  /* 0    */ V(5, 9, 1),	/* 320 */
-  /* 1    */ V(9, 5, 1),
+  /* 0000 0110 10 ... */
+  /* 0    */ V(0, 11, 1),	/* 1262 */
+  /* 1    */ V(11, 0, 1),
 
-  /* 0001 1001 ... */
-  /* 0    */ V(2, 10, 1),	/* 322 */
-  /* 1    */ V(10, 2, 1),
+  /* 0000 0110 11 ... */
+  /* 0    */ V(9, 6, 1),	/* 1264 */
+  /* 1    */ V(4, 10, 1),
 
-  /* 0001 1010 ... */
-  /* 0    */ V(1, 10, 1),	/* 324 */
-  /* 1    */ V(10, 1, 1),
+  /* 0000 0111 00 ... */
+  /* 0    */ V(3, 10, 1),	/* 1266 */
+  /* 1    */ V(10, 3, 1),
 
-  /* 0001 1011 ... */
-  /* 00   */ V(0, 10, 2),	/* 326 */
-  /* 01   */ V(10, 0, 2),
-  /* 10   */ V(6, 8, 1),
-  /* 11   */ V(6, 8, 1),
+  /* 0000 0111 01 ... */
+  /* 0    */ V(5, 9, 1),	/* 1268 */
+  /* 1    */ V(9, 5, 1),
 
-  /* 0001 1100 ... */
-  /* 0    */ V(8, 6, 1),	/* 330 */
+  /* 0000 1000 10 ... */
+  /* 0    */ V(0, 10, 1),	/* 1270 */
+  /* 1    */ V(6, 8, 1),
+
+  /* 0000 1001 00 ... */
+  /* 0    */ V(8, 6, 1),	/* 1272 */
   /* 1    */ V(4, 9, 1),
 
-  /* 0001 1101 ... */
-  /* 0    */ V(9, 4, 1),	/* 332 */
-  /* 1    */ V(3, 9, 1),
+  /* 0000 1001 10 ... */
+  /* 0    */ V(3, 9, 1),	/* 1274 */
+  /* 1    */ V(5, 8, 1),
 
-  /* 0001 1110 ... */
-  /* 00   */ V(9, 3, 1),	/* 334 */
-  /* 01   */ V(9, 3, 1),
-  /* 10   */ V(7, 7, 2),
-  /* 11   */ V(0, 9, 2),
+  /* 0000 1001 11 ... */
+  /* 0    */ V(8, 5, 1),	/* 1276 */
+  /* 1    */ V(6, 7, 1),
 
-  /* 0001 1111 ... */
-  /* 0    */ V(5, 8, 1),	/* 338 */
-  /* 1    */ V(8, 5, 1),
+  /* 0000 1010 10 ... */
+  /* 0    */ V(5, 7, 1),	/* 1278 */
+  /* 1    */ V(7, 5, 1),
 
-  /* 0010 0000 ... */
-  /* 0    */ V(2, 9, 1),	/* 340 */
-  /* 1    */ V(6, 7, 1),
+  /* 0000 1011 01 ... */
+  /* 0    */ V(6, 6, 1),	/* 1280 */
+  /* 1    */ V(4, 7, 1),
 
-  /* 0010 0001 ... */
-  /* 0    */ V(7, 6, 1),	/* 342 */
-  /* 1    */ V(9, 2, 1),
+  /* 0000 1011 10 ... */
+  /* 0    */ V(7, 4, 1),	/* 1282 */
+  /* 1    */ V(5, 6, 1),
 
-  /* 0010 0011 ... */
-  /* 0    */ V(1, 9, 1),	/* 344 */
-  /* 1    */ V(9, 0, 1),
+  /* 0000 1011 11 ... */
+  /* 0    */ V(6, 5, 1),	/* 1284 */
+  /* 1    */ V(7, 3, 1),
 
-  /* 0010 0100 ... */
-  /* 0    */ V(4, 8, 1),	/* 346 */
-  /* 1    */ V(8, 4, 1),
+  /* 0000 1110 01 ... */
+  /* 0    */ V(4, 6, 1),	/* 1286 */
+  /* 1    */ V(6, 4, 1)
+};
 
-  /* 0010 0101 ... */
-  /* 0    */ V(5, 7, 1),	/* 348 */
-  /* 1    */ V(7, 5, 1),
+static
+union huffpair const hufftab15[] = {
+  /* 0000000000 */ PTR(1024, 3),
+  /* 0000000001 */ PTR(1032, 3),
+  /* 0000000010 */ PTR(1040, 2),
+  /* 0000000011 */ PTR(1044, 2),
+  /* 0000000100 */ PTR(1048, 2),
+  /* 0000000101 */ PTR(1052, 2),
+  /* 0000000110 */ PTR(1056, 2),
+  /* 0000000111 */ PTR(1060, 3),
+  /* 0000001000 */ PTR(1068, 1),
+  /* 0000001001 */ PTR(1070, 2),
+  /* 0000001010 */ PTR(1074, 1),
+  /* 0000001011 */ PTR(1076, 1),
+  /* 0000001100 */ PTR(1078, 1),
+  /* 0000001101 */ PTR(1080, 2),
+  /* 0000001110 */ PTR(1084, 1),
+  /* 0000001111 */ PTR(1086, 1),
+  /* 0000010000 */ PTR(1088, 1),
+  /* 0000010001 */ PTR(1090, 2),
+  /* 0000010010 */ PTR(1094, 1),
+  /* 0000010011 */ PTR(1096, 1),
+  /* 0000010100 */ PTR(1098, 1),
+  /* 0000010101 */ PTR(1100, 1),
+  /* 0000010110 */ PTR(1102, 1),
+  /* 0000010111 */ PTR(1104, 1),
+  /* 0000011000 */ PTR(1106, 1),
+  /* 0000011001 */ PTR(1108, 1),
+  /* 0000011010 */ PTR(1110, 1),
+  /* 0000011011 */ PTR(1112, 1),
+  /* 0000011100 */ PTR(1114, 1),
+  /* 0000011101 */ PTR(1116, 1),
+  /* 0000011110 */ PTR(1118, 2),
+  /* 0000011111 */ PTR(1122, 1),
+  /* 0000100000 */ PTR(1124, 1),
+  /* 0000100001 */ PTR(1126, 1),
+  /* 0000100010 */ V(13, 4, 10),
+  /* 0000100011 */ PTR(1128, 1),
+  /* 0000100100 */ PTR(1130, 1),
+  /* 0000100101 */ PTR(1132, 1),
+  /* 0000100110 */ V(13, 3, 10),
+  /* 0000100111 */ V(13, 2, 10),
+  /* 0000101000 */ PTR(1134, 1),
+  /* 0000101001 */ V(1, 13, 10),
+  /* 0000101010 */ V(7, 11, 10),
+  /* 0000101011 */ V(11, 7, 10),
+  /* 0000101100 */ V(13, 1, 10),
+  /* 0000101101 */ PTR(1136, 1),
+  /* 0000101110 */ V(12, 5, 10),
+  /* 0000101111 */ V(8, 10, 10),
+  /* 0000110000 */ V(10, 8, 10),
+  /* 0000110001 */ V(4, 12, 10),
+  /* 0000110010 */ V(12, 4, 10),
+  /* 0000110011 */ V(6, 11, 10),
+  /* 0000110100 */ V(11, 6, 10),
+  /* 0000110101 */ PTR(1138, 1),
+  /* 0000110110 */ V(3, 12, 10),
+  /* 0000110111 */ V(12, 3, 10),
+  /* 0000111000 */ V(7, 10, 10),
+  /* 0000111001 */ V(10, 7, 10),
+  /* 0000111010 */ V(10, 6, 10),
+  /* 0000111011 */ PTR(1140, 1),
+  /* 0000111100 */ V(12, 2, 9),
+  /* 0000111101 */ V(12, 2, 9),
+  /* 0000111110 */ V(2, 12, 10),
+  /* 0000111111 */ V(5, 11, 10),
+  /* 0001000000 */ V(11, 5, 10),
+  /* 0001000001 */ V(1, 12, 10),
+  /* 0001000010 */ V(8, 9, 10),
+  /* 0001000011 */ V(9, 8, 10),
+  /* 0001000100 */ V(12, 1, 10),
+  /* 0001000101 */ V(4, 11, 10),
+  /* 0001000110 */ V(11, 4, 10),
+  /* 0001000111 */ V(6, 10, 10),
+  /* 0001001000 */ V(3, 11, 10),
+  /* 0001001001 */ V(7, 9, 10),
+  /* 0001001010 */ V(11, 3, 9),
+  /* 0001001011 */ V(11, 3, 9),
+  /* 0001001100 */ V(9, 7, 10),
+  /* 0001001101 */ V(8, 8, 10),
+  /* 0001001110 */ V(2, 11, 10),
+  /* 0001001111 */ V(5, 10, 10),
+  /* 0001010000 */ V(11, 2, 9),
+  /* 0001010001 */ V(11, 2, 9),
+  /* 0001010010 */ V(10, 5, 10),
+  /* 0001010011 */ V(1, 11, 10),
+  /* 0001010100 */ V(11, 1, 9),
+  /* 0001010101 */ V(11, 1, 9),
+  /* 0001010110 */ V(11, 0, 10),
+  /* 0001010111 */ V(6, 9, 10),
+  /* 0001011000 */ V(9, 6, 10),
+  /* 0001011001 */ V(4, 10, 10),
+  /* 0001011010 */ V(10, 4, 10),
+  /* 0001011011 */ V(7, 8, 10),
+  /* 0001011100 */ V(8, 7, 10),
+  /* 0001011101 */ V(3, 10, 10),
+  /* 0001011110 */ V(10, 3, 9),
+  /* 0001011111 */ V(10, 3, 9),
+  /* 0001100000 */ V(5, 9, 9),
+  /* 0001100001 */ V(5, 9, 9),
+  /* 0001100010 */ V(9, 5, 9),
+  /* 0001100011 */ V(9, 5, 9),
+  /* 0001100100 */ V(2, 10, 9),
+  /* 0001100101 */ V(2, 10, 9),
+  /* 0001100110 */ V(10, 2, 9),
+  /* 0001100111 */ V(10, 2, 9),
+  /* 0001101000 */ V(1, 10, 9),
+  /* 0001101001 */ V(1, 10, 9),
+  /* 0001101010 */ V(10, 1, 9),
+  /* 0001101011 */ V(10, 1, 9),
+  /* 0001101100 */ V(0, 10, 10),
+  /* 0001101101 */ V(10, 0, 10),
+  /* 0001101110 */ V(6, 8, 9),
+  /* 0001101111 */ V(6, 8, 9),
+  /* 0001110000 */ V(8, 6, 9),
+  /* 0001110001 */ V(8, 6, 9),
+  /* 0001110010 */ V(4, 9, 9),
+  /* 0001110011 */ V(4, 9, 9),
+  /* 0001110100 */ V(9, 4, 9),
+  /* 0001110101 */ V(9, 4, 9),
+  /* 0001110110 */ V(3, 9, 9),
+  /* 0001110111 */ V(3, 9, 9),
+  /* 0001111000 */ V(9, 3, 9),
+  /* 0001111001 */ V(9, 3, 9),
+  /* 0001111010 */ V(7, 7, 10),
+  /* 0001111011 */ V(0, 9, 10),
+  /* 0001111100 */ V(5, 8, 9),
+  /* 0001111101 */ V(5, 8, 9),
+  /* 0001111110 */ V(8, 5, 9),
+  /* 0001111111 */ V(8, 5, 9),
+  /* 0010000000 */ V(2, 9, 9),
+  /* 0010000001 */ V(2, 9, 9),
+  /* 0010000010 */ V(6, 7, 9),
+  /* 0010000011 */ V(6, 7, 9),
+  /* 0010000100 */ V(7, 6, 9),
+  /* 0010000101 */ V(7, 6, 9),
+  /* 0010000110 */ V(9, 2, 9),
+  /* 0010000111 */ V(9, 2, 9),
+  /* 0010001000 */ V(9, 1, 8),
+  /* 0010001001 */ V(9, 1, 8),
+  /* 0010001010 */ V(9, 1, 8),
+  /* 0010001011 */ V(9, 1, 8),
+  /* 0010001100 */ V(1, 9, 9),
+  /* 0010001101 */ V(1, 9, 9),
+  /* 0010001110 */ V(9, 0, 9),
+  /* 0010001111 */ V(9, 0, 9),
+  /* 0010010000 */ V(4, 8, 9),
+  /* 0010010001 */ V(4, 8, 9),
+  /* 0010010010 */ V(8, 4, 9),
+  /* 0010010011 */ V(8, 4, 9),
+  /* 0010010100 */ V(5, 7, 9),
+  /* 0010010101 */ V(5, 7, 9),
+  /* 0010010110 */ V(7, 5, 9),
+  /* 0010010111 */ V(7, 5, 9),
+  /* 0010011000 */ V(3, 8, 9),
+  /* 0010011001 */ V(3, 8, 9),
+  /* 0010011010 */ V(8, 3, 9),
+  /* 0010011011 */ V(8, 3, 9),
+  /* 0010011100 */ V(6, 6, 9),
+  /* 0010011101 */ V(6, 6, 9),
+  /* 0010011110 */ V(4, 7, 9),
+  /* 0010011111 */ V(4, 7, 9),
+  /* 0010100000 */ V(2, 8, 8),
+  /* 0010100001 */ V(2, 8, 8),
+  /* 0010100010 */ V(2, 8, 8),
+  /* 0010100011 */ V(2, 8, 8),
+  /* 0010100100 */ V(8, 2, 8),
+  /* 0010100101 */ V(8, 2, 8),
+  /* 0010100110 */ V(8, 2, 8),
+  /* 0010100111 */ V(8, 2, 8),
+  /* 0010101000 */ V(1, 8, 8),
+  /* 0010101001 */ V(1, 8, 8),
+  /* 0010101010 */ V(1, 8, 8),
+  /* 0010101011 */ V(1, 8, 8),
+  /* 0010101100 */ V(8, 1, 8),
+  /* 0010101101 */ V(8, 1, 8),
+  /* 0010101110 */ V(8, 1, 8),
+  /* 0010101111 */ V(8, 1, 8),
+  /* 0010110000 */ V(7, 4, 9),
+  /* 0010110001 */ V(7, 4, 9),
+  /* 0010110010 */ V(0, 8, 9),
+  /* 0010110011 */ V(0, 8, 9),
+  /* 0010110100 */ V(8, 0, 9),
+  /* 0010110101 */ V(8, 0, 9),
+  /* 0010110110 */ V(5, 6, 9),
+  /* 0010110111 */ V(5, 6, 9),
+  /* 0010111000 */ V(6, 5, 9),
+  /* 0010111001 */ V(6, 5, 9),
+  /* 0010111010 */ V(3, 7, 9),
+  /* 0010111011 */ V(3, 7, 9),
+  /* 0010111100 */ V(7, 3, 9),
+  /* 0010111101 */ V(7, 3, 9),
+  /* 0010111110 */ V(4, 6, 9),
+  /* 0010111111 */ V(4, 6, 9),
+  /* 0011000000 */ V(2, 7, 8),
+  /* 0011000001 */ V(2, 7, 8),
+  /* 0011000010 */ V(2, 7, 8),
+  /* 0011000011 */ V(2, 7, 8),
+  /* 0011000100 */ V(7, 2, 8),
+  /* 0011000101 */ V(7, 2, 8),
+  /* 0011000110 */ V(7, 2, 8),
+  /* 0011000111 */ V(7, 2, 8),
+  /* 0011001000 */ V(6, 4, 8),
+  /* 0011001001 */ V(6, 4, 8),
+  /* 0011001010 */ V(6, 4, 8),
+  /* 0011001011 */ V(6, 4, 8),
+  /* 0011001100 */ V(1, 7, 8),
+  /* 0011001101 */ V(1, 7, 8),
+  /* 0011001110 */ V(1, 7, 8),
+  /* 0011001111 */ V(1, 7, 8),
+  /* 0011010000 */ V(5, 5, 8),
+  /* 0011010001 */ V(5, 5, 8),
+  /* 0011010010 */ V(5, 5, 8),
+  /* 0011010011 */ V(5, 5, 8),
+  /* 0011010100 */ V(7, 1, 8),
+  /* 0011010101 */ V(7, 1, 8),
+  /* 0011010110 */ V(7, 1, 8),
+  /* 0011010111 */ V(7, 1, 8),
+  /* 0011011000 */ V(0, 7, 9),
+  /* 0011011001 */ V(0, 7, 9),
+  /* 0011011010 */ V(7, 0, 9),
+  /* 0011011011 */ V(7, 0, 9),
+  /* 0011011100 */ V(3, 6, 8),
+  /* 0011011101 */ V(3, 6, 8),
+  /* 0011011110 */ V(3, 6, 8),
+  /* 0011011111 */ V(3, 6, 8),
+  /* 0011100000 */ V(6, 3, 8),
+  /* 0011100001 */ V(6, 3, 8),
+  /* 0011100010 */ V(6, 3, 8),
+  /* 0011100011 */ V(6, 3, 8),
+  /* 0011100100 */ V(4, 5, 8),
+  /* 0011100101 */ V(4, 5, 8),
+  /* 0011100110 */ V(4, 5, 8),
+  /* 0011100111 */ V(4, 5, 8),
+  /* 0011101000 */ V(5, 4, 8),
+  /* 0011101001 */ V(5, 4, 8),
+  /* 0011101010 */ V(5, 4, 8),
+  /* 0011101011 */ V(5, 4, 8),
+  /* 0011101100 */ V(2, 6, 8),
+  /* 0011101101 */ V(2, 6, 8),
+  /* 0011101110 */ V(2, 6, 8),
+  /* 0011101111 */ V(2, 6, 8),
+  /* 0011110000 */ V(6, 2, 8),
+  /* 0011110001 */ V(6, 2, 8),
+  /* 0011110010 */ V(6, 2, 8),
+  /* 0011110011 */ V(6, 2, 8),
+  /* 0011110100 */ V(1, 6, 8),
+  /* 0011110101 */ V(1, 6, 8),
+  /* 0011110110 */ V(1, 6, 8),
+  /* 0011110111 */ V(1, 6, 8),
+  /* 0011111000 */ V(0, 6, 9),
+  /* 0011111001 */ V(0, 6, 9),
+  /* 0011111010 */ V(6, 0, 9),
+  /* 0011111011 */ V(6, 0, 9),
+  /* 0011111100 */ V(3, 5, 8),
+  /* 0011111101 */ V(3, 5, 8),
+  /* 0011111110 */ V(3, 5, 8),
+  /* 0011111111 */ V(3, 5, 8),
+  /* 0100000000 */ V(6, 1, 7),
+  /* 0100000001 */ V(6, 1, 7),
+  /* 0100000010 */ V(6, 1, 7),
+  /* 0100000011 */ V(6, 1, 7),
+  /* 0100000100 */ V(6, 1, 7),
+  /* 0100000101 */ V(6, 1, 7),
+  /* 0100000110 */ V(6, 1, 7),
+  /* 0100000111 */ V(6, 1, 7),
+  /* 0100001000 */ V(5, 3, 8),
+  /* 0100001001 */ V(5, 3, 8),
+  /* 0100001010 */ V(5, 3, 8),
+  /* 0100001011 */ V(5, 3, 8),
+  /* 0100001100 */ V(4, 4, 8),
+  /* 0100001101 */ V(4, 4, 8),
+  /* 0100001110 */ V(4, 4, 8),
+  /* 0100001111 */ V(4, 4, 8),
+  /* 0100010000 */ V(2, 5, 7),
+  /* 0100010001 */ V(2, 5, 7),
+  /* 0100010010 */ V(2, 5, 7),
+  /* 0100010011 */ V(2, 5, 7),
+  /* 0100010100 */ V(2, 5, 7),
+  /* 0100010101 */ V(2, 5, 7),
+  /* 0100010110 */ V(2, 5, 7),
+  /* 0100010111 */ V(2, 5, 7),
+  /* 0100011000 */ V(5, 2, 7),
+  /* 0100011001 */ V(5, 2, 7),
+  /* 0100011010 */ V(5, 2, 7),
+  /* 0100011011 */ V(5, 2, 7),
+  /* 0100011100 */ V(5, 2, 7),
+  /* 0100011101 */ V(5, 2, 7),
+  /* 0100011110 */ V(5, 2, 7),
+  /* 0100011111 */ V(5, 2, 7),
+  /* 0100100000 */ V(1, 5, 7),
+  /* 0100100001 */ V(1, 5, 7),
+  /* 0100100010 */ V(1, 5, 7),
+  /* 0100100011 */ V(1, 5, 7),
+  /* 0100100100 */ V(1, 5, 7),
+  /* 0100100101 */ V(1, 5, 7),
+  /* 0100100110 */ V(1, 5, 7),
+  /* 0100100111 */ V(1, 5, 7),
+  /* 0100101000 */ V(5, 1, 7),
+  /* 0100101001 */ V(5, 1, 7),
+  /* 0100101010 */ V(5, 1, 7),
+  /* 0100101011 */ V(5, 1, 7),
+  /* 0100101100 */ V(5, 1, 7),
+  /* 0100101101 */ V(5, 1, 7),
+  /* 0100101110 */ V(5, 1, 7),
+  /* 0100101111 */ V(5, 1, 7),
+  /* 0100110000 */ V(0, 5, 8),
+  /* 0100110001 */ V(0, 5, 8),
+  /* 0100110010 */ V(0, 5, 8),
+  /* 0100110011 */ V(0, 5, 8),
+  /* 0100110100 */ V(5, 0, 8),
+  /* 0100110101 */ V(5, 0, 8),
+  /* 0100110110 */ V(5, 0, 8),
+  /* 0100110111 */ V(5, 0, 8),
+  /* 0100111000 */ V(3, 4, 7),
+  /* 0100111001 */ V(3, 4, 7),
+  /* 0100111010 */ V(3, 4, 7),
+  /* 0100111011 */ V(3, 4, 7),
+  /* 0100111100 */ V(3, 4, 7),
+  /* 0100111101 */ V(3, 4, 7),
+  /* 0100111110 */ V(3, 4, 7),
+  /* 0100111111 */ V(3, 4, 7),
+  /* 0101000000 */ V(4, 3, 7),
+  /* 0101000001 */ V(4, 3, 7),
+  /* 0101000010 */ V(4, 3, 7),
+  /* 0101000011 */ V(4, 3, 7),
+  /* 0101000100 */ V(4, 3, 7),
+  /* 0101000101 */ V(4, 3, 7),
+  /* 0101000110 */ V(4, 3, 7),
+  /* 0101000111 */ V(4, 3, 7),
+  /* 0101001000 */ V(2, 4, 7),
+  /* 0101001001 */ V(2, 4, 7),
+  /* 0101001010 */ V(2, 4, 7),
+  /* 0101001011 */ V(2, 4, 7),
+  /* 0101001100 */ V(2, 4, 7),
+  /* 0101001101 */ V(2, 4, 7),
+  /* 0101001110 */ V(2, 4, 7),
+  /* 0101001111 */ V(2, 4, 7),
+  /* 0101010000 */ V(4, 2, 7),
+  /* 0101010001 */ V(4, 2, 7),
+  /* 0101010010 */ V(4, 2, 7),
+  /* 0101010011 */ V(4, 2, 7),
+  /* 0101010100 */ V(4, 2, 7),
+  /* 0101010101 */ V(4, 2, 7),
+  /* 0101010110 */ V(4, 2, 7),
+  /* 0101010111 */ V(4, 2, 7),
+  /* 0101011000 */ V(3, 3, 7),
+  /* 0101011001 */ V(3, 3, 7),
+  /* 0101011010 */ V(3, 3, 7),
+  /* 0101011011 */ V(3, 3, 7),
+  /* 0101011100 */ V(3, 3, 7),
+  /* 0101011101 */ V(3, 3, 7),
+  /* 0101011110 */ V(3, 3, 7),
+  /* 0101011111 */ V(3, 3, 7),
+  /* 0101100000 */ V(4, 1, 6),
+  /* 0101100001 */ V(4, 1, 6),
+  /* 0101100010 */ V(4, 1, 6),
+  /* 0101100011 */ V(4, 1, 6),
+  /* 0101100100 */ V(4, 1, 6),
+  /* 0101100101 */ V(4, 1, 6),
+  /* 0101100110 */ V(4, 1, 6),
+  /* 0101100111 */ V(4, 1, 6),
+  /* 0101101000 */ V(4, 1, 6),
+  /* 0101101001 */ V(4, 1, 6),
+  /* 0101101010 */ V(4, 1, 6),
+  /* 0101101011 */ V(4, 1, 6),
+  /* 0101101100 */ V(4, 1, 6),
+  /* 0101101101 */ V(4, 1, 6),
+  /* 0101101110 */ V(4, 1, 6),
+  /* 0101101111 */ V(4, 1, 6),
+  /* 0101110000 */ V(1, 4, 7),
+  /* 0101110001 */ V(1, 4, 7),
+  /* 0101110010 */ V(1, 4, 7),
+  /* 0101110011 */ V(1, 4, 7),
+  /* 0101110100 */ V(1, 4, 7),
+  /* 0101110101 */ V(1, 4, 7),
+  /* 0101110110 */ V(1, 4, 7),
+  /* 0101110111 */ V(1, 4, 7),
+  /* 0101111000 */ V(0, 4, 7),
+  /* 0101111001 */ V(0, 4, 7),
+  /* 0101111010 */ V(0, 4, 7),
+  /* 0101111011 */ V(0, 4, 7),
+  /* 0101111100 */ V(0, 4, 7),
+  /* 0101111101 */ V(0, 4, 7),
+  /* 0101111110 */ V(0, 4, 7),
+  /* 0101111111 */ V(0, 4, 7),
+  /* 0110000000 */ V(2, 3, 6),
+  /* 0110000001 */ V(2, 3, 6),
+  /* 0110000010 */ V(2, 3, 6),
+  /* 0110000011 */ V(2, 3, 6),
+  /* 0110000100 */ V(2, 3, 6),
+  /* 0110000101 */ V(2, 3, 6),
+  /* 0110000110 */ V(2, 3, 6),
+  /* 0110000111 */ V(2, 3, 6),
+  /* 0110001000 */ V(2, 3, 6),
+  /* 0110001001 */ V(2, 3, 6),
+  /* 0110001010 */ V(2, 3, 6),
+  /* 0110001011 */ V(2, 3, 6),
+  /* 0110001100 */ V(2, 3, 6),
+  /* 0110001101 */ V(2, 3, 6),
+  /* 0110001110 */ V(2, 3, 6),
+  /* 0110001111 */ V(2, 3, 6),
+  /* 0110010000 */ V(3, 2, 6),
+  /* 0110010001 */ V(3, 2, 6),
+  /* 0110010010 */ V(3, 2, 6),
+  /* 0110010011 */ V(3, 2, 6),
+  /* 0110010100 */ V(3, 2, 6),
+  /* 0110010101 */ V(3, 2, 6),
+  /* 0110010110 */ V(3, 2, 6),
+  /* 0110010111 */ V(3, 2, 6),
+  /* 0110011000 */ V(3, 2, 6),
+  /* 0110011001 */ V(3, 2, 6),
+  /* 0110011010 */ V(3, 2, 6),
+  /* 0110011011 */ V(3, 2, 6),
+  /* 0110011100 */ V(3, 2, 6),
+  /* 0110011101 */ V(3, 2, 6),
+  /* 0110011110 */ V(3, 2, 6),
+  /* 0110011111 */ V(3, 2, 6),
+  /* 0110100000 */ V(4, 0, 7),
+  /* 0110100001 */ V(4, 0, 7),
+  /* 0110100010 */ V(4, 0, 7),
+  /* 0110100011 */ V(4, 0, 7),
+  /* 0110100100 */ V(4, 0, 7),
+  /* 0110100101 */ V(4, 0, 7),
+  /* 0110100110 */ V(4, 0, 7),
+  /* 0110100111 */ V(4, 0, 7),
+  /* 0110101000 */ V(0, 3, 7),
+  /* 0110101001 */ V(0, 3, 7),
+  /* 0110101010 */ V(0, 3, 7),
+  /* 0110101011 */ V(0, 3, 7),
+  /* 0110101100 */ V(0, 3, 7),
+  /* 0110101101 */ V(0, 3, 7),
+  /* 0110101110 */ V(0, 3, 7),
+  /* 0110101111 */ V(0, 3, 7),
+  /* 0110110000 */ V(1, 3, 6),
+  /* 0110110001 */ V(1, 3, 6),
+  /* 0110110010 */ V(1, 3, 6),
+  /* 0110110011 */ V(1, 3, 6),
+  /* 0110110100 */ V(1, 3, 6),
+  /* 0110110101 */ V(1, 3, 6),
+  /* 0110110110 */ V(1, 3, 6),
+  /* 0110110111 */ V(1, 3, 6),
+  /* 0110111000 */ V(1, 3, 6),
+  /* 0110111001 */ V(1, 3, 6),
+  /* 0110111010 */ V(1, 3, 6),
+  /* 0110111011 */ V(1, 3, 6),
+  /* 0110111100 */ V(1, 3, 6),
+  /* 0110111101 */ V(1, 3, 6),
+  /* 0110111110 */ V(1, 3, 6),
+  /* 0110111111 */ V(1, 3, 6),
+  /* 0111000000 */ V(3, 1, 6),
+  /* 0111000001 */ V(3, 1, 6),
+  /* 0111000010 */ V(3, 1, 6),
+  /* 0111000011 */ V(3, 1, 6),
+  /* 0111000100 */ V(3, 1, 6),
+  /* 0111000101 */ V(3, 1, 6),
+  /* 0111000110 */ V(3, 1, 6),
+  /* 0111000111 */ V(3, 1, 6),
+  /* 0111001000 */ V(3, 1, 6),
+  /* 0111001001 */ V(3, 1, 6),
+  /* 0111001010 */ V(3, 1, 6),
+  /* 0111001011 */ V(3, 1, 6),
+  /* 0111001100 */ V(3, 1, 6),
+  /* 0111001101 */ V(3, 1, 6),
+  /* 0111001110 */ V(3, 1, 6),
+  /* 0111001111 */ V(3, 1, 6),
+  /* 0111010000 */ V(3, 0, 6),
+  /* 0111010001 */ V(3, 0, 6),
+  /* 0111010010 */ V(3, 0, 6),
+  /* 0111010011 */ V(3, 0, 6),
+  /* 0111010100 */ V(3, 0, 6),
+  /* 0111010101 */ V(3, 0, 6),
+  /* 0111010110 */ V(3, 0, 6),
+  /* 0111010111 */ V(3, 0, 6),
+  /* 0111011000 */ V(3, 0, 6),
+  /* 0111011001 */ V(3, 0, 6),
+  /* 0111011010 */ V(3, 0, 6),
+  /* 0111011011 */ V(3, 0, 6),
+  /* 0111011100 */ V(3, 0, 6),
+  /* 0111011101 */ V(3, 0, 6),
+  /* 0111011110 */ V(3, 0, 6),
+  /* 0111011111 */ V(3, 0, 6),
+  /* 0111100000 */ V(2, 2, 5),
+  /* 0111100001 */ V(2, 2, 5),
+  /* 0111100010 */ V(2, 2, 5),
+  /* 0111100011 */ V(2, 2, 5),
+  /* 0111100100 */ V(2, 2, 5),
+  /* 0111100101 */ V(2, 2, 5),
+  /* 0111100110 */ V(2, 2, 5),
+  /* 0111100111 */ V(2, 2, 5),
+  /* 0111101000 */ V(2, 2, 5),
+  /* 0111101001 */ V(2, 2, 5),
+  /* 0111101010 */ V(2, 2, 5),
+  /* 0111101011 */ V(2, 2, 5),
+  /* 0111101100 */ V(2, 2, 5),
+  /* 0111101101 */ V(2, 2, 5),
+  /* 0111101110 */ V(2, 2, 5),
+  /* 0111101111 */ V(2, 2, 5),
+  /* 0111110000 */ V(2, 2, 5),
+  /* 0111110001 */ V(2, 2, 5),
+  /* 0111110010 */ V(2, 2, 5),
+  /* 0111110011 */ V(2, 2, 5),
+  /* 0111110100 */ V(2, 2, 5),
+  /* 0111110101 */ V(2, 2, 5),
+  /* 0111110110 */ V(2, 2, 5),
+  /* 0111110111 */ V(2, 2, 5),
+  /* 0111111000 */ V(2, 2, 5),
+  /* 0111111001 */ V(2, 2, 5),
+  /* 0111111010 */ V(2, 2, 5),
+  /* 0111111011 */ V(2, 2, 5),
+  /* 0111111100 */ V(2, 2, 5),
+  /* 0111111101 */ V(2, 2, 5),
+  /* 0111111110 */ V(2, 2, 5),
+  /* 0111111111 */ V(2, 2, 5),
+  /* 1000000000 */ V(1, 2, 5),
+  /* 1000000001 */ V(1, 2, 5),
+  /* 1000000010 */ V(1, 2, 5),
+  /* 1000000011 */ V(1, 2, 5),
+  /* 1000000100 */ V(1, 2, 5),
+  /* 1000000101 */ V(1, 2, 5),
+  /* 1000000110 */ V(1, 2, 5),
+  /* 1000000111 */ V(1, 2, 5),
+  /* 1000001000 */ V(1, 2, 5),
+  /* 1000001001 */ V(1, 2, 5),
+  /* 1000001010 */ V(1, 2, 5),
+  /* 1000001011 */ V(1, 2, 5),
+  /* 1000001100 */ V(1, 2, 5),
+  /* 1000001101 */ V(1, 2, 5),
+  /* 1000001110 */ V(1, 2, 5),
+  /* 1000001111 */ V(1, 2, 5),
+  /* 1000010000 */ V(1, 2, 5),
+  /* 1000010001 */ V(1, 2, 5),
+  /* 1000010010 */ V(1, 2, 5),
+  /* 1000010011 */ V(1, 2, 5),
+  /* 1000010100 */ V(1, 2, 5),
+  /* 1000010101 */ V(1, 2, 5),
+  /* 1000010110 */ V(1, 2, 5),
+  /* 1000010111 */ V(1, 2, 5),
+  /* 1000011000 */ V(1, 2, 5),
+  /* 1000011001 */ V(1, 2, 5),
+  /* 1000011010 */ V(1, 2, 5),
+  /* 1000011011 */ V(1, 2, 5),
+  /* 1000011100 */ V(1, 2, 5),
+  /* 1000011101 */ V(1, 2, 5),
+  /* 1000011110 */ V(1, 2, 5),
+  /* 1000011111 */ V(1, 2, 5),
+  /* 1000100000 */ V(2, 1, 5),
+  /* 1000100001 */ V(2, 1, 5),
+  /* 1000100010 */ V(2, 1, 5),
+  /* 1000100011 */ V(2, 1, 5),
+  /* 1000100100 */ V(2, 1, 5),
+  /* 1000100101 */ V(2, 1, 5),
+  /* 1000100110 */ V(2, 1, 5),
+  /* 1000100111 */ V(2, 1, 5),
+  /* 1000101000 */ V(2, 1, 5),
+  /* 1000101001 */ V(2, 1, 5),
+  /* 1000101010 */ V(2, 1, 5),
+  /* 1000101011 */ V(2, 1, 5),
+  /* 1000101100 */ V(2, 1, 5),
+  /* 1000101101 */ V(2, 1, 5),
+  /* 1000101110 */ V(2, 1, 5),
+  /* 1000101111 */ V(2, 1, 5),
+  /* 1000110000 */ V(2, 1, 5),
+  /* 1000110001 */ V(2, 1, 5),
+  /* 1000110010 */ V(2, 1, 5),
+  /* 1000110011 */ V(2, 1, 5),
+  /* 1000110100 */ V(2, 1, 5),
+  /* 1000110101 */ V(2, 1, 5),
+  /* 1000110110 */ V(2, 1, 5),
+  /* 1000110111 */ V(2, 1, 5),
+  /* 1000111000 */ V(2, 1, 5),
+  /* 1000111001 */ V(2, 1, 5),
+  /* 1000111010 */ V(2, 1, 5),
+  /* 1000111011 */ V(2, 1, 5),
+  /* 1000111100 */ V(2, 1, 5),
+  /* 1000111101 */ V(2, 1, 5),
+  /* 1000111110 */ V(2, 1, 5),
+  /* 1000111111 */ V(2, 1, 5),
+  /* 1001000000 */ V(0, 2, 5),
+  /* 1001000001 */ V(0, 2, 5),
+  /* 1001000010 */ V(0, 2, 5),
+  /* 1001000011 */ V(0, 2, 5),
+  /* 1001000100 */ V(0, 2, 5),
+  /* 1001000101 */ V(0, 2, 5),
+  /* 1001000110 */ V(0, 2, 5),
+  /* 1001000111 */ V(0, 2, 5),
+  /* 1001001000 */ V(0, 2, 5),
+  /* 1001001001 */ V(0, 2, 5),
+  /* 1001001010 */ V(0, 2, 5),
+  /* 1001001011 */ V(0, 2, 5),
+  /* 1001001100 */ V(0, 2, 5),
+  /* 1001001101 */ V(0, 2, 5),
+  /* 1001001110 */ V(0, 2, 5),
+  /* 1001001111 */ V(0, 2, 5),
+  /* 1001010000 */ V(0, 2, 5),
+  /* 1001010001 */ V(0, 2, 5),
+  /* 1001010010 */ V(0, 2, 5),
+  /* 1001010011 */ V(0, 2, 5),
+  /* 1001010100 */ V(0, 2, 5),
+  /* 1001010101 */ V(0, 2, 5),
+  /* 1001010110 */ V(0, 2, 5),
+  /* 1001010111 */ V(0, 2, 5),
+  /* 1001011000 */ V(0, 2, 5),
+  /* 1001011001 */ V(0, 2, 5),
+  /* 1001011010 */ V(0, 2, 5),
+  /* 1001011011 */ V(0, 2, 5),
+  /* 1001011100 */ V(0, 2, 5),
+  /* 1001011101 */ V(0, 2, 5),
+  /* 1001011110 */ V(0, 2, 5),
+  /* 1001011111 */ V(0, 2, 5),
+  /* 1001100000 */ V(2, 0, 5),
+  /* 1001100001 */ V(2, 0, 5),
+  /* 1001100010 */ V(2, 0, 5),
+  /* 1001100011 */ V(2, 0, 5),
+  /* 1001100100 */ V(2, 0, 5),
+  /* 1001100101 */ V(2, 0, 5),
+  /* 1001100110 */ V(2, 0, 5),
+  /* 1001100111 */ V(2, 0, 5),
+  /* 1001101000 */ V(2, 0, 5),
+  /* 1001101001 */ V(2, 0, 5),
+  /* 1001101010 */ V(2, 0, 5),
+  /* 1001101011 */ V(2, 0, 5),
+  /* 1001101100 */ V(2, 0, 5),
+  /* 1001101101 */ V(2, 0, 5),
+  /* 1001101110 */ V(2, 0, 5),
+  /* 1001101111 */ V(2, 0, 5),
+  /* 1001110000 */ V(2, 0, 5),
+  /* 1001110001 */ V(2, 0, 5),
+  /* 1001110010 */ V(2, 0, 5),
+  /* 1001110011 */ V(2, 0, 5),
+  /* 1001110100 */ V(2, 0, 5),
+  /* 1001110101 */ V(2, 0, 5),
+  /* 1001110110 */ V(2, 0, 5),
+  /* 1001110111 */ V(2, 0, 5),
+  /* 1001111000 */ V(2, 0, 5),
+  /* 1001111001 */ V(2, 0, 5),
+  /* 1001111010 */ V(2, 0, 5),
+  /* 1001111011 */ V(2, 0, 5),
+  /* 1001111100 */ V(2, 0, 5),
+  /* 1001111101 */ V(2, 0, 5),
+  /* 1001111110 */ V(2, 0, 5),
+  /* 1001111111 */ V(2, 0, 5),
+  /* 1010000000 */ V(1, 1, 3),
+  /* 1010000001 */ V(1, 1, 3),
+  /* 1010000010 */ V(1, 1, 3),
+  /* 1010000011 */ V(1, 1, 3),
+  /* 1010000100 */ V(1, 1, 3),
+  /* 1010000101 */ V(1, 1, 3),
+  /* 1010000110 */ V(1, 1, 3),
+  /* 1010000111 */ V(1, 1, 3),
+  /* 1010001000 */ V(1, 1, 3),
+  /* 1010001001 */ V(1, 1, 3),
+  /* 1010001010 */ V(1, 1, 3),
+  /* 1010001011 */ V(1, 1, 3),
+  /* 1010001100 */ V(1, 1, 3),
+  /* 1010001101 */ V(1, 1, 3),
+  /* 1010001110 */ V(1, 1, 3),
+  /* 1010001111 */ V(1, 1, 3),
+  /* 1010010000 */ V(1, 1, 3),
+  /* 1010010001 */ V(1, 1, 3),
+  /* 1010010010 */ V(1, 1, 3),
+  /* 1010010011 */ V(1, 1, 3),
+  /* 1010010100 */ V(1, 1, 3),
+  /* 1010010101 */ V(1, 1, 3),
+  /* 1010010110 */ V(1, 1, 3),
+  /* 1010010111 */ V(1, 1, 3),
+  /* 1010011000 */ V(1, 1, 3),
+  /* 1010011001 */ V(1, 1, 3),
+  /* 1010011010 */ V(1, 1, 3),
+  /* 1010011011 */ V(1, 1, 3),
+  /* 1010011100 */ V(1, 1, 3),
+  /* 1010011101 */ V(1, 1, 3),
+  /* 1010011110 */ V(1, 1, 3),
+  /* 1010011111 */ V(1, 1, 3),
+  /* 1010100000 */ V(1, 1, 3),
+  /* 1010100001 */ V(1, 1, 3),
+  /* 1010100010 */ V(1, 1, 3),
+  /* 1010100011 */ V(1, 1, 3),
+  /* 1010100100 */ V(1, 1, 3),
+  /* 1010100101 */ V(1, 1, 3),
+  /* 1010100110 */ V(1, 1, 3),
+  /* 1010100111 */ V(1, 1, 3),
+  /* 1010101000 */ V(1, 1, 3),
+  /* 1010101001 */ V(1, 1, 3),
+  /* 1010101010 */ V(1, 1, 3),
+  /* 1010101011 */ V(1, 1, 3),
+  /* 1010101100 */ V(1, 1, 3),
+  /* 1010101101 */ V(1, 1, 3),
+  /* 1010101110 */ V(1, 1, 3),
+  /* 1010101111 */ V(1, 1, 3),
+  /* 1010110000 */ V(1, 1, 3),
+  /* 1010110001 */ V(1, 1, 3),
+  /* 1010110010 */ V(1, 1, 3),
+  /* 1010110011 */ V(1, 1, 3),
+  /* 1010110100 */ V(1, 1, 3),
+  /* 1010110101 */ V(1, 1, 3),
+  /* 1010110110 */ V(1, 1, 3),
+  /* 1010110111 */ V(1, 1, 3),
+  /* 1010111000 */ V(1, 1, 3),
+  /* 1010111001 */ V(1, 1, 3),
+  /* 1010111010 */ V(1, 1, 3),
+  /* 1010111011 */ V(1, 1, 3),
+  /* 1010111100 */ V(1, 1, 3),
+  /* 1010111101 */ V(1, 1, 3),
+  /* 1010111110 */ V(1, 1, 3),
+  /* 1010111111 */ V(1, 1, 3),
+  /* 1011000000 */ V(1, 1, 3),
+  /* 1011000001 */ V(1, 1, 3),
+  /* 1011000010 */ V(1, 1, 3),
+  /* 1011000011 */ V(1, 1, 3),
+  /* 1011000100 */ V(1, 1, 3),
+  /* 1011000101 */ V(1, 1, 3),
+  /* 1011000110 */ V(1, 1, 3),
+  /* 1011000111 */ V(1, 1, 3),
+  /* 1011001000 */ V(1, 1, 3),
+  /* 1011001001 */ V(1, 1, 3),
+  /* 1011001010 */ V(1, 1, 3),
+  /* 1011001011 */ V(1, 1, 3),
+  /* 1011001100 */ V(1, 1, 3),
+  /* 1011001101 */ V(1, 1, 3),
+  /* 1011001110 */ V(1, 1, 3),
+  /* 1011001111 */ V(1, 1, 3),
+  /* 1011010000 */ V(1, 1, 3),
+  /* 1011010001 */ V(1, 1, 3),
+  /* 1011010010 */ V(1, 1, 3),
+  /* 1011010011 */ V(1, 1, 3),
+  /* 1011010100 */ V(1, 1, 3),
+  /* 1011010101 */ V(1, 1, 3),
+  /* 1011010110 */ V(1, 1, 3),
+  /* 1011010111 */ V(1, 1, 3),
+  /* 1011011000 */ V(1, 1, 3),
+  /* 1011011001 */ V(1, 1, 3),
+  /* 1011011010 */ V(1, 1, 3),
+  /* 1011011011 */ V(1, 1, 3),
+  /* 1011011100 */ V(1, 1, 3),
+  /* 1011011101 */ V(1, 1, 3),
+  /* 1011011110 */ V(1, 1, 3),
+  /* 1011011111 */ V(1, 1, 3),
+  /* 1011100000 */ V(1, 1, 3),
+  /* 1011100001 */ V(1, 1, 3),
+  /* 1011100010 */ V(1, 1, 3),
+  /* 1011100011 */ V(1, 1, 3),
+  /* 1011100100 */ V(1, 1, 3),
+  /* 1011100101 */ V(1, 1, 3),
+  /* 1011100110 */ V(1, 1, 3),
+  /* 1011100111 */ V(1, 1, 3),
+  /* 1011101000 */ V(1, 1, 3),
+  /* 1011101001 */ V(1, 1, 3),
+  /* 1011101010 */ V(1, 1, 3),
+  /* 1011101011 */ V(1, 1, 3),
+  /* 1011101100 */ V(1, 1, 3),
+  /* 1011101101 */ V(1, 1, 3),
+  /* 1011101110 */ V(1, 1, 3),
+  /* 1011101111 */ V(1, 1, 3),
+  /* 1011110000 */ V(1, 1, 3),
+  /* 1011110001 */ V(1, 1, 3),
+  /* 1011110010 */ V(1, 1, 3),
+  /* 1011110011 */ V(1, 1, 3),
+  /* 1011110100 */ V(1, 1, 3),
+  /* 1011110101 */ V(1, 1, 3),
+  /* 1011110110 */ V(1, 1, 3),
+  /* 1011110111 */ V(1, 1, 3),
+  /* 1011111000 */ V(1, 1, 3),
+  /* 1011111001 */ V(1, 1, 3),
+  /* 1011111010 */ V(1, 1, 3),
+  /* 1011111011 */ V(1, 1, 3),
+  /* 1011111100 */ V(1, 1, 3),
+  /* 1011111101 */ V(1, 1, 3),
+  /* 1011111110 */ V(1, 1, 3),
+  /* 1011111111 */ V(1, 1, 3),
+  /* 1100000000 */ V(0, 1, 4),
+  /* 1100000001 */ V(0, 1, 4),
+  /* 1100000010 */ V(0, 1, 4),
+  /* 1100000011 */ V(0, 1, 4),
+  /* 1100000100 */ V(0, 1, 4),
+  /* 1100000101 */ V(0, 1, 4),
+  /* 1100000110 */ V(0, 1, 4),
+  /* 1100000111 */ V(0, 1, 4),
+  /* 1100001000 */ V(0, 1, 4),
+  /* 1100001001 */ V(0, 1, 4),
+  /* 1100001010 */ V(0, 1, 4),
+  /* 1100001011 */ V(0, 1, 4),
+  /* 1100001100 */ V(0, 1, 4),
+  /* 1100001101 */ V(0, 1, 4),
+  /* 1100001110 */ V(0, 1, 4),
+  /* 1100001111 */ V(0, 1, 4),
+  /* 1100010000 */ V(0, 1, 4),
+  /* 1100010001 */ V(0, 1, 4),
+  /* 1100010010 */ V(0, 1, 4),
+  /* 1100010011 */ V(0, 1, 4),
+  /* 1100010100 */ V(0, 1, 4),
+  /* 1100010101 */ V(0, 1, 4),
+  /* 1100010110 */ V(0, 1, 4),
+  /* 1100010111 */ V(0, 1, 4),
+  /* 1100011000 */ V(0, 1, 4),
+  /* 1100011001 */ V(0, 1, 4),
+  /* 1100011010 */ V(0, 1, 4),
+  /* 1100011011 */ V(0, 1, 4),
+  /* 1100011100 */ V(0, 1, 4),
+  /* 1100011101 */ V(0, 1, 4),
+  /* 1100011110 */ V(0, 1, 4),
+  /* 1100011111 */ V(0, 1, 4),
+  /* 1100100000 */ V(0, 1, 4),
+  /* 1100100001 */ V(0, 1, 4),
+  /* 1100100010 */ V(0, 1, 4),
+  /* 1100100011 */ V(0, 1, 4),
+  /* 1100100100 */ V(0, 1, 4),
+  /* 1100100101 */ V(0, 1, 4),
+  /* 1100100110 */ V(0, 1, 4),
+  /* 1100100111 */ V(0, 1, 4),
+  /* 1100101000 */ V(0, 1, 4),
+  /* 1100101001 */ V(0, 1, 4),
+  /* 1100101010 */ V(0, 1, 4),
+  /* 1100101011 */ V(0, 1, 4),
+  /* 1100101100 */ V(0, 1, 4),
+  /* 1100101101 */ V(0, 1, 4),
+  /* 1100101110 */ V(0, 1, 4),
+  /* 1100101111 */ V(0, 1, 4),
+  /* 1100110000 */ V(0, 1, 4),
+  /* 1100110001 */ V(0, 1, 4),
+  /* 1100110010 */ V(0, 1, 4),
+  /* 1100110011 */ V(0, 1, 4),
+  /* 1100110100 */ V(0, 1, 4),
+  /* 1100110101 */ V(0, 1, 4),
+  /* 1100110110 */ V(0, 1, 4),
+  /* 1100110111 */ V(0, 1, 4),
+  /* 1100111000 */ V(0, 1, 4),
+  /* 1100111001 */ V(0, 1, 4),
+  /* 1100111010 */ V(0, 1, 4),
+  /* 1100111011 */ V(0, 1, 4),
+  /* 1100111100 */ V(0, 1, 4),
+  /* 1100111101 */ V(0, 1, 4),
+  /* 1100111110 */ V(0, 1, 4),
+  /* 1100111111 */ V(0, 1, 4),
+  /* 1101000000 */ V(1, 0, 4),
+  /* 1101000001 */ V(1, 0, 4),
+  /* 1101000010 */ V(1, 0, 4),
+  /* 1101000011 */ V(1, 0, 4),
+  /* 1101000100 */ V(1, 0, 4),
+  /* 1101000101 */ V(1, 0, 4),
+  /* 1101000110 */ V(1, 0, 4),
+  /* 1101000111 */ V(1, 0, 4),
+  /* 1101001000 */ V(1, 0, 4),
+  /* 1101001001 */ V(1, 0, 4),
+  /* 1101001010 */ V(1, 0, 4),
+  /* 1101001011 */ V(1, 0, 4),
+  /* 1101001100 */ V(1, 0, 4),
+  /* 1101001101 */ V(1, 0, 4),
+  /* 1101001110 */ V(1, 0, 4),
+  /* 1101001111 */ V(1, 0, 4),
+  /* 1101010000 */ V(1, 0, 4),
+  /* 1101010001 */ V(1, 0, 4),
+  /* 1101010010 */ V(1, 0, 4),
+  /* 1101010011 */ V(1, 0, 4),
+  /* 1101010100 */ V(1, 0, 4),
+  /* 1101010101 */ V(1, 0, 4),
+  /* 1101010110 */ V(1, 0, 4),
+  /* 1101010111 */ V(1, 0, 4),
+  /* 1101011000 */ V(1, 0, 4),
+  /* 1101011001 */ V(1, 0, 4),
+  /* 1101011010 */ V(1, 0, 4),
+  /* 1101011011 */ V(1, 0, 4),
+  /* 1101011100 */ V(1, 0, 4),
+  /* 1101011101 */ V(1, 0, 4),
+  /* 1101011110 */ V(1, 0, 4),
+  /* 1101011111 */ V(1, 0, 4),
+  /* 1101100000 */ V(1, 0, 4),
+  /* 1101100001 */ V(1, 0, 4),
+  /* 1101100010 */ V(1, 0, 4),
+  /* 1101100011 */ V(1, 0, 4),
+  /* 1101100100 */ V(1, 0, 4),
+  /* 1101100101 */ V(1, 0, 4),
+  /* 1101100110 */ V(1, 0, 4),
+  /* 1101100111 */ V(1, 0, 4),
+  /* 1101101000 */ V(1, 0, 4),
+  /* 1101101001 */ V(1, 0, 4),
+  /* 1101101010 */ V(1, 0, 4),
+  /* 1101101011 */ V(1, 0, 4),
+  /* 1101101100 */ V(1, 0, 4),
+  /* 1101101101 */ V(1, 0, 4),
+  /* 1101101110 */ V(1, 0, 4),
+  /* 1101101111 */ V(1, 0, 4),
+  /* 1101110000 */ V(1, 0, 4),
+  /* 1101110001 */ V(1, 0, 4),
+  /* 1101110010 */ V(1, 0, 4),
+  /* 1101110011 */ V(1, 0, 4),
+  /* 1101110100 */ V(1, 0, 4),
+  /* 1101110101 */ V(1, 0, 4),
+  /* 1101110110 */ V(1, 0, 4),
+  /* 1101110111 */ V(1, 0, 4),
+  /* 1101111000 */ V(1, 0, 4),
+  /* 1101111001 */ V(1, 0, 4),
+  /* 1101111010 */ V(1, 0, 4),
+  /* 1101111011 */ V(1, 0, 4),
+  /* 1101111100 */ V(1, 0, 4),
+  /* 1101111101 */ V(1, 0, 4),
+  /* 1101111110 */ V(1, 0, 4),
+  /* 1101111111 */ V(1, 0, 4),
+  /* 1110000000 */ V(0, 0, 3),
+  /* 1110000001 */ V(0, 0, 3),
+  /* 1110000010 */ V(0, 0, 3),
+  /* 1110000011 */ V(0, 0, 3),
+  /* 1110000100 */ V(0, 0, 3),
+  /* 1110000101 */ V(0, 0, 3),
+  /* 1110000110 */ V(0, 0, 3),
+  /* 1110000111 */ V(0, 0, 3),
+  /* 1110001000 */ V(0, 0, 3),
+  /* 1110001001 */ V(0, 0, 3),
+  /* 1110001010 */ V(0, 0, 3),
+  /* 1110001011 */ V(0, 0, 3),
+  /* 1110001100 */ V(0, 0, 3),
+  /* 1110001101 */ V(0, 0, 3),
+  /* 1110001110 */ V(0, 0, 3),
+  /* 1110001111 */ V(0, 0, 3),
+  /* 1110010000 */ V(0, 0, 3),
+  /* 1110010001 */ V(0, 0, 3),
+  /* 1110010010 */ V(0, 0, 3),
+  /* 1110010011 */ V(0, 0, 3),
+  /* 1110010100 */ V(0, 0, 3),
+  /* 1110010101 */ V(0, 0, 3),
+  /* 1110010110 */ V(0, 0, 3),
+  /* 1110010111 */ V(0, 0, 3),
+  /* 1110011000 */ V(0, 0, 3),
+  /* 1110011001 */ V(0, 0, 3),
+  /* 1110011010 */ V(0, 0, 3),
+  /* 1110011011 */ V(0, 0, 3),
+  /* 1110011100 */ V(0, 0, 3),
+  /* 1110011101 */ V(0, 0, 3),
+  /* 1110011110 */ V(0, 0, 3),
+  /* 1110011111 */ V(0, 0, 3),
+  /* 1110100000 */ V(0, 0, 3),
+  /* 1110100001 */ V(0, 0, 3),
+  /* 1110100010 */ V(0, 0, 3),
+  /* 1110100011 */ V(0, 0, 3),
+  /* 1110100100 */ V(0, 0, 3),
+  /* 1110100101 */ V(0, 0, 3),
+  /* 1110100110 */ V(0, 0, 3),
+  /* 1110100111 */ V(0, 0, 3),
+  /* 1110101000 */ V(0, 0, 3),
+  /* 1110101001 */ V(0, 0, 3),
+  /* 1110101010 */ V(0, 0, 3),
+  /* 1110101011 */ V(0, 0, 3),
+  /* 1110101100 */ V(0, 0, 3),
+  /* 1110101101 */ V(0, 0, 3),
+  /* 1110101110 */ V(0, 0, 3),
+  /* 1110101111 */ V(0, 0, 3),
+  /* 1110110000 */ V(0, 0, 3),
+  /* 1110110001 */ V(0, 0, 3),
+  /* 1110110010 */ V(0, 0, 3),
+  /* 1110110011 */ V(0, 0, 3),
+  /* 1110110100 */ V(0, 0, 3),
+  /* 1110110101 */ V(0, 0, 3),
+  /* 1110110110 */ V(0, 0, 3),
+  /* 1110110111 */ V(0, 0, 3),
+  /* 1110111000 */ V(0, 0, 3),
+  /* 1110111001 */ V(0, 0, 3),
+  /* 1110111010 */ V(0, 0, 3),
+  /* 1110111011 */ V(0, 0, 3),
+  /* 1110111100 */ V(0, 0, 3),
+  /* 1110111101 */ V(0, 0, 3),
+  /* 1110111110 */ V(0, 0, 3),
+  /* 1110111111 */ V(0, 0, 3),
+  /* 1111000000 */ V(0, 0, 3),
+  /* 1111000001 */ V(0, 0, 3),
+  /* 1111000010 */ V(0, 0, 3),
+  /* 1111000011 */ V(0, 0, 3),
+  /* 1111000100 */ V(0, 0, 3),
+  /* 1111000101 */ V(0, 0, 3),
+  /* 1111000110 */ V(0, 0, 3),
+  /* 1111000111 */ V(0, 0, 3),
+  /* 1111001000 */ V(0, 0, 3),
+  /* 1111001001 */ V(0, 0, 3),
+  /* 1111001010 */ V(0, 0, 3),
+  /* 1111001011 */ V(0, 0, 3),
+  /* 1111001100 */ V(0, 0, 3),
+  /* 1111001101 */ V(0, 0, 3),
+  /* 1111001110 */ V(0, 0, 3),
+  /* 1111001111 */ V(0, 0, 3),
+  /* 1111010000 */ V(0, 0, 3),
+  /* 1111010001 */ V(0, 0, 3),
+  /* 1111010010 */ V(0, 0, 3),
+  /* 1111010011 */ V(0, 0, 3),
+  /* 1111010100 */ V(0, 0, 3),
+  /* 1111010101 */ V(0, 0, 3),
+  /* 1111010110 */ V(0, 0, 3),
+  /* 1111010111 */ V(0, 0, 3),
+  /* 1111011000 */ V(0, 0, 3),
+  /* 1111011001 */ V(0, 0, 3),
+  /* 1111011010 */ V(0, 0, 3),
+  /* 1111011011 */ V(0, 0, 3),
+  /* 1111011100 */ V(0, 0, 3),
+  /* 1111011101 */ V(0, 0, 3),
+  /* 1111011110 */ V(0, 0, 3),
+  /* 1111011111 */ V(0, 0, 3),
+  /* 1111100000 */ V(0, 0, 3),
+  /* 1111100001 */ V(0, 0, 3),
+  /* 1111100010 */ V(0, 0, 3),
+  /* 1111100011 */ V(0, 0, 3),
+  /* 1111100100 */ V(0, 0, 3),
+  /* 1111100101 */ V(0, 0, 3),
+  /* 1111100110 */ V(0, 0, 3),
+  /* 1111100111 */ V(0, 0, 3),
+  /* 1111101000 */ V(0, 0, 3),
+  /* 1111101001 */ V(0, 0, 3),
+  /* 1111101010 */ V(0, 0, 3),
+  /* 1111101011 */ V(0, 0, 3),
+  /* 1111101100 */ V(0, 0, 3),
+  /* 1111101101 */ V(0, 0, 3),
+  /* 1111101110 */ V(0, 0, 3),
+  /* 1111101111 */ V(0, 0, 3),
+  /* 1111110000 */ V(0, 0, 3),
+  /* 1111110001 */ V(0, 0, 3),
+  /* 1111110010 */ V(0, 0, 3),
+  /* 1111110011 */ V(0, 0, 3),
+  /* 1111110100 */ V(0, 0, 3),
+  /* 1111110101 */ V(0, 0, 3),
+  /* 1111110110 */ V(0, 0, 3),
+  /* 1111110111 */ V(0, 0, 3),
+  /* 1111111000 */ V(0, 0, 3),
+  /* 1111111001 */ V(0, 0, 3),
+  /* 1111111010 */ V(0, 0, 3),
+  /* 1111111011 */ V(0, 0, 3),
+  /* 1111111100 */ V(0, 0, 3),
+  /* 1111111101 */ V(0, 0, 3),
+  /* 1111111110 */ V(0, 0, 3),
+  /* 1111111111 */ V(0, 0, 3),
+
+  /* 0000 0000 00 ... */
+  /* 000  */ V(15, 15, 3),	/* 1024 */
+  /* 001  */ V(14, 15, 3),
+  /* 010  */ V(15, 14, 3),
+  /* 011  */ V(13, 15, 3),
+  /* 100  */ V(14, 14, 2),
+  /* 101  */ V(14, 14, 2),
+  /* 110  */ V(15, 13, 3),
+  /* 111  */ V(12, 15, 3),
+
+  /* 0000 0000 01 ... */
+  /* 000  */ V(15, 12, 3),	/* 1032 */
+  /* 001  */ V(13, 14, 3),
+  /* 010  */ V(14, 13, 3),
+  /* 011  */ V(11, 15, 3),
+  /* 100  */ V(15, 11, 2),
+  /* 101  */ V(15, 11, 2),
+  /* 110  */ V(12, 14, 3),
+  /* 111  */ V(14, 12, 3),
+
+  /* 0000 0000 10 ... */
+  /* 00   */ V(13, 13, 2),	/* 1040 */
+  /* 01   */ V(10, 15, 2),
+  /* 10   */ V(15, 10, 2),
+  /* 11   */ V(11, 14, 2),
+
+  /* 0000 0000 11 ... */
+  /* 00   */ V(14, 11, 2),	/* 1044 */
+  /* 01   */ V(12, 13, 2),
+  /* 10   */ V(13, 12, 2),
+  /* 11   */ V(9, 15, 2),
+
+  /* 0000 0001 00 ... */
+  /* 00   */ V(15, 9, 2),	/* 1048 */
+  /* 01   */ V(14, 10, 2),
+  /* 10   */ V(11, 13, 2),
+  /* 11   */ V(13, 11, 2),
+
+  /* 0000 0001 01 ... */
+  /* 00   */ V(8, 15, 2),	/* 1052 */
+  /* 01   */ V(15, 8, 2),
+  /* 10   */ V(12, 12, 2),
+  /* 11   */ V(9, 14, 2),
+
+  /* 0000 0001 10 ... */
+  /* 00   */ V(14, 9, 2),	/* 1056 */
+  /* 01   */ V(7, 15, 2),
+  /* 10   */ V(15, 7, 2),
+  /* 11   */ V(10, 13, 2),
+
+  /* 0000 0001 11 ... */
+  /* 000  */ V(13, 10, 2),	/* 1060 */
+  /* 001  */ V(13, 10, 2),
+  /* 010  */ V(11, 12, 2),
+  /* 011  */ V(11, 12, 2),
+  /* 100  */ V(6, 15, 2),
+  /* 101  */ V(6, 15, 2),
+  /* 110  */ V(10, 14, 3),
+  /* 111  */ V(0, 15, 3),
 
-  /* 0010 0110 ... */
-  /* 0    */ V(3, 8, 1),	/* 350 */
-  /* 1    */ V(8, 3, 1),
+  /* 0000 0010 00 ... */
+  /* 0    */ V(12, 11, 1),	/* 1068 */
+  /* 1    */ V(15, 6, 1),
 
-  /* 0010 0111 ... */
-  /* 0    */ V(6, 6, 1),	/* 352 */
-  /* 1    */ V(4, 7, 1),
+  /* 0000 0010 01 ... */
+  /* 00   */ V(8, 14, 2),	/* 1070 */
+  /* 01   */ V(14, 8, 2),
+  /* 10   */ V(5, 15, 2),
+  /* 11   */ V(9, 13, 2),
 
-  /* 0010 1100 ... */
-  /* 0    */ V(7, 4, 1),	/* 354 */
-  /* 1    */ V(0, 8, 1),
+  /* 0000 0010 10 ... */
+  /* 0    */ V(15, 5, 1),	/* 1074 */
+  /* 1    */ V(7, 14, 1),
 
-  /* 0010 1101 ... */
-  /* 0    */ V(8, 0, 1),	/* 356 */
-  /* 1    */ V(5, 6, 1),
+  /* 0000 0010 11 ... */
+  /* 0    */ V(14, 7, 1),	/* 1076 */
+  /* 1    */ V(10, 12, 1),
 
-  /* 0010 1110 ... */
-  /* 0    */ V(6, 5, 1),	/* 358 */
-  /* 1    */ V(3, 7, 1),
+  /* 0000 0011 00 ... */
+  /* 0    */ V(12, 10, 1),	/* 1078 */
+  /* 1    */ V(11, 11, 1),
 
-  /* 0010 1111 ... */
-  /* 0    */ V(7, 3, 1),	/* 360 */
-  /* 1    */ V(4, 6, 1),
+  /* 0000 0011 01 ... */
+  /* 00   */ V(13, 9, 2),	/* 1080 */
+  /* 01   */ V(8, 13, 2),
+  /* 10   */ V(4, 15, 1),
+  /* 11   */ V(4, 15, 1),
 
-  /* 0011 0110 ... */
-  /* 0    */ V(0, 7, 1),	/* 362 */
-  /* 1    */ V(7, 0, 1),
+  /* 0000 0011 10 ... */
+  /* 0    */ V(15, 4, 1),	/* 1084 */
+  /* 1    */ V(3, 15, 1),
 
-  /* 0011 1110 ... */
-  /* 0    */ V(0, 6, 1),	/* 364 */
-  /* 1    */ V(6, 0, 1),
+  /* 0000 0011 11 ... */
+  /* 0    */ V(15, 3, 1),	/* 1086 */
+  /* 1    */ V(13, 8, 1),
 
-  /* 0000 0000 0000 ... */
-  /* 0    */ V(15, 15, 1),	/* 366 */
-  /* 1    */ V(14, 15, 1),
+  /* 0000 0100 00 ... */
+  /* 0    */ V(14, 6, 1),	/* 1088 */
+  /* 1    */ V(2, 15, 1),
 
-  /* 0000 0000 0001 ... */
-  /* 0    */ V(15, 14, 1),	/* 368 */
-  /* 1    */ V(13, 15, 1),
+  /* 0000 0100 01 ... */
+  /* 00   */ V(15, 2, 1),	/* 1090 */
+  /* 01   */ V(15, 2, 1),
+  /* 10   */ V(6, 14, 2),
+  /* 11   */ V(15, 0, 2),
 
-  /* 0000 0000 0011 ... */
-  /* 0    */ V(15, 13, 1),	/* 370 */
-  /* 1    */ V(12, 15, 1),
+  /* 0000 0100 10 ... */
+  /* 0    */ V(1, 15, 1),	/* 1094 */
+  /* 1    */ V(15, 1, 1),
 
-  /* 0000 0000 0100 ... */
-  /* 0    */ V(15, 12, 1),	/* 372 */
-  /* 1    */ V(13, 14, 1),
+  /* 0000 0100 11 ... */
+  /* 0    */ V(9, 12, 1),	/* 1096 */
+  /* 1    */ V(12, 9, 1),
 
-  /* 0000 0000 0101 ... */
-  /* 0    */ V(14, 13, 1),	/* 374 */
-  /* 1    */ V(11, 15, 1),
+  /* 0000 0101 00 ... */
+  /* 0    */ V(5, 14, 1),	/* 1098 */
+  /* 1    */ V(10, 11, 1),
 
-  /* 0000 0000 0111 ... */
-  /* 0    */ V(12, 14, 1),	/* 376 */
-  /* 1    */ V(14, 12, 1),
+  /* 0000 0101 01 ... */
+  /* 0    */ V(11, 10, 1),	/* 1100 */
+  /* 1    */ V(14, 5, 1),
 
-  /* 0000 0001 1111 ... */
-  /* 0    */ V(10, 14, 1),	/* 378 */
-  /* 1    */ V(0, 15, 1)
-};
+  /* 0000 0101 10 ... */
+  /* 0    */ V(7, 13, 1),	/* 1102 */
+  /* 1    */ V(13, 7, 1),
 
-static
-union huffpair const hufftab16[] = {
-  /* 0000 */ PTR(16, 4),
-  /* 0001 */ PTR(32, 4),
-  /* 0010 */ PTR(48, 4),
-  /* 0011 */ PTR(64, 2),
-  /* 0100 */ V(1, 1, 4),
-  /* 0101 */ V(0, 1, 4),
-  /* 0110 */ V(1, 0, 3),
-  /* 0111 */ V(1, 0, 3),
-  /* 1000 */ V(0, 0, 1),
-  /* 1001 */ V(0, 0, 1),
-  /* 1010 */ V(0, 0, 1),
-  /* 1011 */ V(0, 0, 1),
-  /* 1100 */ V(0, 0, 1),
-  /* 1101 */ V(0, 0, 1),
-  /* 1110 */ V(0, 0, 1),
-  /* 1111 */ V(0, 0, 1),
-
-  /* 0000 ... */
-  /* 0000 */ PTR(68, 3),	/* 16 */
-  /* 0001 */ PTR(76, 3),
-  /* 0010 */ PTR(84, 2),
-  /* 0011 */ V(15, 15, 4),
-  /* 0100 */ PTR(88, 2),
-  /* 0101 */ PTR(92, 1),
-  /* 0110 */ PTR(94, 4),
-  /* 0111 */ V(15, 2, 4),
-  /* 1000 */ PTR(110, 1),
-  /* 1001 */ V(1, 15, 4),
-  /* 1010 */ V(15, 1, 4),
-  /* 1011 */ PTR(112, 4),
-  /* 1100 */ PTR(128, 4),
-  /* 1101 */ PTR(144, 4),
-  /* 1110 */ PTR(160, 4),
-  /* 1111 */ PTR(176, 4),
-
-  /* 0001 ... */
-  /* 0000 */ PTR(192, 4),	/* 32 */
-  /* 0001 */ PTR(208, 3),
-  /* 0010 */ PTR(216, 3),
-  /* 0011 */ PTR(224, 3),
-  /* 0100 */ PTR(232, 3),
-  /* 0101 */ PTR(240, 3),
-  /* 0110 */ PTR(248, 3),
-  /* 0111 */ PTR(256, 3),
-  /* 1000 */ PTR(264, 2),
-  /* 1001 */ PTR(268, 2),
-  /* 1010 */ PTR(272, 1),
-  /* 1011 */ PTR(274, 2),
-  /* 1100 */ PTR(278, 2),
-  /* 1101 */ PTR(282, 1),
-  /* 1110 */ V(5, 1, 4),
-  /* 1111 */ PTR(284, 1),
-
-  /* 0010 ... */
-  /* 0000 */ PTR(286, 1),	/* 48 */
-  /* 0001 */ PTR(288, 1),
-  /* 0010 */ PTR(290, 1),
-  /* 0011 */ V(1, 4, 4),
-  /* 0100 */ V(4, 1, 4),
-  /* 0101 */ PTR(292, 1),
-  /* 0110 */ V(2, 3, 4),
-  /* 0111 */ V(3, 2, 4),
-  /* 1000 */ V(1, 3, 3),
-  /* 1001 */ V(1, 3, 3),
-  /* 1010 */ V(3, 1, 3),
-  /* 1011 */ V(3, 1, 3),
-  /* 1100 */ V(0, 3, 4),
-  /* 1101 */ V(3, 0, 4),
-  /* 1110 */ V(2, 2, 3),
-  /* 1111 */ V(2, 2, 3),
-
-  /* 0011 ... */
-  /* 00   */ V(1, 2, 2),	/* 64 */
-  /* 01   */ V(2, 1, 2),
-  /* 10   */ V(0, 2, 2),
-  /* 11   */ V(2, 0, 2),
-
-  /* 0000 0000 ... */
-  /* 000  */ V(14, 15, 3),	/* 68 */
-  /* 001  */ V(15, 14, 3),
-  /* 010  */ V(13, 15, 3),
-  /* 011  */ V(15, 13, 3),
-  /* 100  */ V(12, 15, 3),
-  /* 101  */ V(15, 12, 3),
-  /* 110  */ V(11, 15, 3),
-  /* 111  */ V(15, 11, 3),
-
-  /* 0000 0001 ... */
-  /* 000  */ V(10, 15, 2),	/* 76 */
-  /* 001  */ V(10, 15, 2),
-  /* 010  */ V(15, 10, 3),
-  /* 011  */ V(9, 15, 3),
-  /* 100  */ V(15, 9, 3),
-  /* 101  */ V(15, 8, 3),
-  /* 110  */ V(8, 15, 2),
-  /* 111  */ V(8, 15, 2),
-
-  /* 0000 0010 ... */
-  /* 00   */ V(7, 15, 2),	/* 84 */
-  /* 01   */ V(15, 7, 2),
-  /* 10   */ V(6, 15, 2),
-  /* 11   */ V(15, 6, 2),
-
-  /* 0000 0100 ... */
-  /* 00   */ V(5, 15, 2),	/* 88 */
-  /* 01   */ V(15, 5, 2),
-  /* 10   */ V(4, 15, 1),
-  /* 11   */ V(4, 15, 1),
+  /* 0000 0101 11 ... */
+  /* 0    */ V(4, 14, 1),	/* 1104 */
+  /* 1    */ V(14, 4, 1),
 
-  /* 0000 0101 ... */
-  /* 0    */ V(15, 4, 1),	/* 92 */
-  /* 1    */ V(15, 3, 1),
-
-  /* 0000 0110 ... */
-  /* 0000 */ V(15, 0, 1),	/* 94 */
-  /* 0001 */ V(15, 0, 1),
-  /* 0010 */ V(15, 0, 1),
-  /* 0011 */ V(15, 0, 1),
-  /* 0100 */ V(15, 0, 1),
-  /* 0101 */ V(15, 0, 1),
-  /* 0110 */ V(15, 0, 1),
-  /* 0111 */ V(15, 0, 1),
-  /* 1000 */ V(3, 15, 2),
-  /* 1001 */ V(3, 15, 2),
-  /* 1010 */ V(3, 15, 2),
-  /* 1011 */ V(3, 15, 2),
-  /* 1100 */ PTR(294, 4),
-  /* 1101 */ PTR(310, 3),
-  /* 1110 */ PTR(318, 3),
-  /* 1111 */ PTR(326, 3),
-
-  /* 0000 1000 ... */
-  /* 0    */ V(2, 15, 1),	/* 110 */
-  /* 1    */ V(0, 15, 1),
-
-  /* 0000 1011 ... */
-  /* 0000 */ PTR(334, 2),	/* 112 */
-  /* 0001 */ PTR(338, 2),
-  /* 0010 */ PTR(342, 2),
-  /* 0011 */ PTR(346, 1),
-  /* 0100 */ PTR(348, 2),
-  /* 0101 */ PTR(352, 2),
-  /* 0110 */ PTR(356, 1),
-  /* 0111 */ PTR(358, 2),
-  /* 1000 */ PTR(362, 2),
-  /* 1001 */ PTR(366, 2),
-  /* 1010 */ PTR(370, 2),
-  /* 1011 */ V(14, 3, 4),
-  /* 1100 */ PTR(374, 1),
-  /* 1101 */ PTR(376, 1),
-  /* 1110 */ PTR(378, 1),
-  /* 1111 */ PTR(380, 1),
-
-  /* 0000 1100 ... */
-  /* 0000 */ PTR(382, 1),	/* 128 */
-  /* 0001 */ PTR(384, 1),
-  /* 0010 */ PTR(386, 1),
-  /* 0011 */ V(0, 13, 4),
-  /* 0100 */ PTR(388, 1),
-  /* 0101 */ PTR(390, 1),
-  /* 0110 */ PTR(392, 1),
-  /* 0111 */ V(3, 12, 4),
-  /* 1000 */ PTR(394, 1),
-  /* 1001 */ V(1, 12, 4),
-  /* 1010 */ V(12, 0, 4),
-  /* 1011 */ PTR(396, 1),
-  /* 1100 */ V(14, 2, 3),
-  /* 1101 */ V(14, 2, 3),
-  /* 1110 */ V(2, 14, 4),
-  /* 1111 */ V(1, 14, 4),
-
-  /* 0000 1101 ... */
-  /* 0000 */ V(13, 3, 4),	/* 144 */
-  /* 0001 */ V(2, 13, 4),
-  /* 0010 */ V(13, 2, 4),
-  /* 0011 */ V(13, 1, 4),
-  /* 0100 */ V(3, 11, 4),
-  /* 0101 */ PTR(398, 1),
-  /* 0110 */ V(1, 13, 3),
-  /* 0111 */ V(1, 13, 3),
-  /* 1000 */ V(12, 4, 4),
-  /* 1001 */ V(6, 11, 4),
-  /* 1010 */ V(12, 3, 4),
-  /* 1011 */ V(10, 7, 4),
-  /* 1100 */ V(2, 12, 3),
-  /* 1101 */ V(2, 12, 3),
-  /* 1110 */ V(12, 2, 4),
-  /* 1111 */ V(11, 5, 4),
-
-  /* 0000 1110 ... */
-  /* 0000 */ V(12, 1, 4),	/* 160 */
-  /* 0001 */ V(0, 12, 4),
-  /* 0010 */ V(4, 11, 4),
-  /* 0011 */ V(11, 4, 4),
-  /* 0100 */ V(6, 10, 4),
-  /* 0101 */ V(10, 6, 4),
-  /* 0110 */ V(11, 3, 3),
-  /* 0111 */ V(11, 3, 3),
-  /* 1000 */ V(5, 10, 4),
-  /* 1001 */ V(10, 5, 4),
-  /* 1010 */ V(2, 11, 3),
-  /* 1011 */ V(2, 11, 3),
-  /* 1100 */ V(11, 2, 3),
-  /* 1101 */ V(11, 2, 3),
-  /* 1110 */ V(1, 11, 3),
-  /* 1111 */ V(1, 11, 3),
-
-  /* 0000 1111 ... */
-  /* 0000 */ V(11, 1, 3),	/* 176 */
-  /* 0001 */ V(11, 1, 3),
-  /* 0010 */ V(0, 11, 4),
-  /* 0011 */ V(11, 0, 4),
-  /* 0100 */ V(6, 9, 4),
-  /* 0101 */ V(9, 6, 4),
-  /* 0110 */ V(4, 10, 4),
-  /* 0111 */ V(10, 4, 4),
-  /* 1000 */ V(7, 8, 4),
-  /* 1001 */ V(8, 7, 4),
-  /* 1010 */ V(10, 3, 3),
-  /* 1011 */ V(10, 3, 3),
-  /* 1100 */ V(3, 10, 4),
-  /* 1101 */ V(5, 9, 4),
-  /* 1110 */ V(2, 10, 3),
-  /* 1111 */ V(2, 10, 3),
-
-  /* 0001 0000 ... */
-  /* 0000 */ V(9, 5, 4),	/* 192 */
-  /* 0001 */ V(6, 8, 4),
-  /* 0010 */ V(10, 1, 3),
-  /* 0011 */ V(10, 1, 3),
-  /* 0100 */ V(8, 6, 4),
-  /* 0101 */ V(7, 7, 4),
-  /* 0110 */ V(9, 4, 3),
-  /* 0111 */ V(9, 4, 3),
-  /* 1000 */ V(4, 9, 4),
-  /* 1001 */ V(5, 7, 4),
-  /* 1010 */ V(6, 7, 3),
-  /* 1011 */ V(6, 7, 3),
-  /* 1100 */ V(10, 2, 2),
-  /* 1101 */ V(10, 2, 2),
-  /* 1110 */ V(10, 2, 2),
-  /* 1111 */ V(10, 2, 2),
-
-  /* 0001 0001 ... */
-  /* 000  */ V(1, 10, 2),	/* 208 */
-  /* 001  */ V(1, 10, 2),
-  /* 010  */ V(0, 10, 3),
-  /* 011  */ V(10, 0, 3),
-  /* 100  */ V(3, 9, 3),
-  /* 101  */ V(9, 3, 3),
-  /* 110  */ V(5, 8, 3),
-  /* 111  */ V(8, 5, 3),
-
-  /* 0001 0010 ... */
-  /* 000  */ V(2, 9, 2),	/* 216 */
-  /* 001  */ V(2, 9, 2),
-  /* 010  */ V(9, 2, 2),
-  /* 011  */ V(9, 2, 2),
-  /* 100  */ V(7, 6, 3),
-  /* 101  */ V(0, 9, 3),
-  /* 110  */ V(1, 9, 2),
-  /* 111  */ V(1, 9, 2),
-
-  /* 0001 0011 ... */
-  /* 000  */ V(9, 1, 2),	/* 224 */
-  /* 001  */ V(9, 1, 2),
-  /* 010  */ V(9, 0, 3),
-  /* 011  */ V(4, 8, 3),
-  /* 100  */ V(8, 4, 3),
-  /* 101  */ V(7, 5, 3),
-  /* 110  */ V(3, 8, 3),
-  /* 111  */ V(8, 3, 3),
-
-  /* 0001 0100 ... */
-  /* 000  */ V(6, 6, 3),	/* 232 */
-  /* 001  */ V(2, 8, 3),
-  /* 010  */ V(8, 2, 2),
-  /* 011  */ V(8, 2, 2),
-  /* 100  */ V(4, 7, 3),
-  /* 101  */ V(7, 4, 3),
-  /* 110  */ V(1, 8, 2),
-  /* 111  */ V(1, 8, 2),
-
-  /* 0001 0101 ... */
-  /* 000  */ V(8, 1, 2),	/* 240 */
-  /* 001  */ V(8, 1, 2),
-  /* 010  */ V(8, 0, 2),
-  /* 011  */ V(8, 0, 2),
-  /* 100  */ V(0, 8, 3),
-  /* 101  */ V(5, 6, 3),
-  /* 110  */ V(3, 7, 2),
-  /* 111  */ V(3, 7, 2),
-
-  /* 0001 0110 ... */
-  /* 000  */ V(7, 3, 2),	/* 248 */
-  /* 001  */ V(7, 3, 2),
-  /* 010  */ V(6, 5, 3),
-  /* 011  */ V(4, 6, 3),
-  /* 100  */ V(2, 7, 2),
-  /* 101  */ V(2, 7, 2),
-  /* 110  */ V(7, 2, 2),
-  /* 111  */ V(7, 2, 2),
-
-  /* 0001 0111 ... */
-  /* 000  */ V(6, 4, 3),	/* 256 */
-  /* 001  */ V(5, 5, 3),
-  /* 010  */ V(0, 7, 2),
-  /* 011  */ V(0, 7, 2),
-  /* 100  */ V(1, 7, 1),
-  /* 101  */ V(1, 7, 1),
-  /* 110  */ V(1, 7, 1),
-  /* 111  */ V(1, 7, 1),
-
-  /* 0001 1000 ... */
-  /* 00   */ V(7, 1, 1),	/* 264  */
-  /* 01   */ V(7, 1, 1),
-  /* 10   */ V(7, 0, 2),
-  /* 11   */ V(3, 6, 2),
-
-  /* 0001 1001 ... */
-  /* 00   */ V(6, 3, 2),	/* 268 */
-  /* 01   */ V(4, 5, 2),
-  /* 10   */ V(5, 4, 2),
-  /* 11   */ V(2, 6, 2),
-
-  /* 0001 1010 ... */
-  /* 0    */ V(6, 2, 1),	/* 272 */
-  /* 1    */ V(1, 6, 1),
-
-  /* 0001 1011 ... */
-  /* 00   */ V(6, 1, 1),	/* 274 */
-  /* 01   */ V(6, 1, 1),
-  /* 10   */ V(0, 6, 2),
-  /* 11   */ V(6, 0, 2),
-
-  /* 0001 1100 ... */
-  /* 00   */ V(5, 3, 1),	/* 278 */
-  /* 01   */ V(5, 3, 1),
-  /* 10   */ V(3, 5, 2),
-  /* 11   */ V(4, 4, 2),
-
-  /* 0001 1101 ... */
-  /* 0    */ V(2, 5, 1),	/* 282 */
-  /* 1    */ V(5, 2, 1),
-
-  /* 0001 1111 ... */
-  /* 0    */ V(1, 5, 1),	/* 284 */
-  /* 1    */ V(0, 5, 1),
-
-  /* 0010 0000 ... */
-  /* 0    */ V(3, 4, 1),	/* 286 */
-  /* 1    */ V(4, 3, 1),
-
-  /* 0010 0001 ... */
-  /* 0    */ V(5, 0, 1),	/* 288 */
-  /* 1    */ V(2, 4, 1),
-
-  /* 0010 0010 ... */
-  /* 0    */ V(4, 2, 1),	/* 290 */
-  /* 1    */ V(3, 3, 1),
-
-  /* 0010 0101 ... */
-  /* 0    */ V(0, 4, 1),	/* 292 */
-  /* 1    */ V(4, 0, 1),
-
-  /* 0000 0110 1100 ... */
-  /* 0000 */ V(12, 14, 4),	/* 294 */
-  /* 0001 */ PTR(400, 1),
-  /* 0010 */ V(13, 14, 3),
-  /* 0011 */ V(13, 14, 3),
-  /* 0100 */ V(14, 9, 3),
-  /* 0101 */ V(14, 9, 3),
-  /* 0110 */ V(14, 10, 4),
-  /* 0111 */ V(13, 9, 4),
-  /* 1000 */ V(14, 14, 2),
-  /* 1001 */ V(14, 14, 2),
-  /* 1010 */ V(14, 14, 2),
-  /* 1011 */ V(14, 14, 2),
-  /* 1100 */ V(14, 13, 3),
-  /* 1101 */ V(14, 13, 3),
-  /* 1110 */ V(14, 11, 3),
-  /* 1111 */ V(14, 11, 3),
-
-  /* 0000 0110 1101 ... */
-  /* 000  */ V(11, 14, 2),	/* 310 */
-  /* 001  */ V(11, 14, 2),
-  /* 010  */ V(12, 13, 2),
-  /* 011  */ V(12, 13, 2),
-  /* 100  */ V(13, 12, 3),
-  /* 101  */ V(13, 11, 3),
-  /* 110  */ V(10, 14, 2),
-  /* 111  */ V(10, 14, 2),
-
-  /* 0000 0110 1110 ... */
-  /* 000  */ V(12, 12, 2),	/* 318 */
-  /* 001  */ V(12, 12, 2),
-  /* 010  */ V(10, 13, 3),
-  /* 011  */ V(13, 10, 3),
-  /* 100  */ V(7, 14, 3),
-  /* 101  */ V(10, 12, 3),
-  /* 110  */ V(12, 10, 2),
-  /* 111  */ V(12, 10, 2),
-
-  /* 0000 0110 1111 ... */
-  /* 000  */ V(12, 9, 3),	/* 326 */
-  /* 001  */ V(7, 13, 3),
-  /* 010  */ V(5, 14, 2),
-  /* 011  */ V(5, 14, 2),
-  /* 100  */ V(11, 13, 1),
-  /* 101  */ V(11, 13, 1),
-  /* 110  */ V(11, 13, 1),
-  /* 111  */ V(11, 13, 1),
-
-  /* 0000 1011 0000 ... */
-  /* 00   */ V(9, 14, 1),	/* 334 */
-  /* 01   */ V(9, 14, 1),
-  /* 10   */ V(11, 12, 2),
-  /* 11   */ V(12, 11, 2),
-
-  /* 0000 1011 0001 ... */
-  /* 00   */ V(8, 14, 2),	/* 338 */
-  /* 01   */ V(14, 8, 2),
-  /* 10   */ V(9, 13, 2),
-  /* 11   */ V(14, 7, 2),
+  /* 0000 0110 00 ... */
+  /* 0    */ V(8, 12, 1),	/* 1106 */
+  /* 1    */ V(12, 8, 1),
 
-  /* 0000 1011 0010 ... */
-  /* 00   */ V(11, 11, 2),	/* 342 */
-  /* 01   */ V(8, 13, 2),
-  /* 10   */ V(13, 8, 2),
-  /* 11   */ V(6, 14, 2),
+  /* 0000 0110 01 ... */
+  /* 0    */ V(3, 14, 1),	/* 1108 */
+  /* 1    */ V(6, 13, 1),
 
-  /* 0000 1011 0011 ... */
-  /* 0    */ V(14, 6, 1),	/* 346 */
-  /* 1    */ V(9, 12, 1),
+  /* 0000 0110 10 ... */
+  /* 0    */ V(13, 6, 1),	/* 1110 */
+  /* 1    */ V(14, 3, 1),
+
+  /* 0000 0110 11 ... */
+  /* 0    */ V(9, 11, 1),	/* 1112 */
+  /* 1    */ V(11, 9, 1),
+
+  /* 0000 0111 00 ... */
+  /* 0    */ V(2, 14, 1),	/* 1114 */
+  /* 1    */ V(10, 10, 1),
 
-  /* 0000 1011 0100 ... */
-  /* 00   */ V(10, 11, 2),	/* 348 */
-  /* 01   */ V(11, 10, 2),
-  /* 10   */ V(14, 5, 2),
-  /* 11   */ V(13, 7, 2),
-
-  /* 0000 1011 0101 ... */
-  /* 00   */ V(4, 14, 1),	/* 352 */
-  /* 01   */ V(4, 14, 1),
-  /* 10   */ V(14, 4, 2),
-  /* 11   */ V(8, 12, 2),
-
-  /* 0000 1011 0110 ... */
-  /* 0    */ V(12, 8, 1),	/* 356 */
-  /* 1    */ V(3, 14, 1),
-
-  /* 0000 1011 0111 ... */
-  /* 00   */ V(6, 13, 1),	/* 358 */
-  /* 01   */ V(6, 13, 1),
-  /* 10   */ V(13, 6, 2),
-  /* 11   */ V(9, 11, 2),
-
-  /* 0000 1011 1000 ... */
-  /* 00   */ V(11, 9, 2),	/* 362 */
-  /* 01   */ V(10, 10, 2),
-  /* 10   */ V(14, 1, 1),
-  /* 11   */ V(14, 1, 1),
-
-  /* 0000 1011 1001 ... */
-  /* 00   */ V(13, 4, 1),	/* 366 */
-  /* 01   */ V(13, 4, 1),
-  /* 10   */ V(11, 8, 2),
-  /* 11   */ V(10, 9, 2),
-
-  /* 0000 1011 1010 ... */
-  /* 00   */ V(7, 11, 1),	/* 370 */
-  /* 01   */ V(7, 11, 1),
-  /* 10   */ V(11, 7, 2),
-  /* 11   */ V(13, 0, 2),
-
-  /* 0000 1011 1100 ... */
-  /* 0    */ V(0, 14, 1),	/* 374 */
-  /* 1    */ V(14, 0, 1),
-
-  /* 0000 1011 1101 ... */
-  /* 0    */ V(5, 13, 1),	/* 376 */
+  /* 0000 0111 01 ... */
+  /* 0    */ V(14, 2, 1),	/* 1116 */
+  /* 1    */ V(1, 14, 1),
+
+  /* 0000 0111 10 ... */
+  /* 00   */ V(14, 1, 1),	/* 1118 */
+  /* 01   */ V(14, 1, 1),
+  /* 10   */ V(0, 14, 2),
+  /* 11   */ V(14, 0, 2),
+
+  /* 0000 0111 11 ... */
+  /* 0    */ V(5, 13, 1),	/* 1122 */
   /* 1    */ V(13, 5, 1),
 
-  /* 0000 1011 1110 ... */
-  /* 0    */ V(7, 12, 1),	/* 378 */
+  /* 0000 1000 00 ... */
+  /* 0    */ V(7, 12, 1),	/* 1124 */
   /* 1    */ V(12, 7, 1),
 
-  /* 0000 1011 1111 ... */
-  /* 0    */ V(4, 13, 1),	/* 380 */
+  /* 0000 1000 01 ... */
+  /* 0    */ V(4, 13, 1),	/* 1126 */
   /* 1    */ V(8, 11, 1),
 
-  /* 0000 1100 0000 ... */
-  /* 0    */ V(9, 10, 1),	/* 382 */
+  /* 0000 1000 11 ... */
+  /* 0    */ V(11, 8, 1),	/* 1128 */
+  /* 1    */ V(9, 10, 1),
+
+  /* 0000 1001 00 ... */
+  /* 0    */ V(10, 9, 1),	/* 1130 */
   /* 1    */ V(6, 12, 1),
 
-  /* 0000 1100 0001 ... */
-  /* 0    */ V(12, 6, 1),	/* 384 */
+  /* 0000 1001 01 ... */
+  /* 0    */ V(12, 6, 1),	/* 1132 */
   /* 1    */ V(3, 13, 1),
 
-  /* 0000 1100 0010 ... */
-  /* 0    */ V(5, 12, 1),	/* 386 */
-  /* 1    */ V(12, 5, 1),
+  /* 0000 1010 00 ... */
+  /* 0    */ V(2, 13, 1),	/* 1134 */
+  /* 1    */ V(0, 13, 1),
 
-  /* 0000 1100 0100 ... */
-  /* 0    */ V(8, 10, 1),	/* 388 */
-  /* 1    */ V(10, 8, 1),
+  /* 0000 1011 01 ... */
+  /* 0    */ V(5, 12, 1),	/* 1136 */
+  /* 1    */ V(13, 0, 1),
 
-  /* 0000 1100 0101 ... */
-  /* 0    */ V(9, 9, 1),	/* 390 */
-  /* 1    */ V(4, 12, 1),
+  /* 0000 1101 01 ... */
+  /* 0    */ V(9, 9, 1),	/* 1138 */
+  /* 1    */ V(0, 12, 1),
 
-  /* 0000 1100 0110 ... */
-  /* 0    */ V(11, 6, 1),	/* 392 */
-  /* 1    */ V(7, 10, 1),
+  /* 0000 1110 11 ... */
+  /* 0    */ V(12, 0, 1),	/* 1140 */
+  /* 1    */ V(0, 11, 1)
+};
 
-  /* 0000 1100 1000 ... */
-  /* 0    */ V(5, 11, 1),	/* 394 */
-  /* 1    */ V(8, 9, 1),
+static
+union huffpair const hufftab16[] = {
+  /* 0000000000 */ PTR(1024, 1),
+  /* 0000000001 */ PTR(1026, 1),
+  /* 0000000010 */ PTR(1028, 1),
+  /* 0000000011 */ PTR(1030, 1),
+  /* 0000000100 */ V(10, 15, 10),
+  /* 0000000101 */ PTR(1032, 1),
+  /* 0000000110 */ PTR(1034, 1),
+  /* 0000000111 */ V(8, 15, 10),
+  /* 0000001000 */ V(7, 15, 10),
+  /* 0000001001 */ V(15, 7, 10),
+  /* 0000001010 */ V(6, 15, 10),
+  /* 0000001011 */ V(15, 6, 10),
+  /* 0000001100 */ V(15, 15, 8),
+  /* 0000001101 */ V(15, 15, 8),
+  /* 0000001110 */ V(15, 15, 8),
+  /* 0000001111 */ V(15, 15, 8),
+  /* 0000010000 */ V(5, 15, 10),
+  /* 0000010001 */ V(15, 5, 10),
+  /* 0000010010 */ V(4, 15, 9),
+  /* 0000010011 */ V(4, 15, 9),
+  /* 0000010100 */ V(15, 4, 9),
+  /* 0000010101 */ V(15, 4, 9),
+  /* 0000010110 */ V(15, 3, 9),
+  /* 0000010111 */ V(15, 3, 9),
+  /* 0000011000 */ V(15, 0, 9),
+  /* 0000011001 */ V(15, 0, 9),
+  /* 0000011010 */ V(3, 15, 10),
+  /* 0000011011 */ PTR(1036, 6),
+  /* 0000011100 */ V(15, 2, 8),
+  /* 0000011101 */ V(15, 2, 8),
+  /* 0000011110 */ V(15, 2, 8),
+  /* 0000011111 */ V(15, 2, 8),
+  /* 0000100000 */ V(2, 15, 9),
+  /* 0000100001 */ V(2, 15, 9),
+  /* 0000100010 */ V(0, 15, 9),
+  /* 0000100011 */ V(0, 15, 9),
+  /* 0000100100 */ V(1, 15, 8),
+  /* 0000100101 */ V(1, 15, 8),
+  /* 0000100110 */ V(1, 15, 8),
+  /* 0000100111 */ V(1, 15, 8),
+  /* 0000101000 */ V(15, 1, 8),
+  /* 0000101001 */ V(15, 1, 8),
+  /* 0000101010 */ V(15, 1, 8),
+  /* 0000101011 */ V(15, 1, 8),
+  /* 0000101100 */ PTR(1102, 4),
+  /* 0000101101 */ PTR(1118, 4),
+  /* 0000101110 */ PTR(1134, 4),
+  /* 0000101111 */ PTR(1150, 3),
+  /* 0000110000 */ PTR(1158, 3),
+  /* 0000110001 */ PTR(1166, 3),
+  /* 0000110010 */ PTR(1174, 3),
+  /* 0000110011 */ PTR(1182, 2),
+  /* 0000110100 */ PTR(1186, 2),
+  /* 0000110101 */ PTR(1190, 3),
+  /* 0000110110 */ PTR(1198, 2),
+  /* 0000110111 */ PTR(1202, 2),
+  /* 0000111000 */ PTR(1206, 2),
+  /* 0000111001 */ PTR(1210, 2),
+  /* 0000111010 */ PTR(1214, 2),
+  /* 0000111011 */ PTR(1218, 1),
+  /* 0000111100 */ PTR(1220, 2),
+  /* 0000111101 */ PTR(1224, 2),
+  /* 0000111110 */ PTR(1228, 2),
+  /* 0000111111 */ PTR(1232, 2),
+  /* 0001000000 */ PTR(1236, 2),
+  /* 0001000001 */ PTR(1240, 2),
+  /* 0001000010 */ PTR(1244, 2),
+  /* 0001000011 */ V(10, 2, 10),
+  /* 0001000100 */ V(1, 10, 10),
+  /* 0001000101 */ PTR(1248, 1),
+  /* 0001000110 */ PTR(1250, 1),
+  /* 0001000111 */ PTR(1252, 1),
+  /* 0001001000 */ V(2, 9, 10),
+  /* 0001001001 */ V(9, 2, 10),
+  /* 0001001010 */ PTR(1254, 1),
+  /* 0001001011 */ V(1, 9, 10),
+  /* 0001001100 */ V(9, 1, 10),
+  /* 0001001101 */ PTR(1256, 1),
+  /* 0001001110 */ PTR(1258, 1),
+  /* 0001001111 */ PTR(1260, 1),
+  /* 0001010000 */ PTR(1262, 1),
+  /* 0001010001 */ V(8, 2, 10),
+  /* 0001010010 */ PTR(1264, 1),
+  /* 0001010011 */ V(1, 8, 10),
+  /* 0001010100 */ V(8, 1, 10),
+  /* 0001010101 */ V(8, 0, 10),
+  /* 0001010110 */ PTR(1266, 1),
+  /* 0001010111 */ V(3, 7, 10),
+  /* 0001011000 */ V(7, 3, 10),
+  /* 0001011001 */ PTR(1268, 1),
+  /* 0001011010 */ V(2, 7, 10),
+  /* 0001011011 */ V(7, 2, 10),
+  /* 0001011100 */ PTR(1270, 1),
+  /* 0001011101 */ V(0, 7, 10),
+  /* 0001011110 */ V(1, 7, 9),
+  /* 0001011111 */ V(1, 7, 9),
+  /* 0001100000 */ V(7, 1, 9),
+  /* 0001100001 */ V(7, 1, 9),
+  /* 0001100010 */ V(7, 0, 10),
+  /* 0001100011 */ V(3, 6, 10),
+  /* 0001100100 */ V(6, 3, 10),
+  /* 0001100101 */ V(4, 5, 10),
+  /* 0001100110 */ V(5, 4, 10),
+  /* 0001100111 */ V(2, 6, 10),
+  /* 0001101000 */ V(6, 2, 9),
+  /* 0001101001 */ V(6, 2, 9),
+  /* 0001101010 */ V(1, 6, 9),
+  /* 0001101011 */ V(1, 6, 9),
+  /* 0001101100 */ V(6, 1, 9),
+  /* 0001101101 */ V(6, 1, 9),
+  /* 0001101110 */ V(0, 6, 10),
+  /* 0001101111 */ V(6, 0, 10),
+  /* 0001110000 */ V(5, 3, 9),
+  /* 0001110001 */ V(5, 3, 9),
+  /* 0001110010 */ V(3, 5, 10),
+  /* 0001110011 */ V(4, 4, 10),
+  /* 0001110100 */ V(2, 5, 9),
+  /* 0001110101 */ V(2, 5, 9),
+  /* 0001110110 */ V(5, 2, 9),
+  /* 0001110111 */ V(5, 2, 9),
+  /* 0001111000 */ V(5, 1, 8),
+  /* 0001111001 */ V(5, 1, 8),
+  /* 0001111010 */ V(5, 1, 8),
+  /* 0001111011 */ V(5, 1, 8),
+  /* 0001111100 */ V(1, 5, 9),
+  /* 0001111101 */ V(1, 5, 9),
+  /* 0001111110 */ V(0, 5, 9),
+  /* 0001111111 */ V(0, 5, 9),
+  /* 0010000000 */ V(3, 4, 9),
+  /* 0010000001 */ V(3, 4, 9),
+  /* 0010000010 */ V(4, 3, 9),
+  /* 0010000011 */ V(4, 3, 9),
+  /* 0010000100 */ V(5, 0, 9),
+  /* 0010000101 */ V(5, 0, 9),
+  /* 0010000110 */ V(2, 4, 9),
+  /* 0010000111 */ V(2, 4, 9),
+  /* 0010001000 */ V(4, 2, 9),
+  /* 0010001001 */ V(4, 2, 9),
+  /* 0010001010 */ V(3, 3, 9),
+  /* 0010001011 */ V(3, 3, 9),
+  /* 0010001100 */ V(1, 4, 8),
+  /* 0010001101 */ V(1, 4, 8),
+  /* 0010001110 */ V(1, 4, 8),
+  /* 0010001111 */ V(1, 4, 8),
+  /* 0010010000 */ V(4, 1, 8),
+  /* 0010010001 */ V(4, 1, 8),
+  /* 0010010010 */ V(4, 1, 8),
+  /* 0010010011 */ V(4, 1, 8),
+  /* 0010010100 */ V(0, 4, 9),
+  /* 0010010101 */ V(0, 4, 9),
+  /* 0010010110 */ V(4, 0, 9),
+  /* 0010010111 */ V(4, 0, 9),
+  /* 0010011000 */ V(2, 3, 8),
+  /* 0010011001 */ V(2, 3, 8),
+  /* 0010011010 */ V(2, 3, 8),
+  /* 0010011011 */ V(2, 3, 8),
+  /* 0010011100 */ V(3, 2, 8),
+  /* 0010011101 */ V(3, 2, 8),
+  /* 0010011110 */ V(3, 2, 8),
+  /* 0010011111 */ V(3, 2, 8),
+  /* 0010100000 */ V(1, 3, 7),
+  /* 0010100001 */ V(1, 3, 7),
+  /* 0010100010 */ V(1, 3, 7),
+  /* 0010100011 */ V(1, 3, 7),
+  /* 0010100100 */ V(1, 3, 7),
+  /* 0010100101 */ V(1, 3, 7),
+  /* 0010100110 */ V(1, 3, 7),
+  /* 0010100111 */ V(1, 3, 7),
+  /* 0010101000 */ V(3, 1, 7),
+  /* 0010101001 */ V(3, 1, 7),
+  /* 0010101010 */ V(3, 1, 7),
+  /* 0010101011 */ V(3, 1, 7),
+  /* 0010101100 */ V(3, 1, 7),
+  /* 0010101101 */ V(3, 1, 7),
+  /* 0010101110 */ V(3, 1, 7),
+  /* 0010101111 */ V(3, 1, 7),
+  /* 0010110000 */ V(0, 3, 8),
+  /* 0010110001 */ V(0, 3, 8),
+  /* 0010110010 */ V(0, 3, 8),
+  /* 0010110011 */ V(0, 3, 8),
+  /* 0010110100 */ V(3, 0, 8),
+  /* 0010110101 */ V(3, 0, 8),
+  /* 0010110110 */ V(3, 0, 8),
+  /* 0010110111 */ V(3, 0, 8),
+  /* 0010111000 */ V(2, 2, 7),
+  /* 0010111001 */ V(2, 2, 7),
+  /* 0010111010 */ V(2, 2, 7),
+  /* 0010111011 */ V(2, 2, 7),
+  /* 0010111100 */ V(2, 2, 7),
+  /* 0010111101 */ V(2, 2, 7),
+  /* 0010111110 */ V(2, 2, 7),
+  /* 0010111111 */ V(2, 2, 7),
+  /* 0011000000 */ V(1, 2, 6),
+  /* 0011000001 */ V(1, 2, 6),
+  /* 0011000010 */ V(1, 2, 6),
+  /* 0011000011 */ V(1, 2, 6),
+  /* 0011000100 */ V(1, 2, 6),
+  /* 0011000101 */ V(1, 2, 6),
+  /* 0011000110 */ V(1, 2, 6),
+  /* 0011000111 */ V(1, 2, 6),
+  /* 0011001000 */ V(1, 2, 6),
+  /* 0011001001 */ V(1, 2, 6),
+  /* 0011001010 */ V(1, 2, 6),
+  /* 0011001011 */ V(1, 2, 6),
+  /* 0011001100 */ V(1, 2, 6),
+  /* 0011001101 */ V(1, 2, 6),
+  /* 0011001110 */ V(1, 2, 6),
+  /* 0011001111 */ V(1, 2, 6),
+  /* 0011010000 */ V(2, 1, 6),
+  /* 0011010001 */ V(2, 1, 6),
+  /* 0011010010 */ V(2, 1, 6),
+  /* 0011010011 */ V(2, 1, 6),
+  /* 0011010100 */ V(2, 1, 6),
+  /* 0011010101 */ V(2, 1, 6),
+  /* 0011010110 */ V(2, 1, 6),
+  /* 0011010111 */ V(2, 1, 6),
+  /* 0011011000 */ V(2, 1, 6),
+  /* 0011011001 */ V(2, 1, 6),
+  /* 0011011010 */ V(2, 1, 6),
+  /* 0011011011 */ V(2, 1, 6),
+  /* 0011011100 */ V(2, 1, 6),
+  /* 0011011101 */ V(2, 1, 6),
+  /* 0011011110 */ V(2, 1, 6),
+  /* 0011011111 */ V(2, 1, 6),
+  /* 0011100000 */ V(0, 2, 6),
+  /* 0011100001 */ V(0, 2, 6),
+  /* 0011100010 */ V(0, 2, 6),
+  /* 0011100011 */ V(0, 2, 6),
+  /* 0011100100 */ V(0, 2, 6),
+  /* 0011100101 */ V(0, 2, 6),
+  /* 0011100110 */ V(0, 2, 6),
+  /* 0011100111 */ V(0, 2, 6),
+  /* 0011101000 */ V(0, 2, 6),
+  /* 0011101001 */ V(0, 2, 6),
+  /* 0011101010 */ V(0, 2, 6),
+  /* 0011101011 */ V(0, 2, 6),
+  /* 0011101100 */ V(0, 2, 6),
+  /* 0011101101 */ V(0, 2, 6),
+  /* 0011101110 */ V(0, 2, 6),
+  /* 0011101111 */ V(0, 2, 6),
+  /* 0011110000 */ V(2, 0, 6),
+  /* 0011110001 */ V(2, 0, 6),
+  /* 0011110010 */ V(2, 0, 6),
+  /* 0011110011 */ V(2, 0, 6),
+  /* 0011110100 */ V(2, 0, 6),
+  /* 0011110101 */ V(2, 0, 6),
+  /* 0011110110 */ V(2, 0, 6),
+  /* 0011110111 */ V(2, 0, 6),
+  /* 0011111000 */ V(2, 0, 6),
+  /* 0011111001 */ V(2, 0, 6),
+  /* 0011111010 */ V(2, 0, 6),
+  /* 0011111011 */ V(2, 0, 6),
+  /* 0011111100 */ V(2, 0, 6),
+  /* 0011111101 */ V(2, 0, 6),
+  /* 0011111110 */ V(2, 0, 6),
+  /* 0011111111 */ V(2, 0, 6),
+  /* 0100000000 */ V(1, 1, 4),
+  /* 0100000001 */ V(1, 1, 4),
+  /* 0100000010 */ V(1, 1, 4),
+  /* 0100000011 */ V(1, 1, 4),
+  /* 0100000100 */ V(1, 1, 4),
+  /* 0100000101 */ V(1, 1, 4),
+  /* 0100000110 */ V(1, 1, 4),
+  /* 0100000111 */ V(1, 1, 4),
+  /* 0100001000 */ V(1, 1, 4),
+  /* 0100001001 */ V(1, 1, 4),
+  /* 0100001010 */ V(1, 1, 4),
+  /* 0100001011 */ V(1, 1, 4),
+  /* 0100001100 */ V(1, 1, 4),
+  /* 0100001101 */ V(1, 1, 4),
+  /* 0100001110 */ V(1, 1, 4),
+  /* 0100001111 */ V(1, 1, 4),
+  /* 0100010000 */ V(1, 1, 4),
+  /* 0100010001 */ V(1, 1, 4),
+  /* 0100010010 */ V(1, 1, 4),
+  /* 0100010011 */ V(1, 1, 4),
+  /* 0100010100 */ V(1, 1, 4),
+  /* 0100010101 */ V(1, 1, 4),
+  /* 0100010110 */ V(1, 1, 4),
+  /* 0100010111 */ V(1, 1, 4),
+  /* 0100011000 */ V(1, 1, 4),
+  /* 0100011001 */ V(1, 1, 4),
+  /* 0100011010 */ V(1, 1, 4),
+  /* 0100011011 */ V(1, 1, 4),
+  /* 0100011100 */ V(1, 1, 4),
+  /* 0100011101 */ V(1, 1, 4),
+  /* 0100011110 */ V(1, 1, 4),
+  /* 0100011111 */ V(1, 1, 4),
+  /* 0100100000 */ V(1, 1, 4),
+  /* 0100100001 */ V(1, 1, 4),
+  /* 0100100010 */ V(1, 1, 4),
+  /* 0100100011 */ V(1, 1, 4),
+  /* 0100100100 */ V(1, 1, 4),
+  /* 0100100101 */ V(1, 1, 4),
+  /* 0100100110 */ V(1, 1, 4),
+  /* 0100100111 */ V(1, 1, 4),
+  /* 0100101000 */ V(1, 1, 4),
+  /* 0100101001 */ V(1, 1, 4),
+  /* 0100101010 */ V(1, 1, 4),
+  /* 0100101011 */ V(1, 1, 4),
+  /* 0100101100 */ V(1, 1, 4),
+  /* 0100101101 */ V(1, 1, 4),
+  /* 0100101110 */ V(1, 1, 4),
+  /* 0100101111 */ V(1, 1, 4),
+  /* 0100110000 */ V(1, 1, 4),
+  /* 0100110001 */ V(1, 1, 4),
+  /* 0100110010 */ V(1, 1, 4),
+  /* 0100110011 */ V(1, 1, 4),
+  /* 0100110100 */ V(1, 1, 4),
+  /* 0100110101 */ V(1, 1, 4),
+  /* 0100110110 */ V(1, 1, 4),
+  /* 0100110111 */ V(1, 1, 4),
+  /* 0100111000 */ V(1, 1, 4),
+  /* 0100111001 */ V(1, 1, 4),
+  /* 0100111010 */ V(1, 1, 4),
+  /* 0100111011 */ V(1, 1, 4),
+  /* 0100111100 */ V(1, 1, 4),
+  /* 0100111101 */ V(1, 1, 4),
+  /* 0100111110 */ V(1, 1, 4),
+  /* 0100111111 */ V(1, 1, 4),
+  /* 0101000000 */ V(0, 1, 4),
+  /* 0101000001 */ V(0, 1, 4),
+  /* 0101000010 */ V(0, 1, 4),
+  /* 0101000011 */ V(0, 1, 4),
+  /* 0101000100 */ V(0, 1, 4),
+  /* 0101000101 */ V(0, 1, 4),
+  /* 0101000110 */ V(0, 1, 4),
+  /* 0101000111 */ V(0, 1, 4),
+  /* 0101001000 */ V(0, 1, 4),
+  /* 0101001001 */ V(0, 1, 4),
+  /* 0101001010 */ V(0, 1, 4),
+  /* 0101001011 */ V(0, 1, 4),
+  /* 0101001100 */ V(0, 1, 4),
+  /* 0101001101 */ V(0, 1, 4),
+  /* 0101001110 */ V(0, 1, 4),
+  /* 0101001111 */ V(0, 1, 4),
+  /* 0101010000 */ V(0, 1, 4),
+  /* 0101010001 */ V(0, 1, 4),
+  /* 0101010010 */ V(0, 1, 4),
+  /* 0101010011 */ V(0, 1, 4),
+  /* 0101010100 */ V(0, 1, 4),
+  /* 0101010101 */ V(0, 1, 4),
+  /* 0101010110 */ V(0, 1, 4),
+  /* 0101010111 */ V(0, 1, 4),
+  /* 0101011000 */ V(0, 1, 4),
+  /* 0101011001 */ V(0, 1, 4),
+  /* 0101011010 */ V(0, 1, 4),
+  /* 0101011011 */ V(0, 1, 4),
+  /* 0101011100 */ V(0, 1, 4),
+  /* 0101011101 */ V(0, 1, 4),
+  /* 0101011110 */ V(0, 1, 4),
+  /* 0101011111 */ V(0, 1, 4),
+  /* 0101100000 */ V(0, 1, 4),
+  /* 0101100001 */ V(0, 1, 4),
+  /* 0101100010 */ V(0, 1, 4),
+  /* 0101100011 */ V(0, 1, 4),
+  /* 0101100100 */ V(0, 1, 4),
+  /* 0101100101 */ V(0, 1, 4),
+  /* 0101100110 */ V(0, 1, 4),
+  /* 0101100111 */ V(0, 1, 4),
+  /* 0101101000 */ V(0, 1, 4),
+  /* 0101101001 */ V(0, 1, 4),
+  /* 0101101010 */ V(0, 1, 4),
+  /* 0101101011 */ V(0, 1, 4),
+  /* 0101101100 */ V(0, 1, 4),
+  /* 0101101101 */ V(0, 1, 4),
+  /* 0101101110 */ V(0, 1, 4),
+  /* 0101101111 */ V(0, 1, 4),
+  /* 0101110000 */ V(0, 1, 4),
+  /* 0101110001 */ V(0, 1, 4),
+  /* 0101110010 */ V(0, 1, 4),
+  /* 0101110011 */ V(0, 1, 4),
+  /* 0101110100 */ V(0, 1, 4),
+  /* 0101110101 */ V(0, 1, 4),
+  /* 0101110110 */ V(0, 1, 4),
+  /* 0101110111 */ V(0, 1, 4),
+  /* 0101111000 */ V(0, 1, 4),
+  /* 0101111001 */ V(0, 1, 4),
+  /* 0101111010 */ V(0, 1, 4),
+  /* 0101111011 */ V(0, 1, 4),
+  /* 0101111100 */ V(0, 1, 4),
+  /* 0101111101 */ V(0, 1, 4),
+  /* 0101111110 */ V(0, 1, 4),
+  /* 0101111111 */ V(0, 1, 4),
+  /* 0110000000 */ V(1, 0, 3),
+  /* 0110000001 */ V(1, 0, 3),
+  /* 0110000010 */ V(1, 0, 3),
+  /* 0110000011 */ V(1, 0, 3),
+  /* 0110000100 */ V(1, 0, 3),
+  /* 0110000101 */ V(1, 0, 3),
+  /* 0110000110 */ V(1, 0, 3),
+  /* 0110000111 */ V(1, 0, 3),
+  /* 0110001000 */ V(1, 0, 3),
+  /* 0110001001 */ V(1, 0, 3),
+  /* 0110001010 */ V(1, 0, 3),
+  /* 0110001011 */ V(1, 0, 3),
+  /* 0110001100 */ V(1, 0, 3),
+  /* 0110001101 */ V(1, 0, 3),
+  /* 0110001110 */ V(1, 0, 3),
+  /* 0110001111 */ V(1, 0, 3),
+  /* 0110010000 */ V(1, 0, 3),
+  /* 0110010001 */ V(1, 0, 3),
+  /* 0110010010 */ V(1, 0, 3),
+  /* 0110010011 */ V(1, 0, 3),
+  /* 0110010100 */ V(1, 0, 3),
+  /* 0110010101 */ V(1, 0, 3),
+  /* 0110010110 */ V(1, 0, 3),
+  /* 0110010111 */ V(1, 0, 3),
+  /* 0110011000 */ V(1, 0, 3),
+  /* 0110011001 */ V(1, 0, 3),
+  /* 0110011010 */ V(1, 0, 3),
+  /* 0110011011 */ V(1, 0, 3),
+  /* 0110011100 */ V(1, 0, 3),
+  /* 0110011101 */ V(1, 0, 3),
+  /* 0110011110 */ V(1, 0, 3),
+  /* 0110011111 */ V(1, 0, 3),
+  /* 0110100000 */ V(1, 0, 3),
+  /* 0110100001 */ V(1, 0, 3),
+  /* 0110100010 */ V(1, 0, 3),
+  /* 0110100011 */ V(1, 0, 3),
+  /* 0110100100 */ V(1, 0, 3),
+  /* 0110100101 */ V(1, 0, 3),
+  /* 0110100110 */ V(1, 0, 3),
+  /* 0110100111 */ V(1, 0, 3),
+  /* 0110101000 */ V(1, 0, 3),
+  /* 0110101001 */ V(1, 0, 3),
+  /* 0110101010 */ V(1, 0, 3),
+  /* 0110101011 */ V(1, 0, 3),
+  /* 0110101100 */ V(1, 0, 3),
+  /* 0110101101 */ V(1, 0, 3),
+  /* 0110101110 */ V(1, 0, 3),
+  /* 0110101111 */ V(1, 0, 3),
+  /* 0110110000 */ V(1, 0, 3),
+  /* 0110110001 */ V(1, 0, 3),
+  /* 0110110010 */ V(1, 0, 3),
+  /* 0110110011 */ V(1, 0, 3),
+  /* 0110110100 */ V(1, 0, 3),
+  /* 0110110101 */ V(1, 0, 3),
+  /* 0110110110 */ V(1, 0, 3),
+  /* 0110110111 */ V(1, 0, 3),
+  /* 0110111000 */ V(1, 0, 3),
+  /* 0110111001 */ V(1, 0, 3),
+  /* 0110111010 */ V(1, 0, 3),
+  /* 0110111011 */ V(1, 0, 3),
+  /* 0110111100 */ V(1, 0, 3),
+  /* 0110111101 */ V(1, 0, 3),
+  /* 0110111110 */ V(1, 0, 3),
+  /* 0110111111 */ V(1, 0, 3),
+  /* 0111000000 */ V(1, 0, 3),
+  /* 0111000001 */ V(1, 0, 3),
+  /* 0111000010 */ V(1, 0, 3),
+  /* 0111000011 */ V(1, 0, 3),
+  /* 0111000100 */ V(1, 0, 3),
+  /* 0111000101 */ V(1, 0, 3),
+  /* 0111000110 */ V(1, 0, 3),
+  /* 0111000111 */ V(1, 0, 3),
+  /* 0111001000 */ V(1, 0, 3),
+  /* 0111001001 */ V(1, 0, 3),
+  /* 0111001010 */ V(1, 0, 3),
+  /* 0111001011 */ V(1, 0, 3),
+  /* 0111001100 */ V(1, 0, 3),
+  /* 0111001101 */ V(1, 0, 3),
+  /* 0111001110 */ V(1, 0, 3),
+  /* 0111001111 */ V(1, 0, 3),
+  /* 0111010000 */ V(1, 0, 3),
+  /* 0111010001 */ V(1, 0, 3),
+  /* 0111010010 */ V(1, 0, 3),
+  /* 0111010011 */ V(1, 0, 3),
+  /* 0111010100 */ V(1, 0, 3),
+  /* 0111010101 */ V(1, 0, 3),
+  /* 0111010110 */ V(1, 0, 3),
+  /* 0111010111 */ V(1, 0, 3),
+  /* 0111011000 */ V(1, 0, 3),
+  /* 0111011001 */ V(1, 0, 3),
+  /* 0111011010 */ V(1, 0, 3),
+  /* 0111011011 */ V(1, 0, 3),
+  /* 0111011100 */ V(1, 0, 3),
+  /* 0111011101 */ V(1, 0, 3),
+  /* 0111011110 */ V(1, 0, 3),
+  /* 0111011111 */ V(1, 0, 3),
+  /* 0111100000 */ V(1, 0, 3),
+  /* 0111100001 */ V(1, 0, 3),
+  /* 0111100010 */ V(1, 0, 3),
+  /* 0111100011 */ V(1, 0, 3),
+  /* 0111100100 */ V(1, 0, 3),
+  /* 0111100101 */ V(1, 0, 3),
+  /* 0111100110 */ V(1, 0, 3),
+  /* 0111100111 */ V(1, 0, 3),
+  /* 0111101000 */ V(1, 0, 3),
+  /* 0111101001 */ V(1, 0, 3),
+  /* 0111101010 */ V(1, 0, 3),
+  /* 0111101011 */ V(1, 0, 3),
+  /* 0111101100 */ V(1, 0, 3),
+  /* 0111101101 */ V(1, 0, 3),
+  /* 0111101110 */ V(1, 0, 3),
+  /* 0111101111 */ V(1, 0, 3),
+  /* 0111110000 */ V(1, 0, 3),
+  /* 0111110001 */ V(1, 0, 3),
+  /* 0111110010 */ V(1, 0, 3),
+  /* 0111110011 */ V(1, 0, 3),
+  /* 0111110100 */ V(1, 0, 3),
+  /* 0111110101 */ V(1, 0, 3),
+  /* 0111110110 */ V(1, 0, 3),
+  /* 0111110111 */ V(1, 0, 3),
+  /* 0111111000 */ V(1, 0, 3),
+  /* 0111111001 */ V(1, 0, 3),
+  /* 0111111010 */ V(1, 0, 3),
+  /* 0111111011 */ V(1, 0, 3),
+  /* 0111111100 */ V(1, 0, 3),
+  /* 0111111101 */ V(1, 0, 3),
+  /* 0111111110 */ V(1, 0, 3),
+  /* 0111111111 */ V(1, 0, 3),
+  /* 1000000000 */ V(0, 0, 1),
+  /* 1000000001 */ V(0, 0, 1),
+  /* 1000000010 */ V(0, 0, 1),
+  /* 1000000011 */ V(0, 0, 1),
+  /* 1000000100 */ V(0, 0, 1),
+  /* 1000000101 */ V(0, 0, 1),
+  /* 1000000110 */ V(0, 0, 1),
+  /* 1000000111 */ V(0, 0, 1),
+  /* 1000001000 */ V(0, 0, 1),
+  /* 1000001001 */ V(0, 0, 1),
+  /* 1000001010 */ V(0, 0, 1),
+  /* 1000001011 */ V(0, 0, 1),
+  /* 1000001100 */ V(0, 0, 1),
+  /* 1000001101 */ V(0, 0, 1),
+  /* 1000001110 */ V(0, 0, 1),
+  /* 1000001111 */ V(0, 0, 1),
+  /* 1000010000 */ V(0, 0, 1),
+  /* 1000010001 */ V(0, 0, 1),
+  /* 1000010010 */ V(0, 0, 1),
+  /* 1000010011 */ V(0, 0, 1),
+  /* 1000010100 */ V(0, 0, 1),
+  /* 1000010101 */ V(0, 0, 1),
+  /* 1000010110 */ V(0, 0, 1),
+  /* 1000010111 */ V(0, 0, 1),
+  /* 1000011000 */ V(0, 0, 1),
+  /* 1000011001 */ V(0, 0, 1),
+  /* 1000011010 */ V(0, 0, 1),
+  /* 1000011011 */ V(0, 0, 1),
+  /* 1000011100 */ V(0, 0, 1),
+  /* 1000011101 */ V(0, 0, 1),
+  /* 1000011110 */ V(0, 0, 1),
+  /* 1000011111 */ V(0, 0, 1),
+  /* 1000100000 */ V(0, 0, 1),
+  /* 1000100001 */ V(0, 0, 1),
+  /* 1000100010 */ V(0, 0, 1),
+  /* 1000100011 */ V(0, 0, 1),
+  /* 1000100100 */ V(0, 0, 1),
+  /* 1000100101 */ V(0, 0, 1),
+  /* 1000100110 */ V(0, 0, 1),
+  /* 1000100111 */ V(0, 0, 1),
+  /* 1000101000 */ V(0, 0, 1),
+  /* 1000101001 */ V(0, 0, 1),
+  /* 1000101010 */ V(0, 0, 1),
+  /* 1000101011 */ V(0, 0, 1),
+  /* 1000101100 */ V(0, 0, 1),
+  /* 1000101101 */ V(0, 0, 1),
+  /* 1000101110 */ V(0, 0, 1),
+  /* 1000101111 */ V(0, 0, 1),
+  /* 1000110000 */ V(0, 0, 1),
+  /* 1000110001 */ V(0, 0, 1),
+  /* 1000110010 */ V(0, 0, 1),
+  /* 1000110011 */ V(0, 0, 1),
+  /* 1000110100 */ V(0, 0, 1),
+  /* 1000110101 */ V(0, 0, 1),
+  /* 1000110110 */ V(0, 0, 1),
+  /* 1000110111 */ V(0, 0, 1),
+  /* 1000111000 */ V(0, 0, 1),
+  /* 1000111001 */ V(0, 0, 1),
+  /* 1000111010 */ V(0, 0, 1),
+  /* 1000111011 */ V(0, 0, 1),
+  /* 1000111100 */ V(0, 0, 1),
+  /* 1000111101 */ V(0, 0, 1),
+  /* 1000111110 */ V(0, 0, 1),
+  /* 1000111111 */ V(0, 0, 1),
+  /* 1001000000 */ V(0, 0, 1),
+  /* 1001000001 */ V(0, 0, 1),
+  /* 1001000010 */ V(0, 0, 1),
+  /* 1001000011 */ V(0, 0, 1),
+  /* 1001000100 */ V(0, 0, 1),
+  /* 1001000101 */ V(0, 0, 1),
+  /* 1001000110 */ V(0, 0, 1),
+  /* 1001000111 */ V(0, 0, 1),
+  /* 1001001000 */ V(0, 0, 1),
+  /* 1001001001 */ V(0, 0, 1),
+  /* 1001001010 */ V(0, 0, 1),
+  /* 1001001011 */ V(0, 0, 1),
+  /* 1001001100 */ V(0, 0, 1),
+  /* 1001001101 */ V(0, 0, 1),
+  /* 1001001110 */ V(0, 0, 1),
+  /* 1001001111 */ V(0, 0, 1),
+  /* 1001010000 */ V(0, 0, 1),
+  /* 1001010001 */ V(0, 0, 1),
+  /* 1001010010 */ V(0, 0, 1),
+  /* 1001010011 */ V(0, 0, 1),
+  /* 1001010100 */ V(0, 0, 1),
+  /* 1001010101 */ V(0, 0, 1),
+  /* 1001010110 */ V(0, 0, 1),
+  /* 1001010111 */ V(0, 0, 1),
+  /* 1001011000 */ V(0, 0, 1),
+  /* 1001011001 */ V(0, 0, 1),
+  /* 1001011010 */ V(0, 0, 1),
+  /* 1001011011 */ V(0, 0, 1),
+  /* 1001011100 */ V(0, 0, 1),
+  /* 1001011101 */ V(0, 0, 1),
+  /* 1001011110 */ V(0, 0, 1),
+  /* 1001011111 */ V(0, 0, 1),
+  /* 1001100000 */ V(0, 0, 1),
+  /* 1001100001 */ V(0, 0, 1),
+  /* 1001100010 */ V(0, 0, 1),
+  /* 1001100011 */ V(0, 0, 1),
+  /* 1001100100 */ V(0, 0, 1),
+  /* 1001100101 */ V(0, 0, 1),
+  /* 1001100110 */ V(0, 0, 1),
+  /* 1001100111 */ V(0, 0, 1),
+  /* 1001101000 */ V(0, 0, 1),
+  /* 1001101001 */ V(0, 0, 1),
+  /* 1001101010 */ V(0, 0, 1),
+  /* 1001101011 */ V(0, 0, 1),
+  /* 1001101100 */ V(0, 0, 1),
+  /* 1001101101 */ V(0, 0, 1),
+  /* 1001101110 */ V(0, 0, 1),
+  /* 1001101111 */ V(0, 0, 1),
+  /* 1001110000 */ V(0, 0, 1),
+  /* 1001110001 */ V(0, 0, 1),
+  /* 1001110010 */ V(0, 0, 1),
+  /* 1001110011 */ V(0, 0, 1),
+  /* 1001110100 */ V(0, 0, 1),
+  /* 1001110101 */ V(0, 0, 1),
+  /* 1001110110 */ V(0, 0, 1),
+  /* 1001110111 */ V(0, 0, 1),
+  /* 1001111000 */ V(0, 0, 1),
+  /* 1001111001 */ V(0, 0, 1),
+  /* 1001111010 */ V(0, 0, 1),
+  /* 1001111011 */ V(0, 0, 1),
+  /* 1001111100 */ V(0, 0, 1),
+  /* 1001111101 */ V(0, 0, 1),
+  /* 1001111110 */ V(0, 0, 1),
+  /* 1001111111 */ V(0, 0, 1),
+  /* 1010000000 */ V(0, 0, 1),
+  /* 1010000001 */ V(0, 0, 1),
+  /* 1010000010 */ V(0, 0, 1),
+  /* 1010000011 */ V(0, 0, 1),
+  /* 1010000100 */ V(0, 0, 1),
+  /* 1010000101 */ V(0, 0, 1),
+  /* 1010000110 */ V(0, 0, 1),
+  /* 1010000111 */ V(0, 0, 1),
+  /* 1010001000 */ V(0, 0, 1),
+  /* 1010001001 */ V(0, 0, 1),
+  /* 1010001010 */ V(0, 0, 1),
+  /* 1010001011 */ V(0, 0, 1),
+  /* 1010001100 */ V(0, 0, 1),
+  /* 1010001101 */ V(0, 0, 1),
+  /* 1010001110 */ V(0, 0, 1),
+  /* 1010001111 */ V(0, 0, 1),
+  /* 1010010000 */ V(0, 0, 1),
+  /* 1010010001 */ V(0, 0, 1),
+  /* 1010010010 */ V(0, 0, 1),
+  /* 1010010011 */ V(0, 0, 1),
+  /* 1010010100 */ V(0, 0, 1),
+  /* 1010010101 */ V(0, 0, 1),
+  /* 1010010110 */ V(0, 0, 1),
+  /* 1010010111 */ V(0, 0, 1),
+  /* 1010011000 */ V(0, 0, 1),
+  /* 1010011001 */ V(0, 0, 1),
+  /* 1010011010 */ V(0, 0, 1),
+  /* 1010011011 */ V(0, 0, 1),
+  /* 1010011100 */ V(0, 0, 1),
+  /* 1010011101 */ V(0, 0, 1),
+  /* 1010011110 */ V(0, 0, 1),
+  /* 1010011111 */ V(0, 0, 1),
+  /* 1010100000 */ V(0, 0, 1),
+  /* 1010100001 */ V(0, 0, 1),
+  /* 1010100010 */ V(0, 0, 1),
+  /* 1010100011 */ V(0, 0, 1),
+  /* 1010100100 */ V(0, 0, 1),
+  /* 1010100101 */ V(0, 0, 1),
+  /* 1010100110 */ V(0, 0, 1),
+  /* 1010100111 */ V(0, 0, 1),
+  /* 1010101000 */ V(0, 0, 1),
+  /* 1010101001 */ V(0, 0, 1),
+  /* 1010101010 */ V(0, 0, 1),
+  /* 1010101011 */ V(0, 0, 1),
+  /* 1010101100 */ V(0, 0, 1),
+  /* 1010101101 */ V(0, 0, 1),
+  /* 1010101110 */ V(0, 0, 1),
+  /* 1010101111 */ V(0, 0, 1),
+  /* 1010110000 */ V(0, 0, 1),
+  /* 1010110001 */ V(0, 0, 1),
+  /* 1010110010 */ V(0, 0, 1),
+  /* 1010110011 */ V(0, 0, 1),
+  /* 1010110100 */ V(0, 0, 1),
+  /* 1010110101 */ V(0, 0, 1),
+  /* 1010110110 */ V(0, 0, 1),
+  /* 1010110111 */ V(0, 0, 1),
+  /* 1010111000 */ V(0, 0, 1),
+  /* 1010111001 */ V(0, 0, 1),
+  /* 1010111010 */ V(0, 0, 1),
+  /* 1010111011 */ V(0, 0, 1),
+  /* 1010111100 */ V(0, 0, 1),
+  /* 1010111101 */ V(0, 0, 1),
+  /* 1010111110 */ V(0, 0, 1),
+  /* 1010111111 */ V(0, 0, 1),
+  /* 1011000000 */ V(0, 0, 1),
+  /* 1011000001 */ V(0, 0, 1),
+  /* 1011000010 */ V(0, 0, 1),
+  /* 1011000011 */ V(0, 0, 1),
+  /* 1011000100 */ V(0, 0, 1),
+  /* 1011000101 */ V(0, 0, 1),
+  /* 1011000110 */ V(0, 0, 1),
+  /* 1011000111 */ V(0, 0, 1),
+  /* 1011001000 */ V(0, 0, 1),
+  /* 1011001001 */ V(0, 0, 1),
+  /* 1011001010 */ V(0, 0, 1),
+  /* 1011001011 */ V(0, 0, 1),
+  /* 1011001100 */ V(0, 0, 1),
+  /* 1011001101 */ V(0, 0, 1),
+  /* 1011001110 */ V(0, 0, 1),
+  /* 1011001111 */ V(0, 0, 1),
+  /* 1011010000 */ V(0, 0, 1),
+  /* 1011010001 */ V(0, 0, 1),
+  /* 1011010010 */ V(0, 0, 1),
+  /* 1011010011 */ V(0, 0, 1),
+  /* 1011010100 */ V(0, 0, 1),
+  /* 1011010101 */ V(0, 0, 1),
+  /* 1011010110 */ V(0, 0, 1),
+  /* 1011010111 */ V(0, 0, 1),
+  /* 1011011000 */ V(0, 0, 1),
+  /* 1011011001 */ V(0, 0, 1),
+  /* 1011011010 */ V(0, 0, 1),
+  /* 1011011011 */ V(0, 0, 1),
+  /* 1011011100 */ V(0, 0, 1),
+  /* 1011011101 */ V(0, 0, 1),
+  /* 1011011110 */ V(0, 0, 1),
+  /* 1011011111 */ V(0, 0, 1),
+  /* 1011100000 */ V(0, 0, 1),
+  /* 1011100001 */ V(0, 0, 1),
+  /* 1011100010 */ V(0, 0, 1),
+  /* 1011100011 */ V(0, 0, 1),
+  /* 1011100100 */ V(0, 0, 1),
+  /* 1011100101 */ V(0, 0, 1),
+  /* 1011100110 */ V(0, 0, 1),
+  /* 1011100111 */ V(0, 0, 1),
+  /* 1011101000 */ V(0, 0, 1),
+  /* 1011101001 */ V(0, 0, 1),
+  /* 1011101010 */ V(0, 0, 1),
+  /* 1011101011 */ V(0, 0, 1),
+  /* 1011101100 */ V(0, 0, 1),
+  /* 1011101101 */ V(0, 0, 1),
+  /* 1011101110 */ V(0, 0, 1),
+  /* 1011101111 */ V(0, 0, 1),
+  /* 1011110000 */ V(0, 0, 1),
+  /* 1011110001 */ V(0, 0, 1),
+  /* 1011110010 */ V(0, 0, 1),
+  /* 1011110011 */ V(0, 0, 1),
+  /* 1011110100 */ V(0, 0, 1),
+  /* 1011110101 */ V(0, 0, 1),
+  /* 1011110110 */ V(0, 0, 1),
+  /* 1011110111 */ V(0, 0, 1),
+  /* 1011111000 */ V(0, 0, 1),
+  /* 1011111001 */ V(0, 0, 1),
+  /* 1011111010 */ V(0, 0, 1),
+  /* 1011111011 */ V(0, 0, 1),
+  /* 1011111100 */ V(0, 0, 1),
+  /* 1011111101 */ V(0, 0, 1),
+  /* 1011111110 */ V(0, 0, 1),
+  /* 1011111111 */ V(0, 0, 1),
+  /* 1100000000 */ V(0, 0, 1),
+  /* 1100000001 */ V(0, 0, 1),
+  /* 1100000010 */ V(0, 0, 1),
+  /* 1100000011 */ V(0, 0, 1),
+  /* 1100000100 */ V(0, 0, 1),
+  /* 1100000101 */ V(0, 0, 1),
+  /* 1100000110 */ V(0, 0, 1),
+  /* 1100000111 */ V(0, 0, 1),
+  /* 1100001000 */ V(0, 0, 1),
+  /* 1100001001 */ V(0, 0, 1),
+  /* 1100001010 */ V(0, 0, 1),
+  /* 1100001011 */ V(0, 0, 1),
+  /* 1100001100 */ V(0, 0, 1),
+  /* 1100001101 */ V(0, 0, 1),
+  /* 1100001110 */ V(0, 0, 1),
+  /* 1100001111 */ V(0, 0, 1),
+  /* 1100010000 */ V(0, 0, 1),
+  /* 1100010001 */ V(0, 0, 1),
+  /* 1100010010 */ V(0, 0, 1),
+  /* 1100010011 */ V(0, 0, 1),
+  /* 1100010100 */ V(0, 0, 1),
+  /* 1100010101 */ V(0, 0, 1),
+  /* 1100010110 */ V(0, 0, 1),
+  /* 1100010111 */ V(0, 0, 1),
+  /* 1100011000 */ V(0, 0, 1),
+  /* 1100011001 */ V(0, 0, 1),
+  /* 1100011010 */ V(0, 0, 1),
+  /* 1100011011 */ V(0, 0, 1),
+  /* 1100011100 */ V(0, 0, 1),
+  /* 1100011101 */ V(0, 0, 1),
+  /* 1100011110 */ V(0, 0, 1),
+  /* 1100011111 */ V(0, 0, 1),
+  /* 1100100000 */ V(0, 0, 1),
+  /* 1100100001 */ V(0, 0, 1),
+  /* 1100100010 */ V(0, 0, 1),
+  /* 1100100011 */ V(0, 0, 1),
+  /* 1100100100 */ V(0, 0, 1),
+  /* 1100100101 */ V(0, 0, 1),
+  /* 1100100110 */ V(0, 0, 1),
+  /* 1100100111 */ V(0, 0, 1),
+  /* 1100101000 */ V(0, 0, 1),
+  /* 1100101001 */ V(0, 0, 1),
+  /* 1100101010 */ V(0, 0, 1),
+  /* 1100101011 */ V(0, 0, 1),
+  /* 1100101100 */ V(0, 0, 1),
+  /* 1100101101 */ V(0, 0, 1),
+  /* 1100101110 */ V(0, 0, 1),
+  /* 1100101111 */ V(0, 0, 1),
+  /* 1100110000 */ V(0, 0, 1),
+  /* 1100110001 */ V(0, 0, 1),
+  /* 1100110010 */ V(0, 0, 1),
+  /* 1100110011 */ V(0, 0, 1),
+  /* 1100110100 */ V(0, 0, 1),
+  /* 1100110101 */ V(0, 0, 1),
+  /* 1100110110 */ V(0, 0, 1),
+  /* 1100110111 */ V(0, 0, 1),
+  /* 1100111000 */ V(0, 0, 1),
+  /* 1100111001 */ V(0, 0, 1),
+  /* 1100111010 */ V(0, 0, 1),
+  /* 1100111011 */ V(0, 0, 1),
+  /* 1100111100 */ V(0, 0, 1),
+  /* 1100111101 */ V(0, 0, 1),
+  /* 1100111110 */ V(0, 0, 1),
+  /* 1100111111 */ V(0, 0, 1),
+  /* 1101000000 */ V(0, 0, 1),
+  /* 1101000001 */ V(0, 0, 1),
+  /* 1101000010 */ V(0, 0, 1),
+  /* 1101000011 */ V(0, 0, 1),
+  /* 1101000100 */ V(0, 0, 1),
+  /* 1101000101 */ V(0, 0, 1),
+  /* 1101000110 */ V(0, 0, 1),
+  /* 1101000111 */ V(0, 0, 1),
+  /* 1101001000 */ V(0, 0, 1),
+  /* 1101001001 */ V(0, 0, 1),
+  /* 1101001010 */ V(0, 0, 1),
+  /* 1101001011 */ V(0, 0, 1),
+  /* 1101001100 */ V(0, 0, 1),
+  /* 1101001101 */ V(0, 0, 1),
+  /* 1101001110 */ V(0, 0, 1),
+  /* 1101001111 */ V(0, 0, 1),
+  /* 1101010000 */ V(0, 0, 1),
+  /* 1101010001 */ V(0, 0, 1),
+  /* 1101010010 */ V(0, 0, 1),
+  /* 1101010011 */ V(0, 0, 1),
+  /* 1101010100 */ V(0, 0, 1),
+  /* 1101010101 */ V(0, 0, 1),
+  /* 1101010110 */ V(0, 0, 1),
+  /* 1101010111 */ V(0, 0, 1),
+  /* 1101011000 */ V(0, 0, 1),
+  /* 1101011001 */ V(0, 0, 1),
+  /* 1101011010 */ V(0, 0, 1),
+  /* 1101011011 */ V(0, 0, 1),
+  /* 1101011100 */ V(0, 0, 1),
+  /* 1101011101 */ V(0, 0, 1),
+  /* 1101011110 */ V(0, 0, 1),
+  /* 1101011111 */ V(0, 0, 1),
+  /* 1101100000 */ V(0, 0, 1),
+  /* 1101100001 */ V(0, 0, 1),
+  /* 1101100010 */ V(0, 0, 1),
+  /* 1101100011 */ V(0, 0, 1),
+  /* 1101100100 */ V(0, 0, 1),
+  /* 1101100101 */ V(0, 0, 1),
+  /* 1101100110 */ V(0, 0, 1),
+  /* 1101100111 */ V(0, 0, 1),
+  /* 1101101000 */ V(0, 0, 1),
+  /* 1101101001 */ V(0, 0, 1),
+  /* 1101101010 */ V(0, 0, 1),
+  /* 1101101011 */ V(0, 0, 1),
+  /* 1101101100 */ V(0, 0, 1),
+  /* 1101101101 */ V(0, 0, 1),
+  /* 1101101110 */ V(0, 0, 1),
+  /* 1101101111 */ V(0, 0, 1),
+  /* 1101110000 */ V(0, 0, 1),
+  /* 1101110001 */ V(0, 0, 1),
+  /* 1101110010 */ V(0, 0, 1),
+  /* 1101110011 */ V(0, 0, 1),
+  /* 1101110100 */ V(0, 0, 1),
+  /* 1101110101 */ V(0, 0, 1),
+  /* 1101110110 */ V(0, 0, 1),
+  /* 1101110111 */ V(0, 0, 1),
+  /* 1101111000 */ V(0, 0, 1),
+  /* 1101111001 */ V(0, 0, 1),
+  /* 1101111010 */ V(0, 0, 1),
+  /* 1101111011 */ V(0, 0, 1),
+  /* 1101111100 */ V(0, 0, 1),
+  /* 1101111101 */ V(0, 0, 1),
+  /* 1101111110 */ V(0, 0, 1),
+  /* 1101111111 */ V(0, 0, 1),
+  /* 1110000000 */ V(0, 0, 1),
+  /* 1110000001 */ V(0, 0, 1),
+  /* 1110000010 */ V(0, 0, 1),
+  /* 1110000011 */ V(0, 0, 1),
+  /* 1110000100 */ V(0, 0, 1),
+  /* 1110000101 */ V(0, 0, 1),
+  /* 1110000110 */ V(0, 0, 1),
+  /* 1110000111 */ V(0, 0, 1),
+  /* 1110001000 */ V(0, 0, 1),
+  /* 1110001001 */ V(0, 0, 1),
+  /* 1110001010 */ V(0, 0, 1),
+  /* 1110001011 */ V(0, 0, 1),
+  /* 1110001100 */ V(0, 0, 1),
+  /* 1110001101 */ V(0, 0, 1),
+  /* 1110001110 */ V(0, 0, 1),
+  /* 1110001111 */ V(0, 0, 1),
+  /* 1110010000 */ V(0, 0, 1),
+  /* 1110010001 */ V(0, 0, 1),
+  /* 1110010010 */ V(0, 0, 1),
+  /* 1110010011 */ V(0, 0, 1),
+  /* 1110010100 */ V(0, 0, 1),
+  /* 1110010101 */ V(0, 0, 1),
+  /* 1110010110 */ V(0, 0, 1),
+  /* 1110010111 */ V(0, 0, 1),
+  /* 1110011000 */ V(0, 0, 1),
+  /* 1110011001 */ V(0, 0, 1),
+  /* 1110011010 */ V(0, 0, 1),
+  /* 1110011011 */ V(0, 0, 1),
+  /* 1110011100 */ V(0, 0, 1),
+  /* 1110011101 */ V(0, 0, 1),
+  /* 1110011110 */ V(0, 0, 1),
+  /* 1110011111 */ V(0, 0, 1),
+  /* 1110100000 */ V(0, 0, 1),
+  /* 1110100001 */ V(0, 0, 1),
+  /* 1110100010 */ V(0, 0, 1),
+  /* 1110100011 */ V(0, 0, 1),
+  /* 1110100100 */ V(0, 0, 1),
+  /* 1110100101 */ V(0, 0, 1),
+  /* 1110100110 */ V(0, 0, 1),
+  /* 1110100111 */ V(0, 0, 1),
+  /* 1110101000 */ V(0, 0, 1),
+  /* 1110101001 */ V(0, 0, 1),
+  /* 1110101010 */ V(0, 0, 1),
+  /* 1110101011 */ V(0, 0, 1),
+  /* 1110101100 */ V(0, 0, 1),
+  /* 1110101101 */ V(0, 0, 1),
+  /* 1110101110 */ V(0, 0, 1),
+  /* 1110101111 */ V(0, 0, 1),
+  /* 1110110000 */ V(0, 0, 1),
+  /* 1110110001 */ V(0, 0, 1),
+  /* 1110110010 */ V(0, 0, 1),
+  /* 1110110011 */ V(0, 0, 1),
+  /* 1110110100 */ V(0, 0, 1),
+  /* 1110110101 */ V(0, 0, 1),
+  /* 1110110110 */ V(0, 0, 1),
+  /* 1110110111 */ V(0, 0, 1),
+  /* 1110111000 */ V(0, 0, 1),
+  /* 1110111001 */ V(0, 0, 1),
+  /* 1110111010 */ V(0, 0, 1),
+  /* 1110111011 */ V(0, 0, 1),
+  /* 1110111100 */ V(0, 0, 1),
+  /* 1110111101 */ V(0, 0, 1),
+  /* 1110111110 */ V(0, 0, 1),
+  /* 1110111111 */ V(0, 0, 1),
+  /* 1111000000 */ V(0, 0, 1),
+  /* 1111000001 */ V(0, 0, 1),
+  /* 1111000010 */ V(0, 0, 1),
+  /* 1111000011 */ V(0, 0, 1),
+  /* 1111000100 */ V(0, 0, 1),
+  /* 1111000101 */ V(0, 0, 1),
+  /* 1111000110 */ V(0, 0, 1),
+  /* 1111000111 */ V(0, 0, 1),
+  /* 1111001000 */ V(0, 0, 1),
+  /* 1111001001 */ V(0, 0, 1),
+  /* 1111001010 */ V(0, 0, 1),
+  /* 1111001011 */ V(0, 0, 1),
+  /* 1111001100 */ V(0, 0, 1),
+  /* 1111001101 */ V(0, 0, 1),
+  /* 1111001110 */ V(0, 0, 1),
+  /* 1111001111 */ V(0, 0, 1),
+  /* 1111010000 */ V(0, 0, 1),
+  /* 1111010001 */ V(0, 0, 1),
+  /* 1111010010 */ V(0, 0, 1),
+  /* 1111010011 */ V(0, 0, 1),
+  /* 1111010100 */ V(0, 0, 1),
+  /* 1111010101 */ V(0, 0, 1),
+  /* 1111010110 */ V(0, 0, 1),
+  /* 1111010111 */ V(0, 0, 1),
+  /* 1111011000 */ V(0, 0, 1),
+  /* 1111011001 */ V(0, 0, 1),
+  /* 1111011010 */ V(0, 0, 1),
+  /* 1111011011 */ V(0, 0, 1),
+  /* 1111011100 */ V(0, 0, 1),
+  /* 1111011101 */ V(0, 0, 1),
+  /* 1111011110 */ V(0, 0, 1),
+  /* 1111011111 */ V(0, 0, 1),
+  /* 1111100000 */ V(0, 0, 1),
+  /* 1111100001 */ V(0, 0, 1),
+  /* 1111100010 */ V(0, 0, 1),
+  /* 1111100011 */ V(0, 0, 1),
+  /* 1111100100 */ V(0, 0, 1),
+  /* 1111100101 */ V(0, 0, 1),
+  /* 1111100110 */ V(0, 0, 1),
+  /* 1111100111 */ V(0, 0, 1),
+  /* 1111101000 */ V(0, 0, 1),
+  /* 1111101001 */ V(0, 0, 1),
+  /* 1111101010 */ V(0, 0, 1),
+  /* 1111101011 */ V(0, 0, 1),
+  /* 1111101100 */ V(0, 0, 1),
+  /* 1111101101 */ V(0, 0, 1),
+  /* 1111101110 */ V(0, 0, 1),
+  /* 1111101111 */ V(0, 0, 1),
+  /* 1111110000 */ V(0, 0, 1),
+  /* 1111110001 */ V(0, 0, 1),
+  /* 1111110010 */ V(0, 0, 1),
+  /* 1111110011 */ V(0, 0, 1),
+  /* 1111110100 */ V(0, 0, 1),
+  /* 1111110101 */ V(0, 0, 1),
+  /* 1111110110 */ V(0, 0, 1),
+  /* 1111110111 */ V(0, 0, 1),
+  /* 1111111000 */ V(0, 0, 1),
+  /* 1111111001 */ V(0, 0, 1),
+  /* 1111111010 */ V(0, 0, 1),
+  /* 1111111011 */ V(0, 0, 1),
+  /* 1111111100 */ V(0, 0, 1),
+  /* 1111111101 */ V(0, 0, 1),
+  /* 1111111110 */ V(0, 0, 1),
+  /* 1111111111 */ V(0, 0, 1),
+
+  /* 0000 0000 00 ... */
+  /* 0    */ V(14, 15, 1),	/* 1024 */
+  /* 1    */ V(15, 14, 1),
+
+  /* 0000 0000 01 ... */
+  /* 0    */ V(13, 15, 1),	/* 1026 */
+  /* 1    */ V(15, 13, 1),
+
+  /* 0000 0000 10 ... */
+  /* 0    */ V(12, 15, 1),	/* 1028 */
+  /* 1    */ V(15, 12, 1),
+
+  /* 0000 0000 11 ... */
+  /* 0    */ V(11, 15, 1),	/* 1030 */
+  /* 1    */ V(15, 11, 1),
+
+  /* 0000 0001 01 ... */
+  /* 0    */ V(15, 10, 1),	/* 1032 */
+  /* 1    */ V(9, 15, 1),
+
+  /* 0000 0001 10 ... */
+  /* 0    */ V(15, 9, 1),	/* 1034 */
+  /* 1    */ V(15, 8, 1),
+
+  /* 0000 0110 11 ... */
+  /* 000000 */ V(12, 14, 6),	/* 1036 */
+  /* 000001 */ PTR(1100, 1),
+  /* 000010 */ V(13, 14, 5),
+  /* 000011 */ V(13, 14, 5),
+  /* 000100 */ V(14, 9, 5),
+  /* 000101 */ V(14, 9, 5),
+  /* 000110 */ V(14, 10, 6),
+  /* 000111 */ V(13, 9, 6),
+  /* 001000 */ V(14, 14, 4),
+  /* 001001 */ V(14, 14, 4),
+  /* 001010 */ V(14, 14, 4),
+  /* 001011 */ V(14, 14, 4),
+  /* 001100 */ V(14, 13, 5),
+  /* 001101 */ V(14, 13, 5),
+  /* 001110 */ V(14, 11, 5),
+  /* 001111 */ V(14, 11, 5),
+  /* 010000 */ V(11, 14, 4),
+  /* 010001 */ V(11, 14, 4),
+  /* 010010 */ V(11, 14, 4),
+  /* 010011 */ V(11, 14, 4),
+  /* 010100 */ V(12, 13, 4),
+  /* 010101 */ V(12, 13, 4),
+  /* 010110 */ V(12, 13, 4),
+  /* 010111 */ V(12, 13, 4),
+  /* 011000 */ V(13, 12, 5),
+  /* 011001 */ V(13, 12, 5),
+  /* 011010 */ V(13, 11, 5),
+  /* 011011 */ V(13, 11, 5),
+  /* 011100 */ V(10, 14, 4),
+  /* 011101 */ V(10, 14, 4),
+  /* 011110 */ V(10, 14, 4),
+  /* 011111 */ V(10, 14, 4),
+  /* 100000 */ V(12, 12, 4),
+  /* 100001 */ V(12, 12, 4),
+  /* 100010 */ V(12, 12, 4),
+  /* 100011 */ V(12, 12, 4),
+  /* 100100 */ V(10, 13, 5),
+  /* 100101 */ V(10, 13, 5),
+  /* 100110 */ V(13, 10, 5),
+  /* 100111 */ V(13, 10, 5),
+  /* 101000 */ V(7, 14, 5),
+  /* 101001 */ V(7, 14, 5),
+  /* 101010 */ V(10, 12, 5),
+  /* 101011 */ V(10, 12, 5),
+  /* 101100 */ V(12, 10, 4),
+  /* 101101 */ V(12, 10, 4),
+  /* 101110 */ V(12, 10, 4),
+  /* 101111 */ V(12, 10, 4),
+  /* 110000 */ V(12, 9, 5),
+  /* 110001 */ V(12, 9, 5),
+  /* 110010 */ V(7, 13, 5),
+  /* 110011 */ V(7, 13, 5),
+  /* 110100 */ V(5, 14, 4),
+  /* 110101 */ V(5, 14, 4),
+  /* 110110 */ V(5, 14, 4),
+  /* 110111 */ V(5, 14, 4),
+  /* 111000 */ V(11, 13, 3),
+  /* 111001 */ V(11, 13, 3),
+  /* 111010 */ V(11, 13, 3),
+  /* 111011 */ V(11, 13, 3),
+  /* 111100 */ V(11, 13, 3),
+  /* 111101 */ V(11, 13, 3),
+  /* 111110 */ V(11, 13, 3),
+  /* 111111 */ V(11, 13, 3),
 
-  /* 0000 1100 1011 ... */
-  /* 0    */ V(9, 8, 1),	/* 396 */
-  /* 1    */ V(7, 9, 1),
+  /* 0000 0110 1100 0001 ... */
+  /* 0    */ V(14, 12, 1),	/* 1100 */
+  /* 1    */ V(13, 13, 1),
+
+  /* 0000 1011 00 ... */
+  /* 0000 */ V(9, 14, 3),	/* 1102 */
+  /* 0001 */ V(9, 14, 3),
+  /* 0010 */ V(11, 12, 4),
+  /* 0011 */ V(12, 11, 4),
+  /* 0100 */ V(8, 14, 4),
+  /* 0101 */ V(14, 8, 4),
+  /* 0110 */ V(9, 13, 4),
+  /* 0111 */ V(14, 7, 4),
+  /* 1000 */ V(11, 11, 4),
+  /* 1001 */ V(8, 13, 4),
+  /* 1010 */ V(13, 8, 4),
+  /* 1011 */ V(6, 14, 4),
+  /* 1100 */ V(14, 6, 3),
+  /* 1101 */ V(14, 6, 3),
+  /* 1110 */ V(9, 12, 3),
+  /* 1111 */ V(9, 12, 3),
+
+  /* 0000 1011 01 ... */
+  /* 0000 */ V(10, 11, 4),	/* 1118 */
+  /* 0001 */ V(11, 10, 4),
+  /* 0010 */ V(14, 5, 4),
+  /* 0011 */ V(13, 7, 4),
+  /* 0100 */ V(4, 14, 3),
+  /* 0101 */ V(4, 14, 3),
+  /* 0110 */ V(14, 4, 4),
+  /* 0111 */ V(8, 12, 4),
+  /* 1000 */ V(12, 8, 3),
+  /* 1001 */ V(12, 8, 3),
+  /* 1010 */ V(3, 14, 3),
+  /* 1011 */ V(3, 14, 3),
+  /* 1100 */ V(6, 13, 3),
+  /* 1101 */ V(6, 13, 3),
+  /* 1110 */ V(13, 6, 4),
+  /* 1111 */ V(9, 11, 4),
+
+  /* 0000 1011 10 ... */
+  /* 0000 */ V(11, 9, 4),	/* 1134 */
+  /* 0001 */ V(10, 10, 4),
+  /* 0010 */ V(14, 1, 3),
+  /* 0011 */ V(14, 1, 3),
+  /* 0100 */ V(13, 4, 3),
+  /* 0101 */ V(13, 4, 3),
+  /* 0110 */ V(11, 8, 4),
+  /* 0111 */ V(10, 9, 4),
+  /* 1000 */ V(7, 11, 3),
+  /* 1001 */ V(7, 11, 3),
+  /* 1010 */ V(11, 7, 4),
+  /* 1011 */ V(13, 0, 4),
+  /* 1100 */ V(14, 3, 2),
+  /* 1101 */ V(14, 3, 2),
+  /* 1110 */ V(14, 3, 2),
+  /* 1111 */ V(14, 3, 2),
+
+  /* 0000 1011 11 ... */
+  /* 000  */ V(0, 14, 3),	/* 1150 */
+  /* 001  */ V(14, 0, 3),
+  /* 010  */ V(5, 13, 3),
+  /* 011  */ V(13, 5, 3),
+  /* 100  */ V(7, 12, 3),
+  /* 101  */ V(12, 7, 3),
+  /* 110  */ V(4, 13, 3),
+  /* 111  */ V(8, 11, 3),
+
+  /* 0000 1100 00 ... */
+  /* 000  */ V(9, 10, 3),	/* 1158 */
+  /* 001  */ V(6, 12, 3),
+  /* 010  */ V(12, 6, 3),
+  /* 011  */ V(3, 13, 3),
+  /* 100  */ V(5, 12, 3),
+  /* 101  */ V(12, 5, 3),
+  /* 110  */ V(0, 13, 2),
+  /* 111  */ V(0, 13, 2),
+
+  /* 0000 1100 01 ... */
+  /* 000  */ V(8, 10, 3),	/* 1166 */
+  /* 001  */ V(10, 8, 3),
+  /* 010  */ V(9, 9, 3),
+  /* 011  */ V(4, 12, 3),
+  /* 100  */ V(11, 6, 3),
+  /* 101  */ V(7, 10, 3),
+  /* 110  */ V(3, 12, 2),
+  /* 111  */ V(3, 12, 2),
 
-  /* 0000 1101 0101 ... */
-  /* 0    */ V(9, 7, 1),	/* 398 */
-  /* 1    */ V(8, 8, 1),
+  /* 0000 1100 10 ... */
+  /* 000  */ V(5, 11, 3),	/* 1174 */
+  /* 001  */ V(8, 9, 3),
+  /* 010  */ V(1, 12, 2),
+  /* 011  */ V(1, 12, 2),
+  /* 100  */ V(12, 0, 2),
+  /* 101  */ V(12, 0, 2),
+  /* 110  */ V(9, 8, 3),
+  /* 111  */ V(7, 9, 3),
+
+  /* 0000 1100 11 ... */
+  /* 00   */ V(14, 2, 1),	/* 1182 */
+  /* 01   */ V(14, 2, 1),
+  /* 10   */ V(2, 14, 2),
+  /* 11   */ V(1, 14, 2),
 
-  /* 0000 0110 1100 0001 ... */
-  /* 0    */ V(14, 12, 1),	/* 400 */
-  /* 1    */ V(13, 13, 1)
+  /* 0000 1101 00 ... */
+  /* 00   */ V(13, 3, 2),	/* 1186 */
+  /* 01   */ V(2, 13, 2),
+  /* 10   */ V(13, 2, 2),
+  /* 11   */ V(13, 1, 2),
+
+  /* 0000 1101 01 ... */
+  /* 000  */ V(3, 11, 2),	/* 1190 */
+  /* 001  */ V(3, 11, 2),
+  /* 010  */ V(9, 7, 3),
+  /* 011  */ V(8, 8, 3),
+  /* 100  */ V(1, 13, 1),
+  /* 101  */ V(1, 13, 1),
+  /* 110  */ V(1, 13, 1),
+  /* 111  */ V(1, 13, 1),
+
+  /* 0000 1101 10 ... */
+  /* 00   */ V(12, 4, 2),	/* 1198 */
+  /* 01   */ V(6, 11, 2),
+  /* 10   */ V(12, 3, 2),
+  /* 11   */ V(10, 7, 2),
+
+  /* 0000 1101 11 ... */
+  /* 00   */ V(2, 12, 1),	/* 1202 */
+  /* 01   */ V(2, 12, 1),
+  /* 10   */ V(12, 2, 2),
+  /* 11   */ V(11, 5, 2),
+
+  /* 0000 1110 00 ... */
+  /* 00   */ V(12, 1, 2),	/* 1206 */
+  /* 01   */ V(0, 12, 2),
+  /* 10   */ V(4, 11, 2),
+  /* 11   */ V(11, 4, 2),
+
+  /* 0000 1110 01 ... */
+  /* 00   */ V(6, 10, 2),	/* 1210 */
+  /* 01   */ V(10, 6, 2),
+  /* 10   */ V(11, 3, 1),
+  /* 11   */ V(11, 3, 1),
+
+  /* 0000 1110 10 ... */
+  /* 00   */ V(5, 10, 2),	/* 1214 */
+  /* 01   */ V(10, 5, 2),
+  /* 10   */ V(2, 11, 1),
+  /* 11   */ V(2, 11, 1),
+
+  /* 0000 1110 11 ... */
+  /* 0    */ V(11, 2, 1),	/* 1218 */
+  /* 1    */ V(1, 11, 1),
+
+  /* 0000 1111 00 ... */
+  /* 00   */ V(11, 1, 1),	/* 1220 */
+  /* 01   */ V(11, 1, 1),
+  /* 10   */ V(0, 11, 2),
+  /* 11   */ V(11, 0, 2),
+
+  /* 0000 1111 01 ... */
+  /* 00   */ V(6, 9, 2),	/* 1224 */
+  /* 01   */ V(9, 6, 2),
+  /* 10   */ V(4, 10, 2),
+  /* 11   */ V(10, 4, 2),
+
+  /* 0000 1111 10 ... */
+  /* 00   */ V(7, 8, 2),	/* 1228 */
+  /* 01   */ V(8, 7, 2),
+  /* 10   */ V(10, 3, 1),
+  /* 11   */ V(10, 3, 1),
+
+  /* 0000 1111 11 ... */
+  /* 00   */ V(3, 10, 2),	/* 1232 */
+  /* 01   */ V(5, 9, 2),
+  /* 10   */ V(2, 10, 1),
+  /* 11   */ V(2, 10, 1),
+
+  /* 0001 0000 00 ... */
+  /* 00   */ V(9, 5, 2),	/* 1236 */
+  /* 01   */ V(6, 8, 2),
+  /* 10   */ V(10, 1, 1),
+  /* 11   */ V(10, 1, 1),
+
+  /* 0001 0000 01 ... */
+  /* 00   */ V(8, 6, 2),	/* 1240 */
+  /* 01   */ V(7, 7, 2),
+  /* 10   */ V(9, 4, 1),
+  /* 11   */ V(9, 4, 1),
+
+  /* 0001 0000 10 ... */
+  /* 00   */ V(4, 9, 2),	/* 1244 */
+  /* 01   */ V(5, 7, 2),
+  /* 10   */ V(6, 7, 1),
+  /* 11   */ V(6, 7, 1),
+
+  /* 0001 0001 01 ... */
+  /* 0    */ V(0, 10, 1),	/* 1248 */
+  /* 1    */ V(10, 0, 1),
+
+  /* 0001 0001 10 ... */
+  /* 0    */ V(3, 9, 1),	/* 1250 */
+  /* 1    */ V(9, 3, 1),
+
+  /* 0001 0001 11 ... */
+  /* 0    */ V(5, 8, 1),	/* 1252 */
+  /* 1    */ V(8, 5, 1),
+
+  /* 0001 0010 10 ... */
+  /* 0    */ V(7, 6, 1),	/* 1254 */
+  /* 1    */ V(0, 9, 1),
+
+  /* 0001 0011 01 ... */
+  /* 0    */ V(9, 0, 1),	/* 1256 */
+  /* 1    */ V(4, 8, 1),
+
+  /* 0001 0011 10 ... */
+  /* 0    */ V(8, 4, 1),	/* 1258 */
+  /* 1    */ V(7, 5, 1),
+
+  /* 0001 0011 11 ... */
+  /* 0    */ V(3, 8, 1),	/* 1260 */
+  /* 1    */ V(8, 3, 1),
+
+  /* 0001 0100 00 ... */
+  /* 0    */ V(6, 6, 1),	/* 1262 */
+  /* 1    */ V(2, 8, 1),
+
+  /* 0001 0100 10 ... */
+  /* 0    */ V(4, 7, 1),	/* 1264 */
+  /* 1    */ V(7, 4, 1),
+
+  /* 0001 0101 10 ... */
+  /* 0    */ V(0, 8, 1),	/* 1266 */
+  /* 1    */ V(5, 6, 1),
+
+  /* 0001 0110 01 ... */
+  /* 0    */ V(6, 5, 1),	/* 1268 */
+  /* 1    */ V(4, 6, 1),
+
+  /* 0001 0111 00 ... */
+  /* 0    */ V(6, 4, 1),	/* 1270 */
+  /* 1    */ V(5, 5, 1)
 };
 
 static
 union huffpair const hufftab24[] = {
-  /* 0000 */ PTR(16, 4),
-  /* 0001 */ PTR(32, 4),
-  /* 0010 */ PTR(48, 4),
-  /* 0011 */ V(15, 15, 4),
-  /* 0100 */ PTR(64, 4),
-  /* 0101 */ PTR(80, 4),
-  /* 0110 */ PTR(96, 4),
-  /* 0111 */ PTR(112, 4),
-  /* 1000 */ PTR(128, 4),
-  /* 1001 */ PTR(144, 4),
-  /* 1010 */ PTR(160, 3),
-  /* 1011 */ PTR(168, 2),
-  /* 1100 */ V(1, 1, 4),
-  /* 1101 */ V(0, 1, 4),
-  /* 1110 */ V(1, 0, 4),
-  /* 1111 */ V(0, 0, 4),
-
-  /* 0000 ... */
-  /* 0000 */ V(14, 15, 4),	/* 16 */
-  /* 0001 */ V(15, 14, 4),
-  /* 0010 */ V(13, 15, 4),
-  /* 0011 */ V(15, 13, 4),
-  /* 0100 */ V(12, 15, 4),
-  /* 0101 */ V(15, 12, 4),
-  /* 0110 */ V(11, 15, 4),
-  /* 0111 */ V(15, 11, 4),
-  /* 1000 */ V(15, 10, 3),
-  /* 1001 */ V(15, 10, 3),
-  /* 1010 */ V(10, 15, 4),
-  /* 1011 */ V(9, 15, 4),
-  /* 1100 */ V(15, 9, 3),
-  /* 1101 */ V(15, 9, 3),
-  /* 1110 */ V(15, 8, 3),
-  /* 1111 */ V(15, 8, 3),
-
-  /* 0001 ... */
-  /* 0000 */ V(8, 15, 4),	/* 32 */
-  /* 0001 */ V(7, 15, 4),
-  /* 0010 */ V(15, 7, 3),
-  /* 0011 */ V(15, 7, 3),
-  /* 0100 */ V(6, 15, 3),
-  /* 0101 */ V(6, 15, 3),
-  /* 0110 */ V(15, 6, 3),
-  /* 0111 */ V(15, 6, 3),
-  /* 1000 */ V(5, 15, 3),
-  /* 1001 */ V(5, 15, 3),
-  /* 1010 */ V(15, 5, 3),
-  /* 1011 */ V(15, 5, 3),
-  /* 1100 */ V(4, 15, 3),
-  /* 1101 */ V(4, 15, 3),
-  /* 1110 */ V(15, 4, 3),
-  /* 1111 */ V(15, 4, 3),
-
-  /* 0010 ... */
-  /* 0000 */ V(3, 15, 3),	/* 48 */
-  /* 0001 */ V(3, 15, 3),
-  /* 0010 */ V(15, 3, 3),
-  /* 0011 */ V(15, 3, 3),
-  /* 0100 */ V(2, 15, 3),
-  /* 0101 */ V(2, 15, 3),
-  /* 0110 */ V(15, 2, 3),
-  /* 0111 */ V(15, 2, 3),
-  /* 1000 */ V(15, 1, 3),
-  /* 1001 */ V(15, 1, 3),
-  /* 1010 */ V(1, 15, 4),
-  /* 1011 */ V(15, 0, 4),
-  /* 1100 */ PTR(172, 3),
-  /* 1101 */ PTR(180, 3),
-  /* 1110 */ PTR(188, 3),
-  /* 1111 */ PTR(196, 3),
-
-  /* 0100 ... */
-  /* 0000 */ PTR(204, 4),	/* 64 */
-  /* 0001 */ PTR(220, 3),
-  /* 0010 */ PTR(228, 3),
-  /* 0011 */ PTR(236, 3),
-  /* 0100 */ PTR(244, 2),
-  /* 0101 */ PTR(248, 2),
-  /* 0110 */ PTR(252, 2),
-  /* 0111 */ PTR(256, 2),
-  /* 1000 */ PTR(260, 2),
-  /* 1001 */ PTR(264, 2),
-  /* 1010 */ PTR(268, 2),
-  /* 1011 */ PTR(272, 2),
-  /* 1100 */ PTR(276, 2),
-  /* 1101 */ PTR(280, 3),
-  /* 1110 */ PTR(288, 2),
-  /* 1111 */ PTR(292, 2),
-
-  /* 0101 ... */
-  /* 0000 */ PTR(296, 2),	/* 80 */
-  /* 0001 */ PTR(300, 3),
-  /* 0010 */ PTR(308, 2),
-  /* 0011 */ PTR(312, 3),
-  /* 0100 */ PTR(320, 1),
-  /* 0101 */ PTR(322, 2),
-  /* 0110 */ PTR(326, 2),
-  /* 0111 */ PTR(330, 1),
-  /* 1000 */ PTR(332, 2),
-  /* 1001 */ PTR(336, 1),
-  /* 1010 */ PTR(338, 1),
-  /* 1011 */ PTR(340, 1),
-  /* 1100 */ PTR(342, 1),
-  /* 1101 */ PTR(344, 1),
-  /* 1110 */ PTR(346, 1),
-  /* 1111 */ PTR(348, 1),
-
-  /* 0110 ... */
-  /* 0000 */ PTR(350, 1),	/* 96 */
-  /* 0001 */ PTR(352, 1),
-  /* 0010 */ PTR(354, 1),
-  /* 0011 */ PTR(356, 1),
-  /* 0100 */ PTR(358, 1),
-  /* 0101 */ PTR(360, 1),
-  /* 0110 */ PTR(362, 1),
-  /* 0111 */ PTR(364, 1),
-  /* 1000 */ PTR(366, 1),
-  /* 1001 */ PTR(368, 1),
-  /* 1010 */ PTR(370, 2),
-  /* 1011 */ PTR(374, 1),
-  /* 1100 */ PTR(376, 2),
-  /* 1101 */ V(7, 3, 4),
-  /* 1110 */ PTR(380, 1),
-  /* 1111 */ V(7, 2, 4),
-
-  /* 0111 ... */
-  /* 0000 */ V(4, 6, 4),	/* 112 */
-  /* 0001 */ V(6, 4, 4),
-  /* 0010 */ V(5, 5, 4),
-  /* 0011 */ V(7, 1, 4),
-  /* 0100 */ V(3, 6, 4),
-  /* 0101 */ V(6, 3, 4),
-  /* 0110 */ V(4, 5, 4),
-  /* 0111 */ V(5, 4, 4),
-  /* 1000 */ V(2, 6, 4),
-  /* 1001 */ V(6, 2, 4),
-  /* 1010 */ V(1, 6, 4),
-  /* 1011 */ V(6, 1, 4),
-  /* 1100 */ PTR(382, 1),
-  /* 1101 */ V(3, 5, 4),
-  /* 1110 */ V(5, 3, 4),
-  /* 1111 */ V(4, 4, 4),
-
-  /* 1000 ... */
-  /* 0000 */ V(2, 5, 4),	/* 128 */
-  /* 0001 */ V(5, 2, 4),
-  /* 0010 */ V(1, 5, 4),
-  /* 0011 */ PTR(384, 1),
-  /* 0100 */ V(5, 1, 3),
-  /* 0101 */ V(5, 1, 3),
-  /* 0110 */ V(3, 4, 4),
-  /* 0111 */ V(4, 3, 4),
-  /* 1000 */ V(2, 4, 3),
-  /* 1001 */ V(2, 4, 3),
-  /* 1010 */ V(4, 2, 3),
-  /* 1011 */ V(4, 2, 3),
-  /* 1100 */ V(3, 3, 3),
-  /* 1101 */ V(3, 3, 3),
-  /* 1110 */ V(1, 4, 3),
-  /* 1111 */ V(1, 4, 3),
-
-  /* 1001 ... */
-  /* 0000 */ V(4, 1, 3),	/* 144 */
-  /* 0001 */ V(4, 1, 3),
-  /* 0010 */ V(0, 4, 4),
-  /* 0011 */ V(4, 0, 4),
-  /* 0100 */ V(2, 3, 3),
-  /* 0101 */ V(2, 3, 3),
-  /* 0110 */ V(3, 2, 3),
-  /* 0111 */ V(3, 2, 3),
-  /* 1000 */ V(1, 3, 2),
-  /* 1001 */ V(1, 3, 2),
-  /* 1010 */ V(1, 3, 2),
-  /* 1011 */ V(1, 3, 2),
-  /* 1100 */ V(3, 1, 2),
-  /* 1101 */ V(3, 1, 2),
-  /* 1110 */ V(3, 1, 2),
-  /* 1111 */ V(3, 1, 2),
-
-  /* 1010 ... */
-  /* 000  */ V(0, 3, 3),	/* 160 */
-  /* 001  */ V(3, 0, 3),
-  /* 010  */ V(2, 2, 2),
-  /* 011  */ V(2, 2, 2),
-  /* 100  */ V(1, 2, 1),
-  /* 101  */ V(1, 2, 1),
-  /* 110  */ V(1, 2, 1),
-  /* 111  */ V(1, 2, 1),
-
-  /* 1011 ... */
-  /* 00   */ V(2, 1, 1),	/* 168 */
-  /* 01   */ V(2, 1, 1),
-  /* 10   */ V(0, 2, 2),
-  /* 11   */ V(2, 0, 2),
-
-  /* 0010 1100 ... */
-  /* 000  */ V(0, 15, 1),	/* 172 */
-  /* 001  */ V(0, 15, 1),
-  /* 010  */ V(0, 15, 1),
-  /* 011  */ V(0, 15, 1),
-  /* 100  */ V(14, 14, 3),
-  /* 101  */ V(13, 14, 3),
-  /* 110  */ V(14, 13, 3),
-  /* 111  */ V(12, 14, 3),
-
-  /* 0010 1101 ... */
-  /* 000  */ V(14, 12, 3),	/* 180 */
-  /* 001  */ V(13, 13, 3),
-  /* 010  */ V(11, 14, 3),
-  /* 011  */ V(14, 11, 3),
-  /* 100  */ V(12, 13, 3),
-  /* 101  */ V(13, 12, 3),
-  /* 110  */ V(10, 14, 3),
-  /* 111  */ V(14, 10, 3),
-
-  /* 0010 1110 ... */
-  /* 000  */ V(11, 13, 3),	/* 188 */
-  /* 001  */ V(13, 11, 3),
-  /* 010  */ V(12, 12, 3),
-  /* 011  */ V(9, 14, 3),
-  /* 100  */ V(14, 9, 3),
-  /* 101  */ V(10, 13, 3),
-  /* 110  */ V(13, 10, 3),
-  /* 111  */ V(11, 12, 3),
-
-  /* 0010 1111 ... */
-  /* 000  */ V(12, 11, 3),	/* 196 */
-  /* 001  */ V(8, 14, 3),
-  /* 010  */ V(14, 8, 3),
-  /* 011  */ V(9, 13, 3),
-  /* 100  */ V(13, 9, 3),
-  /* 101  */ V(7, 14, 3),
-  /* 110  */ V(14, 7, 3),
-  /* 111  */ V(10, 12, 3),
-
-  /* 0100 0000 ... */
-  /* 0000 */ V(12, 10, 3),	/* 204 */
-  /* 0001 */ V(12, 10, 3),
-  /* 0010 */ V(11, 11, 3),
-  /* 0011 */ V(11, 11, 3),
-  /* 0100 */ V(8, 13, 3),
-  /* 0101 */ V(8, 13, 3),
-  /* 0110 */ V(13, 8, 3),
-  /* 0111 */ V(13, 8, 3),
-  /* 1000 */ V(0, 14, 4),
-  /* 1001 */ V(14, 0, 4),
-  /* 1010 */ V(0, 13, 3),
-  /* 1011 */ V(0, 13, 3),
-  /* 1100 */ V(14, 6, 2),
-  /* 1101 */ V(14, 6, 2),
-  /* 1110 */ V(14, 6, 2),
-  /* 1111 */ V(14, 6, 2),
-
-  /* 0100 0001 ... */
-  /* 000  */ V(6, 14, 3),	/* 220 */
-  /* 001  */ V(9, 12, 3),
-  /* 010  */ V(12, 9, 2),
-  /* 011  */ V(12, 9, 2),
-  /* 100  */ V(5, 14, 2),
-  /* 101  */ V(5, 14, 2),
-  /* 110  */ V(11, 10, 2),
-  /* 111  */ V(11, 10, 2),
-
-  /* 0100 0010 ... */
-  /* 000  */ V(14, 5, 2),	/* 228 */
-  /* 001  */ V(14, 5, 2),
-  /* 010  */ V(10, 11, 3),
-  /* 011  */ V(7, 13, 3),
-  /* 100  */ V(13, 7, 2),
-  /* 101  */ V(13, 7, 2),
-  /* 110  */ V(14, 4, 2),
-  /* 111  */ V(14, 4, 2),
-
-  /* 0100 0011 ... */
-  /* 000  */ V(8, 12, 2),	/* 236 */
-  /* 001  */ V(8, 12, 2),
-  /* 010  */ V(12, 8, 2),
-  /* 011  */ V(12, 8, 2),
-  /* 100  */ V(4, 14, 3),
-  /* 101  */ V(2, 14, 3),
-  /* 110  */ V(3, 14, 2),
-  /* 111  */ V(3, 14, 2),
-
-  /* 0100 0100 ... */
-  /* 00   */ V(6, 13, 2),	/* 244 */
-  /* 01   */ V(13, 6, 2),
-  /* 10   */ V(14, 3, 2),
-  /* 11   */ V(9, 11, 2),
-
-  /* 0100 0101 ... */
-  /* 00   */ V(11, 9, 2),	/* 248 */
-  /* 01   */ V(10, 10, 2),
-  /* 10   */ V(14, 2, 2),
-  /* 11   */ V(1, 14, 2),
+  /* 0000000000 */ V(14, 15, 8),
+  /* 0000000001 */ V(14, 15, 8),
+  /* 0000000010 */ V(14, 15, 8),
+  /* 0000000011 */ V(14, 15, 8),
+  /* 0000000100 */ V(15, 14, 8),
+  /* 0000000101 */ V(15, 14, 8),
+  /* 0000000110 */ V(15, 14, 8),
+  /* 0000000111 */ V(15, 14, 8),
+  /* 0000001000 */ V(13, 15, 8),
+  /* 0000001001 */ V(13, 15, 8),
+  /* 0000001010 */ V(13, 15, 8),
+  /* 0000001011 */ V(13, 15, 8),
+  /* 0000001100 */ V(15, 13, 8),
+  /* 0000001101 */ V(15, 13, 8),
+  /* 0000001110 */ V(15, 13, 8),
+  /* 0000001111 */ V(15, 13, 8),
+  /* 0000010000 */ V(12, 15, 8),
+  /* 0000010001 */ V(12, 15, 8),
+  /* 0000010010 */ V(12, 15, 8),
+  /* 0000010011 */ V(12, 15, 8),
+  /* 0000010100 */ V(15, 12, 8),
+  /* 0000010101 */ V(15, 12, 8),
+  /* 0000010110 */ V(15, 12, 8),
+  /* 0000010111 */ V(15, 12, 8),
+  /* 0000011000 */ V(11, 15, 8),
+  /* 0000011001 */ V(11, 15, 8),
+  /* 0000011010 */ V(11, 15, 8),
+  /* 0000011011 */ V(11, 15, 8),
+  /* 0000011100 */ V(15, 11, 8),
+  /* 0000011101 */ V(15, 11, 8),
+  /* 0000011110 */ V(15, 11, 8),
+  /* 0000011111 */ V(15, 11, 8),
+  /* 0000100000 */ V(15, 10, 7),
+  /* 0000100001 */ V(15, 10, 7),
+  /* 0000100010 */ V(15, 10, 7),
+  /* 0000100011 */ V(15, 10, 7),
+  /* 0000100100 */ V(15, 10, 7),
+  /* 0000100101 */ V(15, 10, 7),
+  /* 0000100110 */ V(15, 10, 7),
+  /* 0000100111 */ V(15, 10, 7),
+  /* 0000101000 */ V(10, 15, 8),
+  /* 0000101001 */ V(10, 15, 8),
+  /* 0000101010 */ V(10, 15, 8),
+  /* 0000101011 */ V(10, 15, 8),
+  /* 0000101100 */ V(9, 15, 8),
+  /* 0000101101 */ V(9, 15, 8),
+  /* 0000101110 */ V(9, 15, 8),
+  /* 0000101111 */ V(9, 15, 8),
+  /* 0000110000 */ V(15, 9, 7),
+  /* 0000110001 */ V(15, 9, 7),
+  /* 0000110010 */ V(15, 9, 7),
+  /* 0000110011 */ V(15, 9, 7),
+  /* 0000110100 */ V(15, 9, 7),
+  /* 0000110101 */ V(15, 9, 7),
+  /* 0000110110 */ V(15, 9, 7),
+  /* 0000110111 */ V(15, 9, 7),
+  /* 0000111000 */ V(15, 8, 7),
+  /* 0000111001 */ V(15, 8, 7),
+  /* 0000111010 */ V(15, 8, 7),
+  /* 0000111011 */ V(15, 8, 7),
+  /* 0000111100 */ V(15, 8, 7),
+  /* 0000111101 */ V(15, 8, 7),
+  /* 0000111110 */ V(15, 8, 7),
+  /* 0000111111 */ V(15, 8, 7),
+  /* 0001000000 */ V(8, 15, 8),
+  /* 0001000001 */ V(8, 15, 8),
+  /* 0001000010 */ V(8, 15, 8),
+  /* 0001000011 */ V(8, 15, 8),
+  /* 0001000100 */ V(7, 15, 8),
+  /* 0001000101 */ V(7, 15, 8),
+  /* 0001000110 */ V(7, 15, 8),
+  /* 0001000111 */ V(7, 15, 8),
+  /* 0001001000 */ V(15, 7, 7),
+  /* 0001001001 */ V(15, 7, 7),
+  /* 0001001010 */ V(15, 7, 7),
+  /* 0001001011 */ V(15, 7, 7),
+  /* 0001001100 */ V(15, 7, 7),
+  /* 0001001101 */ V(15, 7, 7),
+  /* 0001001110 */ V(15, 7, 7),
+  /* 0001001111 */ V(15, 7, 7),
+  /* 0001010000 */ V(6, 15, 7),
+  /* 0001010001 */ V(6, 15, 7),
+  /* 0001010010 */ V(6, 15, 7),
+  /* 0001010011 */ V(6, 15, 7),
+  /* 0001010100 */ V(6, 15, 7),
+  /* 0001010101 */ V(6, 15, 7),
+  /* 0001010110 */ V(6, 15, 7),
+  /* 0001010111 */ V(6, 15, 7),
+  /* 0001011000 */ V(15, 6, 7),
+  /* 0001011001 */ V(15, 6, 7),
+  /* 0001011010 */ V(15, 6, 7),
+  /* 0001011011 */ V(15, 6, 7),
+  /* 0001011100 */ V(15, 6, 7),
+  /* 0001011101 */ V(15, 6, 7),
+  /* 0001011110 */ V(15, 6, 7),
+  /* 0001011111 */ V(15, 6, 7),
+  /* 0001100000 */ V(5, 15, 7),
+  /* 0001100001 */ V(5, 15, 7),
+  /* 0001100010 */ V(5, 15, 7),
+  /* 0001100011 */ V(5, 15, 7),
+  /* 0001100100 */ V(5, 15, 7),
+  /* 0001100101 */ V(5, 15, 7),
+  /* 0001100110 */ V(5, 15, 7),
+  /* 0001100111 */ V(5, 15, 7),
+  /* 0001101000 */ V(15, 5, 7),
+  /* 0001101001 */ V(15, 5, 7),
+  /* 0001101010 */ V(15, 5, 7),
+  /* 0001101011 */ V(15, 5, 7),
+  /* 0001101100 */ V(15, 5, 7),
+  /* 0001101101 */ V(15, 5, 7),
+  /* 0001101110 */ V(15, 5, 7),
+  /* 0001101111 */ V(15, 5, 7),
+  /* 0001110000 */ V(4, 15, 7),
+  /* 0001110001 */ V(4, 15, 7),
+  /* 0001110010 */ V(4, 15, 7),
+  /* 0001110011 */ V(4, 15, 7),
+  /* 0001110100 */ V(4, 15, 7),
+  /* 0001110101 */ V(4, 15, 7),
+  /* 0001110110 */ V(4, 15, 7),
+  /* 0001110111 */ V(4, 15, 7),
+  /* 0001111000 */ V(15, 4, 7),
+  /* 0001111001 */ V(15, 4, 7),
+  /* 0001111010 */ V(15, 4, 7),
+  /* 0001111011 */ V(15, 4, 7),
+  /* 0001111100 */ V(15, 4, 7),
+  /* 0001111101 */ V(15, 4, 7),
+  /* 0001111110 */ V(15, 4, 7),
+  /* 0001111111 */ V(15, 4, 7),
+  /* 0010000000 */ V(3, 15, 7),
+  /* 0010000001 */ V(3, 15, 7),
+  /* 0010000010 */ V(3, 15, 7),
+  /* 0010000011 */ V(3, 15, 7),
+  /* 0010000100 */ V(3, 15, 7),
+  /* 0010000101 */ V(3, 15, 7),
+  /* 0010000110 */ V(3, 15, 7),
+  /* 0010000111 */ V(3, 15, 7),
+  /* 0010001000 */ V(15, 3, 7),
+  /* 0010001001 */ V(15, 3, 7),
+  /* 0010001010 */ V(15, 3, 7),
+  /* 0010001011 */ V(15, 3, 7),
+  /* 0010001100 */ V(15, 3, 7),
+  /* 0010001101 */ V(15, 3, 7),
+  /* 0010001110 */ V(15, 3, 7),
+  /* 0010001111 */ V(15, 3, 7),
+  /* 0010010000 */ V(2, 15, 7),
+  /* 0010010001 */ V(2, 15, 7),
+  /* 0010010010 */ V(2, 15, 7),
+  /* 0010010011 */ V(2, 15, 7),
+  /* 0010010100 */ V(2, 15, 7),
+  /* 0010010101 */ V(2, 15, 7),
+  /* 0010010110 */ V(2, 15, 7),
+  /* 0010010111 */ V(2, 15, 7),
+  /* 0010011000 */ V(15, 2, 7),
+  /* 0010011001 */ V(15, 2, 7),
+  /* 0010011010 */ V(15, 2, 7),
+  /* 0010011011 */ V(15, 2, 7),
+  /* 0010011100 */ V(15, 2, 7),
+  /* 0010011101 */ V(15, 2, 7),
+  /* 0010011110 */ V(15, 2, 7),
+  /* 0010011111 */ V(15, 2, 7),
+  /* 0010100000 */ V(15, 1, 7),
+  /* 0010100001 */ V(15, 1, 7),
+  /* 0010100010 */ V(15, 1, 7),
+  /* 0010100011 */ V(15, 1, 7),
+  /* 0010100100 */ V(15, 1, 7),
+  /* 0010100101 */ V(15, 1, 7),
+  /* 0010100110 */ V(15, 1, 7),
+  /* 0010100111 */ V(15, 1, 7),
+  /* 0010101000 */ V(1, 15, 8),
+  /* 0010101001 */ V(1, 15, 8),
+  /* 0010101010 */ V(1, 15, 8),
+  /* 0010101011 */ V(1, 15, 8),
+  /* 0010101100 */ V(15, 0, 8),
+  /* 0010101101 */ V(15, 0, 8),
+  /* 0010101110 */ V(15, 0, 8),
+  /* 0010101111 */ V(15, 0, 8),
+  /* 0010110000 */ V(0, 15, 9),
+  /* 0010110001 */ V(0, 15, 9),
+  /* 0010110010 */ PTR(1024, 1),
+  /* 0010110011 */ PTR(1026, 1),
+  /* 0010110100 */ PTR(1028, 1),
+  /* 0010110101 */ PTR(1030, 1),
+  /* 0010110110 */ PTR(1032, 1),
+  /* 0010110111 */ PTR(1034, 1),
+  /* 0010111000 */ PTR(1036, 1),
+  /* 0010111001 */ PTR(1038, 1),
+  /* 0010111010 */ PTR(1040, 1),
+  /* 0010111011 */ PTR(1042, 1),
+  /* 0010111100 */ PTR(1044, 1),
+  /* 0010111101 */ PTR(1046, 1),
+  /* 0010111110 */ PTR(1048, 1),
+  /* 0010111111 */ PTR(1050, 1),
+  /* 0011000000 */ V(15, 15, 4),
+  /* 0011000001 */ V(15, 15, 4),
+  /* 0011000010 */ V(15, 15, 4),
+  /* 0011000011 */ V(15, 15, 4),
+  /* 0011000100 */ V(15, 15, 4),
+  /* 0011000101 */ V(15, 15, 4),
+  /* 0011000110 */ V(15, 15, 4),
+  /* 0011000111 */ V(15, 15, 4),
+  /* 0011001000 */ V(15, 15, 4),
+  /* 0011001001 */ V(15, 15, 4),
+  /* 0011001010 */ V(15, 15, 4),
+  /* 0011001011 */ V(15, 15, 4),
+  /* 0011001100 */ V(15, 15, 4),
+  /* 0011001101 */ V(15, 15, 4),
+  /* 0011001110 */ V(15, 15, 4),
+  /* 0011001111 */ V(15, 15, 4),
+  /* 0011010000 */ V(15, 15, 4),
+  /* 0011010001 */ V(15, 15, 4),
+  /* 0011010010 */ V(15, 15, 4),
+  /* 0011010011 */ V(15, 15, 4),
+  /* 0011010100 */ V(15, 15, 4),
+  /* 0011010101 */ V(15, 15, 4),
+  /* 0011010110 */ V(15, 15, 4),
+  /* 0011010111 */ V(15, 15, 4),
+  /* 0011011000 */ V(15, 15, 4),
+  /* 0011011001 */ V(15, 15, 4),
+  /* 0011011010 */ V(15, 15, 4),
+  /* 0011011011 */ V(15, 15, 4),
+  /* 0011011100 */ V(15, 15, 4),
+  /* 0011011101 */ V(15, 15, 4),
+  /* 0011011110 */ V(15, 15, 4),
+  /* 0011011111 */ V(15, 15, 4),
+  /* 0011100000 */ V(15, 15, 4),
+  /* 0011100001 */ V(15, 15, 4),
+  /* 0011100010 */ V(15, 15, 4),
+  /* 0011100011 */ V(15, 15, 4),
+  /* 0011100100 */ V(15, 15, 4),
+  /* 0011100101 */ V(15, 15, 4),
+  /* 0011100110 */ V(15, 15, 4),
+  /* 0011100111 */ V(15, 15, 4),
+  /* 0011101000 */ V(15, 15, 4),
+  /* 0011101001 */ V(15, 15, 4),
+  /* 0011101010 */ V(15, 15, 4),
+  /* 0011101011 */ V(15, 15, 4),
+  /* 0011101100 */ V(15, 15, 4),
+  /* 0011101101 */ V(15, 15, 4),
+  /* 0011101110 */ V(15, 15, 4),
+  /* 0011101111 */ V(15, 15, 4),
+  /* 0011110000 */ V(15, 15, 4),
+  /* 0011110001 */ V(15, 15, 4),
+  /* 0011110010 */ V(15, 15, 4),
+  /* 0011110011 */ V(15, 15, 4),
+  /* 0011110100 */ V(15, 15, 4),
+  /* 0011110101 */ V(15, 15, 4),
+  /* 0011110110 */ V(15, 15, 4),
+  /* 0011110111 */ V(15, 15, 4),
+  /* 0011111000 */ V(15, 15, 4),
+  /* 0011111001 */ V(15, 15, 4),
+  /* 0011111010 */ V(15, 15, 4),
+  /* 0011111011 */ V(15, 15, 4),
+  /* 0011111100 */ V(15, 15, 4),
+  /* 0011111101 */ V(15, 15, 4),
+  /* 0011111110 */ V(15, 15, 4),
+  /* 0011111111 */ V(15, 15, 4),
+  /* 0100000000 */ PTR(1052, 1),
+  /* 0100000001 */ PTR(1054, 1),
+  /* 0100000010 */ PTR(1056, 2),
+  /* 0100000011 */ V(14, 6, 10),
+  /* 0100000100 */ PTR(1060, 1),
+  /* 0100000101 */ V(12, 9, 10),
+  /* 0100000110 */ V(5, 14, 10),
+  /* 0100000111 */ V(11, 10, 10),
+  /* 0100001000 */ V(14, 5, 10),
+  /* 0100001001 */ PTR(1062, 1),
+  /* 0100001010 */ V(13, 7, 10),
+  /* 0100001011 */ V(14, 4, 10),
+  /* 0100001100 */ V(8, 12, 10),
+  /* 0100001101 */ V(12, 8, 10),
+  /* 0100001110 */ PTR(1064, 1),
+  /* 0100001111 */ V(3, 14, 10),
+  /* 0100010000 */ V(6, 13, 10),
+  /* 0100010001 */ V(13, 6, 10),
+  /* 0100010010 */ V(14, 3, 10),
+  /* 0100010011 */ V(9, 11, 10),
+  /* 0100010100 */ V(11, 9, 10),
+  /* 0100010101 */ V(10, 10, 10),
+  /* 0100010110 */ V(14, 2, 10),
+  /* 0100010111 */ V(1, 14, 10),
+  /* 0100011000 */ V(14, 1, 10),
+  /* 0100011001 */ V(5, 13, 10),
+  /* 0100011010 */ V(13, 5, 10),
+  /* 0100011011 */ V(7, 12, 10),
+  /* 0100011100 */ V(12, 7, 10),
+  /* 0100011101 */ V(4, 13, 10),
+  /* 0100011110 */ V(8, 11, 10),
+  /* 0100011111 */ V(11, 8, 10),
+  /* 0100100000 */ V(13, 4, 10),
+  /* 0100100001 */ V(9, 10, 10),
+  /* 0100100010 */ V(10, 9, 10),
+  /* 0100100011 */ V(6, 12, 10),
+  /* 0100100100 */ V(12, 6, 10),
+  /* 0100100101 */ V(3, 13, 10),
+  /* 0100100110 */ V(13, 3, 10),
+  /* 0100100111 */ V(2, 13, 10),
+  /* 0100101000 */ V(13, 2, 10),
+  /* 0100101001 */ V(1, 13, 10),
+  /* 0100101010 */ V(7, 11, 10),
+  /* 0100101011 */ V(11, 7, 10),
+  /* 0100101100 */ V(13, 1, 10),
+  /* 0100101101 */ V(5, 12, 10),
+  /* 0100101110 */ V(12, 5, 10),
+  /* 0100101111 */ V(8, 10, 10),
+  /* 0100110000 */ V(10, 8, 10),
+  /* 0100110001 */ V(9, 9, 10),
+  /* 0100110010 */ V(4, 12, 10),
+  /* 0100110011 */ V(12, 4, 10),
+  /* 0100110100 */ V(6, 11, 10),
+  /* 0100110101 */ V(11, 6, 10),
+  /* 0100110110 */ PTR(1066, 1),
+  /* 0100110111 */ V(3, 12, 10),
+  /* 0100111000 */ V(12, 3, 10),
+  /* 0100111001 */ V(7, 10, 10),
+  /* 0100111010 */ V(10, 7, 10),
+  /* 0100111011 */ V(2, 12, 10),
+  /* 0100111100 */ V(12, 2, 10),
+  /* 0100111101 */ V(5, 11, 10),
+  /* 0100111110 */ V(11, 5, 10),
+  /* 0100111111 */ V(1, 12, 10),
+  /* 0101000000 */ V(8, 9, 10),
+  /* 0101000001 */ V(9, 8, 10),
+  /* 0101000010 */ V(12, 1, 10),
+  /* 0101000011 */ V(4, 11, 10),
+  /* 0101000100 */ PTR(1068, 1),
+  /* 0101000101 */ V(3, 11, 10),
+  /* 0101000110 */ PTR(1070, 1),
+  /* 0101000111 */ V(1, 10, 10),
+  /* 0101001000 */ V(11, 4, 9),
+  /* 0101001001 */ V(11, 4, 9),
+  /* 0101001010 */ V(6, 10, 10),
+  /* 0101001011 */ V(10, 6, 10),
+  /* 0101001100 */ V(7, 9, 10),
+  /* 0101001101 */ V(9, 7, 10),
+  /* 0101001110 */ PTR(1072, 1),
+  /* 0101001111 */ V(9, 0, 10),
+  /* 0101010000 */ V(11, 3, 9),
+  /* 0101010001 */ V(11, 3, 9),
+  /* 0101010010 */ V(8, 8, 9),
+  /* 0101010011 */ V(8, 8, 9),
+  /* 0101010100 */ V(2, 11, 10),
+  /* 0101010101 */ V(5, 10, 10),
+  /* 0101010110 */ V(11, 2, 9),
+  /* 0101010111 */ V(11, 2, 9),
+  /* 0101011000 */ V(10, 5, 10),
+  /* 0101011001 */ V(1, 11, 10),
+  /* 0101011010 */ V(11, 1, 10),
+  /* 0101011011 */ V(6, 9, 10),
+  /* 0101011100 */ V(9, 6, 9),
+  /* 0101011101 */ V(9, 6, 9),
+  /* 0101011110 */ V(10, 4, 9),
+  /* 0101011111 */ V(10, 4, 9),
+  /* 0101100000 */ V(4, 10, 10),
+  /* 0101100001 */ V(7, 8, 10),
+  /* 0101100010 */ V(8, 7, 9),
+  /* 0101100011 */ V(8, 7, 9),
+  /* 0101100100 */ V(3, 10, 9),
+  /* 0101100101 */ V(3, 10, 9),
+  /* 0101100110 */ V(10, 3, 9),
+  /* 0101100111 */ V(10, 3, 9),
+  /* 0101101000 */ V(5, 9, 9),
+  /* 0101101001 */ V(5, 9, 9),
+  /* 0101101010 */ V(9, 5, 9),
+  /* 0101101011 */ V(9, 5, 9),
+  /* 0101101100 */ V(2, 10, 9),
+  /* 0101101101 */ V(2, 10, 9),
+  /* 0101101110 */ V(10, 2, 9),
+  /* 0101101111 */ V(10, 2, 9),
+  /* 0101110000 */ V(10, 1, 9),
+  /* 0101110001 */ V(10, 1, 9),
+  /* 0101110010 */ V(6, 8, 9),
+  /* 0101110011 */ V(6, 8, 9),
+  /* 0101110100 */ V(8, 6, 9),
+  /* 0101110101 */ V(8, 6, 9),
+  /* 0101110110 */ V(7, 7, 9),
+  /* 0101110111 */ V(7, 7, 9),
+  /* 0101111000 */ V(4, 9, 9),
+  /* 0101111001 */ V(4, 9, 9),
+  /* 0101111010 */ V(9, 4, 9),
+  /* 0101111011 */ V(9, 4, 9),
+  /* 0101111100 */ V(3, 9, 9),
+  /* 0101111101 */ V(3, 9, 9),
+  /* 0101111110 */ V(9, 3, 9),
+  /* 0101111111 */ V(9, 3, 9),
+  /* 0110000000 */ V(5, 8, 9),
+  /* 0110000001 */ V(5, 8, 9),
+  /* 0110000010 */ V(8, 5, 9),
+  /* 0110000011 */ V(8, 5, 9),
+  /* 0110000100 */ V(2, 9, 9),
+  /* 0110000101 */ V(2, 9, 9),
+  /* 0110000110 */ V(6, 7, 9),
+  /* 0110000111 */ V(6, 7, 9),
+  /* 0110001000 */ V(7, 6, 9),
+  /* 0110001001 */ V(7, 6, 9),
+  /* 0110001010 */ V(9, 2, 9),
+  /* 0110001011 */ V(9, 2, 9),
+  /* 0110001100 */ V(1, 9, 9),
+  /* 0110001101 */ V(1, 9, 9),
+  /* 0110001110 */ V(9, 1, 9),
+  /* 0110001111 */ V(9, 1, 9),
+  /* 0110010000 */ V(4, 8, 9),
+  /* 0110010001 */ V(4, 8, 9),
+  /* 0110010010 */ V(8, 4, 9),
+  /* 0110010011 */ V(8, 4, 9),
+  /* 0110010100 */ V(5, 7, 9),
+  /* 0110010101 */ V(5, 7, 9),
+  /* 0110010110 */ V(7, 5, 9),
+  /* 0110010111 */ V(7, 5, 9),
+  /* 0110011000 */ V(3, 8, 9),
+  /* 0110011001 */ V(3, 8, 9),
+  /* 0110011010 */ V(8, 3, 9),
+  /* 0110011011 */ V(8, 3, 9),
+  /* 0110011100 */ V(6, 6, 9),
+  /* 0110011101 */ V(6, 6, 9),
+  /* 0110011110 */ V(2, 8, 9),
+  /* 0110011111 */ V(2, 8, 9),
+  /* 0110100000 */ V(8, 2, 9),
+  /* 0110100001 */ V(8, 2, 9),
+  /* 0110100010 */ V(1, 8, 9),
+  /* 0110100011 */ V(1, 8, 9),
+  /* 0110100100 */ V(4, 7, 9),
+  /* 0110100101 */ V(4, 7, 9),
+  /* 0110100110 */ V(7, 4, 9),
+  /* 0110100111 */ V(7, 4, 9),
+  /* 0110101000 */ V(8, 1, 9),
+  /* 0110101001 */ V(8, 1, 9),
+  /* 0110101010 */ V(0, 8, 10),
+  /* 0110101011 */ V(8, 0, 10),
+  /* 0110101100 */ V(5, 6, 9),
+  /* 0110101101 */ V(5, 6, 9),
+  /* 0110101110 */ V(6, 5, 9),
+  /* 0110101111 */ V(6, 5, 9),
+  /* 0110110000 */ V(1, 7, 9),
+  /* 0110110001 */ V(1, 7, 9),
+  /* 0110110010 */ V(0, 7, 10),
+  /* 0110110011 */ V(7, 0, 10),
+  /* 0110110100 */ V(7, 3, 8),
+  /* 0110110101 */ V(7, 3, 8),
+  /* 0110110110 */ V(7, 3, 8),
+  /* 0110110111 */ V(7, 3, 8),
+  /* 0110111000 */ V(3, 7, 9),
+  /* 0110111001 */ V(3, 7, 9),
+  /* 0110111010 */ V(2, 7, 9),
+  /* 0110111011 */ V(2, 7, 9),
+  /* 0110111100 */ V(7, 2, 8),
+  /* 0110111101 */ V(7, 2, 8),
+  /* 0110111110 */ V(7, 2, 8),
+  /* 0110111111 */ V(7, 2, 8),
+  /* 0111000000 */ V(4, 6, 8),
+  /* 0111000001 */ V(4, 6, 8),
+  /* 0111000010 */ V(4, 6, 8),
+  /* 0111000011 */ V(4, 6, 8),
+  /* 0111000100 */ V(6, 4, 8),
+  /* 0111000101 */ V(6, 4, 8),
+  /* 0111000110 */ V(6, 4, 8),
+  /* 0111000111 */ V(6, 4, 8),
+  /* 0111001000 */ V(5, 5, 8),
+  /* 0111001001 */ V(5, 5, 8),
+  /* 0111001010 */ V(5, 5, 8),
+  /* 0111001011 */ V(5, 5, 8),
+  /* 0111001100 */ V(7, 1, 8),
+  /* 0111001101 */ V(7, 1, 8),
+  /* 0111001110 */ V(7, 1, 8),
+  /* 0111001111 */ V(7, 1, 8),
+  /* 0111010000 */ V(3, 6, 8),
+  /* 0111010001 */ V(3, 6, 8),
+  /* 0111010010 */ V(3, 6, 8),
+  /* 0111010011 */ V(3, 6, 8),
+  /* 0111010100 */ V(6, 3, 8),
+  /* 0111010101 */ V(6, 3, 8),
+  /* 0111010110 */ V(6, 3, 8),
+  /* 0111010111 */ V(6, 3, 8),
+  /* 0111011000 */ V(4, 5, 8),
+  /* 0111011001 */ V(4, 5, 8),
+  /* 0111011010 */ V(4, 5, 8),
+  /* 0111011011 */ V(4, 5, 8),
+  /* 0111011100 */ V(5, 4, 8),
+  /* 0111011101 */ V(5, 4, 8),
+  /* 0111011110 */ V(5, 4, 8),
+  /* 0111011111 */ V(5, 4, 8),
+  /* 0111100000 */ V(2, 6, 8),
+  /* 0111100001 */ V(2, 6, 8),
+  /* 0111100010 */ V(2, 6, 8),
+  /* 0111100011 */ V(2, 6, 8),
+  /* 0111100100 */ V(6, 2, 8),
+  /* 0111100101 */ V(6, 2, 8),
+  /* 0111100110 */ V(6, 2, 8),
+  /* 0111100111 */ V(6, 2, 8),
+  /* 0111101000 */ V(1, 6, 8),
+  /* 0111101001 */ V(1, 6, 8),
+  /* 0111101010 */ V(1, 6, 8),
+  /* 0111101011 */ V(1, 6, 8),
+  /* 0111101100 */ V(6, 1, 8),
+  /* 0111101101 */ V(6, 1, 8),
+  /* 0111101110 */ V(6, 1, 8),
+  /* 0111101111 */ V(6, 1, 8),
+  /* 0111110000 */ V(0, 6, 9),
+  /* 0111110001 */ V(0, 6, 9),
+  /* 0111110010 */ V(6, 0, 9),
+  /* 0111110011 */ V(6, 0, 9),
+  /* 0111110100 */ V(3, 5, 8),
+  /* 0111110101 */ V(3, 5, 8),
+  /* 0111110110 */ V(3, 5, 8),
+  /* 0111110111 */ V(3, 5, 8),
+  /* 0111111000 */ V(5, 3, 8),
+  /* 0111111001 */ V(5, 3, 8),
+  /* 0111111010 */ V(5, 3, 8),
+  /* 0111111011 */ V(5, 3, 8),
+  /* 0111111100 */ V(4, 4, 8),
+  /* 0111111101 */ V(4, 4, 8),
+  /* 0111111110 */ V(4, 4, 8),
+  /* 0111111111 */ V(4, 4, 8),
+  /* 1000000000 */ V(2, 5, 8),
+  /* 1000000001 */ V(2, 5, 8),
+  /* 1000000010 */ V(2, 5, 8),
+  /* 1000000011 */ V(2, 5, 8),
+  /* 1000000100 */ V(5, 2, 8),
+  /* 1000000101 */ V(5, 2, 8),
+  /* 1000000110 */ V(5, 2, 8),
+  /* 1000000111 */ V(5, 2, 8),
+  /* 1000001000 */ V(1, 5, 8),
+  /* 1000001001 */ V(1, 5, 8),
+  /* 1000001010 */ V(1, 5, 8),
+  /* 1000001011 */ V(1, 5, 8),
+  /* 1000001100 */ V(0, 5, 9),
+  /* 1000001101 */ V(0, 5, 9),
+  /* 1000001110 */ V(5, 0, 9),
+  /* 1000001111 */ V(5, 0, 9),
+  /* 1000010000 */ V(5, 1, 7),
+  /* 1000010001 */ V(5, 1, 7),
+  /* 1000010010 */ V(5, 1, 7),
+  /* 1000010011 */ V(5, 1, 7),
+  /* 1000010100 */ V(5, 1, 7),
+  /* 1000010101 */ V(5, 1, 7),
+  /* 1000010110 */ V(5, 1, 7),
+  /* 1000010111 */ V(5, 1, 7),
+  /* 1000011000 */ V(3, 4, 8),
+  /* 1000011001 */ V(3, 4, 8),
+  /* 1000011010 */ V(3, 4, 8),
+  /* 1000011011 */ V(3, 4, 8),
+  /* 1000011100 */ V(4, 3, 8),
+  /* 1000011101 */ V(4, 3, 8),
+  /* 1000011110 */ V(4, 3, 8),
+  /* 1000011111 */ V(4, 3, 8),
+  /* 1000100000 */ V(2, 4, 7),
+  /* 1000100001 */ V(2, 4, 7),
+  /* 1000100010 */ V(2, 4, 7),
+  /* 1000100011 */ V(2, 4, 7),
+  /* 1000100100 */ V(2, 4, 7),
+  /* 1000100101 */ V(2, 4, 7),
+  /* 1000100110 */ V(2, 4, 7),
+  /* 1000100111 */ V(2, 4, 7),
+  /* 1000101000 */ V(4, 2, 7),
+  /* 1000101001 */ V(4, 2, 7),
+  /* 1000101010 */ V(4, 2, 7),
+  /* 1000101011 */ V(4, 2, 7),
+  /* 1000101100 */ V(4, 2, 7),
+  /* 1000101101 */ V(4, 2, 7),
+  /* 1000101110 */ V(4, 2, 7),
+  /* 1000101111 */ V(4, 2, 7),
+  /* 1000110000 */ V(3, 3, 7),
+  /* 1000110001 */ V(3, 3, 7),
+  /* 1000110010 */ V(3, 3, 7),
+  /* 1000110011 */ V(3, 3, 7),
+  /* 1000110100 */ V(3, 3, 7),
+  /* 1000110101 */ V(3, 3, 7),
+  /* 1000110110 */ V(3, 3, 7),
+  /* 1000110111 */ V(3, 3, 7),
+  /* 1000111000 */ V(1, 4, 7),
+  /* 1000111001 */ V(1, 4, 7),
+  /* 1000111010 */ V(1, 4, 7),
+  /* 1000111011 */ V(1, 4, 7),
+  /* 1000111100 */ V(1, 4, 7),
+  /* 1000111101 */ V(1, 4, 7),
+  /* 1000111110 */ V(1, 4, 7),
+  /* 1000111111 */ V(1, 4, 7),
+  /* 1001000000 */ V(4, 1, 7),
+  /* 1001000001 */ V(4, 1, 7),
+  /* 1001000010 */ V(4, 1, 7),
+  /* 1001000011 */ V(4, 1, 7),
+  /* 1001000100 */ V(4, 1, 7),
+  /* 1001000101 */ V(4, 1, 7),
+  /* 1001000110 */ V(4, 1, 7),
+  /* 1001000111 */ V(4, 1, 7),
+  /* 1001001000 */ V(0, 4, 8),
+  /* 1001001001 */ V(0, 4, 8),
+  /* 1001001010 */ V(0, 4, 8),
+  /* 1001001011 */ V(0, 4, 8),
+  /* 1001001100 */ V(4, 0, 8),
+  /* 1001001101 */ V(4, 0, 8),
+  /* 1001001110 */ V(4, 0, 8),
+  /* 1001001111 */ V(4, 0, 8),
+  /* 1001010000 */ V(2, 3, 7),
+  /* 1001010001 */ V(2, 3, 7),
+  /* 1001010010 */ V(2, 3, 7),
+  /* 1001010011 */ V(2, 3, 7),
+  /* 1001010100 */ V(2, 3, 7),
+  /* 1001010101 */ V(2, 3, 7),
+  /* 1001010110 */ V(2, 3, 7),
+  /* 1001010111 */ V(2, 3, 7),
+  /* 1001011000 */ V(3, 2, 7),
+  /* 1001011001 */ V(3, 2, 7),
+  /* 1001011010 */ V(3, 2, 7),
+  /* 1001011011 */ V(3, 2, 7),
+  /* 1001011100 */ V(3, 2, 7),
+  /* 1001011101 */ V(3, 2, 7),
+  /* 1001011110 */ V(3, 2, 7),
+  /* 1001011111 */ V(3, 2, 7),
+  /* 1001100000 */ V(1, 3, 6),
+  /* 1001100001 */ V(1, 3, 6),
+  /* 1001100010 */ V(1, 3, 6),
+  /* 1001100011 */ V(1, 3, 6),
+  /* 1001100100 */ V(1, 3, 6),
+  /* 1001100101 */ V(1, 3, 6),
+  /* 1001100110 */ V(1, 3, 6),
+  /* 1001100111 */ V(1, 3, 6),
+  /* 1001101000 */ V(1, 3, 6),
+  /* 1001101001 */ V(1, 3, 6),
+  /* 1001101010 */ V(1, 3, 6),
+  /* 1001101011 */ V(1, 3, 6),
+  /* 1001101100 */ V(1, 3, 6),
+  /* 1001101101 */ V(1, 3, 6),
+  /* 1001101110 */ V(1, 3, 6),
+  /* 1001101111 */ V(1, 3, 6),
+  /* 1001110000 */ V(3, 1, 6),
+  /* 1001110001 */ V(3, 1, 6),
+  /* 1001110010 */ V(3, 1, 6),
+  /* 1001110011 */ V(3, 1, 6),
+  /* 1001110100 */ V(3, 1, 6),
+  /* 1001110101 */ V(3, 1, 6),
+  /* 1001110110 */ V(3, 1, 6),
+  /* 1001110111 */ V(3, 1, 6),
+  /* 1001111000 */ V(3, 1, 6),
+  /* 1001111001 */ V(3, 1, 6),
+  /* 1001111010 */ V(3, 1, 6),
+  /* 1001111011 */ V(3, 1, 6),
+  /* 1001111100 */ V(3, 1, 6),
+  /* 1001111101 */ V(3, 1, 6),
+  /* 1001111110 */ V(3, 1, 6),
+  /* 1001111111 */ V(3, 1, 6),
+  /* 1010000000 */ V(0, 3, 7),
+  /* 1010000001 */ V(0, 3, 7),
+  /* 1010000010 */ V(0, 3, 7),
+  /* 1010000011 */ V(0, 3, 7),
+  /* 1010000100 */ V(0, 3, 7),
+  /* 1010000101 */ V(0, 3, 7),
+  /* 1010000110 */ V(0, 3, 7),
+  /* 1010000111 */ V(0, 3, 7),
+  /* 1010001000 */ V(3, 0, 7),
+  /* 1010001001 */ V(3, 0, 7),
+  /* 1010001010 */ V(3, 0, 7),
+  /* 1010001011 */ V(3, 0, 7),
+  /* 1010001100 */ V(3, 0, 7),
+  /* 1010001101 */ V(3, 0, 7),
+  /* 1010001110 */ V(3, 0, 7),
+  /* 1010001111 */ V(3, 0, 7),
+  /* 1010010000 */ V(2, 2, 6),
+  /* 1010010001 */ V(2, 2, 6),
+  /* 1010010010 */ V(2, 2, 6),
+  /* 1010010011 */ V(2, 2, 6),
+  /* 1010010100 */ V(2, 2, 6),
+  /* 1010010101 */ V(2, 2, 6),
+  /* 1010010110 */ V(2, 2, 6),
+  /* 1010010111 */ V(2, 2, 6),
+  /* 1010011000 */ V(2, 2, 6),
+  /* 1010011001 */ V(2, 2, 6),
+  /* 1010011010 */ V(2, 2, 6),
+  /* 1010011011 */ V(2, 2, 6),
+  /* 1010011100 */ V(2, 2, 6),
+  /* 1010011101 */ V(2, 2, 6),
+  /* 1010011110 */ V(2, 2, 6),
+  /* 1010011111 */ V(2, 2, 6),
+  /* 1010100000 */ V(1, 2, 5),
+  /* 1010100001 */ V(1, 2, 5),
+  /* 1010100010 */ V(1, 2, 5),
+  /* 1010100011 */ V(1, 2, 5),
+  /* 1010100100 */ V(1, 2, 5),
+  /* 1010100101 */ V(1, 2, 5),
+  /* 1010100110 */ V(1, 2, 5),
+  /* 1010100111 */ V(1, 2, 5),
+  /* 1010101000 */ V(1, 2, 5),
+  /* 1010101001 */ V(1, 2, 5),
+  /* 1010101010 */ V(1, 2, 5),
+  /* 1010101011 */ V(1, 2, 5),
+  /* 1010101100 */ V(1, 2, 5),
+  /* 1010101101 */ V(1, 2, 5),
+  /* 1010101110 */ V(1, 2, 5),
+  /* 1010101111 */ V(1, 2, 5),
+  /* 1010110000 */ V(1, 2, 5),
+  /* 1010110001 */ V(1, 2, 5),
+  /* 1010110010 */ V(1, 2, 5),
+  /* 1010110011 */ V(1, 2, 5),
+  /* 1010110100 */ V(1, 2, 5),
+  /* 1010110101 */ V(1, 2, 5),
+  /* 1010110110 */ V(1, 2, 5),
+  /* 1010110111 */ V(1, 2, 5),
+  /* 1010111000 */ V(1, 2, 5),
+  /* 1010111001 */ V(1, 2, 5),
+  /* 1010111010 */ V(1, 2, 5),
+  /* 1010111011 */ V(1, 2, 5),
+  /* 1010111100 */ V(1, 2, 5),
+  /* 1010111101 */ V(1, 2, 5),
+  /* 1010111110 */ V(1, 2, 5),
+  /* 1010111111 */ V(1, 2, 5),
+  /* 1011000000 */ V(2, 1, 5),
+  /* 1011000001 */ V(2, 1, 5),
+  /* 1011000010 */ V(2, 1, 5),
+  /* 1011000011 */ V(2, 1, 5),
+  /* 1011000100 */ V(2, 1, 5),
+  /* 1011000101 */ V(2, 1, 5),
+  /* 1011000110 */ V(2, 1, 5),
+  /* 1011000111 */ V(2, 1, 5),
+  /* 1011001000 */ V(2, 1, 5),
+  /* 1011001001 */ V(2, 1, 5),
+  /* 1011001010 */ V(2, 1, 5),
+  /* 1011001011 */ V(2, 1, 5),
+  /* 1011001100 */ V(2, 1, 5),
+  /* 1011001101 */ V(2, 1, 5),
+  /* 1011001110 */ V(2, 1, 5),
+  /* 1011001111 */ V(2, 1, 5),
+  /* 1011010000 */ V(2, 1, 5),
+  /* 1011010001 */ V(2, 1, 5),
+  /* 1011010010 */ V(2, 1, 5),
+  /* 1011010011 */ V(2, 1, 5),
+  /* 1011010100 */ V(2, 1, 5),
+  /* 1011010101 */ V(2, 1, 5),
+  /* 1011010110 */ V(2, 1, 5),
+  /* 1011010111 */ V(2, 1, 5),
+  /* 1011011000 */ V(2, 1, 5),
+  /* 1011011001 */ V(2, 1, 5),
+  /* 1011011010 */ V(2, 1, 5),
+  /* 1011011011 */ V(2, 1, 5),
+  /* 1011011100 */ V(2, 1, 5),
+  /* 1011011101 */ V(2, 1, 5),
+  /* 1011011110 */ V(2, 1, 5),
+  /* 1011011111 */ V(2, 1, 5),
+  /* 1011100000 */ V(0, 2, 6),
+  /* 1011100001 */ V(0, 2, 6),
+  /* 1011100010 */ V(0, 2, 6),
+  /* 1011100011 */ V(0, 2, 6),
+  /* 1011100100 */ V(0, 2, 6),
+  /* 1011100101 */ V(0, 2, 6),
+  /* 1011100110 */ V(0, 2, 6),
+  /* 1011100111 */ V(0, 2, 6),
+  /* 1011101000 */ V(0, 2, 6),
+  /* 1011101001 */ V(0, 2, 6),
+  /* 1011101010 */ V(0, 2, 6),
+  /* 1011101011 */ V(0, 2, 6),
+  /* 1011101100 */ V(0, 2, 6),
+  /* 1011101101 */ V(0, 2, 6),
+  /* 1011101110 */ V(0, 2, 6),
+  /* 1011101111 */ V(0, 2, 6),
+  /* 1011110000 */ V(2, 0, 6),
+  /* 1011110001 */ V(2, 0, 6),
+  /* 1011110010 */ V(2, 0, 6),
+  /* 1011110011 */ V(2, 0, 6),
+  /* 1011110100 */ V(2, 0, 6),
+  /* 1011110101 */ V(2, 0, 6),
+  /* 1011110110 */ V(2, 0, 6),
+  /* 1011110111 */ V(2, 0, 6),
+  /* 1011111000 */ V(2, 0, 6),
+  /* 1011111001 */ V(2, 0, 6),
+  /* 1011111010 */ V(2, 0, 6),
+  /* 1011111011 */ V(2, 0, 6),
+  /* 1011111100 */ V(2, 0, 6),
+  /* 1011111101 */ V(2, 0, 6),
+  /* 1011111110 */ V(2, 0, 6),
+  /* 1011111111 */ V(2, 0, 6),
+  /* 1100000000 */ V(1, 1, 4),
+  /* 1100000001 */ V(1, 1, 4),
+  /* 1100000010 */ V(1, 1, 4),
+  /* 1100000011 */ V(1, 1, 4),
+  /* 1100000100 */ V(1, 1, 4),
+  /* 1100000101 */ V(1, 1, 4),
+  /* 1100000110 */ V(1, 1, 4),
+  /* 1100000111 */ V(1, 1, 4),
+  /* 1100001000 */ V(1, 1, 4),
+  /* 1100001001 */ V(1, 1, 4),
+  /* 1100001010 */ V(1, 1, 4),
+  /* 1100001011 */ V(1, 1, 4),
+  /* 1100001100 */ V(1, 1, 4),
+  /* 1100001101 */ V(1, 1, 4),
+  /* 1100001110 */ V(1, 1, 4),
+  /* 1100001111 */ V(1, 1, 4),
+  /* 1100010000 */ V(1, 1, 4),
+  /* 1100010001 */ V(1, 1, 4),
+  /* 1100010010 */ V(1, 1, 4),
+  /* 1100010011 */ V(1, 1, 4),
+  /* 1100010100 */ V(1, 1, 4),
+  /* 1100010101 */ V(1, 1, 4),
+  /* 1100010110 */ V(1, 1, 4),
+  /* 1100010111 */ V(1, 1, 4),
+  /* 1100011000 */ V(1, 1, 4),
+  /* 1100011001 */ V(1, 1, 4),
+  /* 1100011010 */ V(1, 1, 4),
+  /* 1100011011 */ V(1, 1, 4),
+  /* 1100011100 */ V(1, 1, 4),
+  /* 1100011101 */ V(1, 1, 4),
+  /* 1100011110 */ V(1, 1, 4),
+  /* 1100011111 */ V(1, 1, 4),
+  /* 1100100000 */ V(1, 1, 4),
+  /* 1100100001 */ V(1, 1, 4),
+  /* 1100100010 */ V(1, 1, 4),
+  /* 1100100011 */ V(1, 1, 4),
+  /* 1100100100 */ V(1, 1, 4),
+  /* 1100100101 */ V(1, 1, 4),
+  /* 1100100110 */ V(1, 1, 4),
+  /* 1100100111 */ V(1, 1, 4),
+  /* 1100101000 */ V(1, 1, 4),
+  /* 1100101001 */ V(1, 1, 4),
+  /* 1100101010 */ V(1, 1, 4),
+  /* 1100101011 */ V(1, 1, 4),
+  /* 1100101100 */ V(1, 1, 4),
+  /* 1100101101 */ V(1, 1, 4),
+  /* 1100101110 */ V(1, 1, 4),
+  /* 1100101111 */ V(1, 1, 4),
+  /* 1100110000 */ V(1, 1, 4),
+  /* 1100110001 */ V(1, 1, 4),
+  /* 1100110010 */ V(1, 1, 4),
+  /* 1100110011 */ V(1, 1, 4),
+  /* 1100110100 */ V(1, 1, 4),
+  /* 1100110101 */ V(1, 1, 4),
+  /* 1100110110 */ V(1, 1, 4),
+  /* 1100110111 */ V(1, 1, 4),
+  /* 1100111000 */ V(1, 1, 4),
+  /* 1100111001 */ V(1, 1, 4),
+  /* 1100111010 */ V(1, 1, 4),
+  /* 1100111011 */ V(1, 1, 4),
+  /* 1100111100 */ V(1, 1, 4),
+  /* 1100111101 */ V(1, 1, 4),
+  /* 1100111110 */ V(1, 1, 4),
+  /* 1100111111 */ V(1, 1, 4),
+  /* 1101000000 */ V(0, 1, 4),
+  /* 1101000001 */ V(0, 1, 4),
+  /* 1101000010 */ V(0, 1, 4),
+  /* 1101000011 */ V(0, 1, 4),
+  /* 1101000100 */ V(0, 1, 4),
+  /* 1101000101 */ V(0, 1, 4),
+  /* 1101000110 */ V(0, 1, 4),
+  /* 1101000111 */ V(0, 1, 4),
+  /* 1101001000 */ V(0, 1, 4),
+  /* 1101001001 */ V(0, 1, 4),
+  /* 1101001010 */ V(0, 1, 4),
+  /* 1101001011 */ V(0, 1, 4),
+  /* 1101001100 */ V(0, 1, 4),
+  /* 1101001101 */ V(0, 1, 4),
+  /* 1101001110 */ V(0, 1, 4),
+  /* 1101001111 */ V(0, 1, 4),
+  /* 1101010000 */ V(0, 1, 4),
+  /* 1101010001 */ V(0, 1, 4),
+  /* 1101010010 */ V(0, 1, 4),
+  /* 1101010011 */ V(0, 1, 4),
+  /* 1101010100 */ V(0, 1, 4),
+  /* 1101010101 */ V(0, 1, 4),
+  /* 1101010110 */ V(0, 1, 4),
+  /* 1101010111 */ V(0, 1, 4),
+  /* 1101011000 */ V(0, 1, 4),
+  /* 1101011001 */ V(0, 1, 4),
+  /* 1101011010 */ V(0, 1, 4),
+  /* 1101011011 */ V(0, 1, 4),
+  /* 1101011100 */ V(0, 1, 4),
+  /* 1101011101 */ V(0, 1, 4),
+  /* 1101011110 */ V(0, 1, 4),
+  /* 1101011111 */ V(0, 1, 4),
+  /* 1101100000 */ V(0, 1, 4),
+  /* 1101100001 */ V(0, 1, 4),
+  /* 1101100010 */ V(0, 1, 4),
+  /* 1101100011 */ V(0, 1, 4),
+  /* 1101100100 */ V(0, 1, 4),
+  /* 1101100101 */ V(0, 1, 4),
+  /* 1101100110 */ V(0, 1, 4),
+  /* 1101100111 */ V(0, 1, 4),
+  /* 1101101000 */ V(0, 1, 4),
+  /* 1101101001 */ V(0, 1, 4),
+  /* 1101101010 */ V(0, 1, 4),
+  /* 1101101011 */ V(0, 1, 4),
+  /* 1101101100 */ V(0, 1, 4),
+  /* 1101101101 */ V(0, 1, 4),
+  /* 1101101110 */ V(0, 1, 4),
+  /* 1101101111 */ V(0, 1, 4),
+  /* 1101110000 */ V(0, 1, 4),
+  /* 1101110001 */ V(0, 1, 4),
+  /* 1101110010 */ V(0, 1, 4),
+  /* 1101110011 */ V(0, 1, 4),
+  /* 1101110100 */ V(0, 1, 4),
+  /* 1101110101 */ V(0, 1, 4),
+  /* 1101110110 */ V(0, 1, 4),
+  /* 1101110111 */ V(0, 1, 4),
+  /* 1101111000 */ V(0, 1, 4),
+  /* 1101111001 */ V(0, 1, 4),
+  /* 1101111010 */ V(0, 1, 4),
+  /* 1101111011 */ V(0, 1, 4),
+  /* 1101111100 */ V(0, 1, 4),
+  /* 1101111101 */ V(0, 1, 4),
+  /* 1101111110 */ V(0, 1, 4),
+  /* 1101111111 */ V(0, 1, 4),
+  /* 1110000000 */ V(1, 0, 4),
+  /* 1110000001 */ V(1, 0, 4),
+  /* 1110000010 */ V(1, 0, 4),
+  /* 1110000011 */ V(1, 0, 4),
+  /* 1110000100 */ V(1, 0, 4),
+  /* 1110000101 */ V(1, 0, 4),
+  /* 1110000110 */ V(1, 0, 4),
+  /* 1110000111 */ V(1, 0, 4),
+  /* 1110001000 */ V(1, 0, 4),
+  /* 1110001001 */ V(1, 0, 4),
+  /* 1110001010 */ V(1, 0, 4),
+  /* 1110001011 */ V(1, 0, 4),
+  /* 1110001100 */ V(1, 0, 4),
+  /* 1110001101 */ V(1, 0, 4),
+  /* 1110001110 */ V(1, 0, 4),
+  /* 1110001111 */ V(1, 0, 4),
+  /* 1110010000 */ V(1, 0, 4),
+  /* 1110010001 */ V(1, 0, 4),
+  /* 1110010010 */ V(1, 0, 4),
+  /* 1110010011 */ V(1, 0, 4),
+  /* 1110010100 */ V(1, 0, 4),
+  /* 1110010101 */ V(1, 0, 4),
+  /* 1110010110 */ V(1, 0, 4),
+  /* 1110010111 */ V(1, 0, 4),
+  /* 1110011000 */ V(1, 0, 4),
+  /* 1110011001 */ V(1, 0, 4),
+  /* 1110011010 */ V(1, 0, 4),
+  /* 1110011011 */ V(1, 0, 4),
+  /* 1110011100 */ V(1, 0, 4),
+  /* 1110011101 */ V(1, 0, 4),
+  /* 1110011110 */ V(1, 0, 4),
+  /* 1110011111 */ V(1, 0, 4),
+  /* 1110100000 */ V(1, 0, 4),
+  /* 1110100001 */ V(1, 0, 4),
+  /* 1110100010 */ V(1, 0, 4),
+  /* 1110100011 */ V(1, 0, 4),
+  /* 1110100100 */ V(1, 0, 4),
+  /* 1110100101 */ V(1, 0, 4),
+  /* 1110100110 */ V(1, 0, 4),
+  /* 1110100111 */ V(1, 0, 4),
+  /* 1110101000 */ V(1, 0, 4),
+  /* 1110101001 */ V(1, 0, 4),
+  /* 1110101010 */ V(1, 0, 4),
+  /* 1110101011 */ V(1, 0, 4),
+  /* 1110101100 */ V(1, 0, 4),
+  /* 1110101101 */ V(1, 0, 4),
+  /* 1110101110 */ V(1, 0, 4),
+  /* 1110101111 */ V(1, 0, 4),
+  /* 1110110000 */ V(1, 0, 4),
+  /* 1110110001 */ V(1, 0, 4),
+  /* 1110110010 */ V(1, 0, 4),
+  /* 1110110011 */ V(1, 0, 4),
+  /* 1110110100 */ V(1, 0, 4),
+  /* 1110110101 */ V(1, 0, 4),
+  /* 1110110110 */ V(1, 0, 4),
+  /* 1110110111 */ V(1, 0, 4),
+  /* 1110111000 */ V(1, 0, 4),
+  /* 1110111001 */ V(1, 0, 4),
+  /* 1110111010 */ V(1, 0, 4),
+  /* 1110111011 */ V(1, 0, 4),
+  /* 1110111100 */ V(1, 0, 4),
+  /* 1110111101 */ V(1, 0, 4),
+  /* 1110111110 */ V(1, 0, 4),
+  /* 1110111111 */ V(1, 0, 4),
+  /* 1111000000 */ V(0, 0, 4),
+  /* 1111000001 */ V(0, 0, 4),
+  /* 1111000010 */ V(0, 0, 4),
+  /* 1111000011 */ V(0, 0, 4),
+  /* 1111000100 */ V(0, 0, 4),
+  /* 1111000101 */ V(0, 0, 4),
+  /* 1111000110 */ V(0, 0, 4),
+  /* 1111000111 */ V(0, 0, 4),
+  /* 1111001000 */ V(0, 0, 4),
+  /* 1111001001 */ V(0, 0, 4),
+  /* 1111001010 */ V(0, 0, 4),
+  /* 1111001011 */ V(0, 0, 4),
+  /* 1111001100 */ V(0, 0, 4),
+  /* 1111001101 */ V(0, 0, 4),
+  /* 1111001110 */ V(0, 0, 4),
+  /* 1111001111 */ V(0, 0, 4),
+  /* 1111010000 */ V(0, 0, 4),
+  /* 1111010001 */ V(0, 0, 4),
+  /* 1111010010 */ V(0, 0, 4),
+  /* 1111010011 */ V(0, 0, 4),
+  /* 1111010100 */ V(0, 0, 4),
+  /* 1111010101 */ V(0, 0, 4),
+  /* 1111010110 */ V(0, 0, 4),
+  /* 1111010111 */ V(0, 0, 4),
+  /* 1111011000 */ V(0, 0, 4),
+  /* 1111011001 */ V(0, 0, 4),
+  /* 1111011010 */ V(0, 0, 4),
+  /* 1111011011 */ V(0, 0, 4),
+  /* 1111011100 */ V(0, 0, 4),
+  /* 1111011101 */ V(0, 0, 4),
+  /* 1111011110 */ V(0, 0, 4),
+  /* 1111011111 */ V(0, 0, 4),
+  /* 1111100000 */ V(0, 0, 4),
+  /* 1111100001 */ V(0, 0, 4),
+  /* 1111100010 */ V(0, 0, 4),
+  /* 1111100011 */ V(0, 0, 4),
+  /* 1111100100 */ V(0, 0, 4),
+  /* 1111100101 */ V(0, 0, 4),
+  /* 1111100110 */ V(0, 0, 4),
+  /* 1111100111 */ V(0, 0, 4),
+  /* 1111101000 */ V(0, 0, 4),
+  /* 1111101001 */ V(0, 0, 4),
+  /* 1111101010 */ V(0, 0, 4),
+  /* 1111101011 */ V(0, 0, 4),
+  /* 1111101100 */ V(0, 0, 4),
+  /* 1111101101 */ V(0, 0, 4),
+  /* 1111101110 */ V(0, 0, 4),
+  /* 1111101111 */ V(0, 0, 4),
+  /* 1111110000 */ V(0, 0, 4),
+  /* 1111110001 */ V(0, 0, 4),
+  /* 1111110010 */ V(0, 0, 4),
+  /* 1111110011 */ V(0, 0, 4),
+  /* 1111110100 */ V(0, 0, 4),
+  /* 1111110101 */ V(0, 0, 4),
+  /* 1111110110 */ V(0, 0, 4),
+  /* 1111110111 */ V(0, 0, 4),
+  /* 1111111000 */ V(0, 0, 4),
+  /* 1111111001 */ V(0, 0, 4),
+  /* 1111111010 */ V(0, 0, 4),
+  /* 1111111011 */ V(0, 0, 4),
+  /* 1111111100 */ V(0, 0, 4),
+  /* 1111111101 */ V(0, 0, 4),
+  /* 1111111110 */ V(0, 0, 4),
+  /* 1111111111 */ V(0, 0, 4),
+
+  /* 0010 1100 10 ... */
+  /* 0    */ V(14, 14, 1),	/* 1024 */
+  /* 1    */ V(13, 14, 1),
 
-  /* 0100 0110 ... */
-  /* 00   */ V(14, 1, 2),	/* 252 */
-  /* 01   */ V(5, 13, 2),
-  /* 10   */ V(13, 5, 2),
-  /* 11   */ V(7, 12, 2),
-
-  /* 0100 0111 ... */
-  /* 00   */ V(12, 7, 2),	/* 256 */
-  /* 01   */ V(4, 13, 2),
-  /* 10   */ V(8, 11, 2),
-  /* 11   */ V(11, 8, 2),
-
-  /* 0100 1000 ... */
-  /* 00   */ V(13, 4, 2),	/* 260 */
-  /* 01   */ V(9, 10, 2),
-  /* 10   */ V(10, 9, 2),
-  /* 11   */ V(6, 12, 2),
-
-  /* 0100 1001 ... */
-  /* 00   */ V(12, 6, 2),	/* 264 */
-  /* 01   */ V(3, 13, 2),
-  /* 10   */ V(13, 3, 2),
-  /* 11   */ V(2, 13, 2),
-
-  /* 0100 1010 ... */
-  /* 00   */ V(13, 2, 2),	/* 268 */
-  /* 01   */ V(1, 13, 2),
-  /* 10   */ V(7, 11, 2),
-  /* 11   */ V(11, 7, 2),
-
-  /* 0100 1011 ... */
-  /* 00   */ V(13, 1, 2),	/* 272 */
-  /* 01   */ V(5, 12, 2),
-  /* 10   */ V(12, 5, 2),
-  /* 11   */ V(8, 10, 2),
-
-  /* 0100 1100 ... */
-  /* 00   */ V(10, 8, 2),	/* 276 */
-  /* 01   */ V(9, 9, 2),
-  /* 10   */ V(4, 12, 2),
-  /* 11   */ V(12, 4, 2),
-
-  /* 0100 1101 ... */
-  /* 000  */ V(6, 11, 2),	/* 280 */
-  /* 001  */ V(6, 11, 2),
-  /* 010  */ V(11, 6, 2),
-  /* 011  */ V(11, 6, 2),
-  /* 100  */ V(13, 0, 3),
-  /* 101  */ V(0, 12, 3),
-  /* 110  */ V(3, 12, 2),
-  /* 111  */ V(3, 12, 2),
+  /* 0010 1100 11 ... */
+  /* 0    */ V(14, 13, 1),	/* 1026 */
+  /* 1    */ V(12, 14, 1),
 
-  /* 0100 1110 ... */
-  /* 00   */ V(12, 3, 2),	/* 288 */
-  /* 01   */ V(7, 10, 2),
-  /* 10   */ V(10, 7, 2),
-  /* 11   */ V(2, 12, 2),
-
-  /* 0100 1111 ... */
-  /* 00   */ V(12, 2, 2),	/* 292 */
-  /* 01   */ V(5, 11, 2),
-  /* 10   */ V(11, 5, 2),
-  /* 11   */ V(1, 12, 2),
-
-  /* 0101 0000 ... */
-  /* 00   */ V(8, 9, 2),	/* 296 */
-  /* 01   */ V(9, 8, 2),
-  /* 10   */ V(12, 1, 2),
-  /* 11   */ V(4, 11, 2),
-
-  /* 0101 0001 ... */
-  /* 000  */ V(12, 0, 3),	/* 300 */
-  /* 001  */ V(0, 11, 3),
-  /* 010  */ V(3, 11, 2),
-  /* 011  */ V(3, 11, 2),
-  /* 100  */ V(11, 0, 3),
-  /* 101  */ V(0, 10, 3),
-  /* 110  */ V(1, 10, 2),
-  /* 111  */ V(1, 10, 2),
-
-  /* 0101 0010 ... */
-  /* 00   */ V(11, 4, 1),	/* 308 */
-  /* 01   */ V(11, 4, 1),
-  /* 10   */ V(6, 10, 2),
-  /* 11   */ V(10, 6, 2),
-
-  /* 0101 0011 ... */
-  /* 000  */ V(7, 9, 2),	/* 312 */
-  /* 001  */ V(7, 9, 2),
-  /* 010  */ V(9, 7, 2),
-  /* 011  */ V(9, 7, 2),
-  /* 100  */ V(10, 0, 3),
-  /* 101  */ V(0, 9, 3),
-  /* 110  */ V(9, 0, 2),
-  /* 111  */ V(9, 0, 2),
-
-  /* 0101 0100 ... */
-  /* 0    */ V(11, 3, 1),	/* 320 */
-  /* 1    */ V(8, 8, 1),
-
-  /* 0101 0101 ... */
-  /* 00   */ V(2, 11, 2),	/* 322 */
-  /* 01   */ V(5, 10, 2),
-  /* 10   */ V(11, 2, 1),
-  /* 11   */ V(11, 2, 1),
-
-  /* 0101 0110 ... */
-  /* 00   */ V(10, 5, 2),	/* 326 */
-  /* 01   */ V(1, 11, 2),
-  /* 10   */ V(11, 1, 2),
-  /* 11   */ V(6, 9, 2),
+  /* 0010 1101 00 ... */
+  /* 0    */ V(14, 12, 1),	/* 1028 */
+  /* 1    */ V(13, 13, 1),
 
-  /* 0101 0111 ... */
-  /* 0    */ V(9, 6, 1),	/* 330 */
-  /* 1    */ V(10, 4, 1),
+  /* 0010 1101 01 ... */
+  /* 0    */ V(11, 14, 1),	/* 1030 */
+  /* 1    */ V(14, 11, 1),
 
-  /* 0101 1000 ... */
-  /* 00   */ V(4, 10, 2),	/* 332 */
-  /* 01   */ V(7, 8, 2),
-  /* 10   */ V(8, 7, 1),
-  /* 11   */ V(8, 7, 1),
+  /* 0010 1101 10 ... */
+  /* 0    */ V(12, 13, 1),	/* 1032 */
+  /* 1    */ V(13, 12, 1),
 
-  /* 0101 1001 ... */
-  /* 0    */ V(3, 10, 1),	/* 336 */
-  /* 1    */ V(10, 3, 1),
+  /* 0010 1101 11 ... */
+  /* 0    */ V(10, 14, 1),	/* 1034 */
+  /* 1    */ V(14, 10, 1),
 
-  /* 0101 1010 ... */
-  /* 0    */ V(5, 9, 1),	/* 338 */
-  /* 1    */ V(9, 5, 1),
+  /* 0010 1110 00 ... */
+  /* 0    */ V(11, 13, 1),	/* 1036 */
+  /* 1    */ V(13, 11, 1),
 
-  /* 0101 1011 ... */
-  /* 0    */ V(2, 10, 1),	/* 340 */
-  /* 1    */ V(10, 2, 1),
+  /* 0010 1110 01 ... */
+  /* 0    */ V(12, 12, 1),	/* 1038 */
+  /* 1    */ V(9, 14, 1),
 
-  /* 0101 1100 ... */
-  /* 0    */ V(10, 1, 1),	/* 342 */
-  /* 1    */ V(6, 8, 1),
+  /* 0010 1110 10 ... */
+  /* 0    */ V(14, 9, 1),	/* 1040 */
+  /* 1    */ V(10, 13, 1),
 
-  /* 0101 1101 ... */
-  /* 0    */ V(8, 6, 1),	/* 344 */
-  /* 1    */ V(7, 7, 1),
+  /* 0010 1110 11 ... */
+  /* 0    */ V(13, 10, 1),	/* 1042 */
+  /* 1    */ V(11, 12, 1),
 
-  /* 0101 1110 ... */
-  /* 0    */ V(4, 9, 1),	/* 346 */
-  /* 1    */ V(9, 4, 1),
+  /* 0010 1111 00 ... */
+  /* 0    */ V(12, 11, 1),	/* 1044 */
+  /* 1    */ V(8, 14, 1),
 
-  /* 0101 1111 ... */
-  /* 0    */ V(3, 9, 1),	/* 348 */
-  /* 1    */ V(9, 3, 1),
+  /* 0010 1111 01 ... */
+  /* 0    */ V(14, 8, 1),	/* 1046 */
+  /* 1    */ V(9, 13, 1),
 
-  /* 0110 0000 ... */
-  /* 0    */ V(5, 8, 1),	/* 350 */
-  /* 1    */ V(8, 5, 1),
+  /* 0010 1111 10 ... */
+  /* 0    */ V(13, 9, 1),	/* 1048 */
+  /* 1    */ V(7, 14, 1),
 
-  /* 0110 0001 ... */
-  /* 0    */ V(2, 9, 1),	/* 352 */
-  /* 1    */ V(6, 7, 1),
+  /* 0010 1111 11 ... */
+  /* 0    */ V(14, 7, 1),	/* 1050 */
+  /* 1    */ V(10, 12, 1),
 
-  /* 0110 0010 ... */
-  /* 0    */ V(7, 6, 1),	/* 354 */
-  /* 1    */ V(9, 2, 1),
+  /* 0100 0000 00 ... */
+  /* 0    */ V(12, 10, 1),	/* 1052 */
+  /* 1    */ V(11, 11, 1),
 
-  /* 0110 0011 ... */
-  /* 0    */ V(1, 9, 1),	/* 356 */
-  /* 1    */ V(9, 1, 1),
+  /* 0100 0000 01 ... */
+  /* 0    */ V(8, 13, 1),	/* 1054 */
+  /* 1    */ V(13, 8, 1),
 
-  /* 0110 0100 ... */
-  /* 0    */ V(4, 8, 1),	/* 358 */
-  /* 1    */ V(8, 4, 1),
+  /* 0100 0000 10 ... */
+  /* 00   */ V(0, 14, 2),	/* 1056 */
+  /* 01   */ V(14, 0, 2),
+  /* 10   */ V(0, 13, 1),
+  /* 11   */ V(0, 13, 1),
 
-  /* 0110 0101 ... */
-  /* 0    */ V(5, 7, 1),	/* 360 */
-  /* 1    */ V(7, 5, 1),
+  /* 0100 0001 00 ... */
+  /* 0    */ V(6, 14, 1),	/* 1060 */
+  /* 1    */ V(9, 12, 1),
 
-  /* 0110 0110 ... */
-  /* 0    */ V(3, 8, 1),	/* 362 */
-  /* 1    */ V(8, 3, 1),
+  /* 0100 0010 01 ... */
+  /* 0    */ V(10, 11, 1),	/* 1062 */
+  /* 1    */ V(7, 13, 1),
 
-  /* 0110 0111 ... */
-  /* 0    */ V(6, 6, 1),	/* 364 */
-  /* 1    */ V(2, 8, 1),
+  /* 0100 0011 10 ... */
+  /* 0    */ V(4, 14, 1),	/* 1064 */
+  /* 1    */ V(2, 14, 1),
 
-  /* 0110 1000 ... */
-  /* 0    */ V(8, 2, 1),	/* 366 */
-  /* 1    */ V(1, 8, 1),
+  /* 0100 1101 10 ... */
+  /* 0    */ V(13, 0, 1),	/* 1066 */
+  /* 1    */ V(0, 12, 1),
 
-  /* 0110 1001 ... */
-  /* 0    */ V(4, 7, 1),	/* 368 */
-  /* 1    */ V(7, 4, 1),
+  /* 0101 0001 00 ... */
+  /* 0    */ V(12, 0, 1),	/* 1068 */
+  /* 1    */ V(0, 11, 1),
+
+  /* 0101 0001 10 ... */
+  /* 0    */ V(11, 0, 1),	/* 1070 */
+  /* 1    */ V(0, 10, 1),
 
-  /* 0110 1010 ... */
-  /* 00   */ V(8, 1, 1),	/* 370 */
-  /* 01   */ V(8, 1, 1),
-  /* 10   */ V(0, 8, 2),
-  /* 11   */ V(8, 0, 2),
-
-  /* 0110 1011 ... */
-  /* 0    */ V(5, 6, 1),	/* 374 */
-  /* 1    */ V(6, 5, 1),
-
-  /* 0110 1100 ... */
-  /* 00   */ V(1, 7, 1),	/* 376 */
-  /* 01   */ V(1, 7, 1),
-  /* 10   */ V(0, 7, 2),
-  /* 11   */ V(7, 0, 2),
-
-  /* 0110 1110 ... */
-  /* 0    */ V(3, 7, 1),	/* 380  */
-  /* 1    */ V(2, 7, 1),
-
-  /* 0111 1100 ... */
-  /* 0    */ V(0, 6, 1),	/* 382 */
-  /* 1    */ V(6, 0, 1),
-
-  /* 1000 0011 ... */
-  /* 0    */ V(0, 5, 1),	/* 384 */
-  /* 1    */ V(5, 0, 1)
+  /* 0101 0011 10 ... */
+  /* 0    */ V(10, 0, 1),	/* 1072 */
+  /* 1    */ V(0, 9, 1)
 };
 
 # undef V
@@ -3074,36 +11523,36 @@ union huffpair const hufftab24[] = {
 union huffquad const *const mad_huff_quad_table[2] = { hufftabA, hufftabB };
 
 struct hufftable const mad_huff_pair_table[32] = {
-  /*  0 */ { hufftab0,   0, 0 },
-  /*  1 */ { hufftab1,   0, 3 },
-  /*  2 */ { hufftab2,   0, 3 },
-  /*  3 */ { hufftab3,   0, 3 },
+  /*  0 */ { hufftab0,   0,  0 },
+  /*  1 */ { hufftab1,   0,  3 },
+  /*  2 */ { hufftab2,   0,  6 },
+  /*  3 */ { hufftab3,   0,  6 },
   /*  4 */ { 0 /* not used */ },
-  /*  5 */ { hufftab5,   0, 3 },
-  /*  6 */ { hufftab6,   0, 4 },
-  /*  7 */ { hufftab7,   0, 4 },
-  /*  8 */ { hufftab8,   0, 4 },
-  /*  9 */ { hufftab9,   0, 4 },
-  /* 10 */ { hufftab10,  0, 4 },
-  /* 11 */ { hufftab11,  0, 4 },
-  /* 12 */ { hufftab12,  0, 4 },
-  /* 13 */ { hufftab13,  0, 4 },
+  /*  5 */ { hufftab5,   0,  8 },
+  /*  6 */ { hufftab6,   0,  7 },
+  /*  7 */ { hufftab7,   0, 10 },
+  /*  8 */ { hufftab8,   0, 10 },
+  /*  9 */ { hufftab9,   0,  9 },
+  /* 10 */ { hufftab10,  0, 10 },
+  /* 11 */ { hufftab11,  0, 10 },
+  /* 12 */ { hufftab12,  0, 10 },
+  /* 13 */ { hufftab13,  0, 10 },
   /* 14 */ { 0 /* not used */ },
-  /* 15 */ { hufftab15,  0, 4 },
-  /* 16 */ { hufftab16,  1, 4 },
-  /* 17 */ { hufftab16,  2, 4 },
-  /* 18 */ { hufftab16,  3, 4 },
-  /* 19 */ { hufftab16,  4, 4 },
-  /* 20 */ { hufftab16,  6, 4 },
-  /* 21 */ { hufftab16,  8, 4 },
-  /* 22 */ { hufftab16, 10, 4 },
-  /* 23 */ { hufftab16, 13, 4 },
-  /* 24 */ { hufftab24,  4, 4 },
-  /* 25 */ { hufftab24,  5, 4 },
-  /* 26 */ { hufftab24,  6, 4 },
-  /* 27 */ { hufftab24,  7, 4 },
-  /* 28 */ { hufftab24,  8, 4 },
-  /* 29 */ { hufftab24,  9, 4 },
-  /* 30 */ { hufftab24, 11, 4 },
-  /* 31 */ { hufftab24, 13, 4 }
+  /* 15 */ { hufftab15,  0, 10 },
+  /* 16 */ { hufftab16,  1, 10 },
+  /* 17 */ { hufftab16,  2, 10 },
+  /* 18 */ { hufftab16,  3, 10 },
+  /* 19 */ { hufftab16,  4, 10 },
+  /* 20 */ { hufftab16,  6, 10 },
+  /* 21 */ { hufftab16,  8, 10 },
+  /* 22 */ { hufftab16, 10, 10 },
+  /* 23 */ { hufftab16, 13, 10 },
+  /* 24 */ { hufftab24,  4, 10 },
+  /* 25 */ { hufftab24,  5, 10 },
+  /* 26 */ { hufftab24,  6, 10 },
+  /* 27 */ { hufftab24,  7, 10 },
+  /* 28 */ { hufftab24,  8, 10 },
+  /* 29 */ { hufftab24,  9, 10 },
+  /* 30 */ { hufftab24, 11, 10 },
+  /* 31 */ { hufftab24, 13, 10 }
 };
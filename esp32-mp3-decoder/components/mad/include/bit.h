@@ -22,26 +22,64 @@
 # ifndef LIBMAD_BIT_H
 # define LIBMAD_BIT_H
 
+/*
+ * Bits are read through a big-endian reservoir of one machine word, kept
+ * MSB-aligned in cache. It is refilled with whole bytes, a word at a time
+ * where possible, but never past the end of the current segment.
+ */
+
+# define MAD_BIT_CACHEBITS  (sizeof(unsigned long) * 8)
+
 struct mad_bitptr {
-  unsigned char const *byte;
-  unsigned short cache;
-  unsigned short left;
+  unsigned char const *byte;		/* next byte to load into cache */
+  unsigned long cache;			/* unread bits, MSB first */
+  unsigned short left;			/* number of bits in cache */
+
+  unsigned char const *end;		/* end of first segment (or 0) */
+  unsigned char const *next;		/* start of second segment */
 };
 
 void mad_bit_init(struct mad_bitptr *, unsigned char const *);
+void mad_bit_split(struct mad_bitptr *,
+		   unsigned char const *, unsigned char const *);
 
 # define mad_bit_finish(bitptr)		/* nothing */
 
 unsigned int mad_bit_length(struct mad_bitptr const *,
 			    struct mad_bitptr const *);
 
-# define mad_bit_bitsleft(bitptr)  ((bitptr)->left)
+# define mad_bit_bitsleft(bitptr)  ((((bitptr)->left + 7) & 7) + 1)
 unsigned char const *mad_bit_nextbyte(struct mad_bitptr const *);
 
+void mad_bit_refill(struct mad_bitptr *);
+
+/* peek/consume 0 .. MAD_BIT_CACHEBITS - 1 bits; need at most left bits */
+
+# define mad_bit_peek(bitptr, len)  \
+    (((bitptr)->cache >> 1) >> (MAD_BIT_CACHEBITS - 1 - (len)))
+# define mad_bit_consume(bitptr, len)  \
+    ((void) ((bitptr)->cache <<= (len), (bitptr)->left -= (len)))
+
 void mad_bit_skip(struct mad_bitptr *, unsigned int);
 unsigned long mad_bit_read(struct mad_bitptr *, unsigned int);
 void mad_bit_write(struct mad_bitptr *, unsigned int, unsigned long);
 
+/* read up to 24 bits, from the cache when it holds enough */
+
+static inline
+unsigned long mad_bit_get(struct mad_bitptr *bitptr, unsigned int len)
+{
+  unsigned long value;
+
+  if (bitptr->left < len)
+    return mad_bit_read(bitptr, len);
+
+  value = mad_bit_peek(bitptr, len);
+  mad_bit_consume(bitptr, len);
+
+  return value;
+}
+
 unsigned short mad_bit_crc(struct mad_bitptr, unsigned int, unsigned short);
 
 # endif
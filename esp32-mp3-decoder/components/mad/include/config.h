@@ -19,6 +19,20 @@
 /* Define to enable a fast subband synthesis approximation optimization. */
 #define OPT_SSO
 
+/* Define to run subband synthesis on 16-bit window coefficients and
+   filterbank values (16x16->32-bit multiplies), for half the memory and a
+   cheaper multiply at some cost in accuracy. Requires OPT_SSO. */
+/* #undef OPT_SYNTH16 */
+
+/* Define to keep the subband synthesis DCT and the Layer III IMDCT one slot
+   or subband at a time even where they could run on several at once with
+   vector instructions. */
+/* #undef OPT_DCT_SCALAR */
+
+/* Define to keep the subband synthesis window on the scalar code even where
+   there are SIMD kernels for it. */
+/* #undef OPT_SYNTH_SCALAR */
+
 /* Define to influence a strict interpretation of the ISO/IEC standards, even
    if this is in opposition with best accepted practices. */
 /* #undef OPT_STRICT */
@@ -69,7 +83,13 @@
 /* #undef inline */
 #endif
 
+/* Define FPM_64BIT for full 64-bit intermediate products, or FPM_FLOAT for
+   single-precision floating point on targets with an FPU, e.g. with
+   CFLAGS += -DFPM_FLOAT in component.mk; the default is 32-bit fixed
+   point. */
+#if !defined(FPM_64BIT) && !defined(FPM_FLOAT)
 #define FPM_DEFAULT
+#endif
 
 /* Define to `int' if <sys/types.h> does not define. */
 /* #undef pid_t */
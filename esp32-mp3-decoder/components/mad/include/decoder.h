@@ -39,10 +39,18 @@ enum mad_flow {
 };
 
  
+/*
+ * Per-instance decoder context. Everything a decoder writes to while
+ * running lives here, so several instances can decode concurrently (e.g.
+ * one per core); the constant tables in ROM/flash stay shared.
+ */
 struct sync_t {
     struct mad_stream stream;	// definito main_data_t un array di circa 4K
     struct mad_frame frame;
     struct mad_synth synth;
+
+    main_data_t main_data;		/* Layer III bit reservoir     519 */
+    mad_fixed_t overlap[2][32][18];	/* Layer III block overlap data 4608 */
 };
 
 // # define MAD_BUFFER_GUARD	8
@@ -119,6 +127,9 @@ int mad_decoder_finish(struct mad_decoder *);
 # define mad_decoder_options(decoder, opts)  \
     ((void) ((decoder)->options = (opts)))
 
+void mad_sync_init(struct sync_t *);
+void mad_sync_finish(struct sync_t *);
+
 int mad_decoder_run(struct mad_decoder *, enum mad_decoder_mode);
 int mad_decoder_message(struct mad_decoder *, void *, unsigned int *);
 
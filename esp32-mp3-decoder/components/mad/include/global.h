@@ -57,7 +57,4 @@
 //#  endif
 # endif
 
-void render_sample_block(short *short_sample_buff, int no_samples);
-void set_dac_sample_rate(int rate);
-
 # endif
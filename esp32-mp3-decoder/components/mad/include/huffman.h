@@ -41,17 +41,17 @@ union huffquad {
 
 union huffpair {
   struct {
-    unsigned int final  :  1;
-    unsigned int bits   :  3;
-    unsigned int offset : 12;
+    unsigned short final  :  1;
+    unsigned short bits   :  4;
+    unsigned short offset : 11;
   } ptr;
   struct {
-    unsigned int final  :  1;
-    unsigned int hlen   :  3;
-    unsigned int x      :  4;
-    unsigned int y      :  4;
+    unsigned short final  :  1;
+    unsigned short hlen   :  4;
+    unsigned short x      :  4;
+    unsigned short y      :  4;
   } value;
-  unsigned int final    :  1;
+  unsigned short final    :  1;
 };
 
 struct hufftable {
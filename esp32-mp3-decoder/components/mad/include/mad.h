@@ -65,7 +65,12 @@ extern char const mad_build[];
 # ifndef LIBMAD_FIXED_H
 # define LIBMAD_FIXED_H
 
-# if SIZEOF_INT >= 4
+# if defined(FPM_FLOAT)
+typedef float mad_fixed_t;
+
+typedef float mad_fixed64hi_t;
+typedef float mad_fixed64lo_t;
+# elif SIZEOF_INT >= 4
 typedef   signed int mad_fixed_t;
 
 typedef   signed int mad_fixed64hi_t;
@@ -150,13 +155,36 @@ typedef mad_fixed_t mad_sample_t;
 # define mad_f_sub(x, y)	((x) - (y))
 
 # if defined(FPM_FLOAT)
-#  error "FPM_FLOAT not yet supported"
 
-#  undef MAD_F
-#  define MAD_F(x)		mad_f_todouble(x)
+/*
+ * This version uses single-precision floating point throughout, for targets
+ * with a hardware FPU. The fixed-point constants above are converted at
+ * compile time and MAD_F_ONE is still 1.0, so the decoder itself needs no
+ * changes other than where it manipulates the bits of a sample.
+ */
+#  undef  MAD_F
+#  define MAD_F(x)		((mad_fixed_t)  \
+				 ((x) / (double) (1L << MAD_F_FRACBITS)))
+
+#  undef  MAD_F_MIN
+#  undef  MAD_F_MAX
+#  define MAD_F_MIN		((mad_fixed_t) -8.0)
+#  define MAD_F_MAX		((mad_fixed_t) +8.0)
+
+#  undef  mad_f_tofixed
+#  undef  mad_f_todouble
+#  define mad_f_tofixed(x)	((mad_fixed_t) (x))
+#  define mad_f_todouble(x)	((double) (x))
+
+#  undef  mad_f_intpart
+#  undef  mad_f_fracpart
+#  undef  mad_f_fromint
+#  define mad_f_intpart(x)	((signed long) (x))
+#  define mad_f_fracpart(x)	((x) - mad_f_intpart(x))
+#  define mad_f_fromint(x)	((mad_fixed_t) (x))
 
 #  define mad_f_mul(x, y)	((x) * (y))
-#  define mad_f_scale64
+#  define mad_f_scale64(hi, lo)	((void) (hi), (mad_fixed_t) (lo))
 
 #  undef ASO_ZEROCHECK
 
@@ -546,26 +574,64 @@ mad_fixed_t mad_f_div(mad_fixed_t, mad_fixed_t);
 # ifndef LIBMAD_BIT_H
 # define LIBMAD_BIT_H
 
+/*
+ * Bits are read through a big-endian reservoir of one machine word, kept
+ * MSB-aligned in cache. It is refilled with whole bytes, a word at a time
+ * where possible, but never past the end of the current segment.
+ */
+
+# define MAD_BIT_CACHEBITS  (sizeof(unsigned long) * 8)
+
 struct mad_bitptr {
-  unsigned char const *byte;
-  unsigned short cache;
-  unsigned short left;
+  unsigned char const *byte;		/* next byte to load into cache */
+  unsigned long cache;			/* unread bits, MSB first */
+  unsigned short left;			/* number of bits in cache */
+
+  unsigned char const *end;		/* end of first segment (or 0) */
+  unsigned char const *next;		/* start of second segment */
 };
 
 void mad_bit_init(struct mad_bitptr *, unsigned char const *);
+void mad_bit_split(struct mad_bitptr *,
+		   unsigned char const *, unsigned char const *);
 
 # define mad_bit_finish(bitptr)		/* nothing */
 
 unsigned int mad_bit_length(struct mad_bitptr const *,
 			    struct mad_bitptr const *);
 
-# define mad_bit_bitsleft(bitptr)  ((bitptr)->left)
+# define mad_bit_bitsleft(bitptr)  ((((bitptr)->left + 7) & 7) + 1)
 unsigned char const *mad_bit_nextbyte(struct mad_bitptr const *);
 
+void mad_bit_refill(struct mad_bitptr *);
+
+/* peek/consume 0 .. MAD_BIT_CACHEBITS - 1 bits; need at most left bits */
+
+# define mad_bit_peek(bitptr, len)  \
+    (((bitptr)->cache >> 1) >> (MAD_BIT_CACHEBITS - 1 - (len)))
+# define mad_bit_consume(bitptr, len)  \
+    ((void) ((bitptr)->cache <<= (len), (bitptr)->left -= (len)))
+
 void mad_bit_skip(struct mad_bitptr *, unsigned int);
 unsigned long mad_bit_read(struct mad_bitptr *, unsigned int);
 void mad_bit_write(struct mad_bitptr *, unsigned int, unsigned long);
 
+/* read up to 24 bits, from the cache when it holds enough */
+
+static inline
+unsigned long mad_bit_get(struct mad_bitptr *bitptr, unsigned int len)
+{
+  unsigned long value;
+
+  if (bitptr->left < len)
+    return mad_bit_read(bitptr, len);
+
+  value = mad_bit_peek(bitptr, len);
+  mad_bit_consume(bitptr, len);
+
+  return value;
+}
+
 unsigned short mad_bit_crc(struct mad_bitptr, unsigned int, unsigned short);
 
 # endif
@@ -659,7 +725,7 @@ void mad_timer_string(mad_timer_t, char *, char const *,
 
 
 # define MAD_BUFFER_GUARD	8
-# define MAD_BUFFER_MDLEN	(511 + 2048 + MAD_BUFFER_GUARD)
+# define MAD_BUFFER_MDLEN	(511 + MAD_BUFFER_GUARD)
 
 enum mad_error {
   MAD_ERROR_NONE	   = 0x0000,	/* no error */
@@ -712,31 +778,57 @@ struct mad_stream {
   main_data_t *main_data;
 
 					/* Layer III main_data() */
+  unsigned char const *md_ptr;		/* main_data still in buffer (or 0) */
   unsigned int md_len;			/* bytes in main_data */
 
   int options;				/* decoding options (see below) */
   enum mad_error error;			/* error code (see above) */
+
+  struct mad_worker const *worker;	/* second core (or 0) */
+};
+
+/*
+ * A second core (or thread) to run half of the work of a stereo frame on.
+ * start() runs job(arg) there and returns right away; wait() returns when
+ * that job is done. Layer III and the synthesis use it to process channel 1
+ * while the caller does channel 0.
+ */
+struct mad_worker {
+  void (*start)(void *, void (*)(void *), void *);
+  void (*wait)(void *);
+  void *data;				/* passed to start() and wait() */
 };
 
 enum {
   MAD_OPTION_IGNORECRC      = 0x0001,	/* ignore CRC errors */
-  MAD_OPTION_HALFSAMPLERATE = 0x0002	/* generate PCM at 1/2 sample rate */
-# if 0  /* not yet implemented */
+  MAD_OPTION_HALFSAMPLERATE = 0x0002,	/* generate PCM at 1/2 sample rate */
   MAD_OPTION_LEFTCHANNEL    = 0x0010,	/* decode left channel only */
   MAD_OPTION_RIGHTCHANNEL   = 0x0020,	/* decode right channel only */
-  MAD_OPTION_SINGLECHANNEL  = 0x0030	/* combine channels */
-# endif
+  MAD_OPTION_SINGLECHANNEL  = 0x0030,	/* combine channels */
+  MAD_OPTION_SBLIMIT        = 0x1f00	/* drop high subbands (see below) */
 };
 
+/*
+ * Decode only the lowest n (2..32) of the 32 subbands, which limits the
+ * audio bandwidth to n/64 of the sample rate: 16 subbands are 11 kHz and
+ * 20 subbands 13.8 kHz at 44.1 kHz. Layer III skips the Huffman decoding,
+ * requantization and IMDCT of everything above the cap.
+ */
+# define MAD_OPTION_SUBBANDS(n)	(((32 - (n)) << 8) & MAD_OPTION_SBLIMIT)
+# define MAD_SBLIMIT(options)	(32 - (((options) & MAD_OPTION_SBLIMIT) >> 8))
+
 void mad_stream_init(struct mad_stream *);
 void mad_stream_finish(struct mad_stream *);
 
 # define mad_stream_options(stream, opts)  \
     ((void) ((stream)->options = (opts)))
+# define mad_stream_worker(stream, wrk)  \
+    ((void) ((stream)->worker = (wrk)))
 
 void mad_stream_buffer(struct mad_stream *,
 		       unsigned char const *, unsigned long);
 void mad_stream_skip(struct mad_stream *, unsigned long);
+void mad_stream_detach(struct mad_stream *);
 
 int mad_stream_sync(struct mad_stream *);
 
@@ -847,19 +939,53 @@ void mad_frame_mute(struct mad_frame *);
 # define LIBMAD_SYNTH_H
 
 
+/* PCM sample formats */
+enum mad_pcm_format {
+  MAD_PCM_FORMAT_S16 = 0		/* signed 16-bit, native byte order */
+};
+
+/* PCM channel layouts */
+enum mad_pcm_layout {
+  MAD_PCM_LAYOUT_MONO        = 0,	/* all channels mixed into one */
+  MAD_PCM_LAYOUT_INTERLEAVED = 1	/* one sample per channel: L R L R ... */
+};
+
 struct mad_pcm {
   unsigned int samplerate;		/* sampling frequency (Hz) */
   unsigned short channels;		/* number of channels */
   unsigned short length;		/* number of samples per channel */
+
+  enum mad_pcm_layout layout;		/* channel layout of samples[] */
+  enum mad_pcm_format format;		/* sample format of samples[] */
+
+  signed short samples[2 * 1152];	/* PCM output samples */
+};
+
+/* consumer of synthesized PCM, called once per frame */
+struct mad_pcm_sink {
+  enum mad_pcm_layout layout;		/* wanted channel layout */
+  enum mad_pcm_format format;		/* wanted sample format */
+
+  void (*write)(void *, struct mad_pcm const *);
+  void *data;				/* passed to write() */
 };
 
+/* filterbank values, and window coefficients */
+# if defined(OPT_SYNTH16)
+typedef signed short mad_filter_t;
+# else
+typedef mad_fixed_t mad_filter_t;
+# endif
+
 struct mad_synth {
-  mad_fixed_t filter[2][2][2][16][8];	/* polyphase filterbank outputs */
+  mad_filter_t filter[2][2][2][16][8];	/* polyphase filterbank outputs */
   					/* [ch][eo][peo][s][v] */
 
   unsigned int phase;			/* current processing phase */
 
   struct mad_pcm pcm;			/* PCM output */
+  struct mad_pcm_sink const *sink;	/* PCM consumer (or 0) */
+  struct mad_worker const *worker;	/* second core (or 0) */
 };
 
 /* single channel PCM selector */
@@ -885,6 +1011,12 @@ void mad_synth_init(struct mad_synth *);
 
 void mad_synth_mute(struct mad_synth *);
 
+# define mad_synth_sink(synth, snk)  \
+    ((void) ((synth)->sink = (snk)))
+
+# define mad_synth_worker(synth, wrk)  \
+    ((void) ((synth)->worker = (wrk)))
+
 void mad_synth_frame(struct mad_synth *, struct mad_frame const *);
 
 # endif
@@ -907,10 +1039,13 @@ enum mad_flow {
   MAD_FLOW_IGNORE   = 0x0020	/* ignore the current frame */
 };
 
-struct t_sync {
+struct sync_t {
   struct mad_stream stream;
   struct mad_frame frame;
   struct mad_synth synth;
+
+  main_data_t main_data;		/* Layer III bit reservoir */
+  mad_fixed_t overlap[2][32][18];	/* Layer III block overlap data */
 };
 
 struct mad_decoder {
@@ -924,7 +1059,7 @@ struct mad_decoder {
     int out;
   } async;
 
-  struct t_sync *sync;
+  struct sync_t *sync;
 
   void *cb_data;
 
@@ -956,6 +1091,9 @@ int mad_decoder_finish(struct mad_decoder *);
 # define mad_decoder_options(decoder, opts)  \
     ((void) ((decoder)->options = (opts)))
 
+void mad_sync_init(struct sync_t *);
+void mad_sync_finish(struct sync_t *);
+
 int mad_decoder_run(struct mad_decoder *, enum mad_decoder_mode);
 int mad_decoder_message(struct mad_decoder *, void *, unsigned int *);
 
@@ -25,7 +25,7 @@
 # include "bit.h"
 
 # define MAD_BUFFER_GUARD	8
-# define MAD_BUFFER_MDLEN	(511 + 2048 + MAD_BUFFER_GUARD)
+# define MAD_BUFFER_MDLEN	(511 + MAD_BUFFER_GUARD)
 
 enum mad_error {
   MAD_ERROR_NONE	   = 0x0000,	/* no error */
@@ -77,31 +77,57 @@ struct mad_stream {
   // unsigned char (*main_data)[MAD_BUFFER_MDLEN];
   main_data_t *main_data;
 					/* Layer III main_data() */
+  unsigned char const *md_ptr;		/* main_data still in buffer (or 0) */
   unsigned int md_len;			/* bytes in main_data */
 
   int options;				/* decoding options (see below) */
   enum mad_error error;			/* error code (see above) */
+
+  struct mad_worker const *worker;	/* second core (or 0) */
+};
+
+/*
+ * A second core (or thread) to run half of the work of a stereo frame on.
+ * start() runs job(arg) there and returns right away; wait() returns when
+ * that job is done. Layer III and the synthesis use it to process channel 1
+ * while the caller does channel 0.
+ */
+struct mad_worker {
+  void (*start)(void *, void (*)(void *), void *);
+  void (*wait)(void *);
+  void *data;				/* passed to start() and wait() */
 };
 
 enum {
   MAD_OPTION_IGNORECRC      = 0x0001,	/* ignore CRC errors */
-  MAD_OPTION_HALFSAMPLERATE = 0x0002	/* generate PCM at 1/2 sample rate */
-# if 0  /* not yet implemented */
+  MAD_OPTION_HALFSAMPLERATE = 0x0002,	/* generate PCM at 1/2 sample rate */
   MAD_OPTION_LEFTCHANNEL    = 0x0010,	/* decode left channel only */
   MAD_OPTION_RIGHTCHANNEL   = 0x0020,	/* decode right channel only */
-  MAD_OPTION_SINGLECHANNEL  = 0x0030	/* combine channels */
-# endif
+  MAD_OPTION_SINGLECHANNEL  = 0x0030,	/* combine channels */
+  MAD_OPTION_SBLIMIT        = 0x1f00	/* drop high subbands (see below) */
 };
 
+/*
+ * Decode only the lowest n (2..32) of the 32 subbands, which limits the
+ * audio bandwidth to n/64 of the sample rate: 16 subbands are 11 kHz and
+ * 20 subbands 13.8 kHz at 44.1 kHz. Layer III skips the Huffman decoding,
+ * requantization and IMDCT of everything above the cap.
+ */
+# define MAD_OPTION_SUBBANDS(n)	(((32 - (n)) << 8) & MAD_OPTION_SBLIMIT)
+# define MAD_SBLIMIT(options)	(32 - (((options) & MAD_OPTION_SBLIMIT) >> 8))
+
 void mad_stream_init(struct mad_stream *);
 void mad_stream_finish(struct mad_stream *);
 
 # define mad_stream_options(stream, opts)  \
     ((void) ((stream)->options = (opts)))
+# define mad_stream_worker(stream, wrk)  \
+    ((void) ((stream)->worker = (wrk)))
 
 void mad_stream_buffer(struct mad_stream *,
 		       unsigned char const *, unsigned long);
 void mad_stream_skip(struct mad_stream *, unsigned long);
+void mad_stream_detach(struct mad_stream *);
 
 int mad_stream_sync(struct mad_stream *);
 
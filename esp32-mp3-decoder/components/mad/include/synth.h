@@ -25,19 +25,53 @@
 # include "fixed.h"
 # include "frame.h"
 
+/* PCM sample formats */
+enum mad_pcm_format {
+  MAD_PCM_FORMAT_S16 = 0		/* signed 16-bit, native byte order */
+};
+
+/* PCM channel layouts */
+enum mad_pcm_layout {
+  MAD_PCM_LAYOUT_MONO        = 0,	/* all channels mixed into one */
+  MAD_PCM_LAYOUT_INTERLEAVED = 1	/* one sample per channel: L R L R ... */
+};
+
 struct mad_pcm {
   unsigned int samplerate;		/* sampling frequency (Hz) */
   unsigned short channels;		/* number of channels */
   unsigned short length;		/* number of samples per channel */
+
+  enum mad_pcm_layout layout;		/* channel layout of samples[] */
+  enum mad_pcm_format format;		/* sample format of samples[] */
+
+  signed short samples[2 * 1152];	/* PCM output samples */
 };
 
+/* consumer of synthesized PCM, called once per frame */
+struct mad_pcm_sink {
+  enum mad_pcm_layout layout;		/* wanted channel layout */
+  enum mad_pcm_format format;		/* wanted sample format */
+
+  void (*write)(void *, struct mad_pcm const *);
+  void *data;				/* passed to write() */
+};
+
+/* filterbank values, and window coefficients */
+# if defined(OPT_SYNTH16)
+typedef signed short mad_filter_t;
+# else
+typedef mad_fixed_t mad_filter_t;
+# endif
+
 struct mad_synth {
-  mad_fixed_t filter[2][2][2][16][8];	/* polyphase filterbank outputs */
+  mad_filter_t filter[2][2][2][16][8];	/* polyphase filterbank outputs */
   					/* [ch][eo][peo][s][v] */
 
   unsigned int phase;			/* current processing phase */
 
   struct mad_pcm pcm;			/* PCM output */
+  struct mad_pcm_sink const *sink;	/* PCM consumer (or 0) */
+  struct mad_worker const *worker;	/* second core (or 0) */
 };
 
 /* single channel PCM selector */
@@ -63,6 +97,12 @@ void mad_synth_init(struct mad_synth *);
 
 void mad_synth_mute(struct mad_synth *);
 
+# define mad_synth_sink(synth, snk)  \
+    ((void) ((synth)->sink = (snk)))
+
+# define mad_synth_worker(synth, wrk)  \
+    ((void) ((synth)->worker = (wrk)))
+
 void mad_synth_frame(struct mad_synth *, struct mad_frame const *);
 
 # endif
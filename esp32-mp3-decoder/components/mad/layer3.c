@@ -39,6 +39,10 @@
 #  define CHAR_BIT  8
 # endif
 
+# if defined(FPM_FLOAT)
+#  include <math.h>
+# endif
+
 # include "fixed.h"
 # include "bit.h"
 # include "stream.h"
@@ -331,14 +335,23 @@ unsigned char const pretab[22] = {
  * table for requantization
  *
  * rq_table[x].mantissa * 2^(rq_table[x].exponent) = x^(4/3)
+ *
+ * or with FPM_FLOAT, which needs no separate exponent, rq_table[x] = x^(4/3)
  */
+# if defined(FPM_FLOAT)
+static
+float const rq_table[8207] = {
+#  include "rq_float.dat"
+};
+# else
 static
 struct fixedfloat {
   unsigned long mantissa  : 27;
   unsigned short exponent :  5;
 } const rq_table[8207] = {
-# include "rq_table.dat"
+#  include "rq_table.dat"
 };
+# endif
 
 /*
  * fractional powers of two
@@ -519,15 +532,15 @@ enum mad_error III_sideinfo(struct mad_bitptr *ptr, unsigned int nch,
   *data_bitlen = 0;
   *priv_bitlen = lsf ? ((nch == 1) ? 1 : 2) : ((nch == 1) ? 5 : 3);
 
-  si->main_data_begin = mad_bit_read(ptr, lsf ? 8 : 9);
-  si->private_bits    = mad_bit_read(ptr, *priv_bitlen);
+  si->main_data_begin = mad_bit_get(ptr, lsf ? 8 : 9);
+  si->private_bits    = mad_bit_get(ptr, *priv_bitlen);
 
   ngr = 1;
   if (!lsf) {
     ngr = 2;
 
     for (ch = 0; ch < nch; ++ch)
-      si->scfsi[ch] = mad_bit_read(ptr, 4);
+      si->scfsi[ch] = mad_bit_get(ptr, 4);
   }
 
   for (gr = 0; gr < ngr; ++gr) {
@@ -536,10 +549,10 @@ enum mad_error III_sideinfo(struct mad_bitptr *ptr, unsigned int nch,
     for (ch = 0; ch < nch; ++ch) {
       struct channel *channel = &granule->ch[ch];
 
-      channel->part2_3_length    = mad_bit_read(ptr, 12);
-      channel->big_values        = mad_bit_read(ptr, 9);
-      channel->global_gain       = mad_bit_read(ptr, 8);
-      channel->scalefac_compress = mad_bit_read(ptr, lsf ? 9 : 4);
+      channel->part2_3_length    = mad_bit_get(ptr, 12);
+      channel->big_values        = mad_bit_get(ptr, 9);
+      channel->global_gain       = mad_bit_get(ptr, 8);
+      channel->scalefac_compress = mad_bit_get(ptr, lsf ? 9 : 4);
 
       *data_bitlen += channel->part2_3_length;
 
@@ -549,8 +562,8 @@ enum mad_error III_sideinfo(struct mad_bitptr *ptr, unsigned int nch,
       channel->flags = 0;
 
       /* window_switching_flag */
-      if (mad_bit_read(ptr, 1)) {
-	channel->block_type = mad_bit_read(ptr, 2);
+      if (mad_bit_get(ptr, 1)) {
+	channel->block_type = mad_bit_get(ptr, 2);
 
 	if (channel->block_type == 0 && result == 0)
 	  result = MAD_ERROR_BADBLOCKTYPE;
@@ -561,33 +574,33 @@ enum mad_error III_sideinfo(struct mad_bitptr *ptr, unsigned int nch,
 	channel->region0_count = 7;
 	channel->region1_count = 36;
 
-	if (mad_bit_read(ptr, 1))
+	if (mad_bit_get(ptr, 1))
 	  channel->flags |= mixed_block_flag;
 	else if (channel->block_type == 2)
 	  channel->region0_count = 8;
 
 	for (i = 0; i < 2; ++i)
-	  channel->table_select[i] = mad_bit_read(ptr, 5);
+	  channel->table_select[i] = mad_bit_get(ptr, 5);
 
 # if defined(DEBUG)
 	channel->table_select[2] = 4;  /* not used */
 # endif
 
 	for (i = 0; i < 3; ++i)
-	  channel->subblock_gain[i] = mad_bit_read(ptr, 3);
+	  channel->subblock_gain[i] = mad_bit_get(ptr, 3);
       }
       else {
 	channel->block_type = 0;
 
 	for (i = 0; i < 3; ++i)
-	  channel->table_select[i] = mad_bit_read(ptr, 5);
+	  channel->table_select[i] = mad_bit_get(ptr, 5);
 
-	channel->region0_count = mad_bit_read(ptr, 4);
-	channel->region1_count = mad_bit_read(ptr, 3);
+	channel->region0_count = mad_bit_get(ptr, 4);
+	channel->region1_count = mad_bit_get(ptr, 3);
       }
 
       /* [preflag,] scalefac_scale, count1table_select */
-      channel->flags |= mad_bit_read(ptr, lsf ? 2 : 3);
+      channel->flags |= mad_bit_get(ptr, lsf ? 2 : 3);
     }
   }
 
@@ -648,7 +661,7 @@ unsigned int III_scalefactors_lsf(struct mad_bitptr *ptr,
     n = 0;
     for (part = 0; part < 4; ++part) {
       for (i = 0; i < nsfb[part]; ++i)
-	channel->scalefac[n++] = mad_bit_read(ptr, slen[part]);
+	channel->scalefac[n++] = mad_bit_get(ptr, slen[part]);
     }
 
     while (n < 39)
@@ -693,7 +706,7 @@ unsigned int III_scalefactors_lsf(struct mad_bitptr *ptr,
       max = (1 << slen[part]) - 1;
 
       for (i = 0; i < nsfb[part]; ++i) {
-	is_pos = mad_bit_read(ptr, slen[part]);
+	is_pos = mad_bit_get(ptr, slen[part]);
 
 	channel->scalefac[n] = is_pos;
 	gr1ch->scalefac[n++] = (is_pos == max);
@@ -732,11 +745,11 @@ unsigned int III_scalefactors(struct mad_bitptr *ptr, struct channel *channel,
 
     nsfb = (channel->flags & mixed_block_flag) ? 8 + 3 * 3 : 6 * 3;
     while (nsfb--)
-      channel->scalefac[sfbi++] = mad_bit_read(ptr, slen1);
+      channel->scalefac[sfbi++] = mad_bit_get(ptr, slen1);
 
     nsfb = 6 * 3;
     while (nsfb--)
-      channel->scalefac[sfbi++] = mad_bit_read(ptr, slen2);
+      channel->scalefac[sfbi++] = mad_bit_get(ptr, slen2);
 
     nsfb = 1 * 3;
     while (nsfb--)
@@ -749,7 +762,7 @@ unsigned int III_scalefactors(struct mad_bitptr *ptr, struct channel *channel,
     }
     else {
       for (sfbi = 0; sfbi < 6; ++sfbi)
-	channel->scalefac[sfbi] = mad_bit_read(ptr, slen1);
+	channel->scalefac[sfbi] = mad_bit_get(ptr, slen1);
     }
 
     if (scfsi & 0x4) {
@@ -758,7 +771,7 @@ unsigned int III_scalefactors(struct mad_bitptr *ptr, struct channel *channel,
     }
     else {
       for (sfbi = 6; sfbi < 11; ++sfbi)
-	channel->scalefac[sfbi] = mad_bit_read(ptr, slen1);
+	channel->scalefac[sfbi] = mad_bit_get(ptr, slen1);
     }
 
     if (scfsi & 0x2) {
@@ -767,7 +780,7 @@ unsigned int III_scalefactors(struct mad_bitptr *ptr, struct channel *channel,
     }
     else {
       for (sfbi = 11; sfbi < 16; ++sfbi)
-	channel->scalefac[sfbi] = mad_bit_read(ptr, slen2);
+	channel->scalefac[sfbi] = mad_bit_get(ptr, slen2);
     }
 
     if (scfsi & 0x1) {
@@ -776,7 +789,7 @@ unsigned int III_scalefactors(struct mad_bitptr *ptr, struct channel *channel,
     }
     else {
       for (sfbi = 16; sfbi < 21; ++sfbi)
-	channel->scalefac[sfbi] = mad_bit_read(ptr, slen2);
+	channel->scalefac[sfbi] = mad_bit_get(ptr, slen2);
     }
 
     channel->scalefac[21] = 0;
@@ -884,6 +897,16 @@ void III_exponents(struct channel const *channel,
  */
 static
 mad_fixed_t III_requantize(unsigned int value, signed int exp)
+# if defined(FPM_FLOAT)
+{
+  signed int frac;
+
+  frac = exp % 4;  /* assumes sign(frac) == sign(exp) */
+  exp /= 4;
+
+  return ldexpf(rq_table[value] * root_table[3 + frac], exp);
+}
+# else
 {
   mad_fixed_t requantized;
   signed int frac;
@@ -921,6 +944,7 @@ mad_fixed_t III_requantize(unsigned int value, signed int exp)
 
   return frac ? mad_f_mul(requantized, root_table[3 + frac]) : requantized;
 }
+# endif
 
 /* we must take care that sz >= bits and sz < sizeof(long) lest bits == 0 */
 # define MASK(cache, sz, bits)	\
@@ -930,13 +954,14 @@ mad_fixed_t III_requantize(unsigned int value, signed int exp)
 
 /*
  * NAME:	III_huffdecode()
- * DESCRIPTION:	decode Huffman code words of one channel of one granule
+ * DESCRIPTION:	decode Huffman code words of one channel of one granule,
+ *		up to the first lines frequency lines (in coded order)
  */
 static
 enum mad_error III_huffdecode(struct mad_bitptr *ptr, mad_fixed_t xr[576],
 			      struct channel *channel,
 			      unsigned char const *sfbwidth,
-			      unsigned int part2_length)
+			      unsigned int part2_length, unsigned int lines)
 {
   signed int exponents[39], exp;
   signed int const *expptr;
@@ -987,7 +1012,11 @@ enum mad_error III_huffdecode(struct mad_bitptr *ptr, mad_fixed_t xr[576],
     exp     = *expptr++;
     reqhits = 0;
 
+    /* ptr already points past the granule, so decoding may stop early */
+
     big_values = channel->big_values;
+    if (big_values > lines / 2)
+      big_values = lines / 2;
 
     while (big_values-- && cachesz + bits_left > 0) {
       union huffpair const *pair;
@@ -1164,13 +1193,18 @@ enum mad_error III_huffdecode(struct mad_bitptr *ptr, mad_fixed_t xr[576],
   /* count1 */
   {
     union huffquad const *table;
+    mad_fixed_t const *xrend;
     register mad_fixed_t requantized;
 
     table = mad_huff_quad_table[channel->flags & count1table_select];
 
     requantized = III_requantize(1, exp);
 
-    while (cachesz + bits_left > 0 && xrptr <= &xr[572]) {
+    /* a quadruple may run two lines past a limit below 576 */
+
+    xrend = &xr[lines < 576 ? lines - 2 : 572];
+
+    while (cachesz + bits_left > 0 && xrptr <= xrend) {
       union huffquad const *quad;
 
       /* hcod (1..6) */
@@ -1181,15 +1215,8 @@ enum mad_error III_huffdecode(struct mad_bitptr *ptr, mad_fixed_t xr[576],
 	bits_left -= 16;
       }
 
-      quad = &table[MASK(bitcache, cachesz, 4)];
-
-      /* quad tables guaranteed to have at most one extra lookup */
-      if (!quad->final) {
-	cachesz -= 4;
-
-	quad = &table[quad->ptr.offset +
-		      MASK(bitcache, cachesz, quad->ptr.bits)];
-      }
+      /* quad tables resolve any code word in one lookup */
+      quad = &table[MASK(bitcache, cachesz, 6)];
 
       cachesz -= quad->value.hlen;
 
@@ -1325,13 +1352,14 @@ void III_reorder(mad_fixed_t xr[576], struct channel const *channel,
 
 /*
  * NAME:	III_stereo()
- * DESCRIPTION:	perform joint stereo processing on a granule
+ * DESCRIPTION:	perform joint stereo processing on a granule, for the
+ *		scalefactor bands that start below lines
  */
 static
 enum mad_error III_stereo(mad_fixed_t xr[2][576],
 			  struct granule const *granule,
 			  struct mad_header *header,
-			  unsigned char const *sfbwidth)
+			  unsigned char const *sfbwidth, unsigned int lines)
 {
   short modes[39];
   unsigned int sfbi, l, n, i;
@@ -1445,7 +1473,7 @@ enum mad_error III_stereo(mad_fixed_t xr[2][576],
       /* intensity_scale */
       lsf_scale = is_lsf_table[right_ch->scalefac_compress & 0x1];
 
-      for (sfbi = l = 0; l < 576; ++sfbi, l += n) {
+      for (sfbi = l = 0; l < lines; ++sfbi, l += n) {
 	n = unalChar(&sfbwidth[sfbi]);
 
 	if (!(modes[sfbi] & I_STEREO))
@@ -1481,7 +1509,7 @@ enum mad_error III_stereo(mad_fixed_t xr[2][576],
       }
     }
     else {  /* !(header->flags & MAD_FLAG_LSF_EXT) */
-      for (sfbi = l = 0; l < 576; ++sfbi, l += n) {
+      for (sfbi = l = 0; l < lines; ++sfbi, l += n) {
 	n = unalChar(&sfbwidth[sfbi]);
 
 	if (!(modes[sfbi] & I_STEREO))
@@ -1515,7 +1543,7 @@ enum mad_error III_stereo(mad_fixed_t xr[2][576],
 
     invsqrt2 = root_table[3 + -2];
 
-    for (sfbi = l = 0; l < 576; ++sfbi, l += n) {
+    for (sfbi = l = 0; l < lines; ++sfbi, l += n) {
       n = unalChar(&sfbwidth[sfbi]);
 
       if (modes[sfbi] != MS_STEREO)
@@ -1575,26 +1603,46 @@ void III_aliasreduce(mad_fixed_t xr[576], int lines)
   }
 }
 
+/*
+ * Where the compiler has generic vector support and a vector unit, the
+ * IMDCT, windowing and overlap-add of a granule are done IMDCT_LANES
+ * subbands at a time, one subband per lane (see III_imdct_block()). The
+ * fast IMDCT below is then compiled for vectors; none of its operations
+ * cross lanes, so each lane is bit-identical to the one-subband code.
+ * OPT_DCT_SCALAR disables this, as it does for the synthesis DCT.
+ */
+
+# if (defined(FPM_DEFAULT) || defined(FPM_FLOAT)) && !defined(ASO_IMDCT) &&  \
+    !defined(OPT_DCT_SCALAR) && defined(__GNUC__) && !defined(__clang__) &&  \
+    (defined(__x86_64__) || defined(__i386__) || defined(__aarch64__))
+#  define IMDCT_LANES  4
+
+typedef mad_fixed_t imdct_t
+  __attribute__((vector_size(IMDCT_LANES * sizeof(mad_fixed_t))));
+typedef signed int imdct_i  /* shuffle masks */
+  __attribute__((vector_size(IMDCT_LANES * sizeof(signed int))));
+# else
+typedef mad_fixed_t imdct_t;
+# endif
+
 # if defined(ASO_IMDCT)
 void III_imdct_l(mad_fixed_t const [18], mad_fixed_t [36], unsigned int);
 # else
 #  if 1
 static
-void fastsdct(mad_fixed_t const x[9], mad_fixed_t y[18])
+void fastsdct(imdct_t const x[9], imdct_t y[18])
 {
-  mad_fixed_t a0,  a1,  a2,  a3,  a4,  a5,  a6,  a7,  a8,  a9,  a10, a11, a12;
-  mad_fixed_t a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25;
-  mad_fixed_t m0,  m1,  m2,  m3,  m4,  m5,  m6,  m7;
-
-  enum {
-    c0 =  MAD_F(0x1f838b8d),  /* 2 * cos( 1 * PI / 18) */
-    c1 =  MAD_F(0x1bb67ae8),  /* 2 * cos( 3 * PI / 18) */
-    c2 =  MAD_F(0x18836fa3),  /* 2 * cos( 4 * PI / 18) */
-    c3 =  MAD_F(0x1491b752),  /* 2 * cos( 5 * PI / 18) */
-    c4 =  MAD_F(0x0af1d43a),  /* 2 * cos( 7 * PI / 18) */
-    c5 =  MAD_F(0x058e86a0),  /* 2 * cos( 8 * PI / 18) */
-    c6 = -MAD_F(0x1e11f642)   /* 2 * cos(16 * PI / 18) */
-  };
+  imdct_t a0,  a1,  a2,  a3,  a4,  a5,  a6,  a7,  a8,  a9,  a10, a11, a12;
+  imdct_t a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25;
+  imdct_t m0,  m1,  m2,  m3,  m4,  m5,  m6,  m7;
+
+  mad_fixed_t const c0 =  MAD_F(0x1f838b8d);  /* 2 * cos( 1 * PI / 18) */
+  mad_fixed_t const c1 =  MAD_F(0x1bb67ae8);  /* 2 * cos( 3 * PI / 18) */
+  mad_fixed_t const c2 =  MAD_F(0x18836fa3);  /* 2 * cos( 4 * PI / 18) */
+  mad_fixed_t const c3 =  MAD_F(0x1491b752);  /* 2 * cos( 5 * PI / 18) */
+  mad_fixed_t const c4 =  MAD_F(0x0af1d43a);  /* 2 * cos( 7 * PI / 18) */
+  mad_fixed_t const c5 =  MAD_F(0x058e86a0);  /* 2 * cos( 8 * PI / 18) */
+  mad_fixed_t const c6 = -MAD_F(0x1e11f642);  /* 2 * cos(16 * PI / 18) */
 
   a0 = x[3] + x[5];
   a1 = x[3] - x[5];
@@ -1648,9 +1696,9 @@ void fastsdct(mad_fixed_t const x[9], mad_fixed_t y[18])
 }
 
 static inline
-void sdctII(mad_fixed_t const x[18], mad_fixed_t X[18])
+void sdctII(imdct_t const x[18], imdct_t X[18])
 {
-  mad_fixed_t tmp[9];
+  imdct_t tmp[9];
   int i;
 
   /* scale[i] = 2 * cos(PI * (2 * i + 1) / (2 * 18)) */
@@ -1693,9 +1741,9 @@ void sdctII(mad_fixed_t const x[18], mad_fixed_t X[18])
 }
 
 static inline
-void dctIV(mad_fixed_t const y[18], mad_fixed_t X[18])
+void dctIV(imdct_t const y[18], imdct_t X[18])
 {
-  mad_fixed_t tmp[18];
+  imdct_t tmp[18];
   int i;
 
   /* scale[i] = 2 * cos(PI * (2 * i + 1) / (4 * 18)) */
@@ -1737,9 +1785,9 @@ void dctIV(mad_fixed_t const y[18], mad_fixed_t X[18])
  * DESCRIPTION:	perform X[18]->x[36] IMDCT using Szu-Wei Lee's fast algorithm
  */
 static inline
-void imdct36(mad_fixed_t const x[18], mad_fixed_t y[36])
+void imdct36(imdct_t const x[18], imdct_t y[36])
 {
-  mad_fixed_t tmp[18];
+  imdct_t tmp[18];
   int i;
 
   /* DCT-IV */
@@ -2057,6 +2105,7 @@ void imdct36(mad_fixed_t const X[18], mad_fixed_t x[36])
 }
 #  endif
 
+# if !defined(IMDCT_LANES)
 /*
  * NAME:	III_imdct_l()
  * DESCRIPTION:	perform IMDCT and windowing for long blocks
@@ -2142,8 +2191,10 @@ void III_imdct_l(mad_fixed_t const X[18], mad_fixed_t z[36],
     break;
   }
 }
+# endif
 # endif  /* ASO_IMDCT */
 
+# if !defined(IMDCT_LANES)
 /*
  * NAME:	III_imdct_s()
  * DESCRIPTION:	perform IMDCT and windowing for short blocks
@@ -2270,6 +2321,7 @@ void III_overlap(mad_fixed_t const output[36], mad_fixed_t overlap[18],
   }
 # endif
 }
+# endif
 
 /*
  * NAME:	III_overlap_z()
@@ -2311,6 +2363,25 @@ void III_overlap_z(mad_fixed_t overlap[18],
 # endif
 }
 
+/*
+ * NAME:	III_overlap_cap()
+ * DESCRIPTION:	clear output and overlap of the subbands above sbcap
+ */
+static
+void III_overlap_cap(mad_fixed_t overlap[32][18],
+		     mad_fixed_t sample[18][32], unsigned int sbcap)
+{
+  unsigned int i;
+
+  if (sbcap == 32)
+    return;
+
+  memset(overlap[sbcap], 0, (32 - sbcap) * sizeof(overlap[0]));
+
+  for (i = 0; i < 18; ++i)
+    memset(&sample[i][sbcap], 0, (32 - sbcap) * sizeof(sample[0][0]));
+}
+
 /*
  * NAME:	III_freqinver()
  * DESCRIPTION:	perform subband frequency inversion for odd sample lines
@@ -2345,16 +2416,398 @@ void III_freqinver(mad_fixed_t sample[18][32], unsigned int sb)
 # endif
 }
 
+# if defined(IMDCT_LANES)
+/*
+ * NAME:	III_transpose()
+ * DESCRIPTION:	transpose four vectors of four values
+ */
+static inline
+void III_transpose(imdct_t v[4])
+{
+  imdct_t t0, t1, t2, t3;
+
+  t0 = __builtin_shuffle(v[0], v[1], (imdct_i) { 0, 4, 1, 5 });
+  t1 = __builtin_shuffle(v[0], v[1], (imdct_i) { 2, 6, 3, 7 });
+  t2 = __builtin_shuffle(v[2], v[3], (imdct_i) { 0, 4, 1, 5 });
+  t3 = __builtin_shuffle(v[2], v[3], (imdct_i) { 2, 6, 3, 7 });
+
+  v[0] = __builtin_shuffle(t0, t2, (imdct_i) { 0, 1, 4, 5 });
+  v[1] = __builtin_shuffle(t0, t2, (imdct_i) { 2, 3, 6, 7 });
+  v[2] = __builtin_shuffle(t1, t3, (imdct_i) { 0, 1, 4, 5 });
+  v[3] = __builtin_shuffle(t1, t3, (imdct_i) { 2, 3, 6, 7 });
+}
+
+/*
+ * NAME:	III_load()
+ * DESCRIPTION:	gather 18 values of four subbands, one subband per lane
+ */
+static inline
+void III_load(imdct_t v[18], mad_fixed_t const (*row)[18])
+{
+  unsigned int i, l;
+
+  for (i = 0; i < 16; i += 4) {
+    for (l = 0; l < 4; ++l)
+      memcpy(&v[i + l], &row[l][i], sizeof(imdct_t));
+
+    III_transpose(&v[i]);
+  }
+
+  v[16] = (imdct_t) { row[0][16], row[1][16], row[2][16], row[3][16] };
+  v[17] = (imdct_t) { row[0][17], row[1][17], row[2][17], row[3][17] };
+}
+
+/*
+ * NAME:	III_store()
+ * DESCRIPTION:	scatter 18 values of four subbands, one subband per lane
+ */
+static inline
+void III_store(imdct_t v[18], mad_fixed_t (*row)[18])
+{
+  unsigned int i, l;
+
+  for (i = 0; i < 16; i += 4) {
+    III_transpose(&v[i]);
+
+    for (l = 0; l < 4; ++l)
+      memcpy(&row[l][i], &v[i + l], sizeof(imdct_t));
+  }
+
+  for (l = 0; l < 4; ++l) {
+    row[l][16] = v[16][l];
+    row[l][17] = v[17][l];
+  }
+}
+
+/*
+ * NAME:	III_imdct_lv()
+ * DESCRIPTION:	perform IMDCT and windowing for long blocks of four subbands
+ */
+static
+void III_imdct_lv(imdct_t const X[18], imdct_t z[36],
+		  unsigned int block_type)
+{
+  unsigned int i;
+
+  imdct36(X, z);
+
+  switch (block_type) {
+  case 0:  /* normal window */
+    for (i =  0; i < 36; ++i) z[i] = mad_f_mul(z[i], window_l[i]);
+    break;
+
+  case 1:  /* start block */
+    for (i =  0; i < 18; ++i) z[i] = mad_f_mul(z[i], window_l[i]);
+    /*  (i = 18; i < 24; ++i) z[i] unchanged */
+    for (i = 24; i < 30; ++i) z[i] = mad_f_mul(z[i], window_s[i - 18]);
+    for (i = 30; i < 36; ++i) z[i] = (imdct_t) { 0 };
+    break;
+
+  case 3:  /* stop block */
+    for (i =  0; i <  6; ++i) z[i] = (imdct_t) { 0 };
+    for (i =  6; i < 12; ++i) z[i] = mad_f_mul(z[i], window_s[i - 6]);
+    /*  (i = 12; i < 18; ++i) z[i] unchanged */
+    for (i = 18; i < 36; ++i) z[i] = mad_f_mul(z[i], window_l[i]);
+    break;
+  }
+}
+
+/*
+ * NAME:	III_imdct_sv()
+ * DESCRIPTION:	perform IMDCT and windowing for short blocks of four subbands
+ */
+static
+void III_imdct_sv(imdct_t const X[18], imdct_t z[36])
+{
+  imdct_t y[36], *yptr;
+  mad_fixed_t const *wptr;
+  int w, i, k;
+
+  /* IMDCT */
+
+  yptr = &y[0];
+
+  for (w = 0; w < 3; ++w) {
+    register mad_fixed_t const (*s)[6];
+
+    s = imdct_s;
+
+    for (i = 0; i < 3; ++i) {
+      yptr[i + 0] = mad_f_mul(X[0], (*s)[0]);
+      for (k = 1; k < 6; ++k)
+	yptr[i + 0] += mad_f_mul(X[k], (*s)[k]);
+      yptr[5 - i] = -yptr[i + 0];
+
+      ++s;
+
+      yptr[i + 6] = mad_f_mul(X[0], (*s)[0]);
+      for (k = 1; k < 6; ++k)
+	yptr[i + 6] += mad_f_mul(X[k], (*s)[k]);
+      yptr[11 - i] = yptr[i + 6];
+
+      ++s;
+    }
+
+    yptr += 12;
+    X    += 6;
+  }
+
+  /* windowing, overlapping and concatenation */
+
+  yptr = &y[0];
+  wptr = &window_s[0];
+
+  for (i = 0; i < 6; ++i) {
+    z[i +  0] = (imdct_t) { 0 };
+    z[i +  6] = mad_f_mul(yptr[ 0 + 0], wptr[0]);
+    z[i + 12] = mad_f_mul(yptr[ 0 + 6], wptr[6]) +
+		mad_f_mul(yptr[12 + 0], wptr[0]);
+    z[i + 18] = mad_f_mul(yptr[12 + 6], wptr[6]) +
+		mad_f_mul(yptr[24 + 0], wptr[0]);
+    z[i + 24] = mad_f_mul(yptr[24 + 6], wptr[6]);
+    z[i + 30] = (imdct_t) { 0 };
+
+    ++yptr;
+    ++wptr;
+  }
+}
+
+/*
+ * NAME:	III_imdct_block()
+ * DESCRIPTION:	perform IMDCT, windowing, overlap-add and frequency
+ *		inversion for all subbands of a granule, four at a time
+ */
+static
+void III_imdct_block(mad_fixed_t xr[576], struct channel const *channel,
+		     mad_fixed_t overlap[32][18], mad_fixed_t sample[18][32],
+		     unsigned int sbcap)
+{
+  imdct_t X[18], z[36], zs[36], v;
+  unsigned int sb, i, sblimit, type, type01;
+
+  /* zero subbands above sblimit come out of the IMDCT as zero */
+
+  i = 18 * sbcap;
+  while (i > 36 && xr[i - 1] == 0)
+    --i;
+
+  sblimit = 32 - (576 - i) / 18;
+
+  /* subbands 0-1 of a mixed block are long blocks with a normal window */
+
+  type = channel->block_type;
+  type01 = (channel->flags & mixed_block_flag) ? 0 : type;
+
+  for (sb = 0; sb < sblimit; sb += 4) {
+    III_load(X, (mad_fixed_t const (*)[18]) &xr[18 * sb]);
+
+    if (type == 2)
+      III_imdct_sv(X, z);
+    else
+      III_imdct_lv(X, z, type);
+
+    if (sb == 0 && type01 != type) {
+      III_imdct_lv(X, zs, type01);
+
+      for (i = 0; i < 36; ++i)
+	z[i] = __builtin_shuffle(zs[i], z[i], (imdct_i) { 0, 1, 6, 7 });
+    }
+
+    /* overlap-add, with frequency inversion of odd subbands */
+
+    III_load(X, (mad_fixed_t const (*)[18]) &overlap[sb]);
+
+    for (i = 0; i < 18; ++i) {
+      v = z[i] + X[i];
+      if (i & 1)
+	v = __builtin_shuffle(v, -v, (imdct_i) { 0, 5, 2, 7 });
+
+      memcpy(&sample[i][sb], &v, sizeof(imdct_t));
+      X[i] = z[i + 18];
+    }
+
+    III_store(X, &overlap[sb]);
+  }
+
+  /* remaining (zero) subbands */
+
+  for (; sb < sbcap; ++sb) {
+    III_overlap_z(overlap[sb], sample, sb);
+
+    if (sb & 1)
+      III_freqinver(sample, sb);
+  }
+
+  III_overlap_cap(overlap, sample, sbcap);
+}
+# endif
+
+/*
+ * NAME:	III_lines()
+ * DESCRIPTION:	return how many frequency lines, in coded order, hold the
+ *		lowest sbcap subbands of a granule channel
+ */
+static
+unsigned int III_lines(struct channel const *channel,
+		       unsigned char const *sfbwidth, unsigned int sbcap)
+{
+  unsigned int l;
+
+  if (channel->block_type != 2 || sbcap == 32)
+    return 18 * sbcap;
+
+  /* short blocks are coded window by window within each scalefactor band,
+     so take every band that starts below the cap, for all three windows */
+
+  l = 0;
+  if (channel->flags & mixed_block_flag) {
+    while (l < 36)
+      l += unalChar(sfbwidth++);
+  }
+
+  while (l < 18 * sbcap) {
+    l += 3 * unalChar(sfbwidth);
+    sfbwidth += 3;
+  }
+
+  return l;
+}
+
+/*
+ * NAME:	III_channel()
+ * DESCRIPTION:	reorder, alias reduce, IMDCT, overlap-add and frequency
+ *		invert one channel of a granule
+ */
+static
+void III_channel(mad_fixed_t xr[576], struct channel const *channel,
+		 unsigned char const *sfbwidth, mad_fixed_t overlap[32][18],
+		 mad_fixed_t sample[18][32], unsigned int sbcap)
+{
+# if !defined(IMDCT_LANES)
+  unsigned int sb, l, i, sblimit;
+  mad_fixed_t output[36];
+# endif
+
+  if (channel->block_type == 2) {
+    III_reorder(xr, channel, sfbwidth);
+
+# if !defined(OPT_STRICT)
+    /*
+     * According to ISO/IEC 11172-3, "Alias reduction is not applied for
+     * granules with block_type == 2 (short block)." However, other
+     * sources suggest alias reduction should indeed be performed on the
+     * lower two subbands of mixed blocks. Most other implementations do
+     * this, so by default we will too.
+     */
+    if (channel->flags & mixed_block_flag)
+      III_aliasreduce(xr, 36);
+# endif
+  }
+  else
+    III_aliasreduce(xr, 18 * sbcap);
+
+# if defined(IMDCT_LANES)
+  III_imdct_block(xr, channel, overlap, sample, sbcap);
+# else
+  l = 0;
+
+  /* subbands 0-1 */
+
+  if (channel->block_type != 2 || (channel->flags & mixed_block_flag)) {
+    unsigned int block_type;
+
+    block_type = channel->block_type;
+    if (channel->flags & mixed_block_flag)
+      block_type = 0;
+
+    /* long blocks */
+    for (sb = 0; sb < 2; ++sb, l += 18) {
+      III_imdct_l(&xr[l], output, block_type);
+      III_overlap(output, overlap[sb], sample, sb);
+    }
+  }
+  else {
+    /* short blocks */
+    for (sb = 0; sb < 2; ++sb, l += 18) {
+      III_imdct_s(&xr[l], output);
+      III_overlap(output, overlap[sb], sample, sb);
+    }
+  }
+
+  III_freqinver(sample, 1);
+
+  /* (nonzero) subbands 2-31 */
+
+  i = 18 * sbcap;
+  while (i > 36 && xr[i - 1] == 0)
+    --i;
+
+  sblimit = 32 - (576 - i) / 18;
+
+  if (channel->block_type != 2) {
+    /* long blocks */
+    for (sb = 2; sb < sblimit; ++sb, l += 18) {
+      III_imdct_l(&xr[l], output, channel->block_type);
+      III_overlap(output, overlap[sb], sample, sb);
+
+      if (sb & 1)
+	III_freqinver(sample, sb);
+    }
+  }
+  else {
+    /* short blocks */
+    for (sb = 2; sb < sblimit; ++sb, l += 18) {
+      III_imdct_s(&xr[l], output);
+      III_overlap(output, overlap[sb], sample, sb);
+
+      if (sb & 1)
+	III_freqinver(sample, sb);
+    }
+  }
+
+  /* remaining (zero) subbands */
+
+  for (sb = sblimit; sb < sbcap; ++sb) {
+    III_overlap_z(overlap[sb], sample, sb);
+
+    if (sb & 1)
+      III_freqinver(sample, sb);
+  }
+
+  III_overlap_cap(overlap, sample, sbcap);
+# endif
+}
+
+/* one channel of a granule, for a worker */
+struct III_job {
+  mad_fixed_t *xr;
+  struct channel const *channel;
+  unsigned char const *sfbwidth;
+  mad_fixed_t (*overlap)[18];
+  mad_fixed_t (*sample)[32];
+  unsigned int sbcap;
+};
+
+static
+void III_channel_job(void *arg)
+{
+  struct III_job const *job = arg;
+
+  III_channel(job->xr, job->channel, job->sfbwidth, job->overlap,
+	      job->sample, job->sbcap);
+}
+
 /*
  * NAME:	III_decode()
  * DESCRIPTION:	decode frame main_data
  */
 static
 enum mad_error III_decode(struct mad_bitptr *ptr, struct mad_frame *frame,
-			  struct sideinfo *si, unsigned int nch)
+			  struct sideinfo *si, unsigned int nch,
+			  struct mad_worker const *worker)
 {
   struct mad_header *header = &frame->header;
-  unsigned int sfreqi, ngr, gr;
+  unsigned int sfreqi, ngr, gr, only, joint, sbcap;
 
   {
     unsigned int sfreq;
@@ -2372,6 +2825,35 @@ enum mad_error III_decode(struct mad_bitptr *ptr, struct mad_frame *frame,
       sfreqi += 3;
   }
 
+  /*
+   * With a single output channel selected, only that channel is carried
+   * through reordering and the IMDCT, into sbsample[0] and overlap[0].
+   * Unless joint stereo needs both spectra, the other channel's main_data
+   * is not even decoded but skipped over by its part2_3_length.
+   */
+
+  only = nch;
+  if (nch == 2) {
+    switch (frame->options & MAD_OPTION_SINGLECHANNEL) {
+    case MAD_OPTION_LEFTCHANNEL:
+      only = 0;
+      break;
+
+    case MAD_OPTION_RIGHTCHANNEL:
+      only = 1;
+      break;
+    }
+  }
+
+  joint = header->mode == MAD_MODE_JOINT_STEREO && header->mode_extension;
+
+  /* with a subband cap, the lines above it are neither Huffman decoded nor
+     requantized, and their subbands are output as zero (see stream.h) */
+
+  sbcap = MAD_SBLIMIT(frame->options);
+  if (sbcap < 2)
+    sbcap = 2;
+
   /* scalefactors, Huffman decoding, requantization */
 
   ngr = (header->flags & MAD_FLAG_LSF_EXT) ? 1 : 2;
@@ -2380,13 +2862,18 @@ enum mad_error III_decode(struct mad_bitptr *ptr, struct mad_frame *frame,
     struct granule *granule = &si->gr[gr];
     unsigned char const *sfbwidth[2];
     mad_fixed_t xr[2][576];
-    unsigned int ch;
+    unsigned int ch, lines[2];
     enum mad_error error;
 
     for (ch = 0; ch < nch; ++ch) {
       struct channel *channel = &granule->ch[ch];
       unsigned int part2_length;
 
+      if (only < nch && ch != only && !joint) {
+	mad_bit_skip(ptr, channel->part2_3_length);
+	continue;
+      }
+
       sfbwidth[ch] =  sfbwidth_table[sfreqi].l;
       if (channel->block_type == 2) {
 	sfbwidth[ch] = (channel->flags & mixed_block_flag) ?
@@ -2403,109 +2890,57 @@ enum mad_error III_decode(struct mad_bitptr *ptr, struct mad_frame *frame,
 					gr == 0 ? 0 : si->scfsi[ch]);
       }
 
-      error = III_huffdecode(ptr, xr[ch], channel, sfbwidth[ch], part2_length);
+      /* the intensity stereo bound is where the right channel's
+	 spectrum ends, which may well be above the cap */
+
+      lines[ch] = III_lines(channel, sfbwidth[ch], sbcap);
+      if (ch == 1 && joint && (header->mode_extension & I_STEREO))
+	lines[ch] = 576;
+
+      error = III_huffdecode(ptr, xr[ch], channel, sfbwidth[ch], part2_length,
+			     lines[ch]);
       if (error)
 	return error;
     }
 
     /* joint stereo processing */
 
-    if (header->mode == MAD_MODE_JOINT_STEREO && header->mode_extension) {
-      error = III_stereo(xr, granule, header, sfbwidth[0]);
+    if (joint) {
+      error = III_stereo(xr, granule, header, sfbwidth[0], lines[0]);
       if (error)
 	return error;
     }
 
-    /* reordering, alias reduction, IMDCT, overlap-add, frequency inversion */
-
-    for (ch = 0; ch < nch; ++ch) {
-      struct channel const *channel = &granule->ch[ch];
-      mad_fixed_t (*sample)[32] = &frame->sbsample[ch][18 * gr];
-      unsigned int sb, l, i, sblimit;
-      mad_fixed_t output[36];
-
-      if (channel->block_type == 2) {
-	III_reorder(xr[ch], channel, sfbwidth[ch]);
-
-# if !defined(OPT_STRICT)
-	/*
-	 * According to ISO/IEC 11172-3, "Alias reduction is not applied for
-	 * granules with block_type == 2 (short block)." However, other
-	 * sources suggest alias reduction should indeed be performed on the
-	 * lower two subbands of mixed blocks. Most other implementations do
-	 * this, so by default we will too.
-	 */
-	if (channel->flags & mixed_block_flag)
-	  III_aliasreduce(xr[ch], 36);
-# endif
-      }
-      else
-	III_aliasreduce(xr[ch], 576);
-
-      l = 0;
-
-      /* subbands 0-1 */
-
-      if (channel->block_type != 2 || (channel->flags & mixed_block_flag)) {
-	unsigned int block_type;
-
-	block_type = channel->block_type;
-	if (channel->flags & mixed_block_flag)
-	  block_type = 0;
-
-	/* long blocks */
-	for (sb = 0; sb < 2; ++sb, l += 18) {
-	  III_imdct_l(&xr[ch][l], output, block_type);
-	  III_overlap(output, (*frame->overlap)[ch][sb], sample, sb);
-	}
-      }
-      else {
-	/* short blocks */
-	for (sb = 0; sb < 2; ++sb, l += 18) {
-	  III_imdct_s(&xr[ch][l], output);
-	  III_overlap(output, (*frame->overlap)[ch][sb], sample, sb);
-	}
-      }
-
-      III_freqinver(sample, 1);
+    /* reordering, alias reduction, IMDCT, overlap-add, frequency inversion;
+       with a worker, channel 1 is done there while channel 0 is done here */
 
-      /* (nonzero) subbands 2-31 */
+    if (worker && nch == 2 && only == nch) {
+      struct III_job job;
 
-      i = 576;
-      while (i > 36 && xr[ch][i - 1] == 0)
-	--i;
+      job.xr       = xr[1];
+      job.channel  = &granule->ch[1];
+      job.sfbwidth = sfbwidth[1];
+      job.overlap  = (*frame->overlap)[1];
+      job.sample   = &frame->sbsample[1][18 * gr];
+      job.sbcap    = sbcap;
 
-      sblimit = 32 - (576 - i) / 18;
+      worker->start(worker->data, III_channel_job, &job);
 
-      if (channel->block_type != 2) {
-	/* long blocks */
-	for (sb = 2; sb < sblimit; ++sb, l += 18) {
-	  III_imdct_l(&xr[ch][l], output, channel->block_type);
-	  III_overlap(output, (*frame->overlap)[ch][sb], sample, sb);
+      III_channel(xr[0], &granule->ch[0], sfbwidth[0], (*frame->overlap)[0],
+		  &frame->sbsample[0][18 * gr], sbcap);
 
-	  if (sb & 1)
-	    III_freqinver(sample, sb);
-	}
-      }
-      else {
-	/* short blocks */
-	for (sb = 2; sb < sblimit; ++sb, l += 18) {
-	  III_imdct_s(&xr[ch][l], output);
-	  III_overlap(output, (*frame->overlap)[ch][sb], sample, sb);
-
-	  if (sb & 1)
-	    III_freqinver(sample, sb);
-	}
-      }
+      worker->wait(worker->data);
+      continue;
+    }
 
-      /* remaining (zero) subbands */
+    for (ch = 0; ch < nch; ++ch) {
+      unsigned int och = (only < nch) ? 0 : ch;
 
-      for (sb = sblimit; sb < 32; ++sb) {
-	III_overlap_z((*frame->overlap)[ch][sb], sample, sb);
+      if (only < nch && ch != only)
+	continue;
 
-	if (sb & 1)
-	  III_freqinver(sample, sb);
-      }
+      III_channel(xr[ch], &granule->ch[ch], sfbwidth[ch],
+		  (*frame->overlap)[och], &frame->sbsample[och][18 * gr], sbcap);
     }
   }
 
@@ -2526,28 +2961,13 @@ int mad_layer_III(struct mad_stream *stream, struct mad_frame *frame)
   struct sideinfo si;
   enum mad_error error;
   int result = 0, i;
-  static mad_fixed_t ovlbuf[2 * 32 * 18];
 
-  /* allocate Layer III dynamic structures */
-    frame->overlap=(void*)ovlbuf;
-	stream->main_data=&MainData;
-/*
-  if (stream->main_data == 0) {
-    stream->main_data = malloc(MAD_BUFFER_MDLEN);
-    if (stream->main_data == 0) {
-      stream->error = MAD_ERROR_NOMEM;
-      return -1;
-    }
-  }
+  /* Layer III buffers are owned by the decoder context (see mad_sync_init) */
 
-  if (frame->overlap == 0) {
-    frame->overlap = calloc(2 * 32 * 18, sizeof(mad_fixed_t));
-    if (frame->overlap == 0) {
-      stream->error = MAD_ERROR_NOMEM;
-      return -1;
-    }
+  if (stream->main_data == 0 || frame->overlap == 0) {
+    stream->error = MAD_ERROR_NOMEM;
+    return -1;
   }
-*/
 
   nch = MAD_NCHANNELS(header);
   si_len = (header->flags & MAD_FLAG_LSF_EXT) ?
@@ -2558,6 +2978,7 @@ int mad_layer_III(struct mad_stream *stream, struct mad_frame *frame)
   if (stream->next_frame - mad_bit_nextbyte(&stream->ptr) <
       (signed int) si_len) {
     stream->error = MAD_ERROR_BADFRAMELEN;
+    stream->md_ptr = 0;
     stream->md_len = 0;
     return -1;
   }
@@ -2620,6 +3041,7 @@ int mad_layer_III(struct mad_stream *stream, struct mad_frame *frame)
 
   if (si.main_data_begin == 0) {
     ptr = stream->ptr;
+    stream->md_ptr = 0;
     stream->md_len = 0;
 
     frame_used = md_len;
@@ -2632,17 +3054,20 @@ int mad_layer_III(struct mad_stream *stream, struct mad_frame *frame)
       }
     }
     else {
-      mad_bit_init(&ptr,
-		   *stream->main_data + stream->md_len - si.main_data_begin);
+      unsigned char const *md;
 
-      if (md_len > si.main_data_begin) {
-	assert(stream->md_len + md_len -
-	       si.main_data_begin <= MAD_BUFFER_MDLEN);
+      /* the reservoir is either still in the input buffer or was saved */
 
-	memcpy(*stream->main_data + stream->md_len,
-	       mad_bit_nextbyte(&stream->ptr),
-	       frame_used = md_len - si.main_data_begin);
-	stream->md_len += frame_used;
+      md = stream->md_ptr ? stream->md_ptr : *stream->main_data;
+
+      mad_bit_init(&ptr, md + stream->md_len - si.main_data_begin);
+
+      /* read on into this frame's data without copying it */
+
+      if (md_len > si.main_data_begin) {
+	mad_bit_split(&ptr, md + stream->md_len,
+		      mad_bit_nextbyte(&stream->ptr));
+	frame_used = md_len - si.main_data_begin;
       }
     }
   }
@@ -2652,7 +3077,7 @@ int mad_layer_III(struct mad_stream *stream, struct mad_frame *frame)
   /* decode main_data */
 
   if (result == 0) {
-    error = III_decode(&ptr, frame, &si, nch);
+    error = III_decode(&ptr, frame, &si, nch, stream->worker);
     if (error) {
       stream->error = error;
       result = -1;
@@ -2672,33 +3097,34 @@ int mad_layer_III(struct mad_stream *stream, struct mad_frame *frame)
 	  data_bitlen, stream->anc_bitlen);
 # endif
 
-  /* preload main_data buffer with up to 511 bytes for next frame(s) */
+  /* keep up to 511 bytes of main_data for next frame(s) */
 
   if (frame_free >= next_md_begin) {
-    memcpy(*stream->main_data,
-	   stream->next_frame - next_md_begin, next_md_begin);
+    /* all of it is in this frame: leave it in the input buffer */
+    stream->md_ptr = stream->next_frame - next_md_begin;
     stream->md_len = next_md_begin;
   }
   else {
-    if (md_len < si.main_data_begin) {
-      unsigned int extra;
+    unsigned int extra = 0;
 
+    if (md_len < si.main_data_begin) {
       extra = si.main_data_begin - md_len;
       if (extra + frame_free > next_md_begin)
 	extra = next_md_begin - frame_free;
 
-      if (extra < stream->md_len) {
-	memmove(*stream->main_data,
-		*stream->main_data + stream->md_len - extra, extra);
-	stream->md_len = extra;
-      }
+      if (extra > stream->md_len)
+	extra = stream->md_len;
     }
-    else
-      stream->md_len = 0;
 
-    memcpy(*stream->main_data + stream->md_len,
+    /* spread over more frames: gather it in the reservoir */
+
+    memmove(*stream->main_data,
+	    (stream->md_ptr ? stream->md_ptr : *stream->main_data) +
+	    stream->md_len - extra, extra);
+    memcpy(*stream->main_data + extra,
 	   stream->next_frame - frame_free, frame_free);
-    stream->md_len += frame_free;
+    stream->md_ptr = 0;
+    stream->md_len = extra + frame_free;
   }
 
   return result;
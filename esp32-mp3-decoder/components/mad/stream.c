@@ -26,12 +26,11 @@
 # include "global.h"
 
 # include <stdlib.h>
+# include <string.h>
 
 # include "bit.h"
 # include "stream.h"
 
-main_data_t MainData; //static alloc of decoder data
-
 /*
  * NAME:	stream->init()
  * DESCRIPTION:	initialize stream struct
@@ -53,9 +52,11 @@ void mad_stream_init(struct mad_stream *stream)
   stream->anc_bitlen = 0;
 
   stream->main_data  = 0;
+  stream->md_ptr     = 0;
   stream->md_len     = 0;
 
   stream->options    = 0;
+  stream->worker     = 0;
   stream->error      = MAD_ERROR_NONE;
 }
 
@@ -90,6 +91,26 @@ void mad_stream_buffer(struct mad_stream *stream,
   stream->sync = 1;
 
   mad_bit_init(&stream->ptr, buffer);
+
+  /* main_data left in the old buffer can't be trusted anymore */
+
+  if (stream->md_ptr) {
+    stream->md_ptr = 0;
+    stream->md_len = 0;
+  }
+}
+
+/*
+ * NAME:	stream->detach()
+ * DESCRIPTION:	copy Layer III main_data that is still read from the input
+ *		buffer into the bit reservoir, so the buffer can be refilled
+ */
+void mad_stream_detach(struct mad_stream *stream)
+{
+  if (stream->md_ptr) {
+    memcpy(*stream->main_data, stream->md_ptr, stream->md_len);
+    stream->md_ptr = 0;
+  }
 }
 
 /*
@@ -39,6 +39,38 @@
  * use this routine if high-quality output is desired.
  */
 
+# if defined(FPM_FLOAT)
+/*
+ * With FPM_FLOAT the scaling is the same, 1.0 == 1 << 14. The offset keeps
+ * the sample positive, so that conversion to integer rounds it to nearest.
+ */
+
+static inline
+signed short scale(mad_fixed_t sample)
+{
+  /* clip */
+  if (sample >= MAD_F_ONE)
+    sample = MAD_F_ONE - MAD_F(1L << 14);
+  else if (sample < -MAD_F_ONE)
+    sample = -MAD_F_ONE;
+
+  /* round and quantize */
+  return (signed int) (sample * (1 << 14) + (32768 + 0.5f)) - 32768;
+}
+
+static inline
+signed short scale_mix(mad_fixed_t sample)
+{
+  /* clip */
+  if (sample >= 2 * MAD_F_ONE)
+    sample = 2 * MAD_F_ONE - MAD_F(1L << 14);
+  else if (sample < -2 * MAD_F_ONE)
+    sample = -2 * MAD_F_ONE;
+
+  /* round and quantize */
+  return (signed int) (sample * (1 << 14) + (32768 + 0.5f)) - 32768;
+}
+# else
 static inline
 signed short scale(mad_fixed_t sample)
 {
@@ -59,6 +91,29 @@ signed short scale(mad_fixed_t sample)
   //This seems to be OK:
   return sample >> (MAD_F_FRACBITS + 2 - 16);
 }
+
+/*
+ * The mono mix is synthesized from left + right, so it is allowed twice the
+ * range before clipping.
+ */
+
+static inline
+signed short scale_mix(mad_fixed_t sample)
+{
+  /* round */
+  sample += (1L << (MAD_F_FRACBITS - 16));
+
+  /* clip */
+  if (sample >= 2 * MAD_F_ONE)
+    sample = 2 * MAD_F_ONE - 1;
+  else if (sample < -2 * MAD_F_ONE)
+    sample = -2 * MAD_F_ONE;
+
+  /* quantize */
+  return sample >> (MAD_F_FRACBITS + 2 - 16);
+}
+# endif
+
 /*
  * NAME:	synth->init()
  * DESCRIPTION:	initialize synth struct
@@ -72,6 +127,11 @@ void mad_synth_init(struct mad_synth *synth)
   synth->pcm.samplerate = 0;
   synth->pcm.channels   = 0;
   synth->pcm.length     = 0;
+  synth->pcm.layout     = MAD_PCM_LAYOUT_MONO;
+  synth->pcm.format     = MAD_PCM_FORMAT_S16;
+
+  synth->sink   = 0;
+  synth->worker = 0;
 }
 
 /*
@@ -122,6 +182,12 @@ void mad_synth_mute(struct mad_synth *synth)
 #  define OPT_SSO
 # endif
 
+/* and floating point has no shifts to place */
+
+# if defined(FPM_FLOAT)
+#  undef OPT_SSO
+# endif
+
 /* second SSO shift, with rounding */
 
 # if defined(OPT_SSO)
@@ -145,38 +211,105 @@ void mad_synth_mute(struct mad_synth *synth)
 #  define MUL(x, y)  mad_f_mul((x), (y))
 # endif
 
+/*
+ * The DCT below is Lee's factorization, (N/2)log2(N) = 80 multiplies for
+ * N = 32, which is about as few as any unscaled 32-point DCT gets. Where
+ * the compiler has generic vector support and a vector unit, it is instead
+ * run on DCT_LANES slots at once, one slot per lane: every butterfly then
+ * stays within its lane, so no shuffles are needed and, with the 32-bit
+ * SSO multiply or FPM_FLOAT, each lane is bit-identical to the scalar DCT.
+ * Define OPT_DCT_SCALAR to always use the one-slot-at-a-time DCT.
+ */
+
+# if ((defined(OPT_SSO) && defined(FPM_DEFAULT)) || defined(FPM_FLOAT)) &&  \
+    !defined(OPT_DCTO) && !defined(OPT_DCT_SCALAR) &&  \
+    defined(__GNUC__) && !defined(__clang__) &&  \
+    (defined(__x86_64__) || defined(__i386__) || defined(__aarch64__))
+#  define DCT_LANES  4
+#  define DCT_COLS   1
+
+typedef mad_fixed_t dct_t
+  __attribute__((vector_size(DCT_LANES * sizeof(mad_fixed_t))));
+typedef signed int dct_i  /* shuffle masks */
+  __attribute__((vector_size(DCT_LANES * sizeof(signed int))));
+typedef dct_t dct_out_t;
+# else
+#  define DCT_COLS   8
+
+typedef mad_fixed_t dct_t;
+typedef mad_filter_t dct_out_t;
+# endif
+
+/*
+ * With OPT_SYNTH16 the filterbank and D[] hold 16-bit values, so that the
+ * window step is 16x16->32-bit multiply-accumulates: the second SSO shift
+ * is 14 bits rather than 12 and the third is dropped. The filterbank
+ * saturates at FILTER16_MAX; the 16 taps of D[] behind any sample add up to
+ * at most 5.36 in magnitude, so the 32-bit sum can then never overflow.
+ */
+
+# if defined(OPT_SYNTH16)
+#  if !defined(OPT_SSO)
+#   error "OPT_SYNTH16 requires OPT_SSO"
+#  endif
+
+#  define FILTER16_MAX  24000  /* 1.46 */
+
+static inline
+mad_filter_t narrow(mad_fixed_t x)
+{
+  if (x > FILTER16_MAX)
+    return FILTER16_MAX;
+  if (x < -FILTER16_MAX)
+    return -FILTER16_MAX;
+
+  return x;
+}
+
+#  undef  SHIFT
+#  if defined(DCT_LANES)
+#   define SHIFT(x)   (((x) + (1L << 13)) >> 14)
+#   define NARROW(x)  narrow(x)
+#  else
+#   define SHIFT(x)   narrow(((x) + (1L << 13)) >> 14)
+#   define NARROW(x)  (x)
+#  endif
+# else
+#  define NARROW(x)   (x)
+# endif
+
 /*
  * NAME:	dct32()
  * DESCRIPTION:	perform fast in[32]->out[32] DCT
  */
 
 static
-void dct32(mad_fixed_t const in[32], unsigned int slot,
-	   mad_fixed_t lo[16][8], mad_fixed_t hi[16][8])
+void dct32(dct_t const in[32], unsigned int slot,
+	   dct_out_t lo[16][DCT_COLS], dct_out_t hi[16][DCT_COLS])
 {
-  mad_fixed_t t0,   t1,   t2,   t3,   t4,   t5,   t6,   t7;
-  mad_fixed_t t8,   t9,   t10,  t11,  t12,  t13,  t14,  t15;
-  mad_fixed_t t16,  t17,  t18,  t19,  t20,  t21,  t22,  t23;
-  mad_fixed_t t24,  t25,  t26,  t27,  t28,  t29,  t30,  t31;
-  mad_fixed_t t32,  t33,  t34,  t35,  t36,  t37,  t38,  t39;
-  mad_fixed_t t40,  t41,  t42,  t43,  t44,  t45,  t46,  t47;
-  mad_fixed_t t48,  t49,  t50,  t51,  t52,  t53,  t54,  t55;
-  mad_fixed_t t56,  t57,  t58,  t59,  t60,  t61,  t62,  t63;
-  mad_fixed_t t64,  t65,  t66,  t67,  t68,  t69,  t70,  t71;
-  mad_fixed_t t72,  t73,  t74,  t75,  t76,  t77,  t78,  t79;
-  mad_fixed_t t80,  t81,  t82,  t83,  t84,  t85,  t86,  t87;
-  mad_fixed_t t88,  t89,  t90,  t91,  t92,  t93,  t94,  t95;
-  mad_fixed_t t96,  t97,  t98,  t99,  t100, t101, t102, t103;
-  mad_fixed_t t104, t105, t106, t107, t108, t109, t110, t111;
-  mad_fixed_t t112, t113, t114, t115, t116, t117, t118, t119;
-  mad_fixed_t t120, t121, t122, t123, t124, t125, t126, t127;
-  mad_fixed_t t128, t129, t130, t131, t132, t133, t134, t135;
-  mad_fixed_t t136, t137, t138, t139, t140, t141, t142, t143;
-  mad_fixed_t t144, t145, t146, t147, t148, t149, t150, t151;
-  mad_fixed_t t152, t153, t154, t155, t156, t157, t158, t159;
-  mad_fixed_t t160, t161, t162, t163, t164, t165, t166, t167;
-  mad_fixed_t t168, t169, t170, t171, t172, t173, t174, t175;
-  mad_fixed_t t176;
+  dct_t t0,   t1,   t2,   t3,   t4,   t5,   t6,   t7;
+  dct_t t8,   t9,   t10,  t11,  t12,  t13,  t14,  t15;
+  dct_t t16,  t17,  t18,  t19,  t20,  t21,  t22,  t23;
+  dct_t t24,  t25,  t26,  t27,  t28,  t29,  t30,  t31;
+  dct_t t32,  t33,  t34,  t35,  t36,  t37,  t38,  t39;
+  dct_t t40,  t41,  t42,  t43,  t44,  t45,  t46,  t47;
+  dct_t t48,  t49,  t50,  t51,  t52,  t53,  t54,  t55;
+  dct_t t56,  t57,  t58,  t59,  t60,  t61,  t62,  t63;
+  dct_t t64,  t65,  t66,  t67,  t68,  t69,  t70,  t71;
+  dct_t t72,  t73,  t74,  t75,  t76,  t77,  t78,  t79;
+  dct_t t80,  t81,  t82,  t83,  t84,  t85,  t86,  t87;
+  dct_t t88,  t89,  t90,  t91,  t92,  t93,  t94,  t95;
+  dct_t t96,  t97,  t98,  t99,  t100, t101, t102, t103;
+  dct_t t104, t105, t106, t107, t108, t109, t110, t111;
+  dct_t t112, t113, t114, t115, t116, t117, t118, t119;
+  dct_t t120, t121, t122, t123, t124, t125, t126, t127;
+  dct_t t128, t129, t130, t131, t132, t133, t134, t135;
+  dct_t t136, t137, t138, t139, t140, t141, t142, t143;
+  dct_t t144, t145, t146, t147, t148, t149, t150, t151;
+  dct_t t152, t153, t154, t155, t156, t157, t158, t159;
+  dct_t t160, t161, t162, t163, t164, t165, t166, t167;
+  dct_t t168, t169, t170, t171, t172, t173, t174, t175;
+  dct_t t176;
 
   /* costab[i] = cos(PI / (2 * 32) * i) */
 
@@ -545,6 +678,75 @@ void dct32(mad_fixed_t const in[32], unsigned int slot,
 # undef MUL
 # undef SHIFT
 
+# if defined(DCT_LANES)
+/*
+ * NAME:	dct32_block()
+ * DESCRIPTION:	perform the DCT of DCT_LANES consecutive slots of a channel
+ *		(or of the mono mix of both channels), one slot per lane
+ */
+static
+void dct32_block(struct mad_frame const *frame, unsigned int ch,
+		 unsigned int s, unsigned int ns, unsigned int mix,
+		 dct_t lo[16][DCT_COLS], dct_t hi[16][DCT_COLS])
+{
+  unsigned int slot[DCT_LANES], l, sb, sbcap;
+  dct_t in[32], v[DCT_LANES], w;
+
+  /* a short last block repeats its last slot in the unused lanes */
+
+  for (l = 0; l < DCT_LANES; ++l)
+    slot[l] = s + l < ns ? s + l : ns - 1;
+
+  /* subbands above a cap are known to be zero (see MAD_OPTION_SBLIMIT) */
+
+  sbcap = (MAD_SBLIMIT(frame->options) + DCT_LANES - 1) & ~(DCT_LANES - 1);
+
+  for (sb = sbcap; sb < 32; ++sb)
+    in[sb] = (dct_t) { 0 };
+
+  for (sb = 0; sb < sbcap; sb += DCT_LANES) {
+    for (l = 0; l < DCT_LANES; ++l) {
+      memcpy(&v[l], &frame->sbsample[ch][slot[l]][sb], sizeof(dct_t));
+      if (mix) {
+	memcpy(&w, &frame->sbsample[1][slot[l]][sb], sizeof(dct_t));
+	v[l] += w;
+      }
+    }
+
+    /* transpose, so that in[sb + i] holds subband sb + i of every slot */
+
+    w         = __builtin_shuffle(v[0], v[1], (dct_i) { 0, 4, 1, 5 });
+    v[1]      = __builtin_shuffle(v[0], v[1], (dct_i) { 2, 6, 3, 7 });
+    v[0]      = w;
+    w         = __builtin_shuffle(v[2], v[3], (dct_i) { 0, 4, 1, 5 });
+    v[3]      = __builtin_shuffle(v[2], v[3], (dct_i) { 2, 6, 3, 7 });
+
+    in[sb + 0] = __builtin_shuffle(v[0], w,    (dct_i) { 0, 1, 4, 5 });
+    in[sb + 1] = __builtin_shuffle(v[0], w,    (dct_i) { 2, 3, 6, 7 });
+    in[sb + 2] = __builtin_shuffle(v[1], v[3], (dct_i) { 0, 1, 4, 5 });
+    in[sb + 3] = __builtin_shuffle(v[1], v[3], (dct_i) { 2, 3, 6, 7 });
+  }
+
+  dct32(in, 0, lo, hi);
+}
+
+/*
+ * NAME:	dct32_store()
+ * DESCRIPTION:	move one lane of a dct32_block() result into the filterbank
+ */
+static inline
+void dct32_store(dct_t const out[2][16][DCT_COLS], unsigned int lane,
+		 unsigned int phase, mad_filter_t filter[2][2][16][8])
+{
+  unsigned int sb;
+
+  for (sb = 0; sb < 16; ++sb) {
+    filter[0][phase & 1][sb][phase >> 1] = NARROW(out[0][sb][0][lane]);
+    filter[1][phase & 1][sb][phase >> 1] = NARROW(out[1][sb][0][lane]);
+  }
+}
+# endif
+
 /* third SSO shift and/or D[] optimization preshift */
 
 # if defined(OPT_SSO)
@@ -555,7 +757,11 @@ void dct32(mad_fixed_t const in[32], unsigned int slot,
 #  define MLA(hi, lo, x, y)	((lo) += (x) * (y))
 #  define MLN(hi, lo)		((lo)  = -(lo))
 #  define MLZ(hi, lo)		((void) (hi), (mad_fixed_t) (lo))
-#  define SHIFT(x)		((x) >> 2)
+#  if defined(OPT_SYNTH16)
+#   define SHIFT(x)		(x)
+#  else
+#   define SHIFT(x)		((x) >> 2)
+#  endif
 #  define PRESHIFT(x)		((MAD_F(x) + (1L << 13)) >> 14)
 # else
 #  define ML0(hi, lo, x, y)	MAD_F_ML0((hi), (lo), (x), (y))
@@ -576,47 +782,451 @@ void dct32(mad_fixed_t const in[32], unsigned int slot,
 
 
 static
-mad_fixed_t const D[17][32] = {
+mad_filter_t const D[17][32] = {
 # include "D.dat"
 };
 
+/*
+ * On hosts that have them, SIMD kernels can do the window/accumulate step
+ * of synth_full(). Every output sample of a slot is the sum of two 8-tap
+ * dot products against rows of the filter bank. The D[] coefficients are
+ * gathered per phase into window[][] once at startup, so the kernels only
+ * need contiguous loads, 32-bit multiplies and adds. With OPT_SSO this is
+ * the same modular integer arithmetic as the scalar code, so the output is
+ * bit-identical; the scalar code is used when no kernel is available. With
+ * OPT_SYNTH16 they are 16-bit multiply-adds into 32 bits, again the same
+ * arithmetic. With FPM_FLOAT the kernels sum in a different order than the
+ * scalar code, so the two can differ by rounding. Define OPT_SYNTH_SCALAR
+ * to always use the scalar code.
+ */
+
+# if (defined(OPT_SSO) || defined(FPM_FLOAT)) && !defined(ASO_SYNTH) &&  \
+    !defined(OPT_SYNTH_SCALAR) && defined(__GNUC__) &&  \
+    (defined(__x86_64__) || defined(__i386__) || defined(__aarch64__))
+#  define SYNTH_SIMD
+# endif
+
+# if defined(SYNTH_SIMD)
+#  if defined(__aarch64__)
+#   include <arm_neon.h>
+#  else
+#   include <immintrin.h>
+#  endif
+
+/* coefficients for rows[0][k] and rows[1][k], per phase and output sample */
+static
+mad_filter_t window[16][32][2][8] __attribute__((aligned(32)));
+
+static
+void (*window_kernel)(mad_fixed_t [32], mad_filter_t const *const [2][32],
+		      mad_filter_t const (*)[2][8]);
+
+#  if defined(FPM_FLOAT) && defined(__aarch64__)
+/*
+ * NAME:	window_neon()
+ * DESCRIPTION:	window/accumulate one slot, 4 output samples at a time
+ */
+static
+void window_neon(mad_fixed_t raw[32], mad_filter_t const *const rows[2][32],
+		 mad_filter_t const (*coef)[2][8])
+{
+  unsigned int k, j;
+
+  for (k = 0; k < 32; k += 4) {
+    float32x4_t v[4];
+
+    for (j = 0; j < 4; ++j) {
+      mad_filter_t const *a = rows[0][k + j], *b = rows[1][k + j];
+      mad_filter_t const *wa = coef[k + j][0], *wb = coef[k + j][1];
+
+      v[j] = vmulq_f32(vld1q_f32(a + 0), vld1q_f32(wa + 0));
+      v[j] = vmlaq_f32(v[j], vld1q_f32(a + 4), vld1q_f32(wa + 4));
+      v[j] = vmlaq_f32(v[j], vld1q_f32(b + 0), vld1q_f32(wb + 0));
+      v[j] = vmlaq_f32(v[j], vld1q_f32(b + 4), vld1q_f32(wb + 4));
+    }
+
+    vst1q_f32(&raw[k], vpaddq_f32(vpaddq_f32(v[0], v[1]),
+				  vpaddq_f32(v[2], v[3])));
+  }
+}
+#  elif defined(FPM_FLOAT)
+/*
+ * NAME:	window_sse3()
+ * DESCRIPTION:	window/accumulate one slot, 4 output samples at a time
+ */
+static __attribute__((target("sse3")))
+void window_sse3(mad_fixed_t raw[32], mad_filter_t const *const rows[2][32],
+		 mad_filter_t const (*coef)[2][8])
+{
+  unsigned int k, j;
+
+  for (k = 0; k < 32; k += 4) {
+    __m128 v[4];
+
+    for (j = 0; j < 4; ++j) {
+      mad_filter_t const *a = rows[0][k + j], *b = rows[1][k + j];
+      __m128 const *wa = (__m128 const *) coef[k + j][0];
+      __m128 const *wb = (__m128 const *) coef[k + j][1];
+
+      v[j] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(a + 0), wa[0]),
+				   _mm_mul_ps(_mm_loadu_ps(a + 4), wa[1])),
+			_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(b + 0), wb[0]),
+				   _mm_mul_ps(_mm_loadu_ps(b + 4), wb[1])));
+    }
+
+    _mm_storeu_ps(&raw[k], _mm_hadd_ps(_mm_hadd_ps(v[0], v[1]),
+				       _mm_hadd_ps(v[2], v[3])));
+  }
+}
+
+/*
+ * NAME:	window_avx()
+ * DESCRIPTION:	window/accumulate one slot, 8 output samples at a time
+ */
+static __attribute__((target("avx")))
+void window_avx(mad_fixed_t raw[32], mad_filter_t const *const rows[2][32],
+		mad_filter_t const (*coef)[2][8])
+{
+  unsigned int k, j;
+
+  for (k = 0; k < 32; k += 8) {
+    __m256 v[8], lo, hi;
+
+    for (j = 0; j < 8; ++j) {
+      __m256 a = _mm256_loadu_ps(rows[0][k + j]);
+      __m256 b = _mm256_loadu_ps(rows[1][k + j]);
+
+      v[j] = _mm256_add_ps(_mm256_mul_ps(a, *(__m256 const *) coef[k + j][0]),
+			   _mm256_mul_ps(b, *(__m256 const *) coef[k + j][1]));
+    }
+
+    /* transpose-and-add: lane j of the result is the sum of v[j] */
+
+    lo = _mm256_hadd_ps(_mm256_hadd_ps(v[0], v[1]),
+			_mm256_hadd_ps(v[2], v[3]));
+    hi = _mm256_hadd_ps(_mm256_hadd_ps(v[4], v[5]),
+			_mm256_hadd_ps(v[6], v[7]));
+
+    _mm256_storeu_ps(&raw[k],
+		     _mm256_add_ps(_mm256_permute2f128_ps(lo, hi, 0x20),
+				   _mm256_permute2f128_ps(lo, hi, 0x31)));
+  }
+}
+#  elif defined(OPT_SYNTH16) && defined(__aarch64__)
+/*
+ * NAME:	window_neon()
+ * DESCRIPTION:	window/accumulate one slot, 4 output samples at a time
+ */
+static
+void window_neon(mad_fixed_t raw[32], mad_filter_t const *const rows[2][32],
+		 mad_filter_t const (*coef)[2][8])
+{
+  unsigned int k, j;
+
+  for (k = 0; k < 32; k += 4) {
+    int32x4_t v[4];
+
+    for (j = 0; j < 4; ++j) {
+      int16x8_t a  = vld1q_s16(rows[0][k + j]);
+      int16x8_t b  = vld1q_s16(rows[1][k + j]);
+      int16x8_t wa = vld1q_s16(coef[k + j][0]);
+      int16x8_t wb = vld1q_s16(coef[k + j][1]);
+
+      v[j] = vmull_s16(vget_low_s16(a), vget_low_s16(wa));
+      v[j] = vmlal_high_s16(v[j], a, wa);
+      v[j] = vmlal_s16(v[j], vget_low_s16(b), vget_low_s16(wb));
+      v[j] = vmlal_high_s16(v[j], b, wb);
+    }
+
+    vst1q_s32(&raw[k], vpaddq_s32(vpaddq_s32(v[0], v[1]),
+				  vpaddq_s32(v[2], v[3])));
+  }
+}
+#  elif defined(OPT_SYNTH16)
+/*
+ * NAME:	window_ssse3()
+ * DESCRIPTION:	window/accumulate one slot, 4 output samples at a time
+ */
+static __attribute__((target("ssse3")))
+void window_ssse3(mad_fixed_t raw[32], mad_filter_t const *const rows[2][32],
+		  mad_filter_t const (*coef)[2][8])
+{
+  unsigned int k, j;
+
+  for (k = 0; k < 32; k += 4) {
+    __m128i v[4];
+
+    for (j = 0; j < 4; ++j) {
+      __m128i a = _mm_loadu_si128((__m128i const *) rows[0][k + j]);
+      __m128i b = _mm_loadu_si128((__m128i const *) rows[1][k + j]);
+
+      v[j] = _mm_add_epi32(
+	_mm_madd_epi16(a, *(__m128i const *) coef[k + j][0]),
+	_mm_madd_epi16(b, *(__m128i const *) coef[k + j][1]));
+    }
+
+    _mm_storeu_si128((__m128i *) &raw[k],
+		     _mm_hadd_epi32(_mm_hadd_epi32(v[0], v[1]),
+				    _mm_hadd_epi32(v[2], v[3])));
+  }
+}
+
+/*
+ * NAME:	window_avx2()
+ * DESCRIPTION:	window/accumulate one slot, 8 output samples at a time
+ */
+static __attribute__((target("avx2")))
+void window_avx2(mad_fixed_t raw[32], mad_filter_t const *const rows[2][32],
+		 mad_filter_t const (*coef)[2][8])
+{
+  unsigned int k, j;
+
+  for (k = 0; k < 32; k += 8) {
+    __m256i v[8], lo, hi;
+
+    for (j = 0; j < 8; ++j) {
+      __m256i ab = _mm256_inserti128_si256(
+	_mm256_castsi128_si256(
+	  _mm_loadu_si128((__m128i const *) rows[0][k + j])),
+	_mm_loadu_si128((__m128i const *) rows[1][k + j]), 1);
+
+      v[j] = _mm256_madd_epi16(ab, *(__m256i const *) coef[k + j]);
+    }
+
+    /* transpose-and-add: lane j of the result is the sum of v[j] */
+
+    lo = _mm256_hadd_epi32(_mm256_hadd_epi32(v[0], v[1]),
+			   _mm256_hadd_epi32(v[2], v[3]));
+    hi = _mm256_hadd_epi32(_mm256_hadd_epi32(v[4], v[5]),
+			   _mm256_hadd_epi32(v[6], v[7]));
+
+    _mm256_storeu_si256((__m256i *) &raw[k],
+			_mm256_add_epi32(_mm256_permute2x128_si256(lo, hi, 0x20),
+					 _mm256_permute2x128_si256(lo, hi, 0x31)));
+  }
+}
+#  elif defined(__aarch64__)
+/*
+ * NAME:	window_neon()
+ * DESCRIPTION:	window/accumulate one slot, 4 output samples at a time
+ */
+static
+void window_neon(mad_fixed_t raw[32], mad_filter_t const *const rows[2][32],
+		 mad_filter_t const (*coef)[2][8])
+{
+  unsigned int k, j;
+
+  for (k = 0; k < 32; k += 4) {
+    int32x4_t v[4];
+
+    for (j = 0; j < 4; ++j) {
+      mad_filter_t const *a = rows[0][k + j], *b = rows[1][k + j];
+      mad_filter_t const *wa = coef[k + j][0], *wb = coef[k + j][1];
+
+      v[j] = vmulq_s32(vld1q_s32(a + 0), vld1q_s32(wa + 0));
+      v[j] = vmlaq_s32(v[j], vld1q_s32(a + 4), vld1q_s32(wa + 4));
+      v[j] = vmlaq_s32(v[j], vld1q_s32(b + 0), vld1q_s32(wb + 0));
+      v[j] = vmlaq_s32(v[j], vld1q_s32(b + 4), vld1q_s32(wb + 4));
+    }
+
+    vst1q_s32(&raw[k], vpaddq_s32(vpaddq_s32(v[0], v[1]),
+				  vpaddq_s32(v[2], v[3])));
+  }
+}
+#  else
+/*
+ * NAME:	window_sse41()
+ * DESCRIPTION:	window/accumulate one slot, 4 output samples at a time
+ */
+static __attribute__((target("sse4.1")))
+void window_sse41(mad_fixed_t raw[32], mad_filter_t const *const rows[2][32],
+		  mad_filter_t const (*coef)[2][8])
+{
+  unsigned int k, j;
+
+  for (k = 0; k < 32; k += 4) {
+    __m128i v[4];
+
+    for (j = 0; j < 4; ++j) {
+      __m128i const *a  = (__m128i const *) rows[0][k + j];
+      __m128i const *b  = (__m128i const *) rows[1][k + j];
+      __m128i const *wa = (__m128i const *) coef[k + j][0];
+      __m128i const *wb = (__m128i const *) coef[k + j][1];
+
+      v[j] = _mm_add_epi32(
+	_mm_add_epi32(_mm_mullo_epi32(_mm_loadu_si128(&a[0]), wa[0]),
+		      _mm_mullo_epi32(_mm_loadu_si128(&a[1]), wa[1])),
+	_mm_add_epi32(_mm_mullo_epi32(_mm_loadu_si128(&b[0]), wb[0]),
+		      _mm_mullo_epi32(_mm_loadu_si128(&b[1]), wb[1])));
+    }
+
+    _mm_storeu_si128((__m128i *) &raw[k],
+		     _mm_hadd_epi32(_mm_hadd_epi32(v[0], v[1]),
+				    _mm_hadd_epi32(v[2], v[3])));
+  }
+}
+
+/*
+ * NAME:	window_avx2()
+ * DESCRIPTION:	window/accumulate one slot, 8 output samples at a time
+ */
+static __attribute__((target("avx2")))
+void window_avx2(mad_fixed_t raw[32], mad_filter_t const *const rows[2][32],
+		 mad_filter_t const (*coef)[2][8])
+{
+  unsigned int k, j;
+
+  for (k = 0; k < 32; k += 8) {
+    __m256i v[8], lo, hi;
+
+    for (j = 0; j < 8; ++j) {
+      __m256i a = _mm256_loadu_si256((__m256i const *) rows[0][k + j]);
+      __m256i b = _mm256_loadu_si256((__m256i const *) rows[1][k + j]);
+
+      v[j] = _mm256_add_epi32(
+	_mm256_mullo_epi32(a, *(__m256i const *) coef[k + j][0]),
+	_mm256_mullo_epi32(b, *(__m256i const *) coef[k + j][1]));
+    }
+
+    /* transpose-and-add: lane j of the result is the sum of v[j] */
+
+    lo = _mm256_hadd_epi32(_mm256_hadd_epi32(v[0], v[1]),
+			   _mm256_hadd_epi32(v[2], v[3]));
+    hi = _mm256_hadd_epi32(_mm256_hadd_epi32(v[4], v[5]),
+			   _mm256_hadd_epi32(v[6], v[7]));
+
+    _mm256_storeu_si256((__m256i *) &raw[k],
+			_mm256_add_epi32(_mm256_permute2x128_si256(lo, hi, 0x20),
+					 _mm256_permute2x128_si256(lo, hi, 0x31)));
+  }
+}
+#  endif
+
+/*
+ * NAME:	window_init()
+ * DESCRIPTION:	gather the window coefficients and pick a kernel
+ */
+static __attribute__((constructor))
+void window_init(void)
+{
+  static unsigned char const tap[8]  = {  0, 14, 12, 10, 8, 6, 4, 2 };
+  static unsigned char const tapm[8] = { 16, 14, 12, 10, 8, 6, 4, 2 };
+  unsigned int phase, sb, i;
+
+  for (phase = 0; phase < 16; ++phase) {
+    unsigned int pe, po;
+    mad_filter_t (*w)[2][8] = window[phase];
+
+    pe = phase & ~1;
+    po = ((phase - 1) & 0xf) | 1;
+
+    /* negated terms are the ones synth_full() accumulates before MLN() */
+
+    for (i = 0; i < 8; ++i) {
+      w[0][0][i] = -D[0][po + tap[i]];
+      w[0][1][i] =  D[0][pe + tap[i]];
+
+      for (sb = 1; sb < 16; ++sb) {
+	w[sb][0][i]      = -D[sb][po + tap[i]];
+	w[sb][1][i]      =  D[sb][pe + tap[i]];
+
+	w[32 - sb][0][i] =  D[sb][31 - tapm[i] - pe];
+	w[32 - sb][1][i] =  D[sb][31 - tapm[i] - po];
+      }
+
+      w[16][0][i] = -D[16][po + tap[i]];
+      w[16][1][i] = 0;
+    }
+  }
+
+#  if defined(__aarch64__)
+  window_kernel = window_neon;
+#  elif defined(FPM_FLOAT)
+  __builtin_cpu_init();
+
+  if (__builtin_cpu_supports("avx"))
+    window_kernel = window_avx;
+  else if (__builtin_cpu_supports("sse3"))
+    window_kernel = window_sse3;
+#  elif defined(OPT_SYNTH16)
+  __builtin_cpu_init();
+
+  if (__builtin_cpu_supports("avx2"))
+    window_kernel = window_avx2;
+  else if (__builtin_cpu_supports("ssse3"))
+    window_kernel = window_ssse3;
+#  else
+  __builtin_cpu_init();
+
+  if (__builtin_cpu_supports("avx2"))
+    window_kernel = window_avx2;
+  else if (__builtin_cpu_supports("sse4.1"))
+    window_kernel = window_sse41;
+#  endif
+}
+# endif
+
 # if defined(ASO_SYNTH)
 void synth_full(struct mad_synth *, struct mad_frame const *,
-		unsigned int, unsigned int);
+		unsigned int, unsigned int, unsigned int);
 # else
 /*
  * NAME:	synth->full()
- * DESCRIPTION:	perform full frequency PCM synthesis
+ * DESCRIPTION:	perform full frequency PCM synthesis of channels first..nch-1
  */
 static
 void  synth_full(struct mad_synth *synth, struct mad_frame const *frame,
-		unsigned int nch, unsigned int ns)
+		unsigned int first, unsigned int nch, unsigned int ns)
 {
   unsigned int phase, ch, s, sb, pe, po;
   short int *pcm1, *pcm2;
-  mad_fixed_t (*filter)[2][2][16][8];
-  mad_fixed_t (*sbsample)[36][32];
-  register mad_fixed_t (*fe)[8], (*fx)[8], (*fo)[8];
-  register mad_fixed_t const (*Dptr)[32], *ptr ;
+  mad_filter_t (*filter)[2][2][16][8];
+  register mad_filter_t (*fe)[8], (*fx)[8], (*fo)[8];
+  register mad_filter_t const (*Dptr)[32], *ptr ;
   register mad_fixed64hi_t hi;
   register mad_fixed64lo_t lo;
   mad_fixed_t raw_sample;
-  short int short_sample_buff[32];
+  unsigned int stride, mix;
+# if defined(DCT_LANES)
+  dct_t block[2][2][16][DCT_COLS];
+# else
+  mad_fixed_t mono[32];
+# endif
 
-  phase = synth->phase;
+  phase  = synth->phase;
+  stride = synth->pcm.channels;
+
+  /* mono output of a stereo frame: mix the subbands, synthesize once */
+  mix = (stride == 1 && nch == 2);
+  if (mix)
+    nch = 1;
 
   for (s = 0; s < ns; ++s)
   {
-    memset (short_sample_buff, 0x00, sizeof(short_sample_buff));
+# if defined(DCT_LANES)
+    if (s % DCT_LANES == 0) {
+      for (ch = first; ch < nch; ++ch)
+	dct32_block(frame, ch, s, ns, mix, block[ch][0], block[ch][1]);
+    }
+# else
+    if (mix) {
+      for (sb = 0; sb < 32; ++sb)
+	mono[sb] = frame->sbsample[0][s][sb] + frame->sbsample[1][s][sb];
+    }
+# endif
 
-    for (ch = 0; ch < nch; ++ch)
+    for (ch = first; ch < nch; ++ch)
     {
-    sbsample = (void*)&frame->sbsample[ch];
     filter   = &synth->filter[ch];
-      pcm1     = short_sample_buff;
+      pcm1     = &synth->pcm.samples[(s * 32) * stride + (stride > 1 ? ch : 0)];
 
-      dct32((*sbsample)[s], phase >> 1,
+# if defined(DCT_LANES)
+      dct32_store((dct_t const (*)[16][DCT_COLS]) block[ch], s % DCT_LANES,
+		  phase, *filter);
+# else
+      dct32(mix ? mono : frame->sbsample[ch][s], phase >> 1,
 	    (*filter)[0][phase & 1], (*filter)[1][phase & 1]);
+# endif
 
       pe = phase & ~1;
       po = ((phase - 1) & 0xf) | 1;
@@ -627,6 +1237,36 @@ void  synth_full(struct mad_synth *synth, struct mad_frame const *frame,
       fx = &(*filter)[0][~phase & 1][0];
       fo = &(*filter)[1][~phase & 1][0];
 
+# if defined(SYNTH_SIMD)
+      if (window_kernel) {
+	mad_filter_t const *rows[2][32];
+	mad_fixed_t raw[32];
+
+	rows[0][0]  = fx[0];
+	rows[1][0]  = fe[0];
+	rows[0][16] = fo[15];
+	rows[1][16] = fe[0];
+
+	for (sb = 1; sb < 16; ++sb) {
+	  rows[0][sb]      = fo[sb - 1];
+	  rows[1][sb]      = fe[sb];
+	  rows[0][32 - sb] = fe[sb];
+	  rows[1][32 - sb] = fo[sb - 1];
+	}
+
+	window_kernel(raw, (mad_filter_t const *const (*)[32]) rows,
+		      window[phase]);
+
+	for (sb = 0; sb < 32; ++sb) {
+	  raw_sample = SHIFT(raw[sb]);
+	  raw_sample = mix ? scale_mix(raw_sample) : scale(raw_sample);
+	  pcm1[sb * stride] = (short int) raw_sample;
+	}
+
+	continue;
+      }
+# endif
+
       Dptr = &D[0];
 
       ptr = *Dptr + po;
@@ -651,9 +1291,10 @@ void  synth_full(struct mad_synth *synth, struct mad_frame const *frame,
       MLA(hi, lo, (*fe)[7], ptr[ 2]);
 
       raw_sample = SHIFT(MLZ(hi, lo));
-      raw_sample = scale(raw_sample);
-      (*pcm1++) += (short int)raw_sample;
-      pcm2 = pcm1 + 30;
+      raw_sample = mix ? scale_mix(raw_sample) : scale(raw_sample);
+      *pcm1 = (short int)raw_sample;
+      pcm1 += stride;
+      pcm2 = pcm1 + 30 * stride;
 
       for (sb = 1; sb < 16; ++sb)
       {
@@ -684,8 +1325,9 @@ void  synth_full(struct mad_synth *synth, struct mad_frame const *frame,
 	MLA(hi, lo, (*fe)[0], ptr[ 0]);
 
         raw_sample = SHIFT(MLZ(hi, lo));
-        raw_sample = scale(raw_sample);
-        (*pcm1++) += (short int)raw_sample;
+        raw_sample = mix ? scale_mix(raw_sample) : scale(raw_sample);
+        *pcm1 = (short int)raw_sample;
+        pcm1 += stride;
 
 	ptr = *Dptr - pe;
 	ML0(hi, lo, (*fe)[0], ptr[31 - 16]);
@@ -708,8 +1350,9 @@ void  synth_full(struct mad_synth *synth, struct mad_frame const *frame,
 	MLA(hi, lo, (*fo)[0], ptr[31 - 16]);
 
         raw_sample = SHIFT(MLZ(hi, lo));
-        raw_sample = scale(raw_sample);
-        (*pcm2--) += (short int)raw_sample;
+        raw_sample = mix ? scale_mix(raw_sample) : scale(raw_sample);
+        *pcm2 = (short int)raw_sample;
+        pcm2 -= stride;
 
 	++fo;
       }
@@ -727,14 +1370,11 @@ void  synth_full(struct mad_synth *synth, struct mad_frame const *frame,
       MLA(hi, lo, (*fo)[7], ptr[ 2]);
 
       raw_sample = SHIFT(-MLZ(hi, lo));
-      raw_sample = scale(raw_sample);
-      (*pcm1) += (short int)raw_sample;
+      raw_sample = mix ? scale_mix(raw_sample) : scale(raw_sample);
+      (*pcm1) = (short int)raw_sample;
 
     }  /* Channel For */
 
-    /* Render di un blocco */
-    render_sample_block(short_sample_buff, 32);
-
       phase = (phase + 1) % 16;
 
   } /* Block for */
@@ -743,37 +1383,61 @@ void  synth_full(struct mad_synth *synth, struct mad_frame const *frame,
 
 /*
  * NAME:	synth->half()
- * DESCRIPTION:	perform half frequency PCM synthesis
+ * DESCRIPTION:	perform half frequency PCM synthesis of channels first..nch-1
  */
 static
 void synth_half(struct mad_synth *synth, struct mad_frame const *frame,
-		unsigned int nch, unsigned int ns)
+		unsigned int first, unsigned int nch, unsigned int ns)
 {
   unsigned int phase, ch, s, sb, pe, po;
   short int *pcm1, *pcm2;
-  mad_fixed_t (*filter)[2][2][16][8];
-  mad_fixed_t (*sbsample)[36][32];
-  register mad_fixed_t (*fe)[8], (*fx)[8], (*fo)[8];
-  register mad_fixed_t const (*Dptr)[32], *ptr ;
+  mad_filter_t (*filter)[2][2][16][8];
+  register mad_filter_t (*fe)[8], (*fx)[8], (*fo)[8];
+  register mad_filter_t const (*Dptr)[32], *ptr ;
   register mad_fixed64hi_t hi;
   register mad_fixed64lo_t lo;
   mad_fixed_t raw_sample;
-  short int short_sample_buff[16];
+  unsigned int stride, mix;
+# if defined(DCT_LANES)
+  dct_t block[2][2][16][DCT_COLS];
+# else
+  mad_fixed_t mono[32];
+# endif
 
-  phase = synth->phase;
+  phase  = synth->phase;
+  stride = synth->pcm.channels;
+
+  /* mono output of a stereo frame: mix the subbands, synthesize once */
+  mix = (stride == 1 && nch == 2);
+  if (mix)
+    nch = 1;
 
   for (s = 0; s < ns; ++s)
   {
-    memset (short_sample_buff, 0x00, sizeof(short_sample_buff));
+# if defined(DCT_LANES)
+    if (s % DCT_LANES == 0) {
+      for (ch = first; ch < nch; ++ch)
+	dct32_block(frame, ch, s, ns, mix, block[ch][0], block[ch][1]);
+    }
+# else
+    if (mix) {
+      for (sb = 0; sb < 32; ++sb)
+	mono[sb] = frame->sbsample[0][s][sb] + frame->sbsample[1][s][sb];
+    }
+# endif
 
-    for (ch = 0; ch < nch; ++ch)
+    for (ch = first; ch < nch; ++ch)
     {
-    sbsample = (void *)&frame->sbsample[ch];
     filter   = &synth->filter[ch];
-      pcm1     = short_sample_buff;
+      pcm1     = &synth->pcm.samples[(s * 16) * stride + (stride > 1 ? ch : 0)];
 
-      dct32((*sbsample)[s], phase >> 1,
+# if defined(DCT_LANES)
+      dct32_store((dct_t const (*)[16][DCT_COLS]) block[ch], s % DCT_LANES,
+		  phase, *filter);
+# else
+      dct32(mix ? mono : frame->sbsample[ch][s], phase >> 1,
 	    (*filter)[0][phase & 1], (*filter)[1][phase & 1]);
+# endif
 
       pe = phase & ~1;
       po = ((phase - 1) & 0xf) | 1;
@@ -808,9 +1472,10 @@ void synth_half(struct mad_synth *synth, struct mad_frame const *frame,
       MLA(hi, lo, (*fe)[7], ptr[ 2]);
 
       raw_sample = SHIFT(MLZ(hi, lo));
-      raw_sample = scale(raw_sample);
-      (*pcm1++) += (short int)raw_sample;
-      pcm2 = pcm1 + 14;
+      raw_sample = mix ? scale_mix(raw_sample) : scale(raw_sample);
+      *pcm1 = (short int)raw_sample;
+      pcm1 += stride;
+      pcm2 = pcm1 + 14 * stride;
 
       for (sb = 1; sb < 16; ++sb)
       {
@@ -819,6 +1484,7 @@ void synth_half(struct mad_synth *synth, struct mad_frame const *frame,
 
 	/* D[32 - sb][i] == -D[sb][31 - i] */
 
+	if (!(sb & 1)) {
 	  ptr = *Dptr + po;
 	  ML0(hi, lo, (*fo)[0], ptr[ 0]);
 	  MLA(hi, lo, (*fo)[1], ptr[14]);
@@ -841,8 +1507,9 @@ void synth_half(struct mad_synth *synth, struct mad_frame const *frame,
 	  MLA(hi, lo, (*fe)[0], ptr[ 0]);
 
         raw_sample = SHIFT(MLZ(hi, lo));
-        raw_sample = scale(raw_sample);
-        (*pcm1++) += (short int)raw_sample;
+        raw_sample = mix ? scale_mix(raw_sample) : scale(raw_sample);
+        *pcm1 = (short int)raw_sample;
+        pcm1 += stride;
 
 	  ptr = *Dptr - pe;
         ML0(hi, lo, (*fe)[0], ptr[31 - 16]);
@@ -865,8 +1532,11 @@ void synth_half(struct mad_synth *synth, struct mad_frame const *frame,
         MLA(hi, lo, (*fo)[0], ptr[31 - 16]);
 
         raw_sample = SHIFT(MLZ(hi, lo));
-        raw_sample = scale(raw_sample);
-        (*pcm2--) += (short int)raw_sample;
+        raw_sample = mix ? scale_mix(raw_sample) : scale(raw_sample);
+        *pcm2 = (short int)raw_sample;
+        pcm2 -= stride;
+
+	}
 
 	++fo;
       }
@@ -884,19 +1554,33 @@ void synth_half(struct mad_synth *synth, struct mad_frame const *frame,
       MLA(hi, lo, (*fo)[7], ptr[ 2]);
 
       raw_sample = SHIFT(-MLZ(hi, lo));
-      raw_sample = scale(raw_sample);
-      (*pcm1) += (short int)raw_sample;
+      raw_sample = mix ? scale_mix(raw_sample) : scale(raw_sample);
+      (*pcm1) = (short int)raw_sample;
 
     } /* Channel For */
 
-    /* Block render */
-    render_sample_block(short_sample_buff, 16);
-
       phase = (phase + 1) % 16;
 
   }/* Block For */
 }
 
+/* channel 1 of a stereo frame, for a worker */
+struct synth_job {
+  struct mad_synth *synth;
+  struct mad_frame const *frame;
+  void (*synth_frame)(struct mad_synth *, struct mad_frame const *,
+		      unsigned int, unsigned int, unsigned int);
+  unsigned int ns;
+};
+
+static
+void synth_job(void *arg)
+{
+  struct synth_job const *job = arg;
+
+  job->synth_frame(job->synth, job->frame, 1, 2, job->ns);
+}
+
 /*
  * NAME:	synth->frame()
  * DESCRIPTION:	perform PCM synthesis of frame subband samples
@@ -905,27 +1589,59 @@ void mad_synth_frame(struct mad_synth *synth, struct mad_frame const *frame)
 {
   unsigned int nch, ns;
   void (*synth_frame)(struct mad_synth *, struct mad_frame const *,
-		      unsigned int, unsigned int);
+		      unsigned int, unsigned int, unsigned int);
 
   nch = MAD_NCHANNELS(&frame->header);
   ns  = MAD_NSBSAMPLES(&frame->header);
 
   synth->pcm.samplerate = frame->header.samplerate;
-  set_dac_sample_rate(synth->pcm.samplerate);
-  synth->pcm.channels   = nch;
-//  synth->pcm.length     = 32 * ns;
-  synth->pcm.length     = 128 * ns;
+  synth->pcm.length     = 32 * ns;
+  synth->pcm.layout     = synth->sink ? synth->sink->layout : MAD_PCM_LAYOUT_MONO;
+  synth->pcm.format     = MAD_PCM_FORMAT_S16;
+  synth->pcm.channels   =
+    (synth->pcm.layout == MAD_PCM_LAYOUT_INTERLEAVED) ? nch : 1;
+
+  switch (frame->options & MAD_OPTION_SINGLECHANNEL) {
+  case MAD_OPTION_LEFTCHANNEL:
+  case MAD_OPTION_RIGHTCHANNEL:
+    /* the selected channel was decoded into sbsample[0] */
+    nch = 1;
+    /* fall through */
+
+  case MAD_OPTION_SINGLECHANNEL:
+    synth->pcm.channels = 1;
+    break;
+  }
 
   synth_frame = synth_full;
 
   if (frame->options & MAD_OPTION_HALFSAMPLERATE) {
     synth->pcm.samplerate /= 2;
     synth->pcm.length     /= 2;
-    set_dac_sample_rate(synth->pcm.samplerate);
+
     synth_frame = synth_half;
   }
 
-  synth_frame(synth, frame, nch, ns);
+  /* channels of interleaved output are independent; with a worker,
+     channel 1 is synthesized there while channel 0 is done here */
+
+  if (synth->worker && synth->pcm.channels == 2) {
+    struct synth_job job;
+
+    job.synth       = synth;
+    job.frame       = frame;
+    job.synth_frame = synth_frame;
+    job.ns          = ns;
+
+    synth->worker->start(synth->worker->data, synth_job, &job);
+    synth_frame(synth, frame, 0, 1, ns);
+    synth->worker->wait(synth->worker->data);
+  }
+  else
+    synth_frame(synth, frame, 0, nch, ns);
+
+  if (synth->sink && synth->sink->write)
+    synth->sink->write(synth->sink->data, &synth->pcm);
 
   synth->phase = (synth->phase + ns) % 16;
 }
@@ -0,0 +1,77 @@
+/*
+ * NAME:	bench_bit.c
+ * DESCRIPTION:	host benchmark: bits per second through the bit reader
+ *
+ * Fields of 1 to 12 bits, about the mix of the header, side information
+ * and scalefactors, are read with mad_bit_get() from a 64 KiB buffer of
+ * random bytes; the best of RUNS runs is reported in Mbit/s. A tree from
+ * before the bit reservoir has no mad_bit_get(), so it falls back to
+ * mad_bit_read() there and the same file can time both, e.g.
+ * make bench_bit MAD=...
+ */
+
+# include <stdio.h>
+# include <time.h>
+
+# include "bit.h"
+
+# ifndef MAD_BIT_CACHEBITS
+#  define mad_bit_get  mad_bit_read
+# endif
+
+# define BUFLEN	65536
+# define FIELDS	4096
+# define REPS	50
+# define RUNS	7
+
+static double now(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+int main(void)
+{
+  static unsigned char buf[BUFLEN + 16];
+  static unsigned char lens[FIELDS];
+  struct mad_bitptr ptr;
+  unsigned long seed = 7, sum = 0;
+  long bits, used;
+  double t, best = 0;
+  int i, r, run;
+
+  for (i = 0; i < BUFLEN; ++i) {
+    seed = seed * 1103515245UL + 12345UL;
+    buf[i] = seed >> 16;
+  }
+  for (i = 0; i < FIELDS; ++i) {
+    seed = seed * 1103515245UL + 12345UL;
+    lens[i] = 1 + ((seed >> 16) & 0x7fff) % 12;
+  }
+
+  for (run = 0; run < RUNS; ++run) {
+    bits = 0;
+    t = now();
+    for (r = 0; r < REPS; ++r) {
+      mad_bit_init(&ptr, buf);
+      for (i = 0, used = 0; used < (BUFLEN - 8) * 8L; ++i) {
+	sum  += mad_bit_get(&ptr, lens[i % FIELDS]);
+	used += lens[i % FIELDS];
+      }
+      bits += used;
+    }
+    t = now() - t;
+    if (bits / t > best)
+      best = bits / t;
+  }
+
+# ifdef MAD_BIT_CACHEBITS
+  printf("mad_bit_get, %d-bit reservoir:", (int) MAD_BIT_CACHEBITS);
+# else
+  printf("mad_bit_read, byte cache:");
+# endif
+  printf(" %.0f Mbit/s (checksum %lx)\n", best / 1e6, sum & 0xffff);
+  return 0;
+}
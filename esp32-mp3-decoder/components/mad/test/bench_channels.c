@@ -0,0 +1,205 @@
+/*
+ * NAME:	bench_channels.c
+ * DESCRIPTION:	host benchmark: decode speed with the single channel options
+ *		and the subband cap
+ *
+ * Synthetic stereo streams are decoded and synthesized as a whole, with
+ * interleaved output, mono mix output, MAD_OPTION_LEFTCHANNEL, RIGHTCHANNEL
+ * and SINGLECHANNEL, and interleaved output with MAD_OPTION_SUBBANDS(20)
+ * and (16); the best of RUNS runs is reported in frames per second. Before timing, the output of LEFTCHANNEL and
+ * RIGHTCHANNEL is checked against the same channel of the interleaved
+ * output, frame by frame. The test streams have random main data, so a
+ * Huffman error may drop a frame in one decode and not in the other (with
+ * a single channel selected, the other one isn't decoded at all), and a
+ * frame that fails halfway may already have changed the overlap-add state.
+ * The PCM of a frame depends on that frame and, through the overlap-add and
+ * the filterbank, on the one before it, so only the frames of which both
+ * runs also decoded the frame right before are compared.
+ */
+
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include <time.h>
+
+# include "mad.h"
+# include "decoder.h"
+# include "teststream.h"
+
+# define FRAMES	400
+# define RUNS	5
+
+struct run {
+  int channels;			/* of the PCM the sink got */
+  int frames;
+  long offset[FRAMES];		/* where every decoded frame starts */
+  long end[FRAMES];		/* and ends */
+  short *pcm;			/* 1152 samples per channel per frame */
+};
+
+static void output(void *data, struct mad_pcm const *pcm)
+{
+  struct run *run = data;
+
+  run->channels = pcm->channels;
+  if (run->pcm)
+    memcpy(run->pcm + (long) run->frames * 1152 * 2, pcm->samples,
+	   pcm->length * pcm->channels * sizeof(short));
+}
+
+static double now(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+/* decode the whole stream; returns the time it took */
+static double decode(unsigned char *buf, unsigned long len, int layout,
+		     int options, struct run *run)
+{
+  static struct sync_t sync;
+  struct mad_pcm_sink sink;
+  double t;
+
+  mad_sync_init(&sync);
+  sink.layout = layout;
+  sink.format = MAD_PCM_FORMAT_S16;
+  sink.write  = output;
+  sink.data   = run;
+  mad_synth_sink(&sync.synth, &sink);
+  mad_stream_options(&sync.stream, options);
+  mad_stream_buffer(&sync.stream, buf, len + MAD_BUFFER_GUARD);
+
+  run->frames = 0;
+  t = now();
+  while (1) {
+    if (mad_frame_decode(&sync.frame, &sync.stream) == -1) {
+      if (!MAD_RECOVERABLE(sync.stream.error))
+	break;
+      continue;
+    }
+    mad_synth_frame(&sync.synth, &sync.frame);
+    run->offset[run->frames] = sync.stream.this_frame - buf;
+    run->end[run->frames++]  = sync.stream.next_frame - buf;
+  }
+  t = now() - t;
+
+  mad_sync_finish(&sync);
+  return t;
+}
+
+/* compare channel ch of the interleaved run with the single channel run;
+   returns the amount of frames compared, or -1 - the offset of a frame
+   that differs */
+static long compare(struct run const *il, struct run const *one, int ch)
+{
+  int f, g, i, n = 0;
+
+  for (f = 1, g = 1; f < il->frames && g < one->frames; ) {
+    if (il->offset[f] < one->offset[g])
+      ++f;
+    else if (il->offset[f] > one->offset[g])
+      ++g;
+    else {
+      if (il->end[f - 1] == il->offset[f] &&
+	  one->end[g - 1] == one->offset[g]) {
+	short const *a = il->pcm + (long) f * 1152 * 2;
+	short const *b = one->pcm + (long) g * 1152 * 2;
+
+	for (i = 0; i < 1152; ++i) {
+	  if (a[i * 2 + ch] != b[i])
+	    return -1 - il->offset[f];
+	}
+	++n;
+      }
+      ++f;
+      ++g;
+    }
+  }
+
+  return n;
+}
+
+int main(void)
+{
+  static struct {
+    char const *name;
+    int br_idx, mode;
+  } const streams[] = {
+    { "128k stereo", 9,  TESTSTREAM_STEREO },
+    { "128k joint",  9,  TESTSTREAM_JOINT  },
+    { "320k joint",  14, TESTSTREAM_JOINT  }
+  };
+  static struct {
+    char const *name;
+    int layout, options;
+  } const configs[] = {
+    { "interleaved", MAD_PCM_LAYOUT_INTERLEAVED, 0 },
+    { "mono mix",    MAD_PCM_LAYOUT_MONO,        0 },
+    { "LEFT",        MAD_PCM_LAYOUT_INTERLEAVED, MAD_OPTION_LEFTCHANNEL },
+    { "RIGHT",       MAD_PCM_LAYOUT_INTERLEAVED, MAD_OPTION_RIGHTCHANNEL },
+    { "SINGLE",      MAD_PCM_LAYOUT_INTERLEAVED, MAD_OPTION_SINGLECHANNEL },
+    { "20 sb",       MAD_PCM_LAYOUT_INTERLEAVED, MAD_OPTION_SUBBANDS(20) },
+    { "16 sb",       MAD_PCM_LAYOUT_INTERLEAVED, MAD_OPTION_SUBBANDS(16) }
+  };
+  static struct run il, one, timed;
+  unsigned char *data, *buf;
+  unsigned long len;
+  int s, c, r;
+  long n, compared = 0;
+  double t, best;
+
+  il.pcm  = malloc((long) FRAMES * 1152 * 2 * sizeof(short));
+  one.pcm = malloc((long) FRAMES * 1152 * 2 * sizeof(short));
+
+  printf("%-12s", "frames/s");
+  for (c = 0; c < 7; ++c)
+    printf(" %11s", configs[c].name);
+  printf("\n");
+
+  for (s = 0; s < 3; ++s) {
+    data = teststream_make(s + 1, FRAMES, 0, 0, streams[s].br_idx,
+			   streams[s].mode, &len);
+    buf = calloc(len + MAD_BUFFER_GUARD, 1);
+    memcpy(buf, data, len);
+
+    decode(buf, len, MAD_PCM_LAYOUT_INTERLEAVED, 0, &il);
+    for (c = 0; c < 2; ++c) {
+      decode(buf, len, MAD_PCM_LAYOUT_INTERLEAVED,
+	     c ? MAD_OPTION_RIGHTCHANNEL : MAD_OPTION_LEFTCHANNEL, &one);
+      n = compare(&il, &one, c);
+      if (one.channels != 1 || n < 0) {
+	printf("FAIL: %s: %s channel differs from the interleaved output "
+	       "in the frame at byte %ld\n", streams[s].name,
+	       c ? "right" : "left", -1 - n);
+	return 1;
+      }
+      if (n < FRAMES / 10) {
+	printf("FAIL: %s: only %ld frames to compare\n", streams[s].name, n);
+	return 1;
+      }
+      compared += n;
+    }
+
+    printf("%-12s", streams[s].name);
+    for (c = 0; c < 7; ++c) {
+      best = 1e9;
+      for (r = 0; r < RUNS; ++r) {
+	t = decode(buf, len, configs[c].layout, configs[c].options, &timed);
+	if (t < best)
+	  best = t;
+      }
+      printf(" %11.0f", timed.frames / best);
+    }
+    printf("\n");
+
+    free(buf);
+    free(data);
+  }
+
+  printf("OK: the left and right channel options match the interleaved "
+	 "output (%ld frames compared)\n", compared);
+  return 0;
+}
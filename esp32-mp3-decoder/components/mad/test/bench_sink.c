@@ -0,0 +1,166 @@
+/*
+ * NAME:	bench_sink.c
+ * DESCRIPTION:	host benchmark: cost of handing the synthesized PCM to the
+ *		application
+ *
+ * A synthetic stream is decoded frame by frame, and every decoded frame is
+ * run through mad_synth_frame() REPEAT times; only those calls are timed.
+ * The output stage copies the mono PCM into a ring buffer, the way the
+ * player hands it to the I2S code. Built normally it gets the PCM through a
+ * struct mad_pcm_sink, once per frame. Built with -DBENCH_OLD_API it
+ * provides the global render_sample_block() hook of the original libmad
+ * port instead, which gets 32 (or 16) samples per call; that only builds
+ * against a tree from before the sink was added:
+ *
+ *   make bench_sink
+ *   make bench_sink_old MAD=/path/to/old/components/mad
+ */
+
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include <time.h>
+
+# include "mad.h"
+# include "teststream.h"
+
+# define FRAMES	400
+# define REPEAT	50
+# define RINGLEN	4096
+
+static short ring[RINGLEN];
+static unsigned int ringpos;
+static unsigned long calls;
+
+static void output(short const *samples, unsigned int n)
+{
+  unsigned int len;
+
+  ++calls;
+  while (n) {
+    len = RINGLEN - ringpos;
+    if (len > n)
+      len = n;
+    memcpy(&ring[ringpos], samples, len * sizeof(short));
+    ringpos = (ringpos + len) % RINGLEN;
+    samples += len;
+    n -= len;
+  }
+}
+
+# ifdef BENCH_OLD_API
+void render_sample_block(short *short_sample_buff, int no_samples)
+{
+  output(short_sample_buff, no_samples);
+}
+
+void set_dac_sample_rate(int rate)
+{
+  (void) rate;
+}
+# else
+static void sink_write(void *data, struct mad_pcm const *pcm)
+{
+  (void) data;
+  output(pcm->samples, pcm->length);
+}
+# endif
+
+static double now(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+/* returns the ns per mad_synth_frame() call */
+static double run(char const *name, int lsf, int sr_idx, int br_idx,
+		  int mode)
+{
+  unsigned char *data, *buf;
+  unsigned long len;
+  struct mad_stream *stream;
+  struct mad_frame *frame;
+  struct mad_synth *synth;
+  double t, total = 0;
+  unsigned long synths = 0, ncalls = 0;
+  int frames = 0, i;
+# ifdef BENCH_OLD_API
+  static struct mad_stream s_stream;
+  static struct mad_frame s_frame;
+  static struct mad_synth s_synth;
+# else
+  static struct sync_t sync;
+  static struct mad_pcm_sink sink;
+# endif
+
+  data = teststream_make(1, FRAMES, lsf, sr_idx, br_idx, mode, &len);
+  buf = calloc(len + MAD_BUFFER_GUARD, 1);
+  memcpy(buf, data, len);
+
+# ifdef BENCH_OLD_API
+  stream = &s_stream;
+  frame  = &s_frame;
+  synth  = &s_synth;
+  mad_stream_init(stream);
+  mad_frame_init(frame);
+  mad_synth_init(synth);
+# else
+  stream = &sync.stream;
+  frame  = &sync.frame;
+  synth  = &sync.synth;
+  mad_sync_init(&sync);
+
+  sink.layout = MAD_PCM_LAYOUT_MONO;
+  sink.format = MAD_PCM_FORMAT_S16;
+  sink.write  = sink_write;
+  sink.data   = 0;
+  mad_synth_sink(synth, &sink);
+# endif
+  mad_stream_buffer(stream, buf, len + MAD_BUFFER_GUARD);
+
+  while (1) {
+    if (mad_frame_decode(frame, stream) == -1) {
+      if (!MAD_RECOVERABLE(stream->error))
+	break;
+      continue;
+    }
+    ++frames;
+
+    calls = 0;
+    t = now();
+    for (i = 0; i < REPEAT; ++i)
+      mad_synth_frame(synth, frame);
+    total += now() - t;
+    synths += REPEAT;
+    ncalls += calls;
+  }
+
+  printf("%-20s %4d frames, %5.1f output calls/frame, %7.0f ns/frame\n",
+	 name, frames, (double) ncalls / synths, total * 1e9 / synths);
+
+  free(buf);
+  free(data);
+  return total * 1e9 / synths;
+}
+
+int main(void)
+{
+  unsigned int sum = 0, i;
+
+# ifdef BENCH_OLD_API
+  printf("render_sample_block() per 32/16 samples:\n");
+# else
+  printf("struct mad_pcm_sink per frame:\n");
+# endif
+  run("MPEG1 44.1k joint", 0, 0, 9, TESTSTREAM_JOINT);
+  run("MPEG2 22.05k mono", 1, 0, 8, TESTSTREAM_MONO);
+
+  /* keep the copies from being optimized away */
+  for (i = 0; i < RINGLEN; ++i)
+    sum += ring[i];
+  printf("(checksum %08x)\n", sum);
+
+  return 0;
+}
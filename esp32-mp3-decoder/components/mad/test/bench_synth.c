@@ -0,0 +1,130 @@
+/*
+ * NAME:	bench_synth.c
+ * DESCRIPTION:	host benchmark: subband synthesis per channel-frame
+ *
+ * The frames of a few test streams are decoded once and kept; then only
+ * mad_synth_frame() (the DCT and the window) is timed on them, with
+ * interleaved output, and the best of RUNS runs is reported in ns per
+ * channel and frame. Build it as is and with -DOPT_DCT_SCALAR
+ * -DOPT_SYNTH_SCALAR (make bench_synth bench_synth_scalar) to compare the
+ * vector paths with the scalar code; the checksums have to be the same.
+ */
+
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include <time.h>
+
+# include "mad.h"
+# include "decoder.h"
+# include "teststream.h"
+
+# define FRAMES	400
+# define REPEAT	5
+# define RUNS	7
+
+static unsigned long long hash;
+
+static void output(void *data, struct mad_pcm const *pcm)
+{
+  unsigned int i, n = pcm->length * pcm->channels;
+
+  (void) data;
+  for (i = 0; i < n; ++i) {
+    hash ^= (unsigned short) pcm->samples[i];
+    hash *= 1099511628211ULL;
+  }
+}
+
+static void discard(void *data, struct mad_pcm const *pcm)
+{
+  (void) data;
+  (void) pcm;
+}
+
+static double now(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+static void run(char const *name, int lsf, int sr_idx, int br_idx, int mode)
+{
+  static struct sync_t sync;
+  static struct mad_synth synth;
+  struct mad_frame *frames;
+  struct mad_pcm_sink sink;
+  unsigned char *data, *buf;
+  unsigned long len, chframes;
+  double t, best = 1e9;
+  int n = 0, i, r, k;
+
+  data = teststream_make(1, FRAMES, lsf, sr_idx, br_idx, mode, &len);
+  buf = calloc(len + MAD_BUFFER_GUARD, 1);
+  memcpy(buf, data, len);
+  frames = malloc(FRAMES * sizeof(*frames));
+
+  mad_sync_init(&sync);
+  mad_stream_buffer(&sync.stream, buf, len + MAD_BUFFER_GUARD);
+  while (n < FRAMES) {
+    if (mad_frame_decode(&sync.frame, &sync.stream) == -1) {
+      if (!MAD_RECOVERABLE(sync.stream.error))
+	break;
+      continue;
+    }
+    frames[n] = sync.frame;
+    frames[n++].overlap = 0;
+  }
+  mad_sync_finish(&sync);
+
+  /* one pass into the checksum, then the timed ones */
+  mad_synth_init(&synth);
+  sink.layout = MAD_PCM_LAYOUT_INTERLEAVED;
+  sink.format = MAD_PCM_FORMAT_S16;
+  sink.write  = output;
+  sink.data   = 0;
+  mad_synth_sink(&synth, &sink);
+  hash = 14695981039346656037ULL;
+  for (i = 0; i < n; ++i)
+    mad_synth_frame(&synth, &frames[i]);
+
+  sink.write = discard;
+  mad_synth_sink(&synth, &sink);
+  for (k = 0; k < RUNS; ++k) {
+    chframes = 0;
+    t = now();
+    for (r = 0; r < REPEAT; ++r) {
+      for (i = 0; i < n; ++i) {
+	mad_synth_frame(&synth, &frames[i]);
+	chframes += MAD_NCHANNELS(&frames[i].header);
+      }
+    }
+    t = now() - t;
+    if (t * 1e9 / chframes < best)
+      best = t * 1e9 / chframes;
+  }
+
+  printf("%-18s %4d frames %6.0f ns/channel-frame (checksum %016llx)\n",
+	 name, n, best, hash);
+
+  mad_synth_finish(&synth);
+  free(frames);
+  free(buf);
+  free(data);
+}
+
+int main(void)
+{
+# if defined(OPT_DCT_SCALAR) && defined(OPT_SYNTH_SCALAR)
+  printf("scalar DCT and window:\n");
+# else
+  printf("default build:\n");
+# endif
+  run("MPEG1 128k stereo", 0, 0, 9,  TESTSTREAM_STEREO);
+  run("MPEG1 320k joint",  0, 0, 14, TESTSTREAM_JOINT);
+  run("MPEG2 64k stereo",  1, 0, 8,  TESTSTREAM_STEREO);
+
+  return 0;
+}
@@ -0,0 +1,445 @@
+/*
+ * NAME:	gen_huffman.c
+ * DESCRIPTION:	generate huffman.c from the original libmad tables
+ *
+ * Reads every code word out of the ISO-derived tables in huffman_iso.c and
+ * builds the flattened tables of ../huffman.c from them: the first level of
+ * a pair table is indexed directly by up to PAIR_STARTBITS code bits (or the
+ * longest code length, if that's shorter), longer code words continue
+ * through second-level tables of at most PAIR_SUBBITS bits, and the
+ * quadruple tables are single 6-bit lookups. The whole source file goes to
+ * stdout:
+ *
+ *   make gen_huffman && ./gen_huffman > ../huffman.c
+ *
+ * "make test" checks that the output is identical to the committed file.
+ */
+
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+
+# include "huffman_iso.h"
+
+# define PAIR_STARTBITS	10
+# define PAIR_SUBBITS	6
+# define QUAD_BITS	6
+
+# define MAXCODES	1024
+# define MAXENTRIES	2048
+# define MAXLEVELS	512
+
+struct code {
+  unsigned long bits;		/* the code word, right-aligned */
+  int len;
+  int val[4];			/* x, y or v, w, x, y */
+};
+
+struct entry {
+  int final;
+  int val[4];
+  int hlen;			/* code length after the start of the level */
+  int offset, bits;		/* next level, if not final */
+};
+
+struct level {
+  int pos;
+  unsigned long prefix;
+  int plen;
+  int bits;
+};
+
+static struct code codes[MAXCODES];
+static int ncodes, nvals;
+
+static struct entry ent[MAXENTRIES];
+static int nent;
+
+static struct level lev[MAXLEVELS];
+static int nlev;
+
+static void add_code(unsigned long bits, int len, int const *val)
+{
+  int i;
+
+  for (i = 0; i < ncodes; ++i) {
+    if (codes[i].bits == bits && codes[i].len == len) {
+      if (memcmp(codes[i].val, val, nvals * sizeof(int)) != 0) {
+	fprintf(stderr, "code word maps to two values\n");
+	exit(1);
+      }
+      return;
+    }
+  }
+
+  if (ncodes == MAXCODES) {
+    fprintf(stderr, "too many code words\n");
+    exit(1);
+  }
+  codes[ncodes].bits = bits;
+  codes[ncodes].len  = len;
+  memcpy(codes[ncodes].val, val, nvals * sizeof(int));
+  ++ncodes;
+}
+
+/*
+ * NAME:	walk_pair()
+ * DESCRIPTION:	collect the code words of an original pair table
+ */
+static void walk_pair(union iso_huffpair const *table, int offset, int clump,
+		      unsigned long prefix, int plen)
+{
+  int i, val[4];
+
+  for (i = 0; i < (1 << clump); ++i) {
+    union iso_huffpair const *e = &table[offset + i];
+    unsigned long bits = (prefix << clump) | i;
+
+    if (!e->final)
+      walk_pair(table, e->ptr.offset, e->ptr.bits, bits, plen + clump);
+    else {
+      val[0] = e->value.x;
+      val[1] = e->value.y;
+      add_code(bits >> (clump - e->value.hlen), plen + e->value.hlen, val);
+    }
+  }
+}
+
+/*
+ * NAME:	walk_quad()
+ * DESCRIPTION:	collect the code words of an original quadruple table
+ */
+static void walk_quad(union iso_huffquad const *table, int offset, int clump,
+		      unsigned long prefix, int plen)
+{
+  int i, val[4];
+
+  for (i = 0; i < (1 << clump); ++i) {
+    union iso_huffquad const *e = &table[offset + i];
+    unsigned long bits = (prefix << clump) | i;
+
+    if (!e->final)
+      walk_quad(table, e->ptr.offset, e->ptr.bits, bits, plen + clump);
+    else {
+      val[0] = e->value.v;
+      val[1] = e->value.w;
+      val[2] = e->value.x;
+      val[3] = e->value.y;
+      add_code(bits >> (clump - e->value.hlen), plen + e->value.hlen, val);
+    }
+  }
+}
+
+static int max_len(void)
+{
+  int i, m = 0;
+
+  for (i = 0; i < ncodes; ++i) {
+    if (codes[i].len > m)
+      m = codes[i].len;
+  }
+
+  return m;
+}
+
+/*
+ * NAME:	build_level()
+ * DESCRIPTION:	lay out one level of a flattened table, and (depth first)
+ *		the levels below it
+ */
+static void build_level(unsigned long prefix, int plen, int bits, int subbits)
+{
+  int base, i, k, n, *pend;
+
+  base = nent;
+  nent += 1 << bits;
+  if (nent > MAXENTRIES || nlev == MAXLEVELS) {
+    fprintf(stderr, "table too big\n");
+    exit(1);
+  }
+  lev[nlev].pos    = base;
+  lev[nlev].prefix = prefix;
+  lev[nlev].plen   = plen;
+  lev[nlev].bits   = bits;
+  ++nlev;
+
+  pend = calloc(1 << bits, sizeof(int));
+
+  for (i = 0; i < (1 << bits); ++i) {
+    unsigned long s = (prefix << bits) | i;
+    int slen = plen + bits;
+    struct entry *e = &ent[base + i];
+
+    /* a code word that is a prefix of these bits */
+    for (k = 0; k < ncodes; ++k) {
+      if (codes[k].len <= slen && (s >> (slen - codes[k].len)) == codes[k].bits)
+	break;
+    }
+    if (k < ncodes) {
+      e->final = 1;
+      memcpy(e->val, codes[k].val, sizeof(e->val));
+      e->hlen  = codes[k].len - plen;
+      continue;
+    }
+
+    /* otherwise a level below, as deep as the longest code word needs */
+    n = 0;
+    for (k = 0; k < ncodes; ++k) {
+      if (codes[k].len > slen &&
+	  (codes[k].bits >> (codes[k].len - slen)) == s &&
+	  codes[k].len - slen > n)
+	n = codes[k].len - slen;
+    }
+    if (n == 0) {
+      fprintf(stderr, "incomplete code\n");
+      exit(1);
+    }
+    pend[i] = n < subbits ? n : subbits;
+  }
+
+  for (i = 0; i < (1 << bits); ++i) {
+    if (pend[i]) {
+      ent[base + i].final  = 0;
+      ent[base + i].offset = nent;
+      ent[base + i].bits   = pend[i];
+      build_level((prefix << bits) | i, plen + bits, pend[i], subbits);
+    }
+  }
+
+  free(pend);
+}
+
+static char const *binary(unsigned long v, int len, int width)
+{
+  static char buf[64];
+  int i;
+
+  for (i = 0; i < len; ++i)
+    buf[i] = (v >> (len - 1 - i)) & 1 ? '1' : '0';
+  for (; i < width; ++i)
+    buf[i] = ' ';
+  buf[i] = 0;
+
+  return buf;
+}
+
+/* the prefix of a level, in groups of four bits */
+static char const *grouped(unsigned long v, int len)
+{
+  static char buf[64];
+  int i, n = 0;
+
+  for (i = 0; i < len; ++i) {
+    if (i && i % 4 == 0)
+      buf[n++] = ' ';
+    buf[n++] = (v >> (len - 1 - i)) & 1 ? '1' : '0';
+  }
+  buf[n] = 0;
+
+  return buf;
+}
+
+static void emit_quad(char const *name, union iso_huffquad const *table)
+{
+  int i, bits, pad;
+
+  ncodes = 0;
+  nvals  = 4;
+  nent   = 0;
+  nlev   = 0;
+  walk_quad(table, 0, 4, 0, 0);
+
+  bits = max_len() < QUAD_BITS ? max_len() : QUAD_BITS;
+  build_level(0, 0, bits, QUAD_BITS);
+  if (nlev != 1) {
+    fprintf(stderr, "%s needs more than one level\n", name);
+    exit(1);
+  }
+  pad = QUAD_BITS - bits;
+
+  printf("static\n");
+  printf("union huffquad const %s[] = {\n", name);
+  for (i = 0; i < (1 << QUAD_BITS); ++i) {
+    struct entry const *e = &ent[i >> pad];
+
+    printf("  /* %s */ V(%d, %d, %d, %d, %d)%s\n", binary(i, QUAD_BITS, 0),
+	   e->val[0], e->val[1], e->val[2], e->val[3], e->hlen,
+	   i == (1 << QUAD_BITS) - 1 ? "" : ",");
+  }
+  printf("};\n\n");
+}
+
+/* returns the startbits of the table */
+static int emit_pair(int index, union iso_huffpair const *table,
+		     unsigned int startbits)
+{
+  int bits, l, i;
+
+  ncodes = 0;
+  nvals  = 2;
+  nent   = 0;
+  nlev   = 0;
+  walk_pair(table, 0, startbits, 0, 0);
+
+  bits = max_len() < PAIR_STARTBITS ? max_len() : PAIR_STARTBITS;
+  build_level(0, 0, bits, PAIR_SUBBITS);
+
+  printf("static\n");
+  printf("union huffpair const hufftab%d[] = {\n", index);
+  for (l = 0; l < nlev; ++l) {
+    int pos = lev[l].pos, w = lev[l].bits > 4 ? lev[l].bits : 4;
+
+    if (pos)
+      printf("\n  /* %s ... */\n", grouped(lev[l].prefix, lev[l].plen));
+
+    for (i = 0; i < (1 << lev[l].bits); ++i) {
+      struct entry const *e = &ent[pos + i];
+
+      printf("  /* %s */ ", binary(i, lev[l].bits, w));
+      if (e->final)
+	printf("V(%d, %d, %d)", e->val[0], e->val[1], e->hlen);
+      else
+	printf("PTR(%d, %d)", e->offset, e->bits);
+      if (pos + i != nent - 1)
+	printf(",");
+      if (i == 0 && pos)
+	printf("\t/* %d */", pos);
+      printf("\n");
+    }
+  }
+  printf("};\n\n");
+
+  return bits;
+}
+
+int main(void)
+{
+  int startbits[32], n, i;
+
+  printf(
+"/*\n"
+" * libmad - MPEG audio decoder library\n"
+" * Copyright (C) 2000-2004 Underbit Technologies, Inc.\n"
+" *\n"
+" * This program is free software; you can redistribute it and/or modify\n"
+" * it under the terms of the GNU General Public License as published by\n"
+" * the Free Software Foundation; either version 2 of the License, or\n"
+" * (at your option) any later version.\n"
+" *\n"
+" * This program is distributed in the hope that it will be useful,\n"
+" * but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+" * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n"
+" * GNU General Public License for more details.\n"
+" *\n"
+" * You should have received a copy of the GNU General Public License\n"
+" * along with this program; if not, write to the Free Software\n"
+" * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA\n"
+" *\n"
+" * $Id: huffman.c,v 1.10 2004/01/23 09:41:32 rob Exp $\n"
+" */\n"
+"\n"
+"# ifdef HAVE_CONFIG_H\n"
+"#  include \"config.h\"\n"
+"# endif\n"
+"\n"
+"# include \"global.h\"\n"
+"\n"
+"# include \"huffman.h\"\n"
+"\n"
+"/*\n"
+" * These are the Huffman code words for Layer III.\n"
+" * The data for these tables are derived from Table B.7 of ISO/IEC 11172-3.\n"
+" *\n"
+" * The tables are flattened for lookup speed: the first level of each pair\n"
+" * table is indexed directly by up to 10 code bits (the startbits of\n"
+" * mad_huff_pair_table[]), which resolves all code words of 10 bits or less\n"
+" * in a single lookup. Longer code words continue through second-level\n"
+" * tables of at most 6 bits. The quadruple tables resolve any code word in\n"
+" * one 6-bit lookup.\n"
+" *\n"
+" * This file is generated from the original tables by test/gen_huffman.c;\n"
+" * regenerate it rather than editing it by hand.\n"
+" */\n"
+"\n"
+"# if defined(__GNUC__) ||  \\\n"
+"    (defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901)\n"
+"#  define V(v, w, x, y, hlen)\t{ .value = { 1, hlen, v, w, x, y } }\n"
+"# else\n"
+"#  if defined(WORDS_BIGENDIAN)\n"
+"#   define V(v, w, x, y, hlen)\t{ { 1, hlen, (v << 11) | (w << 10) |  \\\n"
+"                                             (x <<  9) | (y <<  8) } }\n"
+"#  else\n"
+"#   define V(v, w, x, y, hlen)\t{ { 1, hlen, (v <<  0) | (w <<  1) |  \\\n"
+"                                             (x <<  2) | (y <<  3) } }\n"
+"#  endif\n"
+"# endif\n"
+"\n");
+
+  emit_quad("hufftabA", iso_huff_quad_table[0]);
+  emit_quad("hufftabB", iso_huff_quad_table[1]);
+
+  printf(
+"# undef V\n"
+"\n"
+"# if defined(__GNUC__) ||  \\\n"
+"    (defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901)\n"
+"#  define PTR(offs, bits)\t{ .ptr   = { 0, bits, offs } }\n"
+"#  define V(x, y, hlen)\t\t{ .value = { 1, hlen, x, y } }\n"
+"# else\n"
+"#  define PTR(offs, bits)\t{ { 0, bits, offs } }\n"
+"#  if defined(WORDS_BIGENDIAN)\n"
+"#   define V(x, y, hlen)\t{ { 1, hlen, (x << 7) | (y << 3) } }\n"
+"#  else\n"
+"#   define V(x, y, hlen)\t{ { 1, hlen, (x << 0) | (y << 4) } }\n"
+"#  endif\n"
+"# endif\n"
+"\n");
+
+  /* tables 16-23 and 24-31 share a table and differ only in linbits */
+  for (n = 0; n < 32; ++n) {
+    struct iso_hufftable const *t = &iso_huff_pair_table[n];
+
+    startbits[n] = 0;
+    if (t->table == 0)
+      continue;
+    for (i = 0; i < n; ++i) {
+      if (iso_huff_pair_table[i].table == t->table)
+	break;
+    }
+    if (i < n)
+      startbits[n] = startbits[i];
+    else
+      startbits[n] = emit_pair(n, t->table, t->startbits);
+  }
+
+  printf(
+"# undef V\n"
+"# undef PTR\n"
+"\n"
+"/* external tables */\n"
+"\n"
+"union huffquad const *const mad_huff_quad_table[2] = { hufftabA, hufftabB };\n"
+"\n"
+"struct hufftable const mad_huff_pair_table[32] = {\n");
+
+  for (n = 0; n < 32; ++n) {
+    struct iso_hufftable const *t = &iso_huff_pair_table[n];
+    char name[16];
+
+    if (t->table == 0)
+      printf("  /* %2d */ { 0 /* not used */ }", n);
+    else {
+      for (i = 0; i < n; ++i) {
+	if (iso_huff_pair_table[i].table == t->table)
+	  break;
+      }
+      sprintf(name, "hufftab%d,", i);
+      printf("  /* %2d */ { %-11s%2u, %2d }", n, name, t->linbits,
+	     startbits[n]);
+    }
+    printf("%s\n", n == 31 ? "" : ",");
+  }
+  printf("};\n");
+
+  return 0;
+}
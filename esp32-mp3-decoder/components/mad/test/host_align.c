@@ -0,0 +1,17 @@
+/*
+ * NAME:	host_align.c
+ * DESCRIPTION:	plain versions of the align.c helpers, for host builds
+ *
+ * align.c reads through aligned 32-bit words because the ESP32 can't do
+ * unaligned loads from flash; a host can, and pointers don't fit in an int.
+ */
+
+char unalChar(const unsigned char *adr)
+{
+  return *adr;
+}
+
+short unalShort(const unsigned short *adr)
+{
+  return *adr;
+}
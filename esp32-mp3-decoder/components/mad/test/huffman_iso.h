@@ -0,0 +1,53 @@
+/*
+ * NAME:	huffman_iso.h
+ * DESCRIPTION:	table formats of the original libmad Huffman tables
+ *
+ * See huffman_iso.c. These are the unions huffman.h used before the tables
+ * were flattened: 3-bit clump sizes and code lengths.
+ */
+
+# ifndef HUFFMAN_ISO_H
+# define HUFFMAN_ISO_H
+
+union iso_huffquad {
+  struct {
+    unsigned int final  :  1;
+    unsigned int bits   :  3;
+    unsigned int offset : 12;
+  } ptr;
+  struct {
+    unsigned int final  :  1;
+    unsigned int hlen   :  3;
+    unsigned int v      :  1;
+    unsigned int w      :  1;
+    unsigned int x      :  1;
+    unsigned int y      :  1;
+  } value;
+  unsigned int final    :  1;
+};
+
+union iso_huffpair {
+  struct {
+    unsigned int final  :  1;
+    unsigned int bits   :  3;
+    unsigned int offset : 12;
+  } ptr;
+  struct {
+    unsigned int final  :  1;
+    unsigned int hlen   :  3;
+    unsigned int x      :  4;
+    unsigned int y      :  4;
+  } value;
+  unsigned int final    :  1;
+};
+
+struct iso_hufftable {
+  union iso_huffpair const *table;
+  unsigned int linbits;
+  unsigned int startbits;
+};
+
+extern union iso_huffquad const *const iso_huff_quad_table[2];
+extern struct iso_hufftable const iso_huff_pair_table[32];
+
+# endif
@@ -0,0 +1,136 @@
+/*
+ * NAME:	pcmdump.c
+ * DESCRIPTION:	host tool: hash the PCM of the test streams
+ *
+ * Every test stream is decoded with a few output layouts and options, and
+ * one line with the frame and sample counts and a 64-bit FNV-1a hash of the
+ * PCM is printed for each. The vector DCT, IMDCT and synthesis window paths
+ * are meant to be bit-identical to the scalar code with OPT_SSO, so the
+ * output of a default build has to be exactly the same as that of one with
+ * -DOPT_DCT_SCALAR -DOPT_SYNTH_SCALAR; "make test" checks that.
+ *
+ * Given a file name, it also writes all the PCM there, as raw native-endian
+ * 16-bit samples, for pcmsnr to compare builds that aren't bit-identical
+ * (e.g. OPT_SYNTH16 against FPM_64BIT). With -q the streams are made
+ * quieter, so that nothing clips and nothing overflows (see teststream.h).
+ */
+
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+
+# include "mad.h"
+# include "decoder.h"
+# include "teststream.h"
+
+struct dump {
+  FILE *out;
+  unsigned long long hash;
+  unsigned long samples;
+  int frames;
+};
+
+static void output(void *data, struct mad_pcm const *pcm)
+{
+  struct dump *dump = data;
+  unsigned int i, n = pcm->length * pcm->channels;
+
+  for (i = 0; i < n; ++i) {
+    dump->hash ^= (unsigned short) pcm->samples[i];
+    dump->hash *= 1099511628211ULL;
+  }
+  dump->samples += n;
+  if (dump->out)
+    fwrite(pcm->samples, sizeof(short), n, dump->out);
+}
+
+static void decode(unsigned char *buf, unsigned long len, int layout,
+		   int options, struct dump *dump)
+{
+  static struct sync_t sync;
+  struct mad_pcm_sink sink;
+
+  mad_sync_init(&sync);
+  sink.layout = layout;
+  sink.format = MAD_PCM_FORMAT_S16;
+  sink.write  = output;
+  sink.data   = dump;
+  mad_synth_sink(&sync.synth, &sink);
+  mad_stream_options(&sync.stream, options);
+  mad_stream_buffer(&sync.stream, buf, len + MAD_BUFFER_GUARD);
+
+  dump->hash    = 14695981039346656037ULL;
+  dump->samples = 0;
+  dump->frames  = 0;
+  while (1) {
+    if (mad_frame_decode(&sync.frame, &sync.stream) == -1) {
+      if (!MAD_RECOVERABLE(sync.stream.error))
+	break;
+      continue;
+    }
+    mad_synth_frame(&sync.synth, &sync.frame);
+    dump->frames++;
+  }
+
+  mad_sync_finish(&sync);
+}
+
+int main(int argc, char *argv[])
+{
+  static struct {
+    char const *name;
+    int nframes, lsf, sr_idx, br_idx, mode;
+  } const streams[] = {
+    { "MPEG1 128k stereo", 400, 0, 0, 9,  TESTSTREAM_STEREO },
+    { "MPEG1 320k joint",  400, 0, 0, 14, TESTSTREAM_JOINT  },
+    { "MPEG2 64k stereo",  600, 1, 0, 8,  TESTSTREAM_STEREO },
+    { "MPEG2 64k mono",    600, 1, 1, 8,  TESTSTREAM_MONO   }
+  };
+  static struct {
+    char const *name;
+    int layout, options;
+  } const configs[] = {
+    { "interleaved", MAD_PCM_LAYOUT_INTERLEAVED, 0 },
+    { "mono mix",    MAD_PCM_LAYOUT_MONO,        0 },
+    { "half rate",   MAD_PCM_LAYOUT_INTERLEAVED, MAD_OPTION_HALFSAMPLERATE },
+    { "left",        MAD_PCM_LAYOUT_INTERLEAVED, MAD_OPTION_LEFTCHANNEL }
+  };
+  struct dump dump;
+  unsigned char *data, *buf;
+  unsigned long len;
+  int s, c;
+
+  if (argc > 1 && strcmp(argv[1], "-q") == 0) {
+    teststream_gain(100, 130);
+    --argc;
+    ++argv;
+  }
+
+  dump.out = 0;
+  if (argc > 1 && (dump.out = fopen(argv[1], "wb")) == 0) {
+    perror(argv[1]);
+    return 1;
+  }
+
+  for (s = 0; s < 4; ++s) {
+    data = teststream_make(s + 1, streams[s].nframes, streams[s].lsf,
+			   streams[s].sr_idx, streams[s].br_idx,
+			   streams[s].mode, &len);
+    buf = calloc(len + MAD_BUFFER_GUARD, 1);
+    memcpy(buf, data, len);
+
+    for (c = 0; c < 4; ++c) {
+      decode(buf, len, configs[c].layout, configs[c].options, &dump);
+      printf("%-18s %-12s %4d frames %8lu samples %016llx\n",
+	     streams[s].name, configs[c].name, dump.frames, dump.samples,
+	     dump.hash);
+    }
+
+    free(buf);
+    free(data);
+  }
+
+  if (dump.out)
+    fclose(dump.out);
+  return 0;
+}
@@ -0,0 +1,76 @@
+/*
+ * NAME:	pcmsnr.c
+ * DESCRIPTION:	host tool: signal to noise ratio of one PCM dump against
+ *		another
+ *
+ * Reads two files of raw native-endian 16-bit samples, as written by
+ * pcmdump, and prints the SNR of the second against the first, with the
+ * rms and largest difference in LSB. The test streams are loud enough that
+ * some samples clip; where either side is at full scale the difference
+ * says nothing about precision, so those samples are left out. With a
+ * third argument, exits with an error if the SNR is below that many dB.
+ */
+
+# include <stdio.h>
+# include <stdlib.h>
+# include <math.h>
+
+static int clipped(int x)
+{
+  return x >= 32767 || x <= -32768;
+}
+
+int main(int argc, char *argv[])
+{
+  FILE *ref, *test;
+  short a, b;
+  double signal = 0, noise = 0, snr;
+  unsigned long n = 0, clip = 0;
+  int diff, maxdiff = 0;
+
+  if (argc < 3) {
+    fprintf(stderr, "usage: %s reference.pcm test.pcm [min-dB]\n", argv[0]);
+    return 2;
+  }
+  if ((ref = fopen(argv[1], "rb")) == 0) {
+    perror(argv[1]);
+    return 2;
+  }
+  if ((test = fopen(argv[2], "rb")) == 0) {
+    perror(argv[2]);
+    return 2;
+  }
+
+  while (fread(&a, sizeof(a), 1, ref) == 1) {
+    if (fread(&b, sizeof(b), 1, test) != 1) {
+      printf("FAIL: %s is shorter than %s\n", argv[2], argv[1]);
+      return 1;
+    }
+    if (clipped(a) || clipped(b)) {
+      ++clip;
+      continue;
+    }
+    diff = b - a;
+    if (abs(diff) > maxdiff)
+      maxdiff = abs(diff);
+    signal += (double) a * a;
+    noise  += (double) diff * diff;
+    ++n;
+  }
+  if (fread(&b, sizeof(b), 1, test) == 1) {
+    printf("FAIL: %s is longer than %s\n", argv[2], argv[1]);
+    return 1;
+  }
+
+  snr = noise ? 10 * log10(signal / noise) : 999;
+  printf("%s vs %s: %.1f dB SNR, %.2f LSB rms, %d LSB max "
+	 "(%lu samples, %lu clipped left out)\n", argv[2], argv[1], snr,
+	 n ? sqrt(noise / n) : 0, maxdiff, n, clip);
+
+  if (argc > 3 && snr < atof(argv[3])) {
+    printf("FAIL: less than %s dB\n", argv[3]);
+    return 1;
+  }
+
+  return 0;
+}
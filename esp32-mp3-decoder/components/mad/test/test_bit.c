@@ -0,0 +1,172 @@
+/*
+ * NAME:	test_bit.c
+ * DESCRIPTION:	host test: the bit reader against a bit-by-bit model
+ *
+ * Random sequences of mad_bit_read() (0 to 32 bits), mad_bit_get() (up to
+ * 24 bits), mad_bit_skip(), mad_bit_length(), mad_bit_nextbyte(),
+ * mad_bit_bitsleft() and mad_bit_crc() are run on a bit pointer over one
+ * piece of memory or, through mad_bit_split(), two; every result has to
+ * match a model that just counts bits through the two pieces. The first
+ * of two pieces is allocated to its exact size, so a build with
+ * -fsanitize=address also catches the reservoir loading past the end of
+ * it; past the end of the stream, like in a decoder buffer, there are
+ * MAD_BUFFER_GUARD bytes.
+ */
+
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+
+# include "bit.h"
+# include "stream.h"
+
+# define TRACES	20000
+# define OPS	60
+# define SEGLEN	80
+
+static unsigned long rng = 1;
+
+static unsigned int rnd(unsigned int n)
+{
+  rng = rng * 1103515245UL + 12345UL;
+  return ((rng >> 8) & 0xffffff) % n;
+}
+
+/* the model: a bit position in the concatenation of the two segments */
+struct model {
+  unsigned char const *seg[2];
+  unsigned long len[2];		/* in bytes */
+  unsigned long pos;		/* in bits */
+};
+
+static unsigned char const *model_byte(struct model const *m,
+				       unsigned long n)
+{
+  return n < m->len[0] ? m->seg[0] + n : m->seg[1] + (n - m->len[0]);
+}
+
+static unsigned long model_read(struct model *m, unsigned int len)
+{
+  unsigned long value = 0;
+
+  while (len--) {
+    value = (value << 1) |
+      (*model_byte(m, m->pos / 8) >> (7 - m->pos % 8) & 1);
+    m->pos++;
+  }
+
+  return value;
+}
+
+static unsigned short model_crc(struct model m, unsigned int len,
+				unsigned short init)
+{
+  unsigned int crc = init;
+
+  while (len--) {
+    if ((model_read(&m, 1) ^ (crc >> 15)) & 1)
+      crc = (crc << 1) ^ 0x8005;
+    else
+      crc <<= 1;
+  }
+
+  return crc & 0xffff;
+}
+
+static int trace(int n, int split)
+{
+  struct mad_bitptr ptr, start;
+  struct model m;
+  unsigned char *a, *b;
+  unsigned long total, want, got, i;
+  unsigned int len;
+  int k, op, fail = 0;
+
+  m.len[0] = split ? rnd(SEGLEN) : SEGLEN;
+  m.len[1] = split ? SEGLEN : 0;
+  m.pos    = 0;
+  total    = (m.len[0] + m.len[1]) * 8;
+
+  a = calloc(m.len[0] + (split ? 0 : MAD_BUFFER_GUARD), 1);
+  b = calloc(m.len[1] + MAD_BUFFER_GUARD, 1);
+  for (i = 0; i < m.len[0]; ++i)
+    a[i] = rnd(256);
+  for (i = 0; i < m.len[1]; ++i)
+    b[i] = rnd(256);
+  m.seg[0] = a;
+  m.seg[1] = b;
+
+  mad_bit_init(&ptr, a);
+  if (split)
+    mad_bit_split(&ptr, a + m.len[0], b);
+  start = ptr;
+
+  for (k = 0; k < OPS; ++k) {
+    op  = rnd(6);
+    len = rnd(op == 1 ? 25 : 33);
+    if (m.pos + len + 16 > total)
+      break;
+
+    switch (op) {
+    case 0:
+      want = model_read(&m, len);
+      got  = mad_bit_read(&ptr, len);
+      break;
+
+    case 1:
+      want = model_read(&m, len);
+      got  = mad_bit_get(&ptr, len);
+      break;
+
+    case 2:
+      m.pos += len;
+      mad_bit_skip(&ptr, len);
+      want = got = 0;
+      break;
+
+    case 3:
+      want = m.pos;
+      got  = mad_bit_length(&start, &ptr);
+      break;
+
+    case 4:
+      want = (unsigned long) model_byte(&m, (m.pos + 7) / 8) * 9 +
+	8 - m.pos % 8;
+      got  = (unsigned long) mad_bit_nextbyte(&ptr) * 9 +
+	mad_bit_bitsleft(&ptr);
+      break;
+
+    default:
+      len  = rnd(16 + 1);
+      want = model_crc(m, len, 0xffff);
+      got  = mad_bit_crc(ptr, len, 0xffff);
+      break;
+    }
+
+    if (got != want) {
+      printf("FAIL: trace %d (%s), op %d: operation %d on %u bits at bit "
+	     "%lu gives %lx, expected %lx\n", n, split ? "split" : "one piece",
+	     k, op, len, m.pos, got, want);
+      fail = 1;
+      break;
+    }
+  }
+
+  free(a);
+  free(b);
+  return fail;
+}
+
+int main(void)
+{
+  int n;
+
+  for (n = 0; n < TRACES; ++n) {
+    if (trace(n, n & 1))
+      return 1;
+  }
+
+  printf("OK: %d random operation traces match the model (%d-bit "
+	 "reservoir)\n", TRACES, (int) MAD_BIT_CACHEBITS);
+  return 0;
+}
@@ -0,0 +1,136 @@
+/*
+ * NAME:	test_dct.c
+ * DESCRIPTION:	host test: dct32() against a double-precision DCT-II
+ *
+ * Blocks of 36 slots of random subband samples, at amplitudes from full
+ * scale down by up to 2^-11, go through the synthesis DCT the way
+ * synth_full() runs it: four slots per dct32_block() call and one lane per
+ * dct32_store() where the vector DCT is compiled in, one dct32() call per
+ * slot otherwise (-DOPT_DCT_SCALAR). Every output has to be within the
+ * bounds below of the DCT-II of the same input, computed in doubles. Then
+ * the DCT of a granule is timed; the best of RUNS runs is reported in ns
+ * per slot.
+ */
+
+# include <stdio.h>
+# include <stdlib.h>
+# include <math.h>
+# include <time.h>
+
+# include "../synth.c"
+
+# define BLOCKS	2000
+# define RUNS	5
+# define REPEAT	20000
+
+/*
+ * Limits the test checks against, in units of 2^-16 (the scale of the
+ * filterbank values). With OPT_SSO the cosines are 12-bit operands and the
+ * products keep 16 fraction bits, so the error is up to about 290 units for
+ * a full scale input, with an rms of about 32; both paths do exactly the
+ * same arithmetic, so they have the same error.
+ */
+# define MAX_ERR	400.0
+# define MAX_RMS	40.0
+
+static struct mad_frame frame;
+static mad_filter_t filter[2][2][16][8];
+
+/* the DCT of slot s of channel 0 into phase 0 of the filterbank */
+static void transform(unsigned int s, unsigned int phase)
+{
+# if defined(DCT_LANES)
+  static dct_t out[2][16][DCT_COLS];
+
+  if (s % DCT_LANES == 0)
+    dct32_block(&frame, 0, s, 36, 0, out[0], out[1]);
+  dct32_store((dct_t const (*)[16][DCT_COLS]) out, s % DCT_LANES, phase,
+	      filter);
+# else
+  dct32(frame.sbsample[0][s], phase >> 1, filter[0][phase & 1],
+	filter[1][phase & 1]);
+# endif
+}
+
+static double now(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+int main(void)
+{
+  static double cosine[32][32];
+  double amp, ref, err, maxerr = 0, sse = 0, t, best = 1e9;
+  unsigned long seed = 7, n = 0;
+  unsigned int b, s, k, i, r;
+  mad_fixed_t sum = 0;
+
+  for (k = 0; k < 32; ++k) {
+    for (i = 0; i < 32; ++i)
+      cosine[k][i] = cos(M_PI * (2 * i + 1) * k / 64);
+  }
+
+  for (b = 0; b < BLOCKS; ++b) {
+    amp = (b & 1) ? 1.0 : ldexp(1.0, -(int) (b / 2 % 12));
+    for (s = 0; s < 36; ++s) {
+      for (i = 0; i < 32; ++i) {
+	seed = seed * 1103515245UL + 12345UL;
+	frame.sbsample[0][s][i] = (mad_fixed_t)
+	  ((((seed >> 8) & 0xffff) / 32768.0 - 1) * amp * MAD_F_ONE / 4);
+      }
+    }
+
+    for (s = 0; s < 36; ++s) {
+      transform(s, 0);
+
+      /* output k is in hi[15 - k] for k < 16 and in lo[k - 16] above */
+
+      for (k = 0; k < 32; ++k) {
+	ref = 0;
+	for (i = 0; i < 32; ++i)
+	  ref += frame.sbsample[0][s][i] * cosine[k][i];
+	ref *= 65536.0 / MAD_F_ONE;
+
+	err = fabs((k < 16 ? filter[1][0][15 - k][0] :
+		    filter[0][0][k - 16][0]) - ref);
+	if (err > maxerr)
+	  maxerr = err;
+	sse += err * err;
+	++n;
+      }
+    }
+  }
+
+  for (r = 0; r < RUNS; ++r) {
+    t = now();
+    for (i = 0; i < REPEAT / 36; ++i) {
+      for (s = 0; s < 36; ++s)
+	transform(s, s & 15);
+      sum += filter[0][1][3][i & 7];
+    }
+    t = now() - t;
+    if (t < best)
+      best = t;
+  }
+
+# if defined(DCT_LANES)
+  printf("dct32, %d lanes:", DCT_LANES);
+# else
+  printf("dct32, one slot per call:");
+# endif
+  printf(" max error %.1f, rms %.1f (2^-16 units); %.1f ns per slot "
+	 "(checksum %x)\n", maxerr, sqrt(sse / n),
+	 best * 1e9 / (REPEAT / 36 * 36), (unsigned int) sum & 0xff);
+
+  if (maxerr > MAX_ERR || sqrt(sse / n) > MAX_RMS) {
+    printf("FAIL: more than %.0f max or %.0f rms off the double-precision "
+	   "DCT-II\n", MAX_ERR, MAX_RMS);
+    return 1;
+  }
+
+  printf("OK: dct32 is within bounds of the double-precision DCT-II\n");
+  return 0;
+}
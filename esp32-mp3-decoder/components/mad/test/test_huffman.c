@@ -0,0 +1,128 @@
+/*
+ * NAME:	test_huffman.c
+ * DESCRIPTION:	host test: the flattened Huffman tables decode exactly like
+ *		the original ones
+ *
+ * Every possible bit pattern as long as the longest code word (19 bits for
+ * the pair tables, 6 for the quadruple tables) is decoded with both the
+ * original tables in huffman_iso.c, walked the way the old layer3.c did,
+ * and the tables in ../huffman.c, walked the way layer3.c does now. Both
+ * have to give the same values and use up the same number of bits; the
+ * linbits of every pair table have to match as well.
+ */
+
+# include <stdio.h>
+
+# include "huffman.h"
+# include "huffman_iso.h"
+
+# define PAIR_BITS	19
+# define QUAD_BITS	6
+
+/* n bits of w (left-aligned in 32 bits), starting at bit pos */
+static unsigned int take(unsigned long w, int pos, int n)
+{
+  if (n == 0)
+    return 0;
+
+  return (w >> (32 - pos - n)) & ((1UL << n) - 1);
+}
+
+static int check_pair(int n)
+{
+  struct iso_hufftable const *o = &iso_huff_pair_table[n];
+  struct hufftable const *t = &mad_huff_pair_table[n];
+  unsigned long i;
+
+  if ((o->table == 0) != (t->table == 0) || o->linbits != t->linbits) {
+    printf("FAIL: pair table %d: linbits or presence differ\n", n);
+    return 1;
+  }
+  if (o->table == 0)
+    return 0;
+
+  for (i = 0; i < (1UL << PAIR_BITS); ++i) {
+    unsigned long w = i << (32 - PAIR_BITS);
+    union iso_huffpair const *op;
+    union huffpair const *np;
+    int opos = 0, npos = 0, clump;
+
+    clump = o->startbits;
+    op = &o->table[take(w, opos, clump)];
+    while (!op->final) {
+      opos += clump;
+      clump = op->ptr.bits;
+      op = &o->table[op->ptr.offset + take(w, opos, clump)];
+    }
+    opos += op->value.hlen;
+
+    clump = t->startbits;
+    np = &t->table[take(w, npos, clump)];
+    while (!np->final) {
+      npos += clump;
+      clump = np->ptr.bits;
+      np = &t->table[np->ptr.offset + take(w, npos, clump)];
+    }
+    npos += np->value.hlen;
+
+    if (opos != npos || op->value.x != np->value.x ||
+	op->value.y != np->value.y) {
+      printf("FAIL: pair table %d, bits %05lx: (%u, %u)/%d, expected "
+	     "(%u, %u)/%d\n", n, i, np->value.x, np->value.y, npos,
+	     op->value.x, op->value.y, opos);
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+static int check_quad(int n)
+{
+  union iso_huffquad const *o = iso_huff_quad_table[n];
+  union huffquad const *t = mad_huff_quad_table[n];
+  unsigned long i;
+
+  for (i = 0; i < (1UL << QUAD_BITS); ++i) {
+    unsigned long w = i << (32 - QUAD_BITS);
+    union iso_huffquad const *op;
+    union huffquad const *np;
+    int opos = 0, clump = 4;
+
+    op = &o[take(w, opos, clump)];
+    while (!op->final) {
+      opos += clump;
+      clump = op->ptr.bits;
+      op = &o[op->ptr.offset + take(w, opos, clump)];
+    }
+    opos += op->value.hlen;
+
+    np = &t[take(w, 0, QUAD_BITS)];
+
+    if (!np->final || opos != np->value.hlen ||
+	op->value.v != np->value.v || op->value.w != np->value.w ||
+	op->value.x != np->value.x || op->value.y != np->value.y) {
+      printf("FAIL: quad table %c, bits %02lx\n", 'A' + n, i);
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+int main(void)
+{
+  int n;
+
+  for (n = 0; n < 2; ++n) {
+    if (check_quad(n))
+      return 1;
+  }
+  for (n = 0; n < 32; ++n) {
+    if (check_pair(n))
+      return 1;
+  }
+
+  printf("OK: all Huffman code words decode the same in both table formats\n");
+  return 0;
+}
@@ -0,0 +1,151 @@
+/*
+ * NAME:	test_reentrant.c
+ * DESCRIPTION:	host test: decoder instances on different threads don't
+ *		share any state
+ *
+ * Two different streams are decoded one after the other first; that's the
+ * reference. Then they are decoded again, at the same time, on two threads,
+ * each with its own struct sync_t. Every run has to give exactly the same
+ * PCM as the reference, down to the last bit.
+ */
+
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include <pthread.h>
+
+# include "mad.h"
+# include "decoder.h"
+# include "teststream.h"
+
+# define RUNS	20
+
+struct job {
+  char const *name;
+  unsigned char *data;
+  unsigned long len;
+  int options;
+  int nframes;			/* frames in the stream */
+  int minframes;		/* frames that have to decode */
+
+  short *pcm;			/* all decoded samples */
+  unsigned long npcm;
+  unsigned long maxpcm;
+  int frames;
+};
+
+static void output(void *data, struct mad_pcm const *pcm)
+{
+  struct job *job = data;
+  unsigned long n = pcm->length * pcm->channels;
+
+  if (job->npcm + n > job->maxpcm) {
+    job->maxpcm = (job->npcm + n) * 2;
+    job->pcm = realloc(job->pcm, job->maxpcm * sizeof(short));
+  }
+  memcpy(job->pcm + job->npcm, pcm->samples, n * sizeof(short));
+  job->npcm += n;
+}
+
+static void *decode(void *arg)
+{
+  struct job *job = arg;
+  struct sync_t *sync;
+  struct mad_pcm_sink sink;
+  unsigned char *buf;
+
+  /* libmad reads a bit past the end of the data */
+  buf = calloc(job->len + MAD_BUFFER_GUARD, 1);
+  memcpy(buf, job->data, job->len);
+
+  sync = malloc(sizeof(*sync));
+  mad_sync_init(sync);
+
+  sink.layout = MAD_PCM_LAYOUT_INTERLEAVED;
+  sink.format = MAD_PCM_FORMAT_S16;
+  sink.write  = output;
+  sink.data   = job;
+  mad_synth_sink(&sync->synth, &sink);
+  mad_stream_options(&sync->stream, job->options);
+  mad_stream_buffer(&sync->stream, buf, job->len + MAD_BUFFER_GUARD);
+
+  job->npcm   = 0;
+  job->frames = 0;
+  while (1) {
+    if (mad_frame_decode(&sync->frame, &sync->stream) == -1) {
+      if (!MAD_RECOVERABLE(sync->stream.error))
+	break;
+      continue;
+    }
+    mad_synth_frame(&sync->synth, &sync->frame);
+    job->frames++;
+  }
+
+  mad_sync_finish(sync);
+  free(sync);
+  free(buf);
+  return 0;
+}
+
+static int same(struct job const *a, struct job const *b)
+{
+  return a->frames == b->frames && a->npcm == b->npcm &&
+    memcmp(a->pcm, b->pcm, a->npcm * sizeof(short)) == 0;
+}
+
+int main(void)
+{
+  struct job ref[2], job[2];
+  pthread_t thread[2];
+  int i, run, failed = 0;
+
+  memset(ref, 0, sizeof(ref));
+  ref[0].name = "MPEG1 joint stereo";
+  ref[0].nframes = 400;
+  ref[0].minframes = 160;
+  ref[0].data = teststream_make(1, ref[0].nframes, 0, 0, 9,
+				TESTSTREAM_JOINT, &ref[0].len);
+  ref[1].name = "MPEG2 mono";
+  ref[1].nframes = 600;
+  ref[1].minframes = 560;
+  ref[1].data = teststream_make(2, ref[1].nframes, 1, 1, 8,
+				TESTSTREAM_MONO, &ref[1].len);
+
+  /*
+   * The main data of the test streams is random, so not every frame
+   * decodes; but if far fewer do than usual, the decoder isn't getting
+   * much of a workout (or the stream generator broke).
+   */
+  for (i = 0; i < 2; ++i) {
+    decode(&ref[i]);
+    printf("%s: %d of %d frames, %lu samples\n", ref[i].name, ref[i].frames,
+	   ref[i].nframes, ref[i].npcm);
+    if (ref[i].frames < ref[i].minframes) {
+      printf("FAIL: fewer than %d frames decoded\n", ref[i].minframes);
+      return 1;
+    }
+  }
+
+  memset(job, 0, sizeof(job));
+  for (run = 0; run < RUNS; ++run) {
+    for (i = 0; i < 2; ++i) {
+      job[i].name = ref[i].name;
+      job[i].data = ref[i].data;
+      job[i].len  = ref[i].len;
+      pthread_create(&thread[i], 0, decode, &job[i]);
+    }
+    for (i = 0; i < 2; ++i) {
+      pthread_join(thread[i], 0);
+      if (!same(&job[i], &ref[i])) {
+	printf("FAIL: %s differs from the single-threaded run (run %d)\n",
+	       job[i].name, run);
+	failed = 1;
+      }
+    }
+  }
+
+  if (failed)
+    return 1;
+  printf("OK: %d concurrent runs match the single-threaded output\n", RUNS);
+  return 0;
+}
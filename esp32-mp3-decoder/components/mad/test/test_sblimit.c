@@ -0,0 +1,161 @@
+/*
+ * NAME:	test_sblimit.c
+ * DESCRIPTION:	host test: the subband cap (MAD_OPTION_SUBBANDS)
+ *
+ * Test streams are decoded without a cap and with caps of 2, 16, 20 and 31
+ * subbands. With a cap, every decoded frame has to have zero subband
+ * samples and a zero overlap buffer above it. Below the cap the subband
+ * samples have to be the same as without one, except for the top subband:
+ * alias reduction stops at the cap, so that one misses the butterflies
+ * with the subband above it. As in bench_channels, the random main data
+ * can make a frame decode in one run and not in the other, so frames are
+ * only compared where both runs also decoded the frame right before.
+ */
+
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+
+# include "mad.h"
+# include "decoder.h"
+# include "teststream.h"
+
+# define FRAMES	200
+
+struct run {
+  int frames;
+  long offset[FRAMES];		/* where every decoded frame starts */
+  long end[FRAMES];		/* and ends */
+  mad_fixed_t (*sbsample)[2][36][32];
+};
+
+/* decode the whole stream; returns nonzero if anything above the cap
+   isn't zero */
+static int decode(unsigned char *buf, unsigned long len, unsigned int cap,
+		  struct run *run)
+{
+  static struct sync_t sync;
+  unsigned int ch, s, sb;
+  int bad = 0;
+
+  mad_sync_init(&sync);
+  mad_stream_options(&sync.stream, MAD_OPTION_SUBBANDS(cap));
+  mad_stream_buffer(&sync.stream, buf, len + MAD_BUFFER_GUARD);
+
+  run->frames = 0;
+  while (run->frames < FRAMES) {
+    if (mad_frame_decode(&sync.frame, &sync.stream) == -1) {
+      if (!MAD_RECOVERABLE(sync.stream.error))
+	break;
+      continue;
+    }
+
+    for (ch = 0; ch < 2; ++ch) {
+      for (sb = cap; sb < 32; ++sb) {
+	for (s = 0; s < 36; ++s)
+	  bad |= sync.frame.sbsample[ch][s][sb] != 0;
+	for (s = 0; s < 18; ++s)
+	  bad |= (*sync.frame.overlap)[ch][sb][s] != 0;
+      }
+    }
+
+    memcpy(run->sbsample[run->frames], sync.frame.sbsample,
+	   sizeof(sync.frame.sbsample));
+    run->offset[run->frames] = sync.stream.this_frame - buf;
+    run->end[run->frames++]  = sync.stream.next_frame - buf;
+  }
+
+  mad_sync_finish(&sync);
+  return bad;
+}
+
+/* compare the subbands below cap - 1; returns the amount of frames
+   compared, or -1 - the offset of a frame that differs */
+static long compare(struct run const *full, struct run const *capped,
+		    unsigned int cap)
+{
+  unsigned int ch, s, sb;
+  int f, g, n = 0;
+
+  for (f = 1, g = 1; f < full->frames && g < capped->frames; ) {
+    if (full->offset[f] < capped->offset[g])
+      ++f;
+    else if (full->offset[f] > capped->offset[g])
+      ++g;
+    else {
+      if (full->end[f - 1] == full->offset[f] &&
+	  capped->end[g - 1] == capped->offset[g]) {
+	for (ch = 0; ch < 2; ++ch) {
+	  for (s = 0; s < 36; ++s) {
+	    for (sb = 0; sb + 1 < cap; ++sb) {
+	      if (full->sbsample[f][ch][s][sb] !=
+		  capped->sbsample[g][ch][s][sb])
+		return -1 - full->offset[f];
+	    }
+	  }
+	}
+	++n;
+      }
+      ++f;
+      ++g;
+    }
+  }
+
+  return n;
+}
+
+int main(void)
+{
+  static struct {
+    char const *name;
+    int lsf, sr_idx, br_idx, mode;
+  } const streams[] = {
+    { "MPEG1 128k stereo", 0, 0, 9,  TESTSTREAM_STEREO },
+    { "MPEG1 320k joint",  0, 0, 14, TESTSTREAM_JOINT  },
+    { "MPEG2 64k mono",    1, 1, 8,  TESTSTREAM_MONO   }
+  };
+  static unsigned int const caps[] = { 2, 16, 20, 31 };
+  static struct run full, capped;
+  unsigned char *data, *buf;
+  unsigned long len;
+  int s, c;
+  long n, compared = 0;
+
+  full.sbsample   = malloc(FRAMES * sizeof(*full.sbsample));
+  capped.sbsample = malloc(FRAMES * sizeof(*capped.sbsample));
+
+  for (s = 0; s < 3; ++s) {
+    data = teststream_make(s + 1, FRAMES, streams[s].lsf, streams[s].sr_idx,
+			   streams[s].br_idx, streams[s].mode, &len);
+    buf = calloc(len + MAD_BUFFER_GUARD, 1);
+    memcpy(buf, data, len);
+
+    decode(buf, len, 32, &full);
+    for (c = 0; c < 4; ++c) {
+      if (decode(buf, len, caps[c], &capped)) {
+	printf("FAIL: %s, %u subbands: nonzero output or overlap above the "
+	       "cap\n", streams[s].name, caps[c]);
+	return 1;
+      }
+      n = compare(&full, &capped, caps[c]);
+      if (n < 0) {
+	printf("FAIL: %s, %u subbands: the frame at byte %ld differs below "
+	       "the cap\n", streams[s].name, caps[c], -1 - n);
+	return 1;
+      }
+      if (n < FRAMES / 10) {
+	printf("FAIL: %s, %u subbands: only %ld frames to compare\n",
+	       streams[s].name, caps[c], n);
+	return 1;
+      }
+      compared += n;
+    }
+
+    free(buf);
+    free(data);
+  }
+
+  printf("OK: the subband cap zeroes everything above it and changes "
+	 "nothing below (%ld frames compared)\n", compared);
+  return 0;
+}
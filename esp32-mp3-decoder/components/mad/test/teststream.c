@@ -0,0 +1,199 @@
+/*
+ * NAME:	teststream.c
+ * DESCRIPTION:	synthetic MPEG audio Layer III streams for the host tests
+ *
+ * The streams have valid headers and side information and use the bit
+ * reservoir, but the main data is random. They don't sound like anything;
+ * they only have to give the decoder the same work on every run, without
+ * shipping binary test files. Random Huffman data runs past the end of its
+ * granule often enough that only a part of the frames decode: about 45% of
+ * the MPEG-1 stereo frames and over 95% of the MPEG-2 mono ones.
+ */
+
+# include <stdlib.h>
+# include <string.h>
+
+# include "teststream.h"
+
+struct bitwriter {
+  unsigned char *buf;
+  unsigned long pos;		/* in bits */
+};
+
+static unsigned long rng;
+static int gain_lo = 140, gain_hi = 185;
+
+static unsigned int rnd(unsigned int n)
+{
+  rng = rng * 1103515245UL + 12345UL;
+  return ((rng >> 16) & 0x7fff) % n;
+}
+
+static int rnd_range(int lo, int hi)
+{
+  return lo + (int) rnd(hi - lo + 1);
+}
+
+static void put(struct bitwriter *bw, unsigned int value, int nbits)
+{
+  while (nbits--) {
+    if (value >> nbits & 1)
+      bw->buf[bw->pos >> 3] |= 0x80 >> (bw->pos & 7);
+    bw->pos++;
+  }
+}
+
+/*
+ * NAME:	teststream_gain()
+ * DESCRIPTION:	set the range of global_gain for the streams made after this
+ */
+void teststream_gain(int lo, int hi)
+{
+  gain_lo = lo;
+  gain_hi = hi;
+}
+
+/*
+ * NAME:	teststream_make()
+ * DESCRIPTION:	build a stream of nframes frames; the caller frees it
+ */
+unsigned char *teststream_make(unsigned long seed, int nframes, int lsf,
+			       int sr_idx, int br_idx, int mode,
+			       unsigned long *len)
+{
+  static int const brs[2][15] = {
+    { 0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320 },
+    { 0,  8, 16, 24, 32, 40, 48, 56,  64,  80,  96, 112, 128, 144, 160 }
+  };
+  static int const srs[2][3] = { { 44100, 48000, 32000 },
+				 { 22050, 24000, 16000 } };
+  int nch, ngr, si_len, size, cap, k, gr, ch, i, j, n;
+  int ws = 0, bt = 0, mixed = 0, scfsi[2], lens[4];
+  long w, s, prev_end, avail, m, rem;
+  unsigned char *md, *si, *out;
+  struct bitwriter bw;
+
+  rng = seed;
+  nch    = (mode == TESTSTREAM_MONO) ? 1 : 2;
+  ngr    = lsf ? 1 : 2;
+  si_len = lsf ? (nch == 1 ? 9 : 17) : (nch == 1 ? 17 : 32);
+  size   = (lsf ? 72 : 144) * brs[lsf][br_idx] * 1000 / srs[lsf][sr_idx];
+  cap    = size - 4 - si_len;
+
+  /* main data of all frames, as one stream, and the side info per frame */
+  md  = calloc((unsigned long) nframes * cap, 1);
+  si  = calloc((unsigned long) nframes * si_len, 1);
+  out = calloc((unsigned long) nframes * size, 1);
+
+  w = 0;
+  prev_end = 0;
+  for (k = 0; k < nframes; ++k) {
+    /* where this frame's main data starts: somewhere in the reservoir */
+    s = w - (lsf ? 255 : 511);
+    if (s < prev_end)
+      s = prev_end;
+    if (k > 0 && rnd(5) < 4)
+      s = s + rnd(w - s + 1);
+    if (k == 0)
+      s = w;
+    avail = w + cap - s;
+    m = rnd_range(avail / 2 > 1 ? avail / 2 : 1, avail);
+
+    /* ancillary filler up to the start, then the granule/channel data */
+    for (j = prev_end; j < s; ++j)
+      md[j] = rnd(256);
+    rem = m * 8;
+    for (i = 0; i < ngr * nch; ++i) {
+      n = rem / (ngr * nch - i) - rnd(17);
+      if (n > 4095)
+	n = 4095;
+      if (n < 0)
+	n = 0;
+      lens[i] = n;
+      rem -= n;
+    }
+    for (j = s; j < s + m; ++j)
+      md[j] = rnd(256);
+    prev_end = s + m;
+
+    /* side info */
+    bw.buf = si + k * si_len;
+    bw.pos = 0;
+    put(&bw, w - s, lsf ? 8 : 9);
+    put(&bw, 0, lsf ? (nch == 1 ? 1 : 2) : (nch == 1 ? 5 : 3));
+    scfsi[0] = scfsi[1] = 0;
+    if (!lsf) {
+      for (ch = 0; ch < nch; ++ch) {
+	scfsi[ch] = (rnd(3) == 2) ? rnd(16) : 0;
+	put(&bw, scfsi[ch], 4);
+      }
+    }
+    i = 0;
+    for (gr = 0; gr < ngr; ++gr) {
+      for (ch = 0; ch < nch; ++ch) {
+	put(&bw, lens[i++], 12);
+	put(&bw, rnd(10) ? rnd_range(10, 110) : rnd_range(0, 288), 9);
+	put(&bw, rnd_range(gain_lo, gain_hi), 8);
+	put(&bw, lsf ? rnd(512) : rnd(16), lsf ? 9 : 4);
+	/* joint stereo needs the same block type in both channels */
+	if (ch == 0 || mode != TESTSTREAM_JOINT) {
+	  ws    = rnd(10) < 3;
+	  bt    = ws ? "\1\2\2\3"[rnd(4)] : 0;
+	  mixed = (bt == 2) ? rnd(2) : 0;
+	}
+	/* no scalefactor reuse with short blocks (in either channel) */
+	if (!lsf && bt == 2 &&
+	    (scfsi[ch] || (mode == TESTSTREAM_JOINT && scfsi[!ch])))
+	  bt = 1;
+	put(&bw, ws, 1);
+	if (ws) {
+	  put(&bw, bt, 2);
+	  put(&bw, mixed, 1);
+	  for (j = 0; j < 2; ++j) {
+	    do n = rnd(32); while (n == 4 || n == 14);
+	    put(&bw, n, 5);
+	  }
+	  for (j = 0; j < 3; ++j)
+	    put(&bw, rnd(8), 3);
+	}
+	else {
+	  for (j = 0; j < 3; ++j) {
+	    do n = rnd(32); while (n == 4 || n == 14);
+	    put(&bw, n, 5);
+	  }
+	  put(&bw, rnd(16), 4);
+	  put(&bw, rnd(8), 3);
+	}
+	put(&bw, lsf ? rnd(4) : rnd(8), lsf ? 2 : 3);
+      }
+    }
+
+    /* header */
+    bw.buf = out + k * size;
+    bw.pos = 0;
+    put(&bw, 0x7ff, 11);
+    put(&bw, lsf ? 2 : 3, 2);
+    put(&bw, 1, 2);				/* Layer III */
+    put(&bw, 1, 1);				/* no CRC */
+    put(&bw, br_idx, 4);
+    put(&bw, sr_idx, 2);
+    put(&bw, 0, 2);				/* no padding, private bit */
+    put(&bw, mode, 2);
+    put(&bw, (mode == TESTSTREAM_JOINT) ? rnd(4) : 0, 2);
+    put(&bw, 4, 4);				/* original, no emphasis */
+
+    w += cap;
+  }
+  for (j = prev_end; j < w; ++j)
+    md[j] = rnd(256);
+
+  for (k = 0; k < nframes; ++k) {
+    memcpy(out + k * size + 4, si + k * si_len, si_len);
+    memcpy(out + k * size + 4 + si_len, md + (long) k * cap, cap);
+  }
+  free(md);
+  free(si);
+
+  *len = (unsigned long) nframes * size;
+  return out;
+}
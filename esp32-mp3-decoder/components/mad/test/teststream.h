@@ -0,0 +1,26 @@
+/*
+ * NAME:	teststream.h
+ * DESCRIPTION:	synthetic MPEG audio Layer III streams for the host tests
+ */
+
+# ifndef TESTSTREAM_H
+# define TESTSTREAM_H
+
+enum {
+  TESTSTREAM_STEREO = 0,
+  TESTSTREAM_JOINT  = 1,
+  TESTSTREAM_MONO   = 3
+};
+
+/*
+ * The default global_gain range, 140 to 185, is loud enough that some
+ * samples clip and the 32-bit fixed-point code sometimes overflows; 100 to
+ * 130 gives streams that do neither.
+ */
+void teststream_gain(int lo, int hi);
+
+unsigned char *teststream_make(unsigned long seed, int nframes, int lsf,
+			       int sr_idx, int br_idx, int mode,
+			       unsigned long *len);
+
+# endif
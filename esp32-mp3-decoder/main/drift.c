@@ -0,0 +1,71 @@
+/******************************************************************************
+ * FileName: drift.c
+ *
+ * Description: Clock drift controller. The sample clock of the stream server
+ * and our own I2S clock never run at exactly the same speed, so the buffer of
+ * mp3 data slowly fills up or runs dry. This PI controller looks at the
+ * (smoothed) buffer fill and calculates how much faster or slower than nominal
+ * we should play to keep it at its target; the resampler then does that.
+ *
+*******************************************************************************/
+#include "drift.h"
+
+//Time constant of the fill smoothing, as a power of 2 of the amount of blocks: 2^9 blocks of 1152
+//samples is about 13 seconds at 44.1KHz. This gets rid of the jitter of network packets and mp3
+//frames arriving and being decoded in bursts, and of short network stalls.
+#define DRIFT_SMOOTH_SHIFT (9)
+//Proportional gain: speed correction per byte of fill error, 8.24 fixed point (17 is about 1 ppm,
+//so this is about half a ppm per byte). The loop is slow on purpose: a wobbly playback speed is
+//more audible than a buffer that takes a few minutes to settle.
+#define DRIFT_KP (8)
+//Integral gain: the integrated fill error (in byte-blocks) is shifted right this much to get the
+//integral part of the speed correction. This is what ends up tracking the actual clock difference,
+//so the fill settles on the target instead of at an offset proportional to the drift.
+#define DRIFT_KI_SHIFT (10)
+//Largest speed correction, 8.24 fixed point: about 2000 ppm. Must be less than 1/256 (see resample.h).
+#define DRIFT_MAX (2000*17)
+
+static int target;
+static int fillAvg;			//Smoothed fill, in bytes, with 8 fractional bits
+static int integ;
+static int corr;
+
+//Start controlling towards the given buffer fill, in bytes.
+void driftInit(int targetFill) {
+	target=targetFill;
+	fillAvg=targetFill<<8;
+	integ=0;
+	corr=0;
+}
+
+//Call this once for every block of output samples, with the current buffer fill in bytes. Returns
+//the resampler step: the amount of input samples to advance per output sample, as an 8.24 number.
+unsigned int driftUpdate(int fill) {
+	int err, p, i;
+
+	fillAvg+=((fill<<8)-fillAvg)>>DRIFT_SMOOTH_SHIFT;
+	err=(fillAvg>>8)-target;
+
+	p=err*DRIFT_KP;
+	if (p>DRIFT_MAX) p=DRIFT_MAX;
+	if (p<-DRIFT_MAX) p=-DRIFT_MAX;
+
+	//An empty buffer means the network stalled, not that our clock is off. Don't let that wind up
+	//the integrator.
+	if (fill!=0) integ+=err;
+	//Anti-windup: the integral part alone never needs to be more than the maximum correction.
+	if (integ>(DRIFT_MAX<<DRIFT_KI_SHIFT)) integ=DRIFT_MAX<<DRIFT_KI_SHIFT;
+	if (integ<-(DRIFT_MAX<<DRIFT_KI_SHIFT)) integ=-(DRIFT_MAX<<DRIFT_KI_SHIFT);
+	i=integ>>DRIFT_KI_SHIFT;
+
+	corr=p+i;
+	if (corr>DRIFT_MAX) corr=DRIFT_MAX;
+	if (corr<-DRIFT_MAX) corr=-DRIFT_MAX;
+	//A buffer that's too full means the server is faster than us: play faster, eating more input.
+	return (1<<24)+corr;
+}
+
+//Current speed correction, in ppm. Positive means we play faster than nominal.
+int driftGetPpm() {
+	return (int)(((long long)corr*1000000)>>24);
+}
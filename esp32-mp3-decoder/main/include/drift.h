@@ -0,0 +1,8 @@
+#ifndef _DRIFT_H_
+#define _DRIFT_H_
+
+void driftInit(int targetFill);
+unsigned int driftUpdate(int fill);
+int driftGetPpm();
+
+#endif
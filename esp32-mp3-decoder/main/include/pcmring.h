@@ -0,0 +1,25 @@
+#ifndef _PCMRING_H_
+#define _PCMRING_H_
+
+#include "mad.h"
+
+//Most samples in one block: one MPEG1 frame, mixed down to mono
+#define PCM_BLOCK_SAMPLES (1152)
+
+struct pcmBlock {
+	int samplerate;
+	int length;
+	mad_timer_t time;		//Stream time of the first sample
+	mad_timer_t duration;	//Stream time the block covers
+	short samples[PCM_BLOCK_SAMPLES];
+};
+
+int pcmRingInit();
+struct pcmBlock *pcmRingBorrow();
+void pcmRingCommit();
+struct pcmBlock *pcmRingPeek();
+void pcmRingRelease();
+int pcmRingFill();
+long pcmRingGetUnderrunCt();
+
+#endif
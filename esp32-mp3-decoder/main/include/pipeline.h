@@ -0,0 +1,17 @@
+#ifndef _PIPELINE_H_
+#define _PIPELINE_H_
+
+//Number of frames of subband samples in the pipeline between the decode and the synthesis task. With 2,
+//one frame can be decoded while the previous one is synthesized; a 3rd one absorbs some jitter.
+#define PIPELINE_FRAMES (3)
+
+struct sync_t;
+struct mad_frame;
+
+int pipelineInit(struct sync_t *dec);
+struct mad_frame *pipelineGetFree();
+void pipelinePutDecoded(struct mad_frame *frame);
+struct mad_frame *pipelineGetDecoded();
+void pipelinePutFree(struct mad_frame *frame);
+
+#endif
@@ -33,7 +33,7 @@ mp3 output: */
 #endif
 
 /* You can also play a non-streaming mp3 file that's hosted somewhere. WARNING: If you do this,
-make sure to comment out the ADD_DEL_SAMPLES define below, or you'll get too fast a playback 
+make sure to comment out the CLOCK_DRIFT_CORRECTION define below, or you'll get too fast a playback 
 rate! */
 #if 0
 #define PLAY_SERVER "meuk.spritesserver.nl"
@@ -47,31 +47,30 @@ rate! */
 clock of the server is a bit faster than our sample clock, it will send out mp3 data faster
 than we process it and our buffer will fill up. Conversely, if the server clock is slower, we'll
 eat up samples quicker than the server provides them and we end up with an empty buffer.
-To fix this, the mp3 logic can insert/delete some samples to modify the speed of playback.
-If our buffers are filling up too fast (presumably due to a quick sample clock on the other side)
-we will increase our playout speed; if our buffers empty too quickly, we will decrease it a bit.
-Unfortunately, adding or deleting samples isn't very good for the audio quality. If you
-want better quality, turn this off and/or feel free to implement a better algorithm.
+To fix this, the output resamples the decoded audio to play it a tiny bit (at most about 2000ppm)
+faster or slower, as decided by a slow PI controller that keeps the mp3 buffer half full. Unlike
+adding or deleting whole samples, this doesn't click and doesn't audibly change the pitch. This
+replaces the old ADD_DEL_SAMPLES, ADD_DEL_BUFFPERSAMP and ADD_DEL_BUFFPERSAMP_NOSPIRAM settings, which
+are no longer used.
 WARNING: Don't use this define if you play non-stream files. It will presume the sample clock
-on the server side is waaay too fast and will default to playing back the stream too fast.*/
-#define ADD_DEL_SAMPLES
-
-/*ADD_DEL_SAMPLES parameter:
-Size of the cumulative buffer offset before we are going to add or remove a sample
-The higher this number, the more aggressive we're adjusting the sample rate. Higher numbers give
-better resistance to buffer over/underflows due to clock differences, but also can result in
-the music sounding higher/lower due to network issues.*/
-#define ADD_DEL_BUFFPERSAMP (2000)
-
-/*ADD_DEL_SAMPLES parameter:
-Same as ADD_DEL_BUFFPERSAMP but for systems without a big SPI RAM chip to buffer mp3 data in.*/
-#define ADD_DEL_BUFFPERSAMP_NOSPIRAM (3000)
+on the server side is waaay too fast and will play back the stream too fast.*/
+#define CLOCK_DRIFT_CORRECTION
 
 /*Most I2S codecs are okay with getting more than 16 samples, and we can use this to get the
 sample rate we send out somewhat closer to the real sample rate of the MP3 stream. Some codecs
-however (e.g. the PCM5102) will not output anything when this happens. Undefine the following
-define in that case, it makes the I2S port always send out strictly 16-bit samples.*/
-#define ALLOW_VARY_SAMPLE_BITS
+however (e.g. the PCM5102) will not output anything when this happens. With the fractional clock
+divider, 16-bit samples already get within a few ppm of the MPEG sample rates, so this is off by
+default and the I2S port always sends out strictly 16-bit samples. Define this to allow more bits
+for the sample rates that aren't in the table in i2s_clktab.h.*/
+//#define ALLOW_VARY_SAMPLE_BITS
+
+/*Normally, the I2S port is retuned to the sample rate of every stream. With this define, it always
+runs at the given rate (44100 or 48000) instead, and everything else is converted to that in software
+with a polyphase filter (see rateconv.c). This costs a bit of CPU and flattens the very top of the
+audio band (above 0.45 times the lower of the two sample rates), but codecs that only like one rate
+or only 16-bit samples (leave ALLOW_VARY_SAMPLE_BITS undefined for those) will play everything, and rate
+switches (including the ones ADAPTIVE_QUALITY does) don't retune the I2S clock.*/
+//#define FIXED_OUTPUT_RATE (44100)
 
 
 /*While connecting an I2S codec to the I2S port of the ESP is obviously the best way to get nice
@@ -94,6 +93,36 @@ CPU power to run stable at 80MHz without causing DMA dropouts.
 */
 //#define DELTA_SIGMA_HACK
 
+/*When the CPU can't decode the stream in real time (e.g. because of a high bitrate, a slow clock or
+a busy network stack), the output starts to stutter. With this define, the decoder keeps an eye on
+how long decoding a frame takes and on how much audio is queued for the I2S DMA, and it temporarily
+switches to cheaper decoding modes when needed: first it drops the highest frequencies, then it only
+decodes the left channel, and as a last resort (only with FIXED_OUTPUT_RATE, as the I2S clock would
+otherwise be retuned under audio that's already queued) it halves the output sample rate. When there
+is CPU time to spare again for a while, it goes back up to full quality.*/
+//#define ADAPTIVE_QUALITY
+
+/*The ESP32 has two cores. With this define, decoding an mp3 frame into subband samples happens in
+one task on core 0, while a second task on core 1 runs the synthesis filterbank and the output.
+The two are connected by a small ring of frames (see pipeline.h), so the next frame is decoded while
+the current one is synthesized. This costs about 2*9K of RAM for the extra frames.*/
+//#define DUAL_CORE_PIPELINE
+
+/*Another way to use the second core: with this define, a worker task on core 1 does the Layer III
+IMDCT and overlap-add of the right channel of stereo frames while the decoder does the left one. This
+makes decoding a frame quicker rather than overlapping frames, and it needs no extra frame buffers.
+It can be combined with DUAL_CORE_PIPELINE; the worker then shares core 1 with the synthesis task.*/
+//#define CHANNEL_PARALLEL
+
+/*Converting the decoded samples for the I2S port (especially with DELTA_SIGMA_HACK) and waiting for
+free DMA buffers normally happens in the decoder itself. With this define, that is done by a separate
+output task instead, which can run on the other core. The decoder hands it the samples of every frame
+through a ring of OUTPUT_RING_BLOCKS blocks of about 2.3K each: more blocks cost RAM and add latency
+(one 44.1KHz frame is 26mS), but ride out longer decoder hiccups.*/
+//#define OUTPUT_TASK
+#define OUTPUT_RING_BLOCKS (4)
+#define OUTPUT_TASK_CORE (1)
+
 /*While a large (tens to hundreds of K) buffer is necessary for Internet streams, on a
 quiet network and with a direct connection to the stream server, you can get away with
 a much smaller buffer. Enabling the following switch will disable accesses to the 
@@ -0,0 +1,14 @@
+#ifndef _PLAYPOS_H_
+#define _PLAYPOS_H_
+
+#include "mad.h"
+
+//Amount of blocks of output remembered. The I2S DMA buffers hold at most a few dozen milliseconds of
+//samples, so this only has to cover the blocks that can be in there at the same time.
+#define PLAYPOS_BLOCKS (32)
+
+void playPosInit();
+void playPosAddBlock(unsigned int start, unsigned int end, mad_timer_t time, mad_timer_t duration);
+int playPosGet(mad_timer_t *time);
+
+#endif
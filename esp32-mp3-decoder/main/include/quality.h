@@ -0,0 +1,19 @@
+#ifndef _QUALITY_H_
+#define _QUALITY_H_
+
+//Number of decode quality levels. Level 0 is full quality; every next level is cheaper to decode.
+#define QUALITY_LEVELS (5)
+
+void qualityInit();
+void qualityFrameStart();
+void qualityAddIdle(unsigned int cycles);
+int qualityFrameEnd(int samples, int rate);
+void qualityDecodeCycles(unsigned int cycles);
+int qualityGetOptions();
+
+int qualityGetLevel();
+int qualityGetLoad();
+long qualityGetStepDownCt();
+long qualityGetStepUpCt();
+
+#endif
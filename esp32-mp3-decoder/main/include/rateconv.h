@@ -0,0 +1,14 @@
+#ifndef _RATECONV_H_
+#define _RATECONV_H_
+
+//Most samples rateConvBlock takes and gives in one go. When upsampling, feed it at most
+//rateConvMaxIn(step) samples at a time so the output fits.
+#define RATECONV_MAX_IN (1152)
+#define RATECONV_MAX_OUT (1152)
+
+void rateConvInit(int outRate);
+unsigned int rateConvSetRate(int inRate);
+int rateConvMaxIn(unsigned int step);
+int rateConvBlock(const short *in, int len, short *out, unsigned int step);
+
+#endif
@@ -0,0 +1,12 @@
+#ifndef _RESAMPLE_H_
+#define _RESAMPLE_H_
+
+//Most samples resampleBlock takes and gives in one go. The output can be a bit longer than the
+//input when playing slower than the nominal rate.
+#define RESAMPLE_MAX_IN (1152)
+#define RESAMPLE_MAX_OUT (RESAMPLE_MAX_IN+RESAMPLE_MAX_IN/256+2)
+
+void resampleInit();
+int resampleBlock(const short *in, int len, short *out, unsigned int step);
+
+#endif
@@ -1,13 +1,25 @@
 #ifndef _SPIRAM_FIFO_H_
 #define _SPIRAM_FIFO_H_
 
+#include "playerconfig.h"
+
+//Largest contiguous span spiRamFifoPeek will return. 2106 bytes is enough for one mp3 frame.
+#define SPIRAM_FIFO_MAXSPAN (2106)
+
 int spiRamFifoInit();
 void spiRamFifoRead(char *buff, int len);
 void spiRamFifoWrite(char *buff, int len);
 int spiRamFifoFill();
+int spiRamFifoWaitFill(int len, int ticks);
 int spiRamFifoFree();
 long spiRamGetOverrunCt();
 long spiRamGetUnderrunCt();
 int spiRamFifoLen();
 
+#ifdef FAKE_SPI_BUFF
+//Zero-copy read access. Only available when the FIFO lives in internal RAM.
+const char *spiRamFifoPeek(int *len);
+void spiRamFifoSkip(int len);
+#endif
+
 #endif
\ No newline at end of file
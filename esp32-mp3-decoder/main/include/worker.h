@@ -0,0 +1,8 @@
+#ifndef _WORKER_H_
+#define _WORKER_H_
+
+struct mad_worker;
+
+struct mad_worker const *workerInit(int core, int prio);
+
+#endif
@@ -0,0 +1,111 @@
+/******************************************************************************
+ * FileName: pcmring.c
+ *
+ * Description: Ring of PCM blocks between the decoder and the output task. The
+ * decoder puts the samples of every frame in a block; the output task converts
+ * them to whatever the I2S port needs and feeds the DMA buffers. Just like the
+ * SPI RAM FIFO, this is lock-free as long as there is exactly one producer and
+ * one consumer thread.
+ *
+*******************************************************************************/
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <stddef.h>
+#include <stdatomic.h>
+
+#include "pcmring.h"
+#include "playerconfig.h"
+
+//Only the consumer moves ringRpos and only the producer moves ringWpos. The positions run from 0 to
+//2*OUTPUT_RING_BLOCKS-1, so a full ring can be told apart from an empty one. The semaphores are only
+//used to sleep when the ring is empty (consumer) or full (producer).
+static struct pcmBlock ring[OUTPUT_RING_BLOCKS];
+static atomic_int ringRpos;
+static atomic_int ringWpos;
+static atomic_int readerWaiting;
+static atomic_int writerWaiting;
+static xSemaphoreHandle semCanRead;
+static xSemaphoreHandle semCanWrite;
+static volatile long ringUdrCnt;
+
+//Amount of blocks between two ring positions
+static inline int ringDist(int from, int to) {
+	int d=to-from;
+	if (d<0) d+=2*OUTPUT_RING_BLOCKS;
+	return d;
+}
+
+static inline int ringNext(int pos) {
+	pos++;
+	if (pos>=2*OUTPUT_RING_BLOCKS) pos=0;
+	return pos;
+}
+
+static inline struct pcmBlock *ringBlock(int pos) {
+	if (pos>=OUTPUT_RING_BLOCKS) pos-=OUTPUT_RING_BLOCKS;
+	return &ring[pos];
+}
+
+int pcmRingInit() {
+	atomic_store(&ringRpos, 0);
+	atomic_store(&ringWpos, 0);
+	atomic_store(&readerWaiting, 0);
+	atomic_store(&writerWaiting, 0);
+	ringUdrCnt=0;
+	vSemaphoreCreateBinary(semCanRead);
+	vSemaphoreCreateBinary(semCanWrite);
+	if (semCanRead==NULL || semCanWrite==NULL) return 0;
+	xSemaphoreTake(semCanRead, 0);
+	xSemaphoreTake(semCanWrite, 0);
+	return 1;
+}
+
+//Get the next free block to write samples into. Blocks while the ring is full. The block goes to
+//the output task when it's committed using pcmRingCommit.
+struct pcmBlock *pcmRingBorrow() {
+	int wpos=atomic_load_explicit(&ringWpos, memory_order_relaxed);
+	while (ringDist(atomic_load_explicit(&ringRpos, memory_order_acquire), wpos)==OUTPUT_RING_BLOCKS) {
+		atomic_store(&writerWaiting, 1);
+		if (ringDist(atomic_load(&ringRpos), wpos)==OUTPUT_RING_BLOCKS) xSemaphoreTake(semCanWrite, portMAX_DELAY);
+		atomic_store(&writerWaiting, 0);
+	}
+	return ringBlock(wpos);
+}
+
+void pcmRingCommit() {
+	int wpos=atomic_load_explicit(&ringWpos, memory_order_relaxed);
+	atomic_store(&ringWpos, ringNext(wpos));
+	if (atomic_load(&readerWaiting)) xSemaphoreGive(semCanRead);
+}
+
+//Get the oldest block with samples. Blocks while the ring is empty. Hand it back using
+//pcmRingRelease when done with it.
+struct pcmBlock *pcmRingPeek() {
+	int rpos=atomic_load_explicit(&ringRpos, memory_order_relaxed);
+	if (ringDist(rpos, atomic_load_explicit(&ringWpos, memory_order_acquire))==0) {
+		//Nothing decoded in time. The DMA will run dry if this keeps up.
+		ringUdrCnt++;
+		do {
+			atomic_store(&readerWaiting, 1);
+			if (ringDist(rpos, atomic_load(&ringWpos))==0) xSemaphoreTake(semCanRead, portMAX_DELAY);
+			atomic_store(&readerWaiting, 0);
+		} while (ringDist(rpos, atomic_load_explicit(&ringWpos, memory_order_acquire))==0);
+	}
+	return ringBlock(rpos);
+}
+
+void pcmRingRelease() {
+	int rpos=atomic_load_explicit(&ringRpos, memory_order_relaxed);
+	atomic_store(&ringRpos, ringNext(rpos));
+	if (atomic_load(&writerWaiting)) xSemaphoreGive(semCanWrite);
+}
+
+//Amount of blocks waiting for the output task
+int pcmRingFill() {
+	return ringDist(atomic_load_explicit(&ringRpos, memory_order_acquire),
+			atomic_load_explicit(&ringWpos, memory_order_acquire));
+}
+
+long pcmRingGetUnderrunCt() {
+	return ringUdrCnt;
+}
@@ -0,0 +1,70 @@
+/******************************************************************************
+ * FileName: pipeline.c
+ *
+ * Description: Frame pipeline between the mp3 decode task and the synthesis
+ * task, so both can run at the same time on different cores. It's a ring of
+ * mad_frame structs, handed back and forth through two queues: one with empty
+ * frames for the decoder to fill, one with decoded frames for the synthesis.
+ * Only plain FreeRTOS queues are used, so this also runs on the FreeRTOS POSIX
+ * port.
+ *
+*******************************************************************************/
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include <stdlib.h>
+
+#include "mad.h"
+#include "pipeline.h"
+
+//Queue with frames that can be decoded into
+static xQueueHandle freeQueue;
+//Queue with decoded frames, in stream order, waiting to be synthesized
+static xQueueHandle decodedQueue;
+
+
+//Set up the pipeline for decoder context dec. Its own frame is used as one of the pipeline frames,
+//the rest is allocated. All frames share the Layer III overlap buffers of the context; only the
+//decode task uses those. Returns 0 when out of memory.
+int pipelineInit(struct sync_t *dec) {
+	struct mad_frame *frame;
+	int i;
+
+	freeQueue=xQueueCreate(PIPELINE_FRAMES, sizeof(struct mad_frame*));
+	decodedQueue=xQueueCreate(PIPELINE_FRAMES, sizeof(struct mad_frame*));
+	if (freeQueue==NULL || decodedQueue==NULL) return 0;
+
+	frame=&dec->frame;
+	xQueueSend(freeQueue, &frame, portMAX_DELAY);
+	for (i=1; i<PIPELINE_FRAMES; i++) {
+		frame=malloc(sizeof(struct mad_frame));
+		if (frame==NULL) return 0;
+		mad_frame_init(frame);
+		frame->overlap=dec->frame.overlap;
+		xQueueSend(freeQueue, &frame, portMAX_DELAY);
+	}
+	return 1;
+}
+
+//Get an empty frame to decode into. Blocks until the synthesis has released one.
+struct mad_frame *pipelineGetFree() {
+	struct mad_frame *frame;
+	xQueueReceive(freeQueue, &frame, portMAX_DELAY);
+	return frame;
+}
+
+//Hand a decoded frame over to the synthesis task.
+void pipelinePutDecoded(struct mad_frame *frame) {
+	xQueueSend(decodedQueue, &frame, portMAX_DELAY);
+}
+
+//Get the next decoded frame. Blocks until the decoder has one ready.
+struct mad_frame *pipelineGetDecoded() {
+	struct mad_frame *frame;
+	xQueueReceive(decodedQueue, &frame, portMAX_DELAY);
+	return frame;
+}
+
+//Give a synthesized frame back to the decoder.
+void pipelinePutFree(struct mad_frame *frame) {
+	xQueueSend(freeQueue, &frame, portMAX_DELAY);
+}
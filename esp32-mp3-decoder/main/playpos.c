@@ -0,0 +1,93 @@
+/******************************************************************************
+ * FileName: playpos.c
+ *
+ * Description: Playback position. Every block of samples that goes to the I2S
+ * port is remembered together with the stream time it starts at and how much
+ * stream time it covers (the frame durations from the mp3 headers). Matching
+ * that against the amount of samples the I2S port has actually sent gives the
+ * stream time that's audible right now: the time of the last decoded frame
+ * minus whatever is still queued in the output. Resampling, rate conversion
+ * and inserted silence are all taken care of this way, because the blocks
+ * are counted in the samples that really went to the DMA buffers.
+ *
+*******************************************************************************/
+#include <stdint.h>
+#include <stdatomic.h>
+
+#include "playpos.h"
+#include "i2s_freertos.h"
+
+struct playPosBlock {
+	unsigned int start;		//i2sGetSamplesWritten() before the first sample of the block
+	unsigned int end;		//i2sGetSamplesWritten() after the last sample of the block
+	mad_timer_t time;		//Stream time at the start of the block
+	mad_timer_t duration;	//Stream time the block covers; 0 for silence that isn't part of the stream
+};
+
+//Ring of the most recent blocks. Only the output thread writes it; it makes blockSeq odd while it's
+//busy, so a reader in another thread can see it has to try again.
+static struct playPosBlock blocks[PLAYPOS_BLOCKS];
+static int blockHead;
+static int blockCnt;
+static atomic_uint blockSeq;
+
+void playPosInit() {
+	blockHead=0;
+	blockCnt=0;
+	atomic_store(&blockSeq, 0);
+}
+
+//Remember a block that has just been written to the I2S port. Call from the thread that writes to it.
+void playPosAddBlock(unsigned int start, unsigned int end, mad_timer_t time, mad_timer_t duration) {
+	unsigned int seq=atomic_load_explicit(&blockSeq, memory_order_relaxed);
+	atomic_store_explicit(&blockSeq, seq+1, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+	blocks[blockHead].start=start;
+	blocks[blockHead].end=end;
+	blocks[blockHead].time=time;
+	blocks[blockHead].duration=duration;
+	blockHead=(blockHead+1)%PLAYPOS_BLOCKS;
+	if (blockCnt<PLAYPOS_BLOCKS) blockCnt++;
+	atomic_store_explicit(&blockSeq, seq+2, memory_order_release);
+}
+
+//Get the stream time of the sample that's coming out of the I2S port right now. Returns 0 if that
+//isn't known, e.g. because nothing has been played yet.
+int playPosGet(mad_timer_t *time) {
+	unsigned int pos=i2sGetSamplesConsumed();
+	unsigned int seq, off, len;
+	struct playPosBlock b;
+	mad_timer_t part;
+	uint64_t frac;
+	int i, n, found;
+	do {
+		seq=atomic_load_explicit(&blockSeq, memory_order_acquire);
+		//Find the newest block that starts at or before the position.
+		found=0;
+		i=blockHead;
+		for (n=0; n<blockCnt; n++) {
+			i=(i+PLAYPOS_BLOCKS-1)%PLAYPOS_BLOCKS;
+			if ((int)(pos-blocks[i].start)>=0) {
+				b=blocks[i];
+				found=1;
+				break;
+			}
+		}
+		atomic_thread_fence(memory_order_acquire);
+	} while ((seq&1) || atomic_load_explicit(&blockSeq, memory_order_relaxed)!=seq);
+	if (!found) return 0;
+
+	*time=b.time;
+	off=pos-b.start;
+	len=b.end-b.start;
+	if (off>=len) {
+		//Past the end of the block; whatever is playing now (underrun silence) isn't part of the stream.
+		mad_timer_add(time, b.duration);
+	} else {
+		//Somewhere in the block. Its samples are spread evenly over its duration.
+		frac=((uint64_t)b.duration.seconds*MAD_TIMER_RESOLUTION+b.duration.fraction)*off/len;
+		mad_timer_set(&part, frac/MAD_TIMER_RESOLUTION, frac%MAD_TIMER_RESOLUTION, MAD_TIMER_RESOLUTION);
+		mad_timer_add(time, part);
+	}
+	return 1;
+}
@@ -0,0 +1,186 @@
+/******************************************************************************
+ * FileName: quality.c
+ *
+ * Description: Adaptive decode quality. Keeps track of how much of the real-time
+ * budget decoding a frame takes and how much audio is still queued up for the
+ * I2S DMA engine, and steps down to cheaper libmad decode modes when the CPU
+ * can't keep up. When there is headroom again for long enough, it steps back up.
+ *
+*******************************************************************************/
+#include "freertos/FreeRTOS.h"
+#include "xtensa/hal.h"
+#include "sdkconfig.h"
+
+#include "mad.h"
+#include "i2s_freertos.h"
+#include "quality.h"
+#include "playerconfig.h"
+
+//libmad options for every quality level. The subband caps limit the audio bandwidth to about
+//13.8KHz and 11KHz (for a 44.1KHz stream). Decoding only the left channel skips the Layer III
+//work of the right channel of stereo streams. Half sample rate synthesis halves the work of the
+//synthesis filterbank; with 16 subbands there is nothing left above the new Nyquist frequency.
+static const int qualityOpts[QUALITY_LEVELS]={
+	0,
+	MAD_OPTION_SUBBANDS(20),
+	MAD_OPTION_SUBBANDS(16),
+	MAD_OPTION_SUBBANDS(16)|MAD_OPTION_LEFTCHANNEL,
+	MAD_OPTION_SUBBANDS(16)|MAD_OPTION_LEFTCHANNEL|MAD_OPTION_HALFSAMPLERATE
+};
+
+//Rough decode cost of every quality level, relative to full quality. Used to predict the load at the
+//level above the current one. For joint stereo streams, decoding one channel saves less than this.
+static const int qualityCost[QUALITY_LEVELS]={100, 85, 80, 60, 45};
+
+//Cheapest level we step down to. The half sample rate level changes the rate of the PCM, and unless
+//the I2S port runs at a fixed rate, that retunes the I2S clock under the buffers that are already
+//queued, which then play at the wrong speed. So without FIXED_OUTPUT_RATE the ladder ends at the
+//left channel level.
+#ifdef FIXED_OUTPUT_RATE
+#define QUALITY_MAX_LEVEL (QUALITY_LEVELS-1)
+#else
+#define QUALITY_MAX_LEVEL (QUALITY_LEVELS-2)
+#endif
+
+//Average decode load, in percent of the real-time budget, above which we step down a level
+#define QUALITY_LOAD_HIGH (90)
+//Same, but for when the DMA queue is running low or has underrun
+#define QUALITY_LOAD_MID (75)
+//Predicted average load at the next better level below which we consider stepping back up
+#define QUALITY_LOAD_UP (75)
+//The DMA queue is running low if more than this amount of buffers is waiting to be filled
+#define QUALITY_DMA_LOW ((I2SDMABUFCNT-1)/2)
+//Frames to wait after a level change before stepping down again, so the average can settle
+#define QUALITY_HOLD_DOWN (16)
+//Frames with headroom needed before stepping up. This doubles every time a step up has to be
+//undone before it has lasted that long, up to QUALITY_HOLD_UP_MAX.
+#define QUALITY_HOLD_UP (200)
+#define QUALITY_HOLD_UP_MAX (16*QUALITY_HOLD_UP)
+
+static int level;
+static int loadAvg;			//Average load in percent, 4 fractional bits
+static int sinceChange;		//Frames since the last level change
+static int headroomCt;		//Consecutive frames with headroom
+static int holdUp;
+static int lastWasUp;
+static long stepDownCt, stepUpCt;
+static long lastUdrCt;
+static unsigned int frameStart, idleCycles;
+static volatile unsigned int decodeCycles;
+static volatile int options;
+
+
+void qualityInit() {
+	level=0;
+	loadAvg=0;
+	sinceChange=0;
+	headroomCt=0;
+	holdUp=QUALITY_HOLD_UP;
+	lastWasUp=0;
+	stepDownCt=0;
+	stepUpCt=0;
+	lastUdrCt=i2sGetUnderrunCnt();
+	decodeCycles=0;
+	options=qualityOpts[0];
+}
+
+//Call this right before decoding a frame.
+void qualityFrameStart() {
+	frameStart=xthal_get_ccount();
+	idleCycles=0;
+}
+
+//Tell the controller about time spent blocked (e.g. waiting for a free DMA buffer) while
+//decoding the current frame. This does not count as decode load.
+void qualityAddIdle(unsigned int cycles) {
+	idleCycles+=cycles;
+}
+
+//Call this after a frame has been decoded and output, with the amount of samples and the sample
+//rate of its PCM. Returns the libmad options to decode the next frame with.
+int qualityFrameEnd(int samples, int rate) {
+	unsigned int busy, budget;
+	int load, upLoad, dmaLow, udr;
+	long udrCt;
+
+	if (samples==0 || rate==0) return qualityOpts[level];
+
+	busy=xthal_get_ccount()-frameStart-idleCycles;
+	//With the dual-core pipeline, the slowest of the two stages is what limits us.
+	if (decodeCycles>busy) busy=decodeCycles;
+	budget=(unsigned int)((long long)samples*CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ*1000000/rate);
+	load=(int)((long long)busy*100/budget);
+	if (load>400) load=400;
+	loadAvg+=(load*16-loadAvg)/8;
+
+	dmaLow=(i2sGetFreeBufCnt()>QUALITY_DMA_LOW);
+	udrCt=i2sGetUnderrunCnt();
+	udr=(udrCt!=lastUdrCt);
+	lastUdrCt=udrCt;
+
+	sinceChange++;
+	//A step up that lasted long enough resets the wait before the next one.
+	if (lastWasUp && sinceChange>=holdUp) {
+		holdUp=QUALITY_HOLD_UP;
+		lastWasUp=0;
+	}
+
+	if (loadAvg>QUALITY_LOAD_HIGH*16 || ((dmaLow || udr) && loadAvg>QUALITY_LOAD_MID*16)) {
+		headroomCt=0;
+		if (level<QUALITY_MAX_LEVEL && sinceChange>=QUALITY_HOLD_DOWN) {
+			if (lastWasUp) {
+				//We stepped up too early. Wait longer before trying again.
+				holdUp*=2;
+				if (holdUp>QUALITY_HOLD_UP_MAX) holdUp=QUALITY_HOLD_UP_MAX;
+			}
+			level++;
+			stepDownCt++;
+			sinceChange=0;
+			lastWasUp=0;
+		}
+	} else if (level>0 && !dmaLow) {
+		upLoad=loadAvg*qualityCost[level-1]/qualityCost[level];
+		if (upLoad<QUALITY_LOAD_UP*16) headroomCt++; else headroomCt=0;
+		if (headroomCt>=holdUp) {
+			level--;
+			stepUpCt++;
+			sinceChange=0;
+			headroomCt=0;
+			lastWasUp=1;
+		}
+	} else {
+		headroomCt=0;
+	}
+
+	options=qualityOpts[level];
+	return options;
+}
+
+//With the dual-core pipeline, frames are decoded on the other core while this one runs the synthesis
+//and only the synthesis is timed between qualityFrameStart and qualityFrameEnd. The decode task reports
+//the cycles it took to decode a frame here.
+void qualityDecodeCycles(unsigned int cycles) {
+	decodeCycles=cycles;
+}
+
+//Returns the libmad options of the current level, for a decode task that doesn't call qualityFrameEnd.
+int qualityGetOptions() {
+	return options;
+}
+
+int qualityGetLevel() {
+	return level;
+}
+
+//Returns the average decode load, in percent of the real-time budget
+int qualityGetLoad() {
+	return loadAvg/16;
+}
+
+long qualityGetStepDownCt() {
+	return stepDownCt;
+}
+
+long qualityGetStepUpCt() {
+	return stepUpCt;
+}
@@ -0,0 +1,204 @@
+/******************************************************************************
+ * FileName: rateconv.c
+ *
+ * Description: Sample rate converter for a fixed output rate. MPEG audio comes
+ * in 9 sample rates from 8 to 48KHz; instead of retuning the I2S clock for
+ * every one of them, this converts whatever comes in to one output rate. It's
+ * a polyphase FIR: a Kaiser-windowed sinc, tabulated in 64 phases, with linear
+ * interpolation between the phases for the positions in between. The step can
+ * also include the clock drift correction, so both happen in the same pass.
+ *
+ * Working out the coefficients takes a few thousand Bessel functions and sines,
+ * too much to do in the output path when the input rate changes. The tables
+ * for the output rates FIXED_OUTPUT_RATE is meant for (44100 and 48000) are
+ * precomputed in rateconv_tab.h, so a rate change just picks one. To
+ * regenerate it:
+ *   gcc -DRATECONV_GENTAB -Iinclude rateconv.c -lm -o gentab && ./gentab > rateconv_tab.h
+ *
+*******************************************************************************/
+#include <stdint.h>
+#include <string.h>
+
+#include "rateconv.h"
+
+//Taps per output sample. More taps give a steeper filter, but cost 2 multiplies each per output sample.
+#define RC_TAPS (32)
+//Amount of phases in the coefficient table, as a power of 2
+#define RC_PHASE_BITS (6)
+#define RC_PHASES (1<<RC_PHASE_BITS)
+//Kaiser window parameter. 7 gives about 70dB of stopband attenuation.
+#define RC_KAISER_BETA (7.0f)
+//Cutoff of the filter, as a fraction of the lower of the input and output sample rate. The filter
+//is -6dB here; it's fully closed a bit above the Nyquist frequency.
+#define RC_CUTOFF (0.45f)
+
+//Coefficients for one cutoff, 2.14 fixed point. Row p is for an output sample p/RC_PHASES of the way
+//from input sample RC_TAPS/2-1 to RC_TAPS/2 of the window; the extra row is for the way all the way
+//there. The cutoff is RC_CUTOFF*num/den: 1/1 when upsampling, outRate/inRate when downsampling.
+struct rcCoefTab {
+	int num, den;
+	short coef[RC_PHASES+1][RC_TAPS];
+};
+
+#ifndef RATECONV_GENTAB
+#include "rateconv_tab.h"
+
+#define RC_TABCNT ((int)(sizeof(rcCoefTab)/sizeof(rcCoefTab[0])))
+
+//Coefficients in use
+static const short (*coef)[RC_TAPS];
+//Input samples: the last RC_TAPS-1 samples of the previous block, followed by the current block.
+static short wbuf[RC_TAPS-1+RATECONV_MAX_IN];
+//Start of the window of the next output sample in wbuf, and the 0.24 fraction on top of that
+static int pos;
+static unsigned int frac;
+static int outRate;
+static int inRate;
+static unsigned int inStep;
+
+//Start converting to the given output sample rate.
+void rateConvInit(int rate) {
+	outRate=rate;
+	inRate=0;
+	inStep=1<<24;
+	memset(wbuf, 0, sizeof(wbuf));
+	pos=0;
+	frac=0;
+	coef=rcCoefTab[0].coef;
+}
+
+//Set the sample rate of the input. Returns the resampler step for it: the amount of input samples
+//to advance per output sample, as an 8.24 fixed-point number. Only does real work if the rate
+//actually changed.
+unsigned int rateConvSetRate(int rate) {
+	int i, best=0;
+	if (rate==inRate) return inStep;
+	inRate=rate;
+	inStep=(unsigned int)(((uint64_t)rate<<24)/outRate);
+	//Upsampling: keep out the images above the input Nyquist frequency. Downsampling: keep out
+	//everything that would alias around the output Nyquist frequency. For an output rate the table
+	//wasn't made for, that takes the table with the highest cutoff below the one we need; if there's
+	//none, it's the upsampling one.
+	if (rate>outRate) {
+		for (i=1; i<RC_TABCNT; i++) {
+			if ((int64_t)rcCoefTab[i].num*rate>(int64_t)rcCoefTab[i].den*outRate) continue;
+			if (best==0 || (int64_t)rcCoefTab[i].num*rcCoefTab[best].den>(int64_t)rcCoefTab[best].num*rcCoefTab[i].den) best=i;
+		}
+	}
+	coef=rcCoefTab[best].coef;
+	return inStep;
+}
+
+//Largest amount of input samples that's guaranteed not to give more than RATECONV_MAX_OUT output
+//samples at the given step.
+int rateConvMaxIn(unsigned int step) {
+	uint64_t n=((uint64_t)(RATECONV_MAX_OUT-2)*step)>>24;
+	return (n>RATECONV_MAX_IN)?RATECONV_MAX_IN:(int)n;
+}
+
+//Convert a block of len (at most rateConvMaxIn(step)) samples into out. Returns the amount of
+//output samples.
+int rateConvBlock(const short *in, int len, short *out, unsigned int step) {
+	int n=0;
+	int k, a, b, y;
+	const short *x, *h0, *h1;
+	memcpy(wbuf+RC_TAPS-1, in, len*sizeof(short));
+	while (pos<len) {
+		x=wbuf+pos;
+		h0=coef[frac>>(24-RC_PHASE_BITS)];
+		h1=h0+RC_TAPS;
+		a=0;
+		b=0;
+		for (k=0; k<RC_TAPS; k++) {
+			a+=h0[k]*x[k];
+			b+=h1[k]*x[k];
+		}
+		//Interpolate between the two phases with the 16 fraction bits below the phase bits
+		y=a+(int)(((int64_t)(b-a)*((frac>>(8-RC_PHASE_BITS))&0xffff))>>16);
+		y=(y+(1<<13))>>14;
+		if (y>32767) y=32767;
+		if (y<-32768) y=-32768;
+		out[n++]=y;
+
+		frac+=step;
+		pos+=frac>>24;
+		frac&=0xffffff;
+	}
+	pos-=len;
+	//Keep the last RC_TAPS-1 input samples for the next block
+	memmove(wbuf, wbuf+len, (RC_TAPS-1)*sizeof(short));
+	return n;
+}
+
+#else
+#include <stdio.h>
+#include <math.h>
+
+//Zeroth order modified Bessel function of the first kind, for the Kaiser window
+static float besselI0(float x) {
+	float sum=1.0f, term=1.0f;
+	int k;
+	for (k=1; k<32; k++) {
+		term*=(x/(2*k))*(x/(2*k));
+		sum+=term;
+		if (term<sum*1e-8f) break;
+	}
+	return sum;
+}
+
+//Fill a coefficient table for a cutoff frequency fc, in cycles per input sample.
+static void makeCoefs(float fc, short coef[RC_PHASES+1][RC_TAPS]) {
+	int p, k, sum;
+	float t, w, h[RC_TAPS], hsum;
+	for (p=0; p<=RC_PHASES; p++) {
+		hsum=0;
+		for (k=0; k<RC_TAPS; k++) {
+			t=(k-(RC_TAPS/2-1))-(float)p/RC_PHASES;
+			w=1.0f-(t/(RC_TAPS/2))*(t/(RC_TAPS/2));
+			w=(w>0)?besselI0(RC_KAISER_BETA*sqrtf(w))/besselI0(RC_KAISER_BETA):0;
+			h[k]=(t==0)?(2*fc):(sinf(2*(float)M_PI*fc*t)/((float)M_PI*t));
+			h[k]*=w;
+			hsum+=h[k];
+		}
+		//Normalize every phase to a gain of exactly 1 at DC, so a constant input stays constant.
+		sum=0;
+		for (k=0; k<RC_TAPS; k++) {
+			coef[p][k]=(short)lrintf(h[k]*(1<<14)/hsum);
+			sum+=coef[p][k];
+		}
+		coef[p][RC_TAPS/2-1+(p>=RC_PHASES/2)]+=(1<<14)-sum;
+	}
+}
+
+static void printTab(int num, int den) {
+	static short coef[RC_PHASES+1][RC_TAPS];
+	int p, k;
+	makeCoefs(RC_CUTOFF*num/den, coef);
+	printf("\t{%d, %d, {\n", num, den);
+	for (p=0; p<=RC_PHASES; p++) {
+		printf("\t\t{");
+		for (k=0; k<RC_TAPS; k++) printf("%d%s", coef[p][k], (k<RC_TAPS-1)?", ":"");
+		printf("},\n");
+	}
+	printf("\t}},\n");
+}
+
+//Host-side generator for rateconv_tab.h: the upsampling table first, then one for every MPEG sample
+//rate above each output rate.
+int main() {
+	static const int rates[]={8000, 11025, 12000, 16000, 22050, 24000, 32000, 44100, 48000};
+	static const int outRates[]={44100, 48000};
+	int i, j;
+	printf("//Generated by rateconv.c with -DRATECONV_GENTAB; don't edit by hand.\n");
+	printf("//num, den, coefficients for a cutoff of RC_CUTOFF*num/den\n");
+	printf("static const struct rcCoefTab rcCoefTab[]={\n");
+	printTab(1, 1);
+	for (j=0; j<(int)(sizeof(outRates)/sizeof(outRates[0])); j++) {
+		for (i=0; i<(int)(sizeof(rates)/sizeof(rates[0])); i++) {
+			if (rates[i]>outRates[j]) printTab(outRates[j], rates[i]);
+		}
+	}
+	printf("};\n");
+	return 0;
+}
+#endif
@@ -0,0 +1,138 @@
+//Generated by rateconv.c with -DRATECONV_GENTAB; don't edit by hand.
+//num, den, coefficients for a cutoff of RC_CUTOFF*num/den
+static const struct rcCoefTab rcCoefTab[]={
+	{1, 1, {
+		{-6, 14, -23, 30, -26, 0, 59, -162, 315, -516, 755, -1010, 1254, -1457, 1592, 14746, 1592, -1457, 1254, -1010, 755, -516, 315, -162, 59, 0, -26, 30, -23, 14, -6, 0},
+		{-6, 14, -22, 28, -22, -6, 66, -170, 323, -520, 750, -989, 1205, -1355, 1352, 14740, 1836, -1557, 1301, -1029, 758, -511, 306, -153, 51, 6, -29, 32, -24, 14, -7, 2},
+		{-6, 13, -21, 26, -18, -11, 74, -179, 330, -523, 744, -966, 1154, -1253, 1117, 14726, 2084, -1657, 1347, -1046, 760, -504, 296, -143, 43, 11, -33, 34, -25, 15, -7, 2},
+		{-6, 13, -20, 23, -15, -17, 81, -187, 337, -526, 736, -942, 1101, -1149, 887, 14705, 2337, -1754, 1390, -1062, 760, -497, 286, -133, 35, 17, -36, 36, -26, 15, -7, 2},
+		{-6, 13, -19, 21, -11, -22, 88, -194, 343, -527, 728, -916, 1047, -1046, 663, 14669, 2594, -1850, 1431, -1075, 758, -488, 275, -123, 27, 23, -40, 38, -27, 15, -7, 2},
+		{-6, 12, -18, 19, -7, -27, 94, -201, 348, -527, 717, -889, 992, -941, 444, 14626, 2854, -1944, 1470, -1087, 756, -479, 264, -112, 18, 29, -44, 40, -28, 16, -7, 2},
+		{-6, 12, -17, 17, -4, -32, 101, -207, 352, -525, 706, -860, 935, -837, 230, 14572, 3118, -2036, 1506, -1096, 751, -468, 252, -101, 10, 35, -47, 41, -29, 16, -7, 2},
+		{-6, 11, -16, 15, 0, -37, 107, -213, 356, -523, 693, -829, 877, -733, 23, 14509, 3385, -2125, 1540, -1104, 746, -457, 239, -90, 1, 41, -51, 43, -29, 16, -7, 2},
+		{-5, 11, -15, 13, 3, -42, 112, -219, 359, -520, 679, -798, 819, -629, -179, 14438, 3655, -2212, 1571, -1109, 738, -444, 225, -78, -8, 47, -54, 45, -30, 16, -7, 2},
+		{-5, 10, -14, 11, 6, -47, 118, -224, 361, -516, 664, -765, 759, -526, -375, 14360, 3927, -2296, 1600, -1112, 729, -430, 211, -66, -17, 52, -57, 46, -31, 16, -7, 2},
+		{-5, 10, -13, 9, 10, -51, 123, -228, 363, -511, 648, -731, 698, -423, -564, 14267, 4202, -2377, 1626, -1114, 719, -416, 197, -54, -26, 58, -61, 48, -31, 16, -7, 2},
+		{-5, 9, -11, 7, 13, -56, 128, -232, 363, -505, 630, -696, 637, -321, -748, 14166, 4479, -2454, 1649, -1112, 707, -400, 182, -41, -35, 64, -64, 50, -32, 17, -7, 2},
+		{-5, 9, -10, 4, 16, -60, 132, -236, 363, -498, 612, -660, 576, -220, -925, 14060, 4758, -2529, 1669, -1109, 693, -383, 166, -29, -44, 70, -67, 51, -32, 17, -7, 2},
+		{-4, 8, -9, 2, 19, -64, 137, -239, 363, -490, 592, -623, 514, -120, -1095, 13941, 5039, -2599, 1685, -1103, 678, -366, 150, -16, -53, 76, -70, 52, -33, 17, -7, 2},
+		{-4, 8, -8, 0, 22, -68, 141, -241, 361, -482, 572, -586, 452, -22, -1258, 13815, 5321, -2666, 1699, -1096, 661, -347, 133, -3, -62, 81, -73, 54, -33, 17, -6, 2},
+		{-4, 7, -7, -2, 25, -71, 144, -243, 359, -472, 550, -547, 390, 75, -1415, 13679, 5604, -2729, 1710, -1085, 643, -328, 116, 10, -71, 87, -76, 55, -33, 17, -6, 2},
+		{-4, 6, -6, -3, 28, -75, 147, -245, 356, -462, 528, -508, 327, 171, -1565, 13539, 5887, -2787, 1717, -1073, 624, -308, 99, 24, -80, 92, -79, 56, -33, 16, -6, 1},
+		{-4, 6, -5, -5, 31, -78, 150, -246, 353, -450, 505, -469, 265, 264, -1709, 13389, 6171, -2842, 1721, -1058, 603, -287, 81, 37, -89, 97, -81, 57, -34, 16, -6, 1},
+		{-3, 5, -4, -7, 33, -81, 153, -246, 349, -438, 481, -428, 203, 355, -1845, 13228, 6455, -2891, 1722, -1041, 580, -265, 63, 50, -98, 103, -84, 58, -34, 16, -6, 1},
+		{-3, 5, -2, -9, 36, -84, 155, -246, 344, -426, 457, -388, 142, 445, -1974, 13058, 6739, -2936, 1719, -1022, 557, -242, 44, 64, -107, 108, -86, 59, -34, 16, -6, 1},
+		{-3, 4, -1, -11, 38, -87, 157, -246, 338, -412, 432, -347, 81, 532, -2096, 12888, 7022, -2976, 1713, -1001, 531, -219, 25, 78, -116, 112, -89, 59, -34, 16, -5, 1},
+		{-3, 4, 0, -13, 41, -89, 159, -245, 332, -398, 406, -306, 20, 617, -2211, 12703, 7305, -3011, 1703, -977, 505, -195, 6, 91, -124, 117, -91, 60, -33, 15, -5, 1},
+		{-3, 3, 1, -14, 43, -91, 160, -243, 326, -383, 380, -265, -40, 699, -2319, 12513, 7586, -3040, 1690, -951, 477, -171, -13, 105, -133, 122, -93, 60, -33, 15, -5, 1},
+		{-2, 3, 2, -16, 45, -93, 161, -241, 319, -368, 353, -223, -99, 779, -2420, 12313, 7866, -3064, 1673, -923, 448, -145, -32, 118, -141, 126, -94, 61, -33, 15, -5, 1},
+		{-2, 2, 3, -17, 47, -95, 162, -239, 311, -352, 326, -182, -157, 856, -2514, 12112, 8144, -3082, 1653, -893, 418, -120, -52, 131, -149, 130, -96, 61, -33, 14, -4, 1},
+		{-2, 2, 4, -19, 49, -97, 162, -236, 303, -336, 298, -140, -214, 930, -2600, 11901, 8420, -3095, 1629, -861, 387, -94, -72, 145, -157, 134, -97, 61, -32, 14, -4, 1},
+		{-2, 1, 5, -20, 50, -98, 162, -233, 294, -319, 270, -99, -270, 1001, -2680, 11688, 8694, -3102, 1601, -826, 354, -67, -91, 158, -164, 138, -99, 61, -32, 13, -4, 0},
+		{-2, 1, 5, -22, 52, -99, 161, -229, 285, -301, 242, -58, -325, 1069, -2752, 11464, 8965, -3102, 1570, -790, 321, -40, -111, 171, -172, 141, -100, 61, -31, 13, -3, 0},
+		{-1, 0, 6, -23, 53, -100, 161, -225, 275, -283, 214, -18, -379, 1134, -2818, 11239, 9233, -3097, 1536, -751, 286, -12, -131, 183, -179, 144, -101, 60, -31, 12, -3, 0},
+		{-1, 0, 7, -24, 55, -101, 160, -220, 265, -265, 186, 22, -431, 1196, -2877, 11001, 9498, -3085, 1498, -711, 251, 15, -150, 196, -186, 147, -101, 60, -30, 12, -3, 0},
+		{-1, -1, 8, -25, 56, -102, 158, -215, 254, -247, 157, 62, -482, 1255, -2928, 10764, 9759, -3067, 1456, -668, 215, 43, -170, 208, -192, 150, -102, 59, -29, 11, -2, 0},
+		{-1, -1, 9, -26, 57, -102, 157, -210, 243, -228, 129, 101, -531, 1310, -2973, 10517, 10017, -3042, 1411, -624, 178, 72, -190, 220, -199, 153, -102, 59, -28, 10, -2, 0},
+		{-1, -2, 10, -27, 58, -102, 155, -205, 232, -209, 100, 140, -578, 1362, -3011, 10270, 10270, -3011, 1362, -578, 140, 100, -209, 232, -205, 155, -102, 58, -27, 10, -2, -1},
+		{0, -2, 10, -28, 59, -102, 153, -199, 220, -190, 72, 178, -624, 1411, -3042, 10017, 10517, -2973, 1310, -531, 101, 129, -228, 243, -210, 157, -102, 57, -26, 9, -1, -1},
+		{0, -2, 11, -29, 59, -102, 150, -192, 208, -170, 43, 215, -668, 1456, -3067, 9759, 10764, -2928, 1255, -482, 62, 157, -247, 254, -215, 158, -102, 56, -25, 8, -1, -1},
+		{0, -3, 12, -30, 60, -101, 147, -186, 196, -150, 15, 251, -711, 1498, -3085, 9498, 11001, -2877, 1196, -431, 22, 186, -265, 265, -220, 160, -101, 55, -24, 7, 0, -1},
+		{0, -3, 12, -31, 60, -101, 144, -179, 183, -131, -12, 286, -751, 1536, -3097, 9233, 11239, -2818, 1134, -379, -18, 214, -283, 275, -225, 161, -100, 53, -23, 6, 0, -1},
+		{0, -3, 13, -31, 61, -100, 141, -172, 171, -111, -40, 321, -790, 1570, -3102, 8965, 11464, -2752, 1069, -325, -58, 242, -301, 285, -229, 161, -99, 52, -22, 5, 1, -2},
+		{0, -4, 13, -32, 61, -99, 138, -164, 158, -91, -67, 354, -826, 1601, -3102, 8694, 11688, -2680, 1001, -270, -99, 270, -319, 294, -233, 162, -98, 50, -20, 5, 1, -2},
+		{1, -4, 14, -32, 61, -97, 134, -157, 145, -72, -94, 387, -861, 1629, -3095, 8420, 11901, -2600, 930, -214, -140, 298, -336, 303, -236, 162, -97, 49, -19, 4, 2, -2},
+		{1, -4, 14, -33, 61, -96, 130, -149, 131, -52, -120, 418, -893, 1653, -3082, 8144, 12112, -2514, 856, -157, -182, 326, -352, 311, -239, 162, -95, 47, -17, 3, 2, -2},
+		{1, -5, 15, -33, 61, -94, 126, -141, 118, -32, -145, 448, -923, 1673, -3064, 7866, 12313, -2420, 779, -99, -223, 353, -368, 319, -241, 161, -93, 45, -16, 2, 3, -2},
+		{1, -5, 15, -33, 60, -93, 122, -133, 105, -13, -171, 477, -951, 1690, -3040, 7586, 12513, -2319, 699, -40, -265, 380, -383, 326, -243, 160, -91, 43, -14, 1, 3, -3},
+		{1, -5, 15, -33, 60, -91, 117, -124, 91, 6, -195, 505, -977, 1703, -3011, 7305, 12703, -2211, 617, 20, -306, 406, -398, 332, -245, 159, -89, 41, -13, 0, 4, -3},
+		{1, -5, 16, -34, 59, -89, 112, -116, 78, 25, -219, 531, -1001, 1713, -2976, 7022, 12888, -2096, 532, 81, -347, 432, -412, 338, -246, 157, -87, 38, -11, -1, 4, -3},
+		{1, -6, 16, -34, 59, -86, 108, -107, 64, 44, -242, 557, -1022, 1719, -2936, 6739, 13058, -1974, 445, 142, -388, 457, -426, 344, -246, 155, -84, 36, -9, -2, 5, -3},
+		{1, -6, 16, -34, 58, -84, 103, -98, 50, 63, -265, 580, -1041, 1722, -2891, 6455, 13228, -1845, 355, 203, -428, 481, -438, 349, -246, 153, -81, 33, -7, -4, 5, -3},
+		{1, -6, 16, -34, 57, -81, 97, -89, 37, 81, -287, 603, -1058, 1721, -2842, 6171, 13389, -1709, 264, 265, -469, 505, -450, 353, -246, 150, -78, 31, -5, -5, 6, -4},
+		{1, -6, 16, -33, 56, -79, 92, -80, 24, 99, -308, 624, -1073, 1717, -2787, 5887, 13539, -1565, 171, 327, -508, 528, -462, 356, -245, 147, -75, 28, -3, -6, 6, -4},
+		{2, -6, 17, -33, 55, -76, 87, -71, 10, 116, -328, 643, -1085, 1710, -2729, 5604, 13679, -1415, 75, 390, -547, 550, -472, 359, -243, 144, -71, 25, -2, -7, 7, -4},
+		{2, -6, 17, -33, 54, -73, 81, -62, -3, 133, -347, 661, -1096, 1699, -2666, 5321, 13815, -1258, -22, 452, -586, 572, -482, 361, -241, 141, -68, 22, 0, -8, 8, -4},
+		{2, -7, 17, -33, 52, -70, 76, -53, -16, 150, -366, 678, -1103, 1685, -2599, 5039, 13941, -1095, -120, 514, -623, 592, -490, 363, -239, 137, -64, 19, 2, -9, 8, -4},
+		{2, -7, 17, -32, 51, -67, 70, -44, -29, 166, -383, 693, -1109, 1669, -2529, 4758, 14060, -925, -220, 576, -660, 612, -498, 363, -236, 132, -60, 16, 4, -10, 9, -5},
+		{2, -7, 17, -32, 50, -64, 64, -35, -41, 182, -400, 707, -1112, 1649, -2454, 4479, 14166, -748, -321, 637, -696, 630, -505, 363, -232, 128, -56, 13, 7, -11, 9, -5},
+		{2, -7, 16, -31, 48, -61, 58, -26, -54, 197, -416, 719, -1114, 1626, -2377, 4202, 14267, -564, -423, 698, -731, 648, -511, 363, -228, 123, -51, 10, 9, -13, 10, -5},
+		{2, -7, 16, -31, 46, -57, 52, -17, -66, 211, -430, 729, -1112, 1600, -2296, 3927, 14360, -375, -526, 759, -765, 664, -516, 361, -224, 118, -47, 6, 11, -14, 10, -5},
+		{2, -7, 16, -30, 45, -54, 47, -8, -78, 225, -444, 738, -1109, 1571, -2212, 3655, 14438, -179, -629, 819, -798, 679, -520, 359, -219, 112, -42, 3, 13, -15, 11, -5},
+		{2, -7, 16, -29, 43, -51, 41, 1, -90, 239, -457, 746, -1104, 1540, -2125, 3385, 14509, 23, -733, 877, -829, 693, -523, 356, -213, 107, -37, 0, 15, -16, 11, -6},
+		{2, -7, 16, -29, 41, -47, 35, 10, -101, 252, -468, 751, -1096, 1506, -2036, 3118, 14572, 230, -837, 935, -860, 706, -525, 352, -207, 101, -32, -4, 17, -17, 12, -6},
+		{2, -7, 16, -28, 40, -44, 29, 18, -112, 264, -479, 756, -1087, 1470, -1944, 2854, 14626, 444, -941, 992, -889, 717, -527, 348, -201, 94, -27, -7, 19, -18, 12, -6},
+		{2, -7, 15, -27, 38, -40, 23, 27, -123, 275, -488, 758, -1075, 1431, -1850, 2594, 14669, 663, -1046, 1047, -916, 728, -527, 343, -194, 88, -22, -11, 21, -19, 13, -6},
+		{2, -7, 15, -26, 36, -36, 17, 35, -133, 286, -497, 760, -1062, 1390, -1754, 2337, 14705, 887, -1149, 1101, -942, 736, -526, 337, -187, 81, -17, -15, 23, -20, 13, -6},
+		{2, -7, 15, -25, 34, -33, 11, 43, -143, 296, -504, 760, -1046, 1347, -1657, 2084, 14726, 1117, -1253, 1154, -966, 744, -523, 330, -179, 74, -11, -18, 26, -21, 13, -6},
+		{2, -7, 14, -24, 32, -29, 6, 51, -153, 306, -511, 758, -1029, 1301, -1557, 1836, 14740, 1352, -1355, 1205, -989, 750, -520, 323, -170, 66, -6, -22, 28, -22, 14, -6},
+		{0, -6, 14, -23, 30, -26, 0, 59, -162, 315, -516, 755, -1010, 1254, -1457, 1592, 14746, 1592, -1457, 1254, -1010, 755, -516, 315, -162, 59, 0, -26, 30, -23, 14, -6},
+	}},
+	{44100, 48000, {
+		{6, -14, 20, -12, -24, 96, -187, 257, -240, 66, 309, -873, 1547, -2195, 2664, 13544, 2664, -2195, 1547, -873, 309, 66, -240, 257, -187, 96, -24, -12, 20, -14, 6, 0},
+		{6, -14, 19, -10, -27, 98, -187, 252, -226, 44, 335, -892, 1539, -2128, 2444, 13543, 2887, -2259, 1552, -853, 282, 88, -254, 263, -187, 93, -21, -14, 21, -15, 6, -1},
+		{6, -14, 18, -8, -30, 101, -187, 246, -212, 22, 360, -909, 1530, -2059, 2227, 13531, 3113, -2321, 1554, -831, 255, 110, -267, 267, -186, 90, -18, -16, 22, -15, 6, -1},
+		{6, -13, 17, -6, -33, 103, -187, 240, -198, 0, 384, -925, 1517, -1987, 2013, 13513, 3340, -2380, 1554, -807, 227, 133, -280, 272, -185, 86, -15, -18, 23, -15, 6, -1},
+		{6, -13, 16, -4, -36, 105, -186, 233, -184, -22, 408, -938, 1503, -1914, 1802, 13487, 3570, -2435, 1551, -781, 198, 155, -293, 276, -184, 83, -12, -21, 24, -15, 6, -1},
+		{6, -13, 15, -2, -38, 107, -185, 226, -169, -43, 430, -950, 1486, -1838, 1594, 13453, 3802, -2488, 1545, -754, 168, 178, -305, 279, -182, 79, -8, -23, 25, -16, 6, -1},
+		{6, -12, 14, 0, -41, 109, -183, 219, -154, -64, 452, -961, 1467, -1761, 1389, 13413, 4035, -2538, 1537, -726, 138, 200, -317, 282, -180, 75, -5, -25, 26, -16, 6, -1},
+		{6, -12, 13, 2, -43, 110, -182, 211, -140, -85, 472, -969, 1446, -1682, 1189, 13363, 4270, -2584, 1526, -696, 108, 222, -328, 285, -177, 71, -1, -27, 27, -16, 6, -1},
+		{6, -11, 12, 4, -46, 112, -180, 204, -125, -105, 492, -976, 1422, -1601, 992, 13305, 4506, -2627, 1513, -664, 77, 244, -339, 287, -175, 67, 2, -29, 28, -16, 6, -1},
+		{6, -11, 11, 6, -48, 113, -177, 196, -110, -125, 510, -981, 1397, -1520, 799, 13242, 4743, -2666, 1496, -631, 45, 266, -350, 289, -171, 62, 6, -31, 29, -16, 6, -1},
+		{6, -11, 10, 8, -50, 114, -175, 187, -95, -144, 528, -985, 1369, -1437, 610, 13173, 4981, -2701, 1477, -596, 13, 288, -360, 290, -168, 58, 9, -33, 29, -16, 6, -1},
+		{5, -10, 9, 9, -52, 114, -172, 179, -80, -164, 544, -987, 1340, -1353, 425, 13097, 5220, -2732, 1455, -560, -19, 309, -370, 291, -164, 53, 13, -35, 30, -16, 6, -1},
+		{5, -10, 8, 11, -54, 115, -169, 170, -65, -182, 559, -987, 1308, -1268, 245, 13012, 5460, -2760, 1431, -523, -52, 330, -379, 292, -160, 48, 17, -37, 31, -16, 5, -1},
+		{5, -9, 7, 13, -55, 115, -166, 161, -50, -200, 574, -986, 1275, -1182, 69, 12920, 5699, -2783, 1404, -485, -85, 351, -387, 292, -156, 43, 20, -39, 31, -16, 5, -1},
+		{5, -9, 5, 14, -57, 115, -162, 152, -35, -218, 587, -983, 1240, -1096, -102, 12822, 5939, -2802, 1374, -445, -118, 371, -395, 291, -151, 38, 24, -41, 32, -16, 5, 0},
+		{5, -8, 4, 16, -58, 115, -158, 143, -20, -235, 599, -978, 1204, -1009, -269, 12712, 6178, -2816, 1341, -404, -151, 391, -402, 290, -146, 33, 28, -43, 33, -16, 5, 0},
+		{5, -8, 3, 17, -60, 115, -154, 134, -6, -252, 610, -972, 1166, -922, -431, 12604, 6418, -2827, 1306, -362, -185, 411, -409, 288, -141, 27, 32, -45, 33, -16, 5, 0},
+		{5, -7, 2, 19, -61, 114, -150, 124, 9, -267, 620, -964, 1127, -835, -588, 12482, 6656, -2832, 1268, -318, -218, 430, -415, 286, -135, 22, 35, -47, 34, -16, 4, 0},
+		{4, -7, 1, 20, -62, 114, -146, 115, 23, -283, 628, -955, 1086, -748, -740, 12362, 6894, -2833, 1227, -274, -252, 448, -421, 283, -129, 16, 39, -48, 34, -16, 4, 0},
+		{4, -6, 0, 22, -63, 113, -141, 105, 37, -297, 636, -944, 1044, -661, -887, 12228, 7131, -2830, 1184, -229, -285, 466, -426, 280, -123, 11, 43, -50, 34, -16, 4, 0},
+		{4, -6, -1, 23, -64, 112, -136, 95, 51, -312, 642, -931, 1000, -574, -1029, 12092, 7366, -2821, 1138, -183, -318, 483, -430, 277, -117, 5, 47, -52, 35, -16, 4, 0},
+		{4, -5, -2, 24, -65, 110, -131, 85, 65, -325, 647, -918, 956, -488, -1166, 11950, 7600, -2807, 1089, -136, -351, 500, -434, 272, -110, -1, 50, -53, 35, -15, 4, 0},
+		{4, -5, -2, 25, -65, 109, -126, 76, 78, -338, 651, -903, 910, -402, -1297, 11799, 7832, -2789, 1038, -88, -384, 516, -436, 268, -103, -7, 54, -55, 35, -15, 3, 1},
+		{4, -4, -3, 27, -66, 107, -121, 66, 91, -350, 654, -886, 864, -316, -1424, 11643, 8063, -2765, 985, -39, -416, 531, -439, 262, -96, -13, 57, -56, 35, -15, 3, 1},
+		{3, -4, -4, 28, -66, 106, -116, 56, 104, -361, 656, -869, 816, -232, -1544, 11482, 8291, -2737, 929, 10, -449, 546, -440, 257, -88, -19, 61, -57, 35, -14, 3, 1},
+		{3, -3, -5, 29, -66, 104, -110, 46, 116, -371, 657, -850, 768, -148, -1660, 11315, 8517, -2703, 871, 60, -480, 560, -441, 251, -80, -25, 64, -59, 35, -14, 2, 1},
+		{3, -3, -6, 29, -67, 102, -105, 37, 129, -381, 657, -830, 719, -65, -1770, 11146, 8740, -2663, 810, 110, -512, 573, -441, 244, -72, -32, 68, -60, 35, -14, 2, 1},
+		{3, -3, -7, 30, -67, 100, -99, 27, 140, -390, 655, -808, 670, 16, -1875, 10969, 8961, -2619, 748, 160, -542, 585, -440, 237, -64, -38, 71, -61, 35, -13, 2, 1},
+		{3, -2, -7, 31, -66, 97, -93, 17, 152, -399, 653, -786, 620, 97, -1974, 10786, 9178, -2569, 683, 211, -572, 596, -438, 229, -56, -44, 75, -62, 35, -13, 1, 1},
+		{3, -2, -8, 32, -66, 95, -87, 8, 163, -406, 649, -762, 569, 176, -2067, 10596, 9393, -2514, 616, 262, -602, 607, -436, 221, -47, -50, 78, -63, 35, -12, 1, 2},
+		{2, -1, -9, 32, -66, 92, -81, -2, 174, -413, 645, -738, 518, 253, -2156, 10414, 9603, -2453, 547, 313, -631, 616, -433, 212, -39, -56, 81, -64, 34, -12, 0, 2},
+		{2, -1, -10, 33, -66, 90, -75, -11, 184, -419, 639, -712, 467, 329, -2238, 10215, 9811, -2387, 476, 365, -659, 625, -429, 203, -30, -63, 84, -64, 34, -11, 0, 2},
+		{2, 0, -10, 34, -65, 87, -69, -20, 194, -425, 632, -686, 416, 404, -2315, 10014, 10012, -2315, 404, 416, -686, 632, -425, 194, -20, -69, 87, -65, 34, -10, 0, 2},
+		{2, 0, -11, 34, -64, 84, -63, -30, 203, -429, 625, -659, 365, 476, -2387, 9811, 10215, -2238, 329, 467, -712, 639, -419, 184, -11, -75, 90, -66, 33, -10, -1, 2},
+		{2, 0, -12, 34, -64, 81, -56, -39, 212, -433, 616, -631, 313, 547, -2453, 9603, 10414, -2156, 253, 518, -738, 645, -413, 174, -2, -81, 92, -66, 32, -9, -1, 2},
+		{2, 1, -12, 35, -63, 78, -50, -47, 221, -436, 607, -602, 262, 616, -2514, 9393, 10596, -2067, 176, 569, -762, 649, -406, 163, 8, -87, 95, -66, 32, -8, -2, 3},
+		{1, 1, -13, 35, -62, 75, -44, -56, 229, -438, 596, -572, 211, 683, -2569, 9178, 10786, -1974, 97, 620, -786, 653, -399, 152, 17, -93, 97, -66, 31, -7, -2, 3},
+		{1, 2, -13, 35, -61, 71, -38, -64, 237, -440, 585, -542, 160, 748, -2619, 8961, 10969, -1875, 16, 670, -808, 655, -390, 140, 27, -99, 100, -67, 30, -7, -3, 3},
+		{1, 2, -14, 35, -60, 68, -32, -72, 244, -441, 573, -512, 110, 810, -2663, 8740, 11146, -1770, -65, 719, -830, 657, -381, 129, 37, -105, 102, -67, 29, -6, -3, 3},
+		{1, 2, -14, 35, -59, 64, -25, -80, 251, -441, 560, -480, 60, 871, -2703, 8517, 11315, -1660, -148, 768, -850, 657, -371, 116, 46, -110, 104, -66, 29, -5, -3, 3},
+		{1, 3, -14, 35, -57, 61, -19, -88, 257, -440, 546, -449, 10, 929, -2737, 8291, 11482, -1544, -232, 816, -869, 656, -361, 104, 56, -116, 106, -66, 28, -4, -4, 3},
+		{1, 3, -15, 35, -56, 57, -13, -96, 262, -439, 531, -416, -39, 985, -2765, 8063, 11643, -1424, -316, 864, -886, 654, -350, 91, 66, -121, 107, -66, 27, -3, -4, 4},
+		{1, 3, -15, 35, -55, 54, -7, -103, 268, -436, 516, -384, -88, 1038, -2789, 7832, 11799, -1297, -402, 910, -903, 651, -338, 78, 76, -126, 109, -65, 25, -2, -5, 4},
+		{0, 4, -15, 35, -53, 50, -1, -110, 272, -434, 500, -351, -136, 1089, -2807, 7600, 11950, -1166, -488, 956, -918, 647, -325, 65, 85, -131, 110, -65, 24, -2, -5, 4},
+		{0, 4, -16, 35, -52, 47, 5, -117, 277, -430, 483, -318, -183, 1138, -2821, 7366, 12092, -1029, -574, 1000, -931, 642, -312, 51, 95, -136, 112, -64, 23, -1, -6, 4},
+		{0, 4, -16, 34, -50, 43, 11, -123, 280, -426, 466, -285, -229, 1184, -2830, 7131, 12228, -887, -661, 1044, -944, 636, -297, 37, 105, -141, 113, -63, 22, 0, -6, 4},
+		{0, 4, -16, 34, -48, 39, 16, -129, 283, -421, 448, -252, -274, 1227, -2833, 6894, 12362, -740, -748, 1086, -955, 628, -283, 23, 115, -146, 114, -62, 20, 1, -7, 4},
+		{0, 4, -16, 34, -47, 35, 22, -135, 286, -415, 430, -218, -318, 1268, -2832, 6656, 12482, -588, -835, 1127, -964, 620, -267, 9, 124, -150, 114, -61, 19, 2, -7, 5},
+		{0, 5, -16, 33, -45, 32, 27, -141, 288, -409, 411, -185, -362, 1306, -2827, 6418, 12604, -431, -922, 1166, -972, 610, -252, -6, 134, -154, 115, -60, 17, 3, -8, 5},
+		{0, 5, -16, 33, -43, 28, 33, -146, 290, -402, 391, -151, -404, 1341, -2816, 6178, 12712, -269, -1009, 1204, -978, 599, -235, -20, 143, -158, 115, -58, 16, 4, -8, 5},
+		{0, 5, -16, 32, -41, 24, 38, -151, 291, -395, 371, -118, -445, 1374, -2802, 5939, 12822, -102, -1096, 1240, -983, 587, -218, -35, 152, -162, 115, -57, 14, 5, -9, 5},
+		{-1, 5, -16, 31, -39, 20, 43, -156, 292, -387, 351, -85, -485, 1404, -2783, 5699, 12920, 69, -1182, 1275, -986, 574, -200, -50, 161, -166, 115, -55, 13, 7, -9, 5},
+		{-1, 5, -16, 31, -37, 17, 48, -160, 292, -379, 330, -52, -523, 1431, -2760, 5460, 13012, 245, -1268, 1308, -987, 559, -182, -65, 170, -169, 115, -54, 11, 8, -10, 5},
+		{-1, 6, -16, 30, -35, 13, 53, -164, 291, -370, 309, -19, -560, 1455, -2732, 5220, 13097, 425, -1353, 1340, -987, 544, -164, -80, 179, -172, 114, -52, 9, 9, -10, 5},
+		{-1, 6, -16, 29, -33, 9, 58, -168, 290, -360, 288, 13, -596, 1477, -2701, 4981, 13173, 610, -1437, 1369, -985, 528, -144, -95, 187, -175, 114, -50, 8, 10, -11, 6},
+		{-1, 6, -16, 29, -31, 6, 62, -171, 289, -350, 266, 45, -631, 1496, -2666, 4743, 13242, 799, -1520, 1397, -981, 510, -125, -110, 196, -177, 113, -48, 6, 11, -11, 6},
+		{-1, 6, -16, 28, -29, 2, 67, -175, 287, -339, 244, 77, -664, 1513, -2627, 4506, 13305, 992, -1601, 1422, -976, 492, -105, -125, 204, -180, 112, -46, 4, 12, -11, 6},
+		{-1, 6, -16, 27, -27, -1, 71, -177, 285, -328, 222, 108, -696, 1526, -2584, 4270, 13363, 1189, -1682, 1446, -969, 472, -85, -140, 211, -182, 110, -43, 2, 13, -12, 6},
+		{-1, 6, -16, 26, -25, -5, 75, -180, 282, -317, 200, 138, -726, 1537, -2538, 4035, 13413, 1389, -1761, 1467, -961, 452, -64, -154, 219, -183, 109, -41, 0, 14, -12, 6},
+		{-1, 6, -16, 25, -23, -8, 79, -182, 279, -305, 178, 168, -754, 1545, -2488, 3802, 13453, 1594, -1838, 1486, -950, 430, -43, -169, 226, -185, 107, -38, -2, 15, -13, 6},
+		{-1, 6, -15, 24, -21, -12, 83, -184, 276, -293, 155, 198, -781, 1551, -2435, 3570, 13487, 1802, -1914, 1503, -938, 408, -22, -184, 233, -186, 105, -36, -4, 16, -13, 6},
+		{-1, 6, -15, 23, -18, -15, 86, -185, 272, -280, 133, 227, -807, 1554, -2380, 3340, 13513, 2013, -1987, 1517, -925, 384, 0, -198, 240, -187, 103, -33, -6, 17, -13, 6},
+		{-1, 6, -15, 22, -16, -18, 90, -186, 267, -267, 110, 255, -831, 1554, -2321, 3113, 13531, 2227, -2059, 1530, -909, 360, 22, -212, 246, -187, 101, -30, -8, 18, -14, 6},
+		{-1, 6, -15, 21, -14, -21, 93, -187, 263, -254, 88, 282, -853, 1552, -2259, 2887, 13543, 2444, -2128, 1539, -892, 335, 44, -226, 252, -187, 98, -27, -10, 19, -14, 6},
+		{0, 6, -14, 20, -12, -24, 96, -187, 257, -240, 66, 309, -873, 1547, -2195, 2664, 13544, 2664, -2195, 1547, -873, 309, 66, -240, 257, -187, 96, -24, -12, 20, -14, 6},
+	}},
+};
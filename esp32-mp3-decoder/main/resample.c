@@ -0,0 +1,77 @@
+/******************************************************************************
+ * FileName: resample.c
+ *
+ * Description: Fractional resampler for the output, used to play a stream a
+ * tiny bit faster or slower than its nominal sample rate. It interpolates
+ * between the input samples with a 4-tap cubic (Catmull-Rom) Farrow structure,
+ * in fixed point. Unlike adding or dropping whole samples, this doesn't click.
+ *
+*******************************************************************************/
+#include <stdint.h>
+
+#include "resample.h"
+
+//The last 3 input samples of the previous block. Conceptually, the input is this history followed by
+//the samples of the current block.
+static short hist[3];
+//Position of the next output sample, as an index into hist+input, plus a 0.24 fraction. The output
+//sample is interpolated between input samples pos+1 and pos+2.
+static int pos;
+static unsigned int frac;
+
+void resampleInit() {
+	hist[0]=0;
+	hist[1]=0;
+	hist[2]=0;
+	pos=0;
+	frac=0;
+}
+
+static inline int sampAt(const short *in, int i) {
+	return (i<3)?hist[i]:in[i-3];
+}
+
+//Resample a block of len (at most RESAMPLE_MAX_IN) samples into out, which needs room for
+//RESAMPLE_MAX_OUT samples. step is the amount of input samples to advance per output sample, as an
+//8.24 fixed-point number; it must lie within 1/256 of 1.0. Returns the amount of output samples.
+int resampleBlock(const short *in, int len, short *out, unsigned int step) {
+	int n=0;
+	int xm1, x0, x1, x2;
+	int c1, c2, c3, mu, y;
+	while (pos<len) {
+		xm1=sampAt(in, pos);
+		x0=sampAt(in, pos+1);
+		x1=sampAt(in, pos+2);
+		x2=sampAt(in, pos+3);
+		//Farrow coefficients of the Catmull-Rom spline between x0 and x1, all times 2
+		c1=x1-xm1;
+		c2=2*xm1-5*x0+4*x1-x2;
+		c3=(x2-xm1)+3*(x0-x1);
+		mu=frac>>9;		//0.15
+		y=(int)(((int64_t)c3*mu)>>15)+c2;
+		y=(int)(((int64_t)y*mu)>>15)+c1;
+		y=(int)(((int64_t)y*mu)>>15)+2*x0;
+		y>>=1;
+		if (y>32767) y=32767;
+		if (y<-32768) y=-32768;
+		out[n++]=y;
+
+		frac+=step;
+		pos+=frac>>24;
+		frac&=0xffffff;
+	}
+	pos-=len;
+	//Keep the last 3 input samples for the next block
+	if (len>=3) {
+		hist[0]=in[len-3];
+		hist[1]=in[len-2];
+		hist[2]=in[len-1];
+	} else {
+		while (len--) {
+			hist[0]=hist[1];
+			hist[1]=hist[2];
+			hist[2]=*in++;
+		}
+	}
+	return n;
+}
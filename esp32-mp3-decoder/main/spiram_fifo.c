@@ -5,7 +5,8 @@
  *
  * Description: Routines to use a SPI RAM chip as a big FIFO buffer. Multi-
  * thread-aware: the reading and writing can happen in different threads and
- * will block if the fifo is empty and full, respectively.
+ * will block if the fifo is empty and full, respectively. The FIFO is lock-free
+ * as long as there is exactly one reader and one writer thread.
  *
  * Modification history:
  *     2015/06/02, v1.0 File created.
@@ -17,23 +18,27 @@
 #include "freertos/semphr.h"
 #include "freertos/queue.h"
 #include <string.h>
+#include <stdatomic.h>
 
 #include "spiram_fifo.h"
 #include "spiram.h"
 #include "playerconfig.h"
 
+//Maximum amount of bytes moved to or from the SPI RAM chip in one transaction
 #define SPIREADSIZE 64
 
-static int fifoRpos;
-static int fifoWpos;
-static int fifoFill;
+//The FIFO is a single-producer/single-consumer ring: only the reader task moves fifoRpos and only the
+//writer task moves fifoWpos, so neither side needs a lock. The positions run from 0 to 2*SPIRAMSIZE-1
+//so a full FIFO can be told apart from an empty one. The semaphores are only used to sleep when the
+//FIFO is empty (reader) or full (writer); the other side only gives them when the sleeper has flagged
+//it is waiting.
+static atomic_int fifoRpos;
+static atomic_int fifoWpos;
+static atomic_int readerWaiting;
+static atomic_int writerWaiting;
 static xSemaphoreHandle semCanRead;
 static xSemaphoreHandle semCanWrite;
-static xSemaphoreHandle mux;
-static long fifoOvfCnt, fifoUdrCnt;
-
-//Low watermark where we restart the reader thread.
-#define FIFO_LOWMARK (112*1024)
+static volatile long fifoOvfCnt, fifoUdrCnt;
 
 #ifdef FAKE_SPI_BUFF
 //Re-define a bunch of things so we use the internal buffer
@@ -41,93 +46,171 @@ static long fifoOvfCnt, fifoUdrCnt;
 //allocate enough for about one mp3 frame
 // #define SPIRAMSIZE 1850 
 #define SPIRAMSIZE 48500
-static char fakespiram[SPIRAMSIZE];
+//The first SPIRAM_FIFO_MAXSPAN bytes are mirrored behind the end of the buffer, so any span of up to
+//that size can be handed out as one contiguous piece of memory, even if it wraps. The few extra bytes
+//keep bitstream readers that look a bit ahead of the span inside the array.
+static char fakespiram[SPIRAMSIZE+SPIRAM_FIFO_MAXSPAN+8];
 #define spiRamInit() while(0)
 #define spiRamTest() 1
-#define spiRamWrite(pos, buf, n) memcpy(&fakespiram[pos], buf, n)
+#define spiRamWrite(pos, buf, n) fakeSpiRamWrite(pos, buf, n)
 #define spiRamRead(pos, buf, n) memcpy(buf, &fakespiram[pos], n)
+
+static void fakeSpiRamWrite(int pos, char *buf, int n) {
+	memcpy(&fakespiram[pos], buf, n);
+	if (pos<SPIRAM_FIFO_MAXSPAN) {
+		if (n>SPIRAM_FIFO_MAXSPAN-pos) n=SPIRAM_FIFO_MAXSPAN-pos;
+		memcpy(&fakespiram[SPIRAMSIZE+pos], buf, n);
+	}
+}
+//No chip, so no transaction size limit either
+#undef SPIREADSIZE
+#define SPIREADSIZE SPIRAMSIZE
 #endif
 
+//Amount of bytes between two ring positions
+static inline int fifoDist(int from, int to) {
+	int d=to-from;
+	if (d<0) d+=2*SPIRAMSIZE;
+	return d;
+}
+
+//Advance a ring position by n bytes
+static inline int fifoAdvance(int pos, int n) {
+	pos+=n;
+	if (pos>=2*SPIRAMSIZE) pos-=2*SPIRAMSIZE;
+	return pos;
+}
+
 //Initialize the FIFO
 int spiRamFifoInit() {
-	fifoRpos=0;
-	fifoWpos=0;
-	fifoFill=0;
+	atomic_store(&fifoRpos, 0);
+	atomic_store(&fifoWpos, 0);
+	atomic_store(&readerWaiting, 0);
+	atomic_store(&writerWaiting, 0);
 	fifoOvfCnt=0;
 	fifoUdrCnt=0;
 	vSemaphoreCreateBinary(semCanRead);
 	vSemaphoreCreateBinary(semCanWrite);
-	mux=xSemaphoreCreateMutex();
+	xSemaphoreTake(semCanRead, 0);
+	xSemaphoreTake(semCanWrite, 0);
 	spiRamInit();
 	return (spiRamTest());
 }
 
-//Read bytes from the FIFO
+//Read bytes from the FIFO. Blocks until all bytes are read.
 void spiRamFifoRead(char *buff, int len) {
-	int n;
+	int n, rpos, fill;
+	rpos=atomic_load_explicit(&fifoRpos, memory_order_relaxed);
 	while (len>0) {
-		n=len;
-		if (n>SPIREADSIZE) n=SPIREADSIZE;			//don't read more than SPIREADSIZE
-		if (n>(SPIRAMSIZE-fifoRpos)) n=SPIRAMSIZE-fifoRpos; //don't read past end of buffer
-		xSemaphoreTake(mux, portMAX_DELAY);
-		if (fifoFill<n) {
-//			printf("FIFO empty.\n");
-			//Drat, not enough data in FIFO. Wait till there's some written and try again.
+		fill=fifoDist(rpos, atomic_load_explicit(&fifoWpos, memory_order_acquire));
+		if (fill==0) {
+			//Drat, FIFO is empty. Wait till there's some written and try again.
 			fifoUdrCnt++;
-			xSemaphoreGive(mux);
-			if (fifoFill<FIFO_LOWMARK) xSemaphoreTake(semCanRead, portMAX_DELAY);
+			atomic_store(&readerWaiting, 1);
+			if (fifoDist(rpos, atomic_load(&fifoWpos))==0) xSemaphoreTake(semCanRead, portMAX_DELAY);
+			atomic_store(&readerWaiting, 0);
+			continue;
+		}
+		//Read as much as we can in one go, up to the end of the storage.
+		n=len;
+		if (n>fill) n=fill;
+		if (n>SPIREADSIZE) n=SPIREADSIZE;
+		if (rpos>=SPIRAMSIZE) {
+			if (n>(2*SPIRAMSIZE-rpos)) n=2*SPIRAMSIZE-rpos;
+			spiRamRead(rpos-SPIRAMSIZE, buff, n);
 		} else {
-			//Read the data.
-			spiRamRead(fifoRpos, buff, n);
-			buff+=n;
-			len-=n;
-			fifoFill-=n;
-			fifoRpos+=n;
-			if (fifoRpos>=SPIRAMSIZE) fifoRpos=0;
-			xSemaphoreGive(mux);
-			xSemaphoreGive(semCanWrite); //Indicate writer thread there's some free room in the fifo
+			if (n>(SPIRAMSIZE-rpos)) n=SPIRAMSIZE-rpos;
+			spiRamRead(rpos, buff, n);
 		}
+		buff+=n;
+		len-=n;
+		rpos=fifoAdvance(rpos, n);
+		atomic_store(&fifoRpos, rpos);
+		//Wake up the writer thread if it's waiting for free room
+		if (atomic_load(&writerWaiting)) xSemaphoreGive(semCanWrite);
 	}
 }
 
-//Write bytes to the FIFO
+//Write bytes to the FIFO. Blocks until all bytes are written.
 void spiRamFifoWrite(char *buff, int len) {
-	int n;
+	int n, wpos, room;
+	wpos=atomic_load_explicit(&fifoWpos, memory_order_relaxed);
 	while (len>0) {
-		n=len;
-		if (n>SPIREADSIZE) n=SPIREADSIZE;		//don't read more than SPIREADSIZE
-		if (n>(SPIRAMSIZE-fifoWpos)) n=SPIRAMSIZE-fifoWpos; //don't read past end of buffer
-
-		xSemaphoreTake(mux, portMAX_DELAY);
-		if ((SPIRAMSIZE-fifoFill)<n) {
-//			printf("FIFO full.\n");
-			//Drat, not enough free room in FIFO. Wait till there's some read and try again.
+		room=SPIRAMSIZE-fifoDist(atomic_load_explicit(&fifoRpos, memory_order_acquire), wpos);
+		if (room==0) {
+			//Drat, FIFO is full. Wait till there's some read and try again.
 			fifoOvfCnt++;
-			xSemaphoreGive(mux);
-			xSemaphoreTake(semCanWrite, portMAX_DELAY);
+			atomic_store(&writerWaiting, 1);
+			if (fifoDist(atomic_load(&fifoRpos), wpos)==SPIRAMSIZE) xSemaphoreTake(semCanWrite, portMAX_DELAY);
+			atomic_store(&writerWaiting, 0);
+			continue;
+		}
+		//Write as much as we can in one go, up to the end of the storage.
+		n=len;
+		if (n>room) n=room;
+		if (n>SPIREADSIZE) n=SPIREADSIZE;
+		if (wpos>=SPIRAMSIZE) {
+			if (n>(2*SPIRAMSIZE-wpos)) n=2*SPIRAMSIZE-wpos;
+			spiRamWrite(wpos-SPIRAMSIZE, buff, n);
 		} else {
-			//Write the data.
-			spiRamWrite(fifoWpos, buff, n);
-			buff+=n;
-			len-=n;
-			fifoFill+=n;
-			fifoWpos+=n;
-			if (fifoWpos>=SPIRAMSIZE) fifoWpos=0;
-			xSemaphoreGive(mux);
-			xSemaphoreGive(semCanRead); //Tell reader thread there's some data in the fifo.
+			if (n>(SPIRAMSIZE-wpos)) n=SPIRAMSIZE-wpos;
+			spiRamWrite(wpos, buff, n);
 		}
+		buff+=n;
+		len-=n;
+		wpos=fifoAdvance(wpos, n);
+		atomic_store(&fifoWpos, wpos);
+		//Tell reader thread there's some data in the fifo, if it's waiting for that.
+		if (atomic_load(&readerWaiting)) xSemaphoreGive(semCanRead);
 	}
 }
 
-//Get amount of bytes in use
+//Get amount of bytes in use. Lock-free, so cheap enough to call often from either side.
 int spiRamFifoFill() {
-	int ret;
-	xSemaphoreTake(mux, portMAX_DELAY);
-	ret=fifoFill;
-	xSemaphoreGive(mux);
-	return ret;
+	return fifoDist(atomic_load_explicit(&fifoRpos, memory_order_acquire),
+			atomic_load_explicit(&fifoWpos, memory_order_acquire));
 }
 
+//Sleep until there are at least len bytes in the FIFO, or until the timeout (in ticks) runs out.
+//Returns the fill at that point. Only for the reader thread.
+int spiRamFifoWaitFill(int len, int ticks) {
+	int rpos=atomic_load_explicit(&fifoRpos, memory_order_relaxed);
+	int fill;
+	if (len>SPIRAMSIZE) len=SPIRAMSIZE;
+	while ((fill=fifoDist(rpos, atomic_load_explicit(&fifoWpos, memory_order_acquire)))<len) {
+		//Same handshake as in spiRamFifoRead: the writer gives semCanRead after every chunk it writes
+		//while we're flagged as waiting, so we get to re-check after each one.
+		atomic_store(&readerWaiting, 1);
+		if (fifoDist(rpos, atomic_load(&fifoWpos))<len && !xSemaphoreTake(semCanRead, ticks)) {
+			atomic_store(&readerWaiting, 0);
+			return fifoDist(rpos, atomic_load_explicit(&fifoWpos, memory_order_acquire));
+		}
+		atomic_store(&readerWaiting, 0);
+	}
+	return fill;
+}
+
+#ifdef FAKE_SPI_BUFF
+//Get a pointer to the data at the read side of the FIFO without copying it. *len is set to the
+//amount of contiguous bytes available there, at most SPIRAM_FIFO_MAXSPAN. The data stays valid
+//until it's released using spiRamFifoSkip.
+const char *spiRamFifoPeek(int *len) {
+	int rpos=atomic_load_explicit(&fifoRpos, memory_order_relaxed);
+	int fill=fifoDist(rpos, atomic_load_explicit(&fifoWpos, memory_order_acquire));
+	if (fill>SPIRAM_FIFO_MAXSPAN) fill=SPIRAM_FIFO_MAXSPAN;
+	*len=fill;
+	if (rpos>=SPIRAMSIZE) rpos-=SPIRAMSIZE;
+	return &fakespiram[rpos];
+}
+
+//Drop len bytes from the read side of the FIFO
+void spiRamFifoSkip(int len) {
+	int rpos=atomic_load_explicit(&fifoRpos, memory_order_relaxed);
+	atomic_store(&fifoRpos, fifoAdvance(rpos, len));
+	if (atomic_load(&writerWaiting)) xSemaphoreGive(semCanWrite);
+}
+#endif
+
 int spiRamFifoFree() {
 	return (SPIRAMSIZE-spiRamFifoFill());
 }
@@ -137,18 +220,9 @@ int spiRamFifoLen() {
 }
 
 long spiRamGetOverrunCt() {
-	long ret;
-	xSemaphoreTake(mux, portMAX_DELAY);
-	ret=fifoOvfCnt;
-	xSemaphoreGive(mux);
-	return ret;
+	return fifoOvfCnt;
 }
 
 long spiRamGetUnderrunCt() {
-	long ret;
-	xSemaphoreTake(mux, portMAX_DELAY);
-	ret=fifoUdrCnt;
-	xSemaphoreGive(mux);
-	return ret;
+	return fifoUdrCnt;
 }
-
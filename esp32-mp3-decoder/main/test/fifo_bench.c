@@ -0,0 +1,122 @@
+/******************************************************************************
+ * FileName: fifo_bench.c
+ *
+ * Description: Host benchmark for the SPI RAM FIFO (in its FAKE_SPI_BUFF form,
+ * which is the one that can run without the chip). A writer thread pushes a
+ * numbered byte stream through the FIFO in random chunks of up to 4096 bytes,
+ * like the socket reader does; the main thread reads it back in random chunks
+ * of up to one mp3 read buffer and checks every byte. Prints the throughput
+ * and the latency distribution of the read and write calls. Linked against
+ * both main/spiram_fifo.c and the old mutex version, see the Makefile.
+ *
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "spiram_fifo.h"
+
+//Amount of bytes to push through the FIFO
+#define BENCH_BYTES (200*1000*1000L)
+//Largest chunks written and read
+#define BENCH_WRCHUNK (4096)
+#define BENCH_RDCHUNK (2106)
+//Call latencies are kept in a histogram of 1uS bins; anything longer goes in the last one.
+#define LAT_BINS (100000)
+
+struct latHist {
+	long bin[LAT_BINS];
+	long n;
+	double max;
+};
+
+static struct latHist wrLat, rdLat;
+
+static double now() {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec+t.tv_nsec*1e-9;
+}
+
+static void latAdd(struct latHist *h, double s) {
+	long us=(long)(s*1e6);
+	if (us>=LAT_BINS) us=LAT_BINS-1;
+	h->bin[us]++;
+	h->n++;
+	if (s>h->max) h->max=s;
+}
+
+//Latency (in uS) below which the given fraction of the calls finished
+static long latPct(struct latHist *h, double frac) {
+	long i, sum=0;
+	for (i=0; i<LAT_BINS; i++) {
+		sum+=h->bin[i];
+		if (sum>=h->n*frac) return i+1;
+	}
+	return LAT_BINS;
+}
+
+static void latPrint(const char *name, struct latHist *h) {
+	printf("%s: %ld calls, p50 %ldus p99 %ldus p99.9 %ldus max %.0fus\n", name, h->n,
+		latPct(h, 0.5), latPct(h, 0.99), latPct(h, 0.999), h->max*1e6);
+}
+
+static unsigned int rnd(unsigned int *x) {
+	*x=*x*1103515245+12345;
+	return (*x>>16)&0x7fff;
+}
+
+static void *writer(void *arg) {
+	unsigned char buf[BENCH_WRCHUNK];
+	unsigned int x=1;
+	long pos=0;
+	int i, n;
+	double t;
+	(void)arg;
+	while (pos<BENCH_BYTES) {
+		n=rnd(&x)%BENCH_WRCHUNK+1;
+		if (n>BENCH_BYTES-pos) n=BENCH_BYTES-pos;
+		for (i=0; i<n; i++) buf[i]=(unsigned char)((pos+i)*7);
+		t=now();
+		spiRamFifoWrite((char*)buf, n);
+		latAdd(&wrLat, now()-t);
+		pos+=n;
+	}
+	return NULL;
+}
+
+int main() {
+	unsigned char buf[BENCH_RDCHUNK];
+	unsigned int x=7;
+	long pos=0, bad=0;
+	int i, n, fill;
+	double t, start;
+	pthread_t wr;
+
+	spiRamFifoInit();
+	start=now();
+	pthread_create(&wr, NULL, writer, NULL);
+	while (pos<BENCH_BYTES) {
+		n=rnd(&x)%BENCH_RDCHUNK+1;
+		if (n>BENCH_BYTES-pos) n=BENCH_BYTES-pos;
+		t=now();
+		spiRamFifoRead((char*)buf, n);
+		latAdd(&rdLat, now()-t);
+		for (i=0; i<n; i++) {
+			if (buf[i]!=(unsigned char)((pos+i)*7)) bad++;
+		}
+		pos+=n;
+		//The decoder asks for the fill level all the time; it should always make sense.
+		fill=spiRamFifoFill();
+		if (fill<0 || fill>spiRamFifoLen()) bad++;
+	}
+	pthread_join(wr, NULL);
+
+	printf("%.1f MB/s, %ld bad bytes, FIFO full %ld times, empty %ld times\n",
+		BENCH_BYTES/(now()-start)/1e6, bad, spiRamGetOverrunCt(), spiRamGetUnderrunCt());
+	latPrint("write", &wrLat);
+	latPrint("read", &rdLat);
+	return (bad!=0);
+}
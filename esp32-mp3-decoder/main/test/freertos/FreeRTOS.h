@@ -0,0 +1,170 @@
+#ifndef _HOST_FREERTOS_H_
+#define _HOST_FREERTOS_H_
+
+//Just enough of the FreeRTOS task, semaphore and queue API, on top of pthreads, to run the FIFO,
+//pipeline and worker code on a host.
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+typedef struct {
+	pthread_mutex_t m;
+	pthread_cond_t c;
+	int v;
+} *xSemaphoreHandle;
+
+#define portMAX_DELAY (-1)
+//Ticks are milliseconds here
+#define portTICK_RATE_MS 1
+#define pdPASS 1
+
+//Absolute time timeout milliseconds from now, for pthread_cond_timedwait
+static inline void hostDeadline(int timeout, struct timespec *t) {
+	clock_gettime(CLOCK_REALTIME, t);
+	t->tv_sec+=timeout/1000;
+	t->tv_nsec+=(timeout%1000)*1000000L;
+	if (t->tv_nsec>=1000000000L) {
+		t->tv_sec++;
+		t->tv_nsec-=1000000000L;
+	}
+}
+
+static inline xSemaphoreHandle hostSemCreate(int v) {
+	xSemaphoreHandle s=calloc(1, sizeof(*s));
+	pthread_mutex_init(&s->m, NULL);
+	pthread_cond_init(&s->c, NULL);
+	s->v=v;
+	return s;
+}
+
+static inline int xSemaphoreTake(xSemaphoreHandle s, int timeout) {
+	pthread_mutex_lock(&s->m);
+	if (timeout==0 && !s->v) {
+		pthread_mutex_unlock(&s->m);
+		return 0;
+	}
+	if (timeout==portMAX_DELAY) {
+		while (!s->v) pthread_cond_wait(&s->c, &s->m);
+	} else {
+		struct timespec t;
+		hostDeadline(timeout, &t);
+		while (!s->v) {
+			if (pthread_cond_timedwait(&s->c, &s->m, &t)!=0 && !s->v) {
+				pthread_mutex_unlock(&s->m);
+				return 0;
+			}
+		}
+	}
+	s->v=0;
+	pthread_mutex_unlock(&s->m);
+	return 1;
+}
+
+static inline int xSemaphoreGive(xSemaphoreHandle s) {
+	pthread_mutex_lock(&s->m);
+	s->v=1;
+	pthread_cond_signal(&s->c);
+	pthread_mutex_unlock(&s->m);
+	return 1;
+}
+
+#define vSemaphoreCreateBinary(s) ((s)=hostSemCreate(1))
+#define xSemaphoreCreateMutex() hostSemCreate(1)
+
+typedef struct {
+	pthread_mutex_t m;
+	pthread_cond_t c;
+	char *buf;
+	int len, itemSize, head, count;
+} *xQueueHandle;
+
+static inline xQueueHandle xQueueCreate(int len, int itemSize) {
+	xQueueHandle q=calloc(1, sizeof(*q));
+	pthread_mutex_init(&q->m, NULL);
+	pthread_cond_init(&q->c, NULL);
+	q->buf=malloc(len*itemSize);
+	q->len=len;
+	q->itemSize=itemSize;
+	return q;
+}
+
+static inline int hostQueueReady(xQueueHandle q, int send) {
+	return send?(q->count<q->len):(q->count>0);
+}
+
+//With the mutex held, wait until there's room (send) or an item (receive), for at most timeout
+//ticks. Returns 0 if there still isn't.
+static inline int hostQueueWait(xQueueHandle q, int send, int timeout) {
+	struct timespec t;
+	if (timeout!=portMAX_DELAY) hostDeadline(timeout, &t);
+	while (!hostQueueReady(q, send)) {
+		if (timeout==0) return 0;
+		if (timeout==portMAX_DELAY) {
+			pthread_cond_wait(&q->c, &q->m);
+		} else if (pthread_cond_timedwait(&q->c, &q->m, &t)!=0) {
+			return hostQueueReady(q, send);
+		}
+	}
+	return 1;
+}
+
+static inline int xQueueSend(xQueueHandle q, const void *item, int timeout) {
+	pthread_mutex_lock(&q->m);
+	if (!hostQueueWait(q, 1, timeout)) {
+		pthread_mutex_unlock(&q->m);
+		return 0;
+	}
+	memcpy(q->buf+((q->head+q->count)%q->len)*q->itemSize, item, q->itemSize);
+	q->count++;
+	pthread_cond_broadcast(&q->c);
+	pthread_mutex_unlock(&q->m);
+	return 1;
+}
+
+static inline int xQueueReceive(xQueueHandle q, void *item, int timeout) {
+	pthread_mutex_lock(&q->m);
+	if (!hostQueueWait(q, 0, timeout)) {
+		pthread_mutex_unlock(&q->m);
+		return 0;
+	}
+	memcpy(item, q->buf+q->head*q->itemSize, q->itemSize);
+	q->head=(q->head+1)%q->len;
+	q->count--;
+	pthread_cond_broadcast(&q->c);
+	pthread_mutex_unlock(&q->m);
+	return 1;
+}
+
+typedef pthread_t xTaskHandle;
+
+struct hostTask {
+	void (*fn)(void *);
+	void *arg;
+};
+
+static inline void *hostTaskRun(void *p) {
+	struct hostTask t=*(struct hostTask *)p;
+	free(p);
+	t.fn(t.arg);
+	return NULL;
+}
+
+//A detached thread; stack size, priority and core are ignored.
+static inline int xTaskCreatePinnedToCore(void (*fn)(void *), const char *name, int stack, void *arg, int prio,
+		xTaskHandle *handle, int core) {
+	struct hostTask *t=malloc(sizeof(*t));
+	pthread_t th;
+	t->fn=fn;
+	t->arg=arg;
+	if (pthread_create(&th, NULL, hostTaskRun, t)!=0) {
+		free(t);
+		return 0;
+	}
+	pthread_detach(th);
+	if (handle) *handle=th;
+	return pdPASS;
+}
+
+#endif
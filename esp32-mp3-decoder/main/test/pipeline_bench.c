@@ -0,0 +1,176 @@
+/******************************************************************************
+ * FileName: pipeline_bench.c
+ *
+ * Description: Host benchmark for the two-stage frame pipeline (pipeline.c,
+ * DUAL_CORE_PIPELINE). Synthetic test streams from the libmad host tests are
+ * decoded and synthesized to mono PCM twice: serially on one thread, like
+ * tskmad does without the pipeline, and with the decode on the main thread
+ * and the synthesis on a second one, connected by the pipeline, like tskmad
+ * and tsksynth. Both runs have to give exactly the same PCM. Prints the
+ * frame rate of both and the share of the serial time that's synthesis.
+ * With two cores the pipeline runs at the speed of the slower stage, so
+ * that share gives the bound on what it can gain; on a single-CPU host the
+ * pipelined run can only show the overhead of the hand-over.
+ *
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "mad.h"
+#include "decoder.h"
+#include "teststream.h"
+#include "pipeline.h"
+
+//Frames per test stream, and how many times each is decoded back to back
+#define BENCH_FRAMES (400)
+#define BENCH_REPEAT (10)
+
+struct pcmHash {
+	uint64_t hash;
+	long samples;
+};
+
+static double now() {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec+t.tv_nsec*1e-9;
+}
+
+static void hashPcm(void *data, struct mad_pcm const *pcm) {
+	struct pcmHash *h=data;
+	const unsigned char *p=(const unsigned char *)pcm->samples;
+	size_t n=pcm->length*pcm->channels*sizeof(short);
+	while (n--) {
+		h->hash^=*p++;
+		h->hash*=1099511628211ULL;
+	}
+	h->samples+=pcm->length;
+}
+
+static struct sync_t *newDecoder(struct pcmHash *h, struct mad_pcm_sink *sink) {
+	struct sync_t *dec=malloc(sizeof(struct sync_t));
+	h->hash=14695981039346656037ULL;
+	h->samples=0;
+	sink->layout=MAD_PCM_LAYOUT_MONO;
+	sink->format=MAD_PCM_FORMAT_S16;
+	sink->write=hashPcm;
+	sink->data=h;
+	mad_sync_init(dec);
+	mad_synth_sink(&dec->synth, sink);
+	return dec;
+}
+
+//Decode and synthesize on one thread. Returns the number of frames; *synthTime gets the time spent
+//in mad_synth_frame.
+static int runSerial(unsigned char *buf, unsigned long len, struct pcmHash *h, double *synthTime) {
+	struct mad_pcm_sink sink;
+	struct sync_t *dec=newDecoder(h, &sink);
+	int i, frames=0;
+	double t;
+	*synthTime=0;
+	for (i=0; i<BENCH_REPEAT; i++) {
+		mad_stream_buffer(&dec->stream, buf, len+MAD_BUFFER_GUARD);
+		while (1) {
+			if (mad_frame_decode(&dec->frame, &dec->stream)==-1) {
+				if (!MAD_RECOVERABLE(dec->stream.error)) break;
+				continue;
+			}
+			t=now();
+			mad_synth_frame(&dec->synth, &dec->frame);
+			*synthTime+=now()-t;
+			frames++;
+		}
+	}
+	mad_sync_finish(dec);
+	free(dec);
+	return frames;
+}
+
+//The synthesis side of the pipeline, like tsksynth. A NULL frame ends it.
+static void *synthThread(void *arg) {
+	struct mad_synth *synth=arg;
+	struct mad_frame *frame;
+	while ((frame=pipelineGetDecoded())!=NULL) {
+		mad_synth_frame(synth, frame);
+		pipelinePutFree(frame);
+	}
+	return NULL;
+}
+
+//Decode on this thread and synthesize on another one. Returns the number of frames.
+static int runPipelined(unsigned char *buf, unsigned long len, struct pcmHash *h) {
+	struct mad_pcm_sink sink;
+	struct sync_t *dec=newDecoder(h, &sink);
+	struct mad_frame *frame=NULL;
+	pthread_t synth;
+	int i, frames=0;
+	if (!pipelineInit(dec)) {
+		printf("FAIL: pipelineInit\n");
+		exit(1);
+	}
+	pthread_create(&synth, NULL, synthThread, &dec->synth);
+	for (i=0; i<BENCH_REPEAT; i++) {
+		mad_stream_buffer(&dec->stream, buf, len+MAD_BUFFER_GUARD);
+		while (1) {
+			//Keep the frame of a failed decode for the next try, like tskmad
+			if (frame==NULL) frame=pipelineGetFree();
+			if (mad_frame_decode(frame, &dec->stream)==-1) {
+				if (!MAD_RECOVERABLE(dec->stream.error)) break;
+				continue;
+			}
+			pipelinePutDecoded(frame);
+			frame=NULL;
+			frames++;
+		}
+	}
+	pipelinePutDecoded(NULL);
+	pthread_join(synth, NULL);
+	return frames;
+}
+
+int main() {
+	static const struct {
+		const char *name;
+		int lsf, srIdx, brIdx, mode;
+	} streams[]={
+		{"MPEG1 128k stereo", 0, 0, 9, TESTSTREAM_STEREO},
+		{"MPEG1 320k joint", 0, 0, 14, TESTSTREAM_JOINT},
+		{"MPEG2 64k mono", 1, 1, 8, TESTSTREAM_MONO},
+	};
+	struct pcmHash serial, piped;
+	unsigned char *data, *buf;
+	unsigned long len;
+	double t, tSerial, tPiped, tSynth, slower;
+	int i, n, fail=0;
+
+	for (i=0; i<(int)(sizeof(streams)/sizeof(streams[0])); i++) {
+		data=teststream_make(i+1, BENCH_FRAMES, streams[i].lsf, streams[i].srIdx, streams[i].brIdx, streams[i].mode, &len);
+		buf=calloc(len+MAD_BUFFER_GUARD, 1);
+		memcpy(buf, data, len);
+
+		t=now();
+		n=runSerial(buf, len, &serial, &tSynth);
+		tSerial=now()-t;
+		t=now();
+		runPipelined(buf, len, &piped);
+		tPiped=now()-t;
+
+		slower=(tSynth>tSerial-tSynth)?tSynth:tSerial-tSynth;
+		printf("%-18s serial %6.0f frames/s, pipelined %6.0f frames/s (x%.2f); synthesis is %.0f%% of serial, bound x%.2f\n",
+				streams[i].name, n/tSerial, n/tPiped, tSerial/tPiped, 100*tSynth/tSerial, tSerial/slower);
+		if (piped.hash!=serial.hash || piped.samples!=serial.samples) {
+			printf("FAIL: the pipelined PCM differs from the serial PCM\n");
+			fail=1;
+		}
+		free(buf);
+		free(data);
+	}
+	if (!fail) printf("OK: the pipelined PCM matches the serial PCM\n");
+	return fail;
+}
@@ -0,0 +1,150 @@
+/******************************************************************************
+ * FileName: test_drift.c
+ *
+ * Description: Host test for the clock drift correction (drift.c and
+ * resample.c). Simulates a 128 kbit/s stream whose server clock is off from
+ * ours by a few hundred ppm at most, arriving in 1460-byte packets with
+ * jitter and a network stall of 0.3 to 1 second every 13 seconds or so, going through
+ * the mp3 FIFO. The decoder takes one frame out whenever there's one, feeds
+ * the fill to driftUpdate() and resamples 1152 samples with the step it
+ * returns; the time that takes is the amount of samples that comes out.
+ * Every run starts with the fill 8KB off the target. It checks that the loop
+ * settles (the fill averaged over 60 seconds stays within 1KB of the target)
+ * in time, and that in the second half of the run the mean fill is on target
+ * and the mean correction matches the drift.
+ *
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "drift.h"
+#include "resample.h"
+
+#define SIM_RATE (44100)
+#define SIM_BYTES_PER_SEC (128000/8)
+#define SIM_FIFOLEN (48500)
+#define SIM_PACKET (1460)
+//Mean time between network stalls, and the shortest time between the end of one and the start of the
+//next, in seconds. Two stalls back to back can drain the FIFO, which is a different test.
+#define SIM_STALL_EVERY (13)
+#define SIM_STALL_GAP (5)
+#define SIM_SECONDS (2400)
+//Start this far away from the target fill
+#define SIM_OFFSET (8000)
+
+//Limits the test checks against. With these settings (and other seeds) the loop settles in 590 to 920
+//seconds, the steady state fill is within 40 bytes of the target and the correction within 20 ppm of
+//the drift.
+#define MAX_SETTLE_SEC (1200)
+#define MAX_FILL_ERR (100)
+#define MAX_PPM_ERR (40)
+
+//Small deterministic PRNG, so the test does the same on every host
+static unsigned int rndState;
+
+static double urand() {
+	rndState=rndState*1664525+1013904223;
+	return (rndState>>8)/16777216.0;
+}
+
+struct simResult {
+	double settle;			//Time the loop settled, in seconds, or -1 if it didn't
+	double fillErr;			//Mean fill minus target in the second half, in bytes
+	double ppm;				//Mean correction in the second half, in ppm
+	int underruns;
+};
+
+static void simulate(double ppm, int offset, unsigned int seed, struct simResult *r) {
+	static short in[RESAMPLE_MAX_IN], out[RESAMPLE_MAX_OUT];
+	double frameBytes=SIM_BYTES_PER_SEC*1152.0/SIM_RATE;
+	double rate=SIM_BYTES_PER_SEC*(1+ppm*1e-6);
+	int target=SIM_FIFOLEN/2;
+	double t=0, dt, inflight=0, stall=0, lastStall=0, frac=0, avg, sumFill=0, sumPpm=0;
+	int fill=target+offset, seen=0, take, n, i, decoded;
+	long cnt=0;
+	unsigned int step;
+
+	rndState=seed;
+	for (i=0; i<RESAMPLE_MAX_IN; i++) in[i]=(short)(8000*sin(i*0.1));
+	driftInit(target);
+	resampleInit();
+	avg=fill;
+	r->settle=0;
+	r->underruns=0;
+
+	while (t<SIM_SECONDS) {
+		take=(int)(frac+frameBytes);
+		decoded=(fill>=take);
+		if (decoded) {
+			//Decode a frame and play it
+			frac+=frameBytes-take;
+			fill-=take;
+			seen=fill;
+			step=driftUpdate(fill);
+			n=resampleBlock(in, 1152, out, step);
+			dt=(double)n/SIM_RATE;
+		} else {
+			//Nothing to decode: the output underruns until the network catches up.
+			r->underruns++;
+			dt=0.001;
+		}
+		t+=dt;
+
+		//The server sends continuously. Packets arrive with some jitter, and every now and then the
+		//network stalls for a while. Once the FIFO is full, the rest waits in the socket.
+		inflight+=rate*dt;
+		if (stall>0) {
+			stall-=dt;
+			lastStall=t;
+		} else if (t-lastStall>SIM_STALL_GAP && urand()<dt/SIM_STALL_EVERY) {
+			stall=0.3+urand()*0.7;
+		} else {
+			while (inflight>=SIM_PACKET && fill+SIM_PACKET<=SIM_FIFOLEN && urand()<0.85) {
+				inflight-=SIM_PACKET;
+				fill+=SIM_PACKET;
+			}
+		}
+
+		avg+=(fill-avg)*dt/60;
+		if (fabs(avg-target)>1000) r->settle=-1;
+		else if (r->settle<0) r->settle=t;
+		//The fill is looked at where driftUpdate sees it: right after taking a frame.
+		if (decoded && t>SIM_SECONDS/2) {
+			sumFill+=seen-target;
+			sumPpm+=driftGetPpm();
+			cnt++;
+		}
+	}
+	r->fillErr=sumFill/cnt;
+	r->ppm=sumPpm/cnt;
+}
+
+int main() {
+	const double drift[]={-200, -50, 50, 200};
+	const int offset[]={SIM_OFFSET, -SIM_OFFSET};
+	struct simResult r;
+	int i, j, fail=0;
+
+	for (i=0; i<4; i++) {
+		for (j=0; j<2; j++) {
+			simulate(drift[i], offset[j], i*2+j+1, &r);
+			printf("drift %+4.0f ppm, start %+5d B: settled %6.1f s, fill err %+5.0f B, correction %+6.1f ppm, %d underruns\n",
+					drift[i], offset[j], r.settle, r.fillErr, r.ppm, r.underruns);
+			if (r.settle<0 || r.settle>MAX_SETTLE_SEC) {
+				printf("FAIL: didn't settle within %d s\n", MAX_SETTLE_SEC);
+				fail=1;
+			}
+			if (fabs(r.fillErr)>MAX_FILL_ERR) {
+				printf("FAIL: steady state fill more than %d B off target\n", MAX_FILL_ERR);
+				fail=1;
+			}
+			if (fabs(r.ppm-drift[i])>MAX_PPM_ERR) {
+				printf("FAIL: correction more than %d ppm off the drift\n", MAX_PPM_ERR);
+				fail=1;
+			}
+		}
+	}
+	if (!fail) printf("OK: the drift loop settles and tracks the drift\n");
+	return fail;
+}
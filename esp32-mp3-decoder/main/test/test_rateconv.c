@@ -0,0 +1,157 @@
+/******************************************************************************
+ * FileName: test_rateconv.c
+ *
+ * Description: Host test for the fixed output rate converter (rateconv.c,
+ * FIXED_OUTPUT_RATE). Every MPEG sample rate is converted to 44100 and 48000,
+ * in blocks of rateConvMaxIn() samples and in blocks of random length. Both
+ * have to give exactly the same output, never more than RATECONV_MAX_OUT
+ * samples per block, and as many samples as the ratio says. A 1KHz tone has
+ * to come out within MIN_SNR_DB of an ideal resampled sine and, for the
+ * rates that get downsampled, a 23.5KHz tone (above the Nyquist frequency of
+ * both output rates) has to be attenuated by at least MIN_ALIAS_DB. Also
+ * prints the time per output sample for every rate pair.
+ *
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+
+#include "rateconv.h"
+
+//Input samples per run, and how many runs to take the best time of
+#define TEST_LEN (96000)
+#define TEST_RUNS (5)
+//Amplitude of the test tones
+#define TEST_AMP (16000.0)
+//Delay of the converter, in input samples: the output sample at position t of the input comes out
+//after RC_TAPS/2 more samples.
+#define TEST_DELAY (16)
+//Output samples at either end left out of the measurements, to skip the filter settling
+#define TEST_SKIP (200)
+
+//Limits the test checks against. With the current filter the SNR is 73 to 83dB and the 23.5KHz tone
+//comes out at -70dB or less.
+#define MIN_SNR_DB (70.0)
+#define MIN_ALIAS_DB (60.0)
+
+static short in[TEST_LEN];
+static short out[TEST_LEN*7], split[TEST_LEN*7], high[TEST_LEN*7];
+
+static double now() {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec+t.tv_nsec*1e-9;
+}
+
+static void makeTone(double freq, int rate) {
+	int i;
+	for (i=0; i<TEST_LEN; i++) in[i]=(short)lrint(TEST_AMP*sin(2*M_PI*freq/rate*i));
+}
+
+//Convert all of in[] from inRate to outRate, in full blocks or in blocks of random length. Returns the
+//amount of output samples, or -1 if a block gave too many; *time gets the time spent converting.
+static int convert(int inRate, int outRate, short *o, int randomLen, double *time) {
+	unsigned int step;
+	int n=0, p=0, len, k, max;
+	double t;
+	rateConvInit(outRate);
+	step=rateConvSetRate(inRate);
+	max=rateConvMaxIn(step);
+	srand(3);
+	*time=0;
+	while (p<TEST_LEN) {
+		len=randomLen?1+rand()%max:max;
+		if (len>TEST_LEN-p) len=TEST_LEN-p;
+		t=now();
+		k=rateConvBlock(in+p, len, o+n, step);
+		*time+=now()-t;
+		if (k>RATECONV_MAX_OUT) return -1;
+		n+=k;
+		p+=len;
+	}
+	return n;
+}
+
+//SNR of the output against an ideal resampled sine of the given frequency, in dB
+static double toneSnr(const short *o, int n, double freq, int inRate, int outRate) {
+	double step=(double)((((uint64_t)inRate)<<24)/outRate)/(1<<24);
+	double ref, err=0, sig=0;
+	int i;
+	for (i=TEST_SKIP; i<n-TEST_SKIP; i++) {
+		ref=TEST_AMP*sin(2*M_PI*freq/inRate*(i*step-TEST_DELAY));
+		err+=(o[i]-ref)*(o[i]-ref);
+		sig+=ref*ref;
+	}
+	return 10*log10(sig/err);
+}
+
+//Power of the output relative to a full tone of TEST_AMP, in dB
+static double level(const short *o, int n) {
+	double pwr=0;
+	int i;
+	for (i=TEST_SKIP; i<n-TEST_SKIP; i++) pwr+=(double)o[i]*o[i];
+	return 10*log10(pwr/(n-2*TEST_SKIP)/(TEST_AMP*TEST_AMP/2));
+}
+
+int main() {
+	static const int rates[]={8000, 11025, 12000, 16000, 22050, 24000, 32000, 44100, 48000};
+	static const int outRates[]={44100, 48000};
+	double t, best, snr, alias, expect;
+	int i, j, r, n, m, k, fail=0;
+
+	for (j=0; j<(int)(sizeof(outRates)/sizeof(outRates[0])); j++) {
+		for (i=0; i<(int)(sizeof(rates)/sizeof(rates[0])); i++) {
+			makeTone(1000, rates[i]);
+			best=1e9;
+			for (r=0; r<TEST_RUNS; r++) {
+				n=convert(rates[i], outRates[j], out, 0, &t);
+				if (t<best) best=t;
+			}
+			m=convert(rates[i], outRates[j], split, 1, &t);
+			snr=toneSnr(out, n, 1000, rates[i], outRates[j]);
+			alias=0;
+			if (rates[i]>outRates[j]) {
+				makeTone(23500, rates[i]);
+				alias=level(high, convert(rates[i], outRates[j], high, 0, &t));
+			}
+			printf("%5d -> %5d: %6d samples, %5.1f ns/sample, 1KHz SNR %5.1f dB", rates[i], outRates[j], n,
+					1e9*best/n, snr);
+			if (rates[i]>outRates[j]) printf(", 23.5KHz at %5.1f dB", alias);
+			printf("\n");
+
+			if (n<0 || m<0) {
+				printf("FAIL: a block gave more than %d samples\n", RATECONV_MAX_OUT);
+				fail=1;
+				continue;
+			}
+			if (n!=m) {
+				printf("FAIL: %d samples in full blocks, %d in random blocks\n", n, m);
+				fail=1;
+			}
+			for (k=0; k<n && k<m; k++) {
+				if (out[k]!=split[k]) {
+					printf("FAIL: random blocks differ from full blocks at sample %d\n", k);
+					fail=1;
+					break;
+				}
+			}
+			expect=(double)TEST_LEN*outRates[j]/rates[i];
+			if (fabs(n-expect)>2) {
+				printf("FAIL: %d samples, expected %.0f\n", n, expect);
+				fail=1;
+			}
+			if (snr<MIN_SNR_DB) {
+				printf("FAIL: SNR below %.0f dB\n", MIN_SNR_DB);
+				fail=1;
+			}
+			if (rates[i]>outRates[j] && alias>-MIN_ALIAS_DB) {
+				printf("FAIL: the 23.5KHz tone is attenuated by less than %.0f dB\n", MIN_ALIAS_DB);
+				fail=1;
+			}
+		}
+	}
+	if (!fail) printf("OK: the rate converter is accurate and block size independent\n");
+	return fail;
+}
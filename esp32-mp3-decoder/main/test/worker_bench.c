@@ -0,0 +1,160 @@
+/******************************************************************************
+ * FileName: worker_bench.c
+ *
+ * Description: Host benchmark for the channel worker (worker.c,
+ * CHANNEL_PARALLEL). Synthetic test streams from the libmad host tests are
+ * decoded and synthesized three times: without a worker, with the worker task
+ * of worker.c (a thread here) and with a worker that runs every job inline on
+ * the caller and times it. All three have to give exactly the same PCM, for
+ * interleaved and mono mix output. On two cores, channel 1 runs alongside
+ * channel 0, so the time of its jobs comes off the frame time; that gives
+ * the estimate of the latency with the worker that's printed. On a single-CPU
+ * host the worker thread itself can only show the overhead of the hand-over.
+ *
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "mad.h"
+#include "decoder.h"
+#include "teststream.h"
+#include "worker.h"
+
+//Frames per test stream, and how many times each is decoded back to back
+#define BENCH_FRAMES (400)
+#define BENCH_REPEAT (10)
+
+struct pcmHash {
+	uint64_t hash;
+	long samples;
+};
+
+static double now() {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec+t.tv_nsec*1e-9;
+}
+
+static void hashPcm(void *data, struct mad_pcm const *pcm) {
+	struct pcmHash *h=data;
+	const unsigned char *p=(const unsigned char *)pcm->samples;
+	size_t n=pcm->length*pcm->channels*sizeof(short);
+	while (n--) {
+		h->hash^=*p++;
+		h->hash*=1099511628211ULL;
+	}
+	h->samples+=pcm->length;
+}
+
+//Time spent in the jobs of the inline worker
+static double jobTime;
+
+static void inlineStart(void *data, void (*job)(void *), void *arg) {
+	double t=now();
+	job(arg);
+	jobTime+=now()-t;
+}
+
+static void inlineWait(void *data) {
+}
+
+static const struct mad_worker inlineWorker={
+	.start=inlineStart,
+	.wait=inlineWait,
+	.data=NULL
+};
+
+//Decode and synthesize the stream BENCH_REPEAT times. Returns the number of frames; *time gets the
+//time it took.
+static int run(unsigned char *buf, unsigned long len, int layout, struct mad_worker const *worker,
+		struct pcmHash *h, double *time) {
+	struct mad_pcm_sink sink;
+	struct sync_t *dec=malloc(sizeof(struct sync_t));
+	int i, frames=0;
+	double t;
+	h->hash=14695981039346656037ULL;
+	h->samples=0;
+	sink.layout=layout;
+	sink.format=MAD_PCM_FORMAT_S16;
+	sink.write=hashPcm;
+	sink.data=h;
+	mad_sync_init(dec);
+	mad_synth_sink(&dec->synth, &sink);
+	mad_stream_worker(&dec->stream, worker);
+	mad_synth_worker(&dec->synth, worker);
+	t=now();
+	for (i=0; i<BENCH_REPEAT; i++) {
+		mad_stream_buffer(&dec->stream, buf, len+MAD_BUFFER_GUARD);
+		while (1) {
+			if (mad_frame_decode(&dec->frame, &dec->stream)==-1) {
+				if (!MAD_RECOVERABLE(dec->stream.error)) break;
+				continue;
+			}
+			mad_synth_frame(&dec->synth, &dec->frame);
+			frames++;
+		}
+	}
+	*time=now()-t;
+	mad_sync_finish(dec);
+	free(dec);
+	return frames;
+}
+
+int main() {
+	static const struct {
+		const char *name;
+		int lsf, srIdx, brIdx, mode;
+	} streams[]={
+		{"MPEG1 128k stereo", 0, 0, 9, TESTSTREAM_STEREO},
+		{"MPEG1 320k joint", 0, 0, 14, TESTSTREAM_JOINT},
+		{"MPEG2 64k mono", 1, 1, 8, TESTSTREAM_MONO},
+	};
+	static const struct {
+		const char *name;
+		int layout;
+	} layouts[]={
+		{"interleaved", MAD_PCM_LAYOUT_INTERLEAVED},
+		{"mono mix", MAD_PCM_LAYOUT_MONO},
+	};
+	struct mad_worker const *worker;
+	struct pcmHash plain, threaded, timed;
+	unsigned char *data, *buf;
+	unsigned long len;
+	double tPlain, tThreaded, tTimed;
+	int i, j, n, fail=0;
+
+	worker=workerInit(1, 0);
+	if (worker==NULL) {
+		printf("FAIL: workerInit\n");
+		return 1;
+	}
+
+	for (i=0; i<(int)(sizeof(streams)/sizeof(streams[0])); i++) {
+		data=teststream_make(i+1, BENCH_FRAMES, streams[i].lsf, streams[i].srIdx, streams[i].brIdx, streams[i].mode, &len);
+		buf=calloc(len+MAD_BUFFER_GUARD, 1);
+		memcpy(buf, data, len);
+
+		for (j=0; j<(int)(sizeof(layouts)/sizeof(layouts[0])); j++) {
+			n=run(buf, len, layouts[j].layout, NULL, &plain, &tPlain);
+			run(buf, len, layouts[j].layout, worker, &threaded, &tThreaded);
+			jobTime=0;
+			run(buf, len, layouts[j].layout, &inlineWorker, &timed, &tTimed);
+
+			printf("%-18s %-11s %6.1f us/frame, worker thread %6.1f us/frame; channel 1 jobs %5.1f us/frame, 2-core latency ~%6.1f us (-%.0f%%)\n",
+					streams[i].name, layouts[j].name, 1e6*tPlain/n, 1e6*tThreaded/n, 1e6*jobTime/n,
+					1e6*(tTimed-jobTime)/n, 100*jobTime/tTimed);
+			if (threaded.hash!=plain.hash || threaded.samples!=plain.samples ||
+					timed.hash!=plain.hash || timed.samples!=plain.samples) {
+				printf("FAIL: the PCM with the worker differs from the PCM without it\n");
+				fail=1;
+			}
+		}
+		free(buf);
+		free(data);
+	}
+	if (!fail) printf("OK: the PCM with the worker matches the PCM without it\n");
+	return fail;
+}
@@ -26,7 +26,18 @@
 #include "i2s_freertos.h"
 #include "../include/spiram_fifo.h"
 #include "playerconfig.h"
+#include "quality.h"
+#include "pipeline.h"
+#include "drift.h"
+#include "resample.h"
+#include "rateconv.h"
+#include "worker.h"
+#include "pcmring.h"
+#include "playpos.h"
 #include <string.h>
+#ifdef ADAPTIVE_QUALITY
+#include "xtensa/hal.h"
+#endif
 
 
 const char streamHost[]=PLAY_SERVER;
@@ -36,14 +47,33 @@ const int streamPort=PLAY_PORT;
 //Priorities of the reader and the decoder thread. Higher = higher prio.
 #define PRIO_READER 11
 #define PRIO_MAD 1
+//Priority of the synthesis thread, when it runs separately
+#define PRIO_SYNTH 1
+//Priority of the output thread. Above the decoder, so the DMA buffers get refilled in time.
+#define PRIO_OUTPUT 2
 
 
+#ifndef FAKE_SPI_BUFF
 //The mp3 read buffer size. 2106 bytes should be enough for up to 48KHz mp3s according to the sox sources. Used by libmad.
 #define READBUFSZ (2106)
 static char readBuf[READBUFSZ]; 
+#endif
 
 static long bufUnderrunCt;
 
+//Stream time of the start of the frame being synthesized and its duration, and the stream time of
+//the frame after it. Frames of silence have a duration of 0, so the stream time stands still while
+//they play.
+static mad_timer_t frameTime, frameDuration;
+static mad_timer_t nextFrameTime;
+
+#ifdef DUAL_CORE_PIPELINE
+//Header and options of the last decoded frame. Silent frames get these, so they have the same length
+//and sample rate as the audio around them.
+static struct mad_header lastHeader;
+static int lastOptions;
+#endif
+
 
 //Reformat the 16-bit mono sample to a format we can send to I2S.
 static int sampToI2s(short s) {
@@ -102,102 +132,233 @@ static int sampToI2sDeltaSigma(short s) {
 
 
 
-//Calculate the number of samples that we add or delete. Added samples means a slightly lower
-//playback rate, deleted samples means we increase playout speed a bit. This returns an
-//8.24 fixed-point number
-int recalcAddDelSamp(int oldVal) {
-	int ret;
-	long prevUdr=0;
-	static int cnt;
-	int i;
-	static int minFifoFill=0;
-
-	i=spiRamFifoFill();
-	if (i<minFifoFill) minFifoFill=i;
-
-	//Do the rest of the calculations plusminus every 100mS (assuming a sample rate of 44KHz)
-	cnt++;
-	if (cnt<1500) return oldVal;
-	cnt=0;
-
-	if (spiRamFifoLen()<10*1024) {
-		//The FIFO is very small. We can't do calculations on how much it's filled on average, so another
-		//algorithm is called for.
-		int tgt=1600; //we want an average of this amount of bytes as the average minimum buffer fill
-		//Calculate underruns this cycle
-		int udr=spiRamGetUnderrunCt()-prevUdr;
-		//If we have underruns, the minimum buffer fill has been lower than 0.
-		if (udr!=0) minFifoFill=-1;
-		//If we're below our target decrease playback speed, and vice-versa.
-		ret=oldVal+((minFifoFill-tgt)*ADD_DEL_BUFFPERSAMP_NOSPIRAM);
-		prevUdr+=udr;
-		minFifoFill=9999;
-	} else {
-		//We have a larger FIFO; we can adjust according to the FIFO fill rate.
-		int tgt=spiRamFifoLen()/2;
-		ret=(spiRamFifoFill()-tgt)*ADD_DEL_BUFFPERSAMP;
-	}
-	return ret;
-}
+//Sets the needed output sample rate.
+static int oldRate=0;
+static void setDacSampleRate(int rate) {
+	if (rate==oldRate) return;
+	oldRate=rate;
+	printf("Rate %d\n", rate);
 
+#ifdef ALLOW_VARY_SAMPLE_BITS
+	i2sSetRate(rate, 1);
+#else
+	i2sSetRate(rate, 0);
+#endif
+}
 
+//Get (the rest of) a DMA buffer to write samples into. The time spent waiting for a free buffer
+//is not decode load, so the quality controller gets told about it. With OUTPUT_TASK, it's the
+//output task that waits here instead of the decoder.
+static uint32_t *borrowDmaBuffer(int *len) {
+#if defined(ADAPTIVE_QUALITY) && !defined(OUTPUT_TASK)
+	unsigned int t=xthal_get_ccount();
+	uint32_t *buf=i2sBorrowBuffer(len);
+	qualityAddIdle(xthal_get_ccount()-t);
+	return buf;
+#else
+	return i2sBorrowBuffer(len);
+#endif
+}
 
-//This routine is called by the NXP modifications of libmad. It passes us (for the mono synth)
-//32 16-bit samples.
-void render_sample_block(short *short_sample_buff, int no_samples) {
-	//Signed 16.16 fixed point number: the amount of samples we need to add or delete
-	//in every 32-sample 
-	static int sampAddDel=0;
-	//Remainder of sampAddDel cumulatives
-	static int sampErr=0;
-	int i;
+//Convert len 16-bit mono samples for the I2S port and output them. The block starts at stream time
+//time and covers duration of it.
+static void outputPcm(const short *p, int len, int rate, mad_timer_t time, mad_timer_t duration) {
+#if defined(FIXED_OUTPUT_RATE)
+	//Rate-converted version of (part of) the block
+	static short rsBuf[RATECONV_MAX_OUT];
+#elif defined(CLOCK_DRIFT_CORRECTION)
+	//Resampled version of (part of) the block
+	static short rsBuf[RESAMPLE_MAX_OUT];
+#endif
+#if defined(FIXED_OUTPUT_RATE) || defined(CLOCK_DRIFT_CORRECTION)
+	unsigned int step;
+	int n;
+#endif
+	const short *s, *e;
+	uint32_t *out;
+	int outLen, outPos=0;
 	int samp;
-
-#ifdef ADD_DEL_SAMPLES
-	sampAddDel=recalcAddDelSamp(sampAddDel);
+	unsigned int start;
+
+#ifdef FIXED_OUTPUT_RATE
+	//The I2S port always runs at the same rate; the rate converter takes care of the rest.
+	setDacSampleRate(FIXED_OUTPUT_RATE);
+	step=rateConvSetRate(rate);
+#ifdef CLOCK_DRIFT_CORRECTION
+	//Play a tiny bit faster or slower depending on how full the mp3 buffer is, to follow the
+	//sample clock of the server. This just changes the conversion ratio a bit.
+	step=((uint64_t)step*driftUpdate(spiRamFifoFill()))>>24;
+#endif
+#else
+	setDacSampleRate(rate);
+#ifdef CLOCK_DRIFT_CORRECTION
+	//Play a tiny bit faster or slower depending on how full the mp3 buffer is, to follow the
+	//sample clock of the server.
+	step=driftUpdate(spiRamFifoFill());
+#endif
 #endif
 
-
-	sampErr+=sampAddDel;
-	for (i=0; i<no_samples; i++) {
+	//Convert straight into the I2S DMA buffer memory.
+	start=i2sGetSamplesWritten();
+	out=borrowDmaBuffer(&outLen);
+	while (len>0) {
+#if defined(FIXED_OUTPUT_RATE)
+		n=rateConvMaxIn(step);
+		if (n>len) n=len;
+		s=rsBuf;
+		e=rsBuf+rateConvBlock(p, n, rsBuf, step);
+		p+=n;
+		len-=n;
+#elif defined(CLOCK_DRIFT_CORRECTION)
+		n=(len>RESAMPLE_MAX_IN)?RESAMPLE_MAX_IN:len;
+		s=rsBuf;
+		e=rsBuf+resampleBlock(p, n, rsBuf, step);
+		p+=n;
+		len-=n;
+#else
+		s=p;
+		e=p+len;
+		len=0;
+#endif
+		while (s!=e) {
 #if defined(PWM_HACK)
-		samp=sampToI2sPwm(short_sample_buff[i]);
+			samp=sampToI2sPwm(*s++);
 #elif defined(DELTA_SIGMA_HACK)
-		samp=sampToI2sDeltaSigma(short_sample_buff[i]);
+			samp=sampToI2sDeltaSigma(*s++);
 #else
-		samp=sampToI2s(short_sample_buff[i]);
-#endif
-		//Dependent on the amount of buffer we have too much or too little, we're going to add or remove
-		//samples. This basically does error diffusion on the sample added or removed.
-		if (sampErr>(1<<24)) {
-			sampErr-=(1<<24);
-			//...and don't output an i2s sample
-		} else if (sampErr<-(1<<24)) {
-			sampErr+=(1<<24);
-			//..and output 2 samples instead of one.
-			i2sPushSample(samp);
-			i2sPushSample(samp);
-		} else {
-			//Just output the sample.
-			i2sPushSample(samp);
+			samp=sampToI2s(*s++);
+#endif
+			if (outPos==outLen) {
+				//DMA buffer is full; hand it over and get the next one.
+				i2sCommitBuffer(outPos);
+				out=borrowDmaBuffer(&outLen);
+				outPos=0;
+			}
+			out[outPos++]=samp;
 		}
 	}
+	i2sCommitBuffer(outPos);
+	//Remember where in the output this block ended up, for the playback position.
+	playPosAddBlock(start, i2sGetSamplesWritten(), time, duration);
 }
 
-//Called by the NXP modificationss of libmad. Sets the needed output sample rate.
-static int oldRate=0;
-void set_dac_sample_rate(int rate) {
-	if (rate==oldRate) return;
-	oldRate=rate;
-	printf("Rate %d\n", rate);
+#ifdef OUTPUT_TASK
+//Sample rate of the last decoded frame, for blocks of silence
+static int lastRate=44100;
+
+//Get a block in the output ring to put samples into. Waiting for the output task to free one up
+//is not decode load either.
+static struct pcmBlock *borrowPcmBlock() {
+#ifdef ADAPTIVE_QUALITY
+	unsigned int t=xthal_get_ccount();
+	struct pcmBlock *b=pcmRingBorrow();
+	qualityAddIdle(xthal_get_ccount()-t);
+	return b;
+#else
+	return pcmRingBorrow();
+#endif
+}
+#endif
 
-#ifdef ALLOW_VARY_SAMPLE_BITS
-	i2sSetRate(rate, 0);
+//Give the frame that's about to be synthesized its timestamp: the sum of the durations of all frames
+//before it.
+static void stampFrame(struct mad_header const *header) {
+	frameTime=nextFrameTime;
+	frameDuration=header->duration;
+	mad_timer_add(&nextFrameTime, header->duration);
+}
+
+//PCM sink for libmad. The synth calls this once per decoded frame with all of its samples
+//(1152 for MPEG1, 576 for MPEG2) mixed down to 16-bit mono.
+static void renderPcm(void *data, struct mad_pcm const *pcm) {
+#ifdef OUTPUT_TASK
+	//Hand the samples over to the output task.
+	struct pcmBlock *b=borrowPcmBlock();
+	b->samplerate=pcm->samplerate;
+	b->length=pcm->length;
+	b->time=frameTime;
+	b->duration=frameDuration;
+	memcpy(b->samples, pcm->samples, pcm->length*sizeof(short));
+	pcmRingCommit();
+	lastRate=pcm->samplerate;
 #else
-	i2sSetRate(rate, 1);
+	outputPcm(pcm->samples, pcm->length, pcm->samplerate, frameTime, frameDuration);
+#endif
+}
+
+static const struct mad_pcm_sink pcmSink={
+	.layout=MAD_PCM_LAYOUT_MONO,
+	.format=MAD_PCM_FORMAT_S16,
+	.write=renderPcm,
+	.data=NULL
+};
+
+//There's no mp3 data to decode. Output some silence, which also makes us wait for a while.
+static void outputSilence() {
+#ifdef DUAL_CORE_PIPELINE
+	//Only the synthesis task may write to I2S. Send a frame of silence down the pipeline instead; it has
+	//its own zeroed subband samples, so the overlap buffers of the decoder are left alone.
+	struct mad_frame *frame=pipelineGetFree();
+	frame->header=lastHeader;
+	//It's not part of the stream, so it takes no stream time.
+	frame->header.duration=mad_timer_zero;
+	frame->options=lastOptions;
+	memset(frame->sbsample, 0, sizeof(frame->sbsample));
+	pipelinePutDecoded(frame);
+#elif defined(OUTPUT_TASK)
+	//Only the output task may write to I2S. Queue a block of silence instead.
+	struct pcmBlock *b=pcmRingBorrow();
+	b->samplerate=lastRate;
+	b->length=441*2;
+	b->time=nextFrameTime;
+	b->duration=mad_timer_zero;
+	memset(b->samples, 0, b->length*sizeof(short));
+	pcmRingCommit();
+#else
+	//This waits for about 20mS
+	int n;
+	for (n=0; n<441*2; n++) i2sPushSample(0);
 #endif
 }
 
+#ifdef FAKE_SPI_BUFF
+//The FIFO lives in internal RAM, so libmad can decode straight from the FIFO memory. Release what libmad
+//is done with and point it at the data that's left, without copying anything.
+static enum  mad_flow input(struct mad_stream *stream) {
+	const char *p;
+	int n, fill;
+	int need=1;
+	if (stream->buffer!=NULL) {
+		//Give back the bytes that were decoded from the previous span
+		n=stream->next_frame-stream->buffer;
+		spiRamFifoSkip(n);
+		//If libmad couldn't use any of it, the frame at the start isn't complete yet; handing it the
+		//same bytes again would just spin. It needs at least one byte more.
+		if (n==0) need=stream->bufend-stream->buffer+1;
+		if (need>SPIRAM_FIFO_MAXSPAN) need=SPIRAM_FIFO_MAXSPAN;
+	}
+
+	fill=spiRamFifoFill();
+	while (fill<need) {
+		//Sleep until the data comes in, but not much longer than it takes to play a bit of silence.
+		if (fill!=0) fill=spiRamFifoWaitFill(need, 20/portTICK_RATE_MS);
+		if (fill<need) {
+			//Not enough data in the buffer. This only happens when the data feed rate is too low, and
+			//shouldn't normally be needed!
+			bufUnderrunCt++;
+			//We both silence the output as well as wait a while by pushing silent samples into the i2s system.
+			outputSilence();
+			fill=spiRamFifoFill();
+		}
+	}
+
+	//Okay, let MAD decode what's in the FIFO, even if it's not a full span: any complete frame in there
+	//can be decoded already.
+	p=spiRamFifoPeek(&n);
+	mad_stream_buffer(stream, (unsigned char const *)p, n);
+	return MAD_FLOW_CONTINUE;
+}
+#else
 static enum  mad_flow input(struct mad_stream *stream) {
 	int n, i;
 	int rem, fifoLen;
@@ -215,8 +376,7 @@ static enum  mad_flow input(struct mad_stream *stream) {
 //			printf("Buf uflow, need %d bytes.\n", sizeof(readBuf)-rem);
 			bufUnderrunCt++;
 			//We both silence the output as well as wait a while by pushing silent samples into the i2s system.
-			//This waits for about 200mS
-			for (n=0; n<441*2; n++) i2sPushSample(0);
+			outputSilence();
 		} else {
 			//Read some bytes from the FIFO to re-fill the buffer.
 			spiRamFifoRead(&readBuf[rem], n);
@@ -229,6 +389,8 @@ static enum  mad_flow input(struct mad_stream *stream) {
 	return MAD_FLOW_CONTINUE;
 }
 
+#endif
+
 //Routine to print out an error
 static enum mad_flow error(void *data, struct mad_stream *stream, struct mad_frame *frame) {
 	printf("dec err 0x%04x (%s)\n", stream->error, mad_stream_errorstr(stream));
@@ -236,36 +398,133 @@ static enum mad_flow error(void *data, struct mad_stream *stream, struct mad_fra
 }
 
 
+#ifdef OUTPUT_TASK
+//Output task. Takes the blocks of samples the decoder puts in the output ring, converts them for the
+//I2S port and feeds them to the DMA buffers. A rate change ends up in printf (see setDacSampleRate),
+//so this needs as much stack as the other tasks that output samples.
+static void tskoutput(void *pvParameters) {
+	struct pcmBlock *b;
+	while(1) {
+		b=pcmRingPeek();
+		outputPcm(b->samples, b->length, b->samplerate, b->time, b->duration);
+		pcmRingRelease();
+	}
+}
+#endif
+
+#ifdef DUAL_CORE_PIPELINE
+//Synthesis task. Takes the frames the decoder task puts in the pipeline, turns them into PCM and
+//outputs that to the I2S port.
+static void tsksynth(void *pvParameters) {
+	struct mad_synth *synth=pvParameters;
+	struct mad_frame *frame;
+	while(1) {
+		frame=pipelineGetDecoded();
+#ifdef ADAPTIVE_QUALITY
+		qualityFrameStart();
+#endif
+		stampFrame(&frame->header);
+		mad_synth_frame(synth, frame);
+#ifdef ADAPTIVE_QUALITY
+		qualityFrameEnd(synth->pcm.length, synth->pcm.samplerate);
+#endif
+		pipelinePutFree(frame);
+	}
+}
+#endif
+
 //This is the main mp3 decoding task. It will grab data from the input buffer FIFO in the SPI ram and
-//output it to the I2S port.
+//output it to the I2S port. With DUAL_CORE_PIPELINE, it only decodes, and the output is done by
+//the synthesis task.
 static void tskmad(void *pvParameters) {
 	int r;
+#if defined(DUAL_CORE_PIPELINE) && defined(ADAPTIVE_QUALITY)
+	unsigned int t;
+#endif
+	struct sync_t *dec;
 	struct mad_stream *stream;
 	struct mad_frame *frame;
 	struct mad_synth *synth;
+#ifdef CHANNEL_PARALLEL
+	struct mad_worker const *worker;
+#endif
 
-	//Allocate structs needed for mp3 decoding
-	stream=malloc(sizeof(struct mad_stream));
-	frame=malloc(sizeof(struct mad_frame));
-	synth=malloc(sizeof(struct mad_synth));
-
-	if (stream==NULL) { printf("MAD: malloc(stream) failed\n"); return; }
-	if (synth==NULL) { printf("MAD: malloc(synth) failed\n"); return; }
-	if (frame==NULL) { printf("MAD: malloc(frame) failed\n"); return; }
+	//Allocate the decoder context. It holds everything mp3 decoding needs, including the
+	//Layer III bit reservoir and overlap buffers, so more decoders can run side by side.
+	dec=malloc(sizeof(struct sync_t));
+	if (dec==NULL) { printf("MAD: malloc(dec) failed\n"); return; }
+	stream=&dec->stream;
+	frame=&dec->frame;
+	synth=&dec->synth;
+#ifdef DUAL_CORE_PIPELINE
+	frame=NULL;
+#endif
 
 	//Initialize I2S
 	i2sInit();
+#ifdef I2S_UNDERRUN_SILENCE
+	//Tell the I2S code what silence looks like for our kind of output
+#if defined(PWM_HACK)
+	i2sSetSilence(sampToI2sPwm(0));
+#elif defined(DELTA_SIGMA_HACK)
+	i2sSetSilence(sampToI2sDeltaSigma(0));
+#else
+	i2sSetSilence(sampToI2s(0));
+#endif
+#endif
+	playPosInit();
+	nextFrameTime=mad_timer_zero;
+#ifdef CLOCK_DRIFT_CORRECTION
+	resampleInit();
+	driftInit(spiRamFifoLen()/2);
+#endif
+#ifdef FIXED_OUTPUT_RATE
+	rateConvInit(FIXED_OUTPUT_RATE);
+#endif
+#ifdef OUTPUT_TASK
+	if (!pcmRingInit()) { printf("MAD: pcmRingInit failed\n"); return; }
+	if (xTaskCreatePinnedToCore(tskoutput, "tskoutput", 4096, NULL, PRIO_OUTPUT, NULL, OUTPUT_TASK_CORE)!=pdPASS) printf("ERROR creating output task! Out of memory?\n");
+#endif
 
 	bufUnderrunCt=0;
 
 	printf("MAD: Decoder start.\n");
 	//Initialize mp3 parts
-	mad_stream_init(stream);
-	mad_frame_init(frame);
-	mad_synth_init(synth);
+	mad_sync_init(dec);
+	mad_synth_sink(synth, &pcmSink);
+#ifdef CHANNEL_PARALLEL
+	worker=workerInit(1, PRIO_MAD);
+	if (worker==NULL) printf("MAD: workerInit failed, decoding on one core\n");
+	mad_stream_worker(stream, worker);
+#ifndef DUAL_CORE_PIPELINE
+	//The synthesis task already runs on the worker's core in pipeline mode.
+	mad_synth_worker(synth, worker);
+#endif
+#endif
+#ifdef ADAPTIVE_QUALITY
+	qualityInit();
+#endif
+#ifdef DUAL_CORE_PIPELINE
+	if (!pipelineInit(dec)) { printf("MAD: pipelineInit failed\n"); return; }
+	mad_header_init(&lastHeader);
+	lastHeader.layer=MAD_LAYER_III;
+	lastHeader.samplerate=44100;
+	lastOptions=0;
+	if (xTaskCreatePinnedToCore(tsksynth, "tsksynth", 4096, synth, PRIO_SYNTH, NULL, 1)!=pdPASS) printf("ERROR creating synth task! Out of memory?\n");
+#endif
 	while(1) {
 		input(stream); //calls mad_stream_buffer internally
 		while(1) {
+#ifdef DUAL_CORE_PIPELINE
+			//Get a frame to decode into, if we don't have one left over from a failed decode.
+			if (frame==NULL) frame=pipelineGetFree();
+#ifdef ADAPTIVE_QUALITY
+			mad_stream_options(stream, qualityGetOptions());
+			t=xthal_get_ccount();
+#endif
+#elif defined(ADAPTIVE_QUALITY)
+			qualityFrameStart();
+#endif
 			r=mad_frame_decode(frame, stream);
 			if (r==-1) {
 	 			if (!MAD_RECOVERABLE(stream->error)) {
@@ -275,7 +534,22 @@ static void tskmad(void *pvParameters) {
 				error(NULL, stream, frame);
 				continue;
 			}
+#ifdef DUAL_CORE_PIPELINE
+#ifdef ADAPTIVE_QUALITY
+			qualityDecodeCycles(xthal_get_ccount()-t);
+#endif
+			lastHeader=frame->header;
+			lastOptions=frame->options;
+			pipelinePutDecoded(frame);
+			frame=NULL;
+#else
+			stampFrame(&frame->header);
 			mad_synth_frame(synth, frame);
+#ifdef ADAPTIVE_QUALITY
+			//Pick the decode options for the next frame
+			mad_stream_options(stream, qualityFrameEnd(synth->pcm.length, synth->pcm.samplerate));
+#endif
+#endif
 		}
 	}
 }
@@ -339,6 +613,9 @@ static void tskreader(void *pvParameters) {
 	int t=0;
 	int fd;
 	int c=0;
+	int isrCycles, wakeUs;
+	mad_timer_t pos;
+	int queued;
 	while(1) {
 		fd=openConn(streamHost, streamPath);
 		printf("Reading into SPI RAM FIFO...\n");
@@ -353,7 +630,27 @@ static void tskreader(void *pvParameters) {
 			}
 			
 			t=(t+1)&255;
-			if (t==0) printf("Buffer fill %d, DMA underrun ct %d, buff underrun ct %ld\n", spiRamFifoFill(), (int)i2sGetUnderrunCnt(), bufUnderrunCt);
+			if (t==0) {
+				printf("Buffer fill %d, DMA underrun ct %d, buff underrun ct %ld\n", spiRamFifoFill(), (int)i2sGetUnderrunCnt(), bufUnderrunCt);
+				i2sGetTimingStats(&isrCycles, &wakeUs);
+				printf("I2S ISR max %d cycles, DMA buffer wakeup max %d uS\n", isrCycles, wakeUs);
+				if (oldRate!=0 && playPosGet(&pos)) {
+					queued=i2sGetQueuedSamples();
+					//The queued samples play at the rate of the I2S port, which with FIXED_OUTPUT_RATE isn't
+					//the rate of the stream.
+					printf("Stream position %ld ms, output latency %d samples (%d ms)\n", mad_timer_count(pos, MAD_UNITS_MILLISECONDS), queued, queued*1000/i2sGetRate());
+				}
+#ifdef OUTPUT_TASK
+				printf("Output ring fill %d, underrun ct %ld\n", pcmRingFill(), pcmRingGetUnderrunCt());
+#endif
+#ifdef CLOCK_DRIFT_CORRECTION
+				printf("Clock drift correction %d ppm\n", driftGetPpm());
+#endif
+#ifdef ADAPTIVE_QUALITY
+				printf("Quality level %d, decode load %d%%, steps down %ld up %ld\n", qualityGetLevel(), qualityGetLoad(), qualityGetStepDownCt(), qualityGetStepUpCt());
+#endif
+				printf("Reader stack free %d bytes\n", (int)uxTaskGetStackHighWaterMark(NULL));
+			}
 		} while (n>0);
 		close(fd);
 		printf("Connection closed.\n");
@@ -366,8 +663,9 @@ static void tskconnect(void *pvParameters) {
 	vTaskDelay(3000/portTICK_RATE_MS);
 
 	//Fire up the reader task. The reader task will fire up the MP3 decoder as soon
-	//as it has read enough MP3 data.
-	if (xTaskCreate(tskreader, "tskreader", 2300, NULL, PRIO_READER, NULL)!=pdPASS) printf("Error creating reader task!\n");
+	//as it has read enough MP3 data. Its status report does a fair bit of printf, so it gets some more
+	//stack than the 2300 bytes it used to have; it prints how much of that is never used.
+	if (xTaskCreate(tskreader, "tskreader", 3072, NULL, PRIO_READER, NULL)!=pdPASS) printf("Error creating reader task!\n");
 	printf("reader created!\n");
 	//We're done. Delete this task.
 	vTaskDelete(NULL);
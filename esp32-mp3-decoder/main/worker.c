@@ -0,0 +1,59 @@
+/******************************************************************************
+ * FileName: worker.c
+ *
+ * Description: Worker task on the second core for libmad. For stereo frames,
+ * libmad hands the Layer III reordering, IMDCT and overlap-add of channel 1
+ * (and, for interleaved output, its synthesis) to this task and does channel 0
+ * itself in the meantime, so a frame takes less time to decode.
+ *
+*******************************************************************************/
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <stddef.h>
+
+#include "mad.h"
+#include "worker.h"
+
+//Given by workerStart to have the task run the job, given by the task when it's done
+static xSemaphoreHandle semStart;
+static xSemaphoreHandle semDone;
+static void (*workerJob)(void *);
+static void *workerArg;
+
+
+static void tskworker(void *pvParameters) {
+	while(1) {
+		xSemaphoreTake(semStart, portMAX_DELAY);
+		workerJob(workerArg);
+		xSemaphoreGive(semDone);
+	}
+}
+
+static void workerStart(void *data, void (*job)(void *), void *arg) {
+	workerJob=job;
+	workerArg=arg;
+	xSemaphoreGive(semStart);
+}
+
+static void workerWait(void *data) {
+	xSemaphoreTake(semDone, portMAX_DELAY);
+}
+
+static const struct mad_worker worker={
+	.start=workerStart,
+	.wait=workerWait,
+	.data=NULL
+};
+
+//Start the worker task on the given core. Returns the worker to give to mad_stream_worker and
+//mad_synth_worker, or NULL if the task couldn't be started.
+struct mad_worker const *workerInit(int core, int prio) {
+	vSemaphoreCreateBinary(semStart);
+	vSemaphoreCreateBinary(semDone);
+	if (semStart==NULL || semDone==NULL) return NULL;
+	xSemaphoreTake(semStart, 0);
+	xSemaphoreTake(semDone, 0);
+	if (xTaskCreatePinnedToCore(tskworker, "tskworker", 4096, NULL, prio, NULL, core)!=pdPASS) return NULL;
+	return &worker;
+}